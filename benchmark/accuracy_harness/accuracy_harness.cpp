@@ -0,0 +1,478 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "bricks_dsp/bricks.h"
+#include "bricks_dsp/fft.h"
+
+/* Measures the error of the approximations and interpolators in bricks_dsp
+ * together with their cost, and prints a table per category with the
+ * pareto optimal variants marked, i.e. the ones where no other variant is
+ * both cheaper and more accurate. Optionally writes the table as markdown to
+ * the file given as the first argument.
+ *
+ * Metrics, all in dB:
+ * snr       - Reference signal power / error power
+ * thd       - Harmonics of the test tone / test tone
+ * alias     - Everything that is not the test tone or harmonics / test tone
+ * resp_dev  - Max deviation of the test tone gain from the expected gain
+ * Each is the worst case over several test frequencies. Not applicable
+ * metrics are printed as "-", as is ns/op for variants that are not compiled
+ * in and can only be evaluated for accuracy. */
+
+using namespace bricks;
+
+namespace {
+
+constexpr double SAMPLERATE = 48000;
+constexpr int FFT_SIZE = 8192;
+constexpr int TIMING_SAMPLES = 1 << 20;
+constexpr int TIMING_RUNS = 5;
+
+struct Measurement
+{
+    std::string category;
+    std::string name;
+    /* Not all metrics apply to all categories */
+    std::optional<float> snr;
+    std::optional<float> thd;
+    std::optional<float> alias;
+    std::optional<float> resp_dev;
+    /* Not set for variants that are only evaluated for accuracy */
+    std::optional<float> ns_per_op;
+    /* Higher is better, used for finding pareto optimal variants */
+    float quality{0};
+    bool pareto{false};
+};
+
+float to_db(double power_ratio)
+{
+    return static_cast<float>(10.0 * std::log10(std::max(power_ratio, 1.0e-30)));
+}
+
+/* Runs fun TIMING_RUNS times and returns the fastest time in ns per op */
+float time_ns_per_op(const std::function<float()>& fun, int ops)
+{
+    double best = std::numeric_limits<double>::max();
+    volatile float sink = 0;
+    for (int run = 0; run < TIMING_RUNS; ++run)
+    {
+        auto start = std::chrono::steady_clock::now();
+        sink = sink + fun();
+        auto end = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double, std::nano>(end - start).count());
+    }
+    return static_cast<float>(best / ops);
+}
+
+struct ToneAnalysis
+{
+    double thd_ratio;
+    double alias_ratio;
+    double gain;
+};
+
+/* Analyse a signal containing a tone at exactly bin k0 of FFT_SIZE */
+ToneAnalysis analyse_tone(const std::vector<float>& signal, int k0)
+{
+    static RealFft fft(FFT_SIZE);
+    std::vector<float> windowed(FFT_SIZE);
+    std::vector<float> re(fft.bins());
+    std::vector<float> im(fft.bins());
+
+    /* Tone gain by correlation, exact as the tone has an integer number of cycles */
+    double c = 0;
+    double s = 0;
+    for (int n = 0; n < FFT_SIZE; ++n)
+    {
+        double w = 2.0 * M_PI * k0 * n / FFT_SIZE;
+        c += signal[n] * std::cos(w);
+        s += signal[n] * std::sin(w);
+    }
+    double gain = 2.0 * std::sqrt(c * c + s * s) / FFT_SIZE;
+
+    /* Hann windowed spectrum for separating harmonics from the rest */
+    for (int n = 0; n < FFT_SIZE; ++n)
+    {
+        windowed[n] = signal[n] * 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * n / FFT_SIZE));
+    }
+    fft.forward(windowed.data(), re.data(), im.data());
+
+    /* Bins within this distance of a tone are counted as part of it, Hann leaks into the neighbouring bin */
+    constexpr int TONE_WIDTH = 2;
+    std::vector<int> owner(fft.bins(), 0);
+    for (int h = 1; h <= 10; ++h)
+    {
+        /* Fold harmonics above nyquist */
+        int k = (h * k0) % FFT_SIZE;
+        k = k > FFT_SIZE / 2 ? FFT_SIZE - k : k;
+        for (int b = std::max(0, k - TONE_WIDTH); b <= std::min(FFT_SIZE / 2, k + TONE_WIDTH); ++b)
+        {
+            if (owner[b] == 0)
+            {
+                owner[b] = h;
+            }
+        }
+    }
+
+    double tone = 0;
+    double harmonics = 0;
+    double rest = 0;
+    /* Skip DC */
+    for (int b = 1; b < fft.bins(); ++b)
+    {
+        double power = re[b] * re[b] + im[b] * im[b];
+        if (owner[b] == 1)
+        {
+            tone += power;
+        }
+        else if (owner[b] > 1)
+        {
+            harmonics += power;
+        }
+        else
+        {
+            rest += power;
+        }
+    }
+    return {harmonics / tone, rest / tone, gain};
+}
+
+/* Output tone frequencies as fft bins, chosen so that the input tones are
+ * at 0.01 to 0.2 of the samplerate, i.e. up to ~10kHz at 48kHz */
+const std::vector<int> TEST_BINS = {60, 300, 599, 1199};
+
+/* Resample a sine with a non integer ratio, so that all fractional positions are used */
+template <typename Interpolator>
+Measurement measure_interpolator(const std::string& name)
+{
+    constexpr double RATIO = 0.7316;
+    constexpr int MARGIN = 4;
+    Measurement m{"Interpolation", name};
+    float snr = std::numeric_limits<float>::max();
+    float thd = -std::numeric_limits<float>::max();
+    float alias = -std::numeric_limits<float>::max();
+    float resp_dev = 0;
+
+    int input_len = static_cast<int>(FFT_SIZE * RATIO) + 2 * MARGIN;
+    for (int k0 : TEST_BINS)
+    {
+        double out_freq = static_cast<double>(k0) / FFT_SIZE;
+        double in_freq = out_freq / RATIO;
+        std::vector<float> input(input_len);
+        for (int i = 0; i < input_len; ++i)
+        {
+            input[i] = std::sin(2.0 * M_PI * in_freq * (i - MARGIN));
+        }
+
+        Interpolator interpolator;
+        std::vector<float> output(FFT_SIZE);
+        double signal_power = 0;
+        double error_power = 0;
+        for (int n = 0; n < FFT_SIZE; ++n)
+        {
+            double pos = n * RATIO;
+            output[n] = interpolator.interpolate(static_cast<float>(pos + MARGIN), input.data());
+            double ref = std::sin(2.0 * M_PI * in_freq * pos);
+            signal_power += ref * ref;
+            error_power += (output[n] - ref) * (output[n] - ref);
+        }
+        auto analysis = analyse_tone(output, k0);
+        snr = std::min(snr, to_db(signal_power / error_power));
+        thd = std::max(thd, to_db(analysis.thd_ratio));
+        alias = std::max(alias, to_db(analysis.alias_ratio));
+        resp_dev = std::max(resp_dev, std::abs(2.0f * to_db(analysis.gain)));
+    }
+    m.snr = snr;
+    m.thd = thd;
+    m.alias = alias;
+    m.resp_dev = resp_dev;
+
+    /* Timing, reading a long buffer of noise at a non integer ratio */
+    std::vector<float> noise(static_cast<int>(TIMING_SAMPLES * RATIO) + 2 * MARGIN);
+    RandomDevice rand_device;
+    for (auto& sample : noise)
+    {
+        sample = rand_device.get_norm();
+    }
+    m.ns_per_op = time_ns_per_op([&]()
+    {
+        Interpolator interpolator;
+        float sum = 0;
+        float pos = MARGIN;
+        for (int n = 0; n < TIMING_SAMPLES; ++n)
+        {
+            sum += interpolator.interpolate(pos, noise.data());
+            pos += static_cast<float>(RATIO);
+        }
+        return sum;
+    }, TIMING_SAMPLES);
+    m.quality = *m.snr;
+    return m;
+}
+
+/* Gain of a 1 pole lowpass at its nominal cutoff, for an analog RC filter it's -3.01 dB.
+ * The reference is the exact coefficient in double precision */
+Measurement measure_rc_stage(const std::string& name, bool approx)
+{
+    Measurement m{"RCStage coefficient", name};
+    float snr = std::numeric_limits<float>::max();
+    float resp_dev = 0;
+    const std::vector<double> cutoffs = {50, 200, 1000, 5000};
+
+    for (double cutoff : cutoffs)
+    {
+        double rc = 1.0 / (2.0 * M_PI * cutoff);
+        RCStage<float> stage;
+        RCStage<double> reference;
+        reference.set(rc, SAMPLERATE, true);
+        if (approx)
+        {
+            stage.set_approx(static_cast<float>(rc), SAMPLERATE, true);
+        }
+        else
+        {
+            stage.set(static_cast<float>(rc), SAMPLERATE, true);
+        }
+
+        /* Steady state gain at the cutoff frequency */
+        double c = 0;
+        double s = 0;
+        double signal_power = 0;
+        double error_power = 0;
+        int settle = static_cast<int>(20 * rc * SAMPLERATE);
+        int periods = static_cast<int>(SAMPLERATE / cutoff) * 10;
+        for (int n = 0; n < settle + periods; ++n)
+        {
+            double w = 2.0 * M_PI * cutoff * n / SAMPLERATE;
+            double in = std::sin(w);
+            float out = stage.render_lp(static_cast<float>(in));
+            double ref = reference.render_lp(in);
+            if (n >= settle)
+            {
+                c += out * std::cos(w);
+                s += out * std::sin(w);
+                signal_power += ref * ref;
+                error_power += (out - ref) * (out - ref);
+            }
+        }
+        double gain = 2.0 * std::sqrt(c * c + s * s) / periods;
+        resp_dev = std::max(resp_dev, std::abs(2.0f * to_db(gain) + 3.0103f));
+        snr = std::min(snr, to_db(signal_power / error_power));
+    }
+    m.snr = snr;
+    m.resp_dev = resp_dev;
+
+    /* Cost of calculating the coefficient, i.e. for modulating the rc constant every block */
+    constexpr int CALLS = 1 << 16;
+    m.ns_per_op = time_ns_per_op([&]()
+    {
+        RCStage<float> stage;
+        float sum = 0;
+        for (int n = 0; n < CALLS; ++n)
+        {
+            float rc = 0.0001f + n * 1.0e-8f;
+            approx ? stage.set_approx(rc, SAMPLERATE, false) : stage.set(rc, SAMPLERATE, false);
+            sum += stage.render_lp(1.0f);
+        }
+        return sum;
+    }, CALLS);
+    m.quality = *m.snr;
+    return m;
+}
+
+constexpr double ONE_POLE_LAG_TIMECONSTANTS_PER_BLOCK = 2.5;
+
+/* SNR of the step response of a 1 pole lag over 4 blocks, compared to the exact exponential */
+float one_pole_lag_snr(const std::function<float(int)>& step_response)
+{
+    constexpr int LENGTH = PROC_BLOCK_SIZE;
+    double signal_power = 0;
+    double error_power = 0;
+    for (int n = 1; n <= 4 * LENGTH; ++n)
+    {
+        double ref = 1.0 - std::exp(-ONE_POLE_LAG_TIMECONSTANTS_PER_BLOCK * n / LENGTH);
+        double error = step_response(n) - ref;
+        signal_power += ref * ref;
+        error_power += error * error;
+    }
+    return to_db(signal_power / error_power);
+}
+
+/* The OnePoleLag compiled into the library, with the coefficient selected by
+ * BRICKS_DSP_CONSTEXPR_MATH, timed per sample rendered with get_all() */
+Measurement measure_one_pole_lag(const std::string& name)
+{
+    constexpr int LENGTH = PROC_BLOCK_SIZE;
+    Measurement m{"OnePoleLag coefficient", name};
+    std::vector<float> response;
+    OnePoleLag<LENGTH> lag;
+    AlignedArray<float, LENGTH> block;
+    lag.set(1.0f);
+    for (int b = 0; b < 4; ++b)
+    {
+        lag.get_all(block);
+        response.insert(response.end(), block.begin(), block.end());
+    }
+    m.snr = one_pole_lag_snr([&](int n) {return response[n - 1];});
+    m.ns_per_op = time_ns_per_op([&]()
+    {
+        float sum = 0;
+        for (int n = 0; n < TIMING_SAMPLES; n += LENGTH)
+        {
+            lag.set((n & (4 * LENGTH)) ? 1.0f : 0.0f);
+            lag.get_all(block);
+            sum += block[LENGTH - 1];
+        }
+        return sum;
+    }, TIMING_SAMPLES);
+    m.quality = *m.snr;
+    return m;
+}
+
+/* The coefficient OnePoleLag uses when built with the other setting of
+ * BRICKS_DSP_CONSTEXPR_MATH. It can't be instantiated in the same build,
+ * so it's only evaluated for accuracy, with the coefficients re-derived here */
+Measurement measure_one_pole_lag_accuracy(const std::string& name, bool exact_coeff)
+{
+    constexpr int LENGTH = PROC_BLOCK_SIZE;
+    Measurement m{"OnePoleLag coefficient", name};
+    float a0 = exact_coeff ? std::exp(-1.0f * ONE_POLE_LAG_TIMECONSTANTS_PER_BLOCK / LENGTH) :
+                             1.0f - ONE_POLE_LAG_TIMECONSTANTS_PER_BLOCK / LENGTH;
+    float b0 = 1.0f - a0;
+    std::vector<float> response;
+    float lag = 0;
+    for (int n = 1; n <= 4 * LENGTH; ++n)
+    {
+        lag = b0 + a0 * lag;
+        response.push_back(lag);
+    }
+    m.snr = one_pole_lag_snr([&](int n) {return response[n - 1];});
+    m.quality = *m.snr;
+    return m;
+}
+
+/* Gain curves compared to an exact 30 dB exponential curve */
+Measurement measure_gain_curve(const std::string& name, const std::function<float(float)>& curve)
+{
+    constexpr float DB_RANGE = 30.0f;
+    constexpr float MIN_LEVEL = 0.05f;
+    Measurement m{"Gain curve (30 dB)", name};
+    float resp_dev = 0;
+    for (float lin = MIN_LEVEL; lin <= 1.0f; lin += 0.001f)
+    {
+        float ref_db = (lin - 1.0f) * DB_RANGE;
+        float db = 20.0f * std::log10(curve(lin));
+        resp_dev = std::max(resp_dev, std::abs(db - ref_db));
+    }
+    m.resp_dev = resp_dev;
+    m.ns_per_op = time_ns_per_op([&]()
+    {
+        float sum = 0;
+        for (int n = 0; n < TIMING_SAMPLES; ++n)
+        {
+            sum += curve(static_cast<float>(n) / TIMING_SAMPLES);
+        }
+        return sum;
+    }, TIMING_SAMPLES);
+    m.quality = -resp_dev;
+    return m;
+}
+
+void mark_pareto(std::vector<Measurement>& measurements)
+{
+    for (auto& m : measurements)
+    {
+        m.pareto = std::none_of(measurements.begin(), measurements.end(), [&](const Measurement& other)
+        {
+            return other.category == m.category && &other != &m && other.ns_per_op &&
+                   other.ns_per_op <= m.ns_per_op && other.quality >= m.quality &&
+                   (other.ns_per_op < m.ns_per_op || other.quality > m.quality);
+        });
+        m.pareto = m.pareto && m.ns_per_op;
+    }
+}
+
+std::string format(std::optional<float> value, int precision = 1)
+{
+    if (!value)
+    {
+        return "-";
+    }
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(precision) << *value;
+    return stream.str();
+}
+
+std::string make_table(const std::vector<Measurement>& measurements)
+{
+    std::ostringstream table;
+    std::string category;
+    for (const auto& m : measurements)
+    {
+        if (m.category != category)
+        {
+            category = m.category;
+            table << "\n### " << category << "\n\n";
+            table << "| Variant | SNR dB | THD dB | Alias dB | Resp. dev dB | ns/op | Pareto |\n";
+            table << "|---|---|---|---|---|---|---|\n";
+        }
+        table << "| " << m.name << " | " << format(m.snr) << " | " << format(m.thd) << " | " << format(m.alias)
+              << " | " << format(m.resp_dev) << " | " << format(m.ns_per_op, 2)
+              << " | " << (m.pareto ? "*" : "") << " |\n";
+    }
+    return table.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    ScopedDenormalGuard denormal_guard;
+    std::vector<Measurement> measurements;
+
+    measurements.push_back(measure_interpolator<ZerothInterpolation<float>>("ZerothInterpolation"));
+    measurements.push_back(measure_interpolator<LinearInterpolation<float>>("LinearInterpolation"));
+    measurements.push_back(measure_interpolator<CosineInterpolation<float>>("CosineInterpolation"));
+    measurements.push_back(measure_interpolator<CubicInterpolation<float>>("CubicInterpolation"));
+    measurements.push_back(measure_interpolator<CRCubicInterpolation<float>>("CRCubicInterpolation"));
+    measurements.push_back(measure_interpolator<AllpassInterpolation<float>>("AllpassInterpolation"));
+
+    measurements.push_back(measure_rc_stage("RCStage::set", false));
+    measurements.push_back(measure_rc_stage("RCStage::set_approx", true));
+
+#ifdef BRICKS_DSP_CONSTEXPR_MATH
+    measurements.push_back(measure_one_pole_lag("exp coefficient (BRICKS_DSP_CONSTEXPR_MATH)"));
+    measurements.push_back(measure_one_pole_lag_accuracy("linear coefficient (fallback, not built)", false));
+#else
+    measurements.push_back(measure_one_pole_lag_accuracy("exp coefficient (BRICKS_DSP_CONSTEXPR_MATH, not built)", true));
+    measurements.push_back(measure_one_pole_lag("linear coefficient (fallback)"));
+#endif
+
+    measurements.push_back(measure_gain_curve("powf", [](float lin) {return std::pow(10.0f, (lin - 1.0f) * 1.5f);}));
+    measurements.push_back(measure_gain_curve("to_db_approx", [](float lin) {return to_db_approx(lin);}));
+
+    mark_pareto(measurements);
+    auto table = make_table(measurements);
+
+    std::cout << "Accuracy vs speed, block size " << PROC_BLOCK_SIZE << ", * marks pareto optimal variants\n";
+    std::cout << "ns/op is per sample, except for RCStage where it is per coefficient calculation\n";
+    std::cout << table;
+
+    if (argc > 1)
+    {
+        std::ofstream file(argv[1]);
+        file << "## Accuracy vs speed\n\n* marks pareto optimal variants, ns/op is per sample, "
+                "except for RCStage where it is per coefficient calculation\n" << table;
+    }
+    return 0;
+}
@@ -7,18 +7,53 @@ using namespace bricks_bench;
 static auto silence_audio = gen_silence_data();
 static auto sine_audio = gen_sine_data();
 static auto noise_audio = gen_noise_data();
+static auto denormal_audio = gen_denormal_data();
 
 bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* bricks_bench::SILENCE_AUDIO = &silence_audio;
 bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* bricks_bench::SINE_AUDIO = &sine_audio;
 bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* bricks_bench::NOISE_AUDIO = &noise_audio;
+bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* bricks_bench::DENORMAL_AUDIO = &denormal_audio;
 
 constexpr bool PASS_ARRAY_ARGS = true;
 constexpr bool FIXED_CTRL_DATA = false;
+constexpr bool ALLOW_DENORMALS = false;
 
 /* Baseline (1 audio input)*/
 BENCHMARK_TEMPLATE(BrickBM, bricks_bench::BaselineBrick, 2, 1, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks_bench::BaselineBrickCtrlOnly, 2, 0, AudioType::SILENCE);
 
+/* Cache cold bricks, many instances rendered round robin or with caches evicted between
+ * each call, compare with the hot cache timings of the same bricks below */
+constexpr int COLD_INSTANCES = 512;
+constexpr bool EVICT_CACHE = true;
+/* Evicting the cache is slow, so limit the number of runs */
+constexpr int EVICT_ITERATIONS = 2000;
+
+/* Measures the timer overhead with cache eviction */
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks_bench::BaselineBrick, 2, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::WtOscillatorBrick, 1, 0, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::WtOscillatorBrick, 1, 0, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::ModDelayBrick<LinearInterpolation<float>>, 1, 1, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::ModDelayBrick<LinearInterpolation<float>>, 1, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::ModulatedDelayBrick, 1, 1, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::ModulatedDelayBrick, 1, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::AllpassDelayBrick<500>, 2, 1, AudioType::NOISE, COLD_INSTANCES);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::AllpassDelayBrick<500>, 2, 1, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::FdnReverbBrick<8>, 4, 2, AudioType::NOISE, 64);
+BENCHMARK_TEMPLATE(ColdBrickBM, bricks::FdnReverbBrick<8>, 4, 2, AudioType::NOISE, 1, EVICT_CACHE)->Iterations(EVICT_ITERATIONS);
+
+/* Decaying tails with and without denormal protection */
+BENCHMARK_TEMPLATE(BrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::DENORMAL);
+BENCHMARK_TEMPLATE(BrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::DENORMAL, false, true, ALLOW_DENORMALS);
+BENCHMARK_TEMPLATE(BrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::DENORMAL);
+BENCHMARK_TEMPLATE(BrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::DENORMAL, false, true, ALLOW_DENORMALS);
+BENCHMARK_TEMPLATE(BrickBM, bricks::AllpassDelayBrick<500>, 2, 1, AudioType::DENORMAL);
+BENCHMARK_TEMPLATE(BrickBM, bricks::AllpassDelayBrick<500>, 2, 1, AudioType::DENORMAL, false, true, ALLOW_DENORMALS);
+
 /* Up/downsample functions */
 SAMPLE_FUNCTOR(SkipDownsampleFunc, bricks::skip_downsample, 4, 1);
 BENCHMARK_TEMPLATE(FunBM, SkipDownsampleFunc ,4, 1);
@@ -37,14 +72,96 @@ BENCHMARK_TEMPLATE(FunBM, CubicUpsampleFunc, 1, 4, true, AlignedArray<float,4>);
 BENCHMARK_TEMPLATE(BrickBM, bricks::AudioRateADSRBrick, 4, 0, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::LinearADSREnvelopeBrick, 4, 0, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::AudioADSREnvelopeBrick, 4, 0, AudioType::SILENCE);
+
+/* Retriggers one voice every 16 blocks, so all stages are running */
+template <int voices>
+class PolyADSRTestBrick : public bricks::PolyADSRBrick<voices>
+{
+public:
+    PolyADSRTestBrick(const float* attack, const float* decay, const float* sustain, const float* release) :
+            bricks::PolyADSRBrick<voices>(attack, decay, sustain, release) {}
+
+    void render() override
+    {
+        if (_blocks++ % 16 == 0)
+        {
+            this->gate(_voice, false);
+            _voice = (_voice + 1) % voices;
+            this->gate(_voice, true);
+        }
+        bricks::PolyADSRBrick<voices>::render();
+    }
+
+private:
+    int _blocks{0};
+    int _voice{0};
+};
+
+BENCHMARK_TEMPLATE(BrickBM, PolyADSRTestBrick<1>, 4, 0, AudioType::SILENCE);
+BENCHMARK_TEMPLATE(BrickBM, PolyADSRTestBrick<8>, 4, 0, AudioType::SILENCE);
+
+/* Toggles the gate every 16 blocks */
+class AudioRateADSRTestBrick : public bricks::AudioRateADSRBrick
+{
+public:
+    AudioRateADSRTestBrick(const float* attack, const float* decay, const float* sustain, const float* release) :
+            AudioRateADSRBrick(attack, decay, sustain, release) {}
+
+    void render() override
+    {
+        if (_blocks++ % 16 == 0)
+        {
+            _gate = !_gate;
+            gate(_gate);
+        }
+        AudioRateADSRBrick::render();
+    }
+
+private:
+    int  _blocks{0};
+    bool _gate{false};
+};
+
+BENCHMARK_TEMPLATE(BrickBM, AudioRateADSRTestBrick, 4, 0, AudioType::SILENCE);
+
+/* DAHDSR with curved decay and release, toggles the gate every 16 blocks at an offset */
+class SegmentEnvelopeTestBrick : public bricks::SegmentEnvelopeBrick<8>
+{
+public:
+    SegmentEnvelopeTestBrick()
+    {
+        set_dahdsr(0.001f, 0.005f, 0.002f, 0.005f, 0.5f, 0.005f, -3.0f, -3.0f);
+    }
+
+    void render() override
+    {
+        if (_blocks++ % 16 == 0)
+        {
+            _gate = !_gate;
+            gate(_gate, 7);
+        }
+        SegmentEnvelopeBrick<8>::render();
+    }
+
+private:
+    int  _blocks{0};
+    bool _gate{false};
+};
+
+BENCHMARK_TEMPLATE(BrickBM, SegmentEnvelopeTestBrick, 0, 0, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::LfoBrick, 1, 0, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::SineLfoBrick, 1, 0, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::RandLfoBrick, 1, 0, AudioType::SILENCE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::AudioRateLfoBrick, 1, 0, AudioType::SILENCE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::LfoBankBrick<1>, 1, 0, AudioType::SILENCE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::LfoBankBrick<8>, 8, 0, AudioType::SILENCE);
 
 /* Filter bricks */
 BENCHMARK_TEMPLATE(BrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::FixedFilterBrick, 0, 1, AudioType::SINE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::BasicFixedFilterBrick<double>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::BasicFixedFilterBrick<bricks::MixedPrecision>, 0, 1, AudioType::NOISE);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::MultiStageFilterBrick<1, float>, 0, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MultiStageFilterBrick<2, float>, 0, 1, AudioType::NOISE);
@@ -60,14 +177,40 @@ BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<1>, 0, 1, AudioType::NOI
 BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<2>, 0, 2, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<4>, 0, 4, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<8>, 0, 8, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<16>, 0, 16, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<4, double>, 0, 4, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::ParallelFilterBrick<8, double>, 0, 8, AudioType::NOISE);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::SINE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::SVFFilterBrick, 2, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::BasicSVFFilterBrick<double>, 2, 1, AudioType::NOISE);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::MystransLadderFilter, 2, 1, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MystransLadderFilter, 2, 1, AudioType::SINE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MystransLadderFilter, 2, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::BasicMystransLadderFilter<float>, 2, 1, AudioType::NOISE);
+
+/* Convolution with a decaying noise impulse response of ir_length samples */
+template <int ir_length, int tail_partition_size>
+class ConvolutionTestBrick : public bricks::ConvolutionBrick
+{
+public:
+    explicit ConvolutionTestBrick(const AudioBuffer* audio_in) : ConvolutionBrick(audio_in)
+    {
+        std::vector<float> ir(ir_length);
+        for (int i = 0; i < ir_length; ++i)
+        {
+            ir[i] = (*NOISE_AUDIO)[i % TEST_AUDIO_DATA_SIZE] * std::exp(-5.0f * i / ir_length);
+        }
+        set_impulse_response(ir.data(), ir_length, tail_partition_size);
+    }
+};
+
+BENCHMARK_TEMPLATE(BrickBM, ConvolutionTestBrick<1024, 0>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, ConvolutionTestBrick<44100, 0>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, ConvolutionTestBrick<44100, 1024>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, ConvolutionTestBrick<88200, 2048>, 0, 1, AudioType::NOISE);
 
 /* Modulator bricks */
 BENCHMARK_TEMPLATE(BrickBM, bricks::SaturationBrick<ClipType::HARD>, 1, 1, AudioType::SINE);
@@ -99,6 +242,8 @@ BENCHMARK_TEMPLATE(BrickBM, bricks::ModDelayBrick<AllpassInterpolation<float>>,
 BENCHMARK_TEMPLATE(BrickBM, bricks::ModulatedDelayBrick, 1, 1, AudioType::NOISE);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::AllpassDelayBrick<500>, 2, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::FdnReverbBrick<8>, 4, 2, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::FdnReverbBrick<16>, 4, 2, AudioType::NOISE);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::BitRateReducerBrick, 1, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::SampleRateReducerBrick, 1, 1, AudioType::NOISE);
@@ -107,14 +252,56 @@ BENCHMARK_TEMPLATE(BrickBM, bricks::SampleRateReducerBrick, 1, 1, AudioType::NOI
 BENCHMARK_TEMPLATE(BrickBM, bricks::OscillatorBrick, 1, 0, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::FmOscillatorBrick, 1, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::WtOscillatorBrick, 1, 0, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::WavetableMorphOscillatorBrick<false>, 2, 0, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::WavetableMorphOscillatorBrick<true>, 2, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::NoiseGeneratorBrick, 0, 0, AudioType::NOISE);
 
+template <bricks::NoiseGeneratorBrick::Waveform waveform>
+class NoiseGeneratorTestBrick : public bricks::NoiseGeneratorBrick
+{
+public:
+    NoiseGeneratorTestBrick()
+    {
+        set_waveform(waveform);
+    }
+};
+
+BENCHMARK_TEMPLATE(BrickBM, NoiseGeneratorTestBrick<bricks::NoiseGeneratorBrick::Waveform::PINK>, 0, 0, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, NoiseGeneratorTestBrick<bricks::NoiseGeneratorBrick::Waveform::BROWN>, 0, 0, AudioType::NOISE);
+
 /* Analysis bricks */
 BENCHMARK_TEMPLATE(BrickBM, bricks::MeterBrick<1>, 0, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MeterBrick<1>, 0, 1, AudioType::SINE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MeterBrick<1>, 0, 1, AudioType::SILENCE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MeterBrick<2>, 0, 1, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MeterBrick<4>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::TruePeakMeterBrick, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::LoudnessMeterBrick<1>, 0, 1, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::LoudnessMeterBrick<2>, 0, 2, AudioType::NOISE);
+
+/* Includes the analysis normally done on a worker thread, process() is
+ * called every process_interval blocks, like a worker at ~40 Hz would */
+template <int process_interval>
+class SpectrumAnalyzerTestBrick : public bricks::SpectrumAnalyzerBrick
+{
+public:
+    SpectrumAnalyzerTestBrick(const float* averaging, const AudioBuffer* audio_in) : SpectrumAnalyzerBrick(averaging, audio_in) {}
+
+    void render() override
+    {
+        SpectrumAnalyzerBrick::render();
+        if (++_count == process_interval)
+        {
+            process();
+            _count = 0;
+        }
+    }
+
+private:
+    int _count{0};
+};
+
+BENCHMARK_TEMPLATE(BrickBM, SpectrumAnalyzerTestBrick<32>, 1, 1, AudioType::NOISE);
 
 /* Utility bricks */
 BENCHMARK_TEMPLATE(BrickBM, bricks::VcaBrick<Response::LINEAR>, 1, 1, AudioType::NOISE);
@@ -134,6 +321,7 @@ BENCHMARK_TEMPLATE(BrickBM, bricks::AudioMixerBrick<16, Response::LINEAR>, 16, 1
 BENCHMARK_TEMPLATE(BrickBM, bricks::AudioMixerBrick<16, Response::LOG>, 16, 16, AudioType::NOISE, PASS_ARRAY_ARGS);
 BENCHMARK_TEMPLATE(BrickBM, bricks::AudioMixerBrick<16, Response::LINEAR>, 16, 16, AudioType::NOISE, PASS_ARRAY_ARGS, FIXED_CTRL_DATA);
 BENCHMARK_TEMPLATE(BrickBM, bricks::AudioMixerBrick<16, Response::LOG>, 16, 16, AudioType::NOISE, PASS_ARRAY_ARGS, FIXED_CTRL_DATA);
+BENCHMARK_TEMPLATE(BrickBM, bricks::AudioMixerBrick<64, Response::LINEAR>, 64, 64, AudioType::NOISE, PASS_ARRAY_ARGS);
 
 BENCHMARK_TEMPLATE(BrickBM, bricks::StereoMixerBrick<4, Response::LINEAR>, 8, 4, AudioType::NOISE, PASS_ARRAY_ARGS);
 BENCHMARK_TEMPLATE(BrickBM, bricks::StereoMixerBrick<4, Response::LOG>, 8, 4, AudioType::NOISE, PASS_ARRAY_ARGS);
@@ -170,4 +358,27 @@ BENCHMARK_TEMPLATE(BrickBM, bricks::MetaControlBrick<2, 4, false>, 2, 0, AudioTy
 BENCHMARK_TEMPLATE(BrickBM, bricks::MetaControlBrick<4, 8, true>, 4, 0, AudioType::NOISE);
 BENCHMARK_TEMPLATE(BrickBM, bricks::MetaControlBrick<4, 8, false>, 4, 0, AudioType::NOISE);
 
+/* 64 sources and 256 destinations with 30 active routes, the dense matrix
+ * evaluates all of them */
+class ModMatrixTestBrick : public bricks::ModMatrixBrick<64, 0, 256, 0>
+{
+public:
+    template <class ...T>
+    explicit ModMatrixTestBrick(T... inputs)
+    {
+        std::array<const float*, sizeof...(inputs)> ctrl_ins = {inputs...};
+        for (int i = 0; i < 64; ++i)
+        {
+            set_control_input(i, ctrl_ins[i % ctrl_ins.size()]);
+        }
+        for (int r = 0; r < 30; ++r)
+        {
+            add_route({(r * 7) % 64, (r * 37) % 256, 0.5f, static_cast<Curve>(r % 5)});
+        }
+    }
+};
+
+BENCHMARK_TEMPLATE(BrickBM, ModMatrixTestBrick, 4, 0, AudioType::NOISE);
+BENCHMARK_TEMPLATE(BrickBM, bricks::MetaControlBrick<64, 256, false>, 64, 0, AudioType::NOISE);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -2,16 +2,23 @@
 #define BRICKS_DSP_FIXTURE_H
 
 #include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
+#include "bricks_dsp/bricks.h"
+#include "memory_counter.h"
+
 #ifdef __SSE__
 #include <xmmintrin.h>
-#define denormals_intrinsic() _mm_setcsr(0x9FC0)
+/* -ffast-math sets flush-to-zero on program startup, clear it explicitly
+ * to emulate a host that doesn't protect against denormals */
+#define allow_denormals_intrinsic() _mm_setcsr(_mm_getcsr() & ~0x8040)
 #else
-#define denormals_intrinsic()
+#define allow_denormals_intrinsic()
 #endif
-#include "bricks_dsp/bricks.h"
 
 namespace bricks_bench {
 using namespace bricks;
@@ -22,12 +29,17 @@ constexpr float TEST_SAMPLE_RATE = 44100;
 extern bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* SILENCE_AUDIO;
 extern bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* SINE_AUDIO;
 extern bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* NOISE_AUDIO;
+extern bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* DENORMAL_AUDIO;
+
+/* Larger than the L2 cache of most cpus, writing it evicts everything else from L1 and L2 */
+constexpr int EVICTION_BUFFER_SIZE = 4 * 1024 * 1024;
 
 enum class AudioType
 {
     SILENCE,
     SINE,
-    NOISE
+    NOISE,
+    DENORMAL  // Noise at denormal levels, like the very end of a decaying tail
 };
 
 static bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* get_audio_data(AudioType type)
@@ -37,6 +49,7 @@ static bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE>* get_audio_data(AudioTy
         case AudioType::SILENCE: return SILENCE_AUDIO;
         case AudioType::SINE: return SINE_AUDIO;
         case AudioType::NOISE: return NOISE_AUDIO;
+        case AudioType::DENORMAL: return DENORMAL_AUDIO;
         default: return SILENCE_AUDIO;
     }
 }
@@ -70,6 +83,17 @@ static bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE> gen_noise_data()
     return data;
 }
 
+static bricks::AlignedArray<float, TEST_AUDIO_DATA_SIZE> gen_denormal_data()
+{
+    constexpr float DENORMAL_LEVEL = 1.0e-39f;
+    auto data = gen_noise_data();
+    for (auto& i : data)
+    {
+        i *= DENORMAL_LEVEL;
+    }
+    return data;
+}
+
 /* No-op bricks to measure the benchmarking overhead, essentially subtract the
  * measured time from this from all brick benchmarks to measure the overhead */
 class BaselineBrick : public bricks::DspBrickImpl<2, 0, 1, 1>
@@ -118,6 +142,41 @@ std::unique_ptr<T> make_brick_array_args(const std::array<float, ctrl_inputs>& c
     return std::make_unique<T>(c_arg, a_arg);
 }
 
+/* Creates a brick from arrays of control and audio inputs, see BrickBM for array_args */
+template<typename T, int ctrl_inputs, int audio_inputs, bool array_args>
+std::unique_ptr<DspBrick> create_brick(const std::array<float, ctrl_inputs>& ctrl_signals,
+                                       const std::array<bricks::AudioBuffer, audio_inputs>& audio_signals)
+{
+    std::unique_ptr<DspBrick> brick;
+    if constexpr (array_args)
+    {
+        brick = make_brick_array_args<T, ctrl_inputs, audio_inputs>(ctrl_signals, audio_signals,
+                                                                    std::make_index_sequence<ctrl_inputs>{},
+                                                                    std::make_index_sequence<audio_inputs>{});
+    }
+    else
+    {
+        brick = make_brick<T, ctrl_inputs, audio_inputs>(ctrl_signals, audio_signals,
+                                                         std::make_index_sequence<ctrl_inputs>{},
+                                                         std::make_index_sequence<audio_inputs>{});
+    }
+    assert(brick);
+    brick->set_samplerate(TEST_SAMPLE_RATE);
+    return brick;
+}
+
+/* Memory footprint of a brick in bytes, sizeof() plus everything it allocates
+ * on the heap during construction and setup */
+template<typename T, int ctrl_inputs, int audio_inputs, bool array_args>
+int64_t brick_footprint(const std::array<float, ctrl_inputs>& ctrl_signals,
+                        const std::array<bricks::AudioBuffer, audio_inputs>& audio_signals)
+{
+    auto allocated = heap_allocated_bytes();
+    auto brick = create_brick<T, ctrl_inputs, audio_inputs, array_args>(ctrl_signals, audio_signals);
+    /* sizeof(T) is included as the brick itself is allocated with new */
+    return heap_allocated_bytes() - allocated;
+}
+
 /* Generic test fixture that passes a given number of control and audio inputs to the
  * DspBrick to benchmark
  *
@@ -127,11 +186,19 @@ std::unique_ptr<T> make_brick_array_args(const std::array<float, ctrl_inputs>& c
  * audio_type         - The type of audio to pass through - if performance depends on branch pred. or similar
  * array_args         - If true, format the constructor arguments into arrays of ControlPorts and AudioPorts,
  *                      Else, use variadic expansion for passing arguments
- * modulate_ctrl_data - If true, modulate control data between calls to render */
-template<typename T, int ctrl_inputs, int audio_inputs, AudioType audio_type, bool array_args = false, bool modulate_ctrl_data = true>
+ * modulate_ctrl_data - If true, modulate control data between calls to render
+ * flush_denormals    - If true, run with ScopedDenormalGuard like a well-behaved host,
+ *                      else explicitly allow denormals in order to measure their cost */
+template<typename T, int ctrl_inputs, int audio_inputs, AudioType audio_type, bool array_args = false,
+         bool modulate_ctrl_data = true, bool flush_denormals = true>
 static void BrickBM(benchmark::State& state)
 {
-    denormals_intrinsic();
+    /* The previous state is restored when the guard goes out of scope */
+    bricks::ScopedDenormalGuard denormal_guard;
+    if constexpr (!flush_denormals)
+    {
+        allow_denormals_intrinsic();
+    }
 
     std::array<float, ctrl_inputs> ctrl_signals;
     std::array<bricks::AudioBuffer, audio_inputs> audio_signals;
@@ -140,21 +207,7 @@ static void BrickBM(benchmark::State& state)
     ctrl_signals.fill(0.0);
     constexpr float CTRL_INC = 1.0f / TEST_AUDIO_DATA_SIZE;
 
-    std::unique_ptr<DspBrick> test_module;
-    if constexpr (array_args)
-    {
-        test_module = make_brick_array_args<T, ctrl_inputs, audio_inputs>(ctrl_signals, audio_signals,
-                                                                          std::make_index_sequence<ctrl_inputs>{},
-                                                                          std::make_index_sequence<audio_inputs>{});
-    }
-    else
-    {
-        test_module = make_brick<T, ctrl_inputs, audio_inputs>(ctrl_signals, audio_signals,
-                                                               std::make_index_sequence<ctrl_inputs>{},
-                                                               std::make_index_sequence<audio_inputs>{});
-    }
-    assert(test_module);
-    test_module->set_samplerate(TEST_SAMPLE_RATE);
+    auto test_module = create_brick<T, ctrl_inputs, audio_inputs, array_args>(ctrl_signals, audio_signals);
 
     int samples = 0;
     for (auto _ : state)
@@ -181,6 +234,64 @@ static void BrickBM(benchmark::State& state)
          * See timings for the BaselineBrick for an estimation of the overhead */
         test_module->render();
     }
+    state.counters["footprint"] = benchmark::Counter(brick_footprint<T, ctrl_inputs, audio_inputs, array_args>(ctrl_signals, audio_signals),
+                                                     benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+};
+
+/* Same as BrickBM but with the brick's state out of cache, as when rendering a
+ * large graph of bricks where every brick's state has been evicted by the time
+ * it renders again. Either renders instances copies of the brick round robin,
+ * with one brick rendered per iteration, or if evict is true, writes to a large
+ * buffer between every iteration, outside of the measured time. The timings with
+ * evict = true include some overhead from pausing and resuming the timer.
+ * Reports footprint - the memory used by one instance of the brick */
+template<typename T, int ctrl_inputs, int audio_inputs, AudioType audio_type, int instances, bool evict = false,
+         bool array_args = false>
+static void ColdBrickBM(benchmark::State& state)
+{
+    bricks::ScopedDenormalGuard denormal_guard;
+
+    std::array<float, ctrl_inputs> ctrl_signals;
+    std::array<bricks::AudioBuffer, audio_inputs> audio_signals;
+    auto audio_data = get_audio_data(audio_type);
+    ctrl_signals.fill(0.0);
+    constexpr float CTRL_INC = 1.0f / TEST_AUDIO_DATA_SIZE;
+
+    std::vector<std::unique_ptr<DspBrick>> test_modules;
+    for (int i = 0; i < instances; ++i)
+    {
+        test_modules.push_back(create_brick<T, ctrl_inputs, audio_inputs, array_args>(ctrl_signals, audio_signals));
+    }
+    std::vector<char> eviction_buffer(evict ? EVICTION_BUFFER_SIZE : 0);
+
+    int samples = 0;
+    int instance = 0;
+    for (auto _ : state)
+    {
+        if constexpr (evict)
+        {
+            state.PauseTiming();
+            std::fill(eviction_buffer.begin(), eviction_buffer.end(), static_cast<char>(samples));
+            benchmark::ClobberMemory();
+            state.ResumeTiming();
+        }
+        if (samples++ >= TEST_AUDIO_DATA_SIZE - bricks::PROC_BLOCK_SIZE)
+        {
+            samples = 0;
+        }
+        for (auto& i : audio_signals)
+        {
+            std::copy(audio_data->data() + samples, audio_data->data() + samples + bricks::PROC_BLOCK_SIZE, i.data());
+        }
+        for (auto& i: ctrl_signals)
+        {
+            i = static_cast<float>(samples) * CTRL_INC;
+        }
+        test_modules[instance]->render();
+        instance = instance + 1 < instances ? instance + 1 : 0;
+    }
+    state.counters["footprint"] = benchmark::Counter(brick_footprint<T, ctrl_inputs, audio_inputs, array_args>(ctrl_signals, audio_signals),
+                                                     benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
 };
 
 /* Creates a functor object from free-standing function fun, for use in FunBM template */
@@ -213,7 +324,7 @@ struct name                             \
 template <typename SampleFun, int from_size, int to_size, bool memory_arg=false, typename mem_type=float>
 static void FunBM(benchmark::State& state)
 {
-    denormals_intrinsic();
+    bricks::ScopedDenormalGuard denormal_guard;
 
     bricks::AlignedArray<float, from_size * bricks::PROC_BLOCK_SIZE> in_audio;
     bricks::AlignedArray<float, to_size * bricks::PROC_BLOCK_SIZE> out_audio;
@@ -0,0 +1,110 @@
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include "graphs.h"
+
+/* Benchmarks of complete graphs of bricks, for capacity planning. Reports
+ * ns_per_sample (per voice where applicable) and voices_per_core, the number
+ * of graphs a single core could render in realtime at TEST_SAMPLE_RATE.
+ * This file is built once for each block size in BRICKS_DSP_BENCHMARK_BLOCK_SIZES */
+
+using namespace bricks_bench;
+
+constexpr float TEST_SAMPLE_RATE = 44100;
+constexpr int MAX_VOICES = 256;
+constexpr int NOISE_DATA_SIZE = 8192;
+
+/* Timed manually instead of using rate counters to get the counters in plain numbers */
+using Clock = std::chrono::steady_clock;
+
+static void set_graph_counters(benchmark::State& state, Clock::time_point start_time, int graphs)
+{
+    double seconds = std::chrono::duration<double>(Clock::now() - start_time).count();
+    double samples = static_cast<double>(state.iterations()) * bricks::PROC_BLOCK_SIZE * graphs;
+    state.counters["ns_per_sample"] = seconds * 1.0e9 / samples;
+    state.counters["voices_per_core"] = samples / TEST_SAMPLE_RATE / seconds;
+}
+
+/* Renders state.range(0) synth voices per iteration and sums them, like a polyphonic synth would */
+static void PolyphonyBM(benchmark::State& state)
+{
+    bricks::ScopedDenormalGuard denormal_guard;
+    int voice_count = state.range(0);
+    std::vector<std::unique_ptr<SynthVoice>> voices;
+    for (int i = 0; i < voice_count; ++i)
+    {
+        /* Spread out the pitches so that different wavetable levels are used */
+        voices.push_back(std::make_unique<SynthVoice>(0.2f + 0.4f * i / MAX_VOICES));
+        voices.back()->set_samplerate(TEST_SAMPLE_RATE);
+    }
+
+    bricks::AudioBuffer output;
+    auto start_time = Clock::now();
+    for (auto _ : state)
+    {
+        output.fill(0.0f);
+        for (auto& voice : voices)
+        {
+            voice->render();
+            const auto& voice_out = voice->output();
+            for (int i = 0; i < bricks::PROC_BLOCK_SIZE; ++i)
+            {
+                output[i] += voice_out[i];
+            }
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+    set_graph_counters(state, start_time, voice_count);
+}
+
+/* Effect chains processing noise */
+template <typename Graph>
+static void EffectChainBM(benchmark::State& state)
+{
+    bricks::ScopedDenormalGuard denormal_guard;
+    auto graph = std::make_unique<Graph>();
+    graph->set_samplerate(TEST_SAMPLE_RATE);
+
+    /* Pregenerated so that noise generation is not included in the measurement */
+    std::vector<float> noise(NOISE_DATA_SIZE);
+    bricks::RandomDevice rand_device;
+    for (auto& sample : noise)
+    {
+        sample = rand_device.get_norm();
+    }
+
+    int pos = 0;
+    auto start_time = Clock::now();
+    for (auto _ : state)
+    {
+        for (int c = 0; c < Graph::AUDIO_INPUTS; ++c)
+        {
+            std::copy(noise.begin() + pos, noise.begin() + pos + bricks::PROC_BLOCK_SIZE, graph->input(c).begin());
+            pos = (pos + bricks::PROC_BLOCK_SIZE) % NOISE_DATA_SIZE;
+        }
+        graph->render();
+    }
+    set_graph_counters(state, start_time, 1);
+}
+
+BENCHMARK(PolyphonyBM)->RangeMultiplier(2)->Range(1, MAX_VOICES);
+
+BENCHMARK_TEMPLATE(EffectChainBM, DriveFilterEchoChain);
+BENCHMARK_TEMPLATE(EffectChainBM, DiffusedReverbChain);
+BENCHMARK_TEMPLATE(EffectChainBM, ConvolutionReverbChain);
+
+int main(int argc, char** argv)
+{
+    benchmark::AddCustomContext("block_size", std::to_string(bricks::PROC_BLOCK_SIZE));
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
@@ -0,0 +1,168 @@
+#ifndef BRICKS_DSP_BENCHMARK_GRAPHS_H
+#define BRICKS_DSP_BENCHMARK_GRAPHS_H
+
+#include <memory>
+#include <vector>
+
+#include "bricks_dsp/bricks.h"
+
+/* Complete processing graphs of several bricks, as they would be used in a
+ * synth or effect, for benchmarking bricks together rather than in isolation */
+namespace bricks_bench {
+using namespace bricks;
+
+/* Base for all graphs, bricks are rendered in the order they are added */
+class BenchmarkGraph
+{
+public:
+    virtual ~BenchmarkGraph() = default;
+
+    void render()
+    {
+        for (auto brick : _graph)
+        {
+            brick->render();
+        }
+    }
+
+    void set_samplerate(float samplerate)
+    {
+        for (auto brick : _graph)
+        {
+            brick->set_samplerate(samplerate);
+        }
+    }
+
+protected:
+    std::vector<DspBrick*> _graph;
+};
+
+/* Subtractive synth voice, same as the one in examples/synth_voice.cpp */
+class SynthVoice : public BenchmarkGraph
+{
+public:
+    static constexpr int AUDIO_INPUTS = 0;
+
+    SynthVoice(float pitch = 0.4f)
+    {
+        _pitch = pitch;
+        _pitch_2 = pitch + 0.001f;
+        _graph = {&_lfo, &_env, &_osc, &_osc2, &_mixer, &_filt, &_dist, &_amp_level, &_amp};
+        _env.gate(true);
+    }
+
+    const AudioBuffer& output() {return *_amp.audio_output(VcaBrick<Response::LINEAR>::VCA_OUT);}
+
+private:
+    float _attack{0.01f};
+    float _decay{1.6f};
+    float _sustain{0.3f};
+    float _release{1.6f};
+    float _rate{0.3f};
+    float _pitch;
+    float _pitch_2;
+    float _res{0.7f};
+    float _clip{0.2f};
+    float _volume{0.5f};
+
+    LfoBrick                            _lfo{&_rate};
+    LinearADSREnvelopeBrick             _env{&_attack, &_decay, &_sustain, &_release};
+    WtOscillatorBrick                   _osc{&_pitch};
+    WtOscillatorBrick                   _osc2{&_pitch_2};
+    AudioSummerBrick<2>                 _mixer{_osc.audio_output(WtOscillatorBrick::OSC_OUT), _osc2.audio_output(WtOscillatorBrick::OSC_OUT)};
+    SVFFilterBrick                      _filt{_env.control_output(LinearADSREnvelopeBrick::ENV_OUT), &_res, _mixer.audio_output(AudioSummerBrick<2>::SUM_OUT)};
+    AASaturationBrick<ClipType::SOFT>   _dist{&_clip, _filt.audio_output(SVFFilterBrick::LOWPASS)};
+    ControlMultiplierBrick<2>           _amp_level{&_volume, _env.control_output(LinearADSREnvelopeBrick::ENV_OUT)};
+    VcaBrick<Response::LINEAR>          _amp{_amp_level.control_output(ControlMultiplierBrick<2>::MULT_OUT), _dist.audio_output(AASaturationBrick<ClipType::SOFT>::CLIP_OUT)};
+};
+
+/* Mono guitar style chain, distortion into a resonant filter and an echo */
+class DriveFilterEchoChain : public BenchmarkGraph
+{
+public:
+    static constexpr int AUDIO_INPUTS = 1;
+
+    DriveFilterEchoChain()
+    {
+        _graph = {&_drive, &_filter, &_echo};
+    }
+
+    AudioBuffer& input(int /*channel*/) {return _input;}
+
+private:
+    AudioBuffer _input;
+    float _gain{0.6f};
+    float _cutoff{0.6f};
+    float _res{0.5f};
+    float _delay{0.4f};
+
+    AASaturationBrick<ClipType::SOFT>   _drive{&_gain, &_input};
+    MystransLadderFilter                _filter{&_cutoff, &_res, _drive.audio_output(AASaturationBrick<ClipType::SOFT>::CLIP_OUT)};
+    ModulatedDelayBrick                 _echo{&_delay, _filter.audio_output(MystransLadderFilter::FILTER_OUT)};
+};
+
+/* Stereo algorithmic reverb with allpass diffusors in front of a feedback delay network */
+class DiffusedReverbChain : public BenchmarkGraph
+{
+public:
+    static constexpr int AUDIO_INPUTS = 2;
+
+    DiffusedReverbChain()
+    {
+        _graph = {&_diffusor_l, &_diffusor_r, &_reverb};
+    }
+
+    AudioBuffer& input(int channel) {return _input[channel];}
+
+private:
+    std::array<AudioBuffer, 2> _input;
+    float _diffusor_time_l{0.7f};
+    float _diffusor_time_r{0.8f};
+    float _diffusor_gain{0.6f};
+    float _size{0.7f};
+    float _decay{0.6f};
+    float _damping{0.4f};
+    float _mod{0.3f};
+
+    AllpassDelayBrick<200>  _diffusor_l{&_diffusor_time_l, &_diffusor_gain, &_input[0]};
+    AllpassDelayBrick<200>  _diffusor_r{&_diffusor_time_r, &_diffusor_gain, &_input[1]};
+    FdnReverbBrick<8>       _reverb{&_size, &_decay, &_damping, &_mod,
+                                    _diffusor_l.audio_output(AllpassDelayBrick<200>::DELAY_OUT),
+                                    _diffusor_r.audio_output(AllpassDelayBrick<200>::DELAY_OUT)};
+};
+
+/* Stereo convolution reverb with a 1 second decaying noise impulse response */
+class ConvolutionReverbChain : public BenchmarkGraph
+{
+public:
+    static constexpr int AUDIO_INPUTS = 2;
+    static constexpr int IR_LENGTH = 44100;
+    static constexpr int TAIL_PARTITION_SIZE = 1024;
+
+    ConvolutionReverbChain()
+    {
+        std::vector<float> ir(IR_LENGTH);
+        RandomDevice rand_device;
+        for (int i = 0; i < IR_LENGTH; ++i)
+        {
+            ir[i] = rand_device.get_norm() * std::exp(-5.0f * i / IR_LENGTH);
+        }
+        /* Both channels share the same transformed impulse response */
+        auto impulse_response = std::make_shared<const ImpulseResponse>(ir.data(), IR_LENGTH, TAIL_PARTITION_SIZE);
+        _conv_l.set_impulse_response(impulse_response);
+        _conv_r.set_impulse_response(impulse_response);
+        _graph = {&_conv_l, &_conv_r};
+    }
+
+    AudioBuffer& input(int channel) {return _input[channel];}
+
+private:
+    std::array<AudioBuffer, 2> _input;
+
+    ConvolutionBrick    _conv_l{&_input[0]};
+    ConvolutionBrick    _conv_r{&_input[1]};
+};
+
+} // end bricks_bench
+
+#endif //BRICKS_DSP_BENCHMARK_GRAPHS_H
@@ -0,0 +1,77 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "memory_counter.h"
+
+/* Replaces the global operator new and delete to keep track of the number of
+ * bytes currently allocated on the heap. Used for measuring the memory footprint
+ * of bricks. The size of each allocation is stored in a header just before the
+ * returned memory, aligned to the requested alignment. */
+
+namespace {
+std::atomic<int64_t> allocated_bytes{0};
+
+void* counted_alloc(std::size_t size, std::size_t alignment)
+{
+    std::size_t header = alignment < sizeof(std::size_t) ? sizeof(std::size_t) : alignment;
+    /* aligned_alloc requires the size to be a multiple of the alignment */
+    std::size_t total = (size + header + alignment - 1) / alignment * alignment;
+    auto data = static_cast<char*>(std::aligned_alloc(alignment, total));
+    if (data == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    *reinterpret_cast<std::size_t*>(data + header - sizeof(std::size_t)) = size;
+    allocated_bytes += static_cast<int64_t>(size);
+    return data + header;
+}
+
+void counted_free(void* ptr, std::size_t alignment)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    std::size_t header = alignment < sizeof(std::size_t) ? sizeof(std::size_t) : alignment;
+    auto data = static_cast<char*>(ptr) - header;
+    allocated_bytes -= static_cast<int64_t>(*reinterpret_cast<std::size_t*>(data + header - sizeof(std::size_t)));
+    std::free(data);
+}
+} // namespace
+
+int64_t bricks_bench::heap_allocated_bytes()
+{
+    return allocated_bytes;
+}
+
+void* operator new(std::size_t size)
+{
+    return counted_alloc(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return counted_alloc(size, std::max(static_cast<std::size_t>(alignment), std::size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__}));
+}
+
+void operator delete(void* ptr) noexcept
+{
+    counted_free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept
+{
+    counted_free(ptr, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void operator delete(void* ptr, std::align_val_t alignment) noexcept
+{
+    counted_free(ptr, std::max(static_cast<std::size_t>(alignment), std::size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__}));
+}
+
+void operator delete(void* ptr, std::size_t /*size*/, std::align_val_t alignment) noexcept
+{
+    counted_free(ptr, std::max(static_cast<std::size_t>(alignment), std::size_t{__STDCPP_DEFAULT_NEW_ALIGNMENT__}));
+}
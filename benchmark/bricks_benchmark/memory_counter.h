@@ -0,0 +1,13 @@
+#ifndef BRICKS_DSP_MEMORY_COUNTER_H
+#define BRICKS_DSP_MEMORY_COUNTER_H
+
+#include <cstdint>
+
+namespace bricks_bench {
+
+/* Bytes currently allocated with operator new, see memory_counter.cpp */
+int64_t heap_allocated_bytes();
+
+} // namespace bricks_bench
+
+#endif //BRICKS_DSP_MEMORY_COUNTER_H
@@ -0,0 +1,129 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <sndfile.h>
+
+#include "bricks_dsp/bricks.h"
+#include "bricks_dsp/offline_renderer.h"
+
+constexpr float EXAMPLE_SAMPLERATE = 44100;
+constexpr int SECONDS_TO_RENDER = 5;
+constexpr int VOICES = 16;
+
+using namespace bricks;
+
+/* Example of rendering many independent graphs to separate files in parallel
+ * using all cores, like when rendering preset previews or stems */
+
+/* Writes to a 16 bit wav file */
+class SndfileSink : public RenderSink
+{
+public:
+    SndfileSink(const std::string& filename, int channels)
+    {
+        SF_INFO file_info{};
+        file_info.channels = channels;
+        file_info.samplerate = static_cast<int>(EXAMPLE_SAMPLERATE);
+        file_info.format = SF_FORMAT_WAV | SF_FORMAT_PCM_16;
+        _file = sf_open(filename.c_str(), SFM_WRITE, &file_info);
+    }
+
+    ~SndfileSink() override {close();}
+
+    bool valid() const {return _file != nullptr;}
+
+    void write(const float* interleaved, int /*channels*/, int frames) override
+    {
+        sf_writef_float(_file, interleaved, frames);
+    }
+
+    void close() override
+    {
+        if (_file)
+        {
+            sf_close(_file);
+            _file = nullptr;
+        }
+    }
+
+private:
+    SNDFILE* _file{nullptr};
+};
+
+/* Mono voice with a note off 2/3 into the render */
+class Voice : public RenderSource
+{
+public:
+    Voice(float pitch) : _pitch(pitch)
+    {
+        for (auto brick : _graph)
+        {
+            brick->set_samplerate(EXAMPLE_SAMPLERATE);
+        }
+        _env.gate(true);
+    }
+
+    int channels() const override {return 1;}
+
+    void render(int64_t sample_pos) override
+    {
+        if (sample_pos > SECONDS_TO_RENDER * EXAMPLE_SAMPLERATE * 0.66)
+        {
+            _env.gate(false);
+        }
+        for (auto brick : _graph)
+        {
+            brick->render();
+        }
+    }
+
+    const AudioBuffer& output(int /*channel*/) const override {return *_output;}
+
+private:
+    float _attack{0.0f};
+    float _decay{1.6f};
+    float _sustain{0.3f};
+    float _release{1.6f};
+    float _pitch;
+    float _res{0.7f};
+    float _clip{0.2f};
+    float _volume{0.7f};
+
+    LinearADSREnvelopeBrick           _env{&_attack, &_decay, &_sustain, &_release};
+    WtOscillatorBrick                 _osc{&_pitch};
+    SVFFilterBrick                    _filt{_env.control_output(LinearADSREnvelopeBrick::ENV_OUT), &_res, _osc.audio_output(WtOscillatorBrick::OSC_OUT)};
+    AASaturationBrick<ClipType::SOFT> _dist{&_clip, _filt.audio_output(SVFFilterBrick::LOWPASS)};
+    ControlMultiplierBrick<2>         _amp_level{&_volume, _env.control_output(LinearADSREnvelopeBrick::ENV_OUT)};
+    VcaBrick<Response::LINEAR>        _amp{_amp_level.control_output(ControlMultiplierBrick<2>::MULT_OUT), _dist.audio_output(AASaturationBrick<ClipType::SOFT>::CLIP_OUT)};
+
+    const AudioBuffer*                _output{_amp.audio_output(VcaBrick<Response::LINEAR>::VCA_OUT)};
+
+    std::vector<DspBrick*> _graph{&_env, &_osc, &_filt, &_dist, &_amp_level, &_amp};
+};
+
+int main()
+{
+    std::vector<std::unique_ptr<Voice>> voices;
+    std::vector<std::unique_ptr<SndfileSink>> sinks;
+    OfflineRenderer renderer;
+
+    for (int i = 0; i < VOICES; ++i)
+    {
+        /* One note per semitone from C2 */
+        voices.push_back(std::make_unique<Voice>(note_to_control(36 + i)));
+        sinks.push_back(std::make_unique<SndfileSink>("./voice_" + std::to_string(i) + ".wav", 1));
+        if (!sinks.back()->valid())
+        {
+            std::cout << "Couldn't open file for writing: " << sf_strerror(nullptr) << std::endl;
+            return -1;
+        }
+        renderer.add_job(voices.back().get(), sinks.back().get(), static_cast<int64_t>(SECONDS_TO_RENDER * EXAMPLE_SAMPLERATE));
+    }
+
+    auto stats = renderer.run(EXAMPLE_SAMPLERATE);
+    std::cout << "Rendered " << VOICES << " voices on " << renderer.threads() << " threads in " << stats.seconds
+              << " s, " << stats.realtime_factor << " x realtime" << std::endl;
+    return 0;
+}
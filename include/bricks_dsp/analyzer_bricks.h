@@ -1,16 +1,31 @@
 #ifndef BRICKS_DSP_ANALYZER_BRICKS_H
 #define BRICKS_DSP_ANALYZER_BRICKS_H
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <cassert>
 
 #include "dsp_brick.h"
 #include "utils.h"
-#include "expiring_queue.h"
+#include "snapshot_buffer.h"
+#include "sample_ring.h"
+#include "fft.h"
+#include "filter_bricks.h"
 
 namespace bricks {
 
+/* Captures blocks of block_size samples for display, starting at the first
+ * sample over the trigger level. Completed blocks are published from the audio
+ * thread through a SnapshotBuffer, which any number of gui threads can read
+ * from directly with read_display_data(), or through sync() and display_data()
+ * for a single reader that wants its own copy. */
 template <int block_size, int past_blocks = 4>
 class OscilloscopeBrick : public DspBrickImpl<2, 0, 1, 0>
 {
@@ -25,32 +40,42 @@ public:
 
     OscilloscopeBrick()
     {
-        _rt_data = std::make_unique<ExpiringQueue<Block, past_blocks>>();
+        _rt_data = std::make_unique<SnapshotBuffer<Block, past_blocks>>();
         _data = std::make_unique<std::array<Block, past_blocks>>();
     };
 
-    OscilloscopeBrick(const float* trig_level, const AudioBuffer* audio_in)
+    OscilloscopeBrick(const float* trig_level, const AudioBuffer* audio_in) : OscilloscopeBrick()
     {
-        OscilloscopeBrick();
         set_control_input(0, trig_level);
         set_audio_input(0, audio_in);
     }
 
     void reset() override
     {
-        //_rt_data->clear();
         for (auto& i : *_data.get())
         {
             i.fill(0);
         }
     }
 
+    /* Copy the blocks published since the last call to the data returned by
+     * display_data(). Not thread safe, for use from a single gui thread */
     void sync()
     {
-        for (int i = 0; i < past_blocks; ++i)
+        auto count = _rt_data->frame_count();
+        int new_blocks = static_cast<int>(std::min<uint64_t>(count - _synced_count, past_blocks));
+        auto& data = *_data;
+        /* Older blocks move back in history */
+        std::move_backward(data.begin(), data.end() - new_blocks, data.end());
+        for (int i = 0; i < new_blocks; ++i)
         {
-            (*_data)[i] = _rt_data->get(i);
+            /* Fails if the block was overwritten, or not enough have been published */
+            if (!_rt_data->read_copy(i, data[i]))
+            {
+                data[i].fill(0);
+            }
         }
+        _synced_count = count;
     }
 
     const Block& display_data(int history)
@@ -58,6 +83,19 @@ public:
         return (*_data)[history];
     }
 
+    /* Zero copy access to the block published history blocks before the latest,
+     * can be called from any number of threads. Returns false if the block was
+     * overwritten during the call, in which case the data passed to fun should
+     * be discarded */
+    template <typename Function>
+    bool read_display_data(int history, Function&& fun) const
+    {
+        return _rt_data->read(history, std::forward<Function>(fun));
+    }
+
+    /* Number of blocks published, for checking if there is new data */
+    uint64_t block_count() const {return _rt_data->frame_count();}
+
     void render() override
     {
         float trig_level = _ctrl_value(ControlInput::TRIG_LEVEL);
@@ -66,6 +104,8 @@ public:
         int trig_count = _trig_count;
         float prev = 0;
 
+        /* The block is written in place and only published when complete */
+        Block* block = &_rt_data->write_slot();
         auto& in = _input_buffer(0);
         for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
         {
@@ -82,10 +122,11 @@ public:
 
             if (trig_count++ > skip)
             {
-                _block[_block_index++] = sample;
-                if (_block_index >= _block.size())
+                (*block)[_block_index++] = sample;
+                if (_block_index >= block_size)
                 {
-                    _rt_data->push(_block);
+                    _rt_data->publish();
+                    block = &_rt_data->write_slot();
                     _block_index = 0;
                     triggered = false;
                 }
@@ -101,17 +142,17 @@ public:
 private:
     static constexpr float HYSTERESIS = 0.1;
 
-    std::unique_ptr<ExpiringQueue<Block, past_blocks>> _rt_data;
+    std::unique_ptr<SnapshotBuffer<Block, past_blocks>> _rt_data;
     std::unique_ptr<std::array<Block, past_blocks>> _data;
+    uint64_t _synced_count{0};
 
-    Block _block;
     int _block_index{0};
     bool _triggered{false};
     float _trig_value{0};
     int _trig_count{0};
 };
 
-/* Metering, rms and peak */
+/* Metering, rms and peak. Only every skip:th sample is used */
 template<int skip = 1>
 class MeterBrick : public DspBrickImpl<0, 2, 1, 0>
 {
@@ -140,20 +181,19 @@ public:
     void render() override
     {
         float sq_sum = 0;
-        float min = std::numeric_limits<float>::max();
-        float max = std::numeric_limits<float>::min();
+        float peak = 0;
 
+        /* Branchless reductions so that the loop vectorises */
         auto& in = _input_buffer(0);
-        for (int i = 0; i < in.size(); i += skip)
+        for (int i = 0; i < PROC_BLOCK_SIZE; i += skip)
         {
             float s = in[i];
             sq_sum += s * s;
-            min = s < min ? s : min;
-            max = s > max ? s : max;
+            peak = std::max(peak, std::abs(s));
         }
         float rms = std::sqrt((skip / static_cast<float>(PROC_BLOCK_SIZE)) * sq_sum);
         _rms_smoother.set(from_db_approx(rms));
-        _peak_smoother.set(from_db_approx(std::max(max, -min)));
+        _peak_smoother.set(from_db_approx(peak));
         _set_ctrl_value(ControlOutput::RMS, _rms_smoother.get());
         _set_ctrl_value(ControlOutput::PEAK, _peak_smoother.get());
     }
@@ -163,6 +203,402 @@ private:
     OnePoleLag<PROC_BLOCK_SIZE / 4>  _peak_smoother;
 };
 
+/* True peak meter according to ITU-R BS.1770-4 annex 2. Finds the peaks
+ * between samples by oversampling 4 times with a 48 tap polyphase fir filter.
+ * Outputs the linear true peak level of the last block and the highest since
+ * the last reset. */
+class TruePeakMeterBrick : public DspBrickImpl<0, 2, 1, 0>
+{
+public:
+    enum ControlOutput
+    {
+        TRUE_PEAK = 0,
+        MAX_TRUE_PEAK
+    };
+
+    static constexpr int OVERSAMPLING = 4;
+    static constexpr int TAPS_PER_PHASE = 12;
+
+    TruePeakMeterBrick() = default;
+
+    TruePeakMeterBrick(const AudioBuffer* audio_in)
+    {
+        set_audio_input(0, audio_in);
+    }
+
+    void reset() override;
+
+    void render() override;
+
+private:
+    /* The last TAPS_PER_PHASE - 1 samples of the previous block followed by the current block */
+    std::array<float, TAPS_PER_PHASE - 1 + PROC_BLOCK_SIZE> _history{};
+    float _max_peak{0};
+};
+
+/* Loudness meter according to ITU-R BS.1770-4 and EBU R128. Outputs the
+ * momentary (400 ms window), short term (3 s window) and gated integrated
+ * loudness, since the last reset, in LUFS. Updated every 100 ms.
+ * All channels have a weight of 1, i.e. left, right and center, surround
+ * channel weights are not supported.
+ * The integrated loudness keeps a histogram of 400 ms block loudness with
+ * 0.1 LU resolution, instead of a list of all blocks, so the memory use is
+ * constant and it's safe to run for any length of time. */
+template <int channels = 2>
+class LoudnessMeterBrick : public DspBrickImpl<0, 3, channels, 0>
+{
+public:
+    enum ControlOutput
+    {
+        MOMENTARY = 0,
+        SHORT_TERM,
+        INTEGRATED
+    };
+
+    /* Output when there's no signal or not enough audio has been measured */
+    static constexpr float MIN_LOUDNESS = -120.0f;
+    static constexpr float ABSOLUTE_GATE = -70.0f;
+    static constexpr float RELATIVE_GATE = -10.0f;
+
+    LoudnessMeterBrick()
+    {
+        set_samplerate(DEFAULT_SAMPLERATE);
+    }
+
+    template <class ...T>
+    explicit LoudnessMeterBrick(T... inputs) : LoudnessMeterBrick()
+    {
+        static_assert(sizeof...(inputs) == channels);
+        std::array<const AudioBuffer*, channels> audio_ins = {{inputs...}};
+        for (int i = 0; i < channels; ++i)
+        {
+            this->set_audio_input(i, audio_ins[i]);
+        }
+    }
+
+    void set_samplerate(float samplerate) override
+    {
+        /* K-weighting filters, a high shelf followed by a high pass, same as libebur128 */
+        double k = std::tan(M_PI * SHELF_FREQ / samplerate);
+        double vh = std::pow(10.0, SHELF_GAIN_DB / 20.0);
+        double vb = std::pow(vh, SHELF_VB_EXP);
+        double a0 = 1.0 + k / SHELF_Q + k * k;
+        _shelf.b0 = static_cast<float>((vh + vb * k / SHELF_Q + k * k) / a0);
+        _shelf.b1 = static_cast<float>(2.0 * (k * k - vh) / a0);
+        _shelf.b2 = static_cast<float>((vh - vb * k / SHELF_Q + k * k) / a0);
+        _shelf.a1 = static_cast<float>(2.0 * (k * k - 1.0) / a0);
+        _shelf.a2 = static_cast<float>((1.0 - k / SHELF_Q + k * k) / a0);
+
+        k = std::tan(M_PI * HIGHPASS_FREQ / samplerate);
+        a0 = 1.0 + k / HIGHPASS_Q + k * k;
+        _highpass.b0 = 1.0f;
+        _highpass.b1 = -2.0f;
+        _highpass.b2 = 1.0f;
+        _highpass.a1 = static_cast<float>(2.0 * (k * k - 1.0) / a0);
+        _highpass.a2 = static_cast<float>((1.0 - k / HIGHPASS_Q + k * k) / a0);
+
+        _sub_block_length = static_cast<int>(std::round(samplerate * SUB_BLOCK_SECONDS));
+        reset();
+    }
+
+    void reset() override
+    {
+        _registers = {};
+        _sub_block_pos = 0;
+        _sub_block_sum = 0;
+        _sub_blocks.fill(0);
+        _sub_block_index = 0;
+        _sub_block_count = 0;
+        _histogram.fill(0);
+        _histogram_sum = 0;
+        _histogram_count = 0;
+        for (auto output : {MOMENTARY, SHORT_TERM, INTEGRATED})
+        {
+            this->_set_ctrl_value(output, MIN_LOUDNESS);
+        }
+    }
+
+    void render() override
+    {
+        AudioBuffer squares;
+        squares.fill(0.0f);
+        for (int c = 0; c < channels; ++c)
+        {
+            /* Both filter stages in the same loop, so their recursions can overlap */
+            const auto& in = this->_input_buffer(c);
+            auto shelf_reg = _registers[c][0];
+            auto highpass_reg = _registers[c][1];
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                float weighted = render_biquad_sample(render_biquad_sample(in[i], _shelf, shelf_reg), _highpass, highpass_reg);
+                squares[i] += weighted * weighted;
+            }
+            flush_denormals(shelf_reg);
+            flush_denormals(highpass_reg);
+            _registers[c][0] = shelf_reg;
+            _registers[c][1] = highpass_reg;
+        }
+
+        /* Sub blocks are generally not a multiple of the block size */
+        int pos = 0;
+        while (pos < PROC_BLOCK_SIZE)
+        {
+            int count = std::min(PROC_BLOCK_SIZE - pos, _sub_block_length - _sub_block_pos);
+            float sum = 0;
+            for (int i = pos; i < pos + count; ++i)
+            {
+                sum += squares[i];
+            }
+            _sub_block_sum += sum;
+            _sub_block_pos += count;
+            pos += count;
+            if (_sub_block_pos == _sub_block_length)
+            {
+                _end_sub_block();
+            }
+        }
+    }
+
+private:
+    static constexpr double SHELF_FREQ = 1681.974450955533;
+    static constexpr double SHELF_GAIN_DB = 3.999843853973347;
+    static constexpr double SHELF_Q = 0.7071752369554196;
+    static constexpr double SHELF_VB_EXP = 0.4996667741545416;
+    static constexpr double HIGHPASS_FREQ = 38.13547087602444;
+    static constexpr double HIGHPASS_Q = 0.5003270373238773;
+
+    static constexpr double SUB_BLOCK_SECONDS = 0.1;
+    static constexpr int MOMENTARY_SUB_BLOCKS = 4;
+    static constexpr int SHORT_TERM_SUB_BLOCKS = 30;
+
+    /* Histogram bins of 0.1 LU from the absolute gate up to +5 LUFS */
+    static constexpr float HISTOGRAM_MAX = 5.0f;
+    static constexpr float HISTOGRAM_STEP = 0.1f;
+    static constexpr int HISTOGRAM_BINS = static_cast<int>((HISTOGRAM_MAX - ABSOLUTE_GATE) / HISTOGRAM_STEP);
+
+    static float _to_loudness(double mean_square)
+    {
+        return mean_square > 0 ? static_cast<float>(-0.691 + 10.0 * std::log10(mean_square)) : MIN_LOUDNESS;
+    }
+
+    static double _to_mean_square(double loudness)
+    {
+        return std::pow(10.0, (loudness + 0.691) / 10.0);
+    }
+
+    /* Mean square at the center of each histogram bin */
+    static inline const std::array<double, HISTOGRAM_BINS> BIN_MEAN_SQUARES = []()
+    {
+        std::array<double, HISTOGRAM_BINS> mean_squares;
+        for (int b = 0; b < HISTOGRAM_BINS; ++b)
+        {
+            mean_squares[b] = _to_mean_square(ABSOLUTE_GATE + (b + 0.5) * HISTOGRAM_STEP);
+        }
+        return mean_squares;
+    }();
+
+    /* Mean square of the latest count sub blocks */
+    double _window_mean_square(int count) const
+    {
+        double sum = 0;
+        for (int i = 1; i <= count; ++i)
+        {
+            sum += _sub_blocks[(_sub_block_index - i + SHORT_TERM_SUB_BLOCKS) % SHORT_TERM_SUB_BLOCKS];
+        }
+        return sum / count;
+    }
+
+    void _end_sub_block()
+    {
+        _sub_blocks[_sub_block_index] = _sub_block_sum / _sub_block_length;
+        _sub_block_index = (_sub_block_index + 1) % SHORT_TERM_SUB_BLOCKS;
+        _sub_block_count++;
+        _sub_block_sum = 0;
+        _sub_block_pos = 0;
+
+        if (_sub_block_count >= MOMENTARY_SUB_BLOCKS)
+        {
+            /* Gating blocks are the momentary windows, overlapping by 75% */
+            float momentary = _to_loudness(_window_mean_square(MOMENTARY_SUB_BLOCKS));
+            this->_set_ctrl_value(MOMENTARY, momentary);
+            if (momentary >= ABSOLUTE_GATE)
+            {
+                int bin = std::min(static_cast<int>((momentary - ABSOLUTE_GATE) / HISTOGRAM_STEP), HISTOGRAM_BINS - 1);
+                _histogram[bin]++;
+                _histogram_sum += BIN_MEAN_SQUARES[bin];
+                _histogram_count++;
+            }
+            this->_set_ctrl_value(INTEGRATED, _integrated_loudness());
+        }
+        if (_sub_block_count >= SHORT_TERM_SUB_BLOCKS)
+        {
+            this->_set_ctrl_value(SHORT_TERM, _to_loudness(_window_mean_square(SHORT_TERM_SUB_BLOCKS)));
+        }
+    }
+
+    /* Mean of the blocks over the absolute gate, kept as a running sum, then
+     * of the blocks over the relative gate, which only walks the bins above it */
+    float _integrated_loudness() const
+    {
+        if (_histogram_count == 0)
+        {
+            return MIN_LOUDNESS;
+        }
+        double ungated = _histogram_sum / _histogram_count;
+        float relative_gate = _to_loudness(ungated) + RELATIVE_GATE;
+        int first_bin = std::clamp(static_cast<int>(std::ceil((relative_gate - ABSOLUTE_GATE) / HISTOGRAM_STEP)), 0, HISTOGRAM_BINS - 1);
+        double sum = 0;
+        int64_t count = 0;
+        for (int b = first_bin; b < HISTOGRAM_BINS; ++b)
+        {
+            sum += _histogram[b] * BIN_MEAN_SQUARES[b];
+            count += _histogram[b];
+        }
+        return count > 0 ? _to_loudness(sum / count) : MIN_LOUDNESS;
+    }
+
+    Coefficients    _shelf;
+    Coefficients    _highpass;
+    std::array<std::array<Registers, 2>, channels> _registers{};
+
+    int             _sub_block_length;
+    int             _sub_block_pos{0};
+    double          _sub_block_sum{0};
+    std::array<double, SHORT_TERM_SUB_BLOCKS> _sub_blocks{};
+    int             _sub_block_index{0};
+    int             _sub_block_count{0};
+    std::array<uint32_t, HISTOGRAM_BINS> _histogram{};
+    double          _histogram_sum{0};
+    int64_t         _histogram_count{0};
+};
+
+/* Spectrum analyzer with log spaced frequency bands, for display. The audio
+ * thread only copies its input to a lock free ring buffer in render(). The
+ * windowed fft, averaging and banding is done in process(), which is called
+ * from a non realtime thread, typically an AnalyzerWorker shared by several
+ * analyzers. Finished frames of band levels in dB are published through a
+ * SnapshotBuffer and can be read by any number of gui threads. */
+class SpectrumAnalyzerBrick : public DspBrickImpl<1, 0, 1, 0>
+{
+public:
+    static constexpr int MAX_BANDS = 256;
+
+    /* Band levels in dB, only the first bands() values are used. Fixed size so
+     * that readers can copy it while the writer may be overwriting it */
+    using Frame = std::array<float, MAX_BANDS>;
+
+    enum ControlInput
+    {
+        AVERAGING = 0
+    };
+
+    static constexpr int DEFAULT_FFT_SIZE = 2048;
+    static constexpr int DEFAULT_BANDS = 64;
+    static constexpr float MIN_FREQ = 20.0f;
+    static constexpr float MIN_DB = -120.0f;
+
+    /* fft_size must be a power of 2. Consecutive ffts overlap by half the fft size.
+     * bands is limited to MAX_BANDS */
+    explicit SpectrumAnalyzerBrick(int fft_size = DEFAULT_FFT_SIZE, int bands = DEFAULT_BANDS);
+
+    SpectrumAnalyzerBrick(const float* averaging, const AudioBuffer* audio_in,
+                          int fft_size = DEFAULT_FFT_SIZE, int bands = DEFAULT_BANDS) : SpectrumAnalyzerBrick(fft_size, bands)
+    {
+        set_control_input(ControlInput::AVERAGING, averaging);
+        set_audio_input(0, audio_in);
+    }
+
+    /* Not safe to call while process() is running */
+    void set_samplerate(float samplerate) override;
+
+    /* Realtime safe, the analysis state is cleared on the next call to process() */
+    void reset() override;
+
+    void render() override;
+
+    /* Non realtime. Analyse all samples received since the last call and
+     * publish new frames. Returns true if at least one frame was published.
+     * After a reset(), samples rendered before it are discarded and a silent
+     * frame is published */
+    bool process();
+
+    int bands() const {return _bands;}
+
+    /* Center frequency of a band in Hz */
+    float band_frequency(int band) const {return _band_freqs[band];}
+
+    /* Zero copy access to the latest frame (age = 0) or the one before (age = 1),
+     * from any thread. Returns false if the frame was overwritten during the call
+     * or is not yet available */
+    template <typename Function>
+    bool read_frame(int age, Function&& fun) const
+    {
+        return _frames.read(age, std::forward<Function>(fun));
+    }
+
+    bool read_frame_copy(int age, Frame& dest) const {return _frames.read_copy(age, dest);}
+
+    uint64_t frame_count() const {return _frames.frame_count();}
+
+    /* Samples dropped because process() was not called often enough */
+    int64_t dropped_samples() const {return _ring.dropped();}
+
+private:
+    void _clear_analysis();
+
+    void _analyse_frame();
+
+    int                         _fft_size;
+    int                         _hop_size;
+    int                         _bands;
+    float                       _samplerate{DEFAULT_SAMPLERATE};
+    std::atomic<float>          _averaging{0.0f};
+    SampleRing<float>           _ring;
+    SnapshotBuffer<Frame, 2>    _frames;
+    /* Ring write position at the latest reset() + 1, 0 if there is none pending */
+    std::atomic<uint64_t>       _reset_request{0};
+
+    /* Only accessed from process() */
+    RealFft                     _fft;
+    int                         _hop_fill{0};
+    float                       _power_norm;
+    std::vector<float>          _window;
+    std::vector<float>          _history;
+    std::vector<float>          _windowed;
+    std::vector<float>          _re;
+    std::vector<float>          _im;
+    std::vector<float>          _avg_power;
+    std::vector<float>          _band_freqs;
+    /* Fft bins [_band_first[b], _band_last[b]) are summed for band b */
+    std::vector<int>            _band_first;
+    std::vector<int>            _band_last;
+};
+
+/* Background thread that calls process() on a set of analyzers at a regular
+ * interval, i.e. at the gui frame rate. */
+class AnalyzerWorker
+{
+public:
+    explicit AnalyzerWorker(std::chrono::milliseconds interval = std::chrono::milliseconds(16));
+
+    ~AnalyzerWorker();
+
+    /* Analyzers must be removed before they are destroyed */
+    void add(SpectrumAnalyzerBrick* analyzer);
+
+    void remove(SpectrumAnalyzerBrick* analyzer);
+
+private:
+    void _run();
+
+    std::chrono::milliseconds           _interval;
+    std::mutex                          _mutex;
+    std::condition_variable             _quit_cond;
+    bool                                _quit{false};
+    std::vector<SpectrumAnalyzerBrick*> _analyzers;
+    std::thread                         _thread;
+};
+
 }// namespace bricks
 
 #endif //BRICKS_DSP_ANALYZER_BRICKS_H
@@ -0,0 +1,112 @@
+#ifndef BRICKS_DSP_BATCH_RENDERER_H
+#define BRICKS_DSP_BATCH_RENDERER_H
+
+#include <array>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "offline_renderer.h"
+#include "random_device.h"
+
+namespace bricks {
+
+/* Renders many variants of the same patch, i.e. preset previews, in parallel
+ * with a different set of parameter values for each variant.
+ *
+ * Patch is a RenderSource with a fixed graph of bricks, so the topology and
+ * render order is compiled in and shared by all variants, and must also have:
+ *
+ *   static constexpr int PARAMETERS       - Number of parameter values per variant
+ *   using SharedData = ...                - Read only data used by all instances, i.e.
+ *                                           ImpulseResponses or Wavetables
+ *   Patch(const SharedData& shared)       - Constructor, should only keep references or
+ *                                           shared_ptrs to the shared data, not copies
+ *   void set_samplerate(float samplerate)
+ *   void reset()                          - Clear all state, before each variant
+ *   void set_parameters(const float* values)
+ *
+ * Instead of creating one patch per variant, each worker thread creates one
+ * instance when it renders its first variant and then resets and reuses it for
+ * all following variants, so the setup cost is paid once per thread and the
+ * memory used is the shared data plus one patch per thread, independent of the
+ * number of variants.
+ *
+ * Patches are constructed in a RandomContext with a fixed seed, so as long as
+ * reset() also restarts the random generators of the patch, every variant is
+ * rendered with the same noise, regardless of the worker it's rendered on. */
+template <typename Patch>
+class BatchRenderer
+{
+public:
+    using Parameters = std::array<float, Patch::PARAMETERS>;
+
+    /* Called from the worker threads, must be thread safe. The sink must stay valid
+     * until it is closed or the call to render() returns */
+    using SinkProvider = std::function<RenderSink*(int variant)>;
+
+    explicit BatchRenderer(std::shared_ptr<const typename Patch::SharedData> shared_data,
+                           int threads = 0, int chunk_size = OfflineRenderer::DEFAULT_CHUNK_SIZE) : _shared_data(std::move(shared_data)),
+                                                                                                    _renderer(threads, chunk_size)
+    {
+        _patches.resize(_renderer.threads());
+    }
+
+    /* Render length samples of every variant in parameters, block until all are written */
+    RenderStats render(const std::vector<Parameters>& parameters, const SinkProvider& sinks,
+                       int64_t length, float samplerate = DEFAULT_SAMPLERATE)
+    {
+        auto setup = [&](int worker, int variant) -> RenderJob
+        {
+            auto& patch = _patches[worker];
+            if (!patch)
+            {
+                /* Created by the worker thread so its memory is local to it */
+                RandomContext random_context(RANDOM_SEED);
+                patch = std::make_unique<Patch>(*_shared_data);
+            }
+            patch->set_samplerate(samplerate);
+            patch->reset();
+            patch->set_parameters(parameters[variant].data());
+            return {patch.get(), sinks(variant), length};
+        };
+        return _renderer.run(static_cast<int>(parameters.size()), setup, samplerate);
+    }
+
+    int threads() const {return _renderer.threads();}
+
+    const typename Patch::SharedData& shared_data() const {return *_shared_data;}
+
+    /* Every combination of the given values for each parameter, with the first
+     * parameter changing the slowest, for rendering a grid of variants */
+    static std::vector<Parameters> parameter_grid(const std::array<std::vector<float>, Patch::PARAMETERS>& values)
+    {
+        std::vector<Parameters> grid(1);
+        for (int p = 0; p < Patch::PARAMETERS; ++p)
+        {
+            std::vector<Parameters> expanded;
+            expanded.reserve(grid.size() * values[p].size());
+            for (const auto& row : grid)
+            {
+                for (float value : values[p])
+                {
+                    expanded.push_back(row);
+                    expanded.back()[p] = value;
+                }
+            }
+            grid = std::move(expanded);
+        }
+        return grid;
+    }
+
+private:
+    static constexpr uint32_t RANDOM_SEED = 0;
+
+    std::shared_ptr<const typename Patch::SharedData> _shared_data;
+    OfflineRenderer                                    _renderer;
+    std::vector<std::unique_ptr<Patch>>                _patches;
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_BATCH_RENDERER_H
@@ -7,6 +7,7 @@ constexpr int VERSION_MINOR = BRICKS_DSP_VERSION_MINOR;
 }
 
 #include "dsp_brick.h"
+#include "denormal_guard.h"
 #include "analyzer_bricks.h"
 #include "envelope_bricks.h"
 #include "filter_bricks.h"
@@ -0,0 +1,85 @@
+#ifndef BRICKS_DSP_DENORMAL_GUARD_H
+#define BRICKS_DSP_DENORMAL_GUARD_H
+
+#include <cstdint>
+
+#if defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1)
+#include <xmmintrin.h>
+#define BRICKS_DSP_X86_FLUSH_TO_ZERO
+#elif defined(__aarch64__) && (defined(__GNUC__) || defined(__clang__))
+#define BRICKS_DSP_ARM64_FLUSH_TO_ZERO
+#endif
+
+namespace bricks {
+
+/* Sets flush-to-zero (and denormals-are-zero where available) for the calling
+ * thread during the lifetime of the object, and restores the previous state
+ * when it goes out of scope.
+ * Denormal numbers show up in the decaying tails of recursive filters and
+ * feedback delays and can be up to 100 times slower to process on some cpus.
+ * Create one at the top of every thread that calls render() on bricks. */
+class ScopedDenormalGuard
+{
+public:
+    ScopedDenormalGuard() : _prev_state(_get_state())
+    {
+        _set_state(_prev_state | FLUSH_FLAGS);
+    }
+
+    ~ScopedDenormalGuard()
+    {
+        _set_state(_prev_state);
+    }
+
+    ScopedDenormalGuard(const ScopedDenormalGuard&) = delete;
+    ScopedDenormalGuard& operator=(const ScopedDenormalGuard&) = delete;
+
+    /* True if denormals are flushed to zero in hardware for the calling thread */
+    static bool active()
+    {
+        return FLUSH_FLAGS != 0 && (_get_state() & FLUSH_FLAGS) == FLUSH_FLAGS;
+    }
+
+    /* False on platforms where this class is a no-op, in that case build with
+     * BRICKS_DSP_DENORMAL_SAFE to flush denormals inside the bricks instead */
+    static constexpr bool supported() {return FLUSH_FLAGS != 0;}
+
+private:
+#if defined(BRICKS_DSP_X86_FLUSH_TO_ZERO)
+    using StateType = unsigned int;
+    /* Bit 15 - Flush to zero, bit 6 - Denormals are zero */
+    static constexpr StateType FLUSH_FLAGS = 0x8040;
+
+    static StateType _get_state() {return _mm_getcsr();}
+    static void _set_state(StateType state) {_mm_setcsr(state);}
+
+#elif defined(BRICKS_DSP_ARM64_FLUSH_TO_ZERO)
+    using StateType = uint64_t;
+    /* Bit 24 - Flush to zero, covers both inputs and outputs on arm */
+    static constexpr StateType FLUSH_FLAGS = 1 << 24;
+
+    static StateType _get_state()
+    {
+        StateType state;
+        asm volatile("mrs %0, fpcr" : "=r"(state));
+        return state;
+    }
+
+    static void _set_state(StateType state)
+    {
+        asm volatile("msr fpcr, %0" : : "r"(state));
+    }
+#else
+    using StateType = uint32_t;
+    static constexpr StateType FLUSH_FLAGS = 0;
+
+    static StateType _get_state() {return 0;}
+    static void _set_state(StateType /*state*/) {}
+#endif
+
+    StateType _prev_state;
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_DENORMAL_GUARD_H
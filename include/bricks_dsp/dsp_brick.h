@@ -156,7 +156,7 @@ private:
 #ifdef BRICKS_DSP_INTERNAL_BUFFERS
     std::array<AudioBuffer, audio_outs>         _audio_outs;
 #else
-    std::array<AudioBuffer*, audio_outs>        _audio_outs;
+    std::array<AudioBuffer*, audio_outs>        _audio_outs{};
 #endif
 };
 
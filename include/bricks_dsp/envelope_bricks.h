@@ -1,6 +1,9 @@
 #ifndef BRICKS_DSP_ENVELOPE_BRICKS_H
 #define BRICKS_DSP_ENVELOPE_BRICKS_H
 
+#include <algorithm>
+#include <initializer_list>
+
 #include "dsp_brick.h"
 #include "random_device.h"
 
@@ -68,6 +71,476 @@ private:
     float         _samplerate{DEFAULT_SAMPLERATE};
 };
 
+/* Renders at most max_samples of a linear envelope segment from level towards
+ * target, with inc added per sample, and returns the number of samples rendered.
+ * The length of the segment is calculated up front, so the samples are filled
+ * in one vectorised loop without comparisons. When the target is reached, the
+ * last sample rendered is exactly target, level is set to target and reached
+ * is set to true. If level is already at or past target, nothing is rendered
+ * and the target counts as reached, i.e. if the sustain level was raised
+ * during the decay. */
+inline int render_linear_segment(float* dest, int max_samples, float& level, float target, float inc, bool& reached)
+{
+    /* Tolerance in samples, so that rounding errors don't add an extra sample */
+    constexpr float STEP_TOLERANCE = 1.0e-3f;
+    float distance = target - level;
+    int samples = 0;
+    if (distance * inc > 0.0f)
+    {
+        float steps = std::ceil(distance / inc - STEP_TOLERANCE);
+        samples = static_cast<int>(std::min(steps, static_cast<float>(max_samples + 1)));
+    }
+    reached = samples <= max_samples;
+    if (!reached)
+    {
+        level = fill_linear_ramp(dest, max_samples, level, inc);
+        return max_samples;
+    }
+    if (samples > 0)
+    {
+        fill_linear_ramp(dest, samples - 1, level, inc);
+        dest[samples - 1] = target;
+    }
+    level = target;
+    return samples;
+}
+
+/* Bank of linear slope ADSR envelopes generated at audio rate, for a number of
+ * voices that share the same attack, decay, sustain and release controls.
+ * Audio output n is the envelope of voice n.
+ * Instead of running a state machine per sample, the number of samples until
+ * the next stage is calculated from the level and slope of each voice, and
+ * whole segments are filled with ramps. So the cost of a voice is one
+ * vectorised loop per segment, and there is no branching per sample.
+ * Attack, decay and release times are in seconds, the decay time is for a
+ * decay from 1 to 0, and the release always takes the release time, whatever
+ * the level was when the gate was released. */
+template <int voices>
+class PolyADSRBrick : public DspBrickImpl <4, 0, 0, voices>
+{
+public:
+    enum ControlInput
+    {
+        ATTACK = 0,
+        DECAY,
+        SUSTAIN,
+        RELEASE
+    };
+
+    PolyADSRBrick() = default;
+
+    PolyADSRBrick(const float* attack, const float* decay, const float* sustain, const float* release)
+    {
+        this->set_control_input(ControlInput::ATTACK, attack);
+        this->set_control_input(ControlInput::DECAY, decay);
+        this->set_control_input(ControlInput::SUSTAIN, sustain);
+        this->set_control_input(ControlInput::RELEASE, release);
+    }
+
+    /* Setting gate to true starts the attack phase of a voice from its current
+     * level, so retriggering a voice that is still running doesn't click.
+     * Setting it to false starts the release phase. */
+    void gate(int voice, bool gate)
+    {
+        assert(voice >= 0 && voice < voices);
+        if (gate)
+        {
+            _stage[voice] = Stage::ATTACK;
+        }
+        else if (_stage[voice] != Stage::OFF)
+        {
+            _stage[voice] = Stage::RELEASE;
+            _release_level[voice] = _level[voice];
+        }
+    }
+
+    bool finished(int voice) const {return _stage[voice] == Stage::OFF;}
+
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate = samplerate;
+    }
+
+    void reset() override
+    {
+        _stage.fill(Stage::OFF);
+        _level.fill(0.0f);
+        _release_level.fill(0.0f);
+    }
+
+    void render() override
+    {
+        /* Slopes in level per sample, all stages take at least 1 sample */
+        float attack_inc = 1.0f / std::max(_samplerate * this->_ctrl_value(ControlInput::ATTACK), 1.0f);
+        float decay_inc = 1.0f / std::max(_samplerate * this->_ctrl_value(ControlInput::DECAY), 1.0f);
+        float sustain = std::clamp(this->_ctrl_value(ControlInput::SUSTAIN), 0.0f, 1.0f);
+        float release_inv = 1.0f / std::max(_samplerate * this->_ctrl_value(ControlInput::RELEASE), 1.0f);
+
+        for (int v = 0; v < voices; ++v)
+        {
+            _render_voice(v, attack_inc, decay_inc, sustain, release_inv);
+        }
+    }
+
+private:
+    enum class Stage
+    {
+        OFF,
+        ATTACK,
+        DECAY,
+        SUSTAIN,
+        RELEASE,
+    };
+
+    void _render_voice(int voice, float attack_inc, float decay_inc, float sustain, float release_inv)
+    {
+        float* out = this->_output_buffer(voice).data();
+        float level = _level[voice];
+        Stage stage = _stage[voice];
+        int pos = 0;
+        while (pos < PROC_BLOCK_SIZE)
+        {
+            int remaining = PROC_BLOCK_SIZE - pos;
+            float target;
+            float inc;
+            Stage next;
+            switch (stage)
+            {
+                case Stage::OFF:
+                    level = 0.0f;
+                    std::fill(out + pos, out + PROC_BLOCK_SIZE, level);
+                    pos = PROC_BLOCK_SIZE;
+                    continue;
+
+                case Stage::SUSTAIN:
+                    level = sustain;
+                    std::fill(out + pos, out + PROC_BLOCK_SIZE, level);
+                    pos = PROC_BLOCK_SIZE;
+                    continue;
+
+                case Stage::ATTACK:
+                    target = 1.0f;
+                    inc = attack_inc;
+                    next = Stage::DECAY;
+                    break;
+
+                case Stage::DECAY:
+                    target = sustain;
+                    inc = -decay_inc;
+                    next = Stage::SUSTAIN;
+                    break;
+
+                case Stage::RELEASE:
+                default:
+                    target = 0.0f;
+                    inc = -_release_level[voice] * release_inv;
+                    next = Stage::OFF;
+                    break;
+            }
+
+            bool reached;
+            pos += render_linear_segment(out + pos, remaining, level, target, inc, reached);
+            if (reached)
+            {
+                stage = next;
+            }
+        }
+        _level[voice] = level;
+        _stage[voice] = stage;
+    }
+
+    std::array<Stage, voices>   _stage{};
+    std::array<float, voices>   _level{};
+    std::array<float, voices>   _release_level{};
+    float                       _samplerate{DEFAULT_SAMPLERATE};
+};
+
+/* Envelope made up of up to max_segments segments, each going from the level
+ * where the previous one ended to its own level in a fixed time, with a
+ * curvature per segment. With a sustain segment the envelope holds at the end
+ * of it while the gate is on, and with a loop it repeats the segments from
+ * loop start to loop end while the gate is on. Releasing the gate jumps to
+ * the segment after the sustain segment or loop, from the current level.
+ * Segment lengths and curves are precalculated when set, and segments are
+ * rendered in closed form, so the cost doesn't depend on the number of
+ * segments or their shapes. Gate changes can be given a sample offset into
+ * the next block to render. */
+template <int max_segments>
+class SegmentEnvelopeBrick : public DspBrickImpl<0, 0, 0, 1>
+{
+public:
+    enum AudioOutput
+    {
+        ENV_OUT = 0
+    };
+
+    /* The maximum number of gate changes per block */
+    static constexpr int MAX_GATE_EVENTS = 8;
+
+    struct Segment
+    {
+        float level;
+        /* In seconds, segments are at least 1 sample long */
+        float time;
+        /* 0 is linear. Negative values give a curve that starts fast and
+         * slows down, like a capacitor charging, positive values the opposite.
+         * The shape is (1 - e^(curve * x)) / (1 - e^curve) for x from 0 to 1 */
+        float curve{0};
+    };
+
+    SegmentEnvelopeBrick() = default;
+
+    /* Not realtime safe if the number of segments changes */
+    void set_segments(const Segment* segments, int count)
+    {
+        assert(count >= 0 && count <= max_segments);
+        std::copy(segments, segments + count, _segments.begin());
+        _segment_count = count;
+        _update_segments();
+        if (_state == State::RUNNING && _segment >= count)
+        {
+            _state = State::IDLE;
+        }
+    }
+
+    void set_segments(std::initializer_list<Segment> segments)
+    {
+        set_segments(segments.begin(), static_cast<int>(segments.size()));
+    }
+
+    /* The envelope holds at the end of this segment while the gate is on, -1 for no sustain */
+    void set_sustain_segment(int segment) {_sustain_segment = segment;}
+
+    /* Loop from the start of segment start to the end of segment end while the gate is on, -1 for no loop */
+    void set_loop(int start, int end)
+    {
+        _loop_start = start;
+        _loop_end = end;
+    }
+
+    /* Set up a delay, attack, hold, decay, sustain, release envelope. Times in seconds */
+    void set_dahdsr(float delay, float attack, float hold, float decay, float sustain, float release,
+                    float decay_curve = 0, float release_curve = 0)
+    {
+        set_segments({{0.0f, delay}, {1.0f, attack}, {1.0f, hold}, {sustain, decay, decay_curve}, {0.0f, release, release_curve}});
+        set_sustain_segment(3);
+        set_loop(-1, -1);
+    }
+
+    /* Setting gate to true restarts the envelope from the first segment, from
+     * the current level. Offset is the sample in the next rendered block where
+     * the gate changes */
+    void gate(bool gate, int offset = 0)
+    {
+        assert(offset >= 0 && offset < PROC_BLOCK_SIZE);
+        if (_event_count < MAX_GATE_EVENTS)
+        {
+            /* Keep the events sorted by offset */
+            int i = _event_count++;
+            for (; i > 0 && _events[i - 1].offset > offset; --i)
+            {
+                _events[i] = _events[i - 1];
+            }
+            _events[i] = {offset, gate};
+        }
+    }
+
+    bool finished() const {return _state == State::IDLE && _event_count == 0;}
+
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate = samplerate;
+        _update_segments();
+    }
+
+    void reset() override
+    {
+        _state = State::IDLE;
+        _gate = false;
+        _level = 0.0f;
+        _event_count = 0;
+    }
+
+    void render() override
+    {
+        float* out = _output_buffer(AudioOutput::ENV_OUT).data();
+        int pos = 0;
+        for (int e = 0; e < _event_count; ++e)
+        {
+            _render_span(out, pos, _events[e].offset);
+            pos = _events[e].offset;
+            _set_gate(_events[e].gate);
+        }
+        _event_count = 0;
+        _render_span(out, pos, PROC_BLOCK_SIZE);
+    }
+
+private:
+    enum class State
+    {
+        IDLE,
+        RUNNING,
+        SUSTAIN
+    };
+
+    struct GateEvent
+    {
+        int  offset;
+        bool gate;
+    };
+
+    /* Precalculated per segment */
+    struct SegmentData
+    {
+        int     samples;
+        float   inv_norm;
+        GeometricSeries<PROC_BLOCK_SIZE> powers;
+    };
+
+    void _update_segments()
+    {
+        for (int i = 0; i < _segment_count; ++i)
+        {
+            const auto& segment = _segments[i];
+            auto& data = _segment_data[i];
+            data.samples = std::max(1, static_cast<int>(std::round(segment.time * _samplerate)));
+            if (segment.curve != 0.0f)
+            {
+                data.inv_norm = 1.0f / (1.0f - std::exp(segment.curve));
+                data.powers.set_ratio(std::exp(segment.curve / data.samples));
+            }
+        }
+        /* If the running segment got shorter than the position reached in it,
+         * it finishes with its next sample */
+        if (_state == State::RUNNING && _segment < _segment_count)
+        {
+            _segment_pos = std::min(_segment_pos, _segment_data[_segment].samples - 1);
+        }
+    }
+
+    void _set_gate(bool gate)
+    {
+        _gate = gate;
+        if (gate)
+        {
+            _start_segment(0);
+            return;
+        }
+        int release = std::max(_sustain_segment, _loop_end) + 1;
+        if (release > 0 && release < _segment_count &&
+            (_state == State::SUSTAIN || (_state == State::RUNNING && _segment < release)))
+        {
+            _start_segment(release);
+        }
+    }
+
+    void _start_segment(int segment)
+    {
+        if (segment >= _segment_count)
+        {
+            _state = State::IDLE;
+            return;
+        }
+        _state = State::RUNNING;
+        _segment = segment;
+        _segment_pos = 0;
+        _start_level = _level;
+    }
+
+    void _next_segment()
+    {
+        if (_gate && _segment == _loop_end && _loop_start >= 0)
+        {
+            _start_segment(_loop_start);
+        }
+        else if (_gate && _segment == _sustain_segment)
+        {
+            _state = State::SUSTAIN;
+        }
+        else
+        {
+            _start_segment(_segment + 1);
+        }
+    }
+
+    /* Render from sample start up to, but not including, end */
+    void _render_span(float* out, int start, int end)
+    {
+        while (start < end)
+        {
+            if (_state != State::RUNNING)
+            {
+                std::fill(out + start, out + end, _level);
+                return;
+            }
+            start += _render_segment(out + start, end - start);
+        }
+    }
+
+    /* Render at most max_samples samples of the current segment, returns the number rendered */
+    int _render_segment(float* dest, int max_samples)
+    {
+        const auto& segment = _segments[_segment];
+        const auto& data = _segment_data[_segment];
+        int pos = _segment_pos;
+        if (pos >= data.samples)
+        {
+            /* Already at the end, advance without rendering anything */
+            _level = segment.level;
+            _next_segment();
+            return 0;
+        }
+        int samples = std::min(max_samples, data.samples - pos);
+        float delta = segment.level - _start_level;
+        if (segment.curve == 0.0f)
+        {
+            float inc = delta / data.samples;
+            fill_linear_ramp(dest, samples, _start_level + inc * pos, inc);
+        }
+        else
+        {
+            /* level(n) = start + delta * (1 - e^(curve * n / samples)) * inv_norm, with
+             * e^(curve * (pos + i + 1) / samples) = e^(curve * pos / samples) * powers[i] */
+            float a = _start_level + delta * data.inv_norm;
+            float b = -delta * data.inv_norm * std::exp(segment.curve * pos / data.samples);
+            for (int i = 0; i < samples; ++i)
+            {
+                dest[i] = a + b * data.powers[i];
+            }
+        }
+        _segment_pos = pos + samples;
+        if (_segment_pos == data.samples)
+        {
+            dest[samples - 1] = segment.level;
+            _level = segment.level;
+            _next_segment();
+        }
+        else
+        {
+            _level = dest[samples - 1];
+        }
+        return samples;
+    }
+
+    std::array<Segment, max_segments>       _segments{};
+    std::array<SegmentData, max_segments>   _segment_data{};
+    int         _segment_count{0};
+    int         _sustain_segment{-1};
+    int         _loop_start{-1};
+    int         _loop_end{-1};
+
+    State       _state{State::IDLE};
+    bool        _gate{false};
+    int         _segment{0};
+    int         _segment_pos{0};
+    float       _start_level{0};
+    float       _level{0};
+    float       _samplerate{DEFAULT_SAMPLERATE};
+
+    std::array<GateEvent, MAX_GATE_EVENTS> _events;
+    int         _event_count{0};
+};
+
 /* Control rate linear ADSR envelope with linear slopes */
 class LinearADSREnvelopeBrick : public DspBrickImpl<4, 1, 0, 0>
 {
@@ -238,6 +711,7 @@ public:
     {
         _phase = 0;
         _level = 0;
+        _rand_device.seek(0);
         _set_ctrl_value(ControlOutput::LFO_OUT, 0);
     }
 
@@ -310,6 +784,12 @@ public:
 
     void set_samplerate(float samplerate) override;
 
+    void reset() override
+    {
+        _level = 0;
+        _rand_device.seek(0);
+    }
+
     void render() override
     {
         float out = _rand_device.get_norm() * GAIN_COMP;
@@ -326,6 +806,268 @@ private:
     float        _level{0};
     RandomDevice _rand_device;
 };
+
+/* Waveshapes shared by the LFOs below, which keep their phase as a 32 bit
+ * fixed point fraction of a cycle that wraps exactly */
+
+/* Phase increment from a fraction of a cycle in [0, 0.5]. Converted through a
+ * signed int, as that is what the simd instructions support */
+inline uint32_t lfo_phase_increment(float cycles)
+{
+    return static_cast<uint32_t>(static_cast<int32_t>(cycles * 2147483648.0f)) << 1u;
+}
+
+/* Fixed point phase to a float in [0, 1) */
+inline float lfo_phase_to_float(uint32_t phase)
+{
+    return static_cast<float>(static_cast<int32_t>(phase >> 8u)) * (1.0f / (1 << 24));
+}
+
+/* Triangle starting at 0 and rising, in phase with a sine */
+inline float lfo_triangle(float phase)
+{
+    float tri_phase = phase + 0.25f;
+    tri_phase -= tri_phase >= 1.0f ? 1.0f : 0.0f;
+    return 1.0f - 4.0f * std::abs(tri_phase - 0.5f);
+}
+
+inline float lfo_saw(float phase)
+{
+    return 2.0f * phase - 1.0f;
+}
+
+inline float lfo_pulse(float phase)
+{
+    return phase < 0.5f ? 1.0f : -1.0f;
+}
+
+/* LFO with audio rate output, for modulation that is too fast to be updated
+ * once per block without zipper noise, i.e. tremolo through an
+ * AudioMultiplierBrick. The rate is a control input with the same mapping as
+ * LfoBrick, the phase runs continuously between blocks.
+ * All waveforms are in the range [-1, 1] */
+class AudioRateLfoBrick : public DspBrickImpl<1, 0, 0, 1>
+{
+public:
+    enum class Waveform
+    {
+        SINE,
+        TRIANGLE,
+        SAW,
+        PULSE,
+        SAMPLE_HOLD, // New random value every cycle
+        RANDOM,      // Linear ramps between random values, one per cycle
+    };
+
+    enum ControlInput
+    {
+        RATE = 0
+    };
+
+    enum AudioOutput
+    {
+        LFO_OUT = 0
+    };
+
+    AudioRateLfoBrick() = default;
+
+    AudioRateLfoBrick(const float* rate)
+    {
+        set_control_input(ControlInput::RATE, rate);
+    }
+
+    void set_waveform(Waveform waveform) {_waveform = waveform;}
+
+    /* Set the phase as a fraction of a cycle in [0, 1) */
+    void set_phase(float phase)
+    {
+        _phase = static_cast<uint32_t>(static_cast<uint64_t>(phase * 4294967296.0) & 0xffffffffu);
+    }
+
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate_inv = 1.0f / samplerate;
+    }
+
+    void reset() override
+    {
+        _phase = 0;
+        _cycle = 0;
+        _output_buffer(AudioOutput::LFO_OUT).fill(0.0f);
+    }
+
+    void render() override;
+
+private:
+    float          _samplerate_inv{1.0 / DEFAULT_SAMPLERATE};
+    uint32_t       _phase{0};
+    uint32_t       _cycle{0};
+    uint32_t       _key{RandomDevice().get()};
+    Waveform       _waveform{Waveform::SINE};
+};
+
+/* A bank of control rate LFOs, i.e. one per voice or per modulation target,
+ * rendered together so that all LFOs are computed in parallel simd lanes.
+ * Every waveform is computed for every LFO and the selected one is picked by
+ * weights, so there are no branches per LFO.
+ * Phase is a 32 bit fixed point fraction of a cycle that wraps exactly, so it
+ * doesn't lose precision or drift however long the LFOs run. Control input n
+ * sets the rate of LFO n, with the same mapping as LfoBrick, unless it's synced
+ * to the tempo. All waveforms are in the range [-1, 1] */
+template <int lfos>
+class LfoBankBrick : public DspBrickImpl<lfos, lfos, 0, 0>
+{
+    using this_template = DspBrickImpl<lfos, lfos, 0, 0>;
+
+public:
+    enum class Waveform
+    {
+        SINE,
+        TRIANGLE,
+        SAW,
+        PULSE,
+        SAMPLE_HOLD,
+    };
+
+    static constexpr int WAVEFORMS = 5;
+    static constexpr float LOWEST_LFO_SPEED = 0.05f;
+    static constexpr float DEFAULT_TEMPO = 120.0f;
+
+    LfoBankBrick()
+    {
+        for (int i = 0; i < lfos; ++i)
+        {
+            _keys[i] = _rand_device.get();
+            set_waveform(i, Waveform::SINE);
+        }
+    }
+
+    template <class ...T>
+    explicit LfoBankBrick(T... rates) : LfoBankBrick()
+    {
+        static_assert(sizeof...(rates) == lfos);
+        std::array<const float*, lfos> rate_ins = {{rates...}};
+        for (int i = 0; i < lfos; ++i)
+        {
+            this_template::set_control_input(i, rate_ins[i]);
+        }
+    }
+
+    void set_waveform(int lfo, Waveform waveform)
+    {
+        assert(lfo < lfos);
+        for (int w = 0; w < WAVEFORMS; ++w)
+        {
+            _weights[w][lfo] = w == static_cast<int>(waveform) ? 1.0f : 0.0f;
+        }
+    }
+
+    /* Sync an LFO to the tempo with a period of beats, i.e. 0.25 for 16th notes.
+     * 0 makes it free running at the rate set by its control input again */
+    void set_sync(int lfo, float beats)
+    {
+        assert(lfo < lfos);
+        _sync_beats[lfo] = std::max(beats, 0.0f);
+        _update_sync_freqs();
+    }
+
+    void set_tempo(float bpm)
+    {
+        _tempo = bpm;
+        _update_sync_freqs();
+    }
+
+    /* Align all synced LFOs to a position in beats from the start of the song,
+     * i.e. when the transport starts or loops or to correct for the accumulated
+     * rounding of the phase increment */
+    void set_beat_position(double beats)
+    {
+        for (int i = 0; i < lfos; ++i)
+        {
+            if (_sync_beats[i] > 0.0f)
+            {
+                double cycles = beats / _sync_beats[i];
+                _set_phase(i, cycles - std::floor(cycles));
+            }
+        }
+    }
+
+    /* Set the phase of an LFO as a fraction of a cycle in [0, 1) */
+    void set_phase(int lfo, float phase)
+    {
+        assert(lfo < lfos);
+        _set_phase(lfo, phase);
+    }
+
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate = samplerate;
+    }
+
+    void reset() override
+    {
+        _phases.fill(0);
+        _cycles.fill(0);
+        for (int i = 0; i < lfos; ++i)
+        {
+            this_template::_set_ctrl_value(i, 0.0f);
+        }
+    }
+
+    void render() override
+    {
+        float block_time = PROC_BLOCK_SIZE / _samplerate;
+        std::array<float, lfos> out;
+        for (int i = 0; i < lfos; ++i)
+        {
+            float free_freq = LOWEST_LFO_SPEED * exp2_approx(this_template::_ctrl_value(i) * 10.0f);
+            float freq = _sync_freqs[i] > 0.0f ? _sync_freqs[i] : free_freq;
+
+            /* Limited to half a cycle per block */
+            uint32_t phase = _phases[i] + lfo_phase_increment(std::min(freq * block_time, 0.5f));
+            _cycles[i] += phase < _phases[i] ? 1u : 0u;
+            _phases[i] = phase;
+
+            float p = lfo_phase_to_float(phase);
+            float sine = sin_2pi_approx(p);
+            float triangle = lfo_triangle(p);
+            float saw = lfo_saw(p);
+            float pulse = lfo_pulse(p);
+            float sample_hold = random_to_norm(random_hash(_cycles[i], _keys[i]));
+
+            out[i] = _weights[0][i] * sine + _weights[1][i] * triangle + _weights[2][i] * saw +
+                     _weights[3][i] * pulse + _weights[4][i] * sample_hold;
+        }
+        for (int i = 0; i < lfos; ++i)
+        {
+            this_template::_set_ctrl_value(i, out[i]);
+        }
+    }
+
+private:
+    void _set_phase(int lfo, double phase)
+    {
+        _phases[lfo] = static_cast<uint32_t>(static_cast<uint64_t>(phase * 4294967296.0) & 0xffffffffu);
+    }
+
+    void _update_sync_freqs()
+    {
+        for (int i = 0; i < lfos; ++i)
+        {
+            _sync_freqs[i] = _sync_beats[i] > 0.0f ? _tempo / (60.0f * _sync_beats[i]) : 0.0f;
+        }
+    }
+
+    std::array<uint32_t, lfos>                     _phases{};
+    std::array<uint32_t, lfos>                     _cycles{};
+    std::array<uint32_t, lfos>                     _keys{};
+    std::array<std::array<float, lfos>, WAVEFORMS> _weights{};
+    std::array<float, lfos>                        _sync_beats{};
+    std::array<float, lfos>                        _sync_freqs{};
+    float                                          _tempo{DEFAULT_TEMPO};
+    float                                          _samplerate{DEFAULT_SAMPLERATE};
+    RandomDevice                                   _rand_device;
+};
 }// namespace bricks
 
 #endif //BRICKS_DSP_ENVELOPE_BRICKS_H
@@ -0,0 +1,48 @@
+#ifndef BRICKS_DSP_FFT_H
+#define BRICKS_DSP_FFT_H
+
+#include <vector>
+
+namespace bricks {
+
+/* Radix-2 fft for real valued signals, implemented as a complex fft of half
+ * the size with a post processing step. Spectrums are stored in split format,
+ * i.e. real and imaginary parts in separate arrays, as that is easier for the
+ * compiler to vectorise than interleaved complex numbers.
+ * A real fft of size N has N/2 + 1 unique bins, from DC to nyquist.
+ * Setup allocates memory, forward() and inverse() do not. Not thread safe
+ * as the same scratch buffers are used in each call. */
+class RealFft
+{
+public:
+    /* Size must be a power of 2 and at least 4 */
+    explicit RealFft(int size);
+
+    int size() const {return _size;}
+
+    int bins() const {return _size / 2 + 1;}
+
+    /* Transform size samples from in to bins() complex values in re and im */
+    void forward(const float* in, float* re, float* im);
+
+    /* Transform bins() complex values back to size samples, includes 1/N scaling
+     * so that inverse(forward(x)) == x */
+    void inverse(const float* re, const float* im, float* out);
+
+private:
+    void _complex_fft(float* re, float* im, bool inverse);
+
+    int                 _size;
+    int                 _half_size;
+    std::vector<int>    _bit_reverse;
+    std::vector<float>  _twiddle_re;
+    std::vector<float>  _twiddle_im;
+    std::vector<float>  _split_re;
+    std::vector<float>  _split_im;
+    std::vector<float>  _scratch_re;
+    std::vector<float>  _scratch_im;
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_FFT_H
@@ -1,7 +1,14 @@
 #ifndef BRICKS_DSP_FILTER_BRICKS_H
 #define BRICKS_DSP_FILTER_BRICKS_H
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <vector>
+
 #include "dsp_brick.h"
+#include "fft.h"
+
 namespace bricks {
 
 #ifdef BRICKS_DSP_CONSTEXPR_MATH
@@ -10,6 +17,43 @@ constexpr float DEFAULT_Q = 1 / sqrtf(2.0f);
 constexpr float DEFAULT_Q = 1 / 1.42f;
 #endif
 
+/* Precision policy for the filter bricks. CalcType is used for calculating
+ * coefficients and ProcessType for the coefficients and filter states when
+ * processing, audio in and out is always float. Filter bricks take either
+ * float or double, which use the same type for both, or MixedPrecision.
+ *
+ * Float has twice the simd lanes of double and is enough in most cases.
+ * At low cutoffs, coefficients calculated in float lose precision as cos(w0)
+ * gets close to 1, which MixedPrecision avoids. Below ~20 Hz, or with very
+ * high q, rounding the coefficients to float is itself too inaccurate and
+ * double should be used */
+struct MixedPrecision
+{
+    using CalcType = double;
+    using ProcessType = float;
+};
+
+template <typename Precision>
+struct PrecisionTraits
+{
+    using CalcType = typename Precision::CalcType;
+    using ProcessType = typename Precision::ProcessType;
+};
+
+template <>
+struct PrecisionTraits<float>
+{
+    using CalcType = float;
+    using ProcessType = float;
+};
+
+template <>
+struct PrecisionTraits<double>
+{
+    using CalcType = double;
+    using ProcessType = double;
+};
+
 template<typename FloatType>
 struct BiquadCoefficients
 {
@@ -27,16 +71,26 @@ struct BiquadRegisters
     FloatType z2;
 };
 
-/* Direct form 2 transposed biquad calculation */
+/* Direct form 2 transposed biquad calculation, calculated in FloatType
+ * and returned as SampleType */
+template <typename FloatType, typename SampleType = float>
+inline SampleType render_biquad_sample(SampleType in,
+                                       const BiquadCoefficients<FloatType>& coeff,
+                                       BiquadRegisters<FloatType>& reg)
+{
+    FloatType x = in;
+    FloatType out = x * coeff.b0 + reg.z1;
+    reg.z1 = x * coeff.b1 + reg.z2 - coeff.a1 * out;
+    reg.z2 = x * coeff.b2 - coeff.a2 * out;
+    return static_cast<SampleType>(out);
+}
+
+/* Flush the registers when building with BRICKS_DSP_DENORMAL_SAFE, call once per block */
 template <typename FloatType>
-inline float render_biquad_sample(float in,
-                                  const BiquadCoefficients<FloatType>& coeff,
-                                  BiquadRegisters<FloatType>& reg)
+inline void flush_denormals(BiquadRegisters<FloatType>& reg)
 {
-    FloatType out = in * coeff.b0 + reg.z1;
-    reg.z1 = in * coeff.b1 + reg.z2 - coeff.a1 * out;
-    reg.z2 = in * coeff.b2 - coeff.a2 * out;
-    return out;
+    reg.z1 = flush_denormal(reg.z1);
+    reg.z2 = flush_denormal(reg.z2);
 }
 
 template <typename FloatType, int BlockSize>
@@ -50,37 +104,212 @@ void render_df2_biquad(const AlignedArray<float, BlockSize>& in,
     {
         out[i] = render_biquad_sample(in[i], coeff, reg);
     }
+    flush_denormals(reg);
     registers = reg;
 }
 
 using Coefficients = BiquadCoefficients<float>;
 using Registers = BiquadRegisters<float>;
 
-/* Standard Biquad with non-modulated filter parameters */
-class FixedFilterBrick : public DspBrickImpl<0, 0, 1, 1>
+/* Coefficient generation from http://www.musicdsp.org/files/Audio-EQ-Cookbook.txt
+ * Calculated in CalcType and returned as FloatType */
+template <typename FloatType = float, typename CalcType = FloatType>
+BiquadCoefficients<FloatType> calc_lowpass(float freq, float q, float samplerate)
+{
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType alpha = w0_sin / q;
+    CalcType norm = 1 / (1 + alpha);
+    CalcType b0 = (1 - w0_cos) / 2 * norm;
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(-2 * w0_cos * norm);
+    coeff.a2 = static_cast<FloatType>((1 - alpha) * norm);
+    coeff.b0 = static_cast<FloatType>(b0);
+    coeff.b1 = static_cast<FloatType>((1 - w0_cos) * norm);
+    coeff.b2 = static_cast<FloatType>(b0);
+    return coeff;
+};
+
+template <typename FloatType = float, typename CalcType = FloatType>
+BiquadCoefficients<FloatType> calc_highpass(float freq, float q, float samplerate)
+{
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType alpha = w0_sin / q;
+    CalcType norm = 1 / (1 + alpha);
+    CalcType b0 = (1 + w0_cos) / 2 * norm;
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(-2 * w0_cos * norm);
+    coeff.a2 = static_cast<FloatType>((1 - alpha) * norm);
+    coeff.b0 = static_cast<FloatType>(b0);
+    coeff.b1 = static_cast<FloatType>(-(1 + w0_cos) * norm);
+    coeff.b2 = static_cast<FloatType>(b0);
+    return coeff;
+};
+
+template <typename FloatType = float, typename CalcType = FloatType>
+inline BiquadCoefficients<FloatType> calc_bandpass(float freq, float q, float samplerate)
+{
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType alpha = w0_sin / q;
+    CalcType norm = 1 / (1 + alpha);
+    CalcType b0 = alpha * norm;
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(-2 * w0_cos * norm);
+    coeff.a2 = static_cast<FloatType>((1 - alpha) * norm);
+    coeff.b0 = static_cast<FloatType>(b0);
+    coeff.b1 = 0;
+    coeff.b2 = static_cast<FloatType>(-b0);
+    return coeff;
+};
+
+template <typename FloatType = float, typename CalcType = FloatType>
+inline BiquadCoefficients<FloatType> calc_allpass(float freq, float q, float samplerate)
+{
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType alpha = w0_sin / q;
+    CalcType norm = 1 / (1 + alpha);
+    CalcType a1 = -2 * w0_cos * norm;
+    CalcType b0 = (1 - alpha) * norm;
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(a1);
+    coeff.a2 = static_cast<FloatType>(b0);
+    coeff.b0 = static_cast<FloatType>(b0);
+    coeff.b1 = static_cast<FloatType>(a1);
+    coeff.b2 = 1;
+    return coeff;
+};
+
+/* freq in Hz, gain in dB */
+template <typename FloatType = float, typename CalcType = FloatType>
+inline BiquadCoefficients<FloatType> calc_peaking(float freq, float gain, float q,  float samplerate)
+{
+    CalcType A = std::pow(static_cast<CalcType>(10), gain / static_cast<CalcType>(40));
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType alpha = w0_sin / q;
+    CalcType norm = 1 / (1 + alpha / A);
+    CalcType b0 = (1 + alpha * A) * norm;
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(-2 * w0_cos * norm);
+    coeff.a2 = static_cast<FloatType>((1 - alpha / A) * norm);
+    coeff.b0 = static_cast<FloatType>(b0);
+    coeff.b1 = static_cast<FloatType>(-2 * w0_cos * norm);
+    coeff.b2 = static_cast<FloatType>((1 - alpha * A) * norm);
+    return coeff;
+};
+
+template <typename FloatType = float, typename CalcType = FloatType>
+inline BiquadCoefficients<FloatType> calc_lowshelf(float freq, float gain, float slope, float samplerate)
+{
+    CalcType A = std::pow(static_cast<CalcType>(10), gain / static_cast<CalcType>(40));
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType A2_sqrt_alpha = 2 * w0_sin * std::sqrt((A * A + 1) * (1 / static_cast<CalcType>(slope) - 1) + 2 * A);
+    CalcType A_inc_cos_w0 = (A + 1) * w0_cos;
+    CalcType A_dec_cos_w0 = (A - 1) * w0_cos;
+    CalcType norm = 1 / ((A + 1) + A_dec_cos_w0 + A2_sqrt_alpha);
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(-2 * (A - 1 + A_inc_cos_w0) * norm);
+    coeff.a2 = static_cast<FloatType>((A + 1 + A_dec_cos_w0 - A2_sqrt_alpha) * norm);
+    coeff.b0 = static_cast<FloatType>(A * (A + 1 - A_dec_cos_w0 + A2_sqrt_alpha) * norm);
+    coeff.b1 = static_cast<FloatType>(2 * A * (A - 1 - A_inc_cos_w0) * norm);
+    coeff.b2 = static_cast<FloatType>(A * (A + 1 - A_dec_cos_w0 - A2_sqrt_alpha) * norm);
+    return coeff;
+};
+
+template <typename FloatType = float, typename CalcType = FloatType>
+inline BiquadCoefficients<FloatType> calc_highshelf(float freq, float gain, float slope, float samplerate)
+{
+    CalcType A = std::pow(static_cast<CalcType>(10), gain / static_cast<CalcType>(40));
+    CalcType w0 = 2 * static_cast<CalcType>(M_PI) * freq / samplerate;
+    CalcType w0_cos = std::cos(w0);
+    CalcType w0_sin = std::sin(w0);
+    CalcType A2_sqrt_alpha = 2 * w0_sin * std::sqrt((A * A + 1) * (1 / static_cast<CalcType>(slope) - 1) + 2 * A);
+    CalcType A_inc_cos_w0 = (A + 1) * w0_cos;
+    CalcType A_dec_cos_w0 = (A - 1) * w0_cos;
+    CalcType norm = 1 / ((A + 1) - A_dec_cos_w0 + A2_sqrt_alpha);
+
+    BiquadCoefficients<FloatType> coeff;
+    coeff.a1 = static_cast<FloatType>(2 * (A - 1 - A_inc_cos_w0) * norm);
+    coeff.a2 = static_cast<FloatType>((A + 1 - A_dec_cos_w0 - A2_sqrt_alpha) * norm);
+    coeff.b0 = static_cast<FloatType>(A * (A + 1 + A_dec_cos_w0 + A2_sqrt_alpha) * norm);
+    coeff.b1 = static_cast<FloatType>(-2 * A * (A - 1 + A_inc_cos_w0) * norm);
+    coeff.b2 = static_cast<FloatType>(A * (A + 1 + A_dec_cos_w0 - A2_sqrt_alpha) * norm);
+    return coeff;
+};
+
+/* Standard Biquad with non-modulated filter parameters. The set_ functions
+ * calculate the coefficients with the precision policy's CalcType */
+template <typename Precision = float>
+class BasicFixedFilterBrick : public DspBrickImpl<0, 0, 1, 1>
 {
 public:
+    using CalcType = typename PrecisionTraits<Precision>::CalcType;
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     enum AudioOutput
     {
         FILTER_OUT = 0
     };
 
-    FixedFilterBrick() = default;
+    BasicFixedFilterBrick() = default;
 
-    FixedFilterBrick(const AudioBuffer* audio_in)
+    BasicFixedFilterBrick(const AudioBuffer* audio_in)
     {
         set_audio_input(0, audio_in);
     }
 
-    void set_lowpass(float freq, float q = DEFAULT_Q, bool clear = true);
-    void set_highpass(float freq, float q = DEFAULT_Q, bool clear = true);
-    void set_bandpass(float freq, float q = DEFAULT_Q, bool clear = true);
-    void set_peaking(float freq, float gain, float q = DEFAULT_Q, bool clear = true);
-    void set_allpass(float freq, float q = DEFAULT_Q, bool clear = true);
-    void set_lowshelf(float freq, float gain, float slope = DEFAULT_Q, bool clear = true);
-    void set_highshelf(float freq, float gain, float slope = DEFAULT_Q, bool clear = true);
+    void set_lowpass(float freq, float q = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_lowpass<ProcessType, CalcType>(freq, q, _samplerate), clear);
+    }
+
+    void set_highpass(float freq, float q = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_highpass<ProcessType, CalcType>(freq, q, _samplerate), clear);
+    }
+
+    void set_bandpass(float freq, float q = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_bandpass<ProcessType, CalcType>(freq, q, _samplerate), clear);
+    }
+
+    void set_peaking(float freq, float gain, float q = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_peaking<ProcessType, CalcType>(freq, gain, q, _samplerate), clear);
+    }
 
-    void set_coeffs(const Coefficients& coeffs)
+    void set_allpass(float freq, float q = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_allpass<ProcessType, CalcType>(freq, q, _samplerate), clear);
+    }
+
+    void set_lowshelf(float freq, float gain, float slope = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_lowshelf<ProcessType, CalcType>(freq, gain, slope, _samplerate), clear);
+    }
+
+    void set_highshelf(float freq, float gain, float slope = DEFAULT_Q, bool clear = true)
+    {
+        _set_coeffs(calc_highshelf<ProcessType, CalcType>(freq, gain, slope, _samplerate), clear);
+    }
+
+    void set_coeffs(const BiquadCoefficients<ProcessType>& coeffs)
     {
         _coeff = coeffs;
     }
@@ -90,7 +319,10 @@ public:
         _samplerate = samplerate;
     }
 
-    void render() override;
+    void render() override
+    {
+        render_df2_biquad(_input_buffer(0), _output_buffer(AudioOutput::FILTER_OUT), _coeff, _reg);
+    }
 
     void reset() override
     {
@@ -98,16 +330,29 @@ public:
     }
 
 private:
-    float           _samplerate{DEFAULT_SAMPLERATE};
-    Coefficients    _coeff{0,0,0,0,0};
-    Registers       _reg{0,0};
+    void _set_coeffs(const BiquadCoefficients<ProcessType>& coeffs, bool clear)
+    {
+        _coeff = coeffs;
+        if (clear)
+        {
+            reset();
+        }
+    }
+
+    float                               _samplerate{DEFAULT_SAMPLERATE};
+    BiquadCoefficients<ProcessType>     _coeff{0,0,0,0,0};
+    BiquadRegisters<ProcessType>        _reg{0,0};
 };
 
+using FixedFilterBrick = BasicFixedFilterBrick<float>;
+
 /* Fixed Biquad with non-modulated filter parameters and templated number of stages */
-template<int stages, typename FloatType = float>
+template<int stages, typename Precision = float>
 class MultiStageFilterBrick : public DspBrickImpl<0, 0, 1, 1>
 {
 public:
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     enum AudioOutput
     {
         FILTER_OUT = 0
@@ -120,7 +365,7 @@ public:
         set_audio_input(0, audio_in);
     }
 
-    void set_coeffs(const std::array<BiquadCoefficients<FloatType>, stages>& coeffs)
+    void set_coeffs(const std::array<BiquadCoefficients<ProcessType>, stages>& coeffs)
     {
         _coeff = coeffs;
     }
@@ -136,12 +381,12 @@ public:
             /* With an even number of stages, first render to the buffer, then ping pong
              * between audio_out and buffer to avoid an extra copy in the end */
             AudioBuffer buffer;
-            render_df2_biquad<FloatType, PROC_BLOCK_SIZE>(audio_in, buffer, _coeff[0], regs[0]);
+            render_df2_biquad<ProcessType, PROC_BLOCK_SIZE>(audio_in, buffer, _coeff[0], regs[0]);
             for (int i = 1; i < stages; ++i)
             {
                 const AudioBuffer& in = i % 2 ? buffer : audio_out;
                 AudioBuffer& out = i % 2 ? audio_out : buffer;
-                render_df2_biquad<FloatType, PROC_BLOCK_SIZE>(in, out, _coeff[i], regs[i]);
+                render_df2_biquad<ProcessType, PROC_BLOCK_SIZE>(in, out, _coeff[i], regs[i]);
             }
         }
         else
@@ -149,12 +394,12 @@ public:
             /* With an odd number of stages, first render to audio_out, then ping-pong
              * between buffer and audio out */
             AudioBuffer buffer;
-            render_df2_biquad<FloatType, PROC_BLOCK_SIZE>(audio_in, audio_out, _coeff[0], regs[0]);
+            render_df2_biquad<ProcessType, PROC_BLOCK_SIZE>(audio_in, audio_out, _coeff[0], regs[0]);
             for (int i = 1; i < stages; ++i)
             {
                 const AudioBuffer& in = i % 2 ? audio_out: buffer;
                 AudioBuffer& out = i % 2 ? buffer : audio_out;
-                render_df2_biquad<FloatType, PROC_BLOCK_SIZE>(in, out, _coeff[i], regs[i]);
+                render_df2_biquad<ProcessType, PROC_BLOCK_SIZE>(in, out, _coeff[i], regs[i]);
             }
         }
         _reg = regs;
@@ -166,17 +411,19 @@ public:
     }
 
 private:
-    std::array<BiquadCoefficients<FloatType>, stages>   _coeff;
-    std::array<BiquadRegisters<FloatType>, stages>      _reg;
+    std::array<BiquadCoefficients<ProcessType>, stages>   _coeff;
+    std::array<BiquadRegisters<ProcessType>, stages>      _reg{};
 };
 
 /* Fixed filter with non-modulated filter parameters and stages calculated
  * in parallel, adds 1 sample delay per stage but allows for much more
  * cpu-efficient processing */
-template<int stages, typename FloatType = float>
+template<int stages, typename Precision = float>
 class PipelinedFilterBrick : public DspBrickImpl<0, 0, 1, 1>
 {
 public:
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     enum AudioOutput
     {
         FILTER_OUT = 0
@@ -189,7 +436,7 @@ public:
         set_audio_input(0, audio_in);
     }
 
-    void set_coeffs(const std::array<BiquadCoefficients<FloatType>, stages>& coeffs)
+    void set_coeffs(const std::array<BiquadCoefficients<ProcessType>, stages>& coeffs)
     {
         _coeff = coeffs;
     }
@@ -206,7 +453,7 @@ public:
             pipeline[0] = audio_in[i];
             for (int s = 0; s < stages; ++s)
             {
-                pipeline[s] = render_biquad_sample<FloatType>(pipeline[s], _coeff[s], regs[s]);
+                pipeline[s] = render_biquad_sample<ProcessType>(pipeline[s], _coeff[s], regs[s]);
             }
             audio_out[i] = pipeline[stages - 1];
             // advance buffer 1 sample
@@ -215,6 +462,11 @@ public:
                 pipeline[s] = pipeline[s - 1];
             }
         }
+        for (int s = 0; s < stages; ++s)
+        {
+            flush_denormals(regs[s]);
+            pipeline[s] = flush_denormal(pipeline[s]);
+        }
         _pipeline = pipeline;
         _reg = regs;
     }
@@ -227,20 +479,25 @@ public:
 
 private:
     static_assert(stages >= 2, "Needs at least 2 stages to be useful");
-    std::array<BiquadCoefficients<FloatType>, stages>   _coeff;
-    std::array<BiquadRegisters<FloatType>, stages>      _reg;
-    std::array<FloatType, stages>                       _pipeline;
+    std::array<BiquadCoefficients<ProcessType>, stages>   _coeff;
+    std::array<BiquadRegisters<ProcessType>, stages>      _reg{};
+    std::array<ProcessType, stages>                       _pipeline;
 };
 
 
 /* Fixed filter with templated number of parallel paths.
- * More efficient for multiple voices/channels */
-template<int channel_count, typename FloatType = float>
+ * More efficient for multiple voices/channels. The registers are stored as
+ * one array per register with an element per channel, and the channels are
+ * rendered in groups of one simd register, i.e. 8 float or 4 double channels
+ * with 256 bit vectors */
+template<int channel_count, typename Precision = float>
 class ParallelFilterBrick : public DspBrickImpl<0, 0, channel_count, channel_count>
 {
     using this_template = DspBrickImpl<0, 0, channel_count, channel_count>;
 
 public:
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     ParallelFilterBrick() = default;
 
     template <class ...T>
@@ -254,50 +511,83 @@ public:
         }
     }
 
-    void set_coeffs(const BiquadCoefficients<FloatType>& coeffs)
+    void set_coeffs(const BiquadCoefficients<ProcessType>& coeffs)
     {
         _coeff = coeffs;
     }
 
     void render() override
     {
-        std::array<const AudioBuffer*, channel_count>  inputs;
-        std::array<AudioBuffer*, channel_count>        outputs;
-
-        for (int i = 0; i < channel_count; ++i)
+        int c = 0;
+        for (; c + LANES <= channel_count; c += LANES)
         {
-            inputs[i] = &this_template::_input_buffer(i);
-            outputs[i] = &this_template::_output_buffer(i);
+            _render_channels<LANES>(c);
         }
-
-        auto regs = _reg;
-
-        for (int s = 0; s < PROC_BLOCK_SIZE; ++s)
+        if constexpr (channel_count % LANES != 0)
         {
-            for (int c = 0; c < channel_count; ++c)
-            {
-                outputs[c]->data()[s] = render_biquad_sample<FloatType>(inputs[c]->data()[s], _coeff, regs[c]);
-            }
+            _render_channels<channel_count % LANES>(c);
         }
-        _reg = regs;
     }
 
     void reset() override
     {
-        _reg.fill({0, 0});
+        _z1.fill(0);
+        _z2.fill(0);
     }
 
 private:
-    BiquadCoefficients<FloatType>   _coeff;
-    std::array<BiquadRegisters<FloatType>, channel_count>    _reg;
+    static constexpr int LANES = 32 / sizeof(ProcessType);
+
+    /* Render channels [first, first + count) with the states in registers */
+    template <int count>
+    void _render_channels(int first)
+    {
+        std::array<const float*, count>  inputs;
+        std::array<float*, count>        outputs;
+        std::array<ProcessType, count>   z1;
+        std::array<ProcessType, count>   z2;
+        for (int c = 0; c < count; ++c)
+        {
+            inputs[c] = this_template::_input_buffer(first + c).data();
+            outputs[c] = this_template::_output_buffer(first + c).data();
+            z1[c] = _z1[first + c];
+            z2[c] = _z2[first + c];
+        }
+
+        auto coeff = _coeff;
+        for (int s = 0; s < PROC_BLOCK_SIZE; ++s)
+        {
+            for (int c = 0; c < count; ++c)
+            {
+                ProcessType in = inputs[c][s];
+                ProcessType out = in * coeff.b0 + z1[c];
+                z1[c] = in * coeff.b1 + z2[c] - coeff.a1 * out;
+                z2[c] = in * coeff.b2 - coeff.a2 * out;
+                outputs[c][s] = static_cast<float>(out);
+            }
+        }
+        for (int c = 0; c < count; ++c)
+        {
+            _z1[first + c] = flush_denormal(z1[c]);
+            _z2[first + c] = flush_denormal(z2[c]);
+        }
+    }
+
+    BiquadCoefficients<ProcessType>         _coeff{0,0,0,0,0};
+    std::array<ProcessType, channel_count>  _z1{};
+    std::array<ProcessType, channel_count>  _z2{};
 };
 
 
 /* State variable filter with multiple outs from Andrew Simper, Cytomic,
  * adapted from https://cytomic.com/files/dsp/SvfLinearTrapOptimised2.pdf */
-class SVFFilterBrick : public DspBrickImpl<2, 0, 1, 3>
+template <typename Precision = float>
+class BasicSVFFilterBrick : public DspBrickImpl<2, 0, 1, 3>
 {
 public:
+    using CalcType = typename PrecisionTraits<Precision>::CalcType;
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     enum ControlInput
     {
         CUTOFF = 0,
@@ -311,9 +601,9 @@ public:
         HIGHPASS
     };
 
-    SVFFilterBrick() = default;
+    BasicSVFFilterBrick() = default;
 
-    SVFFilterBrick(const float* cutoff, const float* resonance, const AudioBuffer* audio_in)
+    BasicSVFFilterBrick(const float* cutoff, const float* resonance, const AudioBuffer* audio_in)
     {
         set_control_input(ControlInput::CUTOFF, cutoff);
         set_control_input(ControlInput::RESONANCE, resonance);
@@ -322,7 +612,7 @@ public:
 
     void set_samplerate(float samplerate) override
     {
-        _samplerate_inv = 1.0f / samplerate;
+        _samplerate_inv = 1 / static_cast<CalcType>(samplerate);
     }
 
     void reset() override
@@ -331,20 +621,83 @@ public:
         _reg = {0, 0};
     }
 
-    void render() override;
+    void render() override
+    {
+        const auto& audio_in = _input_buffer(0);
+        auto& lowpass_out = _output_buffer(AudioOutput::LOWPASS);
+        auto& bandpass_out = _output_buffer(AudioOutput::BANDPASS);
+        auto& highpass_out = _output_buffer(AudioOutput::HIGHPASS);
+
+        CalcType freq = 20 * std::pow(static_cast<CalcType>(2), _ctrl_value(ControlInput::CUTOFF) * static_cast<CalcType>(10));
+        freq = std::clamp<CalcType>(freq, 5, 19000);
+        CalcType k = 2 - 2 * static_cast<CalcType>(_ctrl_value(ControlInput::RESONANCE));
+        _g_lag.set(std::tan(static_cast<CalcType>(M_PI) * freq * _samplerate_inv));
+
+        /* The coefficients don't depend on the filter state, so they are computed
+         * for the whole block first, leaving only the state update in the serial loop */
+        AlignedArray<CalcType, PROC_BLOCK_SIZE> g;
+        AlignedArray<ProcessType, PROC_BLOCK_SIZE> a1;
+        AlignedArray<ProcessType, PROC_BLOCK_SIZE> a2;
+        AlignedArray<ProcessType, PROC_BLOCK_SIZE> a3;
+        _g_lag.get_all(g);
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            CalcType c1 = 1 / (1 + g[i] * (g[i] + k));
+            CalcType c2 = g[i] * c1;
+            a1[i] = static_cast<ProcessType>(c1);
+            a2[i] = static_cast<ProcessType>(c2);
+            a3[i] = static_cast<ProcessType>(g[i] * c2);
+        }
+
+        auto reg = _reg;
+        auto k_p = static_cast<ProcessType>(k);
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            ProcessType in = audio_in[i];
+            ProcessType v3 = in - reg[1];
+            ProcessType v1 = a1[i] * reg[0] + a2[i] * v3;
+            ProcessType v2 = reg[1] + a2[i] * reg[0] + a3[i] * v3;
+            reg[0] = 2 * v1 - reg[0];
+            reg[1] = 2 * v2 - reg[1];
+
+            lowpass_out[i] = static_cast<float>(v2);
+            bandpass_out[i] = static_cast<float>(v1);
+            highpass_out[i] = static_cast<float>(in - k_p * v1 - v2);
+        }
+        reg[0] = flush_denormal(reg[0]);
+        reg[1] = flush_denormal(reg[1]);
+        _reg = reg;
+    }
 
 private:
-    float                 _samplerate_inv {1.0f / DEFAULT_SAMPLERATE};
-    std::array<float, 2>  _reg{0,0};
-    ControlSmootherLinear _g_lag;
+    CalcType                                        _samplerate_inv {1 / static_cast<CalcType>(DEFAULT_SAMPLERATE)};
+    std::array<ProcessType, 2>                      _reg{0,0};
+    LinearInterpolator<PROC_BLOCK_SIZE, CalcType>   _g_lag;
 };
 
+using SVFFilterBrick = BasicSVFFilterBrick<float>;
+
+/* tanh(x)/x approximation, flatline at very high inputs
+ * so might not be safe for very large feedback gains
+ * [limit is 1/15 so very large means ~15 or +23dB] */
+template <typename T>
+inline T tanhXdX(T x)
+{
+    T a = x*x;
+    // IIRC I got this as Pade-approx for tanh(sqrt(x))/sqrt(x)
+    return ((a + 105)*a + 945) / ((15*a + 420)*a + 945);
+}
+
 /* Topology-preserving (zero delay) ladder with non-linearities
  * Adapted from https://www.kvraudio.com/forum/viewtopic.php?t=349859
  * and Copyright 2012 Teemu Voipio (mystran @ kvr)  */
-class MystransLadderFilter : public DspBrickImpl<2, 0, 1, 1>
+template <typename Precision = double>
+class BasicMystransLadderFilter : public DspBrickImpl<2, 0, 1, 1>
 {
    public:
+    using CalcType = typename PrecisionTraits<Precision>::CalcType;
+    using ProcessType = typename PrecisionTraits<Precision>::ProcessType;
+
     enum ControlInput
     {
         CUTOFF = 0,
@@ -356,174 +709,240 @@ class MystransLadderFilter : public DspBrickImpl<2, 0, 1, 1>
         FILTER_OUT = 0,
     };
 
-    MystransLadderFilter(const float* cutoff, const float* resonance, const AudioBuffer* audio_in)
+    BasicMystransLadderFilter(const float* cutoff, const float* resonance, const AudioBuffer* audio_in)
     {
         set_control_input(ControlInput::CUTOFF, cutoff);
         set_control_input(ControlInput::RESONANCE, resonance);
         set_audio_input(0, audio_in);
     }
 
-    void render() override;
+    void render() override
+    {
+        const auto& in = _input_buffer(0);
+        auto& audio_out = _output_buffer(0);
+        CalcType freq = 20 * std::pow(static_cast<CalcType>(2), _ctrl_value(ControlInput::CUTOFF) * static_cast<CalcType>(10));
+        freq = std::clamp<CalcType>(freq, 20, 22000);
+        _freq_lag.set(std::tan(static_cast<CalcType>(M_PI) * freq * _samplerate_inv));
+        ProcessType r = static_cast<ProcessType>(40.0 / 9.0) * _ctrl_value(ControlInput::RESONANCE);
+
+        AlignedArray<CalcType, PROC_BLOCK_SIZE> freqs;
+        _freq_lag.get_all(freqs);
+        auto s = _states;
+        auto zi = _zi;
+
+        for(int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            auto f = static_cast<ProcessType>(freqs[i]);
+            ProcessType x = in[i];
+            // input with half delay, for non-linearities
+            ProcessType ih = static_cast<ProcessType>(0.5) * (x + zi);
+            zi = x;
+
+            // evaluate the non-linear gains
+            ProcessType t0 = tanhXdX(ih - r * s[3]);
+            ProcessType t1 = tanhXdX(s[0]);
+            ProcessType t2 = tanhXdX(s[1]);
+            ProcessType t3 = tanhXdX(s[2]);
+            ProcessType t4 = tanhXdX(s[3]);
+
+            // g# the denominators for solutions of individual stages
+            ProcessType g0 = 1 / (1 + f * t1), g1 = 1 / (1 + f * t2);
+            ProcessType g2 = 1 / (1 + f * t3), g3 = 1 / (1 + f * t4);
+
+            // f# are just factored out of the feedback solution
+            ProcessType f3 = f * t3 * g3;
+            ProcessType f2 = f * t2 * g2 * f3;
+            ProcessType f1 = f * t1 * g1 * f2;
+            ProcessType f0 = f * t0 * g0 * f1;
+
+            // solve feedback
+            ProcessType y3 = (g3 * s[3] + f3 * g2 * s[2] + f2 * g1 * s[1] + f1 * g0 * s[0] + f0 * x) / (1 + r * f0);
+
+            // then solve the remaining outputs (with the non-linear gains here)
+            ProcessType xx = t0 * (x - r * y3);
+            ProcessType y0 = t1 * g0 * (s[0] + f * xx);
+            ProcessType y1 = t2 * g1 * (s[1] + f * y0);
+            ProcessType y2 = t3 * g2 * (s[2] + f * y1);
+
+            // update state
+            s[0] += 2 * f * (xx - y0);
+            s[1] += 2 * f * (y0 - y1);
+            s[2] += 2 * f * (y1 - y2);
+            s[3] += 2 * f * (y2 - t4 * y3);
+
+            audio_out[i] = static_cast<float>(y3);
+        }
+        for (auto& state : s)
+        {
+            state = flush_denormal(state);
+        }
+        _zi = zi;
+        _states = s;
+    }
 
     void set_samplerate(float samplerate) override
     {
-        _samplerate_inv = 1.0f / samplerate;
+        _samplerate_inv = 1 / static_cast<CalcType>(samplerate);
     }
 
     void reset() override
     {
         _freq_lag.reset();
         _states.fill(0);
+        _zi = 0;
     }
 
 private:
-    ControlSmootherLinear  _freq_lag;
-    double                 _zi;
-    float                  _samplerate_inv{1.0 / DEFAULT_SAMPLERATE};
-    std::array<double, 4>  _states{0, 0, 0, 0};
+    LinearInterpolator<PROC_BLOCK_SIZE, CalcType>   _freq_lag;
+    ProcessType                                     _zi{0};
+    CalcType                                        _samplerate_inv{1 / static_cast<CalcType>(DEFAULT_SAMPLERATE)};
+    std::array<ProcessType, 4>                      _states{0, 0, 0, 0};
 };
 
-/* Coefficient generation from http://www.musicdsp.org/files/Audio-EQ-Cookbook.txt */
-template <typename  FloatType = float>
-BiquadCoefficients<FloatType> calc_lowpass(float freq, float q, float samplerate)
-{
-    BiquadCoefficients<FloatType> coeff;
-    FloatType w0 = 2.0f * static_cast<FloatType>(M_PI) * freq / samplerate;
-    FloatType w0_cos = std::cos(w0);
-    FloatType w0_sin = std::sin(w0);
-    FloatType alpha = w0_sin / q;
-    FloatType norm = 1.0f / (1.0f + alpha);
-    FloatType b0 = (1.0f - w0_cos) / 2.0f * norm;
-
-    coeff.a1 = -2.0f * w0_cos * norm;
-    coeff.a2 = (1 - alpha) * norm;
-    coeff.b0 = b0;
-    coeff.b1 = (1 - w0_cos) * norm;
-    coeff.b2 = b0;
-    return coeff;
-};
+using MystransLadderFilter = BasicMystransLadderFilter<double>;
 
-template <typename  FloatType = float>
-BiquadCoefficients<FloatType> calc_highpass(float freq, float q, float samplerate)
+/* Impulse response split into partitions and transformed to the frequency
+ * domain for PartitionedConvolver. Immutable once created so it can be
+ * shared between any number of convolvers. */
+class PartitionedIr
 {
-    BiquadCoefficients<FloatType> coeff;
-    FloatType w0 = 2.0f * static_cast<FloatType>(M_PI) * freq / samplerate;
-    FloatType w0_cos = std::cos(w0);
-    FloatType w0_sin = std::sin(w0);
-    FloatType alpha = w0_sin / q;
-    FloatType norm = 1.0f / (1.0f + alpha);
-    FloatType b0 = (1.0f + w0_cos) / 2.0f * norm;
-
-    coeff.a1 = -2.0f * w0_cos * norm;
-    coeff.a2 = (1 - alpha) * norm;
-    coeff.b0 = b0;
-    coeff.b1 = -(1 + w0_cos) * norm;
-    coeff.b2 = b0;
-    return coeff;
-};
+public:
+    PartitionedIr(const float* ir, int length, int partition_size);
 
-template <typename  FloatType = float>
-inline BiquadCoefficients<FloatType> calc_bandpass(float freq, float q, float samplerate)
-{
-    BiquadCoefficients<FloatType> coeff;
-    float w0 = 2.0f * static_cast<float>(M_PI) * freq / samplerate;
-    float w0_cos = std::cos(w0);
-    float w0_sin = std::sin(w0);
-    float alpha = w0_sin / q;
-    float norm = 1.0f / (1.0f + alpha);
-    float b0 = alpha * norm;
-
-    coeff.a1 = -2.0f * w0_cos * norm;
-    coeff.a2 = (1 - alpha) * norm;
-    coeff.b0 = b0;
-    coeff.b1 = 0.0f;
-    coeff.b2 = -b0;
-    return coeff;
-};
+    [[nodiscard]] int partition_size() const {return _partition_size;}
 
-template <typename  FloatType = float>
-inline BiquadCoefficients<FloatType> calc_allpass(float freq, float q, float samplerate)
-{
-    BiquadCoefficients<FloatType> coeff;
-    float w0 = 2.0f * static_cast<float>(M_PI) * freq / samplerate;
-    float w0_cos = std::cos(w0);
-    float w0_sin = std::sin(w0);
-    float alpha = w0_sin / q;
-    float norm = 1.0f / (1.0f + alpha);
-    float a1 =  -2.0f * w0_cos * norm;
-    float b0 = (1.0f - alpha) * norm;
-
-    coeff.a1 = a1;
-    coeff.a2 = b0;
-    coeff.b0 = b0;
-    coeff.b1 = a1;
-    coeff.b2 = 1.0f;
-    return coeff;
+    [[nodiscard]] int partitions() const {return _partitions;}
+
+    [[nodiscard]] int bins() const {return _partition_size + 1;}
+
+    const float* re(int partition) const {return &_re[partition * bins()];}
+
+    const float* im(int partition) const {return &_im[partition * bins()];}
+
+    [[nodiscard]] int memory_size() const {return static_cast<int>((_re.size() + _im.size()) * sizeof(float));}
+
+private:
+    int                 _partition_size;
+    int                 _partitions;
+    std::vector<float>  _re;
+    std::vector<float>  _im;
 };
 
-/* freq in Hz, gain in dB */
-template <typename  FloatType = float>
-inline BiquadCoefficients<FloatType> calc_peaking(float freq, float gain, float q,  float samplerate)
+/* Uniformly partitioned overlap-save convolution using a frequency domain
+ * delay line. Used as a building block in ConvolutionBrick. The work for one
+ * partition is split in 3 steps so that it can be spread out over several
+ * process blocks when the partitions are large. */
+class PartitionedConvolver
 {
-    BiquadCoefficients<FloatType> coeff;
-    float A = powf(10.0f, gain / 40.0f) ;
-    float w0 = 2.0f * static_cast<float>(M_PI) * freq / samplerate;
-    float w0_cos = std::cos(w0);
-    float w0_sin = std::sin(w0);
-    float alpha = w0_sin / q;
-    float norm = 1.0f / (1.0f + alpha / A);
-    float b0 = (1.0f + alpha * A) * norm;
-
-    coeff.a1 = -2.0f * w0_cos * norm;
-    coeff.a2 = (1 - alpha / A) * norm;
-    coeff.b0 = b0;
-    coeff.b1 = -2.0f * w0_cos * norm;
-    coeff.b2 = (1.0f - alpha * A) * norm;
-    return coeff;
+public:
+    /* Partition the impulse response, allocates memory */
+    void set_impulse_response(const float* ir, int length, int partition_size);
+
+    /* Use an already partitioned impulse response, allocates memory for the delay line */
+    void set_impulse_response(std::shared_ptr<const PartitionedIr> ir);
+
+    [[nodiscard]] int partitions() const {return _partitions;}
+
+    void reset();
+
+    /* Transform partition_size new input samples and push them to the delay line */
+    void push_input(const float* in);
+
+    /* Multiply and accumulate partitions [first, first + count) with the delay line */
+    void accumulate(int first, int count);
+
+    /* Transform the accumulated spectrum to partition_size samples of output and clear it */
+    void output(float* out);
+
+private:
+    std::shared_ptr<const PartitionedIr> _ir;
+    std::unique_ptr<RealFft> _fft;
+    int                      _partition_size{0};
+    int                      _partitions{0};
+    int                      _bins{0};
+    int                      _fdl_head{0};
+    std::vector<float>       _fdl_re;
+    std::vector<float>       _fdl_im;
+    std::vector<float>       _acc_re;
+    std::vector<float>       _acc_im;
+    std::vector<float>       _input;
+    std::vector<float>       _output;
 };
 
-template <typename  FloatType = float>
-inline BiquadCoefficients<FloatType> calc_lowshelf(float freq, float gain, float slope, float samplerate)
+/* Impulse response prepared for ConvolutionBrick. Create once and pass to
+ * several bricks to share the transformed partitions between them, i.e. when
+ * rendering many instances of a patch with the same reverb. */
+class ImpulseResponse
 {
-    BiquadCoefficients<FloatType> coeff;
-    float A = powf(10.0f, gain / 40.0f);
-    float w0 = 2.0f * static_cast<float>(M_PI) * freq / samplerate;
-    float w0_cos = std::cos(w0);
-    float w0_sin = std::sin(w0);
-    float A2_sqrt_alpha = 2.0f * w0_sin * std::sqrt((A * A + 1.0f) * (1.0f / slope - 1.0f) + 2.0f * A);
-    float A_inc_cos_w0 = (A + 1.0f) * w0_cos;
-    float A_dec_cos_w0 = (A - 1.0f) * w0_cos;
-    float norm = 1.0f / ((A + 1.0f) + A_dec_cos_w0 + A2_sqrt_alpha);
-
-    coeff.a1 = -2.0f * (A - 1.0f + A_inc_cos_w0) * norm;
-    coeff.a2 = (A + 1.0f + A_dec_cos_w0 - A2_sqrt_alpha) * norm;
-    coeff.b0 = A * (A + 1.0f - A_dec_cos_w0 + A2_sqrt_alpha) * norm;
-    coeff.b1 = 2.0f * A * (A - 1.0f - A_inc_cos_w0) * norm;
-    coeff.b2 = A * (A + 1.0f - A_dec_cos_w0 - A2_sqrt_alpha) * norm;
-    return coeff;
+public:
+    /* See ConvolutionBrick::set_impulse_response() for tail_partition_size */
+    ImpulseResponse(const float* ir, int length, int tail_partition_size = 0);
+
+    const std::shared_ptr<const PartitionedIr>& head() const {return _head;}
+
+    /* nullptr if the impulse response has no tail */
+    const std::shared_ptr<const PartitionedIr>& tail() const {return _tail;}
+
+    [[nodiscard]] int memory_size() const {return _head->memory_size() + (_tail ? _tail->memory_size() : 0);}
+
+private:
+    std::shared_ptr<const PartitionedIr> _head;
+    std::shared_ptr<const PartitionedIr> _tail;
 };
 
-template <typename  FloatType = float>
-inline BiquadCoefficients<FloatType> calc_highshelf(float freq, float gain, float slope, float samplerate)
+/* Fft based convolution for cabinet simulation and convolution reverbs.
+ * The start of the impulse response is processed with partitions of
+ * PROC_BLOCK_SIZE, which adds no latency beyond the processing block.
+ * Optionally, the tail of the impulse response can be processed with larger
+ * partitions, which is a lot more efficient for long impulse responses.
+ * The tail is computed over the process blocks it takes to fill one tail
+ * partition. The forward and inverse ffts of the tail are not split, they run
+ * in the first and last block of that period, and the multiply-accumulate of
+ * the tail partitions is spread over the blocks in between. So the cpu load is
+ * not flat: the most expensive blocks cost about one fft of twice the tail
+ * partition size, and if there are fewer tail partitions than blocks, some
+ * blocks do no tail work at all. */
+class ConvolutionBrick : public DspBrickImpl<0, 0, 1, 1>
 {
-    BiquadCoefficients<FloatType> coeff;
-    float A = powf(10.0f, gain / 40.0f);
-    float w0 = 2.0f * static_cast<float>(M_PI) * freq / samplerate;
-    float w0_cos = std::cos(w0);
-    float w0_sin = std::sin(w0);
-    float A2_sqrt_alpha = 2.0f * w0_sin * std::sqrt((A * A + 1.0f) * (1.0f / slope - 1.0f) + 2.0f * A);
-    float A_inc_cos_w0 = (A + 1.0f) * w0_cos;
-    float A_dec_cos_w0 = (A - 1.0f) * w0_cos;
-    float norm = 1.0f / ((A + 1.0f) - A_dec_cos_w0 + A2_sqrt_alpha);
-
-    coeff.a1 = 2.0f * (A - 1.0f - A_inc_cos_w0) * norm;
-    coeff.a2 = (A + 1.0f - A_dec_cos_w0 - A2_sqrt_alpha) * norm;
-    coeff.b0 = A * (A + 1.0f + A_dec_cos_w0 + A2_sqrt_alpha) * norm;
-    coeff.b1 = -2.0f * A * (A - 1.0f + A_inc_cos_w0) * norm;
-    coeff.b2 = A * (A + 1.0f + A_dec_cos_w0 - A2_sqrt_alpha) * norm;
-    return coeff;
-};
+public:
+    enum AudioOutput
+    {
+        CONV_OUT = 0
+    };
+
+    ConvolutionBrick() = default;
+
+    ConvolutionBrick(const AudioBuffer* audio_in)
+    {
+        set_audio_input(0, audio_in);
+    }
+
+    /* Set the impulse response, the data is copied. Allocates memory and is not
+     * safe to call while rendering. If tail_partition_size is > 0, it must be a
+     * power of 2 multiple of PROC_BLOCK_SIZE. The first 2 * tail_partition_size
+     * samples are then processed with PROC_BLOCK_SIZE partitions and the rest
+     * with tail_partition_size partitions. */
+    void set_impulse_response(const float* ir, int length, int tail_partition_size = 0);
 
+    /* Use a prepared impulse response, which is shared and not copied. Allocates
+     * memory for the processing state and is not safe to call while rendering */
+    void set_impulse_response(std::shared_ptr<const ImpulseResponse> ir);
+
+    void reset() override;
+
+    void render() override;
+
+private:
+    std::shared_ptr<const ImpulseResponse> _ir;
+    PartitionedConvolver               _head;
+    PartitionedConvolver               _tail;
+    bool                               _has_tail{false};
+    int                                _tail_blocks{0};
+    int                                _tail_step{0};
+    int                                _tail_playing{0};
+    std::vector<float>                 _tail_input;
+    std::array<std::vector<float>, 2>  _tail_output;
+};
 
 }// namespace bricks
 
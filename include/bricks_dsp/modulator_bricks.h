@@ -1,9 +1,11 @@
 #ifndef BRICKS_DSP_MODULATOR_BRICKS_H
 #define BRICKS_DSP_MODULATOR_BRICKS_H
 
+#include <array>
 #include <chrono>
 #include <type_traits>
 #include <memory>
+#include <vector>
 
 #include "dsp_brick.h"
 
@@ -341,21 +343,21 @@ public:
     void render() override
     {
         _copy_audio_in(_input_buffer(DEFAULT_INPUT));
-        auto mod_lag = _mod_lag;
-        mod_lag.set(clamp(_ctrl_value(ControlInput::DELAY_MOD), 0.0f, 1.0f));
+        _mod_lag.set(clamp(_ctrl_value(ControlInput::DELAY_MOD), 0.0f, 1.0f));
+        AudioBuffer mods;
+        _mod_lag.get_all(mods);
         auto& audio_out = _output_buffer(AudioOutput::DELAY_OUT);
         auto inter = _interpolator;
 
         for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
         {
             /* 0.5 is the mid-point. Delay is modulated around the set delay */
-            float delay = clamp(_delay * (mod_lag.get() * 2.0f) - i, 0, _max_delay);
+            float delay = clamp(_delay * (mods[i] * 2.0f) - i, 0, _max_delay);
             auto read_index = _get_read_index(delay);
             assert(read_index < _max_samples + PROC_BLOCK_SIZE);
 
             audio_out[i] = inter.interpolate(read_index++, _buffer);
         }
-        _mod_lag = mod_lag;
         _interpolator = inter;
     }
 
@@ -486,7 +488,7 @@ public:
             }
             float delay_out = _buffer[index];
 
-            float delay_in = in[i] + gain * delay_out;
+            float delay_in = flush_denormal(in[i] + gain * delay_out);
             _buffer[write_index++] = delay_in;
             if (write_index >= length)
             {
@@ -505,6 +507,226 @@ private:
 };
 
 
+/* Feedback delay network reverb with a Hadamard feedback matrix and lowpass
+ * damping and slow delay modulation in each line. Stereo input is fed to
+ * alternating delay lines and taken from alternating lines to the outputs.
+ * All delay lines share one buffer, interleaved so that the outputs of all
+ * lines for one sample are adjacent, and all per-line state is stored as
+ * arrays over the lines, so the per-sample work vectorises over the lines.
+ * Changes to the SIZE parameter are smoothed but will cause some pitch
+ * shifting while moving, like on a tape delay. */
+template<int lines = 8>
+class FdnReverbBrick : public DspBrickImpl<4, 0, 2, 2>
+{
+public:
+    enum ControlInput
+    {
+        SIZE = 0,
+        DECAY,
+        DAMPING,
+        MODULATION
+    };
+
+    enum AudioOutput
+    {
+        LEFT_OUT = 0,
+        RIGHT_OUT
+    };
+
+    FdnReverbBrick()
+    {
+        set_samplerate(DEFAULT_SAMPLERATE);
+    }
+
+    FdnReverbBrick(const float* size,
+                   const float* decay,
+                   const float* damping,
+                   const float* modulation,
+                   const AudioBuffer* left_in,
+                   const AudioBuffer* right_in)
+    {
+        set_control_input(ControlInput::SIZE, size);
+        set_control_input(ControlInput::DECAY, decay);
+        set_control_input(ControlInput::DAMPING, damping);
+        set_control_input(ControlInput::MODULATION, modulation);
+        set_audio_input(0, left_in);
+        set_audio_input(1, right_in);
+        set_samplerate(DEFAULT_SAMPLERATE);
+    }
+
+    /* Allocates memory for the delay lines, not safe to call while rendering */
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate = samplerate;
+        float max_delay = (MAX_DELAY_MS + MAX_MOD_MS) * 0.001f * samplerate + PROC_BLOCK_SIZE + 2;
+        int capacity = 1;
+        while (capacity < max_delay)
+        {
+            capacity *= 2;
+        }
+        _mask = capacity - 1;
+        _buffer.assign(capacity * lines, 0.0f);
+        for (int l = 0; l < lines; ++l)
+        {
+            _base_delay[l] = DELAY_TIMES_MS[l * MAX_LINES / lines] * 0.001f * samplerate;
+            _mod_phase[l] = static_cast<float>(l) / lines;
+        }
+        reset();
+    }
+
+    void reset() override
+    {
+        std::fill(_buffer.begin(), _buffer.end(), 0.0f);
+        _lp_state.fill(0.0f);
+        for (int l = 0; l < lines; ++l)
+        {
+            _delay[l] = _base_delay[l];
+        }
+        _write_index = 0;
+    }
+
+    void render() override
+    {
+        float size = 0.2f + 0.8f * clamp(_ctrl_value(ControlInput::SIZE), 0.0f, 1.0f);
+        float rt60 = MIN_RT60 * std::exp2(RT60_RANGE_OCTAVES * clamp(_ctrl_value(ControlInput::DECAY), 0.0f, 1.0f));
+        float damping = MAX_DAMPING * clamp(_ctrl_value(ControlInput::DAMPING), 0.0f, 1.0f);
+        float mod_depth = MAX_MOD_MS * 0.001f * _samplerate * clamp(_ctrl_value(ControlInput::MODULATION), 0.0f, 1.0f);
+        float mod_inc = MOD_RATE * PROC_BLOCK_SIZE / _samplerate;
+
+        /* Control rate updates of modulation, delay times and feedback gains per line */
+        std::array<float, lines> delay;
+        std::array<float, lines> delay_step;
+        std::array<float, lines> gain;
+        for (int l = 0; l < lines; ++l)
+        {
+            float phase = _mod_phase[l] + mod_inc * (1.0f + 0.1f * l);
+            phase -= phase >= 1.0f ? 1.0f : 0.0f;
+            _mod_phase[l] = phase;
+            /* Triangle lfo in [0, 1] */
+            float lfo = 2.0f * std::abs(phase - 0.5f);
+            float target = _base_delay[l] * size + mod_depth * lfo;
+            delay[l] = _delay[l];
+            delay_step[l] = (target - delay[l]) / PROC_BLOCK_SIZE;
+            _delay[l] = target;
+            /* -60 dB after rt60 seconds, regardless of line length */
+            gain[l] = std::exp2(LOG2_MINUS_60DB * target / (rt60 * _samplerate)) * NORM_GAIN;
+        }
+
+        const auto& left_in = _input_buffer(0);
+        const auto& right_in = _input_buffer(1);
+        auto& left_out = _output_buffer(AudioOutput::LEFT_OUT);
+        auto& right_out = _output_buffer(AudioOutput::RIGHT_OUT);
+
+        auto lp_state = _lp_state;
+        float* buffer = _buffer.data();
+        int mask = _mask;
+        int write_index = _write_index;
+
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            std::array<int, lines> index;
+            std::array<float, lines> frac;
+            for (int l = 0; l < lines; ++l)
+            {
+                delay[l] += delay_step[l];
+                /* Offset by the buffer size so the position is always positive and truncation can be used */
+                float pos = static_cast<float>(write_index + mask + 1) - delay[l];
+                index[l] = static_cast<int>(pos);
+                frac[l] = pos - index[l];
+            }
+
+            std::array<float, lines> d1;
+            std::array<float, lines> d2;
+            for (int l = 0; l < lines; ++l)
+            {
+                d1[l] = buffer[(index[l] & mask) * lines + l];
+                d2[l] = buffer[((index[l] + 1) & mask) * lines + l];
+            }
+
+            std::array<float, lines> values;
+            for (int l = 0; l < lines; ++l)
+            {
+                float value = d1[l] + frac[l] * (d2[l] - d1[l]);
+                lp_state[l] = value + damping * (lp_state[l] - value);
+                values[l] = lp_state[l];
+            }
+
+            float left = 0.0f;
+            float right = 0.0f;
+            for (int l = 0; l < lines; l += 2)
+            {
+                left += values[l];
+                right += values[l + 1];
+            }
+            left_out[i] = left * OUTPUT_GAIN;
+            right_out[i] = right * OUTPUT_GAIN;
+
+            _hadamard(values);
+
+            float* write_ptr = buffer + (write_index & mask) * lines;
+            for (int l = 0; l < lines; l += 2)
+            {
+                write_ptr[l] = values[l] * gain[l] + left_in[i] * INPUT_GAIN;
+                write_ptr[l + 1] = values[l + 1] * gain[l + 1] + right_in[i] * INPUT_GAIN;
+            }
+            write_index = (write_index + 1) & mask;
+        }
+
+        for (auto& state : lp_state)
+        {
+            state = flush_denormal(state);
+        }
+        _lp_state = lp_state;
+        _write_index = write_index;
+    }
+
+private:
+    static_assert(lines >= 2 && lines <= 16 && (lines & (lines - 1)) == 0, "lines must be 2, 4, 8 or 16");
+
+    /* Unnormalised fast Walsh-Hadamard transform, the normalisation is included in
+     * the feedback gain. Written as log2(lines) identical stages of sums and
+     * differences of adjacent pairs, which is easier to vectorise than the in-place
+     * butterfly version and gives the same Hadamard matrix */
+    static void _hadamard(std::array<float, lines>& values)
+    {
+        for (int stage = 1; stage < lines; stage *= 2)
+        {
+            std::array<float, lines> tmp;
+            for (int i = 0; i < lines / 2; ++i)
+            {
+                tmp[i] = values[2 * i] + values[2 * i + 1];
+                tmp[i + lines / 2] = values[2 * i] - values[2 * i + 1];
+            }
+            values = tmp;
+        }
+    }
+
+    static constexpr int MAX_LINES = 16;
+    /* Mutually prime-ish delay times to avoid coinciding echoes */
+    static constexpr std::array<float, MAX_LINES> DELAY_TIMES_MS = {29.3f, 31.7f, 37.1f, 41.3f, 43.9f, 47.3f, 53.1f, 59.7f,
+                                                                    61.3f, 67.9f, 71.3f, 73.7f, 79.1f, 83.3f, 89.9f, 97.3f};
+    static constexpr float MAX_DELAY_MS = 97.3f;
+    static constexpr float MAX_MOD_MS = 1.5f;
+    static constexpr float MOD_RATE = 0.7f;
+    static constexpr float MIN_RT60 = 0.2f;
+    static constexpr float RT60_RANGE_OCTAVES = 7.0f;
+    static constexpr float MAX_DAMPING = 0.9f;
+    static constexpr float LOG2_MINUS_60DB = -9.965784f;
+    /* 1 / sqrt(lines) */
+    static constexpr float NORM_GAIN = lines == 2 ? 0.7071068f : lines == 4 ? 0.5f : lines == 8 ? 0.3535534f : 0.25f;
+    static constexpr float INPUT_GAIN = 0.5f;
+    static constexpr float OUTPUT_GAIN = 2.0f / lines;
+
+    std::vector<float>       _buffer;
+    int                      _mask{0};
+    int                      _write_index{0};
+    float                    _samplerate{DEFAULT_SAMPLERATE};
+    std::array<float, lines> _base_delay;
+    std::array<float, lines> _delay;
+    std::array<float, lines> _mod_phase;
+    std::array<float, lines> _lp_state;
+};
+
 /* Reduce the bit depth continuously from 24 to 1 */
 class BitRateReducerBrick : public DspBrickImpl<1, 0, 1, 1>
 {
@@ -569,8 +791,8 @@ private:
     float           _down_phase{0.0f};
     float           _up_phase{0.0f};
 
-    AlignedArray<float, PROC_BLOCK_SIZE + SAMPLE_DELAY * 2> _delay_buffer;
-    AlignedArray<float, PROC_BLOCK_SIZE + SAMPLE_DELAY * 2> _downsampled_buffer;
+    AlignedArray<float, PROC_BLOCK_SIZE + SAMPLE_DELAY * 2> _delay_buffer{0.0f};
+    AlignedArray<float, PROC_BLOCK_SIZE + SAMPLE_DELAY * 2> _downsampled_buffer{0.0f};
 };
 
 } // end namespace bricks
@@ -0,0 +1,151 @@
+#ifndef BRICKS_DSP_OFFLINE_RENDERER_H
+#define BRICKS_DSP_OFFLINE_RENDERER_H
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "dsp_brick.h"
+
+namespace bricks {
+
+/* Something that produces audio one block at a time, typically a graph of
+ * bricks. A source is only ever rendered from one thread at a time. */
+class RenderSource
+{
+public:
+    virtual ~RenderSource() = default;
+
+    virtual int channels() const = 0;
+
+    /* Render PROC_BLOCK_SIZE samples, sample_pos is the position of the first
+     * sample in the block, for sources that need to schedule events */
+    virtual void render(int64_t sample_pos) = 0;
+
+    virtual const AudioBuffer& output(int channel) const = 0;
+};
+
+/* Renders a list of bricks in order and outputs the given buffers */
+class GraphSource : public RenderSource
+{
+public:
+    GraphSource(std::vector<DspBrick*> graph, std::vector<const AudioBuffer*> outputs) : _graph(std::move(graph)),
+                                                                                         _outputs(std::move(outputs)) {}
+
+    int channels() const override {return static_cast<int>(_outputs.size());}
+
+    void render(int64_t /*sample_pos*/) override
+    {
+        for (auto brick : _graph)
+        {
+            brick->render();
+        }
+    }
+
+    const AudioBuffer& output(int channel) const override {return *_outputs[channel];}
+
+private:
+    std::vector<DspBrick*>          _graph;
+    std::vector<const AudioBuffer*> _outputs;
+};
+
+/* Destination for rendered audio, i.e. a file. All calls are made from the
+ * renderer's writer thread, never concurrently for the same sink. */
+class RenderSink
+{
+public:
+    virtual ~RenderSink() = default;
+
+    /* Write frames of interleaved audio with the source's number of channels */
+    virtual void write(const float* interleaved, int channels, int frames) = 0;
+
+    /* Called after the last write of a job */
+    virtual void close() {}
+};
+
+/* Sink that keeps everything in memory */
+class MemorySink : public RenderSink
+{
+public:
+    void write(const float* interleaved, int channels, int frames) override
+    {
+        _channels = channels;
+        _data.insert(_data.end(), interleaved, interleaved + channels * frames);
+    }
+
+    void close() override {_closed = true;}
+
+    int channels() const {return _channels;}
+
+    int frames() const {return _channels > 0 ? static_cast<int>(_data.size()) / _channels : 0;}
+
+    bool closed() const {return _closed;}
+
+    const std::vector<float>& data() const {return _data;}
+
+private:
+    int                 _channels{0};
+    bool                _closed{false};
+    std::vector<float>  _data;
+};
+
+struct RenderJob
+{
+    RenderSource*   source;
+    RenderSink*     sink;
+    /* In samples, does not need to be a multiple of PROC_BLOCK_SIZE */
+    int64_t         length;
+};
+
+struct RenderStats
+{
+    int64_t samples;
+    double  seconds;
+    /* Rendered audio duration / wall clock time at the given samplerate */
+    double  realtime_factor;
+};
+
+/* Renders independent sources, i.e. stems or preset previews, as fast as
+ * possible over several threads. Each job is rendered from start to end by one
+ * worker thread, as sources are stateful, and workers pick the next unstarted
+ * job when done, so many small jobs spread evenly over all cores.
+ * Workers render into one of 2 chunk buffers per job while a separate writer
+ * thread passes the other one to the sink, so slow sinks only stall rendering
+ * if a whole chunk has been rendered before the previous one is written. */
+class OfflineRenderer
+{
+public:
+    static constexpr int DEFAULT_CHUNK_SIZE = 16384;
+
+    /* threads = 0 uses one thread per core, chunk_size is in frames and
+     * rounded up to a multiple of PROC_BLOCK_SIZE */
+    explicit OfflineRenderer(int threads = 0, int chunk_size = DEFAULT_CHUNK_SIZE);
+
+    /* The source and sink must outlive the call to run(). Length is in samples
+     * and does not need to be a multiple of PROC_BLOCK_SIZE */
+    void add_job(RenderSource* source, RenderSink* sink, int64_t length);
+
+    /* Render all added jobs and block until they are written to their sinks.
+     * Clears the list of jobs when done */
+    RenderStats run(float samplerate = DEFAULT_SAMPLERATE);
+
+    /* Called from the worker threads to set up a job before rendering it,
+     * worker is in the range [0, threads()). Sources returned to the same
+     * worker are never rendered concurrently and can be reused between jobs */
+    using JobProvider = std::function<RenderJob(int worker, int job)>;
+
+    /* Render jobs that are set up on demand by the worker rendering them, for
+     * when there are too many jobs to create all sources up front */
+    RenderStats run(int jobs, const JobProvider& provider, float samplerate = DEFAULT_SAMPLERATE);
+
+    int threads() const {return _threads;}
+
+private:
+    int                     _threads;
+    int                     _chunk_size;
+    std::vector<RenderJob>  _jobs;
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_OFFLINE_RENDERER_H
@@ -5,6 +5,7 @@
 
 #include "dsp_brick.h"
 #include "random_device.h"
+#include "wavetable.h"
 
 namespace bricks {
 
@@ -111,17 +112,13 @@ private:
 };
 
 
-/* Wavetable based saw/sq/tri oscillator with control rate pitch input */
+/* Wavetable based saw/sq/tri oscillator with control rate pitch input. The
+ * tables come from the global WavetableStore and are shared between instances.
+ * Changing waveform or table is not safe to do from the audio thread */
 class WtOscillatorBrick : public DspBrickImpl<1, 0, 0, 1>
 {
 public:
-    enum class Waveform
-    {
-        SAW,
-        PULSE,
-        TRIANGLE,
-        SINE
-    };
+    using Waveform = BasicWaveform;
 
     enum ControlInput
     {
@@ -133,14 +130,21 @@ public:
         OSC_OUT = 0
     };
 
-    WtOscillatorBrick() = default;
+    WtOscillatorBrick()
+    {
+        set_waveform(Waveform::SAW);
+    }
 
     WtOscillatorBrick(const float* pitch)
     {
         set_control_input(ControlInput::PITCH, pitch);
+        set_waveform(Waveform::SAW);
     }
 
-    void set_waveform(Waveform waveform) {_waveform = waveform;}
+    void set_waveform(Waveform waveform) {_table = WavetableStore::instance().get(waveform);}
+
+    /* Use a user table, from WavetableStore::add() */
+    void set_wavetable(std::shared_ptr<const Wavetable> table) {_table = std::move(table);}
 
     void set_samplerate(float samplerate) override
     {
@@ -153,13 +157,113 @@ public:
     void render() override;
 
 private:
-    float           _samplerate{DEFAULT_SAMPLERATE};
-    float           _samplerate_inv{1.0 / DEFAULT_SAMPLERATE};
-    float           _phase{0};
-    Waveform        _waveform{Waveform::SAW};
+    float                               _samplerate{DEFAULT_SAMPLERATE};
+    float                               _samplerate_inv{1.0 / DEFAULT_SAMPLERATE};
+    float                               _phase{0};
+    std::shared_ptr<const Wavetable>    _table;
+};
+
+/* Wavetable oscillator that scans between the frames of a MorphWavetable with
+ * the POSITION control, [0, 1] covers all frames. If audio_rate_position is
+ * true, the audio input is added to POSITION every sample. Uses the same mip
+ * map level selection as WtOscillatorBrick. Setting a table is not safe to do
+ * from the audio thread. */
+template <bool audio_rate_position = false>
+class WavetableMorphOscillatorBrick : public DspBrickImpl<2, 0, audio_rate_position ? 1 : 0, 1>
+{
+public:
+    enum ControlInput
+    {
+        PITCH = 0,
+        POSITION
+    };
+
+    enum AudioOutput
+    {
+        OSC_OUT = 0
+    };
+
+    WavetableMorphOscillatorBrick()
+    {
+        set_wavetable(WavetableStore::instance().basic_morph());
+    }
+
+    WavetableMorphOscillatorBrick(const float* pitch, const float* position, const AudioBuffer* position_mod = nullptr)
+    {
+        this->set_control_input(ControlInput::PITCH, pitch);
+        this->set_control_input(ControlInput::POSITION, position);
+        if constexpr (audio_rate_position)
+        {
+            this->set_audio_input(0, position_mod);
+        }
+        set_wavetable(WavetableStore::instance().basic_morph());
+    }
+
+    void set_wavetable(std::shared_ptr<const MorphWavetable> table) {_table = std::move(table);}
+
+    void set_samplerate(float samplerate) override
+    {
+        _samplerate = samplerate;
+        _samplerate_inv = 1.0f / samplerate;
+    }
+
+    void reset() override
+    {
+        _phase = 0.0f;
+        _position_smoother.reset();
+    }
+
+    void render() override
+    {
+        float pitch = this->_ctrl_value(ControlInput::PITCH);
+        float phase_inc = control_to_freq(pitch) * _samplerate_inv;
+        int level = wavetable_level(pitch, _samplerate);
+        float table_len = MorphWavetable::length(level);
+        const float* table = _table->level(level);
+        int frames = _table->frames();
+        float max_position = static_cast<float>(frames - 1);
+
+        _position_smoother.set(clamp(this->_ctrl_value(ControlInput::POSITION), 0.0f, 1.0f) * max_position);
+        AudioBuffer positions;
+        _position_smoother.get_all(positions);
+        float phase = _phase;
+        auto& audio_out = this->_output_buffer(AudioOutput::OSC_OUT);
+
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            float position = positions[i];
+            if constexpr (audio_rate_position)
+            {
+                position = clamp(position + this->_input_buffer(0)[i] * max_position, 0.0f, max_position);
+            }
+            /* Frame and frame + 1 are interpolated, the last frame is reached with frac = 1 */
+            int frame = std::min(static_cast<int>(position), frames - 2);
+            float frame_frac = position - frame;
+
+            phase += phase_inc;
+            phase -= phase >= 1.0f ? 1.0f : 0.0f;
+            float pos = phase * table_len;
+            int index = static_cast<int>(pos);
+            float frac = pos - index;
+
+            const float* d1 = table + index * frames + frame;
+            const float* d2 = d1 + frames;
+            float s1 = d1[0] + frame_frac * (d1[1] - d1[0]);
+            float s2 = d2[0] + frame_frac * (d2[1] - d2[0]);
+            audio_out[i] = s1 + frac * (s2 - s1);
+        }
+        _phase = phase;
+    }
+
+private:
+    float                                   _samplerate{DEFAULT_SAMPLERATE};
+    float                                   _samplerate_inv{1.0 / DEFAULT_SAMPLERATE};
+    float                                   _phase{0};
+    ControlSmootherLinear                   _position_smoother;
+    std::shared_ptr<const MorphWavetable>   _table;
 };
 
-/* Noise generator with 3 levels of lp filtering */
+/* White, pink (-3 dB/octave) or brown (-6 dB/octave) noise generator */
 class NoiseGeneratorBrick : public DspBrickImpl<0, 0, 0, 1>
 {
 public:
@@ -175,17 +279,35 @@ public:
         NOISE_OUT = 0,
     };
 
-    NoiseGeneratorBrick() = default;
+    static constexpr int PINK_POLES = 8;
+
+    NoiseGeneratorBrick()
+    {
+        set_samplerate(DEFAULT_SAMPLERATE);
+    }
 
     void set_waveform(Waveform waveform) {_waveform = waveform;}
 
     void set_samplerate(float samplerate) override;
 
+    void reset() override
+    {
+        _pink_state.fill(0.0f);
+        _pink_delayed = 0;
+        _brown_state = 0;
+        _rand_device.seek(0);
+    }
+
     void render() override;
 
 private:
-    float               _pink_coeff_a0;
+    std::array<float, PINK_POLES> _pink_poles;
+    std::array<float, PINK_POLES> _pink_gains;
+    std::array<float, PINK_POLES> _pink_state{};
+    float               _pink_delayed{0};
     float               _brown_coeff_a0;
+    float               _brown_coeff_b0;
+    float               _brown_state{0};
     Waveform            _waveform{Waveform::WHITE};
     RandomDevice        _rand_device;
 };
@@ -1,31 +1,125 @@
 #ifndef BRICKS_DSP_RANDOM_DEVICE_H
 #define BRICKS_DSP_RANDOM_DEVICE_H
 
-#include <random>
+#include <cstdint>
 
 namespace bricks {
 
+/* Integer hash with good avalanche (lowbias32 by C. Wellons) with the key mixed in */
+inline constexpr uint32_t random_hash(uint32_t x, uint32_t key)
+{
+    x ^= key;
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x += key;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Map a random integer to a float in [-1, 1) using its 24 upper bits */
+inline constexpr float random_to_norm(uint32_t x)
+{
+    return static_cast<float>(static_cast<int32_t>(x >> 8)) * (1.0f / (1 << 23)) - 1.0f;
+}
+
+/* Counter based random generator. Every value is a hash of a running counter
+ * and a per device key, so there is no dependency between consecutive values
+ * and filling a block compiles to a few vector instructions per sample.
+ *
+ * The key is derived from a seed and a stream id, devices with the same seed
+ * and stream produce the same sequence, and different streams of the same seed
+ * are independent. The position in the stream can be set directly, so jumping
+ * ahead is free. Each stream repeats after 2^32 values. */
 class RandomDevice
 {
 public:
+    /* Seeded from the RandomContext of this thread if there is one, see below.
+     * Otherwise each device gets a new stream from a process wide counter and
+     * the output depends on the order devices are constructed in */
     RandomDevice();
 
-    uint32_t get() {return _device();}
+    RandomDevice(uint32_t seed, uint32_t stream)
+    {
+        set_seed(seed, stream);
+    }
+
+    /* Restarts the stream from position 0 */
+    void set_seed(uint32_t seed, uint32_t stream)
+    {
+        _key = random_hash(random_hash(stream, STREAM_KEY), seed);
+        _counter = 0;
+    }
+
+    /* Jump to position in the stream, i.e. seek(0) to restart the sequence */
+    void seek(uint32_t position) {_counter = position;}
+
+    /* Jump ahead count values, the same as generating and discarding them */
+    void skip(uint32_t count) {_counter += count;}
+
+    uint32_t position() const {return _counter;}
+
+    uint32_t get() {return random_hash(_counter++, _key);}
+
+    /* Random value normalised to [-1, 1) */
+    float get_norm() {return random_to_norm(get());}
 
-    /* Random value normalised to [-1, 1] */
-    float get_norm()
+    /* Fill count values normalised to [-1, 1) */
+    void fill_norm(float* dest, int count)
     {
-        return (static_cast<float>(_device()) - FLOAT_MIN) / (FLOAT_MAX * 0.5f) - 1.0f;
+        uint32_t counter = _counter;
+        uint32_t key = _key;
+        for (int i = 0; i < count; ++i)
+        {
+            dest[i] = random_to_norm(random_hash(counter + i, key));
+        }
+        _counter = counter + count;
+    }
+
+    template <typename Buffer>
+    void fill_norm(Buffer& buffer)
+    {
+        fill_norm(buffer.data(), static_cast<int>(buffer.size()));
     }
-    static constexpr float FLOAT_MIN = static_cast<float>(std::minstd_rand::min());
-    static constexpr float FLOAT_MAX = static_cast<float>(std::minstd_rand::max());
 
 private:
-    static uint32_t  _seed;
-    std::minstd_rand _device;
+    static constexpr uint32_t STREAM_KEY = 0x9e3779b9U;
+
+    uint32_t         _key;
+    uint32_t         _counter{0};
 };
 
+/* While a RandomContext is in scope, every RandomDevice constructed by the
+ * same thread, i.e. the ones in the bricks of a graph, gets the context's seed
+ * and consecutive stream ids, starting from first_stream. A graph built inside
+ * a context therefore produces the same noise no matter which thread builds it
+ * or what else is built before or concurrently, so parallel and batch renders
+ * are bit identical to serial ones. Contexts can be nested, the innermost one
+ * is used. Not copyable, must be destroyed on the thread that created it */
+class RandomContext
+{
+public:
+    explicit RandomContext(uint32_t seed, uint32_t first_stream = 0);
+
+    ~RandomContext();
 
+    RandomContext(const RandomContext&) = delete;
+    RandomContext& operator=(const RandomContext&) = delete;
+
+    uint32_t seed() const {return _seed;}
+
+    /* Returns the next stream id and advances the counter */
+    uint32_t next_stream() {return _next_stream++;}
+
+    /* The innermost context of this thread, or nullptr */
+    static RandomContext* current();
+
+private:
+    uint32_t        _seed;
+    uint32_t        _next_stream;
+    RandomContext*  _previous;
+};
 
 } // namespace bricks
 
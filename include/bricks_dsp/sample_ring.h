@@ -0,0 +1,97 @@
+#ifndef BRICKS_DSP_SAMPLE_RING_H
+#define BRICKS_DSP_SAMPLE_RING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace bricks {
+
+/* Lock free single producer, single consumer ring buffer of samples, for
+ * passing audio from the audio thread to a non realtime thread. Neither side
+ * ever blocks, if the ring is full the producer drops the samples that don't
+ * fit and counts them. */
+template <typename T = float>
+class SampleRing
+{
+public:
+    /* Capacity is rounded up to a power of 2, allocates memory */
+    explicit SampleRing(int min_capacity)
+    {
+        int capacity = 1;
+        while (capacity < min_capacity)
+        {
+            capacity *= 2;
+        }
+        _data.resize(capacity);
+        _mask = capacity - 1;
+    }
+
+    int capacity() const {return _mask + 1;}
+
+    /* Producer side. Returns the number of samples written */
+    int write(const T* data, int count)
+    {
+        auto write_pos = _write_pos.load(std::memory_order_relaxed);
+        auto read_pos = _read_pos.load(std::memory_order_acquire);
+        int free = capacity() - static_cast<int>(write_pos - read_pos);
+        int to_write = std::min(count, free);
+        for (int i = 0; i < to_write; ++i)
+        {
+            _data[(write_pos + i) & _mask] = data[i];
+        }
+        _write_pos.store(write_pos + to_write, std::memory_order_release);
+        if (to_write < count)
+        {
+            _dropped.fetch_add(count - to_write, std::memory_order_relaxed);
+        }
+        return to_write;
+    }
+
+    /* Producer side. Total number of samples written */
+    uint64_t write_position() const {return _write_pos.load(std::memory_order_relaxed);}
+
+    /* Consumer side. Samples available for reading */
+    int available() const
+    {
+        return static_cast<int>(_write_pos.load(std::memory_order_acquire) - _read_pos.load(std::memory_order_relaxed));
+    }
+
+    /* Consumer side. Returns the number of samples read */
+    int read(T* dest, int count)
+    {
+        auto read_pos = _read_pos.load(std::memory_order_relaxed);
+        int to_read = std::min(count, available());
+        for (int i = 0; i < to_read; ++i)
+        {
+            dest[i] = _data[(read_pos + i) & _mask];
+        }
+        _read_pos.store(read_pos + to_read, std::memory_order_release);
+        return to_read;
+    }
+
+    /* Consumer side. Discard all samples before position, as returned from
+     * write_position() on the producer side */
+    void discard_until(uint64_t position)
+    {
+        auto read_pos = _read_pos.load(std::memory_order_relaxed);
+        auto write_pos = _write_pos.load(std::memory_order_acquire);
+        _read_pos.store(std::clamp(position, read_pos, write_pos), std::memory_order_release);
+    }
+
+    /* Total number of samples dropped because the ring was full */
+    int64_t dropped() const {return _dropped.load(std::memory_order_relaxed);}
+
+private:
+    std::vector<T>          _data;
+    int                     _mask;
+    /* On separate cache lines as they are written by different threads */
+    alignas(64) std::atomic<uint64_t> _write_pos{0};
+    alignas(64) std::atomic<uint64_t> _read_pos{0};
+    std::atomic<int64_t>    _dropped{0};
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_SAMPLE_RING_H
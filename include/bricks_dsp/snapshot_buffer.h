@@ -0,0 +1,115 @@
+#ifndef BRICKS_DSP_SNAPSHOT_BUFFER_H
+#define BRICKS_DSP_SNAPSHOT_BUFFER_H
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+
+namespace bricks {
+
+/* Hands the most recent frames of data, i.e. oscilloscope or spectrum frames,
+ * from the audio thread to any number of readers, i.e. gui threads.
+ * The writer never blocks or waits for readers, and readers never block the
+ * writer. Each slot is protected by a sequence lock: the sequence number of
+ * a slot is odd while it's being written and 2 * (frame + 1) when frame has been
+ * published to it, so readers can detect both a torn read and a slot that has
+ * been reused for a newer frame, and retry.
+ * There is one more slot than the history length, so the slot being written
+ * is never one of the history frames. Readers only fail if they are more than
+ * a whole frame behind the writer, or read slower than the writer writes.
+ * Readers may copy a slot while it is being overwritten, which is only safe
+ * if T is trivially copyable, so no types that own memory, i.e. std::vector. */
+template <typename T, int history>
+class SnapshotBuffer
+{
+public:
+    static_assert(history > 0);
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+
+    /* Writer side. Returns the slot for the next frame to be written in place,
+     * which can be filled over several calls before calling publish() */
+    T& write_slot()
+    {
+        auto frame = _published.load(std::memory_order_relaxed);
+        auto& slot = _slots[frame % CAPACITY];
+        if (!_writing)
+        {
+            slot.sequence.store(2 * frame + 1, std::memory_order_relaxed);
+            /* Make sure the odd sequence number is visible before any data is written */
+            std::atomic_thread_fence(std::memory_order_release);
+            _writing = true;
+        }
+        return slot.data;
+    }
+
+    /* Writer side. Publish the frame written to write_slot() */
+    void publish()
+    {
+        write_slot();
+        auto frame = _published.load(std::memory_order_relaxed);
+        _slots[frame % CAPACITY].sequence.store(2 * frame + 2, std::memory_order_release);
+        _published.store(frame + 1, std::memory_order_release);
+        _writing = false;
+    }
+
+    /* Writer side. Copy and publish a complete frame */
+    void push(const T& frame)
+    {
+        write_slot() = frame;
+        publish();
+    }
+
+    /* Total number of frames published, readers can compare this with a previous
+     * value to see if there is new data */
+    uint64_t frame_count() const {return _published.load(std::memory_order_acquire);}
+
+    /* Reader side, zero copy. Calls fun with a const reference to the frame
+     * published age frames before the latest one. If the frame is overwritten
+     * while fun is running, the result must be discarded and false is returned.
+     * Also returns false if there are not enough frames published yet */
+    template <typename Function>
+    bool read(int age, Function&& fun) const
+    {
+        auto published = _published.load(std::memory_order_acquire);
+        if (age < 0 || age >= history || static_cast<uint64_t>(age) >= published)
+        {
+            return false;
+        }
+        auto frame = published - 1 - age;
+        const auto& slot = _slots[frame % CAPACITY];
+        auto expected = 2 * frame + 2;
+        if (slot.sequence.load(std::memory_order_acquire) != expected)
+        {
+            return false;
+        }
+        fun(slot.data);
+        /* Make sure all reads from data are done before checking the sequence again */
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return slot.sequence.load(std::memory_order_relaxed) == expected;
+    }
+
+    /* Reader side. Copy a frame to dest, returns false if dest is not valid */
+    bool read_copy(int age, T& dest) const
+    {
+        return read(age, [&](const T& frame) {dest = frame;});
+    }
+
+private:
+    static constexpr int CAPACITY = history + 1;
+
+    struct Slot
+    {
+        std::atomic<uint64_t>   sequence{0};
+        T                       data{};
+    };
+
+    std::array<Slot, CAPACITY>  _slots;
+    std::atomic<uint64_t>       _published{0};
+    /* Only accessed by the writer */
+    bool                        _writing{false};
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_SNAPSHOT_BUFFER_H
@@ -1,6 +1,7 @@
 #ifndef BRICKS_DSP_UTILITY_BRICKS_H
 #define BRICKS_DSP_UTILITY_BRICKS_H
 
+#include <algorithm>
 #include <cassert>
 
 #include "dsp_brick.h"
@@ -52,12 +53,12 @@ public:
         _gain_lag.set(gain);
         if (_gain_lag.moving())
         {
-            auto gain_lag = _gain_lag;
+            AudioBuffer gains;
+            _gain_lag.get_all(gains);
             for (int s = 0; s < audio_out.size(); ++s)
             {
-                audio_out[s] = audio_in[s] * gain_lag.get();
+                audio_out[s] = audio_in[s] * gains[s];
             }
-            _gain_lag = gain_lag;
         }
         else
         {
@@ -105,45 +106,34 @@ public:
     void reset() override
     {
         this_template::_output_buffer(AudioOutput::MIX_OUT).fill(0.0f);
+        _gains.fill(0.0f);
     }
 
     void render() override
     {
-        auto& audio_out = this_template::_output_buffer(AudioOutput::MIX_OUT);
-        audio_out.fill(0.0f);
-
+        /* Gains ramp linearly to the new value over one block */
+        std::array<const float*, channel_count> inputs;
+        std::array<float, channel_count> targets;
+        std::array<float, channel_count> steps;
         for (int i = 0; i < channel_count; ++i)
         {
-            auto gain_lag = _gain_lags[i];
-
             float gain = this_template::_ctrl_value(i);
             if constexpr (response == Response::LOG)
             {
                 gain = to_db_approx(gain);
             }
-            gain_lag.set(gain);
-            const auto& audio_in = this_template::_input_buffer(i);
-
-            if (gain_lag.moving())
-            {
-                for (int s = 0; s < audio_out.size(); ++s)
-                {
-                    audio_out[s] += audio_in[s] * gain_lag.get();
-                }
-            }
-            else
-            {
-                for (int s = 0; s < audio_out.size(); ++s)
-                {
-                    audio_out[s] += audio_in[s] * gain;
-                }
-            }
-            _gain_lags[i] = gain_lag;
+            targets[i] = gain;
+            steps[i] = (gain - _gains[i]) * (1.0f / PROC_BLOCK_SIZE);
+            inputs[i] = this_template::_input_buffer(i).data();
         }
+        auto& audio_out = this_template::_output_buffer(AudioOutput::MIX_OUT);
+        mix_ramped<PROC_BLOCK_SIZE>(audio_out.data(), inputs.data(), _gains.data(), steps.data(), channel_count);
+
+        _gains = targets;
     }
 
 private:
-    std::array<ControlSmootherLinear, channel_count> _gain_lags;
+    std::array<float, channel_count> _gains{};
 };
 
 /* General n to 2 audio mixer with individual gain controls for each input
@@ -181,22 +171,21 @@ public:
     {
         this_template::_output_buffer(AudioOutput::LEFT_OUT).fill(0.0f);
         this_template::_output_buffer(AudioOutput::RIGHT_OUT).fill(0.0f);
+        _left_gains.fill(0.0f);
+        _right_gains.fill(0.0f);
     }
 
     void render() override
     {
-        auto& left_out = this_template::_output_buffer(AudioOutput::LEFT_OUT);
-        auto& right_out = this_template::_output_buffer(AudioOutput::RIGHT_OUT);
-        left_out.fill(0.0f);
-        right_out.fill(0.0f);
-
+        /* Gains ramp linearly to the new value over one block */
+        std::array<const float*, channel_count> inputs;
+        std::array<float, channel_count> left_targets;
+        std::array<float, channel_count> right_targets;
+        std::array<float, channel_count> left_steps;
+        std::array<float, channel_count> right_steps;
         for (int i = 0; i < channel_count; ++i)
         {
-            auto left_lag = _gain_lags[i * 2];
-            auto right_lag = _gain_lags[i * 2 + 1];
-
             // 0 is fully left and 1 fully right
-            //float pan = this_template::_ctrl_value(i * 2) * 2.0f - 1.0f;
             float pan = clamp(this_template::_ctrl_value(i * 2), 0.0f, 1.0f);
             float gain = this_template::_ctrl_value(i * 2 + 1);
 
@@ -206,37 +195,25 @@ public:
             }
 
             // Equal gain pan law (-6dB), should probably do better curves
-            float left_gain = gain * (1.0f - pan);
-            float right_gain = gain * pan;
-
-            left_lag.set(left_gain);
-            right_lag.set(right_gain);
-
-            const auto& audio_in = this_template::_input_buffer(i);
-
-            if (left_lag.moving() || right_lag.moving())
-            {
-                for (int s = 0; s < left_out.size(); ++s)
-                {
-                    left_out[s] += audio_in[s] * left_lag.get();
-                    right_out[s] += audio_in[s] * right_lag.get();
-                }
-            }
-            else
-            {
-                for (int s = 0; s < left_out.size(); ++s)
-                {
-                    left_out[s] += audio_in[s] * left_gain;
-                    right_out[s] += audio_in[s] * right_gain;
-                }
-            }
-            _gain_lags[i * 2] = left_lag;
-            _gain_lags[i * 2 + 1] = right_lag;
+            left_targets[i] = gain * (1.0f - pan);
+            right_targets[i] = gain * pan;
+            left_steps[i] = (left_targets[i] - _left_gains[i]) * (1.0f / PROC_BLOCK_SIZE);
+            right_steps[i] = (right_targets[i] - _right_gains[i]) * (1.0f / PROC_BLOCK_SIZE);
+            inputs[i] = this_template::_input_buffer(i).data();
         }
+        auto& left_out = this_template::_output_buffer(AudioOutput::LEFT_OUT);
+        auto& right_out = this_template::_output_buffer(AudioOutput::RIGHT_OUT);
+        mix_ramped_stereo<PROC_BLOCK_SIZE>(left_out.data(), right_out.data(), inputs.data(),
+                                           _left_gains.data(), left_steps.data(),
+                                           _right_gains.data(), right_steps.data(), channel_count);
+
+        _left_gains = left_targets;
+        _right_gains = right_targets;
     }
 
 private:
-    std::array<ControlSmootherLinear, channel_count * 2> _gain_lags;
+    std::array<float, channel_count> _left_gains{};
+    std::array<float, channel_count> _right_gains{};
 };
 
 /* General n to 1 audio mixer without gain controls */
@@ -508,6 +485,340 @@ private:
     float  _clamp_min{0.0f};
     float  _clamp_max{1.0f};
 };
+
+/* Modulation matrix with sparse routing, for patches with many sources and
+ * destinations but few active routes. Sources 0 to ctrl_sources - 1 are the
+ * control inputs and the following ones are the audio inputs, destinations are
+ * numbered the same way, control outputs first and then audio outputs.
+ *
+ * Routes are stored sorted by destination (compressed sparse rows), so that
+ * render only touches the active routes, with depth and curve evaluated for all
+ * of them in one vectorised pass, and each destination is the sum of its
+ * routes. Destinations without routes output 0.
+ *
+ * Depth changes are ramped over one block for audio destinations, as are
+ * control sources routed to audio destinations. Control destinations are
+ * updated once per block. Audio sources routed to control destinations use
+ * the last sample of the block.
+ * Adding and removing routes doesn't allocate, but rebuilds the tables. Routes
+ * that are kept continue their ramps, new routes start at their current value */
+template <int ctrl_sources, int audio_sources, int ctrl_dests, int audio_dests, int max_routes = 32>
+class ModMatrixBrick : public DspBrickImpl<ctrl_sources, ctrl_dests, audio_sources, audio_dests>
+{
+    using this_template = DspBrickImpl<ctrl_sources, ctrl_dests, audio_sources, audio_dests>;
+
+public:
+    static constexpr int SOURCES = ctrl_sources + audio_sources;
+    static constexpr int DESTINATIONS = ctrl_dests + audio_dests;
+
+    enum class Curve
+    {
+        LINEAR,     // x
+        BIPOLAR,    // 2x - 1, maps [0, 1] to [-1, 1]
+        INVERTED,   // 1 - x
+        QUADRATIC,  // x * |x|, keeps the sign
+        CUBIC,      // x^3
+    };
+
+    struct Route
+    {
+        int   source;
+        int   destination;
+        float depth;
+        Curve curve{Curve::LINEAR};
+    };
+
+    ModMatrixBrick() = default;
+
+    ModMatrixBrick(std::array<const float*, ctrl_sources> ctrl_ins,
+                   std::array<const AudioBuffer*, audio_sources> audio_ins)
+    {
+        for (unsigned int i = 0; i < ctrl_ins.size(); ++i)
+        {
+            this_template::set_control_input(i, ctrl_ins[i]);
+        }
+        for (unsigned int i = 0; i < audio_ins.size(); ++i)
+        {
+            this_template::set_audio_input(i, audio_ins[i]);
+        }
+    }
+
+    /* Adds a route, or replaces the depth and curve if the source is already
+     * routed to the destination. Returns false if there are max_routes routes */
+    bool add_route(const Route& route)
+    {
+        assert(route.source >= 0 && route.source < SOURCES);
+        assert(route.destination >= 0 && route.destination < DESTINATIONS);
+        auto existing = _find_route(route.source, route.destination);
+        if (existing != _routes.begin() + _route_count)
+        {
+            *existing = route;
+        }
+        else if (_route_count < max_routes)
+        {
+            _routes[_route_count++] = route;
+        }
+        else
+        {
+            return false;
+        }
+        _build_tables();
+        return true;
+    }
+
+    void remove_route(int source, int destination)
+    {
+        auto end = _routes.begin() + _route_count;
+        auto route = _find_route(source, destination);
+        if (route != end)
+        {
+            std::copy(route + 1, end, route);
+            _route_count--;
+            _build_tables();
+        }
+    }
+
+    void clear_routes()
+    {
+        _route_count = 0;
+        _build_tables();
+    }
+
+    int route_count() const {return _route_count;}
+
+    /* Change the depth of an existing route without rebuilding the tables, so
+     * the change is smoothed. Returns false if there is no such route */
+    bool set_depth(int source, int destination, float depth)
+    {
+        auto route = _find_route(source, destination);
+        if (route == _routes.begin() + _route_count)
+        {
+            return false;
+        }
+        route->depth = depth;
+        for (int r = 0; r < _route_count; ++r)
+        {
+            if (_sources[r] == source && _destinations[r] == destination)
+            {
+                _depths[r] = depth;
+            }
+        }
+        return true;
+    }
+
+    void reset() override
+    {
+        _clear_outputs();
+        _primed.fill(false);
+        _ramps_valid = false;
+    }
+
+    void render() override
+    {
+        std::array<float, max_routes> mods{};
+        for (int r = 0; r < _route_count; ++r)
+        {
+            int source = _sources[r];
+            mods[r] = source < ctrl_sources ? this_template::_ctrl_value(source) :
+                                              this_template::_input_buffer(source - ctrl_sources)[PROC_BLOCK_SIZE - 1];
+        }
+        /* Curve and depth of all routes */
+        for (int r = 0; r < _route_count; ++r)
+        {
+            float x = mods[r];
+            mods[r] = _depths[r] * (_c0[r] + x * (_c1[r] + _c2[r] * std::abs(x) + _c3[r] * x * x));
+        }
+        if (!_ramps_valid)
+        {
+            for (int r = 0; r < _route_count; ++r)
+            {
+                if (!_primed[r])
+                {
+                    _prev_mods[r] = mods[r];
+                    _prev_depths[r] = _depths[r];
+                    _primed[r] = true;
+                }
+            }
+            _ramps_valid = true;
+        }
+
+        /* Rows typically have 1 or 2 routes, so they are summed in a single
+         * pass over the routes rather than with a loop per row */
+        float sum = 0.0f;
+        for (int r = 0, row = 0; row < _ctrl_rows; ++r)
+        {
+            sum += mods[r];
+            if (r + 1 == _row_start[row + 1])
+            {
+                this_template::_set_ctrl_value(_row_dest[row++], sum);
+                sum = 0.0f;
+            }
+        }
+
+        for (int row = _ctrl_rows; row < _rows; ++row)
+        {
+            auto& audio_out = this_template::_output_buffer(_row_dest[row] - ctrl_dests);
+            audio_out.fill(0.0f);
+            for (int r = _row_start[row]; r < _row_start[row + 1]; ++r)
+            {
+                if (_sources[r] < ctrl_sources)
+                {
+                    _add_ramp(audio_out, _prev_mods[r], mods[r]);
+                }
+                else
+                {
+                    _add_audio_route(audio_out, this_template::_input_buffer(_sources[r] - ctrl_sources), r);
+                }
+            }
+        }
+        std::copy(mods.begin(), mods.begin() + _route_count, _prev_mods.begin());
+        std::copy(_depths.begin(), _depths.begin() + _route_count, _prev_depths.begin());
+    }
+
+private:
+    /* Curves as coefficients of c0 + c1 * x + c2 * x * |x| + c3 * x^3 */
+    static constexpr std::array<std::array<float, 4>, 5> CURVE_COEFFS = {{{0.0f, 1.0f, 0.0f, 0.0f},
+                                                                          {-1.0f, 2.0f, 0.0f, 0.0f},
+                                                                          {1.0f, -1.0f, 0.0f, 0.0f},
+                                                                          {0.0f, 0.0f, 1.0f, 0.0f},
+                                                                          {0.0f, 0.0f, 0.0f, 1.0f}}};
+
+    typename std::array<Route, max_routes>::iterator _find_route(int source, int destination)
+    {
+        return std::find_if(_routes.begin(), _routes.begin() + _route_count, [&](const Route& r)
+        {
+            return r.source == source && r.destination == destination;
+        });
+    }
+
+    static void _add_ramp(AudioBuffer& audio_out, float start, float end)
+    {
+        float step = (end - start) / PROC_BLOCK_SIZE;
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            audio_out[i] += start + step * static_cast<float>(i + 1);
+        }
+    }
+
+    void _add_audio_route(AudioBuffer& audio_out, const AudioBuffer& audio_in, int r)
+    {
+        float depth = _prev_depths[r];
+        float step = (_depths[r] - depth) / PROC_BLOCK_SIZE;
+        float c0 = _c0[r];
+        float c1 = _c1[r];
+        float c2 = _c2[r];
+        float c3 = _c3[r];
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            float x = audio_in[i];
+            float d = depth + step * static_cast<float>(i + 1);
+            audio_out[i] += d * (c0 + x * (c1 + c2 * std::abs(x) + c3 * x * x));
+        }
+    }
+
+    void _clear_outputs()
+    {
+        for (int i = 0; i < ctrl_dests; ++i)
+        {
+            this_template::_set_ctrl_value(i, 0.0f);
+        }
+        for (int i = 0; i < audio_dests; ++i)
+        {
+            /* Routes may be set up before the outputs are connected */
+            if (this_template::audio_output(i))
+            {
+                this_template::_output_buffer(i).fill(0.0f);
+            }
+        }
+    }
+
+    void _build_tables()
+    {
+        std::array<int, max_routes> order;
+        for (int r = 0; r < _route_count; ++r)
+        {
+            order[r] = r;
+        }
+        /* Stable insertion sort, std::stable_sort may allocate a temporary buffer */
+        for (int i = 1; i < _route_count; ++i)
+        {
+            int index = order[i];
+            int j = i;
+            for (; j > 0 && _routes[order[j - 1]].destination > _routes[index].destination; --j)
+            {
+                order[j] = order[j - 1];
+            }
+            order[j] = index;
+        }
+
+        /* Ramp state of the previous tables, to carry over to routes that are kept */
+        int prev_count = _row_start[_rows];
+        auto prev_sources = _sources;
+        auto prev_destinations = _destinations;
+        auto prev_mods = _prev_mods;
+        auto prev_depths = _prev_depths;
+        auto prev_primed = _primed;
+
+        _rows = 0;
+        _ctrl_rows = 0;
+        for (int r = 0; r < _route_count; ++r)
+        {
+            const auto& route = _routes[order[r]];
+            const auto& coeffs = CURVE_COEFFS[static_cast<int>(route.curve)];
+            _sources[r] = route.source;
+            _destinations[r] = route.destination;
+            _depths[r] = route.depth;
+            _c0[r] = coeffs[0];
+            _c1[r] = coeffs[1];
+            _c2[r] = coeffs[2];
+            _c3[r] = coeffs[3];
+            _primed[r] = false;
+            for (int p = 0; p < prev_count; ++p)
+            {
+                if (prev_sources[p] == route.source && prev_destinations[p] == route.destination)
+                {
+                    _prev_mods[r] = prev_mods[p];
+                    _prev_depths[r] = prev_depths[p];
+                    _primed[r] = prev_primed[p];
+                    break;
+                }
+            }
+            if (_rows == 0 || _row_dest[_rows - 1] != route.destination)
+            {
+                _row_dest[_rows] = route.destination;
+                _row_start[_rows] = r;
+                _ctrl_rows += route.destination < ctrl_dests ? 1 : 0;
+                _rows++;
+            }
+        }
+        _row_start[_rows] = _route_count;
+        _clear_outputs();
+        _ramps_valid = std::all_of(_primed.begin(), _primed.begin() + _route_count, [](bool primed) {return primed;});
+    }
+
+    std::array<Route, max_routes>   _routes;
+    int                             _route_count{0};
+
+    /* Routes sorted by destination, as structure of arrays */
+    std::array<int, max_routes>     _sources{};
+    std::array<int, max_routes>     _destinations{};
+    std::array<float, max_routes>   _depths{};
+    std::array<float, max_routes>   _prev_depths{};
+    std::array<float, max_routes>   _prev_mods{};
+    std::array<float, max_routes>   _c0{};
+    std::array<float, max_routes>   _c1{};
+    std::array<float, max_routes>   _c2{};
+    std::array<float, max_routes>   _c3{};
+    /* Routes with a valid _prev_mods and _prev_depths, false for new routes */
+    std::array<bool, max_routes>    _primed{};
+    bool                            _ramps_valid{false};
+
+    /* One row per destination with routes, control destinations first */
+    std::array<int, max_routes>     _row_dest{};
+    std::array<int, max_routes + 1> _row_start{};
+    int                             _rows{0};
+    int                             _ctrl_rows{0};
+};
 }// namespace bricks
 
 #endif //BRICKS_DSP_UTILITY_BRICKS_H
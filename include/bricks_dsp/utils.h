@@ -1,6 +1,11 @@
 #ifndef BRICKS_DSP_UTILS_H
 #define BRICKS_DSP_UTILS_H
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <cstdint>
+#include <utility>
 
 #include "aligned_array.h"
 
@@ -62,6 +67,30 @@ inline float from_db_approx(float db)
     return std::cbrt(db);
 }
 
+/* Polynomial approximation of 2^x, with a relative error below 1e-6, that
+ * unlike powf and exp2f vectorises. x is clamped to the normal float range */
+inline float exp2_approx(float x)
+{
+    x = std::min(std::max(x, -126.0f), 127.0f);
+    float xi = std::floor(x);
+    float f = x - xi;
+    float p = 1.0f + f * (0.693151363f + f * (0.240164153f + f * (0.0558004476f + f * (0.00901668699f + f * 0.00186718313f))));
+    auto scale = std::bit_cast<float>((static_cast<int32_t>(xi) + 127) << 23);
+    return p * scale;
+}
+
+/* Polynomial approximation of sin(2 pi phase) for phase in [0, 1], with an
+ * error below 1e-6, that vectorises */
+inline float sin_2pi_approx(float phase)
+{
+    /* sin(2 pi phase) = -sin(2 pi t) for t in [-0.5, 0.5], which is folded
+     * into [-0.25, 0.25] where the polynomial is fitted */
+    float t = phase - 0.5f;
+    float z = std::abs(t) > 0.25f ? std::copysign(0.5f, t) - t : t;
+    float z2 = z * z;
+    return -z * (6.28316756f + z2 * (-41.3375176f + z2 * (81.3516777f + z2 * -71.0873581f)));
+}
+
 /* clamp/clip a value between min and max. With -ffast-math this seems to
  * compile to branchless and very efficient code for use on an audio buffer
  * Same as std::clamp, but faster with clang for some weird reason */
@@ -78,22 +107,228 @@ inline float clamp(const float& x, const float& min, const float& max)
     return x;
 }
 
-/* Linear interpolations over N samples */
+/* Flush very small values to 0. Used on filter and feedback states in bricks
+ * when building with BRICKS_DSP_DENORMAL_SAFE, for targets where denormals
+ * can't be flushed in hardware with ScopedDenormalGuard. Otherwise a no-op */
+template <typename T>
+inline T flush_denormal(T x)
+{
+#ifdef BRICKS_DSP_DENORMAL_SAFE
+    /* -300 dB, well above the denormal range but far below anything audible */
+    constexpr T DENORMAL_THRESHOLD = static_cast<T>(1.0e-15);
+    return std::abs(x) < DENORMAL_THRESHOLD ? static_cast<T>(0) : x;
+#else
+    return x;
+#endif
+}
+
+/* Fill count samples with a linear ramp that starts one increment after
+ * start, i.e. continues from a previous sample with the value start.
+ * Returns the value of the last sample */
+template <typename T>
+inline T fill_linear_ramp(T* dest, int count, T start, T inc)
+{
+    for (int i = 0; i < count; ++i)
+    {
+        dest[i] = start + inc * static_cast<T>(i + 1);
+    }
+    return start + inc * static_cast<T>(count);
+}
+
+/* Number of inputs summed per pass over the output in the mix kernels below */
+constexpr int MIX_TILE = 4;
+
+/* Sums the inputs in the index sequence into dest, each multiplied with a gain
+ * that ramps linearly from start + step to start + step * length, like
+ * fill_linear_ramp(). The inputs are unrolled with a fold expression and
+ * copied to locals, so that the loop vectorises over the samples */
+template <int length, bool accumulate, size_t... k>
+inline void mix_ramped_tile(float* dest, const float* const* inputs, const float* start, const float* step,
+                            std::index_sequence<k...>)
+{
+    std::array<const float*, sizeof...(k)> in = {inputs[k]...};
+    std::array<float, sizeof...(k)> gain = {start[k]...};
+    std::array<float, sizeof...(k)> inc = {step[k]...};
+    for (int i = 0; i < length; ++i)
+    {
+        float n = static_cast<float>(i + 1);
+        float sum = ((in[k][i] * (gain[k] + inc[k] * n)) + ...);
+        dest[i] = accumulate ? dest[i] + sum : sum;
+    }
+}
+
+/* Mix count, at most MIX_TILE, inputs in one pass */
+template <int length, bool accumulate>
+inline void mix_ramped_tile(float* dest, const float* const* inputs, const float* start, const float* step, int count)
+{
+    switch (count)
+    {
+        case 4:
+            mix_ramped_tile<length, accumulate>(dest, inputs, start, step, std::make_index_sequence<4>());
+            break;
+        case 3:
+            mix_ramped_tile<length, accumulate>(dest, inputs, start, step, std::make_index_sequence<3>());
+            break;
+        case 2:
+            mix_ramped_tile<length, accumulate>(dest, inputs, start, step, std::make_index_sequence<2>());
+            break;
+        case 1:
+            mix_ramped_tile<length, accumulate>(dest, inputs, start, step, std::make_index_sequence<1>());
+            break;
+        default:
+            if constexpr (!accumulate)
+            {
+                std::fill(dest, dest + length, 0.0f);
+            }
+    }
+}
+
+/* Mix count buffers of length samples into dest with linearly ramped gains.
+ * The gains are computed from the sample index rather than accumulated, so
+ * there is no dependency between samples, and inputs are summed MIX_TILE at
+ * a time, so that dest is loaded and stored once per tile instead of once per
+ * input. If accumulate is false, dest is overwritten */
 template <int length>
-class LinearInterpolator
+inline void mix_ramped(float* dest, const float* const* inputs, const float* start, const float* step,
+                       int count, bool accumulate = false)
+{
+    static_assert(MIX_TILE == 4, "Tile sizes above are hardcoded");
+    int k = 0;
+    if (!accumulate)
+    {
+        k = std::min(count, MIX_TILE);
+        mix_ramped_tile<length, false>(dest, inputs, start, step, k);
+    }
+    for (; k < count; k += MIX_TILE)
+    {
+        mix_ramped_tile<length, true>(dest, inputs + k, start + k, step + k, std::min(count - k, MIX_TILE));
+    }
+}
+
+/* Same as mix_ramped_tile() but with separate gains for a left and a right output */
+template <int length, bool accumulate, size_t... k>
+inline void mix_ramped_stereo_tile(float* left, float* right, const float* const* inputs,
+                                   const float* left_start, const float* left_step,
+                                   const float* right_start, const float* right_step, std::index_sequence<k...>)
+{
+    std::array<const float*, sizeof...(k)> in = {inputs[k]...};
+    std::array<float, sizeof...(k)> left_gain = {left_start[k]...};
+    std::array<float, sizeof...(k)> left_inc = {left_step[k]...};
+    std::array<float, sizeof...(k)> right_gain = {right_start[k]...};
+    std::array<float, sizeof...(k)> right_inc = {right_step[k]...};
+    for (int i = 0; i < length; ++i)
+    {
+        float n = static_cast<float>(i + 1);
+        float left_sum = ((in[k][i] * (left_gain[k] + left_inc[k] * n)) + ...);
+        float right_sum = ((in[k][i] * (right_gain[k] + right_inc[k] * n)) + ...);
+        left[i] = accumulate ? left[i] + left_sum : left_sum;
+        right[i] = accumulate ? right[i] + right_sum : right_sum;
+    }
+}
+
+template <int length, bool accumulate>
+inline void mix_ramped_stereo_tile(float* left, float* right, const float* const* inputs,
+                                   const float* left_start, const float* left_step,
+                                   const float* right_start, const float* right_step, int count)
+{
+    switch (count)
+    {
+        case 4:
+            mix_ramped_stereo_tile<length, accumulate>(left, right, inputs, left_start, left_step,
+                                                       right_start, right_step, std::make_index_sequence<4>());
+            break;
+        case 3:
+            mix_ramped_stereo_tile<length, accumulate>(left, right, inputs, left_start, left_step,
+                                                       right_start, right_step, std::make_index_sequence<3>());
+            break;
+        case 2:
+            mix_ramped_stereo_tile<length, accumulate>(left, right, inputs, left_start, left_step,
+                                                       right_start, right_step, std::make_index_sequence<2>());
+            break;
+        case 1:
+            mix_ramped_stereo_tile<length, accumulate>(left, right, inputs, left_start, left_step,
+                                                       right_start, right_step, std::make_index_sequence<1>());
+            break;
+        default:
+            if constexpr (!accumulate)
+            {
+                std::fill(left, left + length, 0.0f);
+                std::fill(right, right + length, 0.0f);
+            }
+    }
+}
+
+/* Mix count mono buffers into a left and a right buffer, with separate
+ * linearly ramped gains for each side, see mix_ramped() */
+template <int length>
+inline void mix_ramped_stereo(float* left, float* right, const float* const* inputs,
+                              const float* left_start, const float* left_step,
+                              const float* right_start, const float* right_step, int count, bool accumulate = false)
+{
+    int k = 0;
+    if (!accumulate)
+    {
+        k = std::min(count, MIX_TILE);
+        mix_ramped_stereo_tile<length, false>(left, right, inputs, left_start, left_step, right_start, right_step, k);
+    }
+    for (; k < count; k += MIX_TILE)
+    {
+        mix_ramped_stereo_tile<length, true>(left, right, inputs + k, left_start + k, left_step + k,
+                                             right_start + k, right_step + k, std::min(count - k, MIX_TILE));
+    }
+}
+
+/* The powers ratio^1 .. ratio^length of a geometric series. Precomputed so
+ * that exponential curves can be rendered in closed form, as a + b * ratio^n,
+ * which vectorises, instead of with a recursion over the previous sample */
+template <int length>
+class GeometricSeries
 {
 public:
-    void set(float target) {_step = (target - _lag) / static_cast<float>(length);}
+    GeometricSeries() : GeometricSeries(1.0f) {}
 
-    float get() {return _lag += _step;};
+    explicit GeometricSeries(float ratio)
+    {
+        set_ratio(ratio);
+    }
 
-    AlignedArray<float, length> get_all()
+    void set_ratio(float ratio)
     {
-        AlignedArray<float, length> values;
-        for (auto& v : values)
+        float power = 1.0f;
+        for (auto& p : _powers)
         {
-            v = this->get();
+            power *= ratio;
+            p = power;
         }
+    }
+
+    /* Returns ratio^(n + 1) */
+    float operator[](int n) const {return _powers[n];}
+
+private:
+    AlignedArray<float, length> _powers;
+};
+
+/* Linear interpolations over N samples */
+template <int length, typename T = float>
+class LinearInterpolator
+{
+public:
+    void set(T target) {_step = (target - _lag) / static_cast<T>(length);}
+
+    T get() {return _lag += _step;};
+
+    /* Fill dest with the next length values, computed from the sample index
+     * rather than accumulated, so that it vectorises */
+    void get_all(AlignedArray<T, length>& dest)
+    {
+        _lag = fill_linear_ramp(dest.data(), length, _lag, _step);
+    }
+
+    AlignedArray<T, length> get_all()
+    {
+        AlignedArray<T, length> values;
+        get_all(values);
         return values;
     };
 
@@ -103,13 +338,13 @@ public:
         _step = 0;
     }
 
-    [[nodiscard]] float step() {return _step;}
+    [[nodiscard]] T step() {return _step;}
 
-    [[nodiscard]] bool moving() {return _step != 0.0f;};
+    [[nodiscard]] bool moving() {return _step != 0;};
 
 private:
-    float _lag{0};
-    float _step{0};
+    T _lag{0};
+    T _step{0};
 };
 
 /* 1 pole filtering over N samples */
@@ -117,17 +352,32 @@ template <int length>
 class OnePoleLag
 {
 public:
-    void set(float target) {_target = target;}
+    void set(float target)
+    {
+        _target = target;
+        _lag = flush_denormal(_lag);
+    }
 
     float get() {return _lag = COEFF_B0 * _target + COEFF_A0 * _lag;}
 
-    AlignedArray<float, length> get_all()
+    /* Fill dest with the next length values. The distance to the target decays
+     * as COEFF_A0^n, so a block is rendered in closed form from a table of the
+     * powers of COEFF_A0 instead of with the recursion in get() */
+    void get_all(AlignedArray<float, length>& dest)
     {
-        AlignedArray<float, length> values;
-        for (auto& v : values)
+        float target = _target;
+        float diff = _lag - target;
+        for (int i = 0; i < length; ++i)
         {
-            v = this->get();
+            dest[i] = target + diff * POWERS[i];
         }
+        _lag = dest[length - 1];
+    }
+
+    AlignedArray<float, length> get_all()
+    {
+        AlignedArray<float, length> values;
+        get_all(values);
         return values;
     };
 
@@ -148,6 +398,18 @@ static constexpr float COEFF_B0 = 1 - COEFF_A0;
 static constexpr float COEFF_A0 = 1.0f - TIMECONSTANTS_PER_BLOCK / length;
 static constexpr float COEFF_B0 = 1.0f - COEFF_A0;
 #endif
+/* COEFF_A0^1 .. COEFF_A0^length */
+static constexpr std::array<float, length> POWERS = []()
+{
+    std::array<float, length> powers{};
+    float power = 1.0f;
+    for (auto& p : powers)
+    {
+        power *= COEFF_A0;
+        p = power;
+    }
+    return powers;
+}();
 
     float _target{0};
     float _lag{0};
@@ -350,6 +612,9 @@ public:
         return _reg;
     }
 
+    /* Call once per block when the stage is used in a decaying feedback path */
+    void flush_denormals() {_reg = flush_denormal(_reg);}
+
     void reset() {_reg = 0;}
 
 private:
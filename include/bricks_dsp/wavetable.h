@@ -0,0 +1,141 @@
+#ifndef BRICKS_DSP_WAVETABLE_H
+#define BRICKS_DSP_WAVETABLE_H
+
+#include <array>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace bricks {
+
+enum class BasicWaveform
+{
+    SAW,
+    PULSE,
+    TRIANGLE,
+    SINE
+};
+
+/* Band limited and mip mapped single cycle waveform. Level 0 has the most
+ * harmonics and the longest table, each following level has half the length
+ * and half the harmonics of the previous one. Every level is followed by a
+ * copy of its first sample so that linear interpolation can read one sample
+ * past the end without wrapping. Immutable once created. */
+class Wavetable
+{
+public:
+    static constexpr int LEVELS = 10;
+    static constexpr int BASE_LENGTH = 8192;
+
+    /* Highest harmonic + 1 included in each level. Halved and rounded half up
+     * from 1000, as the generator of the previously used tables did, so level 4
+     * has harmonics up to 62 */
+    static constexpr std::array<int, LEVELS> HARMONIC_LIMITS = {1000, 500, 250, 125, 63, 31, 16, 8, 4, 2};
+
+    /* Create a wavetable from the cosine and sine amplitudes of its harmonics,
+     * starting with the fundamental at index 0. Harmonics over the limit of each
+     * level are discarded */
+    Wavetable(const std::vector<float>& cos_amplitudes, const std::vector<float>& sin_amplitudes, float dc = 0.0f);
+
+    static constexpr int length(int level) {return BASE_LENGTH >> level;}
+
+    /* Pointer to length(level) + 1 samples */
+    const float* level(int level) const {return _data.data() + _offsets[level];}
+
+    /* Size of the table data in bytes */
+    int memory_size() const {return static_cast<int>(_data.size() * sizeof(float));}
+
+private:
+    std::array<int, LEVELS> _offsets;
+    std::vector<float>      _data;
+};
+
+/* Several wavetables, or frames, with the same mip map levels as Wavetable,
+ * for scanning between frames. Each level is stored with the frames interleaved
+ * so that sample i of frame f is at index i * frames() + f. Interpolating between
+ * 2 adjacent frames and 2 adjacent samples then reads 2 pairs of adjacent
+ * values instead of 4 values far apart. */
+class MorphWavetable
+{
+public:
+    /* Create from at least 2 wavetables */
+    explicit MorphWavetable(const std::vector<std::shared_ptr<const Wavetable>>& frames);
+
+    static constexpr int length(int level) {return Wavetable::length(level);}
+
+    int frames() const {return _frames;}
+
+    /* Pointer to (length(level) + 1) * frames() samples */
+    const float* level(int level) const {return _data.data() + _offsets[level];}
+
+    int memory_size() const {return static_cast<int>(_data.size() * sizeof(float));}
+
+private:
+    int                                 _frames;
+    std::array<int, Wavetable::LEVELS>  _offsets;
+    std::vector<float>                  _data;
+};
+
+/* Select the mip map level for a given pitch, using tables 1 or 2 octaves
+ * above the played note at lower samplerates to make sure they dont alias
+ * when interpolated */
+inline int wavetable_level(float pitch, float samplerate)
+{
+    int wt_shift = samplerate > 80000? 0 : samplerate > 40000? 1 : 2;
+    int level = static_cast<int>(pitch * 10) + wt_shift;
+    return level < 0 ? 0 : level > Wavetable::LEVELS - 1 ? Wavetable::LEVELS - 1 : level;
+}
+
+/* Global store of wavetables, shared between all oscillator instances. The
+ * basic waveforms are generated lazily the first time they are requested,
+ * which allocates memory, so request them before starting to render audio.
+ * User tables can be added under a name and are shared in the same way.
+ * All functions are thread safe, none are safe to call from the audio thread. */
+class WavetableStore
+{
+public:
+    static WavetableStore& instance();
+
+    std::shared_ptr<const Wavetable> get(BasicWaveform waveform);
+
+    /* Returns nullptr if no table with that name has been added */
+    std::shared_ptr<const Wavetable> get(const std::string& name);
+
+    /* Create a band limited table from one cycle of a waveform. length must be
+     * a power of 2. If a table with the same name exists it is replaced, but
+     * oscillators using the old table keep it until they change table */
+    std::shared_ptr<const Wavetable> add(const std::string& name, const float* cycle, int length);
+
+    /* Create a table from harmonic amplitudes, see Wavetable */
+    std::shared_ptr<const Wavetable> add(const std::string& name,
+                                         const std::vector<float>& cos_amplitudes,
+                                         const std::vector<float>& sin_amplitudes);
+
+    /* Frames morphing from sine through triangle and saw to pulse */
+    std::shared_ptr<const MorphWavetable> basic_morph();
+
+    /* Returns nullptr if no morph table with that name has been added */
+    std::shared_ptr<const MorphWavetable> get_morph(const std::string& name);
+
+    /* Create a morph table from frames cycles of length samples each, stored
+     * one after another in cycles. length must be a power of 2 */
+    std::shared_ptr<const MorphWavetable> add_morph(const std::string& name, const float* cycles, int length, int frames);
+
+    /* Remove all tables from the store, oscillators keep the tables they use */
+    void clear();
+
+private:
+    WavetableStore() = default;
+
+    std::mutex                                                      _mutex;
+    std::array<std::shared_ptr<const Wavetable>, 4>                 _basic_tables;
+    std::map<std::string, std::shared_ptr<const Wavetable>>         _user_tables;
+    std::shared_ptr<const MorphWavetable>                           _basic_morph;
+    std::map<std::string, std::shared_ptr<const MorphWavetable>>    _morph_tables;
+};
+
+} // namespace bricks
+
+#endif //BRICKS_DSP_WAVETABLE_H
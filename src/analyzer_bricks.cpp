@@ -0,0 +1,259 @@
+#include <cmath>
+
+#include "analyzer_bricks.h"
+
+namespace bricks {
+
+/* Capacity of the ring between the audio thread and process(), enough for
+ * a few hundred ms of audio so that a busy worker doesn't drop samples */
+constexpr int MIN_RING_CAPACITY = 16384;
+
+/* Polyphase coefficients for the true peak interpolator, a Blackman windowed
+ * sinc with the cutoff at the original nyquist frequency. Each phase is
+ * normalised to unity gain at dc */
+inline const std::array<std::array<float, TruePeakMeterBrick::TAPS_PER_PHASE>, TruePeakMeterBrick::OVERSAMPLING>& true_peak_coeffs()
+{
+    constexpr int PHASES = TruePeakMeterBrick::OVERSAMPLING;
+    constexpr int TAPS = TruePeakMeterBrick::TAPS_PER_PHASE;
+    static const auto coeffs = []()
+    {
+        std::array<std::array<float, TAPS>, PHASES> phases;
+        constexpr int LENGTH = PHASES * TAPS;
+        constexpr double CENTER = (LENGTH - 1) / 2.0;
+        for (int p = 0; p < PHASES; ++p)
+        {
+            double sum = 0;
+            for (int k = 0; k < TAPS; ++k)
+            {
+                int n = p + k * PHASES;
+                double x = (n - CENTER) / PHASES;
+                double sinc = std::sin(M_PI * x) / (M_PI * x);
+                double window = 0.42 - 0.5 * std::cos(2 * M_PI * (n + 0.5) / LENGTH) + 0.08 * std::cos(4 * M_PI * (n + 0.5) / LENGTH);
+                phases[p][k] = static_cast<float>(sinc * window);
+                sum += phases[p][k];
+            }
+            for (auto& coeff : phases[p])
+            {
+                coeff = static_cast<float>(coeff / sum);
+            }
+        }
+        return phases;
+    }();
+    return coeffs;
+}
+
+void TruePeakMeterBrick::reset()
+{
+    _history.fill(0.0f);
+    _max_peak = 0;
+    _set_ctrl_value(ControlOutput::TRUE_PEAK, 0.0f);
+    _set_ctrl_value(ControlOutput::MAX_TRUE_PEAK, 0.0f);
+}
+
+void TruePeakMeterBrick::render()
+{
+    constexpr int HISTORY = TAPS_PER_PHASE - 1;
+    const auto& coeffs = true_peak_coeffs();
+    const auto& in = _input_buffer(0);
+    std::copy(in.begin(), in.end(), _history.begin() + HISTORY);
+
+    /* Every phase is computed for the whole block, with the sample loop
+     * innermost so that it vectorises */
+    float peak = 0;
+    for (int p = 0; p < OVERSAMPLING; ++p)
+    {
+        AudioBuffer acc;
+        acc.fill(0.0f);
+        for (int k = 0; k < TAPS_PER_PHASE; ++k)
+        {
+            float coeff = coeffs[p][k];
+            const float* x = _history.data() + HISTORY - k;
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                acc[i] += coeff * x[i];
+            }
+        }
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            peak = std::max(peak, std::abs(acc[i]));
+        }
+    }
+    std::copy(_history.end() - HISTORY, _history.end(), _history.begin());
+
+    _max_peak = std::max(_max_peak, peak);
+    _set_ctrl_value(ControlOutput::TRUE_PEAK, peak);
+    _set_ctrl_value(ControlOutput::MAX_TRUE_PEAK, _max_peak);
+}
+
+SpectrumAnalyzerBrick::SpectrumAnalyzerBrick(int fft_size, int bands) : _fft_size(fft_size),
+                                                                         _hop_size(fft_size / 2),
+                                                                         _bands(std::clamp(bands, 1, MAX_BANDS)),
+                                                                         _ring(std::max(MIN_RING_CAPACITY, 4 * fft_size)),
+                                                                         _fft(fft_size)
+{
+    _window.resize(fft_size);
+    for (int i = 0; i < fft_size; ++i)
+    {
+        _window[i] = 0.5f * (1.0f - std::cos(2.0f * static_cast<float>(M_PI) * i / fft_size));
+    }
+    /* Scaled so that a full scale sine sums to 0 dB over the bins it leaks
+     * into, dividing by the equivalent noise bandwidth of the window */
+    float window_sum = 0;
+    float window_sq_sum = 0;
+    for (auto w : _window)
+    {
+        window_sum += w;
+        window_sq_sum += w * w;
+    }
+    float enbw = fft_size * window_sq_sum / (window_sum * window_sum);
+    _power_norm = 4.0f / (window_sum * window_sum * enbw);
+
+    _history.assign(fft_size, 0.0f);
+    _windowed.resize(fft_size);
+    _re.resize(_fft.bins());
+    _im.resize(_fft.bins());
+    _avg_power.assign(_fft.bins(), 0.0f);
+    set_samplerate(DEFAULT_SAMPLERATE);
+}
+
+void SpectrumAnalyzerBrick::set_samplerate(float samplerate)
+{
+    _samplerate = samplerate;
+    _band_freqs.resize(_bands);
+    _band_first.resize(_bands);
+    _band_last.resize(_bands);
+
+    float bin_width = samplerate / _fft_size;
+    float ratio = samplerate / 2.0f / MIN_FREQ;
+    for (int b = 0; b < _bands; ++b)
+    {
+        float low = MIN_FREQ * std::pow(ratio, static_cast<float>(b) / _bands);
+        float high = MIN_FREQ * std::pow(ratio, static_cast<float>(b + 1) / _bands);
+        _band_freqs[b] = std::sqrt(low * high);
+        int first = static_cast<int>(std::ceil(low / bin_width));
+        int last = std::min(static_cast<int>(std::ceil(high / bin_width)), _fft.bins());
+        if (first >= last)
+        {
+            /* Band narrower than an fft bin, use the nearest bin */
+            first = std::min(static_cast<int>(std::round(_band_freqs[b] / bin_width)), _fft.bins() - 1);
+            last = first + 1;
+        }
+        _band_first[b] = first;
+        _band_last[b] = last;
+    }
+}
+
+void SpectrumAnalyzerBrick::reset()
+{
+    _reset_request.store(_ring.write_position() + 1, std::memory_order_release);
+}
+
+void SpectrumAnalyzerBrick::render()
+{
+    _averaging.store(_ctrl_value(ControlInput::AVERAGING), std::memory_order_relaxed);
+    _ring.write(_input_buffer(0).data(), PROC_BLOCK_SIZE);
+}
+
+bool SpectrumAnalyzerBrick::process()
+{
+    bool published = false;
+    if (auto request = _reset_request.exchange(0, std::memory_order_acquire); request > 0)
+    {
+        _ring.discard_until(request - 1);
+        _clear_analysis();
+        published = true;
+    }
+    while (true)
+    {
+        /* New samples go in the last hop of the history */
+        float* dest = _history.data() + _fft_size - _hop_size + _hop_fill;
+        _hop_fill += _ring.read(dest, _hop_size - _hop_fill);
+        if (_hop_fill < _hop_size)
+        {
+            return published;
+        }
+        _analyse_frame();
+        std::copy(_history.begin() + _hop_size, _history.end(), _history.begin());
+        _hop_fill = 0;
+        published = true;
+    }
+}
+
+void SpectrumAnalyzerBrick::_clear_analysis()
+{
+    std::fill(_history.begin(), _history.end(), 0.0f);
+    std::fill(_avg_power.begin(), _avg_power.end(), 0.0f);
+    _hop_fill = 0;
+    auto& frame = _frames.write_slot();
+    std::fill(frame.begin(), frame.begin() + _bands, MIN_DB);
+    _frames.publish();
+}
+
+void SpectrumAnalyzerBrick::_analyse_frame()
+{
+    for (int i = 0; i < _fft_size; ++i)
+    {
+        _windowed[i] = _history[i] * _window[i];
+    }
+    _fft.forward(_windowed.data(), _re.data(), _im.data());
+
+    float averaging = std::clamp(_averaging.load(std::memory_order_relaxed), 0.0f, 1.0f) * 0.99f;
+    for (int k = 0; k < _fft.bins(); ++k)
+    {
+        float power = (_re[k] * _re[k] + _im[k] * _im[k]) * _power_norm;
+        _avg_power[k] = averaging * _avg_power[k] + (1.0f - averaging) * power;
+    }
+
+    auto& frame = _frames.write_slot();
+    float min_power = std::pow(10.0f, MIN_DB / 10.0f);
+    for (int b = 0; b < _bands; ++b)
+    {
+        float sum = 0;
+        for (int k = _band_first[b]; k < _band_last[b]; ++k)
+        {
+            sum += _avg_power[k];
+        }
+        frame[b] = 10.0f * std::log10(std::max(sum, min_power));
+    }
+    _frames.publish();
+}
+
+AnalyzerWorker::AnalyzerWorker(std::chrono::milliseconds interval) : _interval(interval),
+                                                                     _thread(&AnalyzerWorker::_run, this) {}
+
+AnalyzerWorker::~AnalyzerWorker()
+{
+    {
+        std::scoped_lock lock(_mutex);
+        _quit = true;
+    }
+    _quit_cond.notify_one();
+    _thread.join();
+}
+
+void AnalyzerWorker::add(SpectrumAnalyzerBrick* analyzer)
+{
+    std::scoped_lock lock(_mutex);
+    _analyzers.push_back(analyzer);
+}
+
+void AnalyzerWorker::remove(SpectrumAnalyzerBrick* analyzer)
+{
+    /* Analyzers are only processed with the mutex held, so it's not in use when this returns */
+    std::scoped_lock lock(_mutex);
+    _analyzers.erase(std::remove(_analyzers.begin(), _analyzers.end(), analyzer), _analyzers.end());
+}
+
+void AnalyzerWorker::_run()
+{
+    std::unique_lock lock(_mutex);
+    while (!_quit_cond.wait_for(lock, _interval, [&]() {return _quit;}))
+    {
+        for (auto analyzer : _analyzers)
+        {
+            analyzer->process();
+        }
+    }
+}
+
+} // namespace bricks
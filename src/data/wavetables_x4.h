@@ -1,6567 +0,0 @@
-#ifndef APOLLO_WAVETABLES_X4_H
-#define APOLLO_WAVETABLES_X4_H
-
-namespace wavetables {
-
-constexpr int offsets[] = {0, 8192, 12288, 14336, 15360, 15872, 16128, 16256, 16320, 16352, 16368};
-constexpr int lengths[] = {8192, 4096, 2048, 1024, 512, 256, 128, 64, 32, 16};
-
-constexpr float saw[] = 
-{0.0, 0.3708156, 0.6728922, 0.8604995, 0.9247449, 0.8930325, 0.8151184, 0.7422635, 0.7084537, 0.7211028, 
-0.7639612, 0.8094364, 0.8337152, 0.827586, 0.7986385, 0.7650139, 0.7448262, 0.7469606, 0.7676363, 0.7937985, 
-0.8108901, 0.8105953, 0.7945872, 0.7727213, 0.7571098, 0.7555187, 0.7676005, 0.7857139, 0.7995493, 0.8018331, 
-0.7920105, 0.7760878, 0.7629753, 0.7595074, 0.7668866, 0.7803706, 0.7921789, 0.7958728, 0.789769, 0.7775986, 
-0.7662014, 0.761654, 0.7660047, 0.776353, 0.7866613, 0.7911886, 0.7876068, 0.7781205, 0.7680692, 0.762879, 
-0.7650935, 0.7730999, 0.7821755, 0.7871932, 0.7854446, 0.778033, 0.7691292, 0.763574, 0.7641996, 0.7703452, 
-0.7783392, 0.7836164, 0.783255, 0.7775289, 0.7696546, 0.7639304, 0.7633387, 0.7679456, 0.7749521, 0.7803196, 
-0.7810297, 0.7767171, 0.7697956, 0.7640504, 0.7625142, 0.7658162, 0.7718994, 0.7772264, 0.7787688, 0.7756652, 
-0.7696411, 0.7639915, 0.7617234, 0.7639023, 0.7691115, 0.7742931, 0.7764768, 0.7744182, 0.7692468, 0.7637874, 
-0.7609606, 0.7621663, 0.766543, 0.7714939, 0.7741603, 0.7730084, 0.7686497, 0.7634577, 0.7602184, 0.7605799, 
-0.7641633, 0.7688136, 0.7718274, 0.7714607, 0.7678757, 0.7630143, 0.7594884, 0.7591208, 0.7619503, 0.7662432, 
-0.7694867, 0.7697952, 0.766944, 0.7624639, 0.7587616, 0.7577705, 0.759887, 0.7637775, 0.7671473, 0.7680294, 
-0.7658697, 0.7618106, 0.758029, 0.7565126, 0.7579598, 0.7614133, 0.7648182, 0.7661788, 0.7646656, 0.7610567, 
-0.7572816, 0.7553322, 0.7561567, 0.7591489, 0.7625085, 0.7642578, 0.7633427, 0.7602039, 0.7565105, 0.7542154, 
-0.754467, 0.7569827, 0.7602266, 0.7622797, 0.7619115, 0.7592535, 0.7557074, 0.7531493, 0.7528806, 0.7549133, 
-0.7579805, 0.7602573, 0.7603821, 0.7582072, 0.7548648, 0.7521213, 0.7513874, 0.7529389, 0.7557777, 0.7582027, 
-0.7587643, 0.7570669, 0.7539755, 0.7511196, 0.7499777, 0.7510573, 0.7536247, 0.7561275, 0.7570682, 0.7558353, 
-0.7530335, 0.7501329, 0.7486414, 0.7492655, 0.7515271, 0.7540428, 0.7553035, 0.7545155, 0.7520335, 0.7491506, 
-0.7473685, 0.7475599, 0.7494898, 0.7519588, 0.7534805, 0.7531117, 0.7509713, 0.7481626, 0.7461491, 0.7459361, 
-0.7475165, 0.7498852, 0.751609, 0.7516285, 0.7498436, 0.7471597, 0.744973, 0.744389, 0.7456097, 0.7478309, 
-0.7496992, 0.7500714, 0.7486484, 0.7461333, 0.7438303, 0.7429127, 0.7437712, 0.7458039, 0.747761, 0.7484467, 
-0.7473846, 0.7450759, 0.7427111, 0.7415008, 0.7420014, 0.7438113, 0.7458039, 0.746761, 0.7460523, 0.7439809, 
-0.7416061, 0.7401463, 0.7402996, 0.7418594, 0.7438375, 0.7450216, 0.7446525, 0.7428426, 0.7405059, 0.7388417, 
-0.7386645, 0.7399532, 0.7418706, 0.7432362, 0.7431874, 0.7416564, 0.7394019, 0.7375792, 0.7370933, 0.7380969, 
-0.7399116, 0.7414128, 0.7416599, 0.7404186, 0.738286, 0.7363507, 0.7355826, 0.7362934, 0.7379683, 0.7395594, 
-0.7400739, 0.7391269, 0.7371508, 0.735148, 0.734128, 0.7345447, 0.7360478, 0.7376842, 0.7384343, 0.7377798, 
-0.7359895, 0.733963, 0.7327247, 0.7328518, 0.7341563, 0.7357955, 0.7367462, 0.7363769, 0.7347964, 0.7327877, 
-0.7313668, 0.7312144, 0.7322994, 0.7339009, 0.7350157, 0.7349189, 0.7335664, 0.7316142, 0.7300482, 0.7296315, 
-0.7304814, 0.7320083, 0.7332491, 0.7334074, 0.7322955, 0.7304353, 0.7287623, 0.7281009, 0.728706, 0.7301246, 
-0.7314532, 0.7318448, 0.7309806, 0.729244, 0.7275023, 0.7266198, 0.7269758, 0.7282566, 0.7296349, 0.7302346, 
-0.7296196, 0.7280339, 0.7262612, 0.7251844, 0.7252924, 0.7264103, 0.7278012, 0.7285808, 0.7282114, 0.7267994, 
-0.7250321, 0.7237903, 0.7236563, 0.7245909, 0.725959, 0.7268881, 0.7267558, 0.7255356, 0.723808, 0.7224326, 
-0.7220675, 0.722803, 0.7241152, 0.7251617, 0.7252535, 0.7242383, 0.7225822, 0.7211058, 0.7205246, 0.7210503, 
-0.7222761, 0.7234072, 0.7237061, 0.7229043, 0.7213486, 0.7198042, 0.7190256, 0.7193357, 0.7204481, 0.7216305, 
-0.7221161, 0.7215311, 0.720101, 0.7185216, 0.7175679, 0.7176612, 0.7186366, 0.7198379, 0.7204866, 0.7201171, 
-0.7188343, 0.7172521, 0.7161478, 0.7160279, 0.7168468, 0.7180353, 0.7188214, 0.7186617, 0.7175437, 0.7159894, 
-0.7147614, 0.7144361, 0.715083, 0.7162289, 0.7171247, 0.717165, 0.716225, 0.7147275, 0.713404, 0.7128851, 
-0.713349, 0.7144245, 0.7154014, 0.7156281, 0.7148751, 0.7134607, 0.7120707, 0.7113736, 0.7116477, 0.7126279, 
-0.7136567, 0.7140526, 0.7134912, 0.7121835, 0.7107563, 0.7098994, 0.7099813, 0.7108442, 0.7118958, 0.7124412, 
-0.7120716, 0.710891, 0.7094552, 0.7084599, 0.7083511, 0.7090782, 0.7101242, 0.7107967, 0.7106153, 0.7095785, 
-0.7081621, 0.7070515, 0.7067579, 0.7073342, 0.7083474, 0.709123, 0.7091222, 0.7082422, 0.7068715, 0.7056704, 
-0.7052014, 0.7056157, 0.7065708, 0.7074241, 0.7075927, 0.7068788, 0.7055781, 0.7043123, 0.7036807, 0.7039257, 
-0.7047996, 0.7057045, 0.7060281, 0.7054857, 0.7042769, 0.7029725, 0.7021941, 0.7022666, 0.7030385, 0.7039689, 
-0.7044305, 0.7040609, 0.7029631, 0.7016463, 0.7007394, 0.7006397, 0.7012922, 0.7022222, 0.7028023, 0.7026033, 
-0.7016326, 0.7003286, 0.6993137, 0.699046, 0.6995646, 0.7004695, 0.7011468, 0.7011123, 0.7002815, 0.6990146, 
-0.6979137, 0.6974856, 0.6978593, 0.6987156, 0.6994674, 0.6995884, 0.6989067, 0.6976993, 0.6965355, 0.6959578, 
-0.696179, 0.6969653, 0.6977681, 0.6980323, 0.6975055, 0.6963782, 0.6951752, 0.6944615, 0.6945262, 0.6952231, 
-0.6960532, 0.6964456, 0.6960759, 0.6950467, 0.6938283, 0.6929947, 0.6929025, 0.6934932, 0.6943271, 0.6948305, 
-0.6946167, 0.693701, 0.6924904, 0.691555, 0.6913089, 0.6917795, 0.6925943, 0.6931897, 0.6931272, 0.6923373, 
-0.6911569, 0.6901396, 0.6897456, 0.6900854, 0.6908593, 0.6915263, 0.6916074, 0.6909527, 0.6898234, 0.688745, 
-0.6882124, 0.6884136, 0.6891265, 0.6898438, 0.690058, 0.6895444, 0.6884855, 0.6873676, 0.6867082, 0.6867665, 
-0.6874002, 0.6881461, 0.6884802, 0.6881105, 0.6871391, 0.6860035, 0.6852316, 0.6851458, 0.6856844, 0.6864371, 
-0.6868758, 0.6866497, 0.6857803, 0.6846486, 0.6837804, 0.6835525, 0.6839826, 0.6847211, 0.6852472, 0.6851611, 
-0.6844058, 0.6832987, 0.6823522, 0.6819871, 0.6822982, 0.6830021, 0.6835972, 0.6836445, 0.6830126, 0.6819497, 
-0.6809438, 0.6804495, 0.6806338, 0.6812842, 0.6819288, 0.6821005, 0.6815981, 0.6805974, 0.6795521, 0.6789389, 
-0.6789918, 0.6795716, 0.6802456, 0.6805301, 0.6801603, 0.6792381, 0.6781734, 0.6774542, 0.6773738, 0.6778678, 
-0.6785512, 0.6789346, 0.6786978, 0.6778682, 0.676804, 0.6759934, 0.675781, 0.6761764, 0.6768495, 0.6773163, 
-0.6772098, 0.6764843, 0.67544, 0.6745543, 0.674214, 0.6745004, 0.6751442, 0.6756776, 0.6756959, 0.6750835, 
-0.6740776, 0.6731342, 0.6726729, 0.6728426, 0.6734393, 0.6740212, 0.6741563, 0.6736635, 0.672713, 0.6717302, 
-0.671157, 0.6712051, 0.6717384, 0.6723504, 0.672592, 0.6722222, 0.6713426, 0.670339, 0.6696653, 0.6695896, 
-0.6700451, 0.6706686, 0.6710041, 0.6707581, 0.6699628, 0.6689571, 0.6681963, 0.6679975, 0.6683628, 0.6689792, 
-0.6693945, 0.6692704, 0.6685707, 0.667581, 0.666748, 0.6664293, 0.6666942, 0.6672858, 0.6677655, 0.6677585, 
-0.6671633, 0.666207, 0.6653179, 0.6648852, 0.6650422, 0.6655921, 0.6661195, 0.6662227, 0.6657383, 0.6648316, 
-0.6639033, 0.6633648, 0.6634088, 0.6639016, 0.6644595, 0.6646636, 0.6642938, 0.6634513, 0.6625012, 0.6618673, 
-0.6617957, 0.6622175, 0.6627886, 0.6630822, 0.6628282, 0.662063, 0.6611084, 0.6603912, 0.6602042, 0.6605431, 
-0.66111, 0.6614802, 0.6613406, 0.6606635, 0.6597216, 0.6589349, 0.6586351, 0.6588813, 0.6594271, 0.6598596, 
-0.6598305, 0.6592502, 0.6583375, 0.657496, 0.6570886, 0.6572344, 0.6577432, 0.6582227, 0.6582978, 0.6578208, 
-0.6569525, 0.6560721, 0.6555643, 0.6556046, 0.6560618, 0.6565721, 0.6567432, 0.6563733, 0.6555636, 0.6546605, 
-0.6540617, 0.6539937, 0.6543859, 0.6549107, 0.6551674, 0.6549063, 0.6541676, 0.6532582, 0.6525795, 0.652403, 
-0.6527186, 0.6532416, 0.6535721, 0.6534188, 0.6527616, 0.651862, 0.6511161, 0.6508331, 0.6510626, 0.6515679, 
-0.6519588, 0.6519101, 0.651343, 0.6504688, 0.6496696, 0.6492845, 0.6494204, 0.6498928, 0.6503298, 0.6503801, 
-0.6499096, 0.6490755, 0.6482376, 0.6477569, 0.647794, 0.6482195, 0.6486875, 0.6488294, 0.6484595, 0.6476788, 
-0.6468175, 0.6462499, 0.6461851, 0.6465509, 0.6470346, 0.6472586, 0.6469911, 0.646276, 0.6454067, 0.6447623, 
-0.6445951, 0.64489, 0.645374, 0.645669, 0.6455035, 0.6448641, 0.6440022, 0.6432927, 0.6430246, 0.6432393, 
-0.6437085, 0.6440622, 0.643996, 0.6434408, 0.642601, 0.6418394, 0.6414742, 0.6416013, 0.6420413, 0.6424403, 
-0.6424684, 0.6420038, 0.6412001, 0.6404001, 0.6399438, 0.6399779, 0.6403752, 0.6408054, 0.6409211, 0.6405512, 
-0.6397965, 0.6389726, 0.6384328, 0.6383709, 0.6387131, 0.6391601, 0.6393546, 0.6390815, 0.6383875, 0.6375542, 
-0.6369405, 0.6367815, 0.6370579, 0.637507, 0.6377702, 0.6375938, 0.6369704, 0.6361422, 0.6354654, 0.6352106, 
-0.6354121, 0.6358489, 0.6361692, 0.6360873, 0.6355427, 0.6347337, 0.634006, 0.6336587, 0.6337779, 0.6341886, 
-0.6345536, 0.6345618, 0.6341024, 0.633326, 0.6325602, 0.6321257, 0.6321573, 0.6325291, 0.6329253, 0.6330174, 
-0.6326475, 0.6319162, 0.631126, 0.6306113, 0.630552, 0.630873, 0.6312868, 0.6314549, 0.6311767, 0.6305017, 
-0.6297008, 0.6291147, 0.6289633, 0.629223, 0.6296405, 0.629875, 0.6296888, 0.6290797, 0.628282, 0.6276347, 
-0.627392, 0.6275815, 0.627989, 0.6282793, 0.6281832, 0.6276481, 0.6268671, 0.6261698, 0.6258387, 0.6259508, 
-0.6263352, 0.6266693, 0.6266595, 0.6262048, 0.6254532, 0.6247183, 0.6243035, 0.6243327, 0.6246815, 0.625047, 
-0.6251178, 0.6247479, 0.6240377, 0.6232779, 0.622786, 0.622729, 0.6230308, 0.6234146, 0.6235587, 0.6232759, 
-0.6226181, 0.6218466, 0.6212856, 0.621141, 0.6213855, 0.6217745, 0.621983, 0.6217879, 0.6211918, 0.6204217, 
-0.6198011, 0.6195694, 0.619748, 0.620129, 0.620392, 0.620283, 0.6197566, 0.6190008, 0.6183313, 0.6180149, 
-0.6181205, 0.6184809, 0.6187871, 0.6187609, 0.6183105, 0.6175814, 0.6168745, 0.6164777, 0.6165048, 0.6168327, 
-0.6171702, 0.6172216, 0.6168516, 0.6161608, 0.6154287, 0.6149574, 0.6149026, 0.6151868, 0.6155434, 0.6156656, 
-0.6153786, 0.6147365, 0.6139917, 0.6134535, 0.6133151, 0.6135459, 0.6139088, 0.6140937, 0.6138904, 0.6133062, 
-0.6125613, 0.6119651, 0.6117434, 0.6119121, 0.6122689, 0.6125069, 0.6123861, 0.6118677, 0.611135, 0.6104908, 
-0.6101878, 0.6102875, 0.610626, 0.6109067, 0.6108655, 0.610419, 0.6097104, 0.6090292, 0.6086488, 0.608674, 
-0.6089827, 0.6092947, 0.6093284, 0.6089584, 0.6082851, 0.6075783, 0.607126, 0.6070732, 0.6073414, 0.607673, 
-0.6077752, 0.6074844, 0.6068566, 0.6061363, 0.605619, 0.6054863, 0.6057044, 0.6060435, 0.6062067, 0.6059959, 
-0.6054226, 0.6047008, 0.6041269, 0.6039143, 0.6040739, 0.6044086, 0.6046238, 0.6044922, 0.6039811, 0.6032695, 
-0.6026486, 0.6023579, 0.6024521, 0.6027706, 0.6030278, 0.6029729, 0.60253, 0.6018403, 0.6011825, 0.6008171, 
-0.6008406, 0.6011318, 0.6014204, 0.6014378, 0.6010677, 0.6004106, 0.5997271, 0.5992921, 0.5992411, 0.5994946, 
-0.5998033, 0.5998872, 0.5995928, 0.5989782, 0.5982803, 0.5977822, 0.5976548, 0.5978613, 0.5981785, 0.5983217, 
-0.5981041, 0.5975408, 0.5968401, 0.5962868, 0.5960827, 0.5962339, 0.5965482, 0.5967424, 0.5966009, 0.5960964, 
-0.5954044, 0.5948047, 0.5945254, 0.5946146, 0.5949147, 0.5951503, 0.5950827, 0.5946432, 0.5939708, 0.5933347, 
-0.5929832, 0.593005, 0.5932801, 0.593547, 0.5935494, 0.5931793, 0.5925371, 0.591875, 0.591456, 0.5914067, 
-0.5916467, 0.5919342, 0.5920012, 0.5917035, 0.591101, 0.5904239, 0.5899436, 0.5898209, 0.5900167, 0.5903138, 
-0.5904386, 0.5902147, 0.5896605, 0.5889794, 0.5884451, 0.5882487, 0.5883923, 0.5886877, 0.5888625, 0.5887119, 
-0.5882135, 0.5875395, 0.5869596, 0.5866906, 0.5867753, 0.5870583, 0.587274, 0.5871948, 0.5867582, 0.5861019, 
-0.5854858, 0.5851471, 0.5851674, 0.5854276, 0.5856745, 0.5856631, 0.5852929, 0.5846645, 0.5840222, 0.583618, 
-0.5835702, 0.5837977, 0.5840657, 0.584117, 0.5838163, 0.5832251, 0.5825671, 0.5821032, 0.581985, 0.5821709, 
-0.5824492, 0.5825571, 0.5823272, 0.5817816, 0.5811187, 0.5806019, 0.5804127, 0.5805492, 0.5808272, 0.5809839, 
-0.5808249, 0.5803322, 0.5796748, 0.5791132, 0.578854, 0.5789343, 0.5792015, 0.5793988, 0.5793087, 0.578875, 
-0.5782335, 0.577636, 0.5773092, 0.5773281, 0.5775744, 0.5778028, 0.5777785, 0.5774083, 0.5767926, 0.5761688, 
-0.5757784, 0.575732, 0.5759479, 0.5761976, 0.5762345, 0.5759309, 0.5753501, 0.57471, 0.5742613, 0.5741473, 
-0.574324, 0.5745849, 0.5746769, 0.5744416, 0.573904, 0.5732578, 0.5727573, 0.5725749, 0.5727047, 0.5729665, 
-0.5731066, 0.5729396, 0.5724523, 0.5718103, 0.5712657, 0.5710155, 0.5710919, 0.5713445, 0.5715245, 0.5714243, 
-0.5709932, 0.5703656, 0.5697853, 0.5694696, 0.5694872, 0.5697207, 0.5699318, 0.5698955, 0.5695253, 0.5689215, 
-0.5683148, 0.5679372, 0.5678922, 0.5680972, 0.5683301, 0.5683533, 0.5680472, 0.5674761, 0.5668525, 0.566418, 
-0.5663079, 0.566476, 0.5667208, 0.566798, 0.5665577, 0.5660274, 0.5653969, 0.5649117, 0.5647355, 0.5648591, 
-0.5651058, 0.5652303, 0.565056, 0.5645735, 0.5639461, 0.5634173, 0.5631755, 0.5632482, 0.5634871, 0.5636511, 
-0.5635415, 0.5631128, 0.5624981, 0.5619339, 0.5616285, 0.561645, 0.5618664, 0.5620615, 0.562014, 0.5616437, 
-0.561051, 0.5604603, 0.5600946, 0.5600509, 0.5602458, 0.5604629, 0.5604735, 0.5601649, 0.5596028, 0.5589948, 
-0.5585736, 0.5584671, 0.5586272, 0.5588568, 0.5589203, 0.5586751, 0.5581518, 0.557536, 0.5570649, 0.5568946, 
-0.5570125, 0.5572451, 0.557355, 0.5571737, 0.5566959, 0.5560819, 0.555568, 0.5553341, 0.5554034, 0.5556294, 
-0.5557784, 0.55566, 0.5552336, 0.5546309, 0.5540819, 0.5537862, 0.5538015, 0.5540117, 0.5541916, 0.5541337, 
-0.5537634, 0.553181, 0.5526053, 0.5522508, 0.5522083, 0.5523938, 0.552596, 0.5525948, 0.5522839, 0.5517303, 
-0.5511368, 0.550728, 0.5506249, 0.5507776, 0.550993, 0.5510436, 0.550794, 0.550277, 0.549675, 0.5492173, 
-0.5490524, 0.5491649, 0.5493843, 0.5494805, 0.5492928, 0.5488193, 0.548218, 0.547718, 0.5474915, 0.5475575, 
-0.5477715, 0.5479064, 0.5477798, 0.5473555, 0.5467641, 0.5462292, 0.5459426, 0.5459569, 0.5461565, 0.5463223, 
-0.5462546, 0.5458842, 0.5453116, 0.5447499, 0.544406, 0.5443645, 0.5445411, 0.5447295, 0.5447172, 0.5444041, 
-0.5438585, 0.5432786, 0.5428815, 0.5427816, 0.5429272, 0.5431294, 0.5431677, 0.5429139, 0.5424031, 0.5418139, 
-0.5413688, 0.5412091, 0.5413165, 0.5415234, 0.5416068, 0.541413, 0.5409436, 0.5403542, 0.5398672, 0.5396477, 
-0.5397107, 0.5399134, 0.5400351, 0.5399006, 0.5394784, 0.5388976, 0.5383761, 0.538098, 0.5381113, 0.538301, 
-0.5384535, 0.5383765, 0.5380061, 0.5374426, 0.5368941, 0.5365601, 0.5365197, 0.536688, 0.5368633, 0.5368405, 
-0.5365253, 0.5359873, 0.5354202, 0.535034, 0.5349372, 0.5350762, 0.5352658, 0.5352928, 0.535035, 0.5345298, 
-0.5339528, 0.5335195, 0.5333646, 0.5334673, 0.5336625, 0.5337338, 0.5335343, 0.5330687, 0.5324905, 0.5320159, 
-0.5318029, 0.531863, 0.532055, 0.5321643, 0.5320225, 0.5316022, 0.5310314, 0.5305224, 0.5302523, 0.5302648, 
-0.5304451, 0.5305851, 0.5304993, 0.5301289, 0.529574, 0.529038, 0.5287133, 0.528674, 0.5288343, 0.5289973, 
-0.5289646, 0.5286475, 0.5281165, 0.5275616, 0.5271858, 0.5270918, 0.5272246, 0.5274024, 0.5274185, 0.527157, 
-0.5266572, 0.5260917, 0.5256695, 0.5255193, 0.5256174, 0.5258016, 0.5258614, 0.5256565, 0.5251945, 0.5246269, 
-0.5241639, 0.5239571, 0.5240145, 0.5241965, 0.524294, 0.5241453, 0.5237267, 0.5231655, 0.5226683, 0.5224058, 
-0.5224174, 0.5225889, 0.522717, 0.522623, 0.5222525, 0.5217058, 0.5211816, 0.5208657, 0.5208273, 0.5209803, 
-0.5211316, 0.5210896, 0.5207706, 0.5202463, 0.5197028, 0.5193368, 0.5192455, 0.5193724, 0.519539, 0.519545, 
-0.5192799, 0.5187852, 0.5182306, 0.5178189, 0.517673, 0.5177669, 0.5179406, 0.5179897, 0.5177796, 0.517321, 
-0.5167634, 0.5163114, 0.5161105, 0.5161654, 0.5163379, 0.5164242, 0.5162689, 0.515852, 0.5152997, 0.5148137, 
-0.5145585, 0.5145693, 0.5147324, 0.5148493, 0.5147475, 0.514377, 0.513838, 0.5133249, 0.5130174, 0.5129799, 
-0.5131258, 0.5132661, 0.5132152, 0.5128945, 0.5123766, 0.5118439, 0.5114872, 0.5113985, 0.5115197, 0.5116758, 
-0.5116721, 0.5114037, 0.5109138, 0.5103694, 0.5099677, 0.5098259, 0.5099158, 0.5100796, 0.5101184, 0.5099035, 
-0.5094481, 0.5089, 0.5084585, 0.5082631, 0.5083156, 0.508479, 0.5085548, 0.5083933, 0.507978, 0.5074342, 
-0.5069588, 0.5067105, 0.5067204, 0.5068756, 0.5069819, 0.5068727, 0.5065021, 0.5059705, 0.505468, 0.5051684, 
-0.5051317, 0.505271, 0.5054008, 0.5053415, 0.5050192, 0.5045072, 0.5039848, 0.5036369, 0.5035506, 0.5036666, 
-0.5038126, 0.5037997, 0.5035282, 0.5030428, 0.5025082, 0.502116, 0.5019781, 0.5020642, 0.5022186, 0.5022477, 
-0.5020281, 0.5015758, 0.5010367, 0.500605, 0.500415, 0.5004652, 0.5006201, 0.5006858, 0.5005184, 0.5001046, 
-0.4995688, 0.4991036, 0.4988617, 0.498871, 0.4990186, 0.4991148, 0.4989986, 0.4986279, 0.4981032, 0.4976108, 
-0.4973187, 0.4972829, 0.4974158, 0.4975357, 0.4974684, 0.4971445, 0.4966382, 0.4961256, 0.4957861, 0.4957021, 
-0.4958131, 0.4959495, 0.4959279, 0.4956533, 0.4951723, 0.4946469, 0.4942637, 0.4941296, 0.4942121, 0.4943575, 
-0.4943773, 0.4941534, 0.493704, 0.4931734, 0.4927512, 0.4925662, 0.4926142, 0.492761, 0.4928171, 0.4926441, 
-0.4922318, 0.4917037, 0.491248, 0.4910123, 0.4910209, 0.4911614, 0.491248, 0.491125, 0.4907543, 0.4902362, 
-0.4897534, 0.4894685, 0.4894335, 0.4895603, 0.4896708, 0.4895959, 0.4892705, 0.4887696, 0.4882663, 0.4879348, 
-0.487853, 0.4879592, 0.4880865, 0.4880566, 0.4877791, 0.4873022, 0.4867857, 0.4864111, 0.4862805, 0.4863595, 
-0.4864964, 0.4865074, 0.4862793, 0.4858327, 0.4853102, 0.4848971, 0.4847168, 0.4847628, 0.4849018, 0.4849488, 
-0.4847705, 0.4843595, 0.4838387, 0.4833922, 0.4831624, 0.4831703, 0.483304, 0.4833814, 0.4832521, 0.4828813, 
-0.4823695, 0.4818958, 0.4816177, 0.4815834, 0.4817046, 0.481806, 0.4817238, 0.481397, 0.4809013, 0.4804069, 
-0.480083, 0.4800033, 0.4801049, 0.4802236, 0.4801857, 0.4799054, 0.4794325, 0.4789244, 0.478558, 0.4784308, 
-0.4785065, 0.4786353, 0.4786379, 0.4784058, 0.4779618, 0.4774471, 0.4770425, 0.4768668, 0.4769108, 0.4770425, 
-0.4770808, 0.4768973, 0.4764876, 0.4759738, 0.4755361, 0.4753119, 0.4753192, 0.4754464, 0.4755151, 0.4753796, 
-0.4750088, 0.474503, 0.474038, 0.4737665, 0.4737329, 0.4738486, 0.4739414, 0.4738523, 0.473524, 0.4730333, 
-0.4725473, 0.4722307, 0.4721531, 0.4722503, 0.4723607, 0.4723153, 0.4720323, 0.4715632, 0.4710631, 0.4707045, 
-0.4705806, 0.4706532, 0.4707742, 0.4707688, 0.4705328, 0.4700913, 0.4695841, 0.4691877, 0.4690164, 0.4690585, 
-0.4691831, 0.4692131, 0.4690247, 0.4686162, 0.4681091, 0.4676797, 0.467461, 0.4674677, 0.4675887, 0.4676489, 
-0.4675076, 0.4671367, 0.4666367, 0.46618, 0.4659148, 0.4658819, 0.4659923, 0.4660769, 0.4659811, 0.4656516, 
-0.4651655, 0.4646877, 0.464378, 0.4643023, 0.4643954, 0.4644979, 0.4644452, 0.4641597, 0.4636941, 0.4632017, 
-0.4628507, 0.4627299, 0.4627995, 0.4629131, 0.4628999, 0.4626603, 0.4622212, 0.4617211, 0.4613325, 0.4611654, 
-0.4612058, 0.4613236, 0.4613457, 0.4611526, 0.4607453, 0.4602445, 0.4598231, 0.4596095, 0.4596157, 0.4597307, 
-0.459783, 0.459636, 0.4592651, 0.4587706, 0.4583219, 0.4580626, 0.4580304, 0.4581358, 0.4582125, 0.4581104, 
-0.4577796, 0.457298, 0.4568279, 0.456525, 0.4564511, 0.4565403, 0.4566351, 0.4565755, 0.4562876, 0.4558254, 
-0.4553404, 0.4549965, 0.4548787, 0.4549454, 0.4550519, 0.4550314, 0.4547882, 0.4543514, 0.4538582, 0.4534771, 
-0.453314, 0.4533527, 0.453464, 0.4534785, 0.4532809, 0.4528747, 0.45238, 0.4519663, 0.4517577, 0.4517633, 
-0.4518726, 0.4519172, 0.4517649, 0.4513939, 0.4509046, 0.4504636, 0.4502101, 0.4501786, 0.4502791, 0.4503482, 
-0.45024, 0.449908, 0.4494308, 0.4489681, 0.4486716, 0.4485995, 0.4486848, 0.4487724, 0.4487061, 0.4484158, 
-0.447957, 0.447479, 0.4471421, 0.4470271, 0.4470911, 0.4471908, 0.4471631, 0.4469166, 0.446482, 0.4459953, 
-0.4456214, 0.4454622, 0.4454992, 0.4456044, 0.4456115, 0.4454096, 0.4450044, 0.4445156, 0.4441093, 0.4439055, 
-0.4439106, 0.4440144, 0.4440516, 0.4438941, 0.4435231, 0.4430389, 0.4426052, 0.4423572, 0.4423263, 0.4424222, 
-0.4424841, 0.44237, 0.4420368, 0.4415637, 0.4411082, 0.4408178, 0.4407475, 0.4408291, 0.4409097, 0.440837, 
-0.4405445, 0.4400888, 0.4396177, 0.4392873, 0.4391751, 0.4392365, 0.4393296, 0.4392952, 0.4390454, 0.4386128, 
-0.4381324, 0.4377655, 0.43761, 0.4376455, 0.4377446, 0.4377447, 0.4375386, 0.4371345, 0.4366513, 0.4362521, 
-0.4360528, 0.4360575, 0.4361561, 0.4361861, 0.4360237, 0.4356526, 0.4351733, 0.4347466, 0.434504, 0.4344737, 
-0.4345652, 0.43462, 0.4345003, 0.4341659, 0.4336969, 0.4332483, 0.4329638, 0.4328951, 0.4329733, 0.4330471, 
-0.4329682, 0.4326735, 0.4322209, 0.4317563, 0.4314323, 0.4313228, 0.4313816, 0.4314684, 0.4314274, 0.4311745, 
-0.430744, 0.4302696, 0.4299094, 0.4297575, 0.4297914, 0.4298848, 0.4298782, 0.429668, 0.4292649, 0.4287872, 
-0.4283948, 0.4281999, 0.4282041, 0.4282976, 0.4283209, 0.4281536, 0.4277824, 0.4273078, 0.4268879, 0.4266505, 
-0.4266207, 0.426708, 0.4267561, 0.4266309, 0.4262955, 0.4258302, 0.4253882, 0.4251095, 0.4250424, 0.4251171, 
-0.4251845, 0.4250997, 0.4248029, 0.4243532, 0.4238949, 0.423577, 0.4234701, 0.4235264, 0.4236072, 0.4235599, 
-0.4233039, 0.4228754, 0.4224068, 0.4220531, 0.4219046, 0.4219371, 0.422025, 0.4220118, 0.4217978, 0.4213956, 
-0.4209231, 0.4205373, 0.4203466, 0.4203504, 0.420439, 0.4204557, 0.4202839, 0.4199126, 0.4194424, 0.4190292, 
-0.4187966, 0.4187675, 0.4188506, 0.4188922, 0.4187618, 0.4184253, 0.4179637, 0.4175282, 0.4172549, 0.4171894, 
-0.4172608, 0.417322, 0.4172314, 0.4169326, 0.4164857, 0.4160334, 0.4157215, 0.4156171, 0.4156711, 0.4157459, 
-0.4156926, 0.4154337, 0.415007, 0.4145441, 0.4141965, 0.4140514, 0.4140825, 0.414165, 0.4141456, 0.4139278, 
-0.4135266, 0.413059, 0.4126796, 0.4124931, 0.4124964, 0.4125804, 0.4125907, 0.4124144, 0.412043, 0.4115772, 
-0.4111703, 0.4109425, 0.4109139, 0.4109931, 0.4110284, 0.410893, 0.4105554, 0.4100974, 0.409668, 0.4094, 
-0.409336, 0.4094044, 0.4094595, 0.4093634, 0.4090626, 0.4086184, 0.408172, 0.4078658, 0.4077638, 0.4078155, 
-0.4078847, 0.4078255, 0.4075638, 0.4071389, 0.4066814, 0.4063398, 0.4061979, 0.4062277, 0.4063051, 0.4062795, 
-0.4060582, 0.4056578, 0.4051951, 0.4048218, 0.4046392, 0.4046422, 0.4047216, 0.4047258, 0.4045452, 0.4041738, 
-0.4037121, 0.4033113, 0.4030881, 0.4030601, 0.4031354, 0.4031647, 0.4030244, 0.4026858, 0.4022313, 0.4018078, 
-0.401545, 0.4014824, 0.4015477, 0.401597, 0.4014955, 0.4011929, 0.4007513, 0.4003105, 0.4000099, 0.3999102, 
-0.3999597, 0.4000235, 0.3999586, 0.3996941, 0.399271, 0.3988187, 0.3984829, 0.3983442, 0.3983727, 0.398445, 
-0.3984136, 0.3981888, 0.3977892, 0.3973312, 0.3969638, 0.3967851, 0.3967877, 0.3968627, 0.396861, 0.3966762, 
-0.3963047, 0.3958471, 0.3954522, 0.3952335, 0.395206, 0.3952776, 0.3953011, 0.395156, 0.3948165, 0.3943652, 
-0.3939475, 0.3936897, 0.3936285, 0.3936909, 0.3937346, 0.3936279, 0.3933234, 0.3928844, 0.3924491, 0.3921538, 
-0.3920563, 0.3921038, 0.3921622, 0.3920918, 0.3918247, 0.3914033, 0.390956, 0.3906259, 0.3904902, 0.3905174, 
-0.390585, 0.3905479, 0.3903196, 0.3899209, 0.3894674, 0.3891058, 0.3889308, 0.388933, 0.3890038, 0.3889963, 
-0.3888075, 0.3884359, 0.3879823, 0.387593, 0.3873787, 0.3873516, 0.3874197, 0.3874375, 0.3872879, 0.3869474, 
-0.3864994, 0.3860872, 0.3858342, 0.3857744, 0.3858339, 0.3858722, 0.3857605, 0.3854542, 0.3850176, 0.3845876, 
-0.3842975, 0.3842022, 0.3842476, 0.384301, 0.3842252, 0.3839556, 0.3835358, 0.3830934, 0.3827687, 0.3826359, 
-0.3826619, 0.3827249, 0.3826822, 0.3824507, 0.3820527, 0.3816037, 0.3812476, 0.3810762, 0.3810781, 0.3811447, 
-0.3811317, 0.380939, 0.3805673, 0.3801175, 0.3797338, 0.3795236, 0.3794971, 0.3795617, 0.379574, 0.3794199, 
-0.3790785, 0.3786336, 0.3782269, 0.3779785, 0.37792, 0.3779768, 0.3780098, 0.3778932, 0.3775853, 0.377151, 
-0.3767261, 0.3764411, 0.3763479, 0.3763913, 0.3764397, 0.3763588, 0.3760867, 0.3756684, 0.3752308, 0.3749114, 
-0.3747814, 0.3748063, 0.3748647, 0.3748167, 0.374582, 0.3741848, 0.37374, 0.3733893, 0.3732214, 0.3732229, 
-0.3732856, 0.3732672, 0.3730707, 0.372699, 0.3722528, 0.3718745, 0.3716683, 0.3716423, 0.3717036, 0.3717106, 
-0.3715522, 0.3712099, 0.370768, 0.3703665, 0.3701226, 0.3700655, 0.3701196, 0.3701474, 0.3700262, 0.3697165, 
-0.3692845, 0.3688646, 0.3685844, 0.3684933, 0.3685348, 0.3685785, 0.3684925, 0.368218, 0.3678012, 0.3673682, 
-0.3670539, 0.3669267, 0.3669505, 0.3670045, 0.3669513, 0.3667136, 0.366317, 0.3658764, 0.3655309, 0.3653664, 
-0.3653676, 0.3654265, 0.3654028, 0.3652026, 0.3648308, 0.3643882, 0.3640151, 0.3638129, 0.3637873, 0.3638453, 
-0.3638472, 0.3636846, 0.3633414, 0.3629024, 0.362506, 0.3622666, 0.3622107, 0.3622622, 0.3622851, 0.3621593, 
-0.361848, 0.3614182, 0.3610031, 0.3607277, 0.3606386, 0.3606782, 0.3607172, 0.3606264, 0.3603495, 0.3599342, 
-0.3595057, 0.3591963, 0.3590718, 0.3590945, 0.3591443, 0.3590861, 0.3588453, 0.3584495, 0.3580128, 0.3576724, 
-0.3575112, 0.3575121, 0.3575672, 0.3575384, 0.3573347, 0.3569628, 0.3565236, 0.3561556, 0.3559572, 0.3559322, 
-0.355987, 0.3559838, 0.3558172, 0.3554732, 0.355037, 0.3546455, 0.3544103, 0.3543557, 0.3544048, 0.3544228, 
-0.3542925, 0.3539796, 0.353552, 0.3531416, 0.3528708, 0.3527836, 0.3528215, 0.3528559, 0.3527604, 0.3524812, 
-0.3520673, 0.3516431, 0.3513386, 0.3512168, 0.3512384, 0.351284, 0.3512209, 0.3509772, 0.350582, 0.3501493, 
-0.3498138, 0.3496558, 0.3496564, 0.3497079, 0.3496742, 0.349467, 0.349095, 0.3486592, 0.3482961, 0.3481014, 
-0.3480768, 0.3481286, 0.3481206, 0.34795, 0.3476051, 0.3471717, 0.346785, 0.346554, 0.3465005, 0.3465472, 
-0.3465605, 0.3464259, 0.3461114, 0.3456859, 0.3452801, 0.3450137, 0.3449285, 0.3449646, 0.3449946, 0.3448945, 
-0.3446131, 0.3442006, 0.3437806, 0.3434808, 0.3433615, 0.3433821, 0.3434237, 0.3433558, 0.3431093, 0.3427148, 
-0.3422858, 0.3419551, 0.3418003, 0.3418006, 0.3418486, 0.34181, 0.3415994, 0.3412273, 0.3407948, 0.3404365, 
-0.3402455, 0.3402213, 0.3402701, 0.3402573, 0.3400829, 0.3397372, 0.3393065, 0.3389244, 0.3386975, 0.3386452, 
-0.3386895, 0.3386983, 0.3385594, 0.3382434, 0.3378199, 0.3374186, 0.3371566, 0.3370732, 0.3371076, 0.3371334, 
-0.3370287, 0.3367451, 0.336334, 0.3359181, 0.3356229, 0.3355061, 0.3355256, 0.3355634, 0.3354909, 0.3352415, 
-0.3348477, 0.3344224, 0.3340964, 0.3339446, 0.3339446, 0.3339891, 0.3339459, 0.333732, 0.3333598, 0.3329304, 
-0.3325768, 0.3323894, 0.3323657, 0.3324116, 0.3323942, 0.3322159, 0.3318694, 0.3314413, 0.3310639, 0.3308408, 
-0.3307897, 0.3308317, 0.330836, 0.330693, 0.3303756, 0.329954, 0.329557, 0.3292993, 0.3292177, 0.3292505, 
-0.3292721, 0.3291631, 0.3288773, 0.3284675, 0.3280556, 0.3277649, 0.3276505, 0.3276691, 0.327703, 0.327626, 
-0.3273739, 0.3269807, 0.326559, 0.3262375, 0.3260887, 0.3260885, 0.3261297, 0.3260819, 0.3258647, 0.3254925, 
-0.3250662, 0.3247171, 0.3245331, 0.3245099, 0.3245529, 0.324531, 0.3243491, 0.3240019, 0.3235763, 0.3232032, 
-0.3229841, 0.3229341, 0.3229738, 0.3229738, 0.3228268, 0.3225079, 0.3220883, 0.3216955, 0.3214419, 0.3213621, 
-0.3213933, 0.3214108, 0.3212975, 0.3210097, 0.3206011, 0.3201932, 0.3199067, 0.3197947, 0.3198124, 0.3198426, 
-0.3197612, 0.3195065, 0.3191138, 0.3186956, 0.3183786, 0.3182327, 0.3182323, 0.3182702, 0.3182179, 0.3179976, 
-0.3176252, 0.317202, 0.3168573, 0.3166767, 0.3166539, 0.3166942, 0.3166679, 0.3164824, 0.3161344, 0.3157113, 
-0.3153426, 0.3151272, 0.3150783, 0.3151158, 0.3151116, 0.3149607, 0.3146404, 0.3142226, 0.3138339, 0.3135844, 
-0.3135063, 0.313536, 0.3135495, 0.3134321, 0.3131422, 0.3127349, 0.3123307, 0.3120485, 0.3119388, 0.3119556, 
-0.3119822, 0.3118965, 0.3116392, 0.3112471, 0.3108323, 0.3105196, 0.3103766, 0.3103759, 0.3104106, 0.310354, 
-0.3101306, 0.3097581, 0.3093378, 0.3089975, 0.3088202, 0.3087978, 0.3088355, 0.3088049, 0.3086159, 0.3082671, 
-0.3078464, 0.3074819, 0.3072702, 0.3072223, 0.3072578, 0.3072494, 0.3070947, 0.306773, 0.306357, 0.3059723, 
-0.3057268, 0.3056504, 0.3056785, 0.3056882, 0.3055667, 0.3052749, 0.3048687, 0.3044683, 0.3041902, 0.3040828, 
-0.3040987, 0.3041218, 0.3040318, 0.303772, 0.3033805, 0.302969, 0.3026606, 0.3025203, 0.3025194, 0.302551, 
-0.3024902, 0.3022637, 0.3018912, 0.3014737, 0.3011376, 0.3009636, 0.3009416, 0.3009766, 0.3009418, 0.3007494, 
-0.3003999, 0.2999816, 0.2996212, 0.2994131, 0.2993663, 0.2993997, 0.2993873, 0.2992288, 0.2989057, 0.2984915, 
-0.2981108, 0.2978691, 0.2977944, 0.297821, 0.2978269, 0.2977014, 0.2974076, 0.2970027, 0.2966059, 0.2963319, 
-0.2962267, 0.2962417, 0.2962613, 0.2961673, 0.2959049, 0.2955139, 0.2951058, 0.2948015, 0.294664, 0.2946628, 
-0.2946914, 0.2946264, 0.294397, 0.2940243, 0.2936097, 0.2932777, 0.2931068, 0.2930853, 0.2931178, 0.2930789, 
-0.2928831, 0.2925328, 0.2921168, 0.2917604, 0.2915558, 0.2915101, 0.2915415, 0.2915251, 0.291363, 0.2910385, 
-0.2906261, 0.2902492, 0.2900113, 0.2899382, 0.2899634, 0.2899656, 0.2898362, 0.2895405, 0.2891367, 0.2887434, 
-0.2884734, 0.2883704, 0.2883846, 0.2884009, 0.2883028, 0.288038, 0.2876475, 0.2872425, 0.2869423, 0.2868075, 
-0.2868061, 0.2868317, 0.2867626, 0.2865303, 0.2861576, 0.2857457, 0.2854178, 0.28525, 0.2852288, 0.2852588, 
-0.2852159, 0.2850169, 0.2846659, 0.2842521, 0.2838997, 0.2836985, 0.2836538, 0.2836832, 0.283663, 0.2834972, 
-0.2831715, 0.2827608, 0.2823876, 0.2821534, 0.2820819, 0.2821057, 0.2821043, 0.2819711, 0.2816735, 0.2812708, 
-0.280881, 0.2806149, 0.280514, 0.2805274, 0.2805404, 0.2804383, 0.2801712, 0.2797812, 0.2793793, 0.2790831, 
-0.2789508, 0.2789493, 0.278972, 0.2788989, 0.2786638, 0.2782909, 0.2778817, 0.2775578, 0.277393, 0.2773723, 
-0.2773998, 0.277353, 0.2771507, 0.276799, 0.2763874, 0.2760389, 0.2758411, 0.2757974, 0.2758249, 0.2758009, 
-0.2756316, 0.2753046, 0.2748955, 0.274526, 0.2742955, 0.2742255, 0.274248, 0.274243, 0.2741061, 0.2738067, 
-0.273405, 0.2730186, 0.2727563, 0.2726575, 0.2726702, 0.2726799, 0.272574, 0.2723045, 0.271915, 0.2715161, 
-0.2712238, 0.2710941, 0.2710924, 0.2711122, 0.2710353, 0.2707974, 0.2704244, 0.2700178, 0.2696978, 0.269536, 
-0.2695156, 0.2695408, 0.2694901, 0.2692847, 0.2689323, 0.2685228, 0.2681781, 0.2679836, 0.2679409, 0.2679665, 
-0.2679388, 0.2677661, 0.2674378, 0.2670303, 0.2666644, 0.2664374, 0.266369, 0.2663901, 0.2663817, 0.2662411, 
-0.2659399, 0.2655393, 0.2651562, 0.2648977, 0.2648009, 0.2648128, 0.2648193, 0.2647096, 0.2644379, 0.2640489, 
-0.263653, 0.2633644, 0.2632373, 0.2632354, 0.2632524, 0.2631716, 0.262931, 0.262558, 0.2621539, 0.2618377, 
-0.2616788, 0.2616589, 0.2616817, 0.2616272, 0.2614187, 0.2610657, 0.2606583, 0.2603173, 0.260126, 0.2600843, 
-0.260108, 0.2600767, 0.2599006, 0.259571, 0.2591652, 0.2588028, 0.2585793, 0.2585125, 0.2585322, 0.2585204, 
-0.2583762, 0.2580732, 0.2576737, 0.2572939, 0.257039, 0.2569442, 0.2569554, 0.2569588, 0.2568454, 0.2565713, 
-0.2561828, 0.2557899, 0.2555051, 0.2553804, 0.2553783, 0.2553926, 0.2553081, 0.2550648, 0.2546916, 0.2542901, 
-0.2539776, 0.2538216, 0.2538021, 0.2538226, 0.2537644, 0.2535529, 0.2531991, 0.2527938, 0.2524564, 0.2522684, 
-0.2522276, 0.2522495, 0.2522146, 0.2520352, 0.2517044, 0.2513001, 0.2509412, 0.2507212, 0.2506558, 0.2506743, 
-0.250659, 0.2505114, 0.2502066, 0.2498081, 0.2494315, 0.2491802, 0.2490875, 0.2490978, 0.2490982, 0.2489812, 
-0.2487049, 0.2483168, 0.2479267, 0.2476456, 0.2475234, 0.2475211, 0.2475328, 0.2474446, 0.2471986, 0.2468253, 
-0.2464263, 0.2461175, 0.2459643, 0.2459451, 0.2459634, 0.2459016, 0.2456871, 0.2453326, 0.2449293, 0.2445955, 
-0.2444107, 0.2443708, 0.2443909, 0.2443526, 0.2441699, 0.2438379, 0.2434351, 0.2430796, 0.2428629, 0.242799, 
-0.2428163, 0.2427977, 0.2426466, 0.2423401, 0.2419426, 0.2415691, 0.2413214, 0.2412306, 0.2412403, 0.2412377, 
-0.241117, 0.2408386, 0.2404509, 0.2400637, 0.2397862, 0.2396663, 0.2396639, 0.2396729, 0.2395811, 0.2393325, 
-0.2389591, 0.2385625, 0.2382573, 0.2381069, 0.2380881, 0.2381042, 0.2380388, 0.2378214, 0.2374663, 0.2370649, 
-0.2367347, 0.2365529, 0.2365139, 0.2365323, 0.2364905, 0.2363046, 0.2359714, 0.2355701, 0.2352179, 0.2350046, 
-0.2349421, 0.2349582, 0.2349364, 0.2347819, 0.2344737, 0.2340771, 0.2337068, 0.2334625, 0.2333736, 0.2333826, 
-0.2333771, 0.2332529, 0.2329723, 0.2325851, 0.2322006, 0.2319266, 0.2318092, 0.2318066, 0.231813, 0.2317176, 
-0.2314665, 0.231093, 0.2306988, 0.2303971, 0.2302494, 0.2302311, 0.230245, 0.2301761, 0.2299557, 0.2296, 
-0.2292006, 0.2288737, 0.228695, 0.228657, 0.2286737, 0.2286285, 0.2284394, 0.228105, 0.2277052, 0.2273563, 
-0.2271463, 0.2270852, 0.2271, 0.2270751, 0.2269172, 0.2266074, 0.2262117, 0.2258444, 0.2256036, 0.2255166, 
-0.2255249, 0.2255165, 0.2253888, 0.2251061, 0.2247193, 0.2243375, 0.2240671, 0.223952, 0.2239492, 0.2239531, 
-0.2238542, 0.2236006, 0.2232269, 0.2228351, 0.2225369, 0.2223919, 0.2223739, 0.2223857, 0.2223133, 0.2220901, 
-0.2217337, 0.2213363, 0.2210128, 0.220837, 0.2208, 0.220815, 0.2207665, 0.2205743, 0.2202387, 0.2198403, 
-0.2194947, 0.2192878, 0.2192282, 0.2192418, 0.2192138, 0.2190526, 0.2187411, 0.2183464, 0.2179821, 0.2177446, 
-0.2176595, 0.2176671, 0.2176559, 0.2175248, 0.21724, 0.2168536, 0.2164745, 0.2162075, 0.2160947, 0.2160918, 
-0.2160932, 0.2159908, 0.2157347, 0.215361, 0.2149714, 0.2146766, 0.2145343, 0.2145167, 0.2145264, 0.2144506, 
-0.2142246, 0.2138676, 0.213472, 0.2131519, 0.2129791, 0.2129429, 0.2129562, 0.2129044, 0.2127092, 0.2123725, 
-0.2119755, 0.211633, 0.2114294, 0.2113711, 0.2113836, 0.2113525, 0.211188, 0.2108749, 0.2104811, 0.2101197, 
-0.2098856, 0.2098023, 0.2098093, 0.2097952, 0.2096608, 0.209374, 0.208988, 0.2086115, 0.2083479, 0.2082373, 
-0.2082343, 0.2082332, 0.2081275, 0.2078689, 0.207495, 0.2071077, 0.2068163, 0.2066766, 0.2066594, 0.206667, 
-0.206588, 0.2063592, 0.2060015, 0.2056077, 0.2052909, 0.205121, 0.2050857, 0.2050975, 0.2050424, 0.2048442, 
-0.2045063, 0.2041107, 0.2037714, 0.2035708, 0.203514, 0.2035253, 0.2034912, 0.2033235, 0.2030088, 0.2026159, 
-0.2022574, 0.2020265, 0.2019451, 0.2019514, 0.2019346, 0.2017969, 0.201508, 0.2011224, 0.2007485, 0.2004882, 
-0.2003799, 0.2003767, 0.2003732, 0.2002641, 0.2000032, 0.1996292, 0.1992441, 0.198956, 0.1988189, 0.1988021, 
-0.1988077, 0.1987253, 0.1984938, 0.1981354, 0.1977435, 0.1974299, 0.1972629, 0.1972285, 0.1972387, 0.1971805, 
-0.1969792, 0.1966402, 0.196246, 0.1959097, 0.1957123, 0.1956568, 0.195667, 0.1956299, 0.195459, 0.1951427, 
-0.1947507, 0.194395, 0.1941674, 0.1940878, 0.1940935, 0.194074, 0.193933, 0.1936421, 0.1932568, 0.1928855, 
-0.1926285, 0.1925224, 0.1925191, 0.1925132, 0.1924008, 0.1921375, 0.1917634, 0.1913805, 0.1910957, 0.1909611, 
-0.1909447, 0.1909483, 0.1908626, 0.1906284, 0.1902695, 0.1898793, 0.189569, 0.1894047, 0.1893712, 0.1893798, 
-0.1893185, 0.1891143, 0.1887742, 0.1883813, 0.1880481, 0.1878536, 0.1877995, 0.1878086, 0.1877686, 0.1875946, 
-0.1872767, 0.1868856, 0.1865327, 0.1863083, 0.1862304, 0.1862355, 0.1862133, 0.1860691, 0.1857762, 0.1853913, 
-0.1850225, 0.1847688, 0.1846648, 0.1846614, 0.1846532, 0.1845376, 0.1842719, 0.1838976, 0.1835169, 0.1832354, 
-0.1831033, 0.1830872, 0.1830889, 0.183, 0.1827631, 0.1824035, 0.1820151, 0.181708, 0.1815465, 0.1815139, 
-0.1815209, 0.1814565, 0.1812494, 0.1809082, 0.1805166, 0.1801864, 0.179995, 0.1799422, 0.1799502, 0.1799073, 
-0.1797302, 0.1794108, 0.1790205, 0.1786704, 0.1784491, 0.178373, 0.1783775, 0.1783527, 0.1782052, 0.1779104, 
-0.1775259, 0.1771595, 0.176909, 0.1768072, 0.1768037, 0.1767932, 0.1766743, 0.1764063, 0.1760319, 0.1756533, 
-0.175375, 0.1752454, 0.1752297, 0.1752294, 0.1751374, 0.1748979, 0.1745377, 0.174151, 0.1738469, 0.1736883, 
-0.1736565, 0.173662, 0.1735945, 0.1733846, 0.1730423, 0.172652, 0.1723247, 0.1721363, 0.1720848, 0.1720917, 
-0.172046, 0.1718658, 0.1715449, 0.1711554, 0.1708081, 0.1705899, 0.1705156, 0.1705194, 0.170492, 0.1703414, 
-0.1700446, 0.1696605, 0.1692966, 0.1690492, 0.1689495, 0.1689459, 0.1689332, 0.1688111, 0.1685408, 0.1681662, 
-0.1677897, 0.1675146, 0.1673875, 0.1673722, 0.16737, 0.1672748, 0.1670327, 0.1666719, 0.1662869, 0.1659859, 
-0.16583, 0.165799, 0.1658031, 0.1657326, 0.1655198, 0.1651764, 0.1647874, 0.164463, 0.1642775, 0.1642274, 
-0.1642333, 0.1641847, 0.1640015, 0.163679, 0.1632904, 0.1629457, 0.1627306, 0.162658, 0.1626613, 0.1626314, 
-0.1624776, 0.1621789, 0.1617951, 0.1614336, 0.1611894, 0.1610918, 0.1610881, 0.1610731, 0.1609479, 0.1606753, 
-0.1603006, 0.1599262, 0.1596542, 0.1595295, 0.1595146, 0.1595105, 0.1594122, 0.1591675, 0.1588061, 0.1584228, 
-0.1581249, 0.1579716, 0.1579415, 0.1579441, 0.1578707, 0.157655, 0.1573106, 0.1569228, 0.1566014, 0.1564188, 
-0.1563699, 0.1563748, 0.1563234, 0.1561372, 0.1558133, 0.1554254, 0.1550834, 0.1548713, 0.1548005, 0.1548032, 
-0.1547707, 0.1546139, 0.1543133, 0.1539298, 0.1535707, 0.1533296, 0.1532341, 0.1532303, 0.1532131, 0.1530847, 
-0.1528099, 0.1524351, 0.1520627, 0.1517938, 0.1516715, 0.1516569, 0.151651, 0.1515497, 0.1513024, 0.1509404, 
-0.1505587, 0.1502638, 0.1501133, 0.150084, 0.1500851, 0.1500087, 0.1497903, 0.1494448, 0.1490583, 0.1487397, 
-0.14856, 0.1485124, 0.1485162, 0.1484621, 0.148273, 0.1479475, 0.1475604, 0.1472211, 0.147012, 0.1469429, 
-0.146945, 0.14691, 0.1467502, 0.1464477, 0.1460645, 0.1457078, 0.1454697, 0.1453763, 0.1453724, 0.145353, 
-0.1452216, 0.1449445, 0.1445695, 0.1441991, 0.1439333, 0.1438134, 0.1437993, 0.1437915, 0.1436871, 0.1434374, 
-0.1430747, 0.1426947, 0.1424027, 0.1422548, 0.1422264, 0.1422261, 0.1421468, 0.1419256, 0.141579, 0.1411937, 
-0.140878, 0.1407011, 0.1406548, 0.1406576, 0.1406008, 0.1404088, 0.1400818, 0.1396955, 0.1393588, 0.1391527, 
-0.1390852, 0.1390868, 0.1390493, 0.1388865, 0.1385821, 0.1381992, 0.1378448, 0.1376099, 0.1375185, 0.1375145, 
-0.1374929, 0.1373585, 0.1370792, 0.136704, 0.1363356, 0.1360728, 0.1359553, 0.1359415, 0.1359319, 0.1358246, 
-0.1355723, 0.135209, 0.1348307, 0.1345417, 0.1343964, 0.1343688, 0.1343671, 0.1342849, 0.134061, 0.1337133, 
-0.1333292, 0.1330163, 0.1328422, 0.1327972, 0.132799, 0.1327395, 0.1325446, 0.1322161, 0.1318306, 0.1314965, 
-0.1312933, 0.1312275, 0.1312286, 0.1311887, 0.1310228, 0.1307166, 0.130334, 0.1299819, 0.12975, 0.1296606, 
-0.1296566, 0.1296328, 0.1294953, 0.1292139, 0.1288386, 0.1284722, 0.1282123, 0.1280972, 0.1280838, 0.1280724, 
-0.1279621, 0.1277073, 0.1273434, 0.1269667, 0.1266806, 0.1265379, 0.1265112, 0.126508, 0.126423, 0.1261963, 
-0.1258477, 0.1254648, 0.1251546, 0.1249833, 0.1249396, 0.1249404, 0.1248782, 0.1246804, 0.1243505, 0.1239657, 
-0.1236341, 0.1234339, 0.1233698, 0.1233703, 0.123328, 0.1231591, 0.1228511, 0.1224688, 0.122119, 0.12189, 
-0.1218027, 0.1217986, 0.1217727, 0.1216322, 0.1213486, 0.1209731, 0.1206087, 0.1203518, 0.120239, 0.120226, 
-0.1202128, 0.1200996, 0.1198423, 0.1194778, 0.1191027, 0.1188195, 0.1186794, 0.1186535, 0.118649, 0.1185611, 
-0.1183318, 0.117982, 0.1176003, 0.1172929, 0.1171244, 0.1170819, 0.1170818, 0.1170169, 0.1168163, 0.1164849, 
-0.1161009, 0.1157718, 0.1155745, 0.115512, 0.1155121, 0.1154673, 0.1152955, 0.1149856, 0.1146036, 0.1142561, 
-0.1140301, 0.1139448, 0.1139406, 0.1139126, 0.1137692, 0.1134833, 0.1131077, 0.1127452, 0.1124913, 0.1123808, 
-0.1123682, 0.1123532, 0.1122371, 0.1119774, 0.1116123, 0.1112387, 0.1109584, 0.1108208, 0.1107958, 0.1107899, 
-0.1106992, 0.1104672, 0.1101164, 0.1097359, 0.1094311, 0.1092654, 0.1092242, 0.1092231, 0.1091556, 0.1089522, 
-0.1086193, 0.1082361, 0.1079095, 0.1077151, 0.1076543, 0.1076538, 0.1076066, 0.1074319, 0.1071202, 0.1067385, 
-0.1063932, 0.1061701, 0.1060868, 0.1060826, 0.1060525, 0.1059061, 0.1056181, 0.1052423, 0.1048818, 0.1046308, 
-0.1045226, 0.1045104, 0.1044937, 0.1043746, 0.1041125, 0.1037467, 0.1033747, 0.1030972, 0.1029623, 0.102938, 
-0.1029308, 0.1028373, 0.1026027, 0.1022508, 0.1018714, 0.1015694, 0.1014065, 0.1013664, 0.1013645, 0.1012943, 
-0.1010881, 0.1007538, 0.1003712, 0.1000472, 0.0998556, 0.0997964, 0.0997954, 0.0997459, 0.0995683, 0.0992547, 
-0.0988734, 0.0985303, 0.0983101, 0.0982288, 0.0982245, 0.0981923, 0.0980431, 0.0977529, 0.097377, 0.0970183, 
-0.0967703, 0.0966643, 0.0966525, 0.0966341, 0.0965121, 0.0962476, 0.0958812, 0.0955108, 0.0952361, 0.0951037, 
-0.0950803, 0.0950717, 0.0949754, 0.0947381, 0.0943853, 0.094007, 0.0937077, 0.0935475, 0.0935087, 0.0935058, 
-0.0934331, 0.093224, 0.0928883, 0.0925065, 0.0921849, 0.0919962, 0.0919386, 0.0919371, 0.0918852, 0.0917047, 
-0.0913894, 0.0910083, 0.0906674, 0.0904501, 0.0903708, 0.0903664, 0.0903322, 0.09018, 0.0898878, 0.0895117, 
-0.0891549, 0.0889097, 0.0888061, 0.0887946, 0.0887745, 0.0886497, 0.0883827, 0.0880158, 0.0876468, 0.087375, 
-0.0872451, 0.0872225, 0.0872125, 0.0871136, 0.0868737, 0.0865198, 0.0861426, 0.085846, 0.0856884, 0.0856509, 
-0.0856471, 0.0855718, 0.08536, 0.0850228, 0.0846417, 0.0843225, 0.0841367, 0.0840807, 0.0840787, 0.0840245, 
-0.0838412, 0.083524, 0.0831432, 0.0828045, 0.0825901, 0.0825127, 0.0825083, 0.0824721, 0.082317, 0.0820226, 
-0.0816463, 0.0812914, 0.0810491, 0.0809478, 0.0809367, 0.0809149, 0.0807872, 0.0805179, 0.0801503, 0.0797829, 
-0.0795138, 0.0793864, 0.0793647, 0.0793534, 0.0792517, 0.0790092, 0.0786543, 0.0782783, 0.0779842, 0.0778294, 
-0.0777931, 0.0777883, 0.0777105, 0.0774959, 0.0771573, 0.0767769, 0.0764602, 0.0762771, 0.0762228, 0.0762203, 
-0.0761638, 0.0759776, 0.0756587, 0.0752781, 0.0749416, 0.0747301, 0.0746547, 0.0746502, 0.0746119, 0.074454, 
-0.0741575, 0.073781, 0.073428, 0.0731886, 0.0730894, 0.0730788, 0.0730552, 0.0729248, 0.0726531, 0.0722849, 
-0.0719189, 0.0716527, 0.0715278, 0.0715068, 0.0714943, 0.0713898, 0.0711447, 0.0707888, 0.0704139, 0.0701225, 
-0.0699703, 0.0699353, 0.0699296, 0.0698493, 0.0696319, 0.0692919, 0.0689122, 0.0685979, 0.0684176, 0.0683649, 
-0.068362, 0.0683031, 0.0681141, 0.0677934, 0.0674131, 0.0670787, 0.0668701, 0.0667966, 0.0667921, 0.0667518, 
-0.066591, 0.0662924, 0.0659158, 0.0655646, 0.065328, 0.0652311, 0.0652208, 0.0651956, 0.0650623, 0.0647883, 
-0.0644195, 0.064055, 0.0637915, 0.0636691, 0.063649, 0.0636351, 0.063528, 0.0632803, 0.0629233, 0.0625495, 
-0.0622607, 0.0621113, 0.0620774, 0.0620709, 0.061988, 0.0617679, 0.0614265, 0.0610474, 0.0607356, 0.0605581, 
-0.060507, 0.0605036, 0.0604425, 0.0602506, 0.0599281, 0.059548, 0.0592158, 0.05901, 0.0589385, 0.058934, 
-0.0588917, 0.058728, 0.0584273, 0.0580505, 0.0577011, 0.0574674, 0.0573727, 0.0573629, 0.057336, 0.0571999, 
-0.0569235, 0.0565541, 0.0561911, 0.0559303, 0.0558104, 0.0557911, 0.055776, 0.0556662, 0.0554159, 0.0550579, 
-0.0546852, 0.054399, 0.0542522, 0.0542195, 0.0542121, 0.0541267, 0.0539039, 0.0535611, 0.0531827, 0.0528732, 
-0.0526985, 0.052649, 0.0526451, 0.0525818, 0.0523871, 0.0520628, 0.051683, 0.0513529, 0.05115, 0.0510804, 
-0.0510758, 0.0510315, 0.0508651, 0.0505623, 0.0501853, 0.0498377, 0.0496068, 0.0495144, 0.0495049, 0.0494764, 
-0.0493375, 0.0490587, 0.0486887, 0.0483272, 0.0480692, 0.0479517, 0.0479332, 0.0479168, 0.0478043, 0.0475515, 
-0.0471924, 0.0468208, 0.0465372, 0.0463931, 0.0463617, 0.0463534, 0.0462655, 0.0460399, 0.0456957, 0.045318, 
-0.0450109, 0.044839, 0.0447911, 0.0447867, 0.0447211, 0.0445236, 0.0441975, 0.043818, 0.04349, 0.0432899, 
-0.0432222, 0.0432176, 0.0431714, 0.0430021, 0.0426972, 0.04232, 0.0419743, 0.0417461, 0.041656, 0.0416469, 
-0.0416168, 0.0414751, 0.041194, 0.0408233, 0.0404633, 0.040208, 0.040093, 0.0400753, 0.0400576, 0.0399425, 
-0.0396871, 0.039327, 0.0389565, 0.0386755, 0.0385339, 0.0385038, 0.0384946, 0.0384042, 0.038176, 0.0378303, 
-0.0374533, 0.0371486, 0.0369794, 0.0369331, 0.0369283, 0.0368604, 0.0366601, 0.0363323, 0.0359529, 0.0356271, 
-0.0354298, 0.0353641, 0.0353595, 0.0353113, 0.0351391, 0.0348322, 0.0344548, 0.0341109, 0.0338855, 0.0337976, 
-0.0337889, 0.0337571, 0.0336127, 0.0333292, 0.0329579, 0.0325994, 0.0323468, 0.0322343, 0.0322174, 0.0321985, 
-0.0320807, 0.0318227, 0.0314616, 0.0310921, 0.0308137, 0.0306748, 0.0306459, 0.0306358, 0.030543, 0.030312, 
-0.0299649, 0.0295885, 0.0292862, 0.0291198, 0.0290751, 0.0290699, 0.0289997, 0.0287967, 0.028467, 0.0280879, 
-0.0277642, 0.0275697, 0.0275059, 0.0275013, 0.0274511, 0.0272762, 0.0269671, 0.0265895, 0.0262474, 0.0260249, 
-0.0259392, 0.0259309, 0.0258975, 0.0257503, 0.0254645, 0.0250926, 0.0247354, 0.0244856, 0.0243755, 0.0243595, 
-0.0243393, 0.0242189, 0.0239583, 0.0235962, 0.0232278, 0.0229519, 0.0228157, 0.022788, 0.0227771, 0.0226817, 
-0.0224481, 0.0220995, 0.0217238, 0.0214239, 0.0212602, 0.0212171, 0.0212114, 0.0211391, 0.0209332, 0.0206018, 
-0.0202229, 0.0199013, 0.0197096, 0.0196478, 0.0196431, 0.019591, 0.0194133, 0.0191021, 0.0187243, 0.018384, 
-0.0181642, 0.0180807, 0.0180729, 0.0180379, 0.0178879, 0.0175997, 0.0172272, 0.0168715, 0.0166244, 0.0165168, 
-0.0165016, 0.0164801, 0.016357, 0.016094, 0.0157308, 0.0153634, 0.0150901, 0.0149565, 0.0149301, 0.0149183, 
-0.0148205, 0.0145842, 0.0142342, 0.0138591, 0.0135615, 0.0134006, 0.0133591, 0.013353, 0.0132784, 0.0130698, 
-0.0127366, 0.0123579, 0.0120384, 0.0118495, 0.0117896, 0.0117849, 0.0117309, 0.0115503, 0.0112371, 0.0108591, 
-0.0105206, 0.0103036, 0.0102223, 0.0102149, 0.0101782, 0.0100256, 0.009735, 0.0093619, 0.0090076, 0.0087632, 
-0.008658, 0.0086437, 0.008621, 0.0084952, 0.0082296, 0.0078654, 0.0074991, 0.0072283, 0.0070974, 0.0070721, 
-0.0070595, 0.0069593, 0.0067202, 0.0063688, 0.0059944, 0.0056992, 0.005541, 0.0055011, 0.0054946, 0.0054177, 
-0.0052063, 0.0048713, 0.0044929, 0.0041755, 0.0039894, 0.0039314, 0.0039268, 0.0038707, 0.0036874, 0.0033721, 
-0.0029939, 0.0026571, 0.0024429, 0.0023639, 0.0023569, 0.0023186, 0.0021632, 0.0018703, 0.0014965, 0.0011437, 
-0.0009019, 0.0007992, 0.0007858, 0.0007618, 0.0006334, 0.0003653, -0.0, -0.0003653, -0.0006334, -0.0007618, 
--0.0007858, -0.0007992, -0.0009019, -0.0011437, -0.0014965, -0.0018703, -0.0021632, -0.0023186, -0.0023569, -0.0023639, 
--0.0024429, -0.0026571, -0.0029939, -0.0033721, -0.0036874, -0.0038707, -0.0039268, -0.0039314, -0.0039894, -0.0041755, 
--0.0044929, -0.0048713, -0.0052063, -0.0054177, -0.0054946, -0.0055011, -0.005541, -0.0056992, -0.0059944, -0.0063688, 
--0.0067202, -0.0069593, -0.0070595, -0.0070721, -0.0070974, -0.0072283, -0.0074991, -0.0078654, -0.0082296, -0.0084952, 
--0.008621, -0.0086437, -0.008658, -0.0087632, -0.0090076, -0.0093619, -0.009735, -0.0100256, -0.0101782, -0.0102149, 
--0.0102223, -0.0103036, -0.0105206, -0.0108591, -0.0112371, -0.0115503, -0.0117309, -0.0117849, -0.0117896, -0.0118495, 
--0.0120384, -0.0123579, -0.0127366, -0.0130698, -0.0132784, -0.013353, -0.0133591, -0.0134006, -0.0135615, -0.0138591, 
--0.0142342, -0.0145842, -0.0148205, -0.0149183, -0.0149301, -0.0149565, -0.0150901, -0.0153634, -0.0157308, -0.016094, 
--0.016357, -0.0164801, -0.0165016, -0.0165168, -0.0166244, -0.0168715, -0.0172272, -0.0175997, -0.0178879, -0.0180379, 
--0.0180729, -0.0180807, -0.0181642, -0.018384, -0.0187243, -0.0191021, -0.0194133, -0.019591, -0.0196431, -0.0196478, 
--0.0197096, -0.0199013, -0.0202229, -0.0206018, -0.0209332, -0.0211391, -0.0212114, -0.0212171, -0.0212602, -0.0214239, 
--0.0217238, -0.0220995, -0.0224481, -0.0226817, -0.0227771, -0.022788, -0.0228157, -0.0229519, -0.0232278, -0.0235962, 
--0.0239583, -0.0242189, -0.0243393, -0.0243595, -0.0243755, -0.0244856, -0.0247354, -0.0250926, -0.0254645, -0.0257503, 
--0.0258975, -0.0259309, -0.0259392, -0.0260249, -0.0262474, -0.0265895, -0.0269671, -0.0272762, -0.0274511, -0.0275013, 
--0.0275059, -0.0275697, -0.0277642, -0.0280879, -0.028467, -0.0287967, -0.0289997, -0.0290699, -0.0290751, -0.0291198, 
--0.0292862, -0.0295885, -0.0299649, -0.030312, -0.030543, -0.0306358, -0.0306459, -0.0306748, -0.0308137, -0.0310921, 
--0.0314616, -0.0318227, -0.0320807, -0.0321985, -0.0322174, -0.0322343, -0.0323468, -0.0325994, -0.0329579, -0.0333292, 
--0.0336127, -0.0337571, -0.0337889, -0.0337976, -0.0338855, -0.0341109, -0.0344548, -0.0348322, -0.0351391, -0.0353113, 
--0.0353595, -0.0353641, -0.0354298, -0.0356271, -0.0359529, -0.0363323, -0.0366601, -0.0368604, -0.0369283, -0.0369331, 
--0.0369794, -0.0371486, -0.0374533, -0.0378303, -0.038176, -0.0384042, -0.0384946, -0.0385038, -0.0385339, -0.0386755, 
--0.0389565, -0.039327, -0.0396871, -0.0399425, -0.0400576, -0.0400753, -0.040093, -0.040208, -0.0404633, -0.0408233, 
--0.041194, -0.0414751, -0.0416168, -0.0416469, -0.041656, -0.0417461, -0.0419743, -0.04232, -0.0426972, -0.0430021, 
--0.0431714, -0.0432176, -0.0432222, -0.0432899, -0.04349, -0.043818, -0.0441975, -0.0445236, -0.0447211, -0.0447867, 
--0.0447911, -0.044839, -0.0450109, -0.045318, -0.0456957, -0.0460399, -0.0462655, -0.0463534, -0.0463617, -0.0463931, 
--0.0465372, -0.0468208, -0.0471924, -0.0475515, -0.0478043, -0.0479168, -0.0479332, -0.0479517, -0.0480692, -0.0483272, 
--0.0486887, -0.0490587, -0.0493375, -0.0494764, -0.0495049, -0.0495144, -0.0496068, -0.0498377, -0.0501853, -0.0505623, 
--0.0508651, -0.0510315, -0.0510758, -0.0510804, -0.05115, -0.0513529, -0.051683, -0.0520628, -0.0523871, -0.0525818, 
--0.0526451, -0.052649, -0.0526985, -0.0528732, -0.0531827, -0.0535611, -0.0539039, -0.0541267, -0.0542121, -0.0542195, 
--0.0542522, -0.054399, -0.0546852, -0.0550579, -0.0554159, -0.0556662, -0.055776, -0.0557911, -0.0558104, -0.0559303, 
--0.0561911, -0.0565541, -0.0569235, -0.0571999, -0.057336, -0.0573629, -0.0573727, -0.0574674, -0.0577011, -0.0580505, 
--0.0584273, -0.058728, -0.0588917, -0.058934, -0.0589385, -0.05901, -0.0592158, -0.059548, -0.0599281, -0.0602506, 
--0.0604425, -0.0605036, -0.060507, -0.0605581, -0.0607356, -0.0610474, -0.0614265, -0.0617679, -0.061988, -0.0620709, 
--0.0620774, -0.0621113, -0.0622607, -0.0625495, -0.0629233, -0.0632803, -0.063528, -0.0636351, -0.063649, -0.0636691, 
--0.0637915, -0.064055, -0.0644195, -0.0647883, -0.0650623, -0.0651956, -0.0652208, -0.0652311, -0.065328, -0.0655646, 
--0.0659158, -0.0662924, -0.066591, -0.0667518, -0.0667921, -0.0667966, -0.0668701, -0.0670787, -0.0674131, -0.0677934, 
--0.0681141, -0.0683031, -0.068362, -0.0683649, -0.0684176, -0.0685979, -0.0689122, -0.0692919, -0.0696319, -0.0698493, 
--0.0699296, -0.0699353, -0.0699703, -0.0701225, -0.0704139, -0.0707888, -0.0711447, -0.0713898, -0.0714943, -0.0715068, 
--0.0715278, -0.0716527, -0.0719189, -0.0722849, -0.0726531, -0.0729248, -0.0730552, -0.0730788, -0.0730894, -0.0731886, 
--0.073428, -0.073781, -0.0741575, -0.074454, -0.0746119, -0.0746502, -0.0746547, -0.0747301, -0.0749416, -0.0752781, 
--0.0756587, -0.0759776, -0.0761638, -0.0762203, -0.0762228, -0.0762771, -0.0764602, -0.0767769, -0.0771573, -0.0774959, 
--0.0777105, -0.0777883, -0.0777931, -0.0778294, -0.0779842, -0.0782783, -0.0786543, -0.0790092, -0.0792517, -0.0793534, 
--0.0793647, -0.0793864, -0.0795138, -0.0797829, -0.0801503, -0.0805179, -0.0807872, -0.0809149, -0.0809367, -0.0809478, 
--0.0810491, -0.0812914, -0.0816463, -0.0820226, -0.082317, -0.0824721, -0.0825083, -0.0825127, -0.0825901, -0.0828045, 
--0.0831432, -0.083524, -0.0838412, -0.0840245, -0.0840787, -0.0840807, -0.0841367, -0.0843225, -0.0846417, -0.0850228, 
--0.08536, -0.0855718, -0.0856471, -0.0856509, -0.0856884, -0.085846, -0.0861426, -0.0865198, -0.0868737, -0.0871136, 
--0.0872125, -0.0872225, -0.0872451, -0.087375, -0.0876468, -0.0880158, -0.0883827, -0.0886497, -0.0887745, -0.0887946, 
--0.0888061, -0.0889097, -0.0891549, -0.0895117, -0.0898878, -0.09018, -0.0903322, -0.0903664, -0.0903708, -0.0904501, 
--0.0906674, -0.0910083, -0.0913894, -0.0917047, -0.0918852, -0.0919371, -0.0919386, -0.0919962, -0.0921849, -0.0925065, 
--0.0928883, -0.093224, -0.0934331, -0.0935058, -0.0935087, -0.0935475, -0.0937077, -0.094007, -0.0943853, -0.0947381, 
--0.0949754, -0.0950717, -0.0950803, -0.0951037, -0.0952361, -0.0955108, -0.0958812, -0.0962476, -0.0965121, -0.0966341, 
--0.0966525, -0.0966643, -0.0967703, -0.0970183, -0.097377, -0.0977529, -0.0980431, -0.0981923, -0.0982245, -0.0982288, 
--0.0983101, -0.0985303, -0.0988734, -0.0992547, -0.0995683, -0.0997459, -0.0997954, -0.0997964, -0.0998556, -0.1000472, 
--0.1003712, -0.1007538, -0.1010881, -0.1012943, -0.1013645, -0.1013664, -0.1014065, -0.1015694, -0.1018714, -0.1022508, 
--0.1026027, -0.1028373, -0.1029308, -0.102938, -0.1029623, -0.1030972, -0.1033747, -0.1037467, -0.1041125, -0.1043746, 
--0.1044937, -0.1045104, -0.1045226, -0.1046308, -0.1048818, -0.1052423, -0.1056181, -0.1059061, -0.1060525, -0.1060826, 
--0.1060868, -0.1061701, -0.1063932, -0.1067385, -0.1071202, -0.1074319, -0.1076066, -0.1076538, -0.1076543, -0.1077151, 
--0.1079095, -0.1082361, -0.1086193, -0.1089522, -0.1091556, -0.1092231, -0.1092242, -0.1092654, -0.1094311, -0.1097359, 
--0.1101164, -0.1104672, -0.1106992, -0.1107899, -0.1107958, -0.1108208, -0.1109584, -0.1112387, -0.1116123, -0.1119774, 
--0.1122371, -0.1123532, -0.1123682, -0.1123808, -0.1124913, -0.1127452, -0.1131077, -0.1134833, -0.1137692, -0.1139126, 
--0.1139406, -0.1139448, -0.1140301, -0.1142561, -0.1146036, -0.1149856, -0.1152955, -0.1154673, -0.1155121, -0.115512, 
--0.1155745, -0.1157718, -0.1161009, -0.1164849, -0.1168163, -0.1170169, -0.1170818, -0.1170819, -0.1171244, -0.1172929, 
--0.1176003, -0.117982, -0.1183318, -0.1185611, -0.118649, -0.1186535, -0.1186794, -0.1188195, -0.1191027, -0.1194778, 
--0.1198423, -0.1200996, -0.1202128, -0.120226, -0.120239, -0.1203518, -0.1206087, -0.1209731, -0.1213486, -0.1216322, 
--0.1217727, -0.1217986, -0.1218027, -0.12189, -0.122119, -0.1224688, -0.1228511, -0.1231591, -0.123328, -0.1233703, 
--0.1233698, -0.1234339, -0.1236341, -0.1239657, -0.1243505, -0.1246804, -0.1248782, -0.1249404, -0.1249396, -0.1249833, 
--0.1251546, -0.1254648, -0.1258477, -0.1261963, -0.126423, -0.126508, -0.1265112, -0.1265379, -0.1266806, -0.1269667, 
--0.1273434, -0.1277073, -0.1279621, -0.1280724, -0.1280838, -0.1280972, -0.1282123, -0.1284722, -0.1288386, -0.1292139, 
--0.1294953, -0.1296328, -0.1296566, -0.1296606, -0.12975, -0.1299819, -0.130334, -0.1307166, -0.1310228, -0.1311887, 
--0.1312286, -0.1312275, -0.1312933, -0.1314965, -0.1318306, -0.1322161, -0.1325446, -0.1327395, -0.132799, -0.1327972, 
--0.1328422, -0.1330163, -0.1333292, -0.1337133, -0.134061, -0.1342849, -0.1343671, -0.1343688, -0.1343964, -0.1345417, 
--0.1348307, -0.135209, -0.1355723, -0.1358246, -0.1359319, -0.1359415, -0.1359553, -0.1360728, -0.1363356, -0.136704, 
--0.1370792, -0.1373585, -0.1374929, -0.1375145, -0.1375185, -0.1376099, -0.1378448, -0.1381992, -0.1385821, -0.1388865, 
--0.1390493, -0.1390868, -0.1390852, -0.1391527, -0.1393588, -0.1396955, -0.1400818, -0.1404088, -0.1406008, -0.1406576, 
--0.1406548, -0.1407011, -0.140878, -0.1411937, -0.141579, -0.1419256, -0.1421468, -0.1422261, -0.1422264, -0.1422548, 
--0.1424027, -0.1426947, -0.1430747, -0.1434374, -0.1436871, -0.1437915, -0.1437993, -0.1438134, -0.1439333, -0.1441991, 
--0.1445695, -0.1449445, -0.1452216, -0.145353, -0.1453724, -0.1453763, -0.1454697, -0.1457078, -0.1460645, -0.1464477, 
--0.1467502, -0.14691, -0.146945, -0.1469429, -0.147012, -0.1472211, -0.1475604, -0.1479475, -0.148273, -0.1484621, 
--0.1485162, -0.1485124, -0.14856, -0.1487397, -0.1490583, -0.1494448, -0.1497903, -0.1500087, -0.1500851, -0.150084, 
--0.1501133, -0.1502638, -0.1505587, -0.1509404, -0.1513024, -0.1515497, -0.151651, -0.1516569, -0.1516715, -0.1517938, 
--0.1520627, -0.1524351, -0.1528099, -0.1530847, -0.1532131, -0.1532303, -0.1532341, -0.1533296, -0.1535707, -0.1539298, 
--0.1543133, -0.1546139, -0.1547707, -0.1548032, -0.1548005, -0.1548713, -0.1550834, -0.1554254, -0.1558133, -0.1561372, 
--0.1563234, -0.1563748, -0.1563699, -0.1564188, -0.1566014, -0.1569228, -0.1573106, -0.157655, -0.1578707, -0.1579441, 
--0.1579415, -0.1579716, -0.1581249, -0.1584228, -0.1588061, -0.1591675, -0.1594122, -0.1595105, -0.1595146, -0.1595295, 
--0.1596542, -0.1599262, -0.1603006, -0.1606753, -0.1609479, -0.1610731, -0.1610881, -0.1610918, -0.1611894, -0.1614336, 
--0.1617951, -0.1621789, -0.1624776, -0.1626314, -0.1626613, -0.162658, -0.1627306, -0.1629457, -0.1632904, -0.163679, 
--0.1640015, -0.1641847, -0.1642333, -0.1642274, -0.1642775, -0.164463, -0.1647874, -0.1651764, -0.1655198, -0.1657326, 
--0.1658031, -0.165799, -0.16583, -0.1659859, -0.1662869, -0.1666719, -0.1670327, -0.1672748, -0.16737, -0.1673722, 
--0.1673875, -0.1675146, -0.1677897, -0.1681662, -0.1685408, -0.1688111, -0.1689332, -0.1689459, -0.1689495, -0.1690492, 
--0.1692966, -0.1696605, -0.1700446, -0.1703414, -0.170492, -0.1705194, -0.1705156, -0.1705899, -0.1708081, -0.1711554, 
--0.1715449, -0.1718658, -0.172046, -0.1720917, -0.1720848, -0.1721363, -0.1723247, -0.172652, -0.1730423, -0.1733846, 
--0.1735945, -0.173662, -0.1736565, -0.1736883, -0.1738469, -0.174151, -0.1745377, -0.1748979, -0.1751374, -0.1752294, 
--0.1752297, -0.1752454, -0.175375, -0.1756533, -0.1760319, -0.1764063, -0.1766743, -0.1767932, -0.1768037, -0.1768072, 
--0.176909, -0.1771595, -0.1775259, -0.1779104, -0.1782052, -0.1783527, -0.1783775, -0.178373, -0.1784491, -0.1786704, 
--0.1790205, -0.1794108, -0.1797302, -0.1799073, -0.1799502, -0.1799422, -0.179995, -0.1801864, -0.1805166, -0.1809082, 
--0.1812494, -0.1814565, -0.1815209, -0.1815139, -0.1815465, -0.181708, -0.1820151, -0.1824035, -0.1827631, -0.183, 
--0.1830889, -0.1830872, -0.1831033, -0.1832354, -0.1835169, -0.1838976, -0.1842719, -0.1845376, -0.1846532, -0.1846614, 
--0.1846648, -0.1847688, -0.1850225, -0.1853913, -0.1857762, -0.1860691, -0.1862133, -0.1862355, -0.1862304, -0.1863083, 
--0.1865327, -0.1868856, -0.1872767, -0.1875946, -0.1877686, -0.1878086, -0.1877995, -0.1878536, -0.1880481, -0.1883813, 
--0.1887742, -0.1891143, -0.1893185, -0.1893798, -0.1893712, -0.1894047, -0.189569, -0.1898793, -0.1902695, -0.1906284, 
--0.1908626, -0.1909483, -0.1909447, -0.1909611, -0.1910957, -0.1913805, -0.1917634, -0.1921375, -0.1924008, -0.1925132, 
--0.1925191, -0.1925224, -0.1926285, -0.1928855, -0.1932568, -0.1936421, -0.193933, -0.194074, -0.1940935, -0.1940878, 
--0.1941674, -0.194395, -0.1947507, -0.1951427, -0.195459, -0.1956299, -0.195667, -0.1956568, -0.1957123, -0.1959097, 
--0.196246, -0.1966402, -0.1969792, -0.1971805, -0.1972387, -0.1972285, -0.1972629, -0.1974299, -0.1977435, -0.1981354, 
--0.1984938, -0.1987253, -0.1988077, -0.1988021, -0.1988189, -0.198956, -0.1992441, -0.1996292, -0.2000032, -0.2002641, 
--0.2003732, -0.2003767, -0.2003799, -0.2004882, -0.2007485, -0.2011224, -0.201508, -0.2017969, -0.2019346, -0.2019514, 
--0.2019451, -0.2020265, -0.2022574, -0.2026159, -0.2030088, -0.2033235, -0.2034912, -0.2035253, -0.203514, -0.2035708, 
--0.2037714, -0.2041107, -0.2045063, -0.2048442, -0.2050424, -0.2050975, -0.2050857, -0.205121, -0.2052909, -0.2056077, 
--0.2060015, -0.2063592, -0.206588, -0.206667, -0.2066594, -0.2066766, -0.2068163, -0.2071077, -0.207495, -0.2078689, 
--0.2081275, -0.2082332, -0.2082343, -0.2082373, -0.2083479, -0.2086115, -0.208988, -0.209374, -0.2096608, -0.2097952, 
--0.2098093, -0.2098023, -0.2098856, -0.2101197, -0.2104811, -0.2108749, -0.211188, -0.2113525, -0.2113836, -0.2113711, 
--0.2114294, -0.211633, -0.2119755, -0.2123725, -0.2127092, -0.2129044, -0.2129562, -0.2129429, -0.2129791, -0.2131519, 
--0.213472, -0.2138676, -0.2142246, -0.2144506, -0.2145264, -0.2145167, -0.2145343, -0.2146766, -0.2149714, -0.215361, 
--0.2157347, -0.2159908, -0.2160932, -0.2160918, -0.2160947, -0.2162075, -0.2164745, -0.2168536, -0.21724, -0.2175248, 
--0.2176559, -0.2176671, -0.2176595, -0.2177446, -0.2179821, -0.2183464, -0.2187411, -0.2190526, -0.2192138, -0.2192418, 
--0.2192282, -0.2192878, -0.2194947, -0.2198403, -0.2202387, -0.2205743, -0.2207665, -0.220815, -0.2208, -0.220837, 
--0.2210128, -0.2213363, -0.2217337, -0.2220901, -0.2223133, -0.2223857, -0.2223739, -0.2223919, -0.2225369, -0.2228351, 
--0.2232269, -0.2236006, -0.2238542, -0.2239531, -0.2239492, -0.223952, -0.2240671, -0.2243375, -0.2247193, -0.2251061, 
--0.2253888, -0.2255165, -0.2255249, -0.2255166, -0.2256036, -0.2258444, -0.2262117, -0.2266074, -0.2269172, -0.2270751, 
--0.2271, -0.2270852, -0.2271463, -0.2273563, -0.2277052, -0.228105, -0.2284394, -0.2286285, -0.2286737, -0.228657, 
--0.228695, -0.2288737, -0.2292006, -0.2296, -0.2299557, -0.2301761, -0.230245, -0.2302311, -0.2302494, -0.2303971, 
--0.2306988, -0.231093, -0.2314665, -0.2317176, -0.231813, -0.2318066, -0.2318092, -0.2319266, -0.2322006, -0.2325851, 
--0.2329723, -0.2332529, -0.2333771, -0.2333826, -0.2333736, -0.2334625, -0.2337068, -0.2340771, -0.2344737, -0.2347819, 
--0.2349364, -0.2349582, -0.2349421, -0.2350046, -0.2352179, -0.2355701, -0.2359714, -0.2363046, -0.2364905, -0.2365323, 
--0.2365139, -0.2365529, -0.2367347, -0.2370649, -0.2374663, -0.2378214, -0.2380388, -0.2381042, -0.2380881, -0.2381069, 
--0.2382573, -0.2385625, -0.2389591, -0.2393325, -0.2395811, -0.2396729, -0.2396639, -0.2396663, -0.2397862, -0.2400637, 
--0.2404509, -0.2408386, -0.241117, -0.2412377, -0.2412403, -0.2412306, -0.2413214, -0.2415691, -0.2419426, -0.2423401, 
--0.2426466, -0.2427977, -0.2428163, -0.242799, -0.2428629, -0.2430796, -0.2434351, -0.2438379, -0.2441699, -0.2443526, 
--0.2443909, -0.2443708, -0.2444107, -0.2445955, -0.2449293, -0.2453326, -0.2456871, -0.2459016, -0.2459634, -0.2459451, 
--0.2459643, -0.2461175, -0.2464263, -0.2468253, -0.2471986, -0.2474446, -0.2475328, -0.2475211, -0.2475234, -0.2476456, 
--0.2479267, -0.2483168, -0.2487049, -0.2489812, -0.2490982, -0.2490978, -0.2490875, -0.2491802, -0.2494315, -0.2498081, 
--0.2502066, -0.2505114, -0.250659, -0.2506743, -0.2506558, -0.2507212, -0.2509412, -0.2513001, -0.2517044, -0.2520352, 
--0.2522146, -0.2522495, -0.2522276, -0.2522684, -0.2524564, -0.2527938, -0.2531991, -0.2535529, -0.2537644, -0.2538226, 
--0.2538021, -0.2538216, -0.2539776, -0.2542901, -0.2546916, -0.2550648, -0.2553081, -0.2553926, -0.2553783, -0.2553804, 
--0.2555051, -0.2557899, -0.2561828, -0.2565713, -0.2568454, -0.2569588, -0.2569554, -0.2569442, -0.257039, -0.2572939, 
--0.2576737, -0.2580732, -0.2583762, -0.2585204, -0.2585322, -0.2585125, -0.2585793, -0.2588028, -0.2591652, -0.259571, 
--0.2599006, -0.2600767, -0.260108, -0.2600843, -0.260126, -0.2603173, -0.2606583, -0.2610657, -0.2614187, -0.2616272, 
--0.2616817, -0.2616589, -0.2616788, -0.2618377, -0.2621539, -0.262558, -0.262931, -0.2631716, -0.2632524, -0.2632354, 
--0.2632373, -0.2633644, -0.263653, -0.2640489, -0.2644379, -0.2647096, -0.2648193, -0.2648128, -0.2648009, -0.2648977, 
--0.2651562, -0.2655393, -0.2659399, -0.2662411, -0.2663817, -0.2663901, -0.266369, -0.2664374, -0.2666644, -0.2670303, 
--0.2674378, -0.2677661, -0.2679388, -0.2679665, -0.2679409, -0.2679836, -0.2681781, -0.2685228, -0.2689323, -0.2692847, 
--0.2694901, -0.2695408, -0.2695156, -0.269536, -0.2696978, -0.2700178, -0.2704244, -0.2707974, -0.2710353, -0.2711122, 
--0.2710924, -0.2710941, -0.2712238, -0.2715161, -0.271915, -0.2723045, -0.272574, -0.2726799, -0.2726702, -0.2726575, 
--0.2727563, -0.2730186, -0.273405, -0.2738067, -0.2741061, -0.274243, -0.274248, -0.2742255, -0.2742955, -0.274526, 
--0.2748955, -0.2753046, -0.2756316, -0.2758009, -0.2758249, -0.2757974, -0.2758411, -0.2760389, -0.2763874, -0.276799, 
--0.2771507, -0.277353, -0.2773998, -0.2773723, -0.277393, -0.2775578, -0.2778817, -0.2782909, -0.2786638, -0.2788989, 
--0.278972, -0.2789493, -0.2789508, -0.2790831, -0.2793793, -0.2797812, -0.2801712, -0.2804383, -0.2805404, -0.2805274, 
--0.280514, -0.2806149, -0.280881, -0.2812708, -0.2816735, -0.2819711, -0.2821043, -0.2821057, -0.2820819, -0.2821534, 
--0.2823876, -0.2827608, -0.2831715, -0.2834972, -0.283663, -0.2836832, -0.2836538, -0.2836985, -0.2838997, -0.2842521, 
--0.2846659, -0.2850169, -0.2852159, -0.2852588, -0.2852288, -0.28525, -0.2854178, -0.2857457, -0.2861576, -0.2865303, 
--0.2867626, -0.2868317, -0.2868061, -0.2868075, -0.2869423, -0.2872425, -0.2876475, -0.288038, -0.2883028, -0.2884009, 
--0.2883846, -0.2883704, -0.2884734, -0.2887434, -0.2891367, -0.2895405, -0.2898362, -0.2899656, -0.2899634, -0.2899382, 
--0.2900113, -0.2902492, -0.2906261, -0.2910385, -0.291363, -0.2915251, -0.2915415, -0.2915101, -0.2915558, -0.2917604, 
--0.2921168, -0.2925328, -0.2928831, -0.2930789, -0.2931178, -0.2930853, -0.2931068, -0.2932777, -0.2936097, -0.2940243, 
--0.294397, -0.2946264, -0.2946914, -0.2946628, -0.294664, -0.2948015, -0.2951058, -0.2955139, -0.2959049, -0.2961673, 
--0.2962613, -0.2962417, -0.2962267, -0.2963319, -0.2966059, -0.2970027, -0.2974076, -0.2977014, -0.2978269, -0.297821, 
--0.2977944, -0.2978691, -0.2981108, -0.2984915, -0.2989057, -0.2992288, -0.2993873, -0.2993997, -0.2993663, -0.2994131, 
--0.2996212, -0.2999816, -0.3003999, -0.3007494, -0.3009418, -0.3009766, -0.3009416, -0.3009636, -0.3011376, -0.3014737, 
--0.3018912, -0.3022637, -0.3024902, -0.302551, -0.3025194, -0.3025203, -0.3026606, -0.302969, -0.3033805, -0.303772, 
--0.3040318, -0.3041218, -0.3040987, -0.3040828, -0.3041902, -0.3044683, -0.3048687, -0.3052749, -0.3055667, -0.3056882, 
--0.3056785, -0.3056504, -0.3057268, -0.3059723, -0.306357, -0.306773, -0.3070947, -0.3072494, -0.3072578, -0.3072223, 
--0.3072702, -0.3074819, -0.3078464, -0.3082671, -0.3086159, -0.3088049, -0.3088355, -0.3087978, -0.3088202, -0.3089975, 
--0.3093378, -0.3097581, -0.3101306, -0.310354, -0.3104106, -0.3103759, -0.3103766, -0.3105196, -0.3108323, -0.3112471, 
--0.3116392, -0.3118965, -0.3119822, -0.3119556, -0.3119388, -0.3120485, -0.3123307, -0.3127349, -0.3131422, -0.3134321, 
--0.3135495, -0.313536, -0.3135063, -0.3135844, -0.3138339, -0.3142226, -0.3146404, -0.3149607, -0.3151116, -0.3151158, 
--0.3150783, -0.3151272, -0.3153426, -0.3157113, -0.3161344, -0.3164824, -0.3166679, -0.3166942, -0.3166539, -0.3166767, 
--0.3168573, -0.317202, -0.3176252, -0.3179976, -0.3182179, -0.3182702, -0.3182323, -0.3182327, -0.3183786, -0.3186956, 
--0.3191138, -0.3195065, -0.3197612, -0.3198426, -0.3198124, -0.3197947, -0.3199067, -0.3201932, -0.3206011, -0.3210097, 
--0.3212975, -0.3214108, -0.3213933, -0.3213621, -0.3214419, -0.3216955, -0.3220883, -0.3225079, -0.3228268, -0.3229738, 
--0.3229738, -0.3229341, -0.3229841, -0.3232032, -0.3235763, -0.3240019, -0.3243491, -0.324531, -0.3245529, -0.3245099, 
--0.3245331, -0.3247171, -0.3250662, -0.3254925, -0.3258647, -0.3260819, -0.3261297, -0.3260885, -0.3260887, -0.3262375, 
--0.326559, -0.3269807, -0.3273739, -0.327626, -0.327703, -0.3276691, -0.3276505, -0.3277649, -0.3280556, -0.3284675, 
--0.3288773, -0.3291631, -0.3292721, -0.3292505, -0.3292177, -0.3292993, -0.329557, -0.329954, -0.3303756, -0.330693, 
--0.330836, -0.3308317, -0.3307897, -0.3308408, -0.3310639, -0.3314413, -0.3318694, -0.3322159, -0.3323942, -0.3324116, 
--0.3323657, -0.3323894, -0.3325768, -0.3329304, -0.3333598, -0.333732, -0.3339459, -0.3339891, -0.3339446, -0.3339446, 
--0.3340964, -0.3344224, -0.3348477, -0.3352415, -0.3354909, -0.3355634, -0.3355256, -0.3355061, -0.3356229, -0.3359181, 
--0.336334, -0.3367451, -0.3370287, -0.3371334, -0.3371076, -0.3370732, -0.3371566, -0.3374186, -0.3378199, -0.3382434, 
--0.3385594, -0.3386983, -0.3386895, -0.3386452, -0.3386975, -0.3389244, -0.3393065, -0.3397372, -0.3400829, -0.3402573, 
--0.3402701, -0.3402213, -0.3402455, -0.3404365, -0.3407948, -0.3412273, -0.3415994, -0.34181, -0.3418486, -0.3418006, 
--0.3418003, -0.3419551, -0.3422858, -0.3427148, -0.3431093, -0.3433558, -0.3434237, -0.3433821, -0.3433615, -0.3434808, 
--0.3437806, -0.3442006, -0.3446131, -0.3448945, -0.3449946, -0.3449646, -0.3449285, -0.3450137, -0.3452801, -0.3456859, 
--0.3461114, -0.3464259, -0.3465605, -0.3465472, -0.3465005, -0.346554, -0.346785, -0.3471717, -0.3476051, -0.34795, 
--0.3481206, -0.3481286, -0.3480768, -0.3481014, -0.3482961, -0.3486592, -0.349095, -0.349467, -0.3496742, -0.3497079, 
--0.3496564, -0.3496558, -0.3498138, -0.3501493, -0.350582, -0.3509772, -0.3512209, -0.351284, -0.3512384, -0.3512168, 
--0.3513386, -0.3516431, -0.3520673, -0.3524812, -0.3527604, -0.3528559, -0.3528215, -0.3527836, -0.3528708, -0.3531416, 
--0.353552, -0.3539796, -0.3542925, -0.3544228, -0.3544048, -0.3543557, -0.3544103, -0.3546455, -0.355037, -0.3554732, 
--0.3558172, -0.3559838, -0.355987, -0.3559322, -0.3559572, -0.3561556, -0.3565236, -0.3569628, -0.3573347, -0.3575384, 
--0.3575672, -0.3575121, -0.3575112, -0.3576724, -0.3580128, -0.3584495, -0.3588453, -0.3590861, -0.3591443, -0.3590945, 
--0.3590718, -0.3591963, -0.3595057, -0.3599342, -0.3603495, -0.3606264, -0.3607172, -0.3606782, -0.3606386, -0.3607277, 
--0.3610031, -0.3614182, -0.361848, -0.3621593, -0.3622851, -0.3622622, -0.3622107, -0.3622666, -0.362506, -0.3629024, 
--0.3633414, -0.3636846, -0.3638472, -0.3638453, -0.3637873, -0.3638129, -0.3640151, -0.3643882, -0.3648308, -0.3652026, 
--0.3654028, -0.3654265, -0.3653676, -0.3653664, -0.3655309, -0.3658764, -0.366317, -0.3667136, -0.3669513, -0.3670045, 
--0.3669505, -0.3669267, -0.3670539, -0.3673682, -0.3678012, -0.368218, -0.3684925, -0.3685785, -0.3685348, -0.3684933, 
--0.3685844, -0.3688646, -0.3692845, -0.3697165, -0.3700262, -0.3701474, -0.3701196, -0.3700655, -0.3701226, -0.3703665, 
--0.370768, -0.3712099, -0.3715522, -0.3717106, -0.3717036, -0.3716423, -0.3716683, -0.3718745, -0.3722528, -0.372699, 
--0.3730707, -0.3732672, -0.3732856, -0.3732229, -0.3732214, -0.3733893, -0.37374, -0.3741848, -0.374582, -0.3748167, 
--0.3748647, -0.3748063, -0.3747814, -0.3749114, -0.3752308, -0.3756684, -0.3760867, -0.3763588, -0.3764397, -0.3763913, 
--0.3763479, -0.3764411, -0.3767261, -0.377151, -0.3775853, -0.3778932, -0.3780098, -0.3779768, -0.37792, -0.3779785, 
--0.3782269, -0.3786336, -0.3790785, -0.3794199, -0.379574, -0.3795617, -0.3794971, -0.3795236, -0.3797338, -0.3801175, 
--0.3805673, -0.380939, -0.3811317, -0.3811447, -0.3810781, -0.3810762, -0.3812476, -0.3816037, -0.3820527, -0.3824507, 
--0.3826822, -0.3827249, -0.3826619, -0.3826359, -0.3827687, -0.3830934, -0.3835358, -0.3839556, -0.3842252, -0.384301, 
--0.3842476, -0.3842022, -0.3842975, -0.3845876, -0.3850176, -0.3854542, -0.3857605, -0.3858722, -0.3858339, -0.3857744, 
--0.3858342, -0.3860872, -0.3864994, -0.3869474, -0.3872879, -0.3874375, -0.3874197, -0.3873516, -0.3873787, -0.387593, 
--0.3879823, -0.3884359, -0.3888075, -0.3889963, -0.3890038, -0.388933, -0.3889308, -0.3891058, -0.3894674, -0.3899209, 
--0.3903196, -0.3905479, -0.390585, -0.3905174, -0.3904902, -0.3906259, -0.390956, -0.3914033, -0.3918247, -0.3920918, 
--0.3921622, -0.3921038, -0.3920563, -0.3921538, -0.3924491, -0.3928844, -0.3933234, -0.3936279, -0.3937346, -0.3936909, 
--0.3936285, -0.3936897, -0.3939475, -0.3943652, -0.3948165, -0.395156, -0.3953011, -0.3952776, -0.395206, -0.3952335, 
--0.3954522, -0.3958471, -0.3963047, -0.3966762, -0.396861, -0.3968627, -0.3967877, -0.3967851, -0.3969638, -0.3973312, 
--0.3977892, -0.3981888, -0.3984136, -0.398445, -0.3983727, -0.3983442, -0.3984829, -0.3988187, -0.399271, -0.3996941, 
--0.3999586, -0.4000235, -0.3999597, -0.3999102, -0.4000099, -0.4003105, -0.4007513, -0.4011929, -0.4014955, -0.401597, 
--0.4015477, -0.4014824, -0.401545, -0.4018078, -0.4022313, -0.4026858, -0.4030244, -0.4031647, -0.4031354, -0.4030601, 
--0.4030881, -0.4033113, -0.4037121, -0.4041738, -0.4045452, -0.4047258, -0.4047216, -0.4046422, -0.4046392, -0.4048218, 
--0.4051951, -0.4056578, -0.4060582, -0.4062795, -0.4063051, -0.4062277, -0.4061979, -0.4063398, -0.4066814, -0.4071389, 
--0.4075638, -0.4078255, -0.4078847, -0.4078155, -0.4077638, -0.4078658, -0.408172, -0.4086184, -0.4090626, -0.4093634, 
--0.4094595, -0.4094044, -0.409336, -0.4094, -0.409668, -0.4100974, -0.4105554, -0.410893, -0.4110284, -0.4109931, 
--0.4109139, -0.4109425, -0.4111703, -0.4115772, -0.412043, -0.4124144, -0.4125907, -0.4125804, -0.4124964, -0.4124931, 
--0.4126796, -0.413059, -0.4135266, -0.4139278, -0.4141456, -0.414165, -0.4140825, -0.4140514, -0.4141965, -0.4145441, 
--0.415007, -0.4154337, -0.4156926, -0.4157459, -0.4156711, -0.4156171, -0.4157215, -0.4160334, -0.4164857, -0.4169326, 
--0.4172314, -0.417322, -0.4172608, -0.4171894, -0.4172549, -0.4175282, -0.4179637, -0.4184253, -0.4187618, -0.4188922, 
--0.4188506, -0.4187675, -0.4187966, -0.4190292, -0.4194424, -0.4199126, -0.4202839, -0.4204557, -0.420439, -0.4203504, 
--0.4203466, -0.4205373, -0.4209231, -0.4213956, -0.4217978, -0.4220118, -0.422025, -0.4219371, -0.4219046, -0.4220531, 
--0.4224068, -0.4228754, -0.4233039, -0.4235599, -0.4236072, -0.4235264, -0.4234701, -0.423577, -0.4238949, -0.4243532, 
--0.4248029, -0.4250997, -0.4251845, -0.4251171, -0.4250424, -0.4251095, -0.4253882, -0.4258302, -0.4262955, -0.4266309, 
--0.4267561, -0.426708, -0.4266207, -0.4266505, -0.4268879, -0.4273078, -0.4277824, -0.4281536, -0.4283209, -0.4282976, 
--0.4282041, -0.4281999, -0.4283948, -0.4287872, -0.4292649, -0.429668, -0.4298782, -0.4298848, -0.4297914, -0.4297575, 
--0.4299094, -0.4302696, -0.430744, -0.4311745, -0.4314274, -0.4314684, -0.4313816, -0.4313228, -0.4314323, -0.4317563, 
--0.4322209, -0.4326735, -0.4329682, -0.4330471, -0.4329733, -0.4328951, -0.4329638, -0.4332483, -0.4336969, -0.4341659, 
--0.4345003, -0.43462, -0.4345652, -0.4344737, -0.434504, -0.4347466, -0.4351733, -0.4356526, -0.4360237, -0.4361861, 
--0.4361561, -0.4360575, -0.4360528, -0.4362521, -0.4366513, -0.4371345, -0.4375386, -0.4377447, -0.4377446, -0.4376455, 
--0.43761, -0.4377655, -0.4381324, -0.4386128, -0.4390454, -0.4392952, -0.4393296, -0.4392365, -0.4391751, -0.4392873, 
--0.4396177, -0.4400888, -0.4405445, -0.440837, -0.4409097, -0.4408291, -0.4407475, -0.4408178, -0.4411082, -0.4415637, 
--0.4420368, -0.44237, -0.4424841, -0.4424222, -0.4423263, -0.4423572, -0.4426052, -0.4430389, -0.4435231, -0.4438941, 
--0.4440516, -0.4440144, -0.4439106, -0.4439055, -0.4441093, -0.4445156, -0.4450044, -0.4454096, -0.4456115, -0.4456044, 
--0.4454992, -0.4454622, -0.4456214, -0.4459953, -0.446482, -0.4469166, -0.4471631, -0.4471908, -0.4470911, -0.4470271, 
--0.4471421, -0.447479, -0.447957, -0.4484158, -0.4487061, -0.4487724, -0.4486848, -0.4485995, -0.4486716, -0.4489681, 
--0.4494308, -0.449908, -0.45024, -0.4503482, -0.4502791, -0.4501786, -0.4502101, -0.4504636, -0.4509046, -0.4513939, 
--0.4517649, -0.4519172, -0.4518726, -0.4517633, -0.4517577, -0.4519663, -0.45238, -0.4528747, -0.4532809, -0.4534785, 
--0.453464, -0.4533527, -0.453314, -0.4534771, -0.4538582, -0.4543514, -0.4547882, -0.4550314, -0.4550519, -0.4549454, 
--0.4548787, -0.4549965, -0.4553404, -0.4558254, -0.4562876, -0.4565755, -0.4566351, -0.4565403, -0.4564511, -0.456525, 
--0.4568279, -0.457298, -0.4577796, -0.4581104, -0.4582125, -0.4581358, -0.4580304, -0.4580626, -0.4583219, -0.4587706, 
--0.4592651, -0.459636, -0.459783, -0.4597307, -0.4596157, -0.4596095, -0.4598231, -0.4602445, -0.4607453, -0.4611526, 
--0.4613457, -0.4613236, -0.4612058, -0.4611654, -0.4613325, -0.4617211, -0.4622212, -0.4626603, -0.4628999, -0.4629131, 
--0.4627995, -0.4627299, -0.4628507, -0.4632017, -0.4636941, -0.4641597, -0.4644452, -0.4644979, -0.4643954, -0.4643023, 
--0.464378, -0.4646877, -0.4651655, -0.4656516, -0.4659811, -0.4660769, -0.4659923, -0.4658819, -0.4659148, -0.46618, 
--0.4666367, -0.4671367, -0.4675076, -0.4676489, -0.4675887, -0.4674677, -0.467461, -0.4676797, -0.4681091, -0.4686162, 
--0.4690247, -0.4692131, -0.4691831, -0.4690585, -0.4690164, -0.4691877, -0.4695841, -0.4700913, -0.4705328, -0.4707688, 
--0.4707742, -0.4706532, -0.4705806, -0.4707045, -0.4710631, -0.4715632, -0.4720323, -0.4723153, -0.4723607, -0.4722503, 
--0.4721531, -0.4722307, -0.4725473, -0.4730333, -0.473524, -0.4738523, -0.4739414, -0.4738486, -0.4737329, -0.4737665, 
--0.474038, -0.474503, -0.4750088, -0.4753796, -0.4755151, -0.4754464, -0.4753192, -0.4753119, -0.4755361, -0.4759738, 
--0.4764876, -0.4768973, -0.4770808, -0.4770425, -0.4769108, -0.4768668, -0.4770425, -0.4774471, -0.4779618, -0.4784058, 
--0.4786379, -0.4786353, -0.4785065, -0.4784308, -0.478558, -0.4789244, -0.4794325, -0.4799054, -0.4801857, -0.4802236, 
--0.4801049, -0.4800033, -0.480083, -0.4804069, -0.4809013, -0.481397, -0.4817238, -0.481806, -0.4817046, -0.4815834, 
--0.4816177, -0.4818958, -0.4823695, -0.4828813, -0.4832521, -0.4833814, -0.483304, -0.4831703, -0.4831624, -0.4833922, 
--0.4838387, -0.4843595, -0.4847705, -0.4849488, -0.4849018, -0.4847628, -0.4847168, -0.4848971, -0.4853102, -0.4858327, 
--0.4862793, -0.4865074, -0.4864964, -0.4863595, -0.4862805, -0.4864111, -0.4867857, -0.4873022, -0.4877791, -0.4880566, 
--0.4880865, -0.4879592, -0.487853, -0.4879348, -0.4882663, -0.4887696, -0.4892705, -0.4895959, -0.4896708, -0.4895603, 
--0.4894335, -0.4894685, -0.4897534, -0.4902362, -0.4907543, -0.491125, -0.491248, -0.4911614, -0.4910209, -0.4910123, 
--0.491248, -0.4917037, -0.4922318, -0.4926441, -0.4928171, -0.492761, -0.4926142, -0.4925662, -0.4927512, -0.4931734, 
--0.493704, -0.4941534, -0.4943773, -0.4943575, -0.4942121, -0.4941296, -0.4942637, -0.4946469, -0.4951723, -0.4956533, 
--0.4959279, -0.4959495, -0.4958131, -0.4957021, -0.4957861, -0.4961256, -0.4966382, -0.4971445, -0.4974684, -0.4975357, 
--0.4974158, -0.4972829, -0.4973187, -0.4976108, -0.4981032, -0.4986279, -0.4989986, -0.4991148, -0.4990186, -0.498871, 
--0.4988617, -0.4991036, -0.4995688, -0.5001046, -0.5005184, -0.5006858, -0.5006201, -0.5004652, -0.500415, -0.500605, 
--0.5010367, -0.5015758, -0.5020281, -0.5022477, -0.5022186, -0.5020642, -0.5019781, -0.502116, -0.5025082, -0.5030428, 
--0.5035282, -0.5037997, -0.5038126, -0.5036666, -0.5035506, -0.5036369, -0.5039848, -0.5045072, -0.5050192, -0.5053415, 
--0.5054008, -0.505271, -0.5051317, -0.5051684, -0.505468, -0.5059705, -0.5065021, -0.5068727, -0.5069819, -0.5068756, 
--0.5067204, -0.5067105, -0.5069588, -0.5074342, -0.507978, -0.5083933, -0.5085548, -0.508479, -0.5083156, -0.5082631, 
--0.5084585, -0.5089, -0.5094481, -0.5099035, -0.5101184, -0.5100796, -0.5099158, -0.5098259, -0.5099677, -0.5103694, 
--0.5109138, -0.5114037, -0.5116721, -0.5116758, -0.5115197, -0.5113985, -0.5114872, -0.5118439, -0.5123766, -0.5128945, 
--0.5132152, -0.5132661, -0.5131258, -0.5129799, -0.5130174, -0.5133249, -0.513838, -0.514377, -0.5147475, -0.5148493, 
--0.5147324, -0.5145693, -0.5145585, -0.5148137, -0.5152997, -0.515852, -0.5162689, -0.5164242, -0.5163379, -0.5161654, 
--0.5161105, -0.5163114, -0.5167634, -0.517321, -0.5177796, -0.5179897, -0.5179406, -0.5177669, -0.517673, -0.5178189, 
--0.5182306, -0.5187852, -0.5192799, -0.519545, -0.519539, -0.5193724, -0.5192455, -0.5193368, -0.5197028, -0.5202463, 
--0.5207706, -0.5210896, -0.5211316, -0.5209803, -0.5208273, -0.5208657, -0.5211816, -0.5217058, -0.5222525, -0.522623, 
--0.522717, -0.5225889, -0.5224174, -0.5224058, -0.5226683, -0.5231655, -0.5237267, -0.5241453, -0.524294, -0.5241965, 
--0.5240145, -0.5239571, -0.5241639, -0.5246269, -0.5251945, -0.5256565, -0.5258614, -0.5258016, -0.5256174, -0.5255193, 
--0.5256695, -0.5260917, -0.5266572, -0.527157, -0.5274185, -0.5274024, -0.5272246, -0.5270918, -0.5271858, -0.5275616, 
--0.5281165, -0.5286475, -0.5289646, -0.5289973, -0.5288343, -0.528674, -0.5287133, -0.529038, -0.529574, -0.5301289, 
--0.5304993, -0.5305851, -0.5304451, -0.5302648, -0.5302523, -0.5305224, -0.5310314, -0.5316022, -0.5320225, -0.5321643, 
--0.532055, -0.531863, -0.5318029, -0.5320159, -0.5324905, -0.5330687, -0.5335343, -0.5337338, -0.5336625, -0.5334673, 
--0.5333646, -0.5335195, -0.5339528, -0.5345298, -0.535035, -0.5352928, -0.5352658, -0.5350762, -0.5349372, -0.535034, 
--0.5354202, -0.5359873, -0.5365253, -0.5368405, -0.5368633, -0.536688, -0.5365197, -0.5365601, -0.5368941, -0.5374426, 
--0.5380061, -0.5383765, -0.5384535, -0.538301, -0.5381113, -0.538098, -0.5383761, -0.5388976, -0.5394784, -0.5399006, 
--0.5400351, -0.5399134, -0.5397107, -0.5396477, -0.5398672, -0.5403542, -0.5409436, -0.541413, -0.5416068, -0.5415234, 
--0.5413165, -0.5412091, -0.5413688, -0.5418139, -0.5424031, -0.5429139, -0.5431677, -0.5431294, -0.5429272, -0.5427816, 
--0.5428815, -0.5432786, -0.5438585, -0.5444041, -0.5447172, -0.5447295, -0.5445411, -0.5443645, -0.544406, -0.5447499, 
--0.5453116, -0.5458842, -0.5462546, -0.5463223, -0.5461565, -0.5459569, -0.5459426, -0.5462292, -0.5467641, -0.5473555, 
--0.5477798, -0.5479064, -0.5477715, -0.5475575, -0.5474915, -0.547718, -0.548218, -0.5488193, -0.5492928, -0.5494805, 
--0.5493843, -0.5491649, -0.5490524, -0.5492173, -0.549675, -0.550277, -0.550794, -0.5510436, -0.550993, -0.5507776, 
--0.5506249, -0.550728, -0.5511368, -0.5517303, -0.5522839, -0.5525948, -0.552596, -0.5523938, -0.5522083, -0.5522508, 
--0.5526053, -0.553181, -0.5537634, -0.5541337, -0.5541916, -0.5540117, -0.5538015, -0.5537862, -0.5540819, -0.5546309, 
--0.5552336, -0.55566, -0.5557784, -0.5556294, -0.5554034, -0.5553341, -0.555568, -0.5560819, -0.5566959, -0.5571737, 
--0.557355, -0.5572451, -0.5570125, -0.5568946, -0.5570649, -0.557536, -0.5581518, -0.5586751, -0.5589203, -0.5588568, 
--0.5586272, -0.5584671, -0.5585736, -0.5589948, -0.5596028, -0.5601649, -0.5604735, -0.5604629, -0.5602458, -0.5600509, 
--0.5600946, -0.5604603, -0.561051, -0.5616437, -0.562014, -0.5620615, -0.5618664, -0.561645, -0.5616285, -0.5619339, 
--0.5624981, -0.5631128, -0.5635415, -0.5636511, -0.5634871, -0.5632482, -0.5631755, -0.5634173, -0.5639461, -0.5645735, 
--0.565056, -0.5652303, -0.5651058, -0.5648591, -0.5647355, -0.5649117, -0.5653969, -0.5660274, -0.5665577, -0.566798, 
--0.5667208, -0.566476, -0.5663079, -0.566418, -0.5668525, -0.5674761, -0.5680472, -0.5683533, -0.5683301, -0.5680972, 
--0.5678922, -0.5679372, -0.5683148, -0.5689215, -0.5695253, -0.5698955, -0.5699318, -0.5697207, -0.5694872, -0.5694696, 
--0.5697853, -0.5703656, -0.5709932, -0.5714243, -0.5715245, -0.5713445, -0.5710919, -0.5710155, -0.5712657, -0.5718103, 
--0.5724523, -0.5729396, -0.5731066, -0.5729665, -0.5727047, -0.5725749, -0.5727573, -0.5732578, -0.573904, -0.5744416, 
--0.5746769, -0.5745849, -0.574324, -0.5741473, -0.5742613, -0.57471, -0.5753501, -0.5759309, -0.5762345, -0.5761976, 
--0.5759479, -0.575732, -0.5757784, -0.5761688, -0.5767926, -0.5774083, -0.5777785, -0.5778028, -0.5775744, -0.5773281, 
--0.5773092, -0.577636, -0.5782335, -0.578875, -0.5793087, -0.5793988, -0.5792015, -0.5789343, -0.578854, -0.5791132, 
--0.5796748, -0.5803322, -0.5808249, -0.5809839, -0.5808272, -0.5805492, -0.5804127, -0.5806019, -0.5811187, -0.5817816, 
--0.5823272, -0.5825571, -0.5824492, -0.5821709, -0.581985, -0.5821032, -0.5825671, -0.5832251, -0.5838163, -0.584117, 
--0.5840657, -0.5837977, -0.5835702, -0.583618, -0.5840222, -0.5846645, -0.5852929, -0.5856631, -0.5856745, -0.5854276, 
--0.5851674, -0.5851471, -0.5854858, -0.5861019, -0.5867582, -0.5871948, -0.587274, -0.5870583, -0.5867753, -0.5866906, 
--0.5869596, -0.5875395, -0.5882135, -0.5887119, -0.5888625, -0.5886877, -0.5883923, -0.5882487, -0.5884451, -0.5889794, 
--0.5896605, -0.5902147, -0.5904386, -0.5903138, -0.5900167, -0.5898209, -0.5899436, -0.5904239, -0.591101, -0.5917035, 
--0.5920012, -0.5919342, -0.5916467, -0.5914067, -0.591456, -0.591875, -0.5925371, -0.5931793, -0.5935494, -0.593547, 
--0.5932801, -0.593005, -0.5929832, -0.5933347, -0.5939708, -0.5946432, -0.5950827, -0.5951503, -0.5949147, -0.5946146, 
--0.5945254, -0.5948047, -0.5954044, -0.5960964, -0.5966009, -0.5967424, -0.5965482, -0.5962339, -0.5960827, -0.5962868, 
--0.5968401, -0.5975408, -0.5981041, -0.5983217, -0.5981785, -0.5978613, -0.5976548, -0.5977822, -0.5982803, -0.5989782, 
--0.5995928, -0.5998872, -0.5998033, -0.5994946, -0.5992411, -0.5992921, -0.5997271, -0.6004106, -0.6010677, -0.6014378, 
--0.6014204, -0.6011318, -0.6008406, -0.6008171, -0.6011825, -0.6018403, -0.60253, -0.6029729, -0.6030278, -0.6027706, 
--0.6024521, -0.6023579, -0.6026486, -0.6032695, -0.6039811, -0.6044922, -0.6046238, -0.6044086, -0.6040739, -0.6039143, 
--0.6041269, -0.6047008, -0.6054226, -0.6059959, -0.6062067, -0.6060435, -0.6057044, -0.6054863, -0.605619, -0.6061363, 
--0.6068566, -0.6074844, -0.6077752, -0.607673, -0.6073414, -0.6070732, -0.607126, -0.6075783, -0.6082851, -0.6089584, 
--0.6093284, -0.6092947, -0.6089827, -0.608674, -0.6086488, -0.6090292, -0.6097104, -0.610419, -0.6108655, -0.6109067, 
--0.610626, -0.6102875, -0.6101878, -0.6104908, -0.611135, -0.6118677, -0.6123861, -0.6125069, -0.6122689, -0.6119121, 
--0.6117434, -0.6119651, -0.6125613, -0.6133062, -0.6138904, -0.6140937, -0.6139088, -0.6135459, -0.6133151, -0.6134535, 
--0.6139917, -0.6147365, -0.6153786, -0.6156656, -0.6155434, -0.6151868, -0.6149026, -0.6149574, -0.6154287, -0.6161608, 
--0.6168516, -0.6172216, -0.6171702, -0.6168327, -0.6165048, -0.6164777, -0.6168745, -0.6175814, -0.6183105, -0.6187609, 
--0.6187871, -0.6184809, -0.6181205, -0.6180149, -0.6183313, -0.6190008, -0.6197566, -0.620283, -0.620392, -0.620129, 
--0.619748, -0.6195694, -0.6198011, -0.6204217, -0.6211918, -0.6217879, -0.621983, -0.6217745, -0.6213855, -0.621141, 
--0.6212856, -0.6218466, -0.6226181, -0.6232759, -0.6235587, -0.6234146, -0.6230308, -0.622729, -0.622786, -0.6232779, 
--0.6240377, -0.6247479, -0.6251178, -0.625047, -0.6246815, -0.6243327, -0.6243035, -0.6247183, -0.6254532, -0.6262048, 
--0.6266595, -0.6266693, -0.6263352, -0.6259508, -0.6258387, -0.6261698, -0.6268671, -0.6276481, -0.6281832, -0.6282793, 
--0.627989, -0.6275815, -0.627392, -0.6276347, -0.628282, -0.6290797, -0.6296888, -0.629875, -0.6296405, -0.629223, 
--0.6289633, -0.6291147, -0.6297008, -0.6305017, -0.6311767, -0.6314549, -0.6312868, -0.630873, -0.630552, -0.6306113, 
--0.631126, -0.6319162, -0.6326475, -0.6330174, -0.6329253, -0.6325291, -0.6321573, -0.6321257, -0.6325602, -0.633326, 
--0.6341024, -0.6345618, -0.6345536, -0.6341886, -0.6337779, -0.6336587, -0.634006, -0.6347337, -0.6355427, -0.6360873, 
--0.6361692, -0.6358489, -0.6354121, -0.6352106, -0.6354654, -0.6361422, -0.6369704, -0.6375938, -0.6377702, -0.637507, 
--0.6370579, -0.6367815, -0.6369405, -0.6375542, -0.6383875, -0.6390815, -0.6393546, -0.6391601, -0.6387131, -0.6383709, 
--0.6384328, -0.6389726, -0.6397965, -0.6405512, -0.6409211, -0.6408054, -0.6403752, -0.6399779, -0.6399438, -0.6404001, 
--0.6412001, -0.6420038, -0.6424684, -0.6424403, -0.6420413, -0.6416013, -0.6414742, -0.6418394, -0.642601, -0.6434408, 
--0.643996, -0.6440622, -0.6437085, -0.6432393, -0.6430246, -0.6432927, -0.6440022, -0.6448641, -0.6455035, -0.645669, 
--0.645374, -0.64489, -0.6445951, -0.6447623, -0.6454067, -0.646276, -0.6469911, -0.6472586, -0.6470346, -0.6465509, 
--0.6461851, -0.6462499, -0.6468175, -0.6476788, -0.6484595, -0.6488294, -0.6486875, -0.6482195, -0.647794, -0.6477569, 
--0.6482376, -0.6490755, -0.6499096, -0.6503801, -0.6503298, -0.6498928, -0.6494204, -0.6492845, -0.6496696, -0.6504688, 
--0.651343, -0.6519101, -0.6519588, -0.6515679, -0.6510626, -0.6508331, -0.6511161, -0.651862, -0.6527616, -0.6534188, 
--0.6535721, -0.6532416, -0.6527186, -0.652403, -0.6525795, -0.6532582, -0.6541676, -0.6549063, -0.6551674, -0.6549107, 
--0.6543859, -0.6539937, -0.6540617, -0.6546605, -0.6555636, -0.6563733, -0.6567432, -0.6565721, -0.6560618, -0.6556046, 
--0.6555643, -0.6560721, -0.6569525, -0.6578208, -0.6582978, -0.6582227, -0.6577432, -0.6572344, -0.6570886, -0.657496, 
--0.6583375, -0.6592502, -0.6598305, -0.6598596, -0.6594271, -0.6588813, -0.6586351, -0.6589349, -0.6597216, -0.6606635, 
--0.6613406, -0.6614802, -0.66111, -0.6605431, -0.6602042, -0.6603912, -0.6611084, -0.662063, -0.6628282, -0.6630822, 
--0.6627886, -0.6622175, -0.6617957, -0.6618673, -0.6625012, -0.6634513, -0.6642938, -0.6646636, -0.6644595, -0.6639016, 
--0.6634088, -0.6633648, -0.6639033, -0.6648316, -0.6657383, -0.6662227, -0.6661195, -0.6655921, -0.6650422, -0.6648852, 
--0.6653179, -0.666207, -0.6671633, -0.6677585, -0.6677655, -0.6672858, -0.6666942, -0.6664293, -0.666748, -0.667581, 
--0.6685707, -0.6692704, -0.6693945, -0.6689792, -0.6683628, -0.6679975, -0.6681963, -0.6689571, -0.6699628, -0.6707581, 
--0.6710041, -0.6706686, -0.6700451, -0.6695896, -0.6696653, -0.670339, -0.6713426, -0.6722222, -0.672592, -0.6723504, 
--0.6717384, -0.6712051, -0.671157, -0.6717302, -0.672713, -0.6736635, -0.6741563, -0.6740212, -0.6734393, -0.6728426, 
--0.6726729, -0.6731342, -0.6740776, -0.6750835, -0.6756959, -0.6756776, -0.6751442, -0.6745004, -0.674214, -0.6745543, 
--0.67544, -0.6764843, -0.6772098, -0.6773163, -0.6768495, -0.6761764, -0.675781, -0.6759934, -0.676804, -0.6778682, 
--0.6786978, -0.6789346, -0.6785512, -0.6778678, -0.6773738, -0.6774542, -0.6781734, -0.6792381, -0.6801603, -0.6805301, 
--0.6802456, -0.6795716, -0.6789918, -0.6789389, -0.6795521, -0.6805974, -0.6815981, -0.6821005, -0.6819288, -0.6812842, 
--0.6806338, -0.6804495, -0.6809438, -0.6819497, -0.6830126, -0.6836445, -0.6835972, -0.6830021, -0.6822982, -0.6819871, 
--0.6823522, -0.6832987, -0.6844058, -0.6851611, -0.6852472, -0.6847211, -0.6839826, -0.6835525, -0.6837804, -0.6846486, 
--0.6857803, -0.6866497, -0.6868758, -0.6864371, -0.6856844, -0.6851458, -0.6852316, -0.6860035, -0.6871391, -0.6881105, 
--0.6884802, -0.6881461, -0.6874002, -0.6867665, -0.6867082, -0.6873676, -0.6884855, -0.6895444, -0.690058, -0.6898438, 
--0.6891265, -0.6884136, -0.6882124, -0.688745, -0.6898234, -0.6909527, -0.6916074, -0.6915263, -0.6908593, -0.6900854, 
--0.6897456, -0.6901396, -0.6911569, -0.6923373, -0.6931272, -0.6931897, -0.6925943, -0.6917795, -0.6913089, -0.691555, 
--0.6924904, -0.693701, -0.6946167, -0.6948305, -0.6943271, -0.6934932, -0.6929025, -0.6929947, -0.6938283, -0.6950467, 
--0.6960759, -0.6964456, -0.6960532, -0.6952231, -0.6945262, -0.6944615, -0.6951752, -0.6963782, -0.6975055, -0.6980323, 
--0.6977681, -0.6969653, -0.696179, -0.6959578, -0.6965355, -0.6976993, -0.6989067, -0.6995884, -0.6994674, -0.6987156, 
--0.6978593, -0.6974856, -0.6979137, -0.6990146, -0.7002815, -0.7011123, -0.7011468, -0.7004695, -0.6995646, -0.699046, 
--0.6993137, -0.7003286, -0.7016326, -0.7026033, -0.7028023, -0.7022222, -0.7012922, -0.7006397, -0.7007394, -0.7016463, 
--0.7029631, -0.7040609, -0.7044305, -0.7039689, -0.7030385, -0.7022666, -0.7021941, -0.7029725, -0.7042769, -0.7054857, 
--0.7060281, -0.7057045, -0.7047996, -0.7039257, -0.7036807, -0.7043123, -0.7055781, -0.7068788, -0.7075927, -0.7074241, 
--0.7065708, -0.7056157, -0.7052014, -0.7056704, -0.7068715, -0.7082422, -0.7091222, -0.709123, -0.7083474, -0.7073342, 
--0.7067579, -0.7070515, -0.7081621, -0.7095785, -0.7106153, -0.7107967, -0.7101242, -0.7090782, -0.7083511, -0.7084599, 
--0.7094552, -0.710891, -0.7120716, -0.7124412, -0.7118958, -0.7108442, -0.7099813, -0.7098994, -0.7107563, -0.7121835, 
--0.7134912, -0.7140526, -0.7136567, -0.7126279, -0.7116477, -0.7113736, -0.7120707, -0.7134607, -0.7148751, -0.7156281, 
--0.7154014, -0.7144245, -0.713349, -0.7128851, -0.713404, -0.7147275, -0.716225, -0.717165, -0.7171247, -0.7162289, 
--0.715083, -0.7144361, -0.7147614, -0.7159894, -0.7175437, -0.7186617, -0.7188214, -0.7180353, -0.7168468, -0.7160279, 
--0.7161478, -0.7172521, -0.7188343, -0.7201171, -0.7204866, -0.7198379, -0.7186366, -0.7176612, -0.7175679, -0.7185216, 
--0.720101, -0.7215311, -0.7221161, -0.7216305, -0.7204481, -0.7193357, -0.7190256, -0.7198042, -0.7213486, -0.7229043, 
--0.7237061, -0.7234072, -0.7222761, -0.7210503, -0.7205246, -0.7211058, -0.7225822, -0.7242383, -0.7252535, -0.7251617, 
--0.7241152, -0.722803, -0.7220675, -0.7224326, -0.723808, -0.7255356, -0.7267558, -0.7268881, -0.725959, -0.7245909, 
--0.7236563, -0.7237903, -0.7250321, -0.7267994, -0.7282114, -0.7285808, -0.7278012, -0.7264103, -0.7252924, -0.7251844, 
--0.7262612, -0.7280339, -0.7296196, -0.7302346, -0.7296349, -0.7282566, -0.7269758, -0.7266198, -0.7275023, -0.729244, 
--0.7309806, -0.7318448, -0.7314532, -0.7301246, -0.728706, -0.7281009, -0.7287623, -0.7304353, -0.7322955, -0.7334074, 
--0.7332491, -0.7320083, -0.7304814, -0.7296315, -0.7300482, -0.7316142, -0.7335664, -0.7349189, -0.7350157, -0.7339009, 
--0.7322994, -0.7312144, -0.7313668, -0.7327877, -0.7347964, -0.7363769, -0.7367462, -0.7357955, -0.7341563, -0.7328518, 
--0.7327247, -0.733963, -0.7359895, -0.7377798, -0.7384343, -0.7376842, -0.7360478, -0.7345447, -0.734128, -0.735148, 
--0.7371508, -0.7391269, -0.7400739, -0.7395594, -0.7379683, -0.7362934, -0.7355826, -0.7363507, -0.738286, -0.7404186, 
--0.7416599, -0.7414128, -0.7399116, -0.7380969, -0.7370933, -0.7375792, -0.7394019, -0.7416564, -0.7431874, -0.7432362, 
--0.7418706, -0.7399532, -0.7386645, -0.7388417, -0.7405059, -0.7428426, -0.7446525, -0.7450216, -0.7438375, -0.7418594, 
--0.7402996, -0.7401463, -0.7416061, -0.7439809, -0.7460523, -0.746761, -0.7458039, -0.7438113, -0.7420014, -0.7415008, 
--0.7427111, -0.7450759, -0.7473846, -0.7484467, -0.747761, -0.7458039, -0.7437712, -0.7429127, -0.7438303, -0.7461333, 
--0.7486484, -0.7500714, -0.7496992, -0.7478309, -0.7456097, -0.744389, -0.744973, -0.7471597, -0.7498436, -0.7516285, 
--0.751609, -0.7498852, -0.7475165, -0.7459361, -0.7461491, -0.7481626, -0.7509713, -0.7531117, -0.7534805, -0.7519588, 
--0.7494898, -0.7475599, -0.7473685, -0.7491506, -0.7520335, -0.7545155, -0.7553035, -0.7540428, -0.7515271, -0.7492655, 
--0.7486414, -0.7501329, -0.7530335, -0.7558353, -0.7570682, -0.7561275, -0.7536247, -0.7510573, -0.7499777, -0.7511196, 
--0.7539755, -0.7570669, -0.7587643, -0.7582027, -0.7557777, -0.7529389, -0.7513874, -0.7521213, -0.7548648, -0.7582072, 
--0.7603821, -0.7602573, -0.7579805, -0.7549133, -0.7528806, -0.7531493, -0.7557074, -0.7592535, -0.7619115, -0.7622797, 
--0.7602266, -0.7569827, -0.754467, -0.7542154, -0.7565105, -0.7602039, -0.7633427, -0.7642578, -0.7625085, -0.7591489, 
--0.7561567, -0.7553322, -0.7572816, -0.7610567, -0.7646656, -0.7661788, -0.7648182, -0.7614133, -0.7579598, -0.7565126, 
--0.758029, -0.7618106, -0.7658697, -0.7680294, -0.7671473, -0.7637775, -0.759887, -0.7577705, -0.7587616, -0.7624639, 
--0.766944, -0.7697952, -0.7694867, -0.7662432, -0.7619503, -0.7591208, -0.7594884, -0.7630143, -0.7678757, -0.7714607, 
--0.7718274, -0.7688136, -0.7641633, -0.7605799, -0.7602184, -0.7634577, -0.7686497, -0.7730084, -0.7741603, -0.7714939, 
--0.766543, -0.7621663, -0.7609606, -0.7637874, -0.7692468, -0.7744182, -0.7764768, -0.7742931, -0.7691115, -0.7639023, 
--0.7617234, -0.7639915, -0.7696411, -0.7756652, -0.7787688, -0.7772264, -0.7718994, -0.7658162, -0.7625142, -0.7640504, 
--0.7697956, -0.7767171, -0.7810297, -0.7803196, -0.7749521, -0.7679456, -0.7633387, -0.7639304, -0.7696546, -0.7775289, 
--0.783255, -0.7836164, -0.7783392, -0.7703452, -0.7641996, -0.763574, -0.7691292, -0.778033, -0.7854446, -0.7871932, 
--0.7821755, -0.7730999, -0.7650935, -0.762879, -0.7680692, -0.7781205, -0.7876068, -0.7911886, -0.7866613, -0.776353, 
--0.7660047, -0.761654, -0.7662014, -0.7775986, -0.789769, -0.7958728, -0.7921789, -0.7803706, -0.7668866, -0.7595074, 
--0.7629753, -0.7760878, -0.7920105, -0.8018331, -0.7995493, -0.7857139, -0.7676005, -0.7555187, -0.7571098, -0.7727213, 
--0.7945872, -0.8105953, -0.8108901, -0.7937985, -0.7676363, -0.7469606, -0.7448262, -0.7650139, -0.7986385, -0.827586, 
--0.8337152, -0.8094364, -0.7639612, -0.7211028, -0.7084537, -0.7422635, -0.8151184, -0.8930325, -0.9247449, -0.8604995, 
--0.6728922, -0.3708156, 0.0, 0.3704503, 0.6722587, 0.8597377, 0.9239591, 0.8922332, 0.8142165, 0.7411198, 
-0.7069572, 0.7192325, 0.761798, 0.8071178, 0.8313583, 0.8252221, 0.7961955, 0.7623568, 0.7418323, 0.7435885, 
-0.7639489, 0.7899278, 0.8069634, 0.8066639, 0.7905978, 0.7685458, 0.7526169, 0.7506474, 0.7623942, 0.7802962, 
-0.7940547, 0.796332, 0.7864695, 0.7703886, 0.7569809, 0.7531386, 0.7601664, 0.7734113, 0.7851193, 0.7888006, 
-0.7826716, 0.7703702, 0.7587023, 0.7537886, 0.7577751, 0.7678577, 0.7780403, 0.7825449, 0.7789488, 0.7693573, 
-0.7590616, 0.7535171, 0.7553585, 0.7630744, 0.7719972, 0.7769783, 0.7752223, 0.7677294, 0.7586086, 0.7527149, 
-0.7529625, 0.7587949, 0.7666084, 0.7718315, 0.7714654, 0.7656794, 0.7576162, 0.7515725, 0.7506022, 0.7548758, 
-0.7616737, 0.7669666, 0.7676706, 0.7633165, 0.7562341, 0.7501913, 0.74828, 0.751232, 0.7570789, 0.7623081, 
-0.7638388, 0.7607087, 0.754551, 0.7486281, 0.7459926, 0.7478084, 0.7527544, 0.757813, 0.7599752, 0.7579015, 
-0.7526224, 0.7469158, 0.7437334, 0.7445665, 0.7486551, 0.7534561, 0.7560874, 0.7549277, 0.7504854, 0.7450737, 
-0.7414941, 0.7414778, 0.7447501, 0.7492226, 0.7521843, 0.7518129, 0.7481661, 0.743113, 0.7392655, 0.738519, 
-0.7410171, 0.7451041, 0.7482753, 0.7485781, 0.7456838, 0.74104, 0.7370378, 0.735671, 0.7374389, 0.7410957, 
-0.7443702, 0.7452414, 0.7430541, 0.7388586, 0.7348013, 0.7329164, 0.7340014, 0.7371945, 0.7404789, 0.7418193, 
-0.7402901, 0.7365711, 0.7325461, 0.7302396, 0.7306922, 0.7333986, 0.736611, 0.7383269, 0.7374035, 0.734179, 
-0.730263, 0.7276259, 0.7274999, 0.7297065, 0.7327754, 0.7347784, 0.7344056, 0.7316838, 0.7279432, 0.7250613, 
-0.7244136, 0.7261166, 0.7289808, 0.7311874, 0.731307, 0.7290874, 0.7255786, 0.7225328, 0.7214225, 0.7226269, 
-0.7252347, 0.7275669, 0.7281185, 0.7263921, 0.7231618, 0.7200275, 0.7185161, 0.7192346, 0.721544, 0.7239291, 
-0.7248507, 0.723601, 0.7206867, 0.7175336, 0.7156834, 0.7159363, 0.7179144, 0.7202857, 0.7215146, 0.7207179, 
-0.718148, 0.7150398, 0.7129138, 0.7127277, 0.7143507, 0.7166475, 0.718121, 0.7177476, 0.7155415, 0.7125355, 
-0.7101961, 0.7096038, 0.7108563, 0.7130248, 0.7146807, 0.7146954, 0.7128642, 0.7100111, 0.7075197, 0.7065587, 
-0.7074338, 0.7094267, 0.7112046, 0.7115677, 0.7101145, 0.7074578, 0.7048738, 0.7035857, 0.7040841, 0.7058614, 
-0.7077033, 0.7083714, 0.7072917, 0.704868, 0.7022479, 0.7006775, 0.7008074, 0.7023362, 0.7041872, 0.7051141, 
-0.7043963, 0.7022348, 0.6996318, 0.6978263, 0.6976024, 0.6988573, 0.7006661, 0.701804, 0.7014303, 0.6995527, 
-0.6970159, 0.6950238, 0.694467, 0.6954296, 0.6971495, 0.6984495, 0.6983963, 0.6968174, 0.694391, 0.6922612, 
-0.6913976, 0.6920569, 0.6936461, 0.6950594, 0.6952982, 0.6940256, 0.6917488, 0.6895299, 0.6883901, 0.6887419, 
-0.6901639, 0.6916426, 0.6921407, 0.6911752, 0.6890816, 0.6868208, 0.6854394, 0.685486, 0.6867103, 0.6882079, 
-0.6889294, 0.6882654, 0.6863827, 0.6841253, 0.6825394, 0.6822895, 0.6832913, 0.6847639, 0.6856704, 0.6852965, 
-0.6836464, 0.6814348, 0.6796838, 0.6791516, 0.6799123, 0.6813192, 0.6823705, 0.6822699, 0.6808678, 0.678741, 
-0.6768655, 0.6760704, 0.6765775, 0.6778815, 0.679037, 0.6791878, 0.6780433, 0.6760363, 0.6740771, 0.6730431, 
-0.6732902, 0.6744585, 0.6756773, 0.6760537, 0.6751702, 0.6733136, 0.6713112, 0.6700657, 0.6700523, 0.6710567, 
-0.6722989, 0.6728718, 0.6722469, 0.6705665, 0.6685601, 0.6671339, 0.6668651, 0.6676822, 0.6689095, 0.6696468, 
-0.6692729, 0.6677894, 0.6658163, 0.6642423, 0.6637283, 0.6643403, 0.6655165, 0.6663845, 0.6662488, 0.6649775, 
-0.6630724, 0.6613852, 0.660641, 0.6610351, 0.6621272, 0.6630908, 0.6631761, 0.6621271, 0.6603215, 0.6585563, 
-0.6576013, 0.65777, 0.6587481, 0.6597721, 0.6600572, 0.6592352, 0.657557, 0.6557492, 0.6546062, 0.6545475, 
-0.6553857, 0.6564349, 0.6568953, 0.6563, 0.6547731, 0.6529571, 0.6516521, 0.6513688, 0.6520456, 0.6530861, 
-0.6536945, 0.6533205, 0.6519642, 0.6501734, 0.6487348, 0.6482346, 0.6487327, 0.6497321, 0.6504594, 0.6502968, 
-0.649126, 0.6473915, 0.6458492, 0.6451442, 0.6454511, 0.6463796, 0.6471951, 0.6472298, 0.6462547, 0.644605, 
-0.6429901, 0.6420963, 0.6422042, 0.6430347, 0.6439072, 0.6441213, 0.6433473, 0.641808, 0.6401518, 0.6390887, 
-0.6389946, 0.6397031, 0.6406014, 0.6409739, 0.6404017, 0.638995, 0.6373283, 0.6361184, 0.6358238, 0.6363902, 
-0.6372838, 0.6377909, 0.6374169, 0.6361609, 0.6345136, 0.6331818, 0.6326925, 0.6331006, 0.6339604, 0.6345764, 
-0.6343925, 0.6333014, 0.6317019, 0.6302746, 0.6296006, 0.6298383, 0.6306369, 0.6313346, 0.6313291, 0.6304128, 
-0.6288873, 0.6273921, 0.6265471, 0.6266065, 0.6273191, 0.6280707, 0.628228, 0.6274924, 0.6260643, 0.6245294, 
-0.6235303, 0.6234078, 0.6240124, 0.6247896, 0.6250914, 0.6245379, 0.6232277, 0.6216811, 0.6205477, 0.6202439, 
-0.6207215, 0.6214968, 0.6219222, 0.6215481, 0.620373, 0.6188418, 0.6175962, 0.6171157, 0.617451, 0.6181977, 
-0.6187236, 0.6185225, 0.6174959, 0.6160061, 0.614672, 0.6140232, 0.6142047, 0.6148977, 0.6154997, 0.6154614, 
-0.6145931, 0.6131686, 0.611771, 0.6109658, 0.6109856, 0.611602, 0.6122549, 0.6123659, 0.6116616, 0.6103243, 
-0.6088887, 0.607942, 0.6077963, 0.6083156, 0.6089937, 0.6092377, 0.6086994, 0.6074685, 0.6060204, 0.6049498, 
-0.6046385, 0.605043, 0.605721, 0.6060792, 0.6057051, 0.6045966, 0.603161, 0.6019864, 0.6015132, 0.6017885, 
-0.6024419, 0.6028934, 0.6026781, 0.6017048, 0.6003055, 0.5990486, 0.5984206, 0.5985555, 0.5991612, 0.5996839, 
-0.5996185, 0.5987899, 0.5974492, 0.5961326, 0.5953603, 0.5953473, 0.5958838, 0.5964546, 0.5965272, 0.595849, 
-0.5945873, 0.5932343, 0.5923311, 0.592166, 0.5926144, 0.5932097, 0.5934055, 0.59288, 0.5917152, 0.5903493, 
-0.5893312, 0.5890136, 0.5893571, 0.5899538, 0.5902557, 0.5898817, 0.5888289, 0.5874733, 0.5863582, 0.585891, 
-0.586116, 0.5866912, 0.5870804, 0.5868532, 0.5859247, 0.5846014, 0.5834092, 0.5827987, 0.5828945, 0.5834267, 
-0.5838828, 0.5837946, 0.5829994, 0.5817293, 0.5804807, 0.5797363, 0.5796955, 0.5801647, 0.5806664, 0.5807065, 
-0.5800503, 0.5788524, 0.5775691, 0.5767027, 0.5765213, 0.5769097, 0.5774352, 0.5775902, 0.5770755, 0.5759666, 
-0.5746703, 0.5736966, 0.5733736, 0.5736655, 0.5741932, 0.5744475, 0.5740735, 0.573068, 0.5717802, 0.5707157, 
-0.5702536, 0.5704359, 0.5709446, 0.5712809, 0.5710436, 0.5701531, 0.5688945, 0.5677573, 0.5671617, 0.5672242, 
-0.5676938, 0.5680932, 0.5679856, 0.5672188, 0.5660089, 0.5648184, 0.5640976, 0.5640332, 0.564445, 0.5648877, 
-0.5649001, 0.5642627, 0.5631193, 0.5618955, 0.5610606, 0.5608652, 0.5612022, 0.561668, 0.5617881, 0.5612827, 
-0.5602217, 0.558985, 0.5580493, 0.5577217, 0.5579692, 0.5584379, 0.5586514, 0.5582774, 0.5573125, 0.5560829, 
-0.5550617, 0.554604, 0.5547496, 0.5552013, 0.555492, 0.5552461, 0.5543883, 0.5531853, 0.5520954, 0.5515126, 
-0.5515465, 0.5519623, 0.5523128, 0.5521885, 0.5514463, 0.5502881, 0.5491477, 0.5484473, 0.5483625, 0.5487248, 
-0.5491165, 0.5491051, 0.5484839, 0.5473875, 0.5462152, 0.5454074, 0.5451998, 0.5454926, 0.5459067, 0.5459967, 
-0.5454993, 0.5444797, 0.5432946, 0.5423917, 0.5420602, 0.5422693, 0.5426868, 0.542865, 0.5424911, 0.5415613, 
-0.5403822, 0.5393985, 0.5389446, 0.5390584, 0.5394606, 0.5397119, 0.5394584, 0.538629, 0.5374743, 0.5364255, 
-0.5358537, 0.5358627, 0.5362318, 0.5365398, 0.5364011, 0.5356802, 0.5345671, 0.5334701, 0.5327874, 0.5326849, 
-0.5330041, 0.5333516, 0.5333193, 0.5327123, 0.5316569, 0.5305293, 0.5297452, 0.5295271, 0.5297812, 0.5301503, 
-0.530214, 0.5297236, 0.5287402, 0.5276, 0.5267258, 0.5263908, 0.5265664, 0.5269393, 0.5270866, 0.5267127, 
-0.5258137, 0.5246786, 0.5237277, 0.5232772, 0.5233631, 0.523722, 0.5239388, 0.5236788, 0.5228743, 0.5217617, 
-0.5207489, 0.5201868, 0.520174, 0.5205021, 0.520773, 0.5206216, 0.5199194, 0.5188457, 0.5177869, 0.5171198, 
-0.5170017, 0.517283, 0.5175917, 0.5175412, 0.5169466, 0.5159272, 0.5148389, 0.5140755, 0.5138481, 0.5140683, 
-0.5143979, 0.5144386, 0.5139543, 0.5130026, 0.5119019, 0.5110529, 0.5107148, 0.5108611, 0.5111946, 0.5113148, 
-0.510941, 0.510069, 0.5089727, 0.5080507, 0.507603, 0.5076645, 0.5079853, 0.5081717, 0.5079059, 0.5071233, 
-0.5060479, 0.5050668, 0.5045133, 0.5044812, 0.5047732, 0.5050113, 0.5048487, 0.504163, 0.5031242, 0.502099, 
-0.5014456, 0.5013137, 0.5015617, 0.5018361, 0.5017696, 0.501186, 0.5001982, 0.4991447, 0.4983995, 0.4981639, 
-0.4983541, 0.4986488, 0.4986692, 0.4981903, 0.4972668, 0.496201, 0.4953742, 0.4950334, 0.4951536, 0.4954524, 
-0.4955486, 0.4951749, 0.4943268, 0.4932648, 0.4923683, 0.4919233, 0.491963, 0.4922501, 0.4924096, 0.4921387, 
-0.4913755, 0.4903331, 0.48938, 0.488834, 0.4887849, 0.4890449, 0.489254, 0.4890814, 0.4884104, 0.4874025, 
-0.4864071, 0.4857658, 0.4856218, 0.4858402, 0.4860841, 0.4860033, 0.4854294, 0.4844699, 0.4834472, 0.4827183, 
-0.4824754, 0.482639, 0.4829026, 0.4829048, 0.4824309, 0.4815323, 0.4804976, 0.4796906, 0.4793474, 0.4794444, 
-0.4797123, 0.4797871, 0.4794134, 0.4785866, 0.4775553, 0.4766815, 0.4762387, 0.4762591, 0.4765161, 0.4766517, 
-0.4763762, 0.4756303, 0.4746173, 0.4736893, 0.47315, 0.4730857, 0.4733171, 0.4735003, 0.4733189, 0.472661, 
-0.4716807, 0.4707119, 0.4700814, 0.4699265, 0.4701184, 0.4703352, 0.4702416, 0.4696765, 0.4687422, 0.467747, 
-0.4670326, 0.4667832, 0.4669229, 0.4671588, 0.4671449, 0.4666753, 0.465799, 0.4647921, 0.4640028, 0.4636574, 
-0.4637336, 0.4639739, 0.4640297, 0.463656, 0.4628483, 0.4618443, 0.4609909, 0.4605501, 0.4605531, 0.4607833, 
-0.4608974, 0.4606179, 0.4598875, 0.4589008, 0.4579952, 0.4574619, 0.457384, 0.4575898, 0.4577498, 0.4575605, 
-0.4569143, 0.4559587, 0.4550138, 0.454393, 0.4542282, 0.4543964, 0.4545889, 0.4544839, 0.4539266, 0.4530149, 
-0.4520444, 0.4513431, 0.4510878, 0.4512061, 0.4514171, 0.4513887, 0.450923, 0.4500668, 0.4490848, 0.4483114, 
-0.447964, 0.4480216, 0.448237, 0.4482757, 0.4479021, 0.4471115, 0.4461321, 0.4452969, 0.444858, 0.4448454, 
-0.4450513, 0.4451462, 0.4448631, 0.4441466, 0.4431836, 0.4422981, 0.4417703, 0.44168, 0.4418628, 0.4420019, 
-0.4418056, 0.4411699, 0.4402366, 0.4393131, 0.4387011, 0.4385275, 0.4386743, 0.4388449, 0.4387297, 0.4381794, 
-0.4372881, 0.4363398, 0.4356502, 0.4353896, 0.4354886, 0.4356772, 0.4356357, 0.4351736, 0.4343355, 0.4333759, 
-0.4326169, 0.4322676, 0.4323084, 0.4325015, 0.4325247, 0.4321512, 0.4313761, 0.4304188, 0.4296001, 0.4291628, 
-0.4291362, 0.4293203, 0.4293977, 0.4291114, 0.4284075, 0.4274659, 0.4265985, 0.4260755, 0.4259742, 0.4261362, 
-0.4262565, 0.4260538, 0.4254276, 0.4245144, 0.4236103, 0.4230061, 0.4228245, 0.4229521, 0.4231028, 0.4229784, 
-0.4224345, 0.4215616, 0.4206334, 0.4199543, 0.4196889, 0.4197706, 0.4199389, 0.4198856, 0.4194267, 0.4186049, 
-0.4176657, 0.4169195, 0.4165687, 0.4165942, 0.4167671, 0.4167764, 0.4164029, 0.4156418, 0.4147046, 0.4139008, 
-0.4134649, 0.4134255, 0.4135899, 0.4136517, 0.4133623, 0.4126699, 0.4117476, 0.4108967, 0.4103781, 0.4102667, 
-0.4104099, 0.4105131, 0.4103046, 0.4096872, 0.4087921, 0.4079055, 0.4073085, 0.4071197, 0.4072298, 0.4073626, 
-0.4072297, 0.4066917, 0.4058354, 0.4049254, 0.4042559, 0.4039861, 0.404052, 0.404202, 0.4041381, 0.403682, 
-0.4028751, 0.4019542, 0.4012198, 0.4008675, 0.4008792, 0.4010337, 0.4010303, 0.400657, 0.3999086, 0.3989895, 
-0.3981992, 0.3977646, 0.3977137, 0.3978602, 0.3979077, 0.3976157, 0.3969337, 0.3960289, 0.3951928, 0.3946782, 
-0.3945577, 0.3946839, 0.3947716, 0.3945579, 0.3939483, 0.3930697, 0.3921991, 0.3916085, 0.3914131, 0.3915073, 
-0.3916238, 0.3914834, 0.3909507, 0.3901095, 0.3892161, 0.3885552, 0.3882815, 0.388333, 0.3884663, 0.3883927, 
-0.3879393, 0.3871458, 0.3862417, 0.3855179, 0.3851642, 0.3851634, 0.3853013, 0.3852864, 0.3849131, 0.3841762, 
-0.3832737, 0.3824957, 0.3820623, 0.3820009, 0.382131, 0.3821656, 0.3818712, 0.3811986, 0.3803097, 0.3794873, 
-0.3789762, 0.3788474, 0.378958, 0.3790317, 0.3788132, 0.3782108, 0.3773473, 0.3764911, 0.3759064, 0.375705, 
-0.3757847, 0.3758865, 0.3757392, 0.3752112, 0.3743839, 0.3735055, 0.3728525, 0.3725751, 0.3726136, 0.3727317, 
-0.3726493, 0.3721983, 0.3714171, 0.3705283, 0.3698141, 0.3694592, 0.369447, 0.3695696, 0.3695443, 0.3691711, 
-0.3684447, 0.3675573, 0.3667904, 0.3663581, 0.3662871, 0.3664024, 0.3664252, 0.3661286, 0.3654646, 0.3645903, 
-0.3637801, 0.3632724, 0.363136, 0.3632324, 0.3632933, 0.3630705, 0.3624746, 0.3616248, 0.3607818, 0.3602024, 
-0.3599955, 0.3600621, 0.3601503, 0.3599967, 0.3594732, 0.3586585, 0.3577938, 0.357148, 0.3568673, 0.3568938, 
-0.3569981, 0.3569076, 0.3564589, 0.3556889, 0.354814, 0.3541086, 0.3537525, 0.3537299, 0.3538387, 0.3538038, 
-0.3534307, 0.352714, 0.3518403, 0.3510836, 0.3506522, 0.3505724, 0.3506742, 0.3506862, 0.3503877, 0.3497315, 
-0.3488705, 0.3480716, 0.3475668, 0.3474235, 0.347507, 0.3475562, 0.3473295, 0.3467395, 0.3459022, 0.3450713, 
-0.3444967, 0.3442849, 0.3443394, 0.3444153, 0.344256, 0.3437365, 0.3429332, 0.3420811, 0.3414418, 0.3411581, 
-0.3411737, 0.3412654, 0.3411676, 0.3407209, 0.3399612, 0.3390989, 0.3384016, 0.3380444, 0.3380122, 0.3381084, 
-0.3380648, 0.3376918, 0.3369839, 0.3361227, 0.3353753, 0.3349448, 0.334857, 0.3349464, 0.3349486, 0.3346483, 
-0.3339993, 0.3331504, 0.3323618, 0.3318597, 0.33171, 0.3317817, 0.3318203, 0.3315899, 0.3310055, 0.3301797, 
-0.3293597, 0.3287896, 0.3285731, 0.3286166, 0.3286813, 0.3285167, 0.3280009, 0.3272082, 0.3263675, 0.3257342, 
-0.3254477, 0.3254533, 0.3255334, 0.3254289, 0.3249842, 0.3242338, 0.3233831, 0.3226932, 0.322335, 0.322294, 
-0.3223786, 0.3223271, 0.3219542, 0.3212544, 0.3204047, 0.3196658, 0.319236, 0.3191409, 0.319219, 0.3192122, 
-0.3189102, 0.3182679, 0.3174301, 0.3166509, 0.3161512, 0.3159957, 0.3160566, 0.3160854, 0.3158518, 0.3152724, 
-0.314457, 0.3136472, 0.313081, 0.3128603, 0.3128938, 0.3129482, 0.3127789, 0.3122664, 0.3114833, 0.3106531, 
-0.3100252, 0.3097361, 0.3097327, 0.3098022, 0.3096916, 0.3092486, 0.3085068, 0.3076667, 0.3069835, 0.3066244, 
-0.3065754, 0.3066494, 0.3065907, 0.3062179, 0.3055254, 0.3046862, 0.303955, 0.303526, 0.3034241, 0.3034919, 
-0.3034769, 0.3031735, 0.3025371, 0.3017095, 0.3009389, 0.3004415, 0.3002806, 0.3003316, 0.3003515, 0.3001149, 
-0.2995402, 0.2987343, 0.2979337, 0.2973712, 0.2971466, 0.2971709, 0.2972158, 0.2970422, 0.2965329, 0.2957586, 
-0.2949379, 0.2943151, 0.2940236, 0.2940118, 0.2940716, 0.2939555, 0.2935141, 0.2927802, 0.2919498, 0.2912726, 
-0.2909127, 0.2908564, 0.2909207, 0.2908553, 0.2904827, 0.289797, 0.2889674, 0.2882433, 0.2878148, 0.2877068, 
-0.2877651, 0.2877426, 0.2874378, 0.2868071, 0.2859887, 0.2852259, 0.2847306, 0.2845648, 0.2846068, 0.2846185, 
-0.2843792, 0.2838087, 0.2830116, 0.2822194, 0.2816602, 0.2814321, 0.2814479, 0.2814843, 0.2813067, 0.2808003, 
-0.280034, 0.2792221, 0.2786038, 0.2783101, 0.2782906, 0.2783417, 0.2782204, 0.2777806, 0.2770538, 0.2762323, 
-0.2755608, 0.2752, 0.275137, 0.2751925, 0.275121, 0.2747485, 0.274069, 0.2732482, 0.2725305, 0.2721026, 
-0.271989, 0.2720386, 0.2720093, 0.2717033, 0.2710776, 0.2702677, 0.2695121, 0.2690186, 0.2688484, 0.268882, 
-0.2688863, 0.2686446, 0.2680779, 0.2672889, 0.2665043, 0.2659482, 0.2657168, 0.2657249, 0.2657534, 0.2655722, 
-0.2650684, 0.2643096, 0.2635056, 0.2628914, 0.2625958, 0.2625693, 0.2626123, 0.2624864, 0.2620479, 0.2613278, 
-0.2605143, 0.2598479, 0.2594864, 0.2594172, 0.2594646, 0.2593876, 0.2590152, 0.2583414, 0.2575286, 0.2568169, 
-0.2563895, 0.2562706, 0.2563123, 0.2562768, 0.2559697, 0.2553487, 0.2545466, 0.2537975, 0.2533057, 0.2531313, 
-0.2531574, 0.2531548, 0.2529109, 0.2523478, 0.2515662, 0.2507886, 0.2502352, 0.2500009, 0.2500018, 0.2500232, 
-0.2498387, 0.2493374, 0.2485853, 0.2477886, 0.2471782, 0.2468807, 0.2468478, 0.2468834, 0.2467533, 0.2463161, 
-0.245602, 0.2447959, 0.2441341, 0.2437719, 0.2436971, 0.2437371, 0.2436551, 0.2432828, 0.2426142, 0.2418088, 
-0.2411024, 0.2406754, 0.2405518, 0.2405863, 0.2405451, 0.240237, 0.2396202, 0.2388253, 0.2380822, 0.2375918, 
-0.2374137, 0.2374328, 0.2374241, 0.2371781, 0.2366183, 0.2358434, 0.2350722, 0.2345213, 0.2342842, 0.2342787, 
-0.2342935, 0.2341061, 0.233607, 0.2328611, 0.232071, 0.231464, 0.2311648, 0.2311261, 0.2311549, 0.231021, 
-0.230585, 0.2298764, 0.2290771, 0.2284195, 0.2280566, 0.2279767, 0.22801, 0.2279234, 0.2275513, 0.2268874, 
-0.2260887, 0.2253872, 0.2249605, 0.2248326, 0.2248605, 0.2248141, 0.2245052, 0.2238923, 0.2231038, 0.2223661, 
-0.2218771, 0.2216955, 0.2217083, 0.221694, 0.2214462, 0.2208894, 0.2201206, 0.2193552, 0.2188066, 0.2185669, 
-0.2185556, 0.2185645, 0.2183743, 0.2178773, 0.217137, 0.216353, 0.2157491, 0.2154483, 0.2154042, 0.215427, 
-0.2152896, 0.2148546, 0.2141511, 0.2133579, 0.2127041, 0.2123406, 0.212256, 0.2122832, 0.2121925, 0.2118205, 
-0.2111609, 0.2103683, 0.2096712, 0.2092449, 0.209113, 0.2091349, 0.2090838, 0.2087741, 0.2081648, 0.2073822, 
-0.2066494, 0.2061616, 0.2059769, 0.205984, 0.2059645, 0.2057151, 0.205161, 0.2043977, 0.2036376, 0.2030911, 
-0.2028491, 0.2028324, 0.2028359, 0.2026433, 0.2021481, 0.201413, 0.2006344, 0.2000333, 0.1997311, 0.1996821, 
-0.1996994, 0.1995589, 0.1991249, 0.1984259, 0.1976384, 0.196988, 0.1966239, 0.1965351, 0.1965566, 0.1964622, 
-0.1960904, 0.1954348, 0.1946476, 0.1939546, 0.1935285, 0.1933931, 0.1934094, 0.1933541, 0.1930438, 0.1924377, 
-0.1916604, 0.1909321, 0.1904454, 0.1902578, 0.1902597, 0.1902356, 0.1899847, 0.1894331, 0.1886749, 0.1879195, 
-0.1873748, 0.1871307, 0.1871092, 0.1871078, 0.186913, 0.1864196, 0.1856891, 0.1849155, 0.1843169, 0.1840133, 
-0.18396, 0.1839722, 0.1838289, 0.1833959, 0.182701, 0.1819185, 0.1812712, 0.1809066, 0.1808139, 0.1808304, 
-0.1807326, 0.180361, 0.1797089, 0.1789268, 0.1782373, 0.1778114, 0.1776727, 0.1776842, 0.1776251, 0.1773142, 
-0.176711, 0.1759386, 0.1752142, 0.1747284, 0.1745382, 0.1745354, 0.1745072, 0.1742551, 0.1737057, 0.172952, 
-0.1722009, 0.1716579, 0.1714119, 0.1713859, 0.1713801, 0.1711835, 0.1706916, 0.1699652, 0.1691961, 0.1685997, 
-0.168295, 0.1682376, 0.1682454, 0.1680995, 0.1676674, 0.1669763, 0.1661983, 0.1655538, 0.1651886, 0.1650924, 
-0.1651045, 0.1650037, 0.1646322, 0.1639834, 0.1632057, 0.1625194, 0.1620937, 0.1619521, 0.1619591, 0.1618966, 
-0.1615852, 0.1609847, 0.1602166, 0.1594958, 0.1590108, 0.1588183, 0.1588112, 0.1587793, 0.158526, 0.1579788, 
-0.1572292, 0.1564819, 0.1559402, 0.1556925, 0.1556626, 0.1556529, 0.1554545, 0.1549641, 0.1542415, 0.1534764, 
-0.152882, 0.1525761, 0.1525152, 0.1525189, 0.1523708, 0.1519395, 0.1512518, 0.1504777, 0.1498357, 0.1494701, 
-0.1493707, 0.1493788, 0.1492753, 0.148904, 0.1482581, 0.1474844, 0.146801, 0.1463754, 0.1462311, 0.1462342, 
-0.1461687, 0.1458569, 0.1452588, 0.1444945, 0.1437769, 0.1432926, 0.1430979, 0.1430871, 0.1430519, 0.1427977, 
-0.1422522, 0.1415063, 0.1407624, 0.140222, 0.1399727, 0.1399393, 0.1399261, 0.1397262, 0.1392371, 0.1385179, 
-0.1377562, 0.1371636, 0.1368567, 0.1367926, 0.1367927, 0.1366427, 0.1362121, 0.1355274, 0.1347569, 0.1341171, 
-0.133751, 0.1336488, 0.1336533, 0.1335475, 0.1331764, 0.1325331, 0.1317629, 0.131082, 0.1306565, 0.1305098, 
-0.1305095, 0.1304413, 0.1301291, 0.1295332, 0.1287723, 0.1280575, 0.1275738, 0.1273772, 0.1273631, 0.127325, 
-0.1270699, 0.1265261, 0.1257834, 0.1250425, 0.1245031, 0.1242524, 0.1242159, 0.1241997, 0.1239985, 0.1235106, 
-0.1227943, 0.1220358, 0.1214446, 0.1211367, 0.1210699, 0.1210669, 0.1209152, 0.1204853, 0.1198032, 0.1190359, 
-0.1183979, 0.1180313, 0.1179267, 0.1179281, 0.1178203, 0.1174493, 0.1168083, 0.1160412, 0.1153625, 0.114937, 
-0.1147883, 0.1147849, 0.1147144, 0.1144019, 0.1138079, 0.11305, 0.1123376, 0.1118544, 0.1116561, 0.1116391, 
-0.1115985, 0.1113427, 0.1108004, 0.1100605, 0.1093222, 0.1087837, 0.1085317, 0.1084925, 0.1084737, 0.1082714, 
-0.1077845, 0.1070708, 0.106315, 0.105725, 0.1054164, 0.105347, 0.1053414, 0.1051882, 0.1047589, 0.1040792, 
-0.1033146, 0.1026781, 0.1023112, 0.1022044, 0.102203, 0.1020935, 0.1017228, 0.1010838, 0.1003193, 0.0996425, 
-0.099217, 0.0990664, 0.0990604, 0.0989879, 0.0986753, 0.0980829, 0.0973276, 0.0966172, 0.0961344, 0.0959346, 
-0.0959151, 0.0958724, 0.095616, 0.0950751, 0.0943376, 0.0936014, 0.0930637, 0.0928106, 0.0927691, 0.092748, 
-0.0925448, 0.0920589, 0.0913474, 0.0905938, 0.090005, 0.0896955, 0.0896241, 0.0896161, 0.0894618, 0.0890331, 
-0.0883553, 0.087593, 0.0869579, 0.0865905, 0.0864819, 0.0864782, 0.0863673, 0.0859968, 0.0853595, 0.0845973, 
-0.083922, 0.0834965, 0.0833443, 0.083336, 0.083262, 0.0829492, 0.0823582, 0.0816051, 0.0808965, 0.0804139, 
-0.0802129, 0.0801912, 0.0801467, 0.0798899, 0.0793501, 0.0786147, 0.0778803, 0.0773432, 0.0770891, 0.0770456, 
-0.0770227, 0.0768188, 0.0763336, 0.0756241, 0.0748724, 0.0742843, 0.0739742, 0.073901, 0.0738911, 0.0737359, 
-0.0733077, 0.0726316, 0.0718712, 0.0712371, 0.0708694, 0.0707592, 0.0707536, 0.0706415, 0.0702712, 0.0696354, 
-0.0688751, 0.068201, 0.0677754, 0.0676219, 0.0676118, 0.0675364, 0.0672236, 0.0666339, 0.0658826, 0.0651752, 
-0.0646929, 0.0644907, 0.0644673, 0.0644214, 0.0641644, 0.0636255, 0.0628917, 0.0621589, 0.0616221, 0.0613672, 
-0.0613221, 0.0612977, 0.0610933, 0.0606088, 0.0599008, 0.0591506, 0.0585632, 0.0582525, 0.0581778, 0.0581664, 
-0.0580105, 0.0575827, 0.056908, 0.0561491, 0.0555158, 0.0551478, 0.0550363, 0.0550292, 0.0549163, 0.0545462, 
-0.0539116, 0.0531528, 0.0524796, 0.0520539, 0.0518992, 0.0518877, 0.0518113, 0.0514985, 0.0509098, 0.0501599, 
-0.0494536, 0.0489714, 0.0487683, 0.0487435, 0.0486966, 0.0484393, 0.0479012, 0.0471688, 0.046437, 0.0459006, 
-0.0456449, 0.0455985, 0.045573, 0.0453683, 0.0448844, 0.0441776, 0.0434286, 0.0428416, 0.0425304, 0.0424545, 
-0.042442, 0.0422855, 0.0418582, 0.0411846, 0.0404268, 0.0397941, 0.0394257, 0.0393132, 0.039305, 0.0391915, 
-0.0388216, 0.0381879, 0.0374302, 0.0367577, 0.0363318, 0.0361763, 0.0361637, 0.0360867, 0.035774, 0.035186, 
-0.0344372, 0.0337316, 0.0332493, 0.0330455, 0.0330198, 0.032972, 0.0327147, 0.0321773, 0.0314459, 0.0307149, 
-0.0301785, 0.0299223, 0.0298749, 0.0298487, 0.0296438, 0.0291604, 0.0284545, 0.0277062, 0.0271194, 0.0268078, 
-0.0267311, 0.0267178, 0.0265611, 0.0261342, 0.0254613, 0.0247043, 0.0240719, 0.0237032, 0.0235899, 0.023581, 
-0.0234671, 0.0230976, 0.0224646, 0.0217076, 0.0210354, 0.0206093, 0.0204532, 0.0204398, 0.0203624, 0.0200499, 
-0.0194626, 0.0187144, 0.0180092, 0.0175268, 0.0173225, 0.017296, 0.0172479, 0.0169907, 0.0164538, 0.0157229, 
-0.0149923, 0.0144559, 0.0141992, 0.0141513, 0.0141246, 0.0139197, 0.0134368, 0.0127315, 0.0119836, 0.0113968, 
-0.0110848, 0.0110075, 0.0109939, 0.0108371, 0.0104105, 0.0097382, 0.0089816, 0.0083492, 0.0079802, 0.0078665, 
-0.0078572, 0.0077432, 0.0073739, 0.0067414, 0.0059848, 0.0053126, 0.0048863, 0.0047298, 0.0047161, 0.0046386, 
-0.0043263, 0.0037393, 0.0029915, 0.0022864, 0.0018038, 0.0015991, 0.0015723, 0.0015242, 0.0012671, 0.0007306, 
--0.0, -0.0007306, -0.0012671, -0.0015242, -0.0015723, -0.0015991, -0.0018038, -0.0022864, -0.0029915, -0.0037393, 
--0.0043263, -0.0046386, -0.0047161, -0.0047298, -0.0048863, -0.0053126, -0.0059848, -0.0067414, -0.0073739, -0.0077432, 
--0.0078572, -0.0078665, -0.0079802, -0.0083492, -0.0089816, -0.0097382, -0.0104105, -0.0108371, -0.0109939, -0.0110075, 
--0.0110848, -0.0113968, -0.0119836, -0.0127315, -0.0134368, -0.0139197, -0.0141246, -0.0141513, -0.0141992, -0.0144559, 
--0.0149923, -0.0157229, -0.0164538, -0.0169907, -0.0172479, -0.017296, -0.0173225, -0.0175268, -0.0180092, -0.0187144, 
--0.0194626, -0.0200499, -0.0203624, -0.0204398, -0.0204532, -0.0206093, -0.0210354, -0.0217076, -0.0224646, -0.0230976, 
--0.0234671, -0.023581, -0.0235899, -0.0237032, -0.0240719, -0.0247043, -0.0254613, -0.0261342, -0.0265611, -0.0267178, 
--0.0267311, -0.0268078, -0.0271194, -0.0277062, -0.0284545, -0.0291604, -0.0296438, -0.0298487, -0.0298749, -0.0299223, 
--0.0301785, -0.0307149, -0.0314459, -0.0321773, -0.0327147, -0.032972, -0.0330198, -0.0330455, -0.0332493, -0.0337316, 
--0.0344372, -0.035186, -0.035774, -0.0360867, -0.0361637, -0.0361763, -0.0363318, -0.0367577, -0.0374302, -0.0381879, 
--0.0388216, -0.0391915, -0.039305, -0.0393132, -0.0394257, -0.0397941, -0.0404268, -0.0411846, -0.0418582, -0.0422855, 
--0.042442, -0.0424545, -0.0425304, -0.0428416, -0.0434286, -0.0441776, -0.0448844, -0.0453683, -0.045573, -0.0455985, 
--0.0456449, -0.0459006, -0.046437, -0.0471688, -0.0479012, -0.0484393, -0.0486966, -0.0487435, -0.0487683, -0.0489714, 
--0.0494536, -0.0501599, -0.0509098, -0.0514985, -0.0518113, -0.0518877, -0.0518992, -0.0520539, -0.0524796, -0.0531528, 
--0.0539116, -0.0545462, -0.0549163, -0.0550292, -0.0550363, -0.0551478, -0.0555158, -0.0561491, -0.056908, -0.0575827, 
--0.0580105, -0.0581664, -0.0581778, -0.0582525, -0.0585632, -0.0591506, -0.0599008, -0.0606088, -0.0610933, -0.0612977, 
--0.0613221, -0.0613672, -0.0616221, -0.0621589, -0.0628917, -0.0636255, -0.0641644, -0.0644214, -0.0644673, -0.0644907, 
--0.0646929, -0.0651752, -0.0658826, -0.0666339, -0.0672236, -0.0675364, -0.0676118, -0.0676219, -0.0677754, -0.068201, 
--0.0688751, -0.0696354, -0.0702712, -0.0706415, -0.0707536, -0.0707592, -0.0708694, -0.0712371, -0.0718712, -0.0726316, 
--0.0733077, -0.0737359, -0.0738911, -0.073901, -0.0739742, -0.0742843, -0.0748724, -0.0756241, -0.0763336, -0.0768188, 
--0.0770227, -0.0770456, -0.0770891, -0.0773432, -0.0778803, -0.0786147, -0.0793501, -0.0798899, -0.0801467, -0.0801912, 
--0.0802129, -0.0804139, -0.0808965, -0.0816051, -0.0823582, -0.0829492, -0.083262, -0.083336, -0.0833443, -0.0834965, 
--0.083922, -0.0845973, -0.0853595, -0.0859968, -0.0863673, -0.0864782, -0.0864819, -0.0865905, -0.0869579, -0.087593, 
--0.0883553, -0.0890331, -0.0894618, -0.0896161, -0.0896241, -0.0896955, -0.090005, -0.0905938, -0.0913474, -0.0920589, 
--0.0925448, -0.092748, -0.0927691, -0.0928106, -0.0930637, -0.0936014, -0.0943376, -0.0950751, -0.095616, -0.0958724, 
--0.0959151, -0.0959346, -0.0961344, -0.0966172, -0.0973276, -0.0980829, -0.0986753, -0.0989879, -0.0990604, -0.0990664, 
--0.099217, -0.0996425, -0.1003193, -0.1010838, -0.1017228, -0.1020935, -0.102203, -0.1022044, -0.1023112, -0.1026781, 
--0.1033146, -0.1040792, -0.1047589, -0.1051882, -0.1053414, -0.105347, -0.1054164, -0.105725, -0.106315, -0.1070708, 
--0.1077845, -0.1082714, -0.1084737, -0.1084925, -0.1085317, -0.1087837, -0.1093222, -0.1100605, -0.1108004, -0.1113427, 
--0.1115985, -0.1116391, -0.1116561, -0.1118544, -0.1123376, -0.11305, -0.1138079, -0.1144019, -0.1147144, -0.1147849, 
--0.1147883, -0.114937, -0.1153625, -0.1160412, -0.1168083, -0.1174493, -0.1178203, -0.1179281, -0.1179267, -0.1180313, 
--0.1183979, -0.1190359, -0.1198032, -0.1204853, -0.1209152, -0.1210669, -0.1210699, -0.1211367, -0.1214446, -0.1220358, 
--0.1227943, -0.1235106, -0.1239985, -0.1241997, -0.1242159, -0.1242524, -0.1245031, -0.1250425, -0.1257834, -0.1265261, 
--0.1270699, -0.127325, -0.1273631, -0.1273772, -0.1275738, -0.1280575, -0.1287723, -0.1295332, -0.1301291, -0.1304413, 
--0.1305095, -0.1305098, -0.1306565, -0.131082, -0.1317629, -0.1325331, -0.1331764, -0.1335475, -0.1336533, -0.1336488, 
--0.133751, -0.1341171, -0.1347569, -0.1355274, -0.1362121, -0.1366427, -0.1367927, -0.1367926, -0.1368567, -0.1371636, 
--0.1377562, -0.1385179, -0.1392371, -0.1397262, -0.1399261, -0.1399393, -0.1399727, -0.140222, -0.1407624, -0.1415063, 
--0.1422522, -0.1427977, -0.1430519, -0.1430871, -0.1430979, -0.1432926, -0.1437769, -0.1444945, -0.1452588, -0.1458569, 
--0.1461687, -0.1462342, -0.1462311, -0.1463754, -0.146801, -0.1474844, -0.1482581, -0.148904, -0.1492753, -0.1493788, 
--0.1493707, -0.1494701, -0.1498357, -0.1504777, -0.1512518, -0.1519395, -0.1523708, -0.1525189, -0.1525152, -0.1525761, 
--0.152882, -0.1534764, -0.1542415, -0.1549641, -0.1554545, -0.1556529, -0.1556626, -0.1556925, -0.1559402, -0.1564819, 
--0.1572292, -0.1579788, -0.158526, -0.1587793, -0.1588112, -0.1588183, -0.1590108, -0.1594958, -0.1602166, -0.1609847, 
--0.1615852, -0.1618966, -0.1619591, -0.1619521, -0.1620937, -0.1625194, -0.1632057, -0.1639834, -0.1646322, -0.1650037, 
--0.1651045, -0.1650924, -0.1651886, -0.1655538, -0.1661983, -0.1669763, -0.1676674, -0.1680995, -0.1682454, -0.1682376, 
--0.168295, -0.1685997, -0.1691961, -0.1699652, -0.1706916, -0.1711835, -0.1713801, -0.1713859, -0.1714119, -0.1716579, 
--0.1722009, -0.172952, -0.1737057, -0.1742551, -0.1745072, -0.1745354, -0.1745382, -0.1747284, -0.1752142, -0.1759386, 
--0.176711, -0.1773142, -0.1776251, -0.1776842, -0.1776727, -0.1778114, -0.1782373, -0.1789268, -0.1797089, -0.180361, 
--0.1807326, -0.1808304, -0.1808139, -0.1809066, -0.1812712, -0.1819185, -0.182701, -0.1833959, -0.1838289, -0.1839722, 
--0.18396, -0.1840133, -0.1843169, -0.1849155, -0.1856891, -0.1864196, -0.186913, -0.1871078, -0.1871092, -0.1871307, 
--0.1873748, -0.1879195, -0.1886749, -0.1894331, -0.1899847, -0.1902356, -0.1902597, -0.1902578, -0.1904454, -0.1909321, 
--0.1916604, -0.1924377, -0.1930438, -0.1933541, -0.1934094, -0.1933931, -0.1935285, -0.1939546, -0.1946476, -0.1954348, 
--0.1960904, -0.1964622, -0.1965566, -0.1965351, -0.1966239, -0.196988, -0.1976384, -0.1984259, -0.1991249, -0.1995589, 
--0.1996994, -0.1996821, -0.1997311, -0.2000333, -0.2006344, -0.201413, -0.2021481, -0.2026433, -0.2028359, -0.2028324, 
--0.2028491, -0.2030911, -0.2036376, -0.2043977, -0.205161, -0.2057151, -0.2059645, -0.205984, -0.2059769, -0.2061616, 
--0.2066494, -0.2073822, -0.2081648, -0.2087741, -0.2090838, -0.2091349, -0.209113, -0.2092449, -0.2096712, -0.2103683, 
--0.2111609, -0.2118205, -0.2121925, -0.2122832, -0.212256, -0.2123406, -0.2127041, -0.2133579, -0.2141511, -0.2148546, 
--0.2152896, -0.215427, -0.2154042, -0.2154483, -0.2157491, -0.216353, -0.217137, -0.2178773, -0.2183743, -0.2185645, 
--0.2185556, -0.2185669, -0.2188066, -0.2193552, -0.2201206, -0.2208894, -0.2214462, -0.221694, -0.2217083, -0.2216955, 
--0.2218771, -0.2223661, -0.2231038, -0.2238923, -0.2245052, -0.2248141, -0.2248605, -0.2248326, -0.2249605, -0.2253872, 
--0.2260887, -0.2268874, -0.2275513, -0.2279234, -0.22801, -0.2279767, -0.2280566, -0.2284195, -0.2290771, -0.2298764, 
--0.230585, -0.231021, -0.2311549, -0.2311261, -0.2311648, -0.231464, -0.232071, -0.2328611, -0.233607, -0.2341061, 
--0.2342935, -0.2342787, -0.2342842, -0.2345213, -0.2350722, -0.2358434, -0.2366183, -0.2371781, -0.2374241, -0.2374328, 
--0.2374137, -0.2375918, -0.2380822, -0.2388253, -0.2396202, -0.240237, -0.2405451, -0.2405863, -0.2405518, -0.2406754, 
--0.2411024, -0.2418088, -0.2426142, -0.2432828, -0.2436551, -0.2437371, -0.2436971, -0.2437719, -0.2441341, -0.2447959, 
--0.245602, -0.2463161, -0.2467533, -0.2468834, -0.2468478, -0.2468807, -0.2471782, -0.2477886, -0.2485853, -0.2493374, 
--0.2498387, -0.2500232, -0.2500018, -0.2500009, -0.2502352, -0.2507886, -0.2515662, -0.2523478, -0.2529109, -0.2531548, 
--0.2531574, -0.2531313, -0.2533057, -0.2537975, -0.2545466, -0.2553487, -0.2559697, -0.2562768, -0.2563123, -0.2562706, 
--0.2563895, -0.2568169, -0.2575286, -0.2583414, -0.2590152, -0.2593876, -0.2594646, -0.2594172, -0.2594864, -0.2598479, 
--0.2605143, -0.2613278, -0.2620479, -0.2624864, -0.2626123, -0.2625693, -0.2625958, -0.2628914, -0.2635056, -0.2643096, 
--0.2650684, -0.2655722, -0.2657534, -0.2657249, -0.2657168, -0.2659482, -0.2665043, -0.2672889, -0.2680779, -0.2686446, 
--0.2688863, -0.268882, -0.2688484, -0.2690186, -0.2695121, -0.2702677, -0.2710776, -0.2717033, -0.2720093, -0.2720386, 
--0.271989, -0.2721026, -0.2725305, -0.2732482, -0.274069, -0.2747485, -0.275121, -0.2751925, -0.275137, -0.2752, 
--0.2755608, -0.2762323, -0.2770538, -0.2777806, -0.2782204, -0.2783417, -0.2782906, -0.2783101, -0.2786038, -0.2792221, 
--0.280034, -0.2808003, -0.2813067, -0.2814843, -0.2814479, -0.2814321, -0.2816602, -0.2822194, -0.2830116, -0.2838087, 
--0.2843792, -0.2846185, -0.2846068, -0.2845648, -0.2847306, -0.2852259, -0.2859887, -0.2868071, -0.2874378, -0.2877426, 
--0.2877651, -0.2877068, -0.2878148, -0.2882433, -0.2889674, -0.289797, -0.2904827, -0.2908553, -0.2909207, -0.2908564, 
--0.2909127, -0.2912726, -0.2919498, -0.2927802, -0.2935141, -0.2939555, -0.2940716, -0.2940118, -0.2940236, -0.2943151, 
--0.2949379, -0.2957586, -0.2965329, -0.2970422, -0.2972158, -0.2971709, -0.2971466, -0.2973712, -0.2979337, -0.2987343, 
--0.2995402, -0.3001149, -0.3003515, -0.3003316, -0.3002806, -0.3004415, -0.3009389, -0.3017095, -0.3025371, -0.3031735, 
--0.3034769, -0.3034919, -0.3034241, -0.303526, -0.303955, -0.3046862, -0.3055254, -0.3062179, -0.3065907, -0.3066494, 
--0.3065754, -0.3066244, -0.3069835, -0.3076667, -0.3085068, -0.3092486, -0.3096916, -0.3098022, -0.3097327, -0.3097361, 
--0.3100252, -0.3106531, -0.3114833, -0.3122664, -0.3127789, -0.3129482, -0.3128938, -0.3128603, -0.313081, -0.3136472, 
--0.314457, -0.3152724, -0.3158518, -0.3160854, -0.3160566, -0.3159957, -0.3161512, -0.3166509, -0.3174301, -0.3182679, 
--0.3189102, -0.3192122, -0.319219, -0.3191409, -0.319236, -0.3196658, -0.3204047, -0.3212544, -0.3219542, -0.3223271, 
--0.3223786, -0.322294, -0.322335, -0.3226932, -0.3233831, -0.3242338, -0.3249842, -0.3254289, -0.3255334, -0.3254533, 
--0.3254477, -0.3257342, -0.3263675, -0.3272082, -0.3280009, -0.3285167, -0.3286813, -0.3286166, -0.3285731, -0.3287896, 
--0.3293597, -0.3301797, -0.3310055, -0.3315899, -0.3318203, -0.3317817, -0.33171, -0.3318597, -0.3323618, -0.3331504, 
--0.3339993, -0.3346483, -0.3349486, -0.3349464, -0.334857, -0.3349448, -0.3353753, -0.3361227, -0.3369839, -0.3376918, 
--0.3380648, -0.3381084, -0.3380122, -0.3380444, -0.3384016, -0.3390989, -0.3399612, -0.3407209, -0.3411676, -0.3412654, 
--0.3411737, -0.3411581, -0.3414418, -0.3420811, -0.3429332, -0.3437365, -0.344256, -0.3444153, -0.3443394, -0.3442849, 
--0.3444967, -0.3450713, -0.3459022, -0.3467395, -0.3473295, -0.3475562, -0.347507, -0.3474235, -0.3475668, -0.3480716, 
--0.3488705, -0.3497315, -0.3503877, -0.3506862, -0.3506742, -0.3505724, -0.3506522, -0.3510836, -0.3518403, -0.352714, 
--0.3534307, -0.3538038, -0.3538387, -0.3537299, -0.3537525, -0.3541086, -0.354814, -0.3556889, -0.3564589, -0.3569076, 
--0.3569981, -0.3568938, -0.3568673, -0.357148, -0.3577938, -0.3586585, -0.3594732, -0.3599967, -0.3601503, -0.3600621, 
--0.3599955, -0.3602024, -0.3607818, -0.3616248, -0.3624746, -0.3630705, -0.3632933, -0.3632324, -0.363136, -0.3632724, 
--0.3637801, -0.3645903, -0.3654646, -0.3661286, -0.3664252, -0.3664024, -0.3662871, -0.3663581, -0.3667904, -0.3675573, 
--0.3684447, -0.3691711, -0.3695443, -0.3695696, -0.369447, -0.3694592, -0.3698141, -0.3705283, -0.3714171, -0.3721983, 
--0.3726493, -0.3727317, -0.3726136, -0.3725751, -0.3728525, -0.3735055, -0.3743839, -0.3752112, -0.3757392, -0.3758865, 
--0.3757847, -0.375705, -0.3759064, -0.3764911, -0.3773473, -0.3782108, -0.3788132, -0.3790317, -0.378958, -0.3788474, 
--0.3789762, -0.3794873, -0.3803097, -0.3811986, -0.3818712, -0.3821656, -0.382131, -0.3820009, -0.3820623, -0.3824957, 
--0.3832737, -0.3841762, -0.3849131, -0.3852864, -0.3853013, -0.3851634, -0.3851642, -0.3855179, -0.3862417, -0.3871458, 
--0.3879393, -0.3883927, -0.3884663, -0.388333, -0.3882815, -0.3885552, -0.3892161, -0.3901095, -0.3909507, -0.3914834, 
--0.3916238, -0.3915073, -0.3914131, -0.3916085, -0.3921991, -0.3930697, -0.3939483, -0.3945579, -0.3947716, -0.3946839, 
--0.3945577, -0.3946782, -0.3951928, -0.3960289, -0.3969337, -0.3976157, -0.3979077, -0.3978602, -0.3977137, -0.3977646, 
--0.3981992, -0.3989895, -0.3999086, -0.400657, -0.4010303, -0.4010337, -0.4008792, -0.4008675, -0.4012198, -0.4019542, 
--0.4028751, -0.403682, -0.4041381, -0.404202, -0.404052, -0.4039861, -0.4042559, -0.4049254, -0.4058354, -0.4066917, 
--0.4072297, -0.4073626, -0.4072298, -0.4071197, -0.4073085, -0.4079055, -0.4087921, -0.4096872, -0.4103046, -0.4105131, 
--0.4104099, -0.4102667, -0.4103781, -0.4108967, -0.4117476, -0.4126699, -0.4133623, -0.4136517, -0.4135899, -0.4134255, 
--0.4134649, -0.4139008, -0.4147046, -0.4156418, -0.4164029, -0.4167764, -0.4167671, -0.4165942, -0.4165687, -0.4169195, 
--0.4176657, -0.4186049, -0.4194267, -0.4198856, -0.4199389, -0.4197706, -0.4196889, -0.4199543, -0.4206334, -0.4215616, 
--0.4224345, -0.4229784, -0.4231028, -0.4229521, -0.4228245, -0.4230061, -0.4236103, -0.4245144, -0.4254276, -0.4260538, 
--0.4262565, -0.4261362, -0.4259742, -0.4260755, -0.4265985, -0.4274659, -0.4284075, -0.4291114, -0.4293977, -0.4293203, 
--0.4291362, -0.4291628, -0.4296001, -0.4304188, -0.4313761, -0.4321512, -0.4325247, -0.4325015, -0.4323084, -0.4322676, 
--0.4326169, -0.4333759, -0.4343355, -0.4351736, -0.4356357, -0.4356772, -0.4354886, -0.4353896, -0.4356502, -0.4363398, 
--0.4372881, -0.4381794, -0.4387297, -0.4388449, -0.4386743, -0.4385275, -0.4387011, -0.4393131, -0.4402366, -0.4411699, 
--0.4418056, -0.4420019, -0.4418628, -0.44168, -0.4417703, -0.4422981, -0.4431836, -0.4441466, -0.4448631, -0.4451462, 
--0.4450513, -0.4448454, -0.444858, -0.4452969, -0.4461321, -0.4471115, -0.4479021, -0.4482757, -0.448237, -0.4480216, 
--0.447964, -0.4483114, -0.4490848, -0.4500668, -0.450923, -0.4513887, -0.4514171, -0.4512061, -0.4510878, -0.4513431, 
--0.4520444, -0.4530149, -0.4539266, -0.4544839, -0.4545889, -0.4543964, -0.4542282, -0.454393, -0.4550138, -0.4559587, 
--0.4569143, -0.4575605, -0.4577498, -0.4575898, -0.457384, -0.4574619, -0.4579952, -0.4589008, -0.4598875, -0.4606179, 
--0.4608974, -0.4607833, -0.4605531, -0.4605501, -0.4609909, -0.4618443, -0.4628483, -0.463656, -0.4640297, -0.4639739, 
--0.4637336, -0.4636574, -0.4640028, -0.4647921, -0.465799, -0.4666753, -0.4671449, -0.4671588, -0.4669229, -0.4667832, 
--0.4670326, -0.467747, -0.4687422, -0.4696765, -0.4702416, -0.4703352, -0.4701184, -0.4699265, -0.4700814, -0.4707119, 
--0.4716807, -0.472661, -0.4733189, -0.4735003, -0.4733171, -0.4730857, -0.47315, -0.4736893, -0.4746173, -0.4756303, 
--0.4763762, -0.4766517, -0.4765161, -0.4762591, -0.4762387, -0.4766815, -0.4775553, -0.4785866, -0.4794134, -0.4797871, 
--0.4797123, -0.4794444, -0.4793474, -0.4796906, -0.4804976, -0.4815323, -0.4824309, -0.4829048, -0.4829026, -0.482639, 
--0.4824754, -0.4827183, -0.4834472, -0.4844699, -0.4854294, -0.4860033, -0.4860841, -0.4858402, -0.4856218, -0.4857658, 
--0.4864071, -0.4874025, -0.4884104, -0.4890814, -0.489254, -0.4890449, -0.4887849, -0.488834, -0.48938, -0.4903331, 
--0.4913755, -0.4921387, -0.4924096, -0.4922501, -0.491963, -0.4919233, -0.4923683, -0.4932648, -0.4943268, -0.4951749, 
--0.4955486, -0.4954524, -0.4951536, -0.4950334, -0.4953742, -0.496201, -0.4972668, -0.4981903, -0.4986692, -0.4986488, 
--0.4983541, -0.4981639, -0.4983995, -0.4991447, -0.5001982, -0.501186, -0.5017696, -0.5018361, -0.5015617, -0.5013137, 
--0.5014456, -0.502099, -0.5031242, -0.504163, -0.5048487, -0.5050113, -0.5047732, -0.5044812, -0.5045133, -0.5050668, 
--0.5060479, -0.5071233, -0.5079059, -0.5081717, -0.5079853, -0.5076645, -0.507603, -0.5080507, -0.5089727, -0.510069, 
--0.510941, -0.5113148, -0.5111946, -0.5108611, -0.5107148, -0.5110529, -0.5119019, -0.5130026, -0.5139543, -0.5144386, 
--0.5143979, -0.5140683, -0.5138481, -0.5140755, -0.5148389, -0.5159272, -0.5169466, -0.5175412, -0.5175917, -0.517283, 
--0.5170017, -0.5171198, -0.5177869, -0.5188457, -0.5199194, -0.5206216, -0.520773, -0.5205021, -0.520174, -0.5201868, 
--0.5207489, -0.5217617, -0.5228743, -0.5236788, -0.5239388, -0.523722, -0.5233631, -0.5232772, -0.5237277, -0.5246786, 
--0.5258137, -0.5267127, -0.5270866, -0.5269393, -0.5265664, -0.5263908, -0.5267258, -0.5276, -0.5287402, -0.5297236, 
--0.530214, -0.5301503, -0.5297812, -0.5295271, -0.5297452, -0.5305293, -0.5316569, -0.5327123, -0.5333193, -0.5333516, 
--0.5330041, -0.5326849, -0.5327874, -0.5334701, -0.5345671, -0.5356802, -0.5364011, -0.5365398, -0.5362318, -0.5358627, 
--0.5358537, -0.5364255, -0.5374743, -0.538629, -0.5394584, -0.5397119, -0.5394606, -0.5390584, -0.5389446, -0.5393985, 
--0.5403822, -0.5415613, -0.5424911, -0.542865, -0.5426868, -0.5422693, -0.5420602, -0.5423917, -0.5432946, -0.5444797, 
--0.5454993, -0.5459967, -0.5459067, -0.5454926, -0.5451998, -0.5454074, -0.5462152, -0.5473875, -0.5484839, -0.5491051, 
--0.5491165, -0.5487248, -0.5483625, -0.5484473, -0.5491477, -0.5502881, -0.5514463, -0.5521885, -0.5523128, -0.5519623, 
--0.5515465, -0.5515126, -0.5520954, -0.5531853, -0.5543883, -0.5552461, -0.555492, -0.5552013, -0.5547496, -0.554604, 
--0.5550617, -0.5560829, -0.5573125, -0.5582774, -0.5586514, -0.5584379, -0.5579692, -0.5577217, -0.5580493, -0.558985, 
--0.5602217, -0.5612827, -0.5617881, -0.561668, -0.5612022, -0.5608652, -0.5610606, -0.5618955, -0.5631193, -0.5642627, 
--0.5649001, -0.5648877, -0.564445, -0.5640332, -0.5640976, -0.5648184, -0.5660089, -0.5672188, -0.5679856, -0.5680932, 
--0.5676938, -0.5672242, -0.5671617, -0.5677573, -0.5688945, -0.5701531, -0.5710436, -0.5712809, -0.5709446, -0.5704359, 
--0.5702536, -0.5707157, -0.5717802, -0.573068, -0.5740735, -0.5744475, -0.5741932, -0.5736655, -0.5733736, -0.5736966, 
--0.5746703, -0.5759666, -0.5770755, -0.5775902, -0.5774352, -0.5769097, -0.5765213, -0.5767027, -0.5775691, -0.5788524, 
--0.5800503, -0.5807065, -0.5806664, -0.5801647, -0.5796955, -0.5797363, -0.5804807, -0.5817293, -0.5829994, -0.5837946, 
--0.5838828, -0.5834267, -0.5828945, -0.5827987, -0.5834092, -0.5846014, -0.5859247, -0.5868532, -0.5870804, -0.5866912, 
--0.586116, -0.585891, -0.5863582, -0.5874733, -0.5888289, -0.5898817, -0.5902557, -0.5899538, -0.5893571, -0.5890136, 
--0.5893312, -0.5903493, -0.5917152, -0.59288, -0.5934055, -0.5932097, -0.5926144, -0.592166, -0.5923311, -0.5932343, 
--0.5945873, -0.595849, -0.5965272, -0.5964546, -0.5958838, -0.5953473, -0.5953603, -0.5961326, -0.5974492, -0.5987899, 
--0.5996185, -0.5996839, -0.5991612, -0.5985555, -0.5984206, -0.5990486, -0.6003055, -0.6017048, -0.6026781, -0.6028934, 
--0.6024419, -0.6017885, -0.6015132, -0.6019864, -0.603161, -0.6045966, -0.6057051, -0.6060792, -0.605721, -0.605043, 
--0.6046385, -0.6049498, -0.6060204, -0.6074685, -0.6086994, -0.6092377, -0.6089937, -0.6083156, -0.6077963, -0.607942, 
--0.6088887, -0.6103243, -0.6116616, -0.6123659, -0.6122549, -0.611602, -0.6109856, -0.6109658, -0.611771, -0.6131686, 
--0.6145931, -0.6154614, -0.6154997, -0.6148977, -0.6142047, -0.6140232, -0.614672, -0.6160061, -0.6174959, -0.6185225, 
--0.6187236, -0.6181977, -0.617451, -0.6171157, -0.6175962, -0.6188418, -0.620373, -0.6215481, -0.6219222, -0.6214968, 
--0.6207215, -0.6202439, -0.6205477, -0.6216811, -0.6232277, -0.6245379, -0.6250914, -0.6247896, -0.6240124, -0.6234078, 
--0.6235303, -0.6245294, -0.6260643, -0.6274924, -0.628228, -0.6280707, -0.6273191, -0.6266065, -0.6265471, -0.6273921, 
--0.6288873, -0.6304128, -0.6313291, -0.6313346, -0.6306369, -0.6298383, -0.6296006, -0.6302746, -0.6317019, -0.6333014, 
--0.6343925, -0.6345764, -0.6339604, -0.6331006, -0.6326925, -0.6331818, -0.6345136, -0.6361609, -0.6374169, -0.6377909, 
--0.6372838, -0.6363902, -0.6358238, -0.6361184, -0.6373283, -0.638995, -0.6404017, -0.6409739, -0.6406014, -0.6397031, 
--0.6389946, -0.6390887, -0.6401518, -0.641808, -0.6433473, -0.6441213, -0.6439072, -0.6430347, -0.6422042, -0.6420963, 
--0.6429901, -0.644605, -0.6462547, -0.6472298, -0.6471951, -0.6463796, -0.6454511, -0.6451442, -0.6458492, -0.6473915, 
--0.649126, -0.6502968, -0.6504594, -0.6497321, -0.6487327, -0.6482346, -0.6487348, -0.6501734, -0.6519642, -0.6533205, 
--0.6536945, -0.6530861, -0.6520456, -0.6513688, -0.6516521, -0.6529571, -0.6547731, -0.6563, -0.6568953, -0.6564349, 
--0.6553857, -0.6545475, -0.6546062, -0.6557492, -0.657557, -0.6592352, -0.6600572, -0.6597721, -0.6587481, -0.65777, 
--0.6576013, -0.6585563, -0.6603215, -0.6621271, -0.6631761, -0.6630908, -0.6621272, -0.6610351, -0.660641, -0.6613852, 
--0.6630724, -0.6649775, -0.6662488, -0.6663845, -0.6655165, -0.6643403, -0.6637283, -0.6642423, -0.6658163, -0.6677894, 
--0.6692729, -0.6696468, -0.6689095, -0.6676822, -0.6668651, -0.6671339, -0.6685601, -0.6705665, -0.6722469, -0.6728718, 
--0.6722989, -0.6710567, -0.6700523, -0.6700657, -0.6713112, -0.6733136, -0.6751702, -0.6760537, -0.6756773, -0.6744585, 
--0.6732902, -0.6730431, -0.6740771, -0.6760363, -0.6780433, -0.6791878, -0.679037, -0.6778815, -0.6765775, -0.6760704, 
--0.6768655, -0.678741, -0.6808678, -0.6822699, -0.6823705, -0.6813192, -0.6799123, -0.6791516, -0.6796838, -0.6814348, 
--0.6836464, -0.6852965, -0.6856704, -0.6847639, -0.6832913, -0.6822895, -0.6825394, -0.6841253, -0.6863827, -0.6882654, 
--0.6889294, -0.6882079, -0.6867103, -0.685486, -0.6854394, -0.6868208, -0.6890816, -0.6911752, -0.6921407, -0.6916426, 
--0.6901639, -0.6887419, -0.6883901, -0.6895299, -0.6917488, -0.6940256, -0.6952982, -0.6950594, -0.6936461, -0.6920569, 
--0.6913976, -0.6922612, -0.694391, -0.6968174, -0.6983963, -0.6984495, -0.6971495, -0.6954296, -0.694467, -0.6950238, 
--0.6970159, -0.6995527, -0.7014303, -0.701804, -0.7006661, -0.6988573, -0.6976024, -0.6978263, -0.6996318, -0.7022348, 
--0.7043963, -0.7051141, -0.7041872, -0.7023362, -0.7008074, -0.7006775, -0.7022479, -0.704868, -0.7072917, -0.7083714, 
--0.7077033, -0.7058614, -0.7040841, -0.7035857, -0.7048738, -0.7074578, -0.7101145, -0.7115677, -0.7112046, -0.7094267, 
--0.7074338, -0.7065587, -0.7075197, -0.7100111, -0.7128642, -0.7146954, -0.7146807, -0.7130248, -0.7108563, -0.7096038, 
--0.7101961, -0.7125355, -0.7155415, -0.7177476, -0.718121, -0.7166475, -0.7143507, -0.7127277, -0.7129138, -0.7150398, 
--0.718148, -0.7207179, -0.7215146, -0.7202857, -0.7179144, -0.7159363, -0.7156834, -0.7175336, -0.7206867, -0.723601, 
--0.7248507, -0.7239291, -0.721544, -0.7192346, -0.7185161, -0.7200275, -0.7231618, -0.7263921, -0.7281185, -0.7275669, 
--0.7252347, -0.7226269, -0.7214225, -0.7225328, -0.7255786, -0.7290874, -0.731307, -0.7311874, -0.7289808, -0.7261166, 
--0.7244136, -0.7250613, -0.7279432, -0.7316838, -0.7344056, -0.7347784, -0.7327754, -0.7297065, -0.7274999, -0.7276259, 
--0.730263, -0.734179, -0.7374035, -0.7383269, -0.736611, -0.7333986, -0.7306922, -0.7302396, -0.7325461, -0.7365711, 
--0.7402901, -0.7418193, -0.7404789, -0.7371945, -0.7340014, -0.7329164, -0.7348013, -0.7388586, -0.7430541, -0.7452414, 
--0.7443702, -0.7410957, -0.7374389, -0.735671, -0.7370378, -0.74104, -0.7456838, -0.7485781, -0.7482753, -0.7451041, 
--0.7410171, -0.738519, -0.7392655, -0.743113, -0.7481661, -0.7518129, -0.7521843, -0.7492226, -0.7447501, -0.7414778, 
--0.7414941, -0.7450737, -0.7504854, -0.7549277, -0.7560874, -0.7534561, -0.7486551, -0.7445665, -0.7437334, -0.7469158, 
--0.7526224, -0.7579015, -0.7599752, -0.757813, -0.7527544, -0.7478084, -0.7459926, -0.7486281, -0.754551, -0.7607087, 
--0.7638388, -0.7623081, -0.7570789, -0.751232, -0.74828, -0.7501913, -0.7562341, -0.7633165, -0.7676706, -0.7669666, 
--0.7616737, -0.7548758, -0.7506022, -0.7515725, -0.7576162, -0.7656794, -0.7714654, -0.7718315, -0.7666084, -0.7587949, 
--0.7529625, -0.7527149, -0.7586086, -0.7677294, -0.7752223, -0.7769783, -0.7719972, -0.7630744, -0.7553585, -0.7535171, 
--0.7590616, -0.7693573, -0.7789488, -0.7825449, -0.7780403, -0.7678577, -0.7577751, -0.7537886, -0.7587023, -0.7703702, 
--0.7826716, -0.7888006, -0.7851193, -0.7734113, -0.7601664, -0.7531386, -0.7569809, -0.7703886, -0.7864695, -0.796332, 
--0.7940547, -0.7802962, -0.7623942, -0.7506474, -0.7526169, -0.7685458, -0.7905978, -0.8066639, -0.8069634, -0.7899278, 
--0.7639489, -0.7435885, -0.7418323, -0.7623568, -0.7961955, -0.8252221, -0.8313583, -0.8071178, -0.761798, -0.7192325, 
--0.7069572, -0.7411198, -0.8142165, -0.8922332, -0.9239591, -0.8597377, -0.6722587, -0.3704503, 0.0, 0.3697198, 
-0.6709916, 0.8582135, 0.9223868, 0.8906342, 0.8124127, 0.7388334, 0.7039657, 0.7154932, 0.7574718, 0.8024792, 
-0.8266423, 0.8204924, 0.7913092, 0.7570441, 0.7358476, 0.7368472, 0.7565749, 0.7821845, 0.7991062, 0.7987974, 
-0.7826176, 0.7601966, 0.7436353, 0.7409092, 0.7519837, 0.769459, 0.7830608, 0.7853245, 0.7753847, 0.7589918, 
-0.7449973, 0.7404071, 0.7467296, 0.7594916, 0.7709947, 0.7746493, 0.7684724, 0.7559143, 0.7437099, 0.7380657, 
-0.7413213, 0.750867, 0.7607924, 0.7652489, 0.7616263, 0.7518305, 0.7410524, 0.7348027, 0.7358959, 0.7430245, 
-0.7516348, 0.7565385, 0.7547691, 0.7471201, 0.7375732, 0.7310073, 0.7304979, 0.7356973, 0.7431413, 0.7482504, 
-0.7478755, 0.7419762, 0.7335443, 0.7268682, 0.7251408, 0.7287417, 0.7351126, 0.7402487, 0.7409395, 0.7365088, 
-0.7291147, 0.722485, 0.7198255, 0.7220716, 0.7274352, 0.7324595, 0.7339638, 0.7307865, 0.7243725, 0.7179132, 
-0.7145467, 0.715631, 0.7200397, 0.7248409, 0.7269555, 0.7248559, 0.7193731, 0.7131842, 0.7092962, 0.7093805, 
-0.7128811, 0.7173694, 0.7199237, 0.7187514, 0.7141536, 0.708316, 0.7040638, 0.7032898, 0.7059284, 0.7100312, 
-0.7128792, 0.7124997, 0.7087404, 0.7033188, 0.6988386, 0.6973345, 0.6991589, 0.7028186, 0.7058332, 0.7061236, 
-0.7031534, 0.6981985, 0.6936092, 0.6914934, 0.6925545, 0.6957275, 0.6987972, 0.6996429, 0.6974092, 0.6929581, 
-0.6883642, 0.6857476, 0.6861002, 0.6887552, 0.6917824, 0.6930758, 0.6915218, 0.6875997, 0.6830925, 0.6800797, 
-0.6797824, 0.6819, 0.6847996, 0.6864392, 0.6855043, 0.6821251, 0.6777835, 0.6744731, 0.6735883, 0.6751603, 
-0.6778592, 0.6797492, 0.6793693, 0.676536, 0.6724274, 0.6689122, 0.6675056, 0.6685339, 0.6709703, 0.673021, 
-0.6731292, 0.6708349, 0.6670154, 0.6633821, 0.6615217, 0.6620181, 0.6641414, 0.6662692, 0.6667964, 0.6650249, 
-0.6615397, 0.6578686, 0.6556244, 0.6556091, 0.6573796, 0.6595076, 0.6603834, 0.6591103, 0.6559938, 0.6523583, 
-0.6498009, 0.6493024, 0.6506908, 0.6527492, 0.6539028, 0.653096, 0.6503725, 0.6468388, 0.6440386, 0.6430923, 
-0.6440794, 0.646006, 0.6473673, 0.6469884, 0.6446721, 0.6412984, 0.638325, 0.6369723, 0.6375487, 0.6392889, 
-0.6407896, 0.6407944, 0.63889, 0.6357268, 0.6326474, 0.6309346, 0.6311001, 0.6326079, 0.634182, 0.6345221, 
-0.6330254, 0.6301146, 0.6269935, 0.624971, 0.624734, 0.6259715, 0.6275566, 0.6281802, 0.6270788, 0.624454, 
-0.6213514, 0.6190724, 0.6184492, 0.619387, 0.6209252, 0.6217781, 0.6210521, 0.6187383, 0.6157098, 0.613229, 
-0.612243, 0.6128605, 0.6142988, 0.6153258, 0.6149484, 0.6129622, 0.610058, 0.6074308, 0.6061117, 0.6063965, 
-0.6076877, 0.6088334, 0.6087723, 0.6071219, 0.604386, 0.6016674, 0.6000502, 0.5999981, 0.6011012, 0.6023114, 
-0.6025291, 0.601215, 0.5986851, 0.5959284, 0.5940526, 0.5936668, 0.5945479, 0.5957702, 0.5962256, 0.5952406, 
-0.5929472, 0.5902036, 0.5881118, 0.5874031, 0.588035, 0.5892199, 0.589869, 0.589199, 0.5871657, 0.5844829, 
-0.5822201, 0.5812058, 0.5815685, 0.5826704, 0.5834674, 0.5830921, 0.5813352, 0.5787566, 0.5763692, 0.5750725, 
-0.5751533, 0.5761309, 0.5770292, 0.5769228, 0.5754515, 0.573016, 0.5705505, 0.5689996, 0.568793, 0.5696101, 
-0.5705633, 0.5706953, 0.5695116, 0.5672526, 0.564755, 0.5629826, 0.5624898, 0.5631158, 0.5640788, 0.5644147, 
-0.5635141, 0.5614592, 0.5589736, 0.5570157, 0.5562445, 0.5566548, 0.5575845, 0.5580869, 0.5574586, 0.5556295, 
-0.5531976, 0.5510927, 0.5500568, 0.5502329, 0.5510893, 0.5517188, 0.5513462, 0.5497581, 0.5474184, 0.5452064, 
-0.5439251, 0.543855, 0.5446013, 0.5453176, 0.5451789, 0.5438408, 0.5416278, 0.5393494, 0.5378467, 0.5375245, 
-0.5381286, 0.5388911, 0.5389602, 0.5378747, 0.5358184, 0.5335138, 0.5318179, 0.5312439, 0.5316783, 0.5324471, 
-0.5326941, 0.531858, 0.5299833, 0.5276917, 0.5258339, 0.5250143, 0.5252566, 0.5259936, 0.5263858, 0.5257902, 
-0.5241165, 0.5218751, 0.5198892, 0.5188358, 0.5188692, 0.5195385, 0.5200412, 0.5196717, 0.5182133, 0.5160563, 
-0.5139778, 0.5127072, 0.5125205, 0.5130894, 0.5136667, 0.5135042, 0.5122694, 0.5102279, 0.508093, 0.5066263, 
-0.506214, 0.5066534, 0.507269, 0.5072905, 0.506282, 0.504383, 0.5022277, 0.50059, 0.499952, 0.500237, 
-0.5008553, 0.5010342, 0.5002494, 0.4985154, 0.4963749, 0.4945942, 0.4937358, 0.4938463, 0.4944327, 0.4947397, 
-0.4941706, 0.4926195, 0.4905273, 0.488634, 0.4875657, 0.4874862, 0.4880085, 0.4884122, 0.4880462, 0.4866908, 
-0.4846779, 0.482704, 0.4814407, 0.4811611, 0.4815895, 0.4820575, 0.4818773, 0.4807253, 0.4788199, 0.4767982, 
-0.4753591, 0.4748742, 0.4751824, 0.4756817, 0.4756665, 0.4747203, 0.472947, 0.4709102, 0.469318, 0.4686278, 
-0.4687931, 0.4692913, 0.4694168, 0.4686741, 0.4670534, 0.4650336, 0.4633137, 0.4624231, 0.4624272, 0.462893, 
-0.4631323, 0.4625858, 0.461134, 0.4591617, 0.4573421, 0.4562606, 0.4560894, 0.4564931, 0.4568177, 0.4564557, 
-0.4551844, 0.453288, 0.4513979, 0.4501394, 0.4497836, 0.4500982, 0.4504783, 0.4502849, 0.449201, 0.4474063, 
-0.4454759, 0.444058, 0.4435131, 0.4437143, 0.4441196, 0.4440755, 0.4431812, 0.4415108, 0.4395701, 0.4380137, 
-0.4372799, 0.437347, 0.4377477, 0.4378305, 0.4371234, 0.4355959, 0.4336745, 0.4320034, 0.4310853, 0.4310014, 
-0.4313686, 0.4315534, 0.4310267, 0.429657, 0.4277831, 0.426023, 0.4249296, 0.4246821, 0.4249884, 0.4252487, 
-0.4248913, 0.42369, 0.4218897, 0.4200679, 0.4188121, 0.4183926, 0.418613, 0.4189212, 0.4187182, 0.4176915, 
-0.4159887, 0.4141331, 0.4127315, 0.4121359, 0.4122481, 0.4125761, 0.4125094, 0.4116591, 0.4100744, 0.408213, 
-0.4066854, 0.4059141, 0.4058991, 0.406219, 0.4062675, 0.4055912, 0.4041419, 0.4023022, 0.4006707, 0.3997283, 
-0.3995706, 0.3998556, 0.3999961, 0.399487, 0.3981867, 0.3963948, 0.3946836, 0.3935788, 0.3932668, 0.3934915, 
-0.3936991, 0.3933466, 0.392205, 0.3904852, 0.3887199, 0.3874651, 0.3869911, 0.3871323, 0.387381, 0.3871711, 
-0.3861936, 0.3845681, 0.3827747, 0.3813857, 0.3807464, 0.3807834, 0.3810469, 0.3809622, 0.3801503, 0.3786382, 
-0.3768431, 0.3753385, 0.3745345, 0.3744496, 0.3747019, 0.3747226, 0.3740734, 0.3726908, 0.3709197, 0.3693206, 
-0.3683565, 0.3681355, 0.3683514, 0.3684553, 0.3679625, 0.3667217, 0.3649991, 0.3633283, 0.3622127, 0.361845, 
-0.3620007, 0.3621643, 0.3618175, 0.3607274, 0.3590761, 0.3573578, 0.3561026, 0.3555813, 0.3556551, 0.3558539, 
-0.3556394, 0.3547048, 0.3531454, 0.3514043, 0.3500247, 0.349347, 0.3493195, 0.3495287, 0.34943, 0.3486519, 
-0.3472023, 0.3454632, 0.343977, 0.3431438, 0.3429988, 0.3431937, 0.3431917, 0.3425672, 0.3412422, 0.3395294, 
-0.3379568, 0.3369729, 0.336697, 0.3368539, 0.3369276, 0.33645, 0.3352612, 0.3335978, 0.3319606, 0.3308343, 
-0.330418, 0.3305144, 0.3306414, 0.3303007, 0.3292559, 0.3276634, 0.3259846, 0.3247277, 0.3241646, 0.3241803, 
-0.3243371, 0.32412, 0.3232235, 0.3217213, 0.3200244, 0.3186515, 0.3179395, 0.3178562, 0.3180192, 0.3179098, 
-0.3171621, 0.3157668, 0.3140755, 0.3126039, 0.3117442, 0.3115466, 0.3116924, 0.3116722, 0.3110702, 0.3097957, 
-0.308133, 0.3065821, 0.3055796, 0.3052555, 0.3053617, 0.3054104, 0.3049474, 0.3038043, 0.3021922, 0.3005829, 
-0.299446, 0.2989865, 0.2990317, 0.2991279, 0.2987939, 0.2977894, 0.2962481, 0.2946026, 0.2933427, 0.2927423, 
-0.2927073, 0.2928285, 0.2926106, 0.2917484, 0.2902961, 0.2886369, 0.2872685, 0.2865254, 0.2863931, 0.2865166, 
-0.2863992, 0.2856793, 0.2843318, 0.2826815, 0.2812213, 0.2803371, 0.2800932, 0.2801967, 0.280162, 0.279581, 
-0.2783512, 0.2767318, 0.2751986, 0.2741784, 0.2738114, 0.2738735, 0.2739018, 0.273453, 0.2723507, 0.2707831, 
-0.2691971, 0.2680494, 0.2675512, 0.2675516, 0.267622, 0.2672955, 0.2663273, 0.2648307, 0.2632134, 0.2619494, 
-0.2613152, 0.2612356, 0.2613266, 0.2611095, 0.2602785, 0.2588703, 0.2572433, 0.2558772, 0.2551056, 0.2549299, 
-0.2550196, 0.2548967, 0.2542025, 0.2528975, 0.2512826, 0.2498309, 0.2489238, 0.2486385, 0.2487054, 0.2486592, 
-0.2480983, 0.2469086, 0.2453268, 0.2438077, 0.2427705, 0.242365, 0.2423886, 0.2424, 0.2419653, 0.2409, 
-0.2393714, 0.2378047, 0.2366459, 0.2361126, 0.2360736, 0.2361224, 0.235804, 0.234869, 0.233412, 0.2318184, 
-0.2305492, 0.2298839, 0.2297649, 0.22983, 0.2296153, 0.2288132, 0.2274442, 0.2258447, 0.2244792, 0.2236809, 
-0.2234665, 0.223527, 0.2234008, 0.2227309, 0.221464, 0.2198796, 0.2184339, 0.217505, 0.2171825, 0.2172176, 
-0.2171628, 0.2166211, 0.2154677, 0.2139187, 0.2124108, 0.2113569, 0.2109163, 0.2109062, 0.2109041, 0.2104835, 
-0.2094519, 0.2079577, 0.2064069, 0.2052365, 0.2046709, 0.2045971, 0.2046279, 0.2043184, 0.2034141, 0.2019922, 
-0.2004186, 0.1991431, 0.1984489, 0.1982946, 0.1983379, 0.1981269, 0.1973519, 0.196018, 0.1944421, 0.1930754, 
-0.192252, 0.1920027, 0.1920381, 0.1919106, 0.1912638, 0.1900313, 0.1884734, 0.1870315, 0.1860816, 0.1857252, 
-0.1857326, 0.1856717, 0.1851488, 0.1840285, 0.1825083, 0.1810088, 0.1799383, 0.1794655, 0.1794257, 0.179413, 
-0.1790067, 0.1780063, 0.1765425, 0.1750044, 0.173822, 0.1732265, 0.1731216, 0.1731377, 0.172838, 0.1719623, 
-0.1705718, 0.1690148, 0.1677319, 0.1670105, 0.1668245, 0.1668495, 0.1666436, 0.1658942, 0.1645921, 0.1630362, 
-0.1616667, 0.1608193, 0.1605383, 0.1605521, 0.1604252, 0.1598007, 0.1585996, 0.1570647, 0.1556244, 0.1546541, 
-0.1542666, 0.1542498, 0.154185, 0.1536808, 0.152591, 0.1510962, 0.1496026, 0.1485154, 0.1480127, 0.1479466, 
-0.1479259, 0.1475344, 0.146563, 0.1451263, 0.1435981, 0.142403, 0.1417794, 0.1416468, 0.141651, 0.141362, 
-0.1405133, 0.1391511, 0.1376078, 0.1363163, 0.1355689, 0.1353543, 0.1353639, 0.1351646, 0.1344398, 0.1331666, 
-0.1316277, 0.1302537, 0.129383, 0.129073, 0.1290685, 0.1289439, 0.1283412, 0.1271691, 0.125654, 0.1242134, 
-0.1232227, 0.1228065, 0.1227686, 0.1227022, 0.1222166, 0.1211552, 0.1196826, 0.1181927, 0.1170885, 0.1165579, 
-0.1164685, 0.1164423, 0.116066, 0.115122, 0.1137095, 0.1121887, 0.1109801, 0.1103298, 0.1101723, 0.1101673, 
-0.1098899, 0.1090671, 0.1077305, 0.106198, 0.1048968, 0.1041245, 0.1038838, 0.1038808, 0.1036894, 0.1029886, 
-0.1017418, 0.100217, 0.098837, 0.0979435, 0.0976068, 0.0975866, 0.0974662, 0.0968851, 0.0957398, 0.0942418, 
-0.0927988, 0.0917879, 0.0913449, 0.0912887, 0.0912227, 0.090756, 0.0897213, 0.0882682, 0.0867797, 0.0856581, 
-0.085101, 0.084991, 0.0849616, 0.0846012, 0.0836833, 0.0822924, 0.0807766, 0.0795537, 0.0788777, 0.0786977, 
-0.078686, 0.0784213, 0.0776236, 0.0763102, 0.0747862, 0.0734738, 0.0726772, 0.0724127, 0.0723996, 0.0722175, 
-0.0715402, 0.0703179, 0.0688047, 0.0674171, 0.066501, 0.0661395, 0.0661062, 0.0659917, 0.0654321, 0.064312, 
-0.0628284, 0.0613813, 0.0603499, 0.0598816, 0.0598095, 0.059746, 0.0592986, 0.0582892, 0.0568533, 0.0553641, 
-0.0542244, 0.053642, 0.0535138, 0.0534833, 0.0531396, 0.0522469, 0.0508753, 0.0493622, 0.0481239, 0.0474232, 
-0.0472229, 0.0472067, 0.0469559, 0.0461826, 0.0448904, 0.0433725, 0.0420477, 0.0412272, 0.0409407, 0.04092, 
-0.0407488, 0.0400948, 0.0388951, 0.0373912, 0.0359942, 0.0350555, 0.0346708, 0.0346267, 0.0345199, 0.0339822, 
-0.0328857, 0.0314144, 0.0299612, 0.0289089, 0.0284165, 0.0283308, 0.0282717, 0.0278443, 0.0268592, 0.0254382, 
-0.0239462, 0.0227876, 0.0221808, 0.0220364, 0.022007, 0.0216812, 0.0208128, 0.0194585, 0.0179461, 0.0166912, 
-0.0159661, 0.0157474, 0.0157291, 0.0154935, 0.0147443, 0.0134716, 0.0119575, 0.0106188, 0.0097744, 0.0094675, 
-0.0094414, 0.0092827, 0.0086522, 0.0074737, 0.0059768, 0.0045687, 0.0036071, 0.0032004, 0.0031478, 0.0030506, 
-0.0025352, 0.0014612, -0.0, -0.0014612, -0.0025352, -0.0030506, -0.0031478, -0.0032004, -0.0036071, -0.0045687, 
--0.0059768, -0.0074737, -0.0086522, -0.0092827, -0.0094414, -0.0094675, -0.0097744, -0.0106188, -0.0119575, -0.0134716, 
--0.0147443, -0.0154935, -0.0157291, -0.0157474, -0.0159661, -0.0166912, -0.0179461, -0.0194585, -0.0208128, -0.0216812, 
--0.022007, -0.0220364, -0.0221808, -0.0227876, -0.0239462, -0.0254382, -0.0268592, -0.0278443, -0.0282717, -0.0283308, 
--0.0284165, -0.0289089, -0.0299612, -0.0314144, -0.0328857, -0.0339822, -0.0345199, -0.0346267, -0.0346708, -0.0350555, 
--0.0359942, -0.0373912, -0.0388951, -0.0400948, -0.0407488, -0.04092, -0.0409407, -0.0412272, -0.0420477, -0.0433725, 
--0.0448904, -0.0461826, -0.0469559, -0.0472067, -0.0472229, -0.0474232, -0.0481239, -0.0493622, -0.0508753, -0.0522469, 
--0.0531396, -0.0534833, -0.0535138, -0.053642, -0.0542244, -0.0553641, -0.0568533, -0.0582892, -0.0592986, -0.059746, 
--0.0598095, -0.0598816, -0.0603499, -0.0613813, -0.0628284, -0.064312, -0.0654321, -0.0659917, -0.0661062, -0.0661395, 
--0.066501, -0.0674171, -0.0688047, -0.0703179, -0.0715402, -0.0722175, -0.0723996, -0.0724127, -0.0726772, -0.0734738, 
--0.0747862, -0.0763102, -0.0776236, -0.0784213, -0.078686, -0.0786977, -0.0788777, -0.0795537, -0.0807766, -0.0822924, 
--0.0836833, -0.0846012, -0.0849616, -0.084991, -0.085101, -0.0856581, -0.0867797, -0.0882682, -0.0897213, -0.090756, 
--0.0912227, -0.0912887, -0.0913449, -0.0917879, -0.0927988, -0.0942418, -0.0957398, -0.0968851, -0.0974662, -0.0975866, 
--0.0976068, -0.0979435, -0.098837, -0.100217, -0.1017418, -0.1029886, -0.1036894, -0.1038808, -0.1038838, -0.1041245, 
--0.1048968, -0.106198, -0.1077305, -0.1090671, -0.1098899, -0.1101673, -0.1101723, -0.1103298, -0.1109801, -0.1121887, 
--0.1137095, -0.115122, -0.116066, -0.1164423, -0.1164685, -0.1165579, -0.1170885, -0.1181927, -0.1196826, -0.1211552, 
--0.1222166, -0.1227022, -0.1227686, -0.1228065, -0.1232227, -0.1242134, -0.125654, -0.1271691, -0.1283412, -0.1289439, 
--0.1290685, -0.129073, -0.129383, -0.1302537, -0.1316277, -0.1331666, -0.1344398, -0.1351646, -0.1353639, -0.1353543, 
--0.1355689, -0.1363163, -0.1376078, -0.1391511, -0.1405133, -0.141362, -0.141651, -0.1416468, -0.1417794, -0.142403, 
--0.1435981, -0.1451263, -0.146563, -0.1475344, -0.1479259, -0.1479466, -0.1480127, -0.1485154, -0.1496026, -0.1510962, 
--0.152591, -0.1536808, -0.154185, -0.1542498, -0.1542666, -0.1546541, -0.1556244, -0.1570647, -0.1585996, -0.1598007, 
--0.1604252, -0.1605521, -0.1605383, -0.1608193, -0.1616667, -0.1630362, -0.1645921, -0.1658942, -0.1666436, -0.1668495, 
--0.1668245, -0.1670105, -0.1677319, -0.1690148, -0.1705718, -0.1719623, -0.172838, -0.1731377, -0.1731216, -0.1732265, 
--0.173822, -0.1750044, -0.1765425, -0.1780063, -0.1790067, -0.179413, -0.1794257, -0.1794655, -0.1799383, -0.1810088, 
--0.1825083, -0.1840285, -0.1851488, -0.1856717, -0.1857326, -0.1857252, -0.1860816, -0.1870315, -0.1884734, -0.1900313, 
--0.1912638, -0.1919106, -0.1920381, -0.1920027, -0.192252, -0.1930754, -0.1944421, -0.196018, -0.1973519, -0.1981269, 
--0.1983379, -0.1982946, -0.1984489, -0.1991431, -0.2004186, -0.2019922, -0.2034141, -0.2043184, -0.2046279, -0.2045971, 
--0.2046709, -0.2052365, -0.2064069, -0.2079577, -0.2094519, -0.2104835, -0.2109041, -0.2109062, -0.2109163, -0.2113569, 
--0.2124108, -0.2139187, -0.2154677, -0.2166211, -0.2171628, -0.2172176, -0.2171825, -0.217505, -0.2184339, -0.2198796, 
--0.221464, -0.2227309, -0.2234008, -0.223527, -0.2234665, -0.2236809, -0.2244792, -0.2258447, -0.2274442, -0.2288132, 
--0.2296153, -0.22983, -0.2297649, -0.2298839, -0.2305492, -0.2318184, -0.233412, -0.234869, -0.235804, -0.2361224, 
--0.2360736, -0.2361126, -0.2366459, -0.2378047, -0.2393714, -0.2409, -0.2419653, -0.2424, -0.2423886, -0.242365, 
--0.2427705, -0.2438077, -0.2453268, -0.2469086, -0.2480983, -0.2486592, -0.2487054, -0.2486385, -0.2489238, -0.2498309, 
--0.2512826, -0.2528975, -0.2542025, -0.2548967, -0.2550196, -0.2549299, -0.2551056, -0.2558772, -0.2572433, -0.2588703, 
--0.2602785, -0.2611095, -0.2613266, -0.2612356, -0.2613152, -0.2619494, -0.2632134, -0.2648307, -0.2663273, -0.2672955, 
--0.267622, -0.2675516, -0.2675512, -0.2680494, -0.2691971, -0.2707831, -0.2723507, -0.273453, -0.2739018, -0.2738735, 
--0.2738114, -0.2741784, -0.2751986, -0.2767318, -0.2783512, -0.279581, -0.280162, -0.2801967, -0.2800932, -0.2803371, 
--0.2812213, -0.2826815, -0.2843318, -0.2856793, -0.2863992, -0.2865166, -0.2863931, -0.2865254, -0.2872685, -0.2886369, 
--0.2902961, -0.2917484, -0.2926106, -0.2928285, -0.2927073, -0.2927423, -0.2933427, -0.2946026, -0.2962481, -0.2977894, 
--0.2987939, -0.2991279, -0.2990317, -0.2989865, -0.299446, -0.3005829, -0.3021922, -0.3038043, -0.3049474, -0.3054104, 
--0.3053617, -0.3052555, -0.3055796, -0.3065821, -0.308133, -0.3097957, -0.3110702, -0.3116722, -0.3116924, -0.3115466, 
--0.3117442, -0.3126039, -0.3140755, -0.3157668, -0.3171621, -0.3179098, -0.3180192, -0.3178562, -0.3179395, -0.3186515, 
--0.3200244, -0.3217213, -0.3232235, -0.32412, -0.3243371, -0.3241803, -0.3241646, -0.3247277, -0.3259846, -0.3276634, 
--0.3292559, -0.3303007, -0.3306414, -0.3305144, -0.330418, -0.3308343, -0.3319606, -0.3335978, -0.3352612, -0.33645, 
--0.3369276, -0.3368539, -0.336697, -0.3369729, -0.3379568, -0.3395294, -0.3412422, -0.3425672, -0.3431917, -0.3431937, 
--0.3429988, -0.3431438, -0.343977, -0.3454632, -0.3472023, -0.3486519, -0.34943, -0.3495287, -0.3493195, -0.349347, 
--0.3500247, -0.3514043, -0.3531454, -0.3547048, -0.3556394, -0.3558539, -0.3556551, -0.3555813, -0.3561026, -0.3573578, 
--0.3590761, -0.3607274, -0.3618175, -0.3621643, -0.3620007, -0.361845, -0.3622127, -0.3633283, -0.3649991, -0.3667217, 
--0.3679625, -0.3684553, -0.3683514, -0.3681355, -0.3683565, -0.3693206, -0.3709197, -0.3726908, -0.3740734, -0.3747226, 
--0.3747019, -0.3744496, -0.3745345, -0.3753385, -0.3768431, -0.3786382, -0.3801503, -0.3809622, -0.3810469, -0.3807834, 
--0.3807464, -0.3813857, -0.3827747, -0.3845681, -0.3861936, -0.3871711, -0.387381, -0.3871323, -0.3869911, -0.3874651, 
--0.3887199, -0.3904852, -0.392205, -0.3933466, -0.3936991, -0.3934915, -0.3932668, -0.3935788, -0.3946836, -0.3963948, 
--0.3981867, -0.399487, -0.3999961, -0.3998556, -0.3995706, -0.3997283, -0.4006707, -0.4023022, -0.4041419, -0.4055912, 
--0.4062675, -0.406219, -0.4058991, -0.4059141, -0.4066854, -0.408213, -0.4100744, -0.4116591, -0.4125094, -0.4125761, 
--0.4122481, -0.4121359, -0.4127315, -0.4141331, -0.4159887, -0.4176915, -0.4187182, -0.4189212, -0.418613, -0.4183926, 
--0.4188121, -0.4200679, -0.4218897, -0.42369, -0.4248913, -0.4252487, -0.4249884, -0.4246821, -0.4249296, -0.426023, 
--0.4277831, -0.429657, -0.4310267, -0.4315534, -0.4313686, -0.4310014, -0.4310853, -0.4320034, -0.4336745, -0.4355959, 
--0.4371234, -0.4378305, -0.4377477, -0.437347, -0.4372799, -0.4380137, -0.4395701, -0.4415108, -0.4431812, -0.4440755, 
--0.4441196, -0.4437143, -0.4435131, -0.444058, -0.4454759, -0.4474063, -0.449201, -0.4502849, -0.4504783, -0.4500982, 
--0.4497836, -0.4501394, -0.4513979, -0.453288, -0.4551844, -0.4564557, -0.4568177, -0.4564931, -0.4560894, -0.4562606, 
--0.4573421, -0.4591617, -0.461134, -0.4625858, -0.4631323, -0.462893, -0.4624272, -0.4624231, -0.4633137, -0.4650336, 
--0.4670534, -0.4686741, -0.4694168, -0.4692913, -0.4687931, -0.4686278, -0.469318, -0.4709102, -0.472947, -0.4747203, 
--0.4756665, -0.4756817, -0.4751824, -0.4748742, -0.4753591, -0.4767982, -0.4788199, -0.4807253, -0.4818773, -0.4820575, 
--0.4815895, -0.4811611, -0.4814407, -0.482704, -0.4846779, -0.4866908, -0.4880462, -0.4884122, -0.4880085, -0.4874862, 
--0.4875657, -0.488634, -0.4905273, -0.4926195, -0.4941706, -0.4947397, -0.4944327, -0.4938463, -0.4937358, -0.4945942, 
--0.4963749, -0.4985154, -0.5002494, -0.5010342, -0.5008553, -0.500237, -0.499952, -0.50059, -0.5022277, -0.504383, 
--0.506282, -0.5072905, -0.507269, -0.5066534, -0.506214, -0.5066263, -0.508093, -0.5102279, -0.5122694, -0.5135042, 
--0.5136667, -0.5130894, -0.5125205, -0.5127072, -0.5139778, -0.5160563, -0.5182133, -0.5196717, -0.5200412, -0.5195385, 
--0.5188692, -0.5188358, -0.5198892, -0.5218751, -0.5241165, -0.5257902, -0.5263858, -0.5259936, -0.5252566, -0.5250143, 
--0.5258339, -0.5276917, -0.5299833, -0.531858, -0.5326941, -0.5324471, -0.5316783, -0.5312439, -0.5318179, -0.5335138, 
--0.5358184, -0.5378747, -0.5389602, -0.5388911, -0.5381286, -0.5375245, -0.5378467, -0.5393494, -0.5416278, -0.5438408, 
--0.5451789, -0.5453176, -0.5446013, -0.543855, -0.5439251, -0.5452064, -0.5474184, -0.5497581, -0.5513462, -0.5517188, 
--0.5510893, -0.5502329, -0.5500568, -0.5510927, -0.5531976, -0.5556295, -0.5574586, -0.5580869, -0.5575845, -0.5566548, 
--0.5562445, -0.5570157, -0.5589736, -0.5614592, -0.5635141, -0.5644147, -0.5640788, -0.5631158, -0.5624898, -0.5629826, 
--0.564755, -0.5672526, -0.5695116, -0.5706953, -0.5705633, -0.5696101, -0.568793, -0.5689996, -0.5705505, -0.573016, 
--0.5754515, -0.5769228, -0.5770292, -0.5761309, -0.5751533, -0.5750725, -0.5763692, -0.5787566, -0.5813352, -0.5830921, 
--0.5834674, -0.5826704, -0.5815685, -0.5812058, -0.5822201, -0.5844829, -0.5871657, -0.589199, -0.589869, -0.5892199, 
--0.588035, -0.5874031, -0.5881118, -0.5902036, -0.5929472, -0.5952406, -0.5962256, -0.5957702, -0.5945479, -0.5936668, 
--0.5940526, -0.5959284, -0.5986851, -0.601215, -0.6025291, -0.6023114, -0.6011012, -0.5999981, -0.6000502, -0.6016674, 
--0.604386, -0.6071219, -0.6087723, -0.6088334, -0.6076877, -0.6063965, -0.6061117, -0.6074308, -0.610058, -0.6129622, 
--0.6149484, -0.6153258, -0.6142988, -0.6128605, -0.612243, -0.613229, -0.6157098, -0.6187383, -0.6210521, -0.6217781, 
--0.6209252, -0.619387, -0.6184492, -0.6190724, -0.6213514, -0.624454, -0.6270788, -0.6281802, -0.6275566, -0.6259715, 
--0.624734, -0.624971, -0.6269935, -0.6301146, -0.6330254, -0.6345221, -0.634182, -0.6326079, -0.6311001, -0.6309346, 
--0.6326474, -0.6357268, -0.63889, -0.6407944, -0.6407896, -0.6392889, -0.6375487, -0.6369723, -0.638325, -0.6412984, 
--0.6446721, -0.6469884, -0.6473673, -0.646006, -0.6440794, -0.6430923, -0.6440386, -0.6468388, -0.6503725, -0.653096, 
--0.6539028, -0.6527492, -0.6506908, -0.6493024, -0.6498009, -0.6523583, -0.6559938, -0.6591103, -0.6603834, -0.6595076, 
--0.6573796, -0.6556091, -0.6556244, -0.6578686, -0.6615397, -0.6650249, -0.6667964, -0.6662692, -0.6641414, -0.6620181, 
--0.6615217, -0.6633821, -0.6670154, -0.6708349, -0.6731292, -0.673021, -0.6709703, -0.6685339, -0.6675056, -0.6689122, 
--0.6724274, -0.676536, -0.6793693, -0.6797492, -0.6778592, -0.6751603, -0.6735883, -0.6744731, -0.6777835, -0.6821251, 
--0.6855043, -0.6864392, -0.6847996, -0.6819, -0.6797824, -0.6800797, -0.6830925, -0.6875997, -0.6915218, -0.6930758, 
--0.6917824, -0.6887552, -0.6861002, -0.6857476, -0.6883642, -0.6929581, -0.6974092, -0.6996429, -0.6987972, -0.6957275, 
--0.6925545, -0.6914934, -0.6936092, -0.6981985, -0.7031534, -0.7061236, -0.7058332, -0.7028186, -0.6991589, -0.6973345, 
--0.6988386, -0.7033188, -0.7087404, -0.7124997, -0.7128792, -0.7100312, -0.7059284, -0.7032898, -0.7040638, -0.708316, 
--0.7141536, -0.7187514, -0.7199237, -0.7173694, -0.7128811, -0.7093805, -0.7092962, -0.7131842, -0.7193731, -0.7248559, 
--0.7269555, -0.7248409, -0.7200397, -0.715631, -0.7145467, -0.7179132, -0.7243725, -0.7307865, -0.7339638, -0.7324595, 
--0.7274352, -0.7220716, -0.7198255, -0.722485, -0.7291147, -0.7365088, -0.7409395, -0.7402487, -0.7351126, -0.7287417, 
--0.7251408, -0.7268682, -0.7335443, -0.7419762, -0.7478755, -0.7482504, -0.7431413, -0.7356973, -0.7304979, -0.7310073, 
--0.7375732, -0.7471201, -0.7547691, -0.7565385, -0.7516348, -0.7430245, -0.7358959, -0.7348027, -0.7410524, -0.7518305, 
--0.7616263, -0.7652489, -0.7607924, -0.750867, -0.7413213, -0.7380657, -0.7437099, -0.7559143, -0.7684724, -0.7746493, 
--0.7709947, -0.7594916, -0.7467296, -0.7404071, -0.7449973, -0.7589918, -0.7753847, -0.7853245, -0.7830608, -0.769459, 
--0.7519837, -0.7409092, -0.7436353, -0.7601966, -0.7826176, -0.7987974, -0.7991062, -0.7821845, -0.7565749, -0.7368472, 
--0.7358476, -0.7570441, -0.7913092, -0.8204924, -0.8266423, -0.8024792, -0.7574718, -0.7154932, -0.7039657, -0.7388334, 
--0.8124127, -0.8906342, -0.9223868, -0.8582135, -0.6709916, -0.3697198, 0.0, 0.3682585, 0.6684564, 0.8551629, 
-0.919239, 0.8874337, 0.8088056, 0.7342647, 0.697989, 0.7080196, 0.7488196, 0.7931964, 0.8172009, 0.8110249, 
-0.7815348, 0.7464253, 0.7238901, 0.7233756, 0.7418306, 0.766691, 0.7833771, 0.7830501, 0.7666515, 0.7435054, 
-0.7256892, 0.7214507, 0.7311709, 0.7477779, 0.7610538, 0.7632881, 0.7532039, 0.7362042, 0.7210512, 0.7149689, 
-0.7198704, 0.7316473, 0.742723, 0.7463185, 0.7400559, 0.7270054, 0.7137488, 0.7066513, 0.7084356, 0.7168849, 
-0.7262725, 0.7306222, 0.7269555, 0.716775, 0.7050582, 0.6974116, 0.6970009, 0.7029297, 0.710886, 0.7156185, 
-0.7138285, 0.7058929, 0.6955255, 0.6876348, 0.6856075, 0.6895147, 0.6961853, 0.7010437, 0.7006526, 0.694553, 
-0.6854203, 0.6775059, 0.6742656, 0.6764948, 0.6819729, 0.6867655, 0.6874257, 0.6828668, 0.6748903, 0.667121, 
-0.6629722, 0.6637824, 0.6681366, 0.6727135, 0.6741543, 0.6709049, 0.6640225, 0.6565319, 0.6517183, 0.6513191, 
-0.6546076, 0.6588493, 0.6608493, 0.6587164, 0.6528721, 0.6457672, 0.6404915, 0.6390626, 0.6413409, 0.6451518, 
-0.6475241, 0.6463387, 0.6414764, 0.6348422, 0.6292777, 0.6269796, 0.6283049, 0.6316098, 0.6341932, 0.633802, 
-0.6298626, 0.6237652, 0.6180621, 0.6150421, 0.6154756, 0.6182174, 0.6208717, 0.6211326, 0.6180525, 0.6125404, 
-0.6068296, 0.6032251, 0.6028332, 0.6049715, 0.6075745, 0.6083542, 0.6060643, 0.6011701, 0.5955654, 0.5915058, 
-0.5903604, 0.5918701, 0.5943162, 0.5954892, 0.5939149, 0.5896562, 0.5842555, 0.5798626, 0.5780406, 0.5789115, 
-0.5811103, 0.5825584, 0.5816205, 0.5780006, 0.5728867, 0.5682751, 0.5658578, 0.5660932, 0.5679693, 0.5695818, 
-0.569197, 0.5662062, 0.5614473, 0.5567235, 0.5537961, 0.5534119, 0.5549043, 0.5565787, 0.5566607, 0.554277, 
-0.5499269, 0.5451895, 0.5418391, 0.5408629, 0.5419248, 0.543567, 0.5440278, 0.5422184, 0.538317, 0.5336553, 
-0.5299703, 0.52844, 0.5290385, 0.5305638, 0.5313149, 0.5300372, 0.5266108, 0.5221046, 0.5181732, 0.5161358, 
-0.516251, 0.5175847, 0.5185389, 0.5177417, 0.5148036, 0.5105225, 0.5064309, 0.5039412, 0.5035661, 0.504644, 
-0.5057163, 0.5053416, 0.5028927, 0.4988954, 0.4947268, 0.4918459, 0.4909856, 0.4917545, 0.4928636, 0.4928478, 
-0.4908773, 0.4872114, 0.4830448, 0.4798385, 0.4785092, 0.4789271, 0.4799969, 0.4802723, 0.4787588, 0.4754606, 
-0.4713691, 0.4679063, 0.4661344, 0.4661708, 0.4671315, 0.467628, 0.4665405, 0.4636348, 0.4596847, 0.4560361, 
-0.4538571, 0.4534928, 0.4542817, 0.4549286, 0.4542276, 0.4517278, 0.4479779, 0.4442142, 0.4416712, 0.4408983, 
-0.4414608, 0.4421881, 0.4418268, 0.4397357, 0.436236, 0.4324264, 0.4295691, 0.4283902, 0.4286809, 0.4294204, 
-0.4293465, 0.4276564, 0.4244477, 0.4206586, 0.4175419, 0.4159696, 0.4159524, 0.4166398, 0.4167965, 0.4154898, 
-0.4126034, 0.4088969, 0.4055791, 0.4036355, 0.4032841, 0.4038596, 0.4041875, 0.4032379, 0.4006952, 0.3971282, 
-0.3936696, 0.3913851, 0.3906831, 0.391093, 0.3915311, 0.3909045, 0.3887169, 0.3853398, 0.3818015, 0.3792136, 
-0.3781544, 0.378352, 0.3788394, 0.378495, 0.3766643, 0.3735202, 0.3699624, 0.3671148, 0.3657014, 0.3656474, 
-0.3661251, 0.3660166, 0.3645352, 0.3616591, 0.3581397, 0.3550809, 0.3533254, 0.352989, 0.3534005, 0.3534777, 
-0.3523291, 0.3497476, 0.3463211, 0.343103, 0.3410258, 0.3403849, 0.340678, 0.3408876, 0.3400476, 0.3377783, 
-0.3344944, 0.331171, 0.3288003, 0.3278416, 0.3279692, 0.3282569, 0.3276937, 0.3257456, 0.3226484, 0.3192743, 
-0.3166448, 0.3153639, 0.3152852, 0.3155964, 0.3152726, 0.3136455, 0.3107725, 0.3074017, 0.3045537, 0.3029549, 
-0.302636, 0.3029176, 0.3027903, 0.3014758, 0.2988573, 0.2955417, 0.2925199, 0.2906159, 0.2900303, 0.2902318, 
-0.2902547, 0.2892362, 0.2868946, 0.283683, 0.2805353, 0.2783464, 0.2774757, 0.2775504, 0.2776745, 0.2769281, 
-0.2748777, 0.2718145, 0.2685906, 0.266144, 0.2649781, 0.2648841, 0.2650593, 0.2645545, 0.2628013, 0.2599257, 
-0.2566759, 0.254005, 0.2525419, 0.252243, 0.2524192, 0.25212, 0.250662, 0.2480069, 0.2447807, 0.2419241, 
-0.2401698, 0.2396364, 0.2397649, 0.2396307, 0.238458, 0.2360495, 0.2328944, 0.2298945, 0.2278628, 0.2270724, 
-0.227107, 0.2270938, 0.2261889, 0.2240459, 0.2210064, 0.2179085, 0.2156202, 0.2145577, 0.2144561, 0.2145175, 
-0.2138563, 0.21199, 0.2091064, 0.2059573, 0.2034397, 0.2020979, 0.2018221, 0.2019111, 0.2014633, 0.1998772, 
-0.1971846, 0.1940315, 0.1913176, 0.1896968, 0.1892146, 0.1892843, 0.1890145, 0.1877043, 0.1852319, 0.1821211, 
-0.1792486, 0.1773568, 0.1766421, 0.176647, 0.1765157, 0.1754697, 0.1732403, 0.1702161, 0.167226, 0.1650785, 
-0.1641121, 0.1640095, 0.163974, 0.1631737, 0.1612029, 0.1583063, 0.1552425, 0.152861, 0.151631, 0.1513816, 
-0.1513976, 0.1508179, 0.1491139, 0.1463821, 0.1432893, 0.1407019, 0.1392037, 0.1387729, 0.1387952, 0.1384056, 
-0.1369693, 0.134434, 0.1313575, 0.1285972, 0.1268335, 0.1261924, 0.1261763, 0.1259413, 0.1247664, 0.1224537, 
-0.1194373, 0.1165416, 0.1145225, 0.1136481, 0.1135506, 0.113431, 0.112504, 0.1104335, 0.1075191, 0.1045285, 
-0.1022709, 0.1011471, 0.1009278, 0.1008818, 0.1001824, 0.0983669, 0.095593, 0.0925505, 0.0900776, 0.0886951, 
-0.0883176, 0.0883018, 0.0878039, 0.086249, 0.0836498, 0.0805991, 0.0779398, 0.0762966, 0.0757291, 0.0756995, 
-0.0753716, 0.0740757, 0.0716805, 0.0686653, 0.0658535, 0.0639547, 0.0631709, 0.0630844, 0.0628906, 0.061845, 
-0.059677, 0.0567396, 0.053813, 0.0516709, 0.0506505, 0.0504659, 0.0503668, 0.049556, 0.0476322, 0.0448125, 
-0.0418118, 0.0394451, 0.0381747, 0.0378536, 0.0378074, 0.0372095, 0.0355399, 0.0328745, 0.0298423, 0.0272759, 
-0.0257488, 0.0252568, 0.0252206, 0.0248078, 0.0233955, 0.0209164, 0.0178959, 0.0151602, 0.013377, 0.0126845, 
-0.012615, 0.0123546, 0.0111956, 0.0089297, 0.0059637, 0.0030936, 0.0010618, 0.0001449, -0.0, -0.0001449, 
--0.0010618, -0.0030936, -0.0059637, -0.0089297, -0.0111956, -0.0123546, -0.012615, -0.0126845, -0.013377, -0.0151602, 
--0.0178959, -0.0209164, -0.0233955, -0.0248078, -0.0252206, -0.0252568, -0.0257488, -0.0272759, -0.0298423, -0.0328745, 
--0.0355399, -0.0372095, -0.0378074, -0.0378536, -0.0381747, -0.0394451, -0.0418118, -0.0448125, -0.0476322, -0.049556, 
--0.0503668, -0.0504659, -0.0506505, -0.0516709, -0.053813, -0.0567396, -0.059677, -0.061845, -0.0628906, -0.0630844, 
--0.0631709, -0.0639547, -0.0658535, -0.0686653, -0.0716805, -0.0740757, -0.0753716, -0.0756995, -0.0757291, -0.0762966, 
--0.0779398, -0.0805991, -0.0836498, -0.086249, -0.0878039, -0.0883018, -0.0883176, -0.0886951, -0.0900776, -0.0925505, 
--0.095593, -0.0983669, -0.1001824, -0.1008818, -0.1009278, -0.1011471, -0.1022709, -0.1045285, -0.1075191, -0.1104335, 
--0.112504, -0.113431, -0.1135506, -0.1136481, -0.1145225, -0.1165416, -0.1194373, -0.1224537, -0.1247664, -0.1259413, 
--0.1261763, -0.1261924, -0.1268335, -0.1285972, -0.1313575, -0.134434, -0.1369693, -0.1384056, -0.1387952, -0.1387729, 
--0.1392037, -0.1407019, -0.1432893, -0.1463821, -0.1491139, -0.1508179, -0.1513976, -0.1513816, -0.151631, -0.152861, 
--0.1552425, -0.1583063, -0.1612029, -0.1631737, -0.163974, -0.1640095, -0.1641121, -0.1650785, -0.167226, -0.1702161, 
--0.1732403, -0.1754697, -0.1765157, -0.176647, -0.1766421, -0.1773568, -0.1792486, -0.1821211, -0.1852319, -0.1877043, 
--0.1890145, -0.1892843, -0.1892146, -0.1896968, -0.1913176, -0.1940315, -0.1971846, -0.1998772, -0.2014633, -0.2019111, 
--0.2018221, -0.2020979, -0.2034397, -0.2059573, -0.2091064, -0.21199, -0.2138563, -0.2145175, -0.2144561, -0.2145577, 
--0.2156202, -0.2179085, -0.2210064, -0.2240459, -0.2261889, -0.2270938, -0.227107, -0.2270724, -0.2278628, -0.2298945, 
--0.2328944, -0.2360495, -0.238458, -0.2396307, -0.2397649, -0.2396364, -0.2401698, -0.2419241, -0.2447807, -0.2480069, 
--0.250662, -0.25212, -0.2524192, -0.252243, -0.2525419, -0.254005, -0.2566759, -0.2599257, -0.2628013, -0.2645545, 
--0.2650593, -0.2648841, -0.2649781, -0.266144, -0.2685906, -0.2718145, -0.2748777, -0.2769281, -0.2776745, -0.2775504, 
--0.2774757, -0.2783464, -0.2805353, -0.283683, -0.2868946, -0.2892362, -0.2902547, -0.2902318, -0.2900303, -0.2906159, 
--0.2925199, -0.2955417, -0.2988573, -0.3014758, -0.3027903, -0.3029176, -0.302636, -0.3029549, -0.3045537, -0.3074017, 
--0.3107725, -0.3136455, -0.3152726, -0.3155964, -0.3152852, -0.3153639, -0.3166448, -0.3192743, -0.3226484, -0.3257456, 
--0.3276937, -0.3282569, -0.3279692, -0.3278416, -0.3288003, -0.331171, -0.3344944, -0.3377783, -0.3400476, -0.3408876, 
--0.340678, -0.3403849, -0.3410258, -0.343103, -0.3463211, -0.3497476, -0.3523291, -0.3534777, -0.3534005, -0.352989, 
--0.3533254, -0.3550809, -0.3581397, -0.3616591, -0.3645352, -0.3660166, -0.3661251, -0.3656474, -0.3657014, -0.3671148, 
--0.3699624, -0.3735202, -0.3766643, -0.378495, -0.3788394, -0.378352, -0.3781544, -0.3792136, -0.3818015, -0.3853398, 
--0.3887169, -0.3909045, -0.3915311, -0.391093, -0.3906831, -0.3913851, -0.3936696, -0.3971282, -0.4006952, -0.4032379, 
--0.4041875, -0.4038596, -0.4032841, -0.4036355, -0.4055791, -0.4088969, -0.4126034, -0.4154898, -0.4167965, -0.4166398, 
--0.4159524, -0.4159696, -0.4175419, -0.4206586, -0.4244477, -0.4276564, -0.4293465, -0.4294204, -0.4286809, -0.4283902, 
--0.4295691, -0.4324264, -0.436236, -0.4397357, -0.4418268, -0.4421881, -0.4414608, -0.4408983, -0.4416712, -0.4442142, 
--0.4479779, -0.4517278, -0.4542276, -0.4549286, -0.4542817, -0.4534928, -0.4538571, -0.4560361, -0.4596847, -0.4636348, 
--0.4665405, -0.467628, -0.4671315, -0.4661708, -0.4661344, -0.4679063, -0.4713691, -0.4754606, -0.4787588, -0.4802723, 
--0.4799969, -0.4789271, -0.4785092, -0.4798385, -0.4830448, -0.4872114, -0.4908773, -0.4928478, -0.4928636, -0.4917545, 
--0.4909856, -0.4918459, -0.4947268, -0.4988954, -0.5028927, -0.5053416, -0.5057163, -0.504644, -0.5035661, -0.5039412, 
--0.5064309, -0.5105225, -0.5148036, -0.5177417, -0.5185389, -0.5175847, -0.516251, -0.5161358, -0.5181732, -0.5221046, 
--0.5266108, -0.5300372, -0.5313149, -0.5305638, -0.5290385, -0.52844, -0.5299703, -0.5336553, -0.538317, -0.5422184, 
--0.5440278, -0.543567, -0.5419248, -0.5408629, -0.5418391, -0.5451895, -0.5499269, -0.554277, -0.5566607, -0.5565787, 
--0.5549043, -0.5534119, -0.5537961, -0.5567235, -0.5614473, -0.5662062, -0.569197, -0.5695818, -0.5679693, -0.5660932, 
--0.5658578, -0.5682751, -0.5728867, -0.5780006, -0.5816205, -0.5825584, -0.5811103, -0.5789115, -0.5780406, -0.5798626, 
--0.5842555, -0.5896562, -0.5939149, -0.5954892, -0.5943162, -0.5918701, -0.5903604, -0.5915058, -0.5955654, -0.6011701, 
--0.6060643, -0.6083542, -0.6075745, -0.6049715, -0.6028332, -0.6032251, -0.6068296, -0.6125404, -0.6180525, -0.6211326, 
--0.6208717, -0.6182174, -0.6154756, -0.6150421, -0.6180621, -0.6237652, -0.6298626, -0.633802, -0.6341932, -0.6316098, 
--0.6283049, -0.6269796, -0.6292777, -0.6348422, -0.6414764, -0.6463387, -0.6475241, -0.6451518, -0.6413409, -0.6390626, 
--0.6404915, -0.6457672, -0.6528721, -0.6587164, -0.6608493, -0.6588493, -0.6546076, -0.6513191, -0.6517183, -0.6565319, 
--0.6640225, -0.6709049, -0.6741543, -0.6727135, -0.6681366, -0.6637824, -0.6629722, -0.667121, -0.6748903, -0.6828668, 
--0.6874257, -0.6867655, -0.6819729, -0.6764948, -0.6742656, -0.6775059, -0.6854203, -0.694553, -0.7006526, -0.7010437, 
--0.6961853, -0.6895147, -0.6856075, -0.6876348, -0.6955255, -0.7058929, -0.7138285, -0.7156185, -0.710886, -0.7029297, 
--0.6970009, -0.6974116, -0.7050582, -0.716775, -0.7269555, -0.7306222, -0.7262725, -0.7168849, -0.7084356, -0.7066513, 
--0.7137488, -0.7270054, -0.7400559, -0.7463185, -0.742723, -0.7316473, -0.7198704, -0.7149689, -0.7210512, -0.7362042, 
--0.7532039, -0.7632881, -0.7610538, -0.7477779, -0.7311709, -0.7214507, -0.7256892, -0.7435054, -0.7666515, -0.7830501, 
--0.7833771, -0.766691, -0.7418306, -0.7233756, -0.7238901, -0.7464253, -0.7815348, -0.8110249, -0.8172009, -0.7931964, 
--0.7488196, -0.7080196, -0.697989, -0.7342647, -0.8088056, -0.8874337, -0.919239, -0.8551629, -0.6684564, -0.3682585, 
-0.0, 0.3681136, 0.6673946, 0.8520694, 0.9132753, 0.878504, 0.79761, 0.7219101, 0.6853739, 0.695335, 
-0.7354426, 0.7780362, 0.7993049, 0.7901084, 0.7581393, 0.7216175, 0.6986695, 0.6981187, 0.7160818, 0.7394151, 
-0.7535348, 0.7501756, 0.7311116, 0.7062959, 0.6878818, 0.6835971, 0.6929962, 0.7083328, 0.719242, 0.7184756, 
-0.7055717, 0.6866482, 0.6706844, 0.664503, 0.6692199, 0.6799765, 0.68891, 0.6895789, 0.6803789, 0.6651604, 
-0.6508582, 0.6435669, 0.6452647, 0.6529302, 0.6604191, 0.661957, 0.655275, 0.6426993, 0.6296866, 0.621712, 
-0.6212717, 0.6266331, 0.6329462, 0.6350194, 0.6301787, 0.6196439, 0.6077216, 0.599333, 0.5972898, 0.6008196, 
-0.6061077, 0.6084932, 0.6050596, 0.596186, 0.5852379, 0.5766241, 0.5733377, 0.5753477, 0.579702, 0.5822369, 
-0.5799067, 0.5724333, 0.5623864, 0.55369, 0.5494216, 0.5501342, 0.5536141, 0.5561719, 0.554717, 0.5484512, 
-0.5392561, 0.5305906, 0.525542, 0.5251267, 0.5277741, 0.5302521, 0.5294918, 0.5242824, 0.5159027, 0.5073616, 
-0.5016963, 0.5002897, 0.5021372, 0.50445, 0.5042347, 0.4999566, 0.4923624, 0.4840243, 0.4778801, 0.475598, 
-0.4766738, 0.4787489, 0.4789507, 0.4754956, 0.4686598, 0.4605914, 0.454088, 0.4510326, 0.4513634, 0.453139, 
-0.4536456, 0.4509165, 0.4448121, 0.4370706, 0.4303139, 0.4265781, 0.4261911, 0.4276147, 0.428326, 0.4262331, 
-0.4208323, 0.4134659, 0.4065509, 0.4022215, 0.4011458, 0.4021733, 0.4029986, 0.4014577, 0.3967303, 0.389779, 
-0.3827921, 0.3779515, 0.3762185, 0.3768136, 0.3776705, 0.3766011, 0.372514, 0.3660106, 0.3590304, 0.3537575, 
-0.3514018, 0.3515355, 0.3523491, 0.3516733, 0.3481906, 0.3421603, 0.3352584, 0.3296298, 0.3266891, 0.3263395, 
-0.3270416, 0.3266842, 0.3237662, 0.3182275, 0.3114689, 0.3055588, 0.3020742, 0.3012264, 0.301755, 0.3016429, 
-0.2992471, 0.2942115, 0.2876549, 0.2815352, 0.2775511, 0.276197, 0.2764965, 0.2765587, 0.2746391, 0.2701115, 
-0.2638095, 0.2575501, 0.2531139, 0.2512517, 0.2512728, 0.2514407, 0.2499483, 0.2459272, 0.2399259, 0.2335944, 
-0.2287564, 0.2263908, 0.2260904, 0.2262977, 0.225181, 0.2216586, 0.2159981, 0.2096591, 0.2044721, 0.2016141, 
-0.2009553, 0.2011386, 0.2003437, 0.1973061, 0.19202, 0.1857356, 0.1802545, 0.1769209, 0.1758732, 0.1759721, 
-0.1754432, 0.1728706, 0.1679863, 0.1618151, 0.1560965, 0.1523099, 0.1508491, 0.1508069, 0.1504867, 0.1483537, 
-0.1438921, 0.1378892, 0.131991, 0.1277793, 0.1258878, 0.1256513, 0.1254814, 0.1237576, 0.1197331, 0.1139495, 
-0.1079304, 0.1033266, 0.1009932, 0.1005134, 0.100435, 0.0990851, 0.0955057, 0.0899882, 0.0839069, 0.0789487, 
-0.0761686, 0.0754012, 0.0753556, 0.0743395, 0.0712068, 0.0659973, 0.0599125, 0.0546419, 0.0514168, 0.0503222, 
-0.050251, 0.049525, 0.0468341, 0.0419696, 0.0359391, 0.0304019, 0.0267397, 0.0252836, 0.0251297, 0.024646, 
-0.022386, 0.0178981, 0.0119783, 0.0062237, 0.0021386, 0.0002921, -0.0, -0.0002921, -0.0021386, -0.0062237, 
--0.0119783, -0.0178981, -0.022386, -0.024646, -0.0251297, -0.0252836, -0.0267397, -0.0304019, -0.0359391, -0.0419696, 
--0.0468341, -0.049525, -0.050251, -0.0503222, -0.0514168, -0.0546419, -0.0599125, -0.0659973, -0.0712068, -0.0743395, 
--0.0753556, -0.0754012, -0.0761686, -0.0789487, -0.0839069, -0.0899882, -0.0955057, -0.0990851, -0.100435, -0.1005134, 
--0.1009932, -0.1033266, -0.1079304, -0.1139495, -0.1197331, -0.1237576, -0.1254814, -0.1256513, -0.1258878, -0.1277793, 
--0.131991, -0.1378892, -0.1438921, -0.1483537, -0.1504867, -0.1508069, -0.1508491, -0.1523099, -0.1560965, -0.1618151, 
--0.1679863, -0.1728706, -0.1754432, -0.1759721, -0.1758732, -0.1769209, -0.1802545, -0.1857356, -0.19202, -0.1973061, 
--0.2003437, -0.2011386, -0.2009553, -0.2016141, -0.2044721, -0.2096591, -0.2159981, -0.2216586, -0.225181, -0.2262977, 
--0.2260904, -0.2263908, -0.2287564, -0.2335944, -0.2399259, -0.2459272, -0.2499483, -0.2514407, -0.2512728, -0.2512517, 
--0.2531139, -0.2575501, -0.2638095, -0.2701115, -0.2746391, -0.2765587, -0.2764965, -0.276197, -0.2775511, -0.2815352, 
--0.2876549, -0.2942115, -0.2992471, -0.3016429, -0.301755, -0.3012264, -0.3020742, -0.3055588, -0.3114689, -0.3182275, 
--0.3237662, -0.3266842, -0.3270416, -0.3263395, -0.3266891, -0.3296298, -0.3352584, -0.3421603, -0.3481906, -0.3516733, 
--0.3523491, -0.3515355, -0.3514018, -0.3537575, -0.3590304, -0.3660106, -0.372514, -0.3766011, -0.3776705, -0.3768136, 
--0.3762185, -0.3779515, -0.3827921, -0.389779, -0.3967303, -0.4014577, -0.4029986, -0.4021733, -0.4011458, -0.4022215, 
--0.4065509, -0.4134659, -0.4208323, -0.4262331, -0.428326, -0.4276147, -0.4261911, -0.4265781, -0.4303139, -0.4370706, 
--0.4448121, -0.4509165, -0.4536456, -0.453139, -0.4513634, -0.4510326, -0.454088, -0.4605914, -0.4686598, -0.4754956, 
--0.4789507, -0.4787489, -0.4766738, -0.475598, -0.4778801, -0.4840243, -0.4923624, -0.4999566, -0.5042347, -0.50445, 
--0.5021372, -0.5002897, -0.5016963, -0.5073616, -0.5159027, -0.5242824, -0.5294918, -0.5302521, -0.5277741, -0.5251267, 
--0.525542, -0.5305906, -0.5392561, -0.5484512, -0.554717, -0.5561719, -0.5536141, -0.5501342, -0.5494216, -0.55369, 
--0.5623864, -0.5724333, -0.5799067, -0.5822369, -0.579702, -0.5753477, -0.5733377, -0.5766241, -0.5852379, -0.596186, 
--0.6050596, -0.6084932, -0.6061077, -0.6008196, -0.5972898, -0.599333, -0.6077216, -0.6196439, -0.6301787, -0.6350194, 
--0.6329462, -0.6266331, -0.6212717, -0.621712, -0.6296866, -0.6426993, -0.655275, -0.661957, -0.6604191, -0.6529302, 
--0.6452647, -0.6435669, -0.6508582, -0.6651604, -0.6803789, -0.6895789, -0.68891, -0.6799765, -0.6692199, -0.664503, 
--0.6706844, -0.6866482, -0.7055717, -0.7184756, -0.719242, -0.7083328, -0.6929962, -0.6835971, -0.6878818, -0.7062959, 
--0.7311116, -0.7501756, -0.7535348, -0.7394151, -0.7160818, -0.6981187, -0.6986695, -0.7216175, -0.7581393, -0.7901084, 
--0.7993049, -0.7780362, -0.7354426, -0.695335, -0.6853739, -0.7219101, -0.79761, -0.878504, -0.9132753, -0.8520694, 
--0.6673946, -0.3681136, 0.0, 0.3566999, 0.6491464, 0.8336326, 0.8997161, 0.870529, 0.7911785, 0.7104509, 
-0.6633908, 0.6614225, 0.6930573, 0.7336007, 0.7586838, 0.7553906, 0.7264913, 0.6868379, 0.6545908, 0.6419918, 
-0.6500845, 0.6694582, 0.6860191, 0.6884801, 0.673739, 0.6476935, 0.621487, 0.6054384, 0.6038726, 0.6133763, 
-0.6251029, 0.6296739, 0.6220168, 0.6036873, 0.5816543, 0.5643855, 0.5573951, 0.5605645, 0.5685117, 0.5736549, 
-0.5702538, 0.5572944, 0.5387876, 0.5214495, 0.511085, 0.5096061, 0.5142035, 0.5190084, 0.518279, 0.5093939, 
-0.4941012, 0.4774413, 0.4649889, 0.4599163, 0.4614152, 0.4652543, 0.4661114, 0.4604, 0.4480975, 0.4326481, 
-0.4190501, 0.4111835, 0.4098019, 0.4122226, 0.413831, 0.4105614, 0.4010232, 0.3871669, 0.3731738, 0.3631986, 
-0.3591786, 0.3598626, 0.361542, 0.3600619, 0.3530245, 0.341019, 0.3272502, 0.3157935, 0.3094233, 0.3081707, 
-0.3093573, 0.3090601, 0.3042091, 0.2941982, 0.2811652, 0.2688156, 0.2604356, 0.2571573, 0.2573904, 0.2577048, 
-0.2546745, 0.2466944, 0.2348078, 0.2221183, 0.2121182, 0.2068294, 0.2057482, 0.206141, 0.2045203, 0.1985055, 
-0.1880759, 0.1755581, 0.1643675, 0.1571824, 0.1545268, 0.1545107, 0.1538543, 0.1496444, 0.1408808, 0.1289949, 
-0.1170712, 0.1081942, 0.1038068, 0.1029514, 0.1027939, 0.1001426, 0.0931509, 0.0822944, 0.0701074, 0.0598235, 
-0.0536499, 0.0515936, 0.0514649, 0.0500516, 0.0448348, 0.0353311, 0.0233464, 0.0120088, 0.0040968, 0.0005571, 
--0.0, -0.0005571, -0.0040968, -0.0120088, -0.0233464, -0.0353311, -0.0448348, -0.0500516, -0.0514649, -0.0515936, 
--0.0536499, -0.0598235, -0.0701074, -0.0822944, -0.0931509, -0.1001426, -0.1027939, -0.1029514, -0.1038068, -0.1081942, 
--0.1170712, -0.1289949, -0.1408808, -0.1496444, -0.1538543, -0.1545107, -0.1545268, -0.1571824, -0.1643675, -0.1755581, 
--0.1880759, -0.1985055, -0.2045203, -0.206141, -0.2057482, -0.2068294, -0.2121182, -0.2221183, -0.2348078, -0.2466944, 
--0.2546745, -0.2577048, -0.2573904, -0.2571573, -0.2604356, -0.2688156, -0.2811652, -0.2941982, -0.3042091, -0.3090601, 
--0.3093573, -0.3081707, -0.3094233, -0.3157935, -0.3272502, -0.341019, -0.3530245, -0.3600619, -0.361542, -0.3598626, 
--0.3591786, -0.3631986, -0.3731738, -0.3871669, -0.4010232, -0.4105614, -0.413831, -0.4122226, -0.4098019, -0.4111835, 
--0.4190501, -0.4326481, -0.4480975, -0.4604, -0.4661114, -0.4652543, -0.4614152, -0.4599163, -0.4649889, -0.4774413, 
--0.4941012, -0.5093939, -0.518279, -0.5190084, -0.5142035, -0.5096061, -0.511085, -0.5214495, -0.5387876, -0.5572944, 
--0.5702538, -0.5736549, -0.5685117, -0.5605645, -0.5573951, -0.5643855, -0.5816543, -0.6036873, -0.6220168, -0.6296739, 
--0.6251029, -0.6133763, -0.6038726, -0.6054384, -0.621487, -0.6476935, -0.673739, -0.6884801, -0.6860191, -0.6694582, 
--0.6500845, -0.6419918, -0.6545908, -0.6868379, -0.7264913, -0.7553906, -0.7586838, -0.7336007, -0.6930573, -0.6614225, 
--0.6633908, -0.7104509, -0.7911785, -0.870529, -0.8997161, -0.8336326, -0.6491464, -0.3566999, 0.0, 0.3561429, 
-0.6450496, 0.8216238, 0.8763697, 0.835198, 0.7463437, 0.6603992, 0.6119259, 0.6098289, 0.6394074, 0.6737771, 
-0.6885764, 0.6730962, 0.6333404, 0.5866953, 0.5517969, 0.5390404, 0.5462777, 0.5612639, 0.5689479, 0.5594851, 
-0.5328582, 0.4980491, 0.4676327, 0.4509278, 0.4493458, 0.4561939, 0.4607354, 0.4541158, 0.4339409, 0.4051818, 
-0.377134, 0.3582445, 0.3516469, 0.3537351, 0.3563935, 0.3515366, 0.335446, 0.3105999, 0.2841131, 0.2637447, 
-0.2536946, 0.2524488, 0.2537679, 0.2501928, 0.2371138, 0.2151956, 0.1898921, 0.1683812, 0.1556315, 0.1517456, 
-0.1519919, 0.1494608, 0.1388612, 0.119381, 0.095073, 0.0725862, 0.0575081, 0.0513209, 0.0506233, 0.0490239, 
-0.0406572, 0.0233945, 0.0, -0.0233945, -0.0406572, -0.0490239, -0.0506233, -0.0513209, -0.0575081, -0.0725862, 
--0.095073, -0.119381, -0.1388612, -0.1494608, -0.1519919, -0.1517456, -0.1556315, -0.1683812, -0.1898921, -0.2151956, 
--0.2371138, -0.2501928, -0.2537679, -0.2524488, -0.2536946, -0.2637447, -0.2841131, -0.3105999, -0.335446, -0.3515366, 
--0.3563935, -0.3537351, -0.3516469, -0.3582445, -0.377134, -0.4051818, -0.4339409, -0.4541158, -0.4607354, -0.4561939, 
--0.4493458, -0.4509278, -0.4676327, -0.4980491, -0.5328582, -0.5594851, -0.5689479, -0.5612639, -0.5462777, -0.5390404, 
--0.5517969, -0.5866953, -0.6333404, -0.6730962, -0.6885764, -0.6737771, -0.6394074, -0.6098289, -0.6119259, -0.6603992, 
--0.7463437, -0.835198, -0.8763697, -0.8216238, -0.6450496, -0.3561429, 0.0, 0.3327484, 0.6043924, 0.7725999, 
-0.8257464, 0.7838771, 0.6888356, 0.587813, 0.5168529, 0.4904478, 0.5005462, 0.5243163, 0.5365845, 0.5213506, 
-0.4777088, 0.4183141, 0.3619048, 0.3238447, 0.3091639, 0.3110711, 0.31518, 0.3070363, 0.2791637, 0.2343043, 
-0.1835195, 0.1403278, 0.1138997, 0.1046573, 0.1043419, 0.1003807, 0.0822941, 0.0469373, 0.0, -0.0469373, 
--0.0822941, -0.1003807, -0.1043419, -0.1046573, -0.1138997, -0.1403278, -0.1835195, -0.2343043, -0.2791637, -0.3070363, 
--0.31518, -0.3110711, -0.3091639, -0.3238447, -0.3619048, -0.4183141, -0.4777088, -0.5213506, -0.5365845, -0.5243163, 
--0.5005462, -0.4904478, -0.5168529, -0.587813, -0.6888356, -0.7838771, -0.8257464, -0.7725999, -0.6043924, -0.3327484, 
-0.0, 0.2858111, 0.5220983, 0.6722192, 0.7214045, 0.6792197, 0.5749359, 0.4474852, 0.3333333, 0.2561435, 
-0.2213825, 0.21728, 0.2214045, 0.2102794, 0.1685449, 0.0944693, 0.0, -0.0944693, -0.1685449, -0.2102794, 
--0.2214045, -0.21728, -0.2213825, -0.2561435, -0.3333333, -0.4474852, -0.5749359, -0.6792197, -0.7214045, -0.6722192, 
--0.5220983, -0.2858111, 0.0, 0.1913417, 0.3535534, 0.4619398, 0.5, 0.4619398, 0.3535534, 0.1913417, 
-0.0, -0.1913417, -0.3535534, -0.4619398, -0.5, -0.4619398, -0.3535534, -0.1913417, 0.0 };
-
-constexpr float square[] = 
-{0.0, 0.3711808, 0.6735256, 0.8612613, 0.9255307, 0.8938317, 0.8160204, 0.7434072, 0.7099503, 0.7229732, 
-0.7661244, 0.811755, 0.8360721, 0.8299499, 0.8010814, 0.767671, 0.7478201, 0.7503327, 0.7713237, 0.7976692, 
-0.8148169, 0.8145267, 0.7985766, 0.7768968, 0.7616027, 0.7603901, 0.7728068, 0.7911316, 0.8050438, 0.8073342, 
-0.7975515, 0.781787, 0.7689697, 0.7658762, 0.7736069, 0.7873299, 0.7992384, 0.8029449, 0.7968664, 0.7848269, 
-0.7737004, 0.7695194, 0.7742343, 0.7848482, 0.7952822, 0.7998323, 0.7962648, 0.7868836, 0.7770768, 0.7722409, 
-0.7748285, 0.7831255, 0.7923537, 0.7974081, 0.7956669, 0.7883366, 0.7796497, 0.7744331, 0.7754367, 0.7818956, 
-0.7900701, 0.7954013, 0.7950446, 0.7893784, 0.781693, 0.7762883, 0.7760753, 0.7810154, 0.7882304, 0.7936725, 
-0.7943888, 0.7901177, 0.7833572, 0.7779095, 0.7767484, 0.7804003, 0.7867199, 0.7921447, 0.7936989, 0.7906218, 
-0.7847312, 0.779355, 0.7774542, 0.7799963, 0.7854685, 0.7907732, 0.7929784, 0.790935, 0.7858712, 0.7806589, 
-0.7781878, 0.779766, 0.7844309, 0.7895318, 0.7922332, 0.7910892, 0.7868139, 0.7818417, 0.7789427, 0.779682, 
-0.7835766, 0.7884046, 0.7914705, 0.7911084, 0.7875853, 0.7829156, 0.7797113, 0.7797226, 0.7828835, 0.7873823, 
-0.7906981, 0.7910123, 0.7882042, 0.7838878, 0.7804855, 0.7798701, 0.7823351, 0.7864592, 0.7899243, 0.7908174, 
-0.7886854, 0.7847625, 0.7812568, 0.7801088, 0.7819181, 0.7856322, 0.7891575, 0.7905384, 0.7890411, 0.7855423, 
-0.782017, 0.7804248, 0.7816211, 0.7848992, 0.788406, 0.7901887, 0.7892818, 0.7862287, 0.7827579, 0.780805, 
-0.7814341, 0.7842589, 0.7876777, 0.789781, 0.7894174, 0.7868232, 0.7834717, 0.7812372, 0.7813476, 0.78371, 
-0.7869802, 0.7893271, 0.7894572, 0.787327, 0.784151, 0.7817098, 0.7813523, 0.783251, 0.7863207, 0.7888385, 
-0.7894102, 0.7877417, 0.7847892, 0.7822117, 0.7814393, 0.78288, 0.7857053, 0.788326, 0.7892856, 0.7880695, 
-0.7853803, 0.7827323, 0.7815993, 0.7825947, 0.7851398, 0.7877999, 0.7890924, 0.7883131, 0.785919, 0.7832615, 
-0.7818233, 0.782392, 0.784629, 0.78727, 0.7888399, 0.7884757, 0.7864011, 0.7837897, 0.782102, 0.7822683, 
-0.7841766, 0.7867456, 0.7885373, 0.7885616, 0.786823, 0.7843082, 0.7824262, 0.7822192, 0.7837857, 0.7862351, 
-0.7881938, 0.7885752, 0.7871823, 0.7848088, 0.7827867, 0.7822397, 0.7834583, 0.7857464, 0.7878186, 0.788522, 
-0.7874776, 0.7852839, 0.7831744, 0.7823241, 0.7831953, 0.7852864, 0.7874207, 0.7884079, 0.7877083, 0.7857271, 
-0.7835803, 0.7824663, 0.7829968, 0.7848615, 0.7870089, 0.7882393, 0.7878748, 0.7861325, 0.7839959, 0.7826597, 
-0.782862, 0.7844768, 0.7865916, 0.788023, 0.7879784, 0.7864953, 0.7844128, 0.7828972, 0.7827889, 0.7841368, 
-0.786177, 0.7877661, 0.7880215, 0.7868117, 0.7848232, 0.7831715, 0.782775, 0.7838448, 0.7857726, 0.7874762, 
-0.7880072, 0.7870786, 0.7852199, 0.7834752, 0.7828167, 0.7836034, 0.7853853, 0.7871606, 0.7879391, 0.7872942, 
-0.7855963, 0.7838007, 0.7829099, 0.783414, 0.7850214, 0.786827, 0.787822, 0.7874573, 0.7859463, 0.7841406, 
-0.7830497, 0.7832772, 0.7846865, 0.7864827, 0.7876608, 0.7875679, 0.7862649, 0.7844875, 0.7832309, 0.7831925, 
-0.7843854, 0.786135, 0.7874612, 0.7876269, 0.7865476, 0.7848343, 0.7834474, 0.7831588, 0.7841219, 0.7857908, 
-0.7872292, 0.7876359, 0.786791, 0.7851743, 0.7836934, 0.7831739, 0.7838993, 0.7854565, 0.7869709, 0.7875975, 
-0.7869923, 0.7855013, 0.7839624, 0.7832349, 0.7837197, 0.7851383, 0.7866929, 0.7875148, 0.7871499, 0.7858094, 
-0.7842479, 0.7833383, 0.7835844, 0.7848415, 0.7864015, 0.7873916, 0.7872627, 0.7860937, 0.7845436, 0.7834801, 
-0.7834939, 0.7845709, 0.7861031, 0.7872325, 0.7873309, 0.7863496, 0.784843, 0.7836554, 0.7834479, 0.7843306, 
-0.7858041, 0.7870423, 0.7873551, 0.7865734, 0.7851401, 0.7838592, 0.7834451, 0.784124, 0.7855104, 0.7868262, 
-0.787337, 0.7867622, 0.785429, 0.7840862, 0.7834837, 0.7839536, 0.7852276, 0.7865897, 0.7872787, 0.7869137, 
-0.7857044, 0.7843308, 0.7835609, 0.7838213, 0.7849609, 0.7863384, 0.7871833, 0.7870266, 0.7859613, 0.7845873, 
-0.7836736, 0.783728, 0.7847149, 0.7860781, 0.7870543, 0.7871003, 0.7861954, 0.78485, 0.7838179, 0.7836739, 
-0.7844937, 0.7858144, 0.7868957, 0.7871349, 0.7864028, 0.7851134, 0.7839897, 0.7836585, 0.7843007, 0.7855527, 
-0.7867119, 0.7871314, 0.7865806, 0.7853721, 0.7841843, 0.7836805, 0.7841388, 0.7852982, 0.7865077, 0.7870914, 
-0.7867263, 0.7856211, 0.7843968, 0.783738, 0.7840098, 0.7850559, 0.786288, 0.7870171, 0.7868381, 0.7858557, 
-0.7846223, 0.7838284, 0.7839153, 0.7848301, 0.786058, 0.7869113, 0.7869153, 0.7860716, 0.7848557, 0.7839487, 
-0.7838557, 0.7846249, 0.7858225, 0.7867775, 0.7869573, 0.7862652, 0.7850919, 0.7840951, 0.783831, 0.7844436, 
-0.7855868, 0.7866193, 0.7869648, 0.7864334, 0.785326, 0.7842639, 0.7838404, 0.7842892, 0.7853556, 0.786441, 
-0.7869388, 0.7865736, 0.7855533, 0.7844508, 0.7838825, 0.7841637, 0.7851334, 0.7862468, 0.7868811, 0.786684, 
-0.7857693, 0.7846512, 0.7839554, 0.7840688, 0.7849246, 0.7860413, 0.7867938, 0.7867632, 0.78597, 0.7848605, 
-0.7840563, 0.7840053, 0.7847329, 0.7858292, 0.7866799, 0.7868108, 0.7861517, 0.7850743, 0.7841824, 0.7839736, 
-0.7845618, 0.7856149, 0.7865426, 0.7868269, 0.7863115, 0.7852879, 0.7843301, 0.7839731, 0.784414, 0.7854031, 
-0.7863854, 0.786812, 0.7864467, 0.7854969, 0.7844957, 0.7840029, 0.7842919, 0.785198, 0.7862123, 0.7867676, 
-0.7865553, 0.7856971, 0.7846753, 0.7840615, 0.7841972, 0.7850035, 0.7860273, 0.7866954, 0.7866359, 0.7858848, 
-0.7848646, 0.7841466, 0.7841309, 0.7848235, 0.7858347, 0.786598, 0.7866877, 0.7860563, 0.7850595, 0.7842558, 
-0.7840936, 0.7846612, 0.7856386, 0.7864779, 0.7867105, 0.7862087, 0.7852557, 0.784386, 0.7840852, 0.7845194, 
-0.7854433, 0.7863384, 0.7867047, 0.7863393, 0.7854492, 0.7845338, 0.784105, 0.7844005, 0.7852527, 0.786183, 
-0.7866713, 0.7864461, 0.785636, 0.7846958, 0.7841517, 0.7843063, 0.7850707, 0.7860154, 0.7866117, 0.7865275, 
-0.7858123, 0.7848681, 0.7842236, 0.784238, 0.7849008, 0.7858394, 0.786528, 0.7865826, 0.7859749, 0.7850469, 
-0.7843185, 0.7841962, 0.7847463, 0.7856588, 0.7864225, 0.7866109, 0.7861207, 0.7852282, 0.7844339, 0.7841813, 
-0.7846099, 0.7854777, 0.7862981, 0.7866126, 0.7862471, 0.7854083, 0.7845666, 0.7841927, 0.7844939, 0.7852997, 
-0.7861578, 0.7865884, 0.7863521, 0.7855833, 0.7847135, 0.7842294, 0.7844003, 0.7851285, 0.7860051, 0.7865394, 
-0.786434, 0.7857497, 0.7848712, 0.7842901, 0.7843305, 0.7849676, 0.7858434, 0.7864674, 0.7864916, 0.7859044, 
-0.785036, 0.7843729, 0.7842851, 0.78482, 0.7856763, 0.7863745, 0.7865245, 0.7860443, 0.7852044, 0.7844754, 
-0.7842647, 0.7846884, 0.7855076, 0.786263, 0.7865325, 0.786167, 0.7853727, 0.7845951, 0.784269, 0.7845752, 
-0.7853407, 0.7861359, 0.7865162, 0.7862702, 0.7855374, 0.784729, 0.7842972, 0.7844824, 0.785179, 0.7859961, 
-0.7864763, 0.7863523, 0.7856951, 0.7848738, 0.7843483, 0.7844113, 0.785026, 0.7858469, 0.7864145, 0.786412, 
-0.7858427, 0.7850265, 0.7844205, 0.784363, 0.7848845, 0.7856917, 0.7863323, 0.7864487, 0.7859773, 0.7851834, 
-0.7845119, 0.784338, 0.7847573, 0.7855338, 0.7862322, 0.7864622, 0.7860965, 0.7853414, 0.7846202, 0.7843361, 
-0.7846468, 0.7853767, 0.7861165, 0.7864526, 0.786198, 0.7854969, 0.7847426, 0.784357, 0.7845547, 0.7852236, 
-0.7859882, 0.7864207, 0.7862802, 0.7856468, 0.7848762, 0.7843996, 0.7844828, 0.7850776, 0.78585, 0.7863676, 
-0.7863416, 0.7857881, 0.785018, 0.7844627, 0.784432, 0.7849417, 0.7857053, 0.7862951, 0.7863816, 0.785918, 
-0.7851649, 0.7845443, 0.7844029, 0.7848185, 0.7855571, 0.7862049, 0.7863997, 0.7860339, 0.7853136, 0.7846424, 
-0.7843957, 0.7847103, 0.7854087, 0.7860994, 0.786396, 0.7861339, 0.7854609, 0.7847547, 0.7844101, 0.7846191, 
-0.7852632, 0.7859811, 0.7863711, 0.786216, 0.7856038, 0.7848783, 0.7844454, 0.7845464, 0.7851236, 0.7858528, 
-0.7863259, 0.7862789, 0.7857394, 0.7850105, 0.7845003, 0.7844935, 0.7849927, 0.7857174, 0.7862617, 0.7863217, 
-0.7858649, 0.7851483, 0.7845732, 0.784461, 0.7848732, 0.785578, 0.7861804, 0.7863439, 0.785978, 0.7852887, 
-0.7846624, 0.7844491, 0.7847672, 0.7854374, 0.786084, 0.7863454, 0.7860764, 0.7854287, 0.7847655, 0.7844578, 
-0.7846768, 0.7852988, 0.7859748, 0.7863266, 0.7861583, 0.7855652, 0.7848802, 0.7844865, 0.7846037, 0.7851649, 
-0.7858553, 0.7862883, 0.7862224, 0.7856956, 0.7850037, 0.7845341, 0.7845489, 0.7850387, 0.7857284, 0.7862318, 
-0.7862677, 0.7858172, 0.7851334, 0.7845993, 0.7845133, 0.7849225, 0.7855968, 0.7861584, 0.7862935, 0.7859275, 
-0.7852662, 0.7846803, 0.7844973, 0.7848186, 0.7854633, 0.7860701, 0.7862996, 0.7860244, 0.7853995, 0.7847753, 
-0.7845009, 0.784729, 0.7853309, 0.7859691, 0.7862864, 0.7861062, 0.7855303, 0.7848818, 0.7845237, 0.7846554, 
-0.7852024, 0.7858576, 0.7862544, 0.7861713, 0.785656, 0.7849976, 0.7845647, 0.784599, 0.7850803, 0.7857383, 
-0.7862046, 0.7862187, 0.7857738, 0.7851198, 0.7846229, 0.7845608, 0.7849672, 0.7856138, 0.7861384, 0.7862477, 
-0.7858816, 0.7852458, 0.7846967, 0.7845411, 0.7848653, 0.7854869, 0.7860575, 0.7862581, 0.7859772, 0.785373, 
-0.7847842, 0.7845401, 0.7847765, 0.7853602, 0.7859639, 0.7862498, 0.7860587, 0.7854985, 0.7848834, 0.7845575, 
-0.7847026, 0.7852365, 0.7858597, 0.7862234, 0.7861247, 0.7856198, 0.7849919, 0.7845926, 0.7846448, 0.7851183, 
-0.7857474, 0.7861798, 0.7861741, 0.7857343, 0.7851074, 0.7846444, 0.7846041, 0.7850081, 0.7856294, 0.7861201, 
-0.786206, 0.7858397, 0.7852272, 0.7847116, 0.7845811, 0.784908, 0.7855084, 0.786046, 0.78622, 0.785934, 
-0.7853487, 0.7847923, 0.784576, 0.78482, 0.785387, 0.7859591, 0.7862163, 0.7860152, 0.7854694, 0.7848847, 
-0.7845885, 0.7847458, 0.7852678, 0.7858616, 0.786195, 0.786082, 0.7855866, 0.7849867, 0.7846182, 0.7846868, 
-0.7851532, 0.7857557, 0.7861571, 0.786133, 0.7856979, 0.785096, 0.7846642, 0.7846439, 0.7850456, 0.7856438, 
-0.7861034, 0.7861676, 0.7858012, 0.78521, 0.7847252, 0.7846179, 0.7849472, 0.7855283, 0.7860354, 0.7861851, 
-0.7858942, 0.7853264, 0.7847998, 0.7846089, 0.78486, 0.7854117, 0.7859548, 0.7861854, 0.7859752, 0.7854425, 
-0.784886, 0.7846171, 0.7847857, 0.7852966, 0.7858634, 0.7861689, 0.7860426, 0.785556, 0.784982, 0.7846418, 
-0.7847255, 0.7851854, 0.7857634, 0.7861361, 0.7860952, 0.7856644, 0.7850854, 0.7846825, 0.7846807, 0.7850803, 
-0.7856571, 0.7860879, 0.7861321, 0.7857656, 0.7851941, 0.7847379, 0.7846519, 0.7849836, 0.7855466, 0.7860256, 
-0.7861527, 0.7858574, 0.7853057, 0.7848066, 0.7846395, 0.7848971, 0.7854346, 0.7859508, 0.7861569, 0.7859381, 
-0.7854176, 0.7848871, 0.7846435, 0.7848225, 0.7853233, 0.7858651, 0.7861447, 0.7860061, 0.7855276, 0.7849775, 
-0.7846637, 0.7847614, 0.7852152, 0.7857706, 0.7861167, 0.7860601, 0.7856333, 0.7850756, 0.7846994, 0.7847148, 
-0.7851125, 0.7856694, 0.7860736, 0.7860992, 0.7857325, 0.7851794, 0.7847496, 0.7846834, 0.7850173, 0.7855637, 
-0.7860166, 0.7861227, 0.7858232, 0.7852864, 0.784813, 0.7846678, 0.7849315, 0.7854559, 0.7859471, 0.7861304, 
-0.7859036, 0.7853945, 0.7848882, 0.7846681, 0.7848569, 0.7853482, 0.7858667, 0.7861222, 0.7859721, 0.7855012, 
-0.7849733, 0.7846841, 0.7847948, 0.785243, 0.7857773, 0.7860986, 0.7860274, 0.7856043, 0.7850665, 0.7847151, 
-0.7847465, 0.7851425, 0.7856809, 0.7860602, 0.7860685, 0.7857017, 0.7851656, 0.7847605, 0.7847128, 0.7850487, 
-0.7855796, 0.7860082, 0.7860947, 0.7857913, 0.7852684, 0.784819, 0.7846943, 0.7849637, 0.7854758, 0.7859436, 
-0.7861056, 0.7858714, 0.7853728, 0.7848891, 0.7846911, 0.7848889, 0.7853715, 0.7858682, 0.7861011, 0.7859404, 
-0.7854764, 0.7849694, 0.7847031, 0.7848261, 0.785269, 0.7857836, 0.7860817, 0.7859968, 0.7855771, 0.7850579, 
-0.7847299, 0.7847763, 0.7851706, 0.7856917, 0.7860478, 0.7860398, 0.7856728, 0.7851527, 0.7847707, 0.7847404, 
-0.7850782, 0.7855946, 0.7860003, 0.7860684, 0.7857614, 0.7852516, 0.7848245, 0.7847191, 0.7849938, 0.7854944, 
-0.7859404, 0.7860824, 0.7858412, 0.7853525, 0.78489, 0.7847126, 0.784919, 0.7853933, 0.7858696, 0.7860814, 
-0.7859106, 0.7854532, 0.7849657, 0.7847209, 0.7848554, 0.7852935, 0.7857895, 0.7860658, 0.7859681, 0.7855516, 
-0.7850498, 0.7847437, 0.7848042, 0.785197, 0.7857019, 0.786036, 0.7860128, 0.7856456, 0.7851405, 0.7847803, 
-0.7847663, 0.785106, 0.7856087, 0.7859929, 0.7860438, 0.7857333, 0.7852357, 0.7848297, 0.7847424, 0.7850222, 
-0.785512, 0.7859374, 0.7860605, 0.7858128, 0.7853333, 0.7848908, 0.7847329, 0.7849474, 0.7854139, 0.785871, 
-0.7860628, 0.7858825, 0.7854313, 0.7849622, 0.7847377, 0.7848831, 0.7853165, 0.7857951, 0.7860509, 0.785941, 
-0.7855275, 0.7850422, 0.7847567, 0.7848306, 0.785222, 0.7857115, 0.786025, 0.7859873, 0.78562, 0.785129, 
-0.7847893, 0.7847908, 0.7851322, 0.785622, 0.7859859, 0.7860205, 0.7857067, 0.7852207, 0.7848346, 0.7847644, 
-0.785049, 0.7855286, 0.7859346, 0.7860399, 0.7857859, 0.7853152, 0.7848916, 0.784752, 0.7849742, 0.7854334, 
-0.7858723, 0.7860453, 0.7858559, 0.7854106, 0.7849589, 0.7847536, 0.7849093, 0.7853384, 0.7858004, 0.7860367, 
-0.7859154, 0.7855047, 0.7850349, 0.784769, 0.7848555, 0.7852456, 0.7857206, 0.7860146, 0.7859632, 0.7855957, 
-0.7851181, 0.7847978, 0.7848139, 0.785157, 0.7856346, 0.7859793, 0.7859984, 0.7856815, 0.7852064, 0.7848392, 
-0.7847853, 0.7850744, 0.7855444, 0.785932, 0.7860203, 0.7857604, 0.785298, 0.7848923, 0.7847701, 0.7849996, 
-0.7854519, 0.7858736, 0.7860287, 0.7858307, 0.7853909, 0.7849557, 0.7847686, 0.7849341, 0.7853591, 0.7858055, 
-0.7860234, 0.7858911, 0.7854831, 0.785028, 0.7847807, 0.7848792, 0.785268, 0.7857293, 0.7860047, 0.7859403, 
-0.7855726, 0.7851077, 0.7848059, 0.7848359, 0.7851806, 0.7856466, 0.7859731, 0.7859774, 0.7856575, 0.7851928, 
-0.7848436, 0.7848051, 0.7850986, 0.7855594, 0.7859295, 0.7860017, 0.7857361, 0.7852816, 0.7848929, 0.7847874, 
-0.7850238, 0.7854695, 0.7858748, 0.7860128, 0.7858067, 0.7853722, 0.7849526, 0.7847829, 0.7849578, 0.7853789, 
-0.7858103, 0.7860106, 0.7858679, 0.7854624, 0.7850214, 0.7847918, 0.7849017, 0.7852894, 0.7857376, 0.7859953, 
-0.7859185, 0.7855506, 0.7850977, 0.7848136, 0.7848569, 0.7852031, 0.7856581, 0.7859672, 0.7859574, 0.7856347, 
-0.7851799, 0.7848477, 0.784824, 0.7851217, 0.7855738, 0.7859271, 0.785984, 0.7857129, 0.785266, 0.7848935, 
-0.7848038, 0.7850469, 0.7854864, 0.785876, 0.7859977, 0.7857838, 0.7853542, 0.7849497, 0.7847966, 0.7849803, 
-0.7853978, 0.785815, 0.7859985, 0.7858458, 0.7854427, 0.7850151, 0.7848024, 0.7849233, 0.7853099, 0.7857455, 
-0.7859863, 0.7858976, 0.7855295, 0.7850882, 0.7848209, 0.7848769, 0.7852246, 0.7856691, 0.7859615, 0.7859383, 
-0.7856128, 0.7851674, 0.7848517, 0.7848421, 0.7851438, 0.7855875, 0.7859249, 0.785967, 0.7856908, 0.785251, 
-0.784894, 0.7848196, 0.7850691, 0.7855025, 0.7858771, 0.7859833, 0.7857619, 0.7853371, 0.7849469, 0.7848097, 
-0.785002, 0.7854159, 0.7858195, 0.7859868, 0.7858246, 0.7854238, 0.785009, 0.7848125, 0.7849439, 0.7853295, 
-0.7857532, 0.7859777, 0.7858776, 0.7855093, 0.7850791, 0.7848279, 0.7848961, 0.7852453, 0.7856797, 0.7859561, 
-0.78592, 0.7855918, 0.7851555, 0.7848555, 0.7848595, 0.785165, 0.7856008, 0.7859227, 0.7859508, 0.7856695, 
-0.7852366, 0.7848945, 0.7848347, 0.7850903, 0.785518, 0.7858783, 0.7859694, 0.7857408, 0.7853205, 0.7849441, 
-0.7848222, 0.7850228, 0.7854333, 0.7858238, 0.7859757, 0.7858042, 0.7854056, 0.7850032, 0.7848222, 0.7849638, 
-0.7853484, 0.7857605, 0.7859695, 0.7858584, 0.7854899, 0.7850703, 0.7848346, 0.7849146, 0.7852652, 0.7856899, 
-0.785951, 0.7859024, 0.7855716, 0.785144, 0.7848591, 0.7848761, 0.7851854, 0.7856135, 0.7859207, 0.7859351, 
-0.785649, 0.7852227, 0.784895, 0.7848492, 0.7851108, 0.785533, 0.7858794, 0.7859561, 0.7857205, 0.7853046, 
-0.7849415, 0.7848343, 0.7850428, 0.7854501, 0.785828, 0.785965, 0.7857846, 0.785388, 0.7849975, 0.7848316, 
-0.7849829, 0.7853666, 0.7857676, 0.7859615, 0.7858399, 0.7854711, 0.7850618, 0.7848411, 0.7849324, 0.7852844, 
-0.7856998, 0.785946, 0.7858854, 0.7855521, 0.7851329, 0.7848625, 0.7848922, 0.7852051, 0.7856258, 0.7859187, 
-0.78592, 0.7856292, 0.7852093, 0.7848954, 0.7848632, 0.7851305, 0.7855474, 0.7858805, 0.7859433, 0.7857009, 
-0.7852892, 0.7849389, 0.7848459, 0.7850621, 0.7854663, 0.785832, 0.7859546, 0.7857656, 0.7853711, 0.784992, 
-0.7848406, 0.7850014, 0.7853842, 0.7857745, 0.7859539, 0.785822, 0.785453, 0.7850535, 0.7848473, 0.7849496, 
-0.7853029, 0.7857093, 0.7859412, 0.785869, 0.7855332, 0.7851221, 0.7848659, 0.7849078, 0.7852242, 0.7856377, 
-0.7859169, 0.7859055, 0.7856101, 0.7851963, 0.7848958, 0.7848767, 0.7851496, 0.7855614, 0.7858815, 0.7859308, 
-0.7856819, 0.7852743, 0.7849363, 0.7848571, 0.7850808, 0.785482, 0.785836, 0.7859446, 0.7857472, 0.7853546, 
-0.7849866, 0.7848493, 0.7850193, 0.7854013, 0.7857813, 0.7859465, 0.7858047, 0.7854354, 0.7850455, 0.7848533, 
-0.7849663, 0.7853209, 0.7857186, 0.7859366, 0.785853, 0.7855149, 0.7851117, 0.7848691, 0.7849228, 0.7852426, 
-0.7856493, 0.7859151, 0.7858913, 0.7855915, 0.7851836, 0.7848961, 0.7848899, 0.7851682, 0.785575, 0.7858826, 
-0.7859188, 0.7856635, 0.7852598, 0.7849339, 0.784868, 0.785099, 0.7854973, 0.7858399, 0.7859349, 0.7857294, 
-0.7853386, 0.7849814, 0.7848577, 0.7850367, 0.7854179, 0.7857878, 0.7859394, 0.7857879, 0.7854183, 0.7850377, 
-0.7848591, 0.7849824, 0.7853384, 0.7857276, 0.7859321, 0.7858376, 0.7854971, 0.7851015, 0.7848721, 0.7849374, 
-0.7852606, 0.7856606, 0.7859134, 0.7858776, 0.7855734, 0.7851713, 0.7848964, 0.7849026, 0.7851862, 0.7855883, 
-0.7858837, 0.7859071, 0.7856456, 0.7852457, 0.7849314, 0.7848786, 0.7851167, 0.7855122, 0.7858436, 0.7859255, 
-0.7857121, 0.7853231, 0.7849763, 0.7848659, 0.7850536, 0.785434, 0.7857942, 0.7859324, 0.7857715, 0.7854016, 
-0.7850301, 0.7848648, 0.7849982, 0.7853554, 0.7857364, 0.7859278, 0.7858226, 0.7854798, 0.7850915, 0.7848751, 
-0.7849517, 0.7852781, 0.7856716, 0.7859118, 0.7858643, 0.7855558, 0.7851593, 0.7848967, 0.784915, 0.7852038, 
-0.7856012, 0.7858847, 0.7858957, 0.7856281, 0.7852319, 0.784929, 0.7848889, 0.7851339, 0.7855267, 0.7858474, 
-0.7859163, 0.7856952, 0.7853079, 0.7849713, 0.7848739, 0.7850701, 0.7854498, 0.7858004, 0.7859257, 0.7857555, 
-0.7853854, 0.7850226, 0.7848703, 0.7850136, 0.7853721, 0.785745, 0.7859236, 0.7858079, 0.7854629, 0.7850818, 
-0.784878, 0.7849656, 0.7852953, 0.7856824, 0.7859102, 0.7858512, 0.7855386, 0.7851476, 0.784897, 0.7849271, 
-0.785221, 0.7856139, 0.7858858, 0.7858846, 0.7856111, 0.7852185, 0.7849267, 0.784899, 0.7851508, 0.785541, 
-0.785851, 0.7859074, 0.7856786, 0.785293, 0.7849664, 0.7848817, 0.7850862, 0.7854653, 0.7858066, 0.7859191, 
-0.7857399, 0.7853695, 0.7850153, 0.7848756, 0.7850286, 0.7853884, 0.7857535, 0.7859195, 0.7857935, 0.7854463, 
-0.7850722, 0.7848809, 0.7849792, 0.785312, 0.785693, 0.7859087, 0.7858385, 0.7855218, 0.785136, 0.7848972, 
-0.784939, 0.7852378, 0.7856263, 0.7858869, 0.7858737, 0.7855944, 0.7852052, 0.7849243, 0.7849088, 0.7851673, 
-0.7855549, 0.7858546, 0.7858986, 0.7856624, 0.7852784, 0.7849616, 0.7848893, 0.785102, 0.7854804, 0.7858126, 
-0.7859126, 0.7857246, 0.7853538, 0.7850081, 0.7848809, 0.7850433, 0.7854044, 0.7857618, 0.7859155, 0.7857795, 
-0.78543, 0.7850629, 0.7848836, 0.7849925, 0.7853285, 0.7857033, 0.7859072, 0.785826, 0.7855053, 0.7851247, 
-0.7848974, 0.7849506, 0.7852543, 0.7856385, 0.7858879, 0.7858631, 0.7855779, 0.7851923, 0.784922, 0.7849184, 
-0.7851835, 0.7855686, 0.7858582, 0.7858901, 0.7856465, 0.785264, 0.7849568, 0.7848968, 0.7851175, 0.7854953, 
-0.7858186, 0.7859063, 0.7857096, 0.7853385, 0.785001, 0.784886, 0.7850578, 0.7854201, 0.78577, 0.7859116, 
-0.7857657, 0.785414, 0.7850536, 0.7848863, 0.7850056, 0.7853446, 0.7857136, 0.7859058, 0.7858137, 0.785489, 
-0.7851136, 0.7848976, 0.784962, 0.7852706, 0.7856505, 0.785889, 0.7858526, 0.7855618, 0.7851795, 0.7849197, 
-0.7849279, 0.7851994, 0.7855821, 0.7858617, 0.7858816, 0.7856309, 0.7852499, 0.7849521, 0.7849041, 0.7851328, 
-0.78551, 0.7858244, 0.7859001, 0.7856948, 0.7853234, 0.784994, 0.784891, 0.785072, 0.7854356, 0.7857781, 
-0.7859078, 0.7857521, 0.7853983, 0.7850445, 0.7848889, 0.7850184, 0.7853606, 0.7857237, 0.7859044, 0.7858016, 
-0.785473, 0.7851025, 0.7848977, 0.7849732, 0.7852866, 0.7856623, 0.7858901, 0.7858423, 0.7855459, 0.7851668, 
-0.7849174, 0.7849372, 0.7852151, 0.7855954, 0.7858652, 0.7858734, 0.7856155, 0.785236, 0.7849474, 0.7849113, 
-0.7851478, 0.7855245, 0.7858303, 0.7858941, 0.7856802, 0.7853084, 0.784987, 0.7848959, 0.785086, 0.7854509, 
-0.7857861, 0.785904, 0.7857387, 0.7853827, 0.7850355, 0.7848914, 0.7850311, 0.7853763, 0.7857337, 0.785903, 
-0.7857897, 0.7854571, 0.7850917, 0.7848979, 0.7849843, 0.7853024, 0.7856741, 0.7858912, 0.7858322, 0.7855302, 
-0.7851543, 0.7849151, 0.7849464, 0.7852307, 0.7856086, 0.7858687, 0.7858652, 0.7856002, 0.7852222, 0.7849427, 
-0.7849184, 0.7851627, 0.7855388, 0.7858361, 0.7858881, 0.7856658, 0.7852937, 0.7849802, 0.7849008, 0.7850999, 
-0.785466, 0.785794, 0.7859003, 0.7857254, 0.7853673, 0.7850265, 0.7848939, 0.7850437, 0.7853919, 0.7857436, 
-0.7859017, 0.7857779, 0.7854415, 0.7850809, 0.784898, 0.7849952, 0.7853181, 0.7856857, 0.7858923, 0.7858221, 
-0.7855146, 0.7851419, 0.7849128, 0.7849555, 0.785246, 0.7856217, 0.7858721, 0.7858571, 0.7855851, 0.7852085, 
-0.7849381, 0.7849254, 0.7851774, 0.785553, 0.7858418, 0.7858821, 0.7856515, 0.785279, 0.7849733, 0.7849056, 
-0.7851137, 0.785481, 0.7858019, 0.7858967, 0.7857123, 0.785352, 0.7850176, 0.7848964, 0.7850561, 0.7854074, 
-0.7857534, 0.7859005, 0.7857662, 0.7854259, 0.7850701, 0.7848981, 0.7850061, 0.7853336, 0.7856972, 0.7858934, 
-0.7858122, 0.7854992, 0.7851296, 0.7849105, 0.7849645, 0.7852613, 0.7856347, 0.7858756, 0.7858491, 0.7855701, 
-0.7851949, 0.7849335, 0.7849324, 0.785192, 0.7855671, 0.7858475, 0.7858763, 0.7856373, 0.7852645, 0.7849665, 
-0.7849103, 0.7851273, 0.7854959, 0.7858098, 0.7858931, 0.7856993, 0.7853368, 0.7850088, 0.7848988, 0.7850685, 
-0.7854227, 0.7857632, 0.7858992, 0.7857547, 0.7854105, 0.7850595, 0.7848981, 0.7850168, 0.785349, 0.7857087, 
-0.7858945, 0.7858023, 0.7854838, 0.7851174, 0.7849082, 0.7849734, 0.7852765, 0.7856476, 0.7858791, 0.7858412, 
-0.7855552, 0.7851814, 0.7849289, 0.7849392, 0.7852066, 0.7855812, 0.7858533, 0.7858705, 0.7856232, 0.78525, 
-0.7849597, 0.784915, 0.7851409, 0.7855108, 0.7858176, 0.7858896, 0.7856863, 0.7853217, 0.785, 0.7849012, 
-0.7850807, 0.785438, 0.785773, 0.785898, 0.7857431, 0.7853951, 0.7850488, 0.7848982, 0.7850275, 0.7853644, 
-0.7857202, 0.7858956, 0.7857925, 0.7854685, 0.7851052, 0.7849059, 0.7849823, 0.7852916, 0.7856605, 0.7858825, 
-0.7858333, 0.7855404, 0.7851679, 0.7849243, 0.7849461, 0.785221, 0.7855952, 0.785859, 0.7858647, 0.7856092, 
-0.7852355, 0.7849529, 0.7849197, 0.7851544, 0.7855256, 0.7858255, 0.785886, 0.7856734, 0.7853066, 0.7849911, 
-0.7849036, 0.785093, 0.7854533, 0.7857827, 0.7858968, 0.7857317, 0.7853798, 0.7850382, 0.7848982, 0.7850382, 
-0.7853798, 0.7857317, 0.7858968, 0.7857827, 0.7854533, 0.785093, 0.7849036, 0.7849911, 0.7853066, 0.7856734, 
-0.785886, 0.7858255, 0.7855256, 0.7851544, 0.7849197, 0.7849529, 0.7852355, 0.7856092, 0.7858647, 0.785859, 
-0.7855952, 0.785221, 0.7849461, 0.7849243, 0.7851679, 0.7855404, 0.7858333, 0.7858825, 0.7856605, 0.7852916, 
-0.7849823, 0.7849059, 0.7851052, 0.7854685, 0.7857925, 0.7858956, 0.7857202, 0.7853644, 0.7850275, 0.7848982, 
-0.7850488, 0.7853951, 0.7857431, 0.785898, 0.785773, 0.785438, 0.7850807, 0.7849012, 0.785, 0.7853217, 
-0.7856863, 0.7858896, 0.7858176, 0.7855108, 0.7851409, 0.784915, 0.7849597, 0.78525, 0.7856232, 0.7858705, 
-0.7858533, 0.7855812, 0.7852066, 0.7849392, 0.7849289, 0.7851814, 0.7855552, 0.7858412, 0.7858791, 0.7856476, 
-0.7852765, 0.7849734, 0.7849082, 0.7851174, 0.7854838, 0.7858023, 0.7858945, 0.7857087, 0.785349, 0.7850168, 
-0.7848981, 0.7850595, 0.7854105, 0.7857547, 0.7858992, 0.7857632, 0.7854227, 0.7850685, 0.7848988, 0.7850088, 
-0.7853368, 0.7856993, 0.7858931, 0.7858098, 0.7854959, 0.7851273, 0.7849103, 0.7849665, 0.7852645, 0.7856373, 
-0.7858763, 0.7858475, 0.7855671, 0.785192, 0.7849324, 0.7849335, 0.7851949, 0.7855701, 0.7858491, 0.7858756, 
-0.7856347, 0.7852613, 0.7849645, 0.7849105, 0.7851296, 0.7854992, 0.7858122, 0.7858934, 0.7856972, 0.7853336, 
-0.7850061, 0.7848981, 0.7850701, 0.7854259, 0.7857662, 0.7859005, 0.7857534, 0.7854074, 0.7850561, 0.7848964, 
-0.7850176, 0.785352, 0.7857123, 0.7858967, 0.7858019, 0.785481, 0.7851137, 0.7849056, 0.7849733, 0.785279, 
-0.7856515, 0.7858821, 0.7858418, 0.785553, 0.7851774, 0.7849254, 0.7849381, 0.7852085, 0.7855851, 0.7858571, 
-0.7858721, 0.7856217, 0.785246, 0.7849555, 0.7849128, 0.7851419, 0.7855146, 0.7858221, 0.7858923, 0.7856857, 
-0.7853181, 0.7849952, 0.784898, 0.7850809, 0.7854415, 0.7857779, 0.7859017, 0.7857436, 0.7853919, 0.7850437, 
-0.7848939, 0.7850265, 0.7853673, 0.7857254, 0.7859003, 0.785794, 0.785466, 0.7850999, 0.7849008, 0.7849802, 
-0.7852937, 0.7856658, 0.7858881, 0.7858361, 0.7855388, 0.7851627, 0.7849184, 0.7849427, 0.7852222, 0.7856002, 
-0.7858652, 0.7858687, 0.7856086, 0.7852307, 0.7849464, 0.7849151, 0.7851543, 0.7855302, 0.7858322, 0.7858912, 
-0.7856741, 0.7853024, 0.7849843, 0.7848979, 0.7850917, 0.7854571, 0.7857897, 0.785903, 0.7857337, 0.7853763, 
-0.7850311, 0.7848914, 0.7850355, 0.7853827, 0.7857387, 0.785904, 0.7857861, 0.7854509, 0.785086, 0.7848959, 
-0.784987, 0.7853084, 0.7856802, 0.7858941, 0.7858303, 0.7855245, 0.7851478, 0.7849113, 0.7849474, 0.785236, 
-0.7856155, 0.7858734, 0.7858652, 0.7855954, 0.7852151, 0.7849372, 0.7849174, 0.7851668, 0.7855459, 0.7858423, 
-0.7858901, 0.7856623, 0.7852866, 0.7849732, 0.7848977, 0.7851025, 0.785473, 0.7858016, 0.7859044, 0.7857237, 
-0.7853606, 0.7850184, 0.7848889, 0.7850445, 0.7853983, 0.7857521, 0.7859078, 0.7857781, 0.7854356, 0.785072, 
-0.784891, 0.784994, 0.7853234, 0.7856948, 0.7859001, 0.7858244, 0.78551, 0.7851328, 0.7849041, 0.7849521, 
-0.7852499, 0.7856309, 0.7858816, 0.7858617, 0.7855821, 0.7851994, 0.7849279, 0.7849197, 0.7851795, 0.7855618, 
-0.7858526, 0.785889, 0.7856505, 0.7852706, 0.784962, 0.7848976, 0.7851136, 0.785489, 0.7858137, 0.7859058, 
-0.7857136, 0.7853446, 0.7850056, 0.7848863, 0.7850536, 0.785414, 0.7857657, 0.7859116, 0.78577, 0.7854201, 
-0.7850578, 0.784886, 0.785001, 0.7853385, 0.7857096, 0.7859063, 0.7858186, 0.7854953, 0.7851175, 0.7848968, 
-0.7849568, 0.785264, 0.7856465, 0.7858901, 0.7858582, 0.7855686, 0.7851835, 0.7849184, 0.784922, 0.7851923, 
-0.7855779, 0.7858631, 0.7858879, 0.7856385, 0.7852543, 0.7849506, 0.7848974, 0.7851247, 0.7855053, 0.785826, 
-0.7859072, 0.7857033, 0.7853285, 0.7849925, 0.7848836, 0.7850629, 0.78543, 0.7857795, 0.7859155, 0.7857618, 
-0.7854044, 0.7850433, 0.7848809, 0.7850081, 0.7853538, 0.7857246, 0.7859126, 0.7858126, 0.7854804, 0.785102, 
-0.7848893, 0.7849616, 0.7852784, 0.7856624, 0.7858986, 0.7858546, 0.7855549, 0.7851673, 0.7849088, 0.7849243, 
-0.7852052, 0.7855944, 0.7858737, 0.7858869, 0.7856263, 0.7852378, 0.784939, 0.7848972, 0.785136, 0.7855218, 
-0.7858385, 0.7859087, 0.785693, 0.785312, 0.7849792, 0.7848809, 0.7850722, 0.7854463, 0.7857935, 0.7859195, 
-0.7857535, 0.7853884, 0.7850286, 0.7848756, 0.7850153, 0.7853695, 0.7857399, 0.7859191, 0.7858066, 0.7854653, 
-0.7850862, 0.7848817, 0.7849664, 0.785293, 0.7856786, 0.7859074, 0.785851, 0.785541, 0.7851508, 0.784899, 
-0.7849267, 0.7852185, 0.7856111, 0.7858846, 0.7858858, 0.7856139, 0.785221, 0.7849271, 0.784897, 0.7851476, 
-0.7855386, 0.7858512, 0.7859102, 0.7856824, 0.7852953, 0.7849656, 0.784878, 0.7850818, 0.7854629, 0.7858079, 
-0.7859236, 0.785745, 0.7853721, 0.7850136, 0.7848703, 0.7850226, 0.7853854, 0.7857555, 0.7859257, 0.7858004, 
-0.7854498, 0.7850701, 0.7848739, 0.7849713, 0.7853079, 0.7856952, 0.7859163, 0.7858474, 0.7855267, 0.7851339, 
-0.7848889, 0.784929, 0.7852319, 0.7856281, 0.7858957, 0.7858847, 0.7856012, 0.7852038, 0.784915, 0.7848967, 
-0.7851593, 0.7855558, 0.7858643, 0.7859118, 0.7856716, 0.7852781, 0.7849517, 0.7848751, 0.7850915, 0.7854798, 
-0.7858226, 0.7859278, 0.7857364, 0.7853554, 0.7849982, 0.7848648, 0.7850301, 0.7854016, 0.7857715, 0.7859324, 
-0.7857942, 0.785434, 0.7850536, 0.7848659, 0.7849763, 0.7853231, 0.7857121, 0.7859255, 0.7858436, 0.7855122, 
-0.7851167, 0.7848786, 0.7849314, 0.7852457, 0.7856456, 0.7859071, 0.7858837, 0.7855883, 0.7851862, 0.7849026, 
-0.7848964, 0.7851713, 0.7855734, 0.7858776, 0.7859134, 0.7856606, 0.7852606, 0.7849374, 0.7848721, 0.7851015, 
-0.7854971, 0.7858376, 0.7859321, 0.7857276, 0.7853384, 0.7849824, 0.7848591, 0.7850377, 0.7854183, 0.7857879, 
-0.7859394, 0.7857878, 0.7854179, 0.7850367, 0.7848577, 0.7849814, 0.7853386, 0.7857294, 0.7859349, 0.7858399, 
-0.7854973, 0.785099, 0.784868, 0.7849339, 0.7852598, 0.7856635, 0.7859188, 0.7858826, 0.785575, 0.7851682, 
-0.7848899, 0.7848961, 0.7851836, 0.7855915, 0.7858913, 0.7859151, 0.7856493, 0.7852426, 0.7849228, 0.7848691, 
-0.7851117, 0.7855149, 0.785853, 0.7859366, 0.7857186, 0.7853209, 0.7849663, 0.7848533, 0.7850455, 0.7854354, 
-0.7858047, 0.7859465, 0.7857813, 0.7854013, 0.7850193, 0.7848493, 0.7849866, 0.7853546, 0.7857472, 0.7859446, 
-0.785836, 0.785482, 0.7850808, 0.7848571, 0.7849363, 0.7852743, 0.7856819, 0.7859308, 0.7858815, 0.7855614, 
-0.7851496, 0.7848767, 0.7848958, 0.7851963, 0.7856101, 0.7859055, 0.7859169, 0.7856377, 0.7852242, 0.7849078, 
-0.7848659, 0.7851221, 0.7855332, 0.785869, 0.7859412, 0.7857093, 0.7853029, 0.7849496, 0.7848473, 0.7850535, 
-0.785453, 0.785822, 0.7859539, 0.7857745, 0.7853842, 0.7850014, 0.7848406, 0.784992, 0.7853711, 0.7857656, 
-0.7859546, 0.785832, 0.7854663, 0.7850621, 0.7848459, 0.7849389, 0.7852892, 0.7857009, 0.7859433, 0.7858805, 
-0.7855474, 0.7851305, 0.7848632, 0.7848954, 0.7852093, 0.7856292, 0.78592, 0.7859187, 0.7856258, 0.7852051, 
-0.7848922, 0.7848625, 0.7851329, 0.7855521, 0.7858854, 0.785946, 0.7856998, 0.7852844, 0.7849324, 0.7848411, 
-0.7850618, 0.7854711, 0.7858399, 0.7859615, 0.7857676, 0.7853666, 0.7849829, 0.7848316, 0.7849975, 0.785388, 
-0.7857846, 0.785965, 0.785828, 0.7854501, 0.7850428, 0.7848343, 0.7849415, 0.7853046, 0.7857205, 0.7859561, 
-0.7858794, 0.785533, 0.7851108, 0.7848492, 0.784895, 0.7852227, 0.785649, 0.7859351, 0.7859207, 0.7856135, 
-0.7851854, 0.7848761, 0.7848591, 0.785144, 0.7855716, 0.7859024, 0.785951, 0.7856899, 0.7852652, 0.7849146, 
-0.7848346, 0.7850703, 0.7854899, 0.7858584, 0.7859695, 0.7857605, 0.7853484, 0.7849638, 0.7848222, 0.7850032, 
-0.7854056, 0.7858042, 0.7859757, 0.7858238, 0.7854333, 0.7850228, 0.7848222, 0.7849441, 0.7853205, 0.7857408, 
-0.7859694, 0.7858783, 0.785518, 0.7850903, 0.7848347, 0.7848945, 0.7852366, 0.7856695, 0.7859508, 0.7859227, 
-0.7856008, 0.785165, 0.7848595, 0.7848555, 0.7851555, 0.7855918, 0.78592, 0.7859561, 0.7856797, 0.7852453, 
-0.7848961, 0.7848279, 0.7850791, 0.7855093, 0.7858776, 0.7859777, 0.7857532, 0.7853295, 0.7849439, 0.7848125, 
-0.785009, 0.7854238, 0.7858246, 0.7859868, 0.7858195, 0.7854159, 0.785002, 0.7848097, 0.7849469, 0.7853371, 
-0.7857619, 0.7859833, 0.7858771, 0.7855025, 0.7850691, 0.7848196, 0.784894, 0.785251, 0.7856908, 0.785967, 
-0.7859249, 0.7855875, 0.7851438, 0.7848421, 0.7848517, 0.7851674, 0.7856128, 0.7859383, 0.7859615, 0.7856691, 
-0.7852246, 0.7848769, 0.7848209, 0.7850882, 0.7855295, 0.7858976, 0.7859863, 0.7857455, 0.7853099, 0.7849233, 
-0.7848024, 0.7850151, 0.7854427, 0.7858458, 0.7859985, 0.785815, 0.7853978, 0.7849803, 0.7847966, 0.7849497, 
-0.7853542, 0.7857838, 0.7859977, 0.785876, 0.7854864, 0.7850469, 0.7848038, 0.7848935, 0.785266, 0.7857129, 
-0.785984, 0.7859271, 0.7855738, 0.7851217, 0.784824, 0.7848477, 0.7851799, 0.7856347, 0.7859574, 0.7859672, 
-0.7856581, 0.7852031, 0.7848569, 0.7848136, 0.7850977, 0.7855506, 0.7859185, 0.7859953, 0.7857376, 0.7852894, 
-0.7849017, 0.7847918, 0.7850214, 0.7854624, 0.7858679, 0.7860106, 0.7858103, 0.7853789, 0.7849578, 0.7847829, 
-0.7849526, 0.7853722, 0.7858067, 0.7860128, 0.7858748, 0.7854695, 0.7850238, 0.7847874, 0.7848929, 0.7852816, 
-0.7857361, 0.7860017, 0.7859295, 0.7855594, 0.7850986, 0.7848051, 0.7848436, 0.7851928, 0.7856575, 0.7859774, 
-0.7859731, 0.7856466, 0.7851806, 0.7848359, 0.7848059, 0.7851077, 0.7855726, 0.7859403, 0.7860047, 0.7857293, 
-0.785268, 0.7848792, 0.7847807, 0.785028, 0.7854831, 0.7858911, 0.7860234, 0.7858055, 0.7853591, 0.7849341, 
-0.7847686, 0.7849557, 0.7853909, 0.7858307, 0.7860287, 0.7858736, 0.7854519, 0.7849996, 0.7847701, 0.7848923, 
-0.785298, 0.7857604, 0.7860203, 0.785932, 0.7855444, 0.7850744, 0.7847853, 0.7848392, 0.7852064, 0.7856815, 
-0.7859984, 0.7859793, 0.7856346, 0.785157, 0.7848139, 0.7847978, 0.7851181, 0.7855957, 0.7859632, 0.7860146, 
-0.7857206, 0.7852456, 0.7848555, 0.784769, 0.7850349, 0.7855047, 0.7859154, 0.7860367, 0.7858004, 0.7853384, 
-0.7849093, 0.7847536, 0.7849589, 0.7854106, 0.7858559, 0.7860453, 0.7858723, 0.7854334, 0.7849742, 0.784752, 
-0.7848916, 0.7853152, 0.7857859, 0.7860399, 0.7859346, 0.7855286, 0.785049, 0.7847644, 0.7848346, 0.7852207, 
-0.7857067, 0.7860205, 0.7859859, 0.785622, 0.7851322, 0.7847908, 0.7847893, 0.785129, 0.78562, 0.7859873, 
-0.786025, 0.7857115, 0.785222, 0.7848306, 0.7847567, 0.7850422, 0.7855275, 0.785941, 0.7860509, 0.7857951, 
-0.7853165, 0.7848831, 0.7847377, 0.7849622, 0.7854313, 0.7858825, 0.7860628, 0.785871, 0.7854139, 0.7849474, 
-0.7847329, 0.7848908, 0.7853333, 0.7858128, 0.7860605, 0.7859374, 0.785512, 0.7850222, 0.7847424, 0.7848297, 
-0.7852357, 0.7857333, 0.7860438, 0.7859929, 0.7856087, 0.785106, 0.7847663, 0.7847803, 0.7851405, 0.7856456, 
-0.7860128, 0.786036, 0.7857019, 0.785197, 0.7848042, 0.7847437, 0.7850498, 0.7855516, 0.7859681, 0.7860658, 
-0.7857895, 0.7852935, 0.7848554, 0.7847209, 0.7849657, 0.7854532, 0.7859106, 0.7860814, 0.7858696, 0.7853933, 
-0.784919, 0.7847126, 0.78489, 0.7853525, 0.7858412, 0.7860824, 0.7859404, 0.7854944, 0.7849938, 0.7847191, 
-0.7848245, 0.7852516, 0.7857614, 0.7860684, 0.7860003, 0.7855946, 0.7850782, 0.7847404, 0.7847707, 0.7851527, 
-0.7856728, 0.7860398, 0.7860478, 0.7856917, 0.7851706, 0.7847763, 0.7847299, 0.7850579, 0.7855771, 0.7859968, 
-0.7860817, 0.7857836, 0.785269, 0.7848261, 0.7847031, 0.7849694, 0.7854764, 0.7859404, 0.7861011, 0.7858682, 
-0.7853715, 0.7848889, 0.7846911, 0.7848891, 0.7853728, 0.7858714, 0.7861056, 0.7859436, 0.7854758, 0.7849637, 
-0.7846943, 0.784819, 0.7852684, 0.7857913, 0.7860947, 0.7860082, 0.7855796, 0.7850487, 0.7847128, 0.7847605, 
-0.7851656, 0.7857017, 0.7860685, 0.7860602, 0.7856809, 0.7851425, 0.7847465, 0.7847151, 0.7850665, 0.7856043, 
-0.7860274, 0.7860986, 0.7857773, 0.785243, 0.7847948, 0.7846841, 0.7849733, 0.7855012, 0.7859721, 0.7861222, 
-0.7858667, 0.7853482, 0.7848569, 0.7846681, 0.7848882, 0.7853945, 0.7859036, 0.7861304, 0.7859471, 0.7854559, 
-0.7849315, 0.7846678, 0.784813, 0.7852864, 0.7858232, 0.7861227, 0.7860166, 0.7855637, 0.7850173, 0.7846834, 
-0.7847496, 0.7851794, 0.7857325, 0.7860992, 0.7860736, 0.7856694, 0.7851125, 0.7847148, 0.7846994, 0.7850756, 
-0.7856333, 0.7860601, 0.7861167, 0.7857706, 0.7852152, 0.7847614, 0.7846637, 0.7849775, 0.7855276, 0.7860061, 
-0.7861447, 0.7858651, 0.7853233, 0.7848225, 0.7846435, 0.7848871, 0.7854176, 0.7859381, 0.7861569, 0.7859508, 
-0.7854346, 0.7848971, 0.7846395, 0.7848066, 0.7853057, 0.7858574, 0.7861527, 0.7860256, 0.7855466, 0.7849836, 
-0.7846519, 0.7847379, 0.7851941, 0.7857656, 0.7861321, 0.7860879, 0.7856571, 0.7850803, 0.7846807, 0.7846825, 
-0.7850854, 0.7856644, 0.7860952, 0.7861361, 0.7857634, 0.7851854, 0.7847255, 0.7846418, 0.784982, 0.785556, 
-0.7860426, 0.7861689, 0.7858634, 0.7852966, 0.7847857, 0.7846171, 0.784886, 0.7854425, 0.7859752, 0.7861854, 
-0.7859548, 0.7854117, 0.78486, 0.7846089, 0.7847998, 0.7853264, 0.7858942, 0.7861851, 0.7860354, 0.7855283, 
-0.7849472, 0.7846179, 0.7847252, 0.78521, 0.7858012, 0.7861676, 0.7861034, 0.7856438, 0.7850456, 0.7846439, 
-0.7846642, 0.785096, 0.7856979, 0.786133, 0.7861571, 0.7857557, 0.7851532, 0.7846868, 0.7846182, 0.7849867, 
-0.7855866, 0.786082, 0.786195, 0.7858616, 0.7852678, 0.7847458, 0.7845885, 0.7848847, 0.7854694, 0.7860152, 
-0.7862163, 0.7859591, 0.785387, 0.78482, 0.784576, 0.7847923, 0.7853487, 0.785934, 0.78622, 0.786046, 
-0.7855084, 0.784908, 0.7845811, 0.7847116, 0.7852272, 0.7858397, 0.786206, 0.7861201, 0.7856294, 0.7850081, 
-0.7846041, 0.7846444, 0.7851074, 0.7857343, 0.7861741, 0.7861798, 0.7857474, 0.7851183, 0.7846448, 0.7845926, 
-0.7849919, 0.7856198, 0.7861247, 0.7862234, 0.7858597, 0.7852365, 0.7847026, 0.7845575, 0.7848834, 0.7854985, 
-0.7860587, 0.7862498, 0.7859639, 0.7853602, 0.7847765, 0.7845401, 0.7847842, 0.785373, 0.7859772, 0.7862581, 
-0.7860575, 0.7854869, 0.7848653, 0.7845411, 0.7846967, 0.7852458, 0.7858816, 0.7862477, 0.7861384, 0.7856138, 
-0.7849672, 0.7845608, 0.7846229, 0.7851198, 0.7857738, 0.7862187, 0.7862046, 0.7857383, 0.7850803, 0.784599, 
-0.7845647, 0.7849976, 0.785656, 0.7861713, 0.7862544, 0.7858576, 0.7852024, 0.7846554, 0.7845237, 0.7848818, 
-0.7855303, 0.7861062, 0.7862864, 0.7859691, 0.7853309, 0.784729, 0.7845009, 0.7847753, 0.7853995, 0.7860244, 
-0.7862996, 0.7860701, 0.7854633, 0.7848186, 0.7844973, 0.7846803, 0.7852662, 0.7859275, 0.7862935, 0.7861584, 
-0.7855968, 0.7849225, 0.7845133, 0.7845993, 0.7851334, 0.7858172, 0.7862677, 0.7862318, 0.7857284, 0.7850387, 
-0.7845489, 0.7845341, 0.7850037, 0.7856956, 0.7862224, 0.7862883, 0.7858553, 0.7851649, 0.7846037, 0.7844865, 
-0.7848802, 0.7855652, 0.7861583, 0.7863266, 0.7859748, 0.7852988, 0.7846768, 0.7844578, 0.7847655, 0.7854287, 
-0.7860764, 0.7863454, 0.786084, 0.7854374, 0.7847672, 0.7844491, 0.7846624, 0.7852887, 0.785978, 0.7863439, 
-0.7861804, 0.785578, 0.7848732, 0.784461, 0.7845732, 0.7851483, 0.7858649, 0.7863217, 0.7862617, 0.7857174, 
-0.7849927, 0.7844935, 0.7845003, 0.7850105, 0.7857394, 0.7862789, 0.7863259, 0.7858528, 0.7851236, 0.7845464, 
-0.7844454, 0.7848783, 0.7856038, 0.786216, 0.7863711, 0.7859811, 0.7852632, 0.7846191, 0.7844101, 0.7847547, 
-0.7854609, 0.7861339, 0.786396, 0.7860994, 0.7854087, 0.7847103, 0.7843957, 0.7846424, 0.7853136, 0.7860339, 
-0.7863997, 0.7862049, 0.7855571, 0.7848185, 0.7844029, 0.7845443, 0.7851649, 0.785918, 0.7863816, 0.7862951, 
-0.7857053, 0.7849417, 0.784432, 0.7844627, 0.785018, 0.7857881, 0.7863416, 0.7863676, 0.78585, 0.7850776, 
-0.7844828, 0.7843996, 0.7848762, 0.7856468, 0.7862802, 0.7864207, 0.7859882, 0.7852236, 0.7845547, 0.784357, 
-0.7847426, 0.7854969, 0.786198, 0.7864526, 0.7861165, 0.7853767, 0.7846468, 0.7843361, 0.7846202, 0.7853414, 
-0.7860965, 0.7864622, 0.7862322, 0.7855338, 0.7847573, 0.784338, 0.7845119, 0.7851834, 0.7859773, 0.7864487, 
-0.7863323, 0.7856917, 0.7848845, 0.784363, 0.7844205, 0.7850265, 0.7858427, 0.786412, 0.7864145, 0.7858469, 
-0.785026, 0.7844113, 0.7843483, 0.7848738, 0.7856951, 0.7863523, 0.7864763, 0.7859961, 0.785179, 0.7844824, 
-0.7842972, 0.784729, 0.7855374, 0.7862702, 0.7865162, 0.7861359, 0.7853407, 0.7845752, 0.784269, 0.7845951, 
-0.7853727, 0.786167, 0.7865325, 0.786263, 0.7855076, 0.7846884, 0.7842647, 0.7844754, 0.7852044, 0.7860443, 
-0.7865245, 0.7863745, 0.7856763, 0.78482, 0.7842851, 0.7843729, 0.785036, 0.7859044, 0.7864916, 0.7864674, 
-0.7858434, 0.7849676, 0.7843305, 0.7842901, 0.7848712, 0.7857497, 0.786434, 0.7865394, 0.7860051, 0.7851285, 
-0.7844003, 0.7842294, 0.7847135, 0.7855833, 0.7863521, 0.7865884, 0.7861578, 0.7852997, 0.7844939, 0.7841927, 
-0.7845666, 0.7854083, 0.7862471, 0.7866126, 0.7862981, 0.7854777, 0.7846099, 0.7841813, 0.7844339, 0.7852282, 
-0.7861207, 0.7866109, 0.7864225, 0.7856588, 0.7847463, 0.7841962, 0.7843185, 0.7850469, 0.7859749, 0.7865826, 
-0.786528, 0.7858394, 0.7849008, 0.784238, 0.7842236, 0.7848681, 0.7858123, 0.7865275, 0.7866117, 0.7860154, 
-0.7850707, 0.7843063, 0.7841517, 0.7846958, 0.785636, 0.7864461, 0.7866713, 0.786183, 0.7852527, 0.7844005, 
-0.784105, 0.7845338, 0.7854492, 0.7863393, 0.7867047, 0.7863384, 0.7854433, 0.7845194, 0.7840852, 0.784386, 
-0.7852557, 0.7862087, 0.7867105, 0.7864779, 0.7856386, 0.7846612, 0.7840936, 0.7842558, 0.7850595, 0.7860563, 
-0.7866877, 0.786598, 0.7858347, 0.7848235, 0.7841309, 0.7841466, 0.7848646, 0.7858848, 0.7866359, 0.7866954, 
-0.7860273, 0.7850035, 0.7841972, 0.7840615, 0.7846753, 0.7856971, 0.7865553, 0.7867676, 0.7862123, 0.785198, 
-0.7842919, 0.7840029, 0.7844957, 0.7854969, 0.7864467, 0.786812, 0.7863854, 0.7854031, 0.784414, 0.7839731, 
-0.7843301, 0.7852879, 0.7863115, 0.7868269, 0.7865426, 0.7856149, 0.7845618, 0.7839736, 0.7841824, 0.7850743, 
-0.7861517, 0.7868108, 0.7866799, 0.7858292, 0.7847329, 0.7840053, 0.7840563, 0.7848605, 0.78597, 0.7867632, 
-0.7867938, 0.7860413, 0.7849246, 0.7840688, 0.7839554, 0.7846512, 0.7857693, 0.786684, 0.7868811, 0.7862468, 
-0.7851334, 0.7841637, 0.7838825, 0.7844508, 0.7855533, 0.7865736, 0.7869388, 0.786441, 0.7853556, 0.7842892, 
-0.7838404, 0.7842639, 0.785326, 0.7864334, 0.7869648, 0.7866193, 0.7855868, 0.7844436, 0.783831, 0.7840951, 
-0.7850919, 0.7862652, 0.7869573, 0.7867775, 0.7858225, 0.7846249, 0.7838557, 0.7839487, 0.7848557, 0.7860716, 
-0.7869153, 0.7869113, 0.786058, 0.7848301, 0.7839153, 0.7838284, 0.7846223, 0.7858557, 0.7868381, 0.7870171, 
-0.786288, 0.7850559, 0.7840098, 0.783738, 0.7843968, 0.7856211, 0.7867263, 0.7870914, 0.7865077, 0.7852982, 
-0.7841388, 0.7836805, 0.7841843, 0.7853721, 0.7865806, 0.7871314, 0.7867119, 0.7855527, 0.7843007, 0.7836585, 
-0.7839897, 0.7851134, 0.7864028, 0.7871349, 0.7868957, 0.7858144, 0.7844937, 0.7836739, 0.7838179, 0.78485, 
-0.7861954, 0.7871003, 0.7870543, 0.7860781, 0.7847149, 0.783728, 0.7836736, 0.7845873, 0.7859613, 0.7870266, 
-0.7871833, 0.7863384, 0.7849609, 0.7838213, 0.7835609, 0.7843308, 0.7857044, 0.7869137, 0.7872787, 0.7865897, 
-0.7852276, 0.7839536, 0.7834837, 0.7840862, 0.785429, 0.7867622, 0.787337, 0.7868262, 0.7855104, 0.784124, 
-0.7834451, 0.7838592, 0.7851401, 0.7865734, 0.7873551, 0.7870423, 0.7858041, 0.7843306, 0.7834479, 0.7836554, 
-0.784843, 0.7863496, 0.7873309, 0.7872325, 0.7861031, 0.7845709, 0.7834939, 0.7834801, 0.7845436, 0.7860937, 
-0.7872627, 0.7873916, 0.7864015, 0.7848415, 0.7835844, 0.7833383, 0.7842479, 0.7858094, 0.7871499, 0.7875148, 
-0.7866929, 0.7851383, 0.7837197, 0.7832349, 0.7839624, 0.7855013, 0.7869923, 0.7875975, 0.7869709, 0.7854565, 
-0.7838993, 0.7831739, 0.7836934, 0.7851743, 0.786791, 0.7876359, 0.7872292, 0.7857908, 0.7841219, 0.7831588, 
-0.7834474, 0.7848343, 0.7865476, 0.7876269, 0.7874612, 0.786135, 0.7843854, 0.7831925, 0.7832309, 0.7844875, 
-0.7862649, 0.7875679, 0.7876608, 0.7864827, 0.7846865, 0.7832772, 0.7830497, 0.7841406, 0.7859463, 0.7874573, 
-0.787822, 0.786827, 0.7850214, 0.783414, 0.7829099, 0.7838007, 0.7855963, 0.7872942, 0.7879391, 0.7871606, 
-0.7853853, 0.7836034, 0.7828167, 0.7834752, 0.7852199, 0.7870786, 0.7880072, 0.7874762, 0.7857726, 0.7838448, 
-0.782775, 0.7831715, 0.7848232, 0.7868117, 0.7880215, 0.7877661, 0.786177, 0.7841368, 0.7827889, 0.7828972, 
-0.7844128, 0.7864953, 0.7879784, 0.788023, 0.7865916, 0.7844768, 0.782862, 0.7826597, 0.7839959, 0.7861325, 
-0.7878748, 0.7882393, 0.7870089, 0.7848615, 0.7829968, 0.7824663, 0.7835803, 0.7857271, 0.7877083, 0.7884079, 
-0.7874207, 0.7852864, 0.7831953, 0.7823241, 0.7831744, 0.7852839, 0.7874776, 0.788522, 0.7878186, 0.7857464, 
-0.7834583, 0.7822397, 0.7827867, 0.7848088, 0.7871823, 0.7885752, 0.7881938, 0.7862351, 0.7837857, 0.7822192, 
-0.7824262, 0.7843082, 0.786823, 0.7885616, 0.7885373, 0.7867456, 0.7841766, 0.7822683, 0.782102, 0.7837897, 
-0.7864011, 0.7884757, 0.7888399, 0.78727, 0.784629, 0.782392, 0.7818233, 0.7832615, 0.785919, 0.7883131, 
-0.7890924, 0.7877999, 0.7851398, 0.7825947, 0.7815993, 0.7827323, 0.7853803, 0.7880695, 0.7892856, 0.788326, 
-0.7857053, 0.78288, 0.7814393, 0.7822117, 0.7847892, 0.7877417, 0.7894102, 0.7888385, 0.7863207, 0.783251, 
-0.7813523, 0.7817098, 0.784151, 0.787327, 0.7894572, 0.7893271, 0.7869802, 0.78371, 0.7813476, 0.7812372, 
-0.7834717, 0.7868232, 0.7894174, 0.789781, 0.7876777, 0.7842589, 0.7814341, 0.780805, 0.7827579, 0.7862287, 
-0.7892818, 0.7901887, 0.788406, 0.7848992, 0.7816211, 0.7804248, 0.782017, 0.7855423, 0.7890411, 0.7905384, 
-0.7891575, 0.7856322, 0.7819181, 0.7801088, 0.7812568, 0.7847625, 0.7886854, 0.7908174, 0.7899243, 0.7864592, 
-0.7823351, 0.7798701, 0.7804855, 0.7838878, 0.7882042, 0.7910123, 0.7906981, 0.7873823, 0.7828835, 0.7797226, 
-0.7797113, 0.7829156, 0.7875853, 0.7911084, 0.7914705, 0.7884046, 0.7835766, 0.779682, 0.7789427, 0.7818417, 
-0.7868139, 0.7910892, 0.7922332, 0.7895318, 0.7844309, 0.779766, 0.7781878, 0.7806589, 0.7858712, 0.790935, 
-0.7929784, 0.7907732, 0.7854685, 0.7799963, 0.7774542, 0.779355, 0.7847312, 0.7906218, 0.7936989, 0.7921447, 
-0.7867199, 0.7804003, 0.7767484, 0.7779095, 0.7833572, 0.7901177, 0.7943888, 0.7936725, 0.7882304, 0.7810154, 
-0.7760753, 0.7762883, 0.781693, 0.7893784, 0.7950446, 0.7954013, 0.7900701, 0.7818956, 0.7754367, 0.7744331, 
-0.7796497, 0.7883366, 0.7956669, 0.7974081, 0.7923537, 0.7831255, 0.7748285, 0.7722409, 0.7770768, 0.7868836, 
-0.7962648, 0.7998323, 0.7952822, 0.7848482, 0.7742343, 0.7695194, 0.7737004, 0.7848269, 0.7968664, 0.8029449, 
-0.7992384, 0.7873299, 0.7736069, 0.7658762, 0.7689697, 0.781787, 0.7975515, 0.8073342, 0.8050438, 0.7911316, 
-0.7728068, 0.7603901, 0.7616027, 0.7768968, 0.7985766, 0.8145267, 0.8148169, 0.7976692, 0.7713237, 0.7503327, 
-0.7478201, 0.767671, 0.8010814, 0.8299499, 0.8360721, 0.811755, 0.7661244, 0.7229732, 0.7099503, 0.7434072, 
-0.8160204, 0.8938317, 0.9255307, 0.8612613, 0.6735256, 0.3711808, 0.0, -0.3711808, -0.6735256, -0.8612613, 
--0.9255307, -0.8938317, -0.8160204, -0.7434072, -0.7099503, -0.7229732, -0.7661244, -0.811755, -0.8360721, -0.8299499, 
--0.8010814, -0.767671, -0.7478201, -0.7503327, -0.7713237, -0.7976692, -0.8148169, -0.8145267, -0.7985766, -0.7768968, 
--0.7616027, -0.7603901, -0.7728068, -0.7911316, -0.8050438, -0.8073342, -0.7975515, -0.781787, -0.7689697, -0.7658762, 
--0.7736069, -0.7873299, -0.7992384, -0.8029449, -0.7968664, -0.7848269, -0.7737004, -0.7695194, -0.7742343, -0.7848482, 
--0.7952822, -0.7998323, -0.7962648, -0.7868836, -0.7770768, -0.7722409, -0.7748285, -0.7831255, -0.7923537, -0.7974081, 
--0.7956669, -0.7883366, -0.7796497, -0.7744331, -0.7754367, -0.7818956, -0.7900701, -0.7954013, -0.7950446, -0.7893784, 
--0.781693, -0.7762883, -0.7760753, -0.7810154, -0.7882304, -0.7936725, -0.7943888, -0.7901177, -0.7833572, -0.7779095, 
--0.7767484, -0.7804003, -0.7867199, -0.7921447, -0.7936989, -0.7906218, -0.7847312, -0.779355, -0.7774542, -0.7799963, 
--0.7854685, -0.7907732, -0.7929784, -0.790935, -0.7858712, -0.7806589, -0.7781878, -0.779766, -0.7844309, -0.7895318, 
--0.7922332, -0.7910892, -0.7868139, -0.7818417, -0.7789427, -0.779682, -0.7835766, -0.7884046, -0.7914705, -0.7911084, 
--0.7875853, -0.7829156, -0.7797113, -0.7797226, -0.7828835, -0.7873823, -0.7906981, -0.7910123, -0.7882042, -0.7838878, 
--0.7804855, -0.7798701, -0.7823351, -0.7864592, -0.7899243, -0.7908174, -0.7886854, -0.7847625, -0.7812568, -0.7801088, 
--0.7819181, -0.7856322, -0.7891575, -0.7905384, -0.7890411, -0.7855423, -0.782017, -0.7804248, -0.7816211, -0.7848992, 
--0.788406, -0.7901887, -0.7892818, -0.7862287, -0.7827579, -0.780805, -0.7814341, -0.7842589, -0.7876777, -0.789781, 
--0.7894174, -0.7868232, -0.7834717, -0.7812372, -0.7813476, -0.78371, -0.7869802, -0.7893271, -0.7894572, -0.787327, 
--0.784151, -0.7817098, -0.7813523, -0.783251, -0.7863207, -0.7888385, -0.7894102, -0.7877417, -0.7847892, -0.7822117, 
--0.7814393, -0.78288, -0.7857053, -0.788326, -0.7892856, -0.7880695, -0.7853803, -0.7827323, -0.7815993, -0.7825947, 
--0.7851398, -0.7877999, -0.7890924, -0.7883131, -0.785919, -0.7832615, -0.7818233, -0.782392, -0.784629, -0.78727, 
--0.7888399, -0.7884757, -0.7864011, -0.7837897, -0.782102, -0.7822683, -0.7841766, -0.7867456, -0.7885373, -0.7885616, 
--0.786823, -0.7843082, -0.7824262, -0.7822192, -0.7837857, -0.7862351, -0.7881938, -0.7885752, -0.7871823, -0.7848088, 
--0.7827867, -0.7822397, -0.7834583, -0.7857464, -0.7878186, -0.788522, -0.7874776, -0.7852839, -0.7831744, -0.7823241, 
--0.7831953, -0.7852864, -0.7874207, -0.7884079, -0.7877083, -0.7857271, -0.7835803, -0.7824663, -0.7829968, -0.7848615, 
--0.7870089, -0.7882393, -0.7878748, -0.7861325, -0.7839959, -0.7826597, -0.782862, -0.7844768, -0.7865916, -0.788023, 
--0.7879784, -0.7864953, -0.7844128, -0.7828972, -0.7827889, -0.7841368, -0.786177, -0.7877661, -0.7880215, -0.7868117, 
--0.7848232, -0.7831715, -0.782775, -0.7838448, -0.7857726, -0.7874762, -0.7880072, -0.7870786, -0.7852199, -0.7834752, 
--0.7828167, -0.7836034, -0.7853853, -0.7871606, -0.7879391, -0.7872942, -0.7855963, -0.7838007, -0.7829099, -0.783414, 
--0.7850214, -0.786827, -0.787822, -0.7874573, -0.7859463, -0.7841406, -0.7830497, -0.7832772, -0.7846865, -0.7864827, 
--0.7876608, -0.7875679, -0.7862649, -0.7844875, -0.7832309, -0.7831925, -0.7843854, -0.786135, -0.7874612, -0.7876269, 
--0.7865476, -0.7848343, -0.7834474, -0.7831588, -0.7841219, -0.7857908, -0.7872292, -0.7876359, -0.786791, -0.7851743, 
--0.7836934, -0.7831739, -0.7838993, -0.7854565, -0.7869709, -0.7875975, -0.7869923, -0.7855013, -0.7839624, -0.7832349, 
--0.7837197, -0.7851383, -0.7866929, -0.7875148, -0.7871499, -0.7858094, -0.7842479, -0.7833383, -0.7835844, -0.7848415, 
--0.7864015, -0.7873916, -0.7872627, -0.7860937, -0.7845436, -0.7834801, -0.7834939, -0.7845709, -0.7861031, -0.7872325, 
--0.7873309, -0.7863496, -0.784843, -0.7836554, -0.7834479, -0.7843306, -0.7858041, -0.7870423, -0.7873551, -0.7865734, 
--0.7851401, -0.7838592, -0.7834451, -0.784124, -0.7855104, -0.7868262, -0.787337, -0.7867622, -0.785429, -0.7840862, 
--0.7834837, -0.7839536, -0.7852276, -0.7865897, -0.7872787, -0.7869137, -0.7857044, -0.7843308, -0.7835609, -0.7838213, 
--0.7849609, -0.7863384, -0.7871833, -0.7870266, -0.7859613, -0.7845873, -0.7836736, -0.783728, -0.7847149, -0.7860781, 
--0.7870543, -0.7871003, -0.7861954, -0.78485, -0.7838179, -0.7836739, -0.7844937, -0.7858144, -0.7868957, -0.7871349, 
--0.7864028, -0.7851134, -0.7839897, -0.7836585, -0.7843007, -0.7855527, -0.7867119, -0.7871314, -0.7865806, -0.7853721, 
--0.7841843, -0.7836805, -0.7841388, -0.7852982, -0.7865077, -0.7870914, -0.7867263, -0.7856211, -0.7843968, -0.783738, 
--0.7840098, -0.7850559, -0.786288, -0.7870171, -0.7868381, -0.7858557, -0.7846223, -0.7838284, -0.7839153, -0.7848301, 
--0.786058, -0.7869113, -0.7869153, -0.7860716, -0.7848557, -0.7839487, -0.7838557, -0.7846249, -0.7858225, -0.7867775, 
--0.7869573, -0.7862652, -0.7850919, -0.7840951, -0.783831, -0.7844436, -0.7855868, -0.7866193, -0.7869648, -0.7864334, 
--0.785326, -0.7842639, -0.7838404, -0.7842892, -0.7853556, -0.786441, -0.7869388, -0.7865736, -0.7855533, -0.7844508, 
--0.7838825, -0.7841637, -0.7851334, -0.7862468, -0.7868811, -0.786684, -0.7857693, -0.7846512, -0.7839554, -0.7840688, 
--0.7849246, -0.7860413, -0.7867938, -0.7867632, -0.78597, -0.7848605, -0.7840563, -0.7840053, -0.7847329, -0.7858292, 
--0.7866799, -0.7868108, -0.7861517, -0.7850743, -0.7841824, -0.7839736, -0.7845618, -0.7856149, -0.7865426, -0.7868269, 
--0.7863115, -0.7852879, -0.7843301, -0.7839731, -0.784414, -0.7854031, -0.7863854, -0.786812, -0.7864467, -0.7854969, 
--0.7844957, -0.7840029, -0.7842919, -0.785198, -0.7862123, -0.7867676, -0.7865553, -0.7856971, -0.7846753, -0.7840615, 
--0.7841972, -0.7850035, -0.7860273, -0.7866954, -0.7866359, -0.7858848, -0.7848646, -0.7841466, -0.7841309, -0.7848235, 
--0.7858347, -0.786598, -0.7866877, -0.7860563, -0.7850595, -0.7842558, -0.7840936, -0.7846612, -0.7856386, -0.7864779, 
--0.7867105, -0.7862087, -0.7852557, -0.784386, -0.7840852, -0.7845194, -0.7854433, -0.7863384, -0.7867047, -0.7863393, 
--0.7854492, -0.7845338, -0.784105, -0.7844005, -0.7852527, -0.786183, -0.7866713, -0.7864461, -0.785636, -0.7846958, 
--0.7841517, -0.7843063, -0.7850707, -0.7860154, -0.7866117, -0.7865275, -0.7858123, -0.7848681, -0.7842236, -0.784238, 
--0.7849008, -0.7858394, -0.786528, -0.7865826, -0.7859749, -0.7850469, -0.7843185, -0.7841962, -0.7847463, -0.7856588, 
--0.7864225, -0.7866109, -0.7861207, -0.7852282, -0.7844339, -0.7841813, -0.7846099, -0.7854777, -0.7862981, -0.7866126, 
--0.7862471, -0.7854083, -0.7845666, -0.7841927, -0.7844939, -0.7852997, -0.7861578, -0.7865884, -0.7863521, -0.7855833, 
--0.7847135, -0.7842294, -0.7844003, -0.7851285, -0.7860051, -0.7865394, -0.786434, -0.7857497, -0.7848712, -0.7842901, 
--0.7843305, -0.7849676, -0.7858434, -0.7864674, -0.7864916, -0.7859044, -0.785036, -0.7843729, -0.7842851, -0.78482, 
--0.7856763, -0.7863745, -0.7865245, -0.7860443, -0.7852044, -0.7844754, -0.7842647, -0.7846884, -0.7855076, -0.786263, 
--0.7865325, -0.786167, -0.7853727, -0.7845951, -0.784269, -0.7845752, -0.7853407, -0.7861359, -0.7865162, -0.7862702, 
--0.7855374, -0.784729, -0.7842972, -0.7844824, -0.785179, -0.7859961, -0.7864763, -0.7863523, -0.7856951, -0.7848738, 
--0.7843483, -0.7844113, -0.785026, -0.7858469, -0.7864145, -0.786412, -0.7858427, -0.7850265, -0.7844205, -0.784363, 
--0.7848845, -0.7856917, -0.7863323, -0.7864487, -0.7859773, -0.7851834, -0.7845119, -0.784338, -0.7847573, -0.7855338, 
--0.7862322, -0.7864622, -0.7860965, -0.7853414, -0.7846202, -0.7843361, -0.7846468, -0.7853767, -0.7861165, -0.7864526, 
--0.786198, -0.7854969, -0.7847426, -0.784357, -0.7845547, -0.7852236, -0.7859882, -0.7864207, -0.7862802, -0.7856468, 
--0.7848762, -0.7843996, -0.7844828, -0.7850776, -0.78585, -0.7863676, -0.7863416, -0.7857881, -0.785018, -0.7844627, 
--0.784432, -0.7849417, -0.7857053, -0.7862951, -0.7863816, -0.785918, -0.7851649, -0.7845443, -0.7844029, -0.7848185, 
--0.7855571, -0.7862049, -0.7863997, -0.7860339, -0.7853136, -0.7846424, -0.7843957, -0.7847103, -0.7854087, -0.7860994, 
--0.786396, -0.7861339, -0.7854609, -0.7847547, -0.7844101, -0.7846191, -0.7852632, -0.7859811, -0.7863711, -0.786216, 
--0.7856038, -0.7848783, -0.7844454, -0.7845464, -0.7851236, -0.7858528, -0.7863259, -0.7862789, -0.7857394, -0.7850105, 
--0.7845003, -0.7844935, -0.7849927, -0.7857174, -0.7862617, -0.7863217, -0.7858649, -0.7851483, -0.7845732, -0.784461, 
--0.7848732, -0.785578, -0.7861804, -0.7863439, -0.785978, -0.7852887, -0.7846624, -0.7844491, -0.7847672, -0.7854374, 
--0.786084, -0.7863454, -0.7860764, -0.7854287, -0.7847655, -0.7844578, -0.7846768, -0.7852988, -0.7859748, -0.7863266, 
--0.7861583, -0.7855652, -0.7848802, -0.7844865, -0.7846037, -0.7851649, -0.7858553, -0.7862883, -0.7862224, -0.7856956, 
--0.7850037, -0.7845341, -0.7845489, -0.7850387, -0.7857284, -0.7862318, -0.7862677, -0.7858172, -0.7851334, -0.7845993, 
--0.7845133, -0.7849225, -0.7855968, -0.7861584, -0.7862935, -0.7859275, -0.7852662, -0.7846803, -0.7844973, -0.7848186, 
--0.7854633, -0.7860701, -0.7862996, -0.7860244, -0.7853995, -0.7847753, -0.7845009, -0.784729, -0.7853309, -0.7859691, 
--0.7862864, -0.7861062, -0.7855303, -0.7848818, -0.7845237, -0.7846554, -0.7852024, -0.7858576, -0.7862544, -0.7861713, 
--0.785656, -0.7849976, -0.7845647, -0.784599, -0.7850803, -0.7857383, -0.7862046, -0.7862187, -0.7857738, -0.7851198, 
--0.7846229, -0.7845608, -0.7849672, -0.7856138, -0.7861384, -0.7862477, -0.7858816, -0.7852458, -0.7846967, -0.7845411, 
--0.7848653, -0.7854869, -0.7860575, -0.7862581, -0.7859772, -0.785373, -0.7847842, -0.7845401, -0.7847765, -0.7853602, 
--0.7859639, -0.7862498, -0.7860587, -0.7854985, -0.7848834, -0.7845575, -0.7847026, -0.7852365, -0.7858597, -0.7862234, 
--0.7861247, -0.7856198, -0.7849919, -0.7845926, -0.7846448, -0.7851183, -0.7857474, -0.7861798, -0.7861741, -0.7857343, 
--0.7851074, -0.7846444, -0.7846041, -0.7850081, -0.7856294, -0.7861201, -0.786206, -0.7858397, -0.7852272, -0.7847116, 
--0.7845811, -0.784908, -0.7855084, -0.786046, -0.78622, -0.785934, -0.7853487, -0.7847923, -0.784576, -0.78482, 
--0.785387, -0.7859591, -0.7862163, -0.7860152, -0.7854694, -0.7848847, -0.7845885, -0.7847458, -0.7852678, -0.7858616, 
--0.786195, -0.786082, -0.7855866, -0.7849867, -0.7846182, -0.7846868, -0.7851532, -0.7857557, -0.7861571, -0.786133, 
--0.7856979, -0.785096, -0.7846642, -0.7846439, -0.7850456, -0.7856438, -0.7861034, -0.7861676, -0.7858012, -0.78521, 
--0.7847252, -0.7846179, -0.7849472, -0.7855283, -0.7860354, -0.7861851, -0.7858942, -0.7853264, -0.7847998, -0.7846089, 
--0.78486, -0.7854117, -0.7859548, -0.7861854, -0.7859752, -0.7854425, -0.784886, -0.7846171, -0.7847857, -0.7852966, 
--0.7858634, -0.7861689, -0.7860426, -0.785556, -0.784982, -0.7846418, -0.7847255, -0.7851854, -0.7857634, -0.7861361, 
--0.7860952, -0.7856644, -0.7850854, -0.7846825, -0.7846807, -0.7850803, -0.7856571, -0.7860879, -0.7861321, -0.7857656, 
--0.7851941, -0.7847379, -0.7846519, -0.7849836, -0.7855466, -0.7860256, -0.7861527, -0.7858574, -0.7853057, -0.7848066, 
--0.7846395, -0.7848971, -0.7854346, -0.7859508, -0.7861569, -0.7859381, -0.7854176, -0.7848871, -0.7846435, -0.7848225, 
--0.7853233, -0.7858651, -0.7861447, -0.7860061, -0.7855276, -0.7849775, -0.7846637, -0.7847614, -0.7852152, -0.7857706, 
--0.7861167, -0.7860601, -0.7856333, -0.7850756, -0.7846994, -0.7847148, -0.7851125, -0.7856694, -0.7860736, -0.7860992, 
--0.7857325, -0.7851794, -0.7847496, -0.7846834, -0.7850173, -0.7855637, -0.7860166, -0.7861227, -0.7858232, -0.7852864, 
--0.784813, -0.7846678, -0.7849315, -0.7854559, -0.7859471, -0.7861304, -0.7859036, -0.7853945, -0.7848882, -0.7846681, 
--0.7848569, -0.7853482, -0.7858667, -0.7861222, -0.7859721, -0.7855012, -0.7849733, -0.7846841, -0.7847948, -0.785243, 
--0.7857773, -0.7860986, -0.7860274, -0.7856043, -0.7850665, -0.7847151, -0.7847465, -0.7851425, -0.7856809, -0.7860602, 
--0.7860685, -0.7857017, -0.7851656, -0.7847605, -0.7847128, -0.7850487, -0.7855796, -0.7860082, -0.7860947, -0.7857913, 
--0.7852684, -0.784819, -0.7846943, -0.7849637, -0.7854758, -0.7859436, -0.7861056, -0.7858714, -0.7853728, -0.7848891, 
--0.7846911, -0.7848889, -0.7853715, -0.7858682, -0.7861011, -0.7859404, -0.7854764, -0.7849694, -0.7847031, -0.7848261, 
--0.785269, -0.7857836, -0.7860817, -0.7859968, -0.7855771, -0.7850579, -0.7847299, -0.7847763, -0.7851706, -0.7856917, 
--0.7860478, -0.7860398, -0.7856728, -0.7851527, -0.7847707, -0.7847404, -0.7850782, -0.7855946, -0.7860003, -0.7860684, 
--0.7857614, -0.7852516, -0.7848245, -0.7847191, -0.7849938, -0.7854944, -0.7859404, -0.7860824, -0.7858412, -0.7853525, 
--0.78489, -0.7847126, -0.784919, -0.7853933, -0.7858696, -0.7860814, -0.7859106, -0.7854532, -0.7849657, -0.7847209, 
--0.7848554, -0.7852935, -0.7857895, -0.7860658, -0.7859681, -0.7855516, -0.7850498, -0.7847437, -0.7848042, -0.785197, 
--0.7857019, -0.786036, -0.7860128, -0.7856456, -0.7851405, -0.7847803, -0.7847663, -0.785106, -0.7856087, -0.7859929, 
--0.7860438, -0.7857333, -0.7852357, -0.7848297, -0.7847424, -0.7850222, -0.785512, -0.7859374, -0.7860605, -0.7858128, 
--0.7853333, -0.7848908, -0.7847329, -0.7849474, -0.7854139, -0.785871, -0.7860628, -0.7858825, -0.7854313, -0.7849622, 
--0.7847377, -0.7848831, -0.7853165, -0.7857951, -0.7860509, -0.785941, -0.7855275, -0.7850422, -0.7847567, -0.7848306, 
--0.785222, -0.7857115, -0.786025, -0.7859873, -0.78562, -0.785129, -0.7847893, -0.7847908, -0.7851322, -0.785622, 
--0.7859859, -0.7860205, -0.7857067, -0.7852207, -0.7848346, -0.7847644, -0.785049, -0.7855286, -0.7859346, -0.7860399, 
--0.7857859, -0.7853152, -0.7848916, -0.784752, -0.7849742, -0.7854334, -0.7858723, -0.7860453, -0.7858559, -0.7854106, 
--0.7849589, -0.7847536, -0.7849093, -0.7853384, -0.7858004, -0.7860367, -0.7859154, -0.7855047, -0.7850349, -0.784769, 
--0.7848555, -0.7852456, -0.7857206, -0.7860146, -0.7859632, -0.7855957, -0.7851181, -0.7847978, -0.7848139, -0.785157, 
--0.7856346, -0.7859793, -0.7859984, -0.7856815, -0.7852064, -0.7848392, -0.7847853, -0.7850744, -0.7855444, -0.785932, 
--0.7860203, -0.7857604, -0.785298, -0.7848923, -0.7847701, -0.7849996, -0.7854519, -0.7858736, -0.7860287, -0.7858307, 
--0.7853909, -0.7849557, -0.7847686, -0.7849341, -0.7853591, -0.7858055, -0.7860234, -0.7858911, -0.7854831, -0.785028, 
--0.7847807, -0.7848792, -0.785268, -0.7857293, -0.7860047, -0.7859403, -0.7855726, -0.7851077, -0.7848059, -0.7848359, 
--0.7851806, -0.7856466, -0.7859731, -0.7859774, -0.7856575, -0.7851928, -0.7848436, -0.7848051, -0.7850986, -0.7855594, 
--0.7859295, -0.7860017, -0.7857361, -0.7852816, -0.7848929, -0.7847874, -0.7850238, -0.7854695, -0.7858748, -0.7860128, 
--0.7858067, -0.7853722, -0.7849526, -0.7847829, -0.7849578, -0.7853789, -0.7858103, -0.7860106, -0.7858679, -0.7854624, 
--0.7850214, -0.7847918, -0.7849017, -0.7852894, -0.7857376, -0.7859953, -0.7859185, -0.7855506, -0.7850977, -0.7848136, 
--0.7848569, -0.7852031, -0.7856581, -0.7859672, -0.7859574, -0.7856347, -0.7851799, -0.7848477, -0.784824, -0.7851217, 
--0.7855738, -0.7859271, -0.785984, -0.7857129, -0.785266, -0.7848935, -0.7848038, -0.7850469, -0.7854864, -0.785876, 
--0.7859977, -0.7857838, -0.7853542, -0.7849497, -0.7847966, -0.7849803, -0.7853978, -0.785815, -0.7859985, -0.7858458, 
--0.7854427, -0.7850151, -0.7848024, -0.7849233, -0.7853099, -0.7857455, -0.7859863, -0.7858976, -0.7855295, -0.7850882, 
--0.7848209, -0.7848769, -0.7852246, -0.7856691, -0.7859615, -0.7859383, -0.7856128, -0.7851674, -0.7848517, -0.7848421, 
--0.7851438, -0.7855875, -0.7859249, -0.785967, -0.7856908, -0.785251, -0.784894, -0.7848196, -0.7850691, -0.7855025, 
--0.7858771, -0.7859833, -0.7857619, -0.7853371, -0.7849469, -0.7848097, -0.785002, -0.7854159, -0.7858195, -0.7859868, 
--0.7858246, -0.7854238, -0.785009, -0.7848125, -0.7849439, -0.7853295, -0.7857532, -0.7859777, -0.7858776, -0.7855093, 
--0.7850791, -0.7848279, -0.7848961, -0.7852453, -0.7856797, -0.7859561, -0.78592, -0.7855918, -0.7851555, -0.7848555, 
--0.7848595, -0.785165, -0.7856008, -0.7859227, -0.7859508, -0.7856695, -0.7852366, -0.7848945, -0.7848347, -0.7850903, 
--0.785518, -0.7858783, -0.7859694, -0.7857408, -0.7853205, -0.7849441, -0.7848222, -0.7850228, -0.7854333, -0.7858238, 
--0.7859757, -0.7858042, -0.7854056, -0.7850032, -0.7848222, -0.7849638, -0.7853484, -0.7857605, -0.7859695, -0.7858584, 
--0.7854899, -0.7850703, -0.7848346, -0.7849146, -0.7852652, -0.7856899, -0.785951, -0.7859024, -0.7855716, -0.785144, 
--0.7848591, -0.7848761, -0.7851854, -0.7856135, -0.7859207, -0.7859351, -0.785649, -0.7852227, -0.784895, -0.7848492, 
--0.7851108, -0.785533, -0.7858794, -0.7859561, -0.7857205, -0.7853046, -0.7849415, -0.7848343, -0.7850428, -0.7854501, 
--0.785828, -0.785965, -0.7857846, -0.785388, -0.7849975, -0.7848316, -0.7849829, -0.7853666, -0.7857676, -0.7859615, 
--0.7858399, -0.7854711, -0.7850618, -0.7848411, -0.7849324, -0.7852844, -0.7856998, -0.785946, -0.7858854, -0.7855521, 
--0.7851329, -0.7848625, -0.7848922, -0.7852051, -0.7856258, -0.7859187, -0.78592, -0.7856292, -0.7852093, -0.7848954, 
--0.7848632, -0.7851305, -0.7855474, -0.7858805, -0.7859433, -0.7857009, -0.7852892, -0.7849389, -0.7848459, -0.7850621, 
--0.7854663, -0.785832, -0.7859546, -0.7857656, -0.7853711, -0.784992, -0.7848406, -0.7850014, -0.7853842, -0.7857745, 
--0.7859539, -0.785822, -0.785453, -0.7850535, -0.7848473, -0.7849496, -0.7853029, -0.7857093, -0.7859412, -0.785869, 
--0.7855332, -0.7851221, -0.7848659, -0.7849078, -0.7852242, -0.7856377, -0.7859169, -0.7859055, -0.7856101, -0.7851963, 
--0.7848958, -0.7848767, -0.7851496, -0.7855614, -0.7858815, -0.7859308, -0.7856819, -0.7852743, -0.7849363, -0.7848571, 
--0.7850808, -0.785482, -0.785836, -0.7859446, -0.7857472, -0.7853546, -0.7849866, -0.7848493, -0.7850193, -0.7854013, 
--0.7857813, -0.7859465, -0.7858047, -0.7854354, -0.7850455, -0.7848533, -0.7849663, -0.7853209, -0.7857186, -0.7859366, 
--0.785853, -0.7855149, -0.7851117, -0.7848691, -0.7849228, -0.7852426, -0.7856493, -0.7859151, -0.7858913, -0.7855915, 
--0.7851836, -0.7848961, -0.7848899, -0.7851682, -0.785575, -0.7858826, -0.7859188, -0.7856635, -0.7852598, -0.7849339, 
--0.784868, -0.785099, -0.7854973, -0.7858399, -0.7859349, -0.7857294, -0.7853386, -0.7849814, -0.7848577, -0.7850367, 
--0.7854179, -0.7857878, -0.7859394, -0.7857879, -0.7854183, -0.7850377, -0.7848591, -0.7849824, -0.7853384, -0.7857276, 
--0.7859321, -0.7858376, -0.7854971, -0.7851015, -0.7848721, -0.7849374, -0.7852606, -0.7856606, -0.7859134, -0.7858776, 
--0.7855734, -0.7851713, -0.7848964, -0.7849026, -0.7851862, -0.7855883, -0.7858837, -0.7859071, -0.7856456, -0.7852457, 
--0.7849314, -0.7848786, -0.7851167, -0.7855122, -0.7858436, -0.7859255, -0.7857121, -0.7853231, -0.7849763, -0.7848659, 
--0.7850536, -0.785434, -0.7857942, -0.7859324, -0.7857715, -0.7854016, -0.7850301, -0.7848648, -0.7849982, -0.7853554, 
--0.7857364, -0.7859278, -0.7858226, -0.7854798, -0.7850915, -0.7848751, -0.7849517, -0.7852781, -0.7856716, -0.7859118, 
--0.7858643, -0.7855558, -0.7851593, -0.7848967, -0.784915, -0.7852038, -0.7856012, -0.7858847, -0.7858957, -0.7856281, 
--0.7852319, -0.784929, -0.7848889, -0.7851339, -0.7855267, -0.7858474, -0.7859163, -0.7856952, -0.7853079, -0.7849713, 
--0.7848739, -0.7850701, -0.7854498, -0.7858004, -0.7859257, -0.7857555, -0.7853854, -0.7850226, -0.7848703, -0.7850136, 
--0.7853721, -0.785745, -0.7859236, -0.7858079, -0.7854629, -0.7850818, -0.784878, -0.7849656, -0.7852953, -0.7856824, 
--0.7859102, -0.7858512, -0.7855386, -0.7851476, -0.784897, -0.7849271, -0.785221, -0.7856139, -0.7858858, -0.7858846, 
--0.7856111, -0.7852185, -0.7849267, -0.784899, -0.7851508, -0.785541, -0.785851, -0.7859074, -0.7856786, -0.785293, 
--0.7849664, -0.7848817, -0.7850862, -0.7854653, -0.7858066, -0.7859191, -0.7857399, -0.7853695, -0.7850153, -0.7848756, 
--0.7850286, -0.7853884, -0.7857535, -0.7859195, -0.7857935, -0.7854463, -0.7850722, -0.7848809, -0.7849792, -0.785312, 
--0.785693, -0.7859087, -0.7858385, -0.7855218, -0.785136, -0.7848972, -0.784939, -0.7852378, -0.7856263, -0.7858869, 
--0.7858737, -0.7855944, -0.7852052, -0.7849243, -0.7849088, -0.7851673, -0.7855549, -0.7858546, -0.7858986, -0.7856624, 
--0.7852784, -0.7849616, -0.7848893, -0.785102, -0.7854804, -0.7858126, -0.7859126, -0.7857246, -0.7853538, -0.7850081, 
--0.7848809, -0.7850433, -0.7854044, -0.7857618, -0.7859155, -0.7857795, -0.78543, -0.7850629, -0.7848836, -0.7849925, 
--0.7853285, -0.7857033, -0.7859072, -0.785826, -0.7855053, -0.7851247, -0.7848974, -0.7849506, -0.7852543, -0.7856385, 
--0.7858879, -0.7858631, -0.7855779, -0.7851923, -0.784922, -0.7849184, -0.7851835, -0.7855686, -0.7858582, -0.7858901, 
--0.7856465, -0.785264, -0.7849568, -0.7848968, -0.7851175, -0.7854953, -0.7858186, -0.7859063, -0.7857096, -0.7853385, 
--0.785001, -0.784886, -0.7850578, -0.7854201, -0.78577, -0.7859116, -0.7857657, -0.785414, -0.7850536, -0.7848863, 
--0.7850056, -0.7853446, -0.7857136, -0.7859058, -0.7858137, -0.785489, -0.7851136, -0.7848976, -0.784962, -0.7852706, 
--0.7856505, -0.785889, -0.7858526, -0.7855618, -0.7851795, -0.7849197, -0.7849279, -0.7851994, -0.7855821, -0.7858617, 
--0.7858816, -0.7856309, -0.7852499, -0.7849521, -0.7849041, -0.7851328, -0.78551, -0.7858244, -0.7859001, -0.7856948, 
--0.7853234, -0.784994, -0.784891, -0.785072, -0.7854356, -0.7857781, -0.7859078, -0.7857521, -0.7853983, -0.7850445, 
--0.7848889, -0.7850184, -0.7853606, -0.7857237, -0.7859044, -0.7858016, -0.785473, -0.7851025, -0.7848977, -0.7849732, 
--0.7852866, -0.7856623, -0.7858901, -0.7858423, -0.7855459, -0.7851668, -0.7849174, -0.7849372, -0.7852151, -0.7855954, 
--0.7858652, -0.7858734, -0.7856155, -0.785236, -0.7849474, -0.7849113, -0.7851478, -0.7855245, -0.7858303, -0.7858941, 
--0.7856802, -0.7853084, -0.784987, -0.7848959, -0.785086, -0.7854509, -0.7857861, -0.785904, -0.7857387, -0.7853827, 
--0.7850355, -0.7848914, -0.7850311, -0.7853763, -0.7857337, -0.785903, -0.7857897, -0.7854571, -0.7850917, -0.7848979, 
--0.7849843, -0.7853024, -0.7856741, -0.7858912, -0.7858322, -0.7855302, -0.7851543, -0.7849151, -0.7849464, -0.7852307, 
--0.7856086, -0.7858687, -0.7858652, -0.7856002, -0.7852222, -0.7849427, -0.7849184, -0.7851627, -0.7855388, -0.7858361, 
--0.7858881, -0.7856658, -0.7852937, -0.7849802, -0.7849008, -0.7850999, -0.785466, -0.785794, -0.7859003, -0.7857254, 
--0.7853673, -0.7850265, -0.7848939, -0.7850437, -0.7853919, -0.7857436, -0.7859017, -0.7857779, -0.7854415, -0.7850809, 
--0.784898, -0.7849952, -0.7853181, -0.7856857, -0.7858923, -0.7858221, -0.7855146, -0.7851419, -0.7849128, -0.7849555, 
--0.785246, -0.7856217, -0.7858721, -0.7858571, -0.7855851, -0.7852085, -0.7849381, -0.7849254, -0.7851774, -0.785553, 
--0.7858418, -0.7858821, -0.7856515, -0.785279, -0.7849733, -0.7849056, -0.7851137, -0.785481, -0.7858019, -0.7858967, 
--0.7857123, -0.785352, -0.7850176, -0.7848964, -0.7850561, -0.7854074, -0.7857534, -0.7859005, -0.7857662, -0.7854259, 
--0.7850701, -0.7848981, -0.7850061, -0.7853336, -0.7856972, -0.7858934, -0.7858122, -0.7854992, -0.7851296, -0.7849105, 
--0.7849645, -0.7852613, -0.7856347, -0.7858756, -0.7858491, -0.7855701, -0.7851949, -0.7849335, -0.7849324, -0.785192, 
--0.7855671, -0.7858475, -0.7858763, -0.7856373, -0.7852645, -0.7849665, -0.7849103, -0.7851273, -0.7854959, -0.7858098, 
--0.7858931, -0.7856993, -0.7853368, -0.7850088, -0.7848988, -0.7850685, -0.7854227, -0.7857632, -0.7858992, -0.7857547, 
--0.7854105, -0.7850595, -0.7848981, -0.7850168, -0.785349, -0.7857087, -0.7858945, -0.7858023, -0.7854838, -0.7851174, 
--0.7849082, -0.7849734, -0.7852765, -0.7856476, -0.7858791, -0.7858412, -0.7855552, -0.7851814, -0.7849289, -0.7849392, 
--0.7852066, -0.7855812, -0.7858533, -0.7858705, -0.7856232, -0.78525, -0.7849597, -0.784915, -0.7851409, -0.7855108, 
--0.7858176, -0.7858896, -0.7856863, -0.7853217, -0.785, -0.7849012, -0.7850807, -0.785438, -0.785773, -0.785898, 
--0.7857431, -0.7853951, -0.7850488, -0.7848982, -0.7850275, -0.7853644, -0.7857202, -0.7858956, -0.7857925, -0.7854685, 
--0.7851052, -0.7849059, -0.7849823, -0.7852916, -0.7856605, -0.7858825, -0.7858333, -0.7855404, -0.7851679, -0.7849243, 
--0.7849461, -0.785221, -0.7855952, -0.785859, -0.7858647, -0.7856092, -0.7852355, -0.7849529, -0.7849197, -0.7851544, 
--0.7855256, -0.7858255, -0.785886, -0.7856734, -0.7853066, -0.7849911, -0.7849036, -0.785093, -0.7854533, -0.7857827, 
--0.7858968, -0.7857317, -0.7853798, -0.7850382, -0.7848982, -0.7850382, -0.7853798, -0.7857317, -0.7858968, -0.7857827, 
--0.7854533, -0.785093, -0.7849036, -0.7849911, -0.7853066, -0.7856734, -0.785886, -0.7858255, -0.7855256, -0.7851544, 
--0.7849197, -0.7849529, -0.7852355, -0.7856092, -0.7858647, -0.785859, -0.7855952, -0.785221, -0.7849461, -0.7849243, 
--0.7851679, -0.7855404, -0.7858333, -0.7858825, -0.7856605, -0.7852916, -0.7849823, -0.7849059, -0.7851052, -0.7854685, 
--0.7857925, -0.7858956, -0.7857202, -0.7853644, -0.7850275, -0.7848982, -0.7850488, -0.7853951, -0.7857431, -0.785898, 
--0.785773, -0.785438, -0.7850807, -0.7849012, -0.785, -0.7853217, -0.7856863, -0.7858896, -0.7858176, -0.7855108, 
--0.7851409, -0.784915, -0.7849597, -0.78525, -0.7856232, -0.7858705, -0.7858533, -0.7855812, -0.7852066, -0.7849392, 
--0.7849289, -0.7851814, -0.7855552, -0.7858412, -0.7858791, -0.7856476, -0.7852765, -0.7849734, -0.7849082, -0.7851174, 
--0.7854838, -0.7858023, -0.7858945, -0.7857087, -0.785349, -0.7850168, -0.7848981, -0.7850595, -0.7854105, -0.7857547, 
--0.7858992, -0.7857632, -0.7854227, -0.7850685, -0.7848988, -0.7850088, -0.7853368, -0.7856993, -0.7858931, -0.7858098, 
--0.7854959, -0.7851273, -0.7849103, -0.7849665, -0.7852645, -0.7856373, -0.7858763, -0.7858475, -0.7855671, -0.785192, 
--0.7849324, -0.7849335, -0.7851949, -0.7855701, -0.7858491, -0.7858756, -0.7856347, -0.7852613, -0.7849645, -0.7849105, 
--0.7851296, -0.7854992, -0.7858122, -0.7858934, -0.7856972, -0.7853336, -0.7850061, -0.7848981, -0.7850701, -0.7854259, 
--0.7857662, -0.7859005, -0.7857534, -0.7854074, -0.7850561, -0.7848964, -0.7850176, -0.785352, -0.7857123, -0.7858967, 
--0.7858019, -0.785481, -0.7851137, -0.7849056, -0.7849733, -0.785279, -0.7856515, -0.7858821, -0.7858418, -0.785553, 
--0.7851774, -0.7849254, -0.7849381, -0.7852085, -0.7855851, -0.7858571, -0.7858721, -0.7856217, -0.785246, -0.7849555, 
--0.7849128, -0.7851419, -0.7855146, -0.7858221, -0.7858923, -0.7856857, -0.7853181, -0.7849952, -0.784898, -0.7850809, 
--0.7854415, -0.7857779, -0.7859017, -0.7857436, -0.7853919, -0.7850437, -0.7848939, -0.7850265, -0.7853673, -0.7857254, 
--0.7859003, -0.785794, -0.785466, -0.7850999, -0.7849008, -0.7849802, -0.7852937, -0.7856658, -0.7858881, -0.7858361, 
--0.7855388, -0.7851627, -0.7849184, -0.7849427, -0.7852222, -0.7856002, -0.7858652, -0.7858687, -0.7856086, -0.7852307, 
--0.7849464, -0.7849151, -0.7851543, -0.7855302, -0.7858322, -0.7858912, -0.7856741, -0.7853024, -0.7849843, -0.7848979, 
--0.7850917, -0.7854571, -0.7857897, -0.785903, -0.7857337, -0.7853763, -0.7850311, -0.7848914, -0.7850355, -0.7853827, 
--0.7857387, -0.785904, -0.7857861, -0.7854509, -0.785086, -0.7848959, -0.784987, -0.7853084, -0.7856802, -0.7858941, 
--0.7858303, -0.7855245, -0.7851478, -0.7849113, -0.7849474, -0.785236, -0.7856155, -0.7858734, -0.7858652, -0.7855954, 
--0.7852151, -0.7849372, -0.7849174, -0.7851668, -0.7855459, -0.7858423, -0.7858901, -0.7856623, -0.7852866, -0.7849732, 
--0.7848977, -0.7851025, -0.785473, -0.7858016, -0.7859044, -0.7857237, -0.7853606, -0.7850184, -0.7848889, -0.7850445, 
--0.7853983, -0.7857521, -0.7859078, -0.7857781, -0.7854356, -0.785072, -0.784891, -0.784994, -0.7853234, -0.7856948, 
--0.7859001, -0.7858244, -0.78551, -0.7851328, -0.7849041, -0.7849521, -0.7852499, -0.7856309, -0.7858816, -0.7858617, 
--0.7855821, -0.7851994, -0.7849279, -0.7849197, -0.7851795, -0.7855618, -0.7858526, -0.785889, -0.7856505, -0.7852706, 
--0.784962, -0.7848976, -0.7851136, -0.785489, -0.7858137, -0.7859058, -0.7857136, -0.7853446, -0.7850056, -0.7848863, 
--0.7850536, -0.785414, -0.7857657, -0.7859116, -0.78577, -0.7854201, -0.7850578, -0.784886, -0.785001, -0.7853385, 
--0.7857096, -0.7859063, -0.7858186, -0.7854953, -0.7851175, -0.7848968, -0.7849568, -0.785264, -0.7856465, -0.7858901, 
--0.7858582, -0.7855686, -0.7851835, -0.7849184, -0.784922, -0.7851923, -0.7855779, -0.7858631, -0.7858879, -0.7856385, 
--0.7852543, -0.7849506, -0.7848974, -0.7851247, -0.7855053, -0.785826, -0.7859072, -0.7857033, -0.7853285, -0.7849925, 
--0.7848836, -0.7850629, -0.78543, -0.7857795, -0.7859155, -0.7857618, -0.7854044, -0.7850433, -0.7848809, -0.7850081, 
--0.7853538, -0.7857246, -0.7859126, -0.7858126, -0.7854804, -0.785102, -0.7848893, -0.7849616, -0.7852784, -0.7856624, 
--0.7858986, -0.7858546, -0.7855549, -0.7851673, -0.7849088, -0.7849243, -0.7852052, -0.7855944, -0.7858737, -0.7858869, 
--0.7856263, -0.7852378, -0.784939, -0.7848972, -0.785136, -0.7855218, -0.7858385, -0.7859087, -0.785693, -0.785312, 
--0.7849792, -0.7848809, -0.7850722, -0.7854463, -0.7857935, -0.7859195, -0.7857535, -0.7853884, -0.7850286, -0.7848756, 
--0.7850153, -0.7853695, -0.7857399, -0.7859191, -0.7858066, -0.7854653, -0.7850862, -0.7848817, -0.7849664, -0.785293, 
--0.7856786, -0.7859074, -0.785851, -0.785541, -0.7851508, -0.784899, -0.7849267, -0.7852185, -0.7856111, -0.7858846, 
--0.7858858, -0.7856139, -0.785221, -0.7849271, -0.784897, -0.7851476, -0.7855386, -0.7858512, -0.7859102, -0.7856824, 
--0.7852953, -0.7849656, -0.784878, -0.7850818, -0.7854629, -0.7858079, -0.7859236, -0.785745, -0.7853721, -0.7850136, 
--0.7848703, -0.7850226, -0.7853854, -0.7857555, -0.7859257, -0.7858004, -0.7854498, -0.7850701, -0.7848739, -0.7849713, 
--0.7853079, -0.7856952, -0.7859163, -0.7858474, -0.7855267, -0.7851339, -0.7848889, -0.784929, -0.7852319, -0.7856281, 
--0.7858957, -0.7858847, -0.7856012, -0.7852038, -0.784915, -0.7848967, -0.7851593, -0.7855558, -0.7858643, -0.7859118, 
--0.7856716, -0.7852781, -0.7849517, -0.7848751, -0.7850915, -0.7854798, -0.7858226, -0.7859278, -0.7857364, -0.7853554, 
--0.7849982, -0.7848648, -0.7850301, -0.7854016, -0.7857715, -0.7859324, -0.7857942, -0.785434, -0.7850536, -0.7848659, 
--0.7849763, -0.7853231, -0.7857121, -0.7859255, -0.7858436, -0.7855122, -0.7851167, -0.7848786, -0.7849314, -0.7852457, 
--0.7856456, -0.7859071, -0.7858837, -0.7855883, -0.7851862, -0.7849026, -0.7848964, -0.7851713, -0.7855734, -0.7858776, 
--0.7859134, -0.7856606, -0.7852606, -0.7849374, -0.7848721, -0.7851015, -0.7854971, -0.7858376, -0.7859321, -0.7857276, 
--0.7853384, -0.7849824, -0.7848591, -0.7850377, -0.7854183, -0.7857879, -0.7859394, -0.7857878, -0.7854179, -0.7850367, 
--0.7848577, -0.7849814, -0.7853386, -0.7857294, -0.7859349, -0.7858399, -0.7854973, -0.785099, -0.784868, -0.7849339, 
--0.7852598, -0.7856635, -0.7859188, -0.7858826, -0.785575, -0.7851682, -0.7848899, -0.7848961, -0.7851836, -0.7855915, 
--0.7858913, -0.7859151, -0.7856493, -0.7852426, -0.7849228, -0.7848691, -0.7851117, -0.7855149, -0.785853, -0.7859366, 
--0.7857186, -0.7853209, -0.7849663, -0.7848533, -0.7850455, -0.7854354, -0.7858047, -0.7859465, -0.7857813, -0.7854013, 
--0.7850193, -0.7848493, -0.7849866, -0.7853546, -0.7857472, -0.7859446, -0.785836, -0.785482, -0.7850808, -0.7848571, 
--0.7849363, -0.7852743, -0.7856819, -0.7859308, -0.7858815, -0.7855614, -0.7851496, -0.7848767, -0.7848958, -0.7851963, 
--0.7856101, -0.7859055, -0.7859169, -0.7856377, -0.7852242, -0.7849078, -0.7848659, -0.7851221, -0.7855332, -0.785869, 
--0.7859412, -0.7857093, -0.7853029, -0.7849496, -0.7848473, -0.7850535, -0.785453, -0.785822, -0.7859539, -0.7857745, 
--0.7853842, -0.7850014, -0.7848406, -0.784992, -0.7853711, -0.7857656, -0.7859546, -0.785832, -0.7854663, -0.7850621, 
--0.7848459, -0.7849389, -0.7852892, -0.7857009, -0.7859433, -0.7858805, -0.7855474, -0.7851305, -0.7848632, -0.7848954, 
--0.7852093, -0.7856292, -0.78592, -0.7859187, -0.7856258, -0.7852051, -0.7848922, -0.7848625, -0.7851329, -0.7855521, 
--0.7858854, -0.785946, -0.7856998, -0.7852844, -0.7849324, -0.7848411, -0.7850618, -0.7854711, -0.7858399, -0.7859615, 
--0.7857676, -0.7853666, -0.7849829, -0.7848316, -0.7849975, -0.785388, -0.7857846, -0.785965, -0.785828, -0.7854501, 
--0.7850428, -0.7848343, -0.7849415, -0.7853046, -0.7857205, -0.7859561, -0.7858794, -0.785533, -0.7851108, -0.7848492, 
--0.784895, -0.7852227, -0.785649, -0.7859351, -0.7859207, -0.7856135, -0.7851854, -0.7848761, -0.7848591, -0.785144, 
--0.7855716, -0.7859024, -0.785951, -0.7856899, -0.7852652, -0.7849146, -0.7848346, -0.7850703, -0.7854899, -0.7858584, 
--0.7859695, -0.7857605, -0.7853484, -0.7849638, -0.7848222, -0.7850032, -0.7854056, -0.7858042, -0.7859757, -0.7858238, 
--0.7854333, -0.7850228, -0.7848222, -0.7849441, -0.7853205, -0.7857408, -0.7859694, -0.7858783, -0.785518, -0.7850903, 
--0.7848347, -0.7848945, -0.7852366, -0.7856695, -0.7859508, -0.7859227, -0.7856008, -0.785165, -0.7848595, -0.7848555, 
--0.7851555, -0.7855918, -0.78592, -0.7859561, -0.7856797, -0.7852453, -0.7848961, -0.7848279, -0.7850791, -0.7855093, 
--0.7858776, -0.7859777, -0.7857532, -0.7853295, -0.7849439, -0.7848125, -0.785009, -0.7854238, -0.7858246, -0.7859868, 
--0.7858195, -0.7854159, -0.785002, -0.7848097, -0.7849469, -0.7853371, -0.7857619, -0.7859833, -0.7858771, -0.7855025, 
--0.7850691, -0.7848196, -0.784894, -0.785251, -0.7856908, -0.785967, -0.7859249, -0.7855875, -0.7851438, -0.7848421, 
--0.7848517, -0.7851674, -0.7856128, -0.7859383, -0.7859615, -0.7856691, -0.7852246, -0.7848769, -0.7848209, -0.7850882, 
--0.7855295, -0.7858976, -0.7859863, -0.7857455, -0.7853099, -0.7849233, -0.7848024, -0.7850151, -0.7854427, -0.7858458, 
--0.7859985, -0.785815, -0.7853978, -0.7849803, -0.7847966, -0.7849497, -0.7853542, -0.7857838, -0.7859977, -0.785876, 
--0.7854864, -0.7850469, -0.7848038, -0.7848935, -0.785266, -0.7857129, -0.785984, -0.7859271, -0.7855738, -0.7851217, 
--0.784824, -0.7848477, -0.7851799, -0.7856347, -0.7859574, -0.7859672, -0.7856581, -0.7852031, -0.7848569, -0.7848136, 
--0.7850977, -0.7855506, -0.7859185, -0.7859953, -0.7857376, -0.7852894, -0.7849017, -0.7847918, -0.7850214, -0.7854624, 
--0.7858679, -0.7860106, -0.7858103, -0.7853789, -0.7849578, -0.7847829, -0.7849526, -0.7853722, -0.7858067, -0.7860128, 
--0.7858748, -0.7854695, -0.7850238, -0.7847874, -0.7848929, -0.7852816, -0.7857361, -0.7860017, -0.7859295, -0.7855594, 
--0.7850986, -0.7848051, -0.7848436, -0.7851928, -0.7856575, -0.7859774, -0.7859731, -0.7856466, -0.7851806, -0.7848359, 
--0.7848059, -0.7851077, -0.7855726, -0.7859403, -0.7860047, -0.7857293, -0.785268, -0.7848792, -0.7847807, -0.785028, 
--0.7854831, -0.7858911, -0.7860234, -0.7858055, -0.7853591, -0.7849341, -0.7847686, -0.7849557, -0.7853909, -0.7858307, 
--0.7860287, -0.7858736, -0.7854519, -0.7849996, -0.7847701, -0.7848923, -0.785298, -0.7857604, -0.7860203, -0.785932, 
--0.7855444, -0.7850744, -0.7847853, -0.7848392, -0.7852064, -0.7856815, -0.7859984, -0.7859793, -0.7856346, -0.785157, 
--0.7848139, -0.7847978, -0.7851181, -0.7855957, -0.7859632, -0.7860146, -0.7857206, -0.7852456, -0.7848555, -0.784769, 
--0.7850349, -0.7855047, -0.7859154, -0.7860367, -0.7858004, -0.7853384, -0.7849093, -0.7847536, -0.7849589, -0.7854106, 
--0.7858559, -0.7860453, -0.7858723, -0.7854334, -0.7849742, -0.784752, -0.7848916, -0.7853152, -0.7857859, -0.7860399, 
--0.7859346, -0.7855286, -0.785049, -0.7847644, -0.7848346, -0.7852207, -0.7857067, -0.7860205, -0.7859859, -0.785622, 
--0.7851322, -0.7847908, -0.7847893, -0.785129, -0.78562, -0.7859873, -0.786025, -0.7857115, -0.785222, -0.7848306, 
--0.7847567, -0.7850422, -0.7855275, -0.785941, -0.7860509, -0.7857951, -0.7853165, -0.7848831, -0.7847377, -0.7849622, 
--0.7854313, -0.7858825, -0.7860628, -0.785871, -0.7854139, -0.7849474, -0.7847329, -0.7848908, -0.7853333, -0.7858128, 
--0.7860605, -0.7859374, -0.785512, -0.7850222, -0.7847424, -0.7848297, -0.7852357, -0.7857333, -0.7860438, -0.7859929, 
--0.7856087, -0.785106, -0.7847663, -0.7847803, -0.7851405, -0.7856456, -0.7860128, -0.786036, -0.7857019, -0.785197, 
--0.7848042, -0.7847437, -0.7850498, -0.7855516, -0.7859681, -0.7860658, -0.7857895, -0.7852935, -0.7848554, -0.7847209, 
--0.7849657, -0.7854532, -0.7859106, -0.7860814, -0.7858696, -0.7853933, -0.784919, -0.7847126, -0.78489, -0.7853525, 
--0.7858412, -0.7860824, -0.7859404, -0.7854944, -0.7849938, -0.7847191, -0.7848245, -0.7852516, -0.7857614, -0.7860684, 
--0.7860003, -0.7855946, -0.7850782, -0.7847404, -0.7847707, -0.7851527, -0.7856728, -0.7860398, -0.7860478, -0.7856917, 
--0.7851706, -0.7847763, -0.7847299, -0.7850579, -0.7855771, -0.7859968, -0.7860817, -0.7857836, -0.785269, -0.7848261, 
--0.7847031, -0.7849694, -0.7854764, -0.7859404, -0.7861011, -0.7858682, -0.7853715, -0.7848889, -0.7846911, -0.7848891, 
--0.7853728, -0.7858714, -0.7861056, -0.7859436, -0.7854758, -0.7849637, -0.7846943, -0.784819, -0.7852684, -0.7857913, 
--0.7860947, -0.7860082, -0.7855796, -0.7850487, -0.7847128, -0.7847605, -0.7851656, -0.7857017, -0.7860685, -0.7860602, 
--0.7856809, -0.7851425, -0.7847465, -0.7847151, -0.7850665, -0.7856043, -0.7860274, -0.7860986, -0.7857773, -0.785243, 
--0.7847948, -0.7846841, -0.7849733, -0.7855012, -0.7859721, -0.7861222, -0.7858667, -0.7853482, -0.7848569, -0.7846681, 
--0.7848882, -0.7853945, -0.7859036, -0.7861304, -0.7859471, -0.7854559, -0.7849315, -0.7846678, -0.784813, -0.7852864, 
--0.7858232, -0.7861227, -0.7860166, -0.7855637, -0.7850173, -0.7846834, -0.7847496, -0.7851794, -0.7857325, -0.7860992, 
--0.7860736, -0.7856694, -0.7851125, -0.7847148, -0.7846994, -0.7850756, -0.7856333, -0.7860601, -0.7861167, -0.7857706, 
--0.7852152, -0.7847614, -0.7846637, -0.7849775, -0.7855276, -0.7860061, -0.7861447, -0.7858651, -0.7853233, -0.7848225, 
--0.7846435, -0.7848871, -0.7854176, -0.7859381, -0.7861569, -0.7859508, -0.7854346, -0.7848971, -0.7846395, -0.7848066, 
--0.7853057, -0.7858574, -0.7861527, -0.7860256, -0.7855466, -0.7849836, -0.7846519, -0.7847379, -0.7851941, -0.7857656, 
--0.7861321, -0.7860879, -0.7856571, -0.7850803, -0.7846807, -0.7846825, -0.7850854, -0.7856644, -0.7860952, -0.7861361, 
--0.7857634, -0.7851854, -0.7847255, -0.7846418, -0.784982, -0.785556, -0.7860426, -0.7861689, -0.7858634, -0.7852966, 
--0.7847857, -0.7846171, -0.784886, -0.7854425, -0.7859752, -0.7861854, -0.7859548, -0.7854117, -0.78486, -0.7846089, 
--0.7847998, -0.7853264, -0.7858942, -0.7861851, -0.7860354, -0.7855283, -0.7849472, -0.7846179, -0.7847252, -0.78521, 
--0.7858012, -0.7861676, -0.7861034, -0.7856438, -0.7850456, -0.7846439, -0.7846642, -0.785096, -0.7856979, -0.786133, 
--0.7861571, -0.7857557, -0.7851532, -0.7846868, -0.7846182, -0.7849867, -0.7855866, -0.786082, -0.786195, -0.7858616, 
--0.7852678, -0.7847458, -0.7845885, -0.7848847, -0.7854694, -0.7860152, -0.7862163, -0.7859591, -0.785387, -0.78482, 
--0.784576, -0.7847923, -0.7853487, -0.785934, -0.78622, -0.786046, -0.7855084, -0.784908, -0.7845811, -0.7847116, 
--0.7852272, -0.7858397, -0.786206, -0.7861201, -0.7856294, -0.7850081, -0.7846041, -0.7846444, -0.7851074, -0.7857343, 
--0.7861741, -0.7861798, -0.7857474, -0.7851183, -0.7846448, -0.7845926, -0.7849919, -0.7856198, -0.7861247, -0.7862234, 
--0.7858597, -0.7852365, -0.7847026, -0.7845575, -0.7848834, -0.7854985, -0.7860587, -0.7862498, -0.7859639, -0.7853602, 
--0.7847765, -0.7845401, -0.7847842, -0.785373, -0.7859772, -0.7862581, -0.7860575, -0.7854869, -0.7848653, -0.7845411, 
--0.7846967, -0.7852458, -0.7858816, -0.7862477, -0.7861384, -0.7856138, -0.7849672, -0.7845608, -0.7846229, -0.7851198, 
--0.7857738, -0.7862187, -0.7862046, -0.7857383, -0.7850803, -0.784599, -0.7845647, -0.7849976, -0.785656, -0.7861713, 
--0.7862544, -0.7858576, -0.7852024, -0.7846554, -0.7845237, -0.7848818, -0.7855303, -0.7861062, -0.7862864, -0.7859691, 
--0.7853309, -0.784729, -0.7845009, -0.7847753, -0.7853995, -0.7860244, -0.7862996, -0.7860701, -0.7854633, -0.7848186, 
--0.7844973, -0.7846803, -0.7852662, -0.7859275, -0.7862935, -0.7861584, -0.7855968, -0.7849225, -0.7845133, -0.7845993, 
--0.7851334, -0.7858172, -0.7862677, -0.7862318, -0.7857284, -0.7850387, -0.7845489, -0.7845341, -0.7850037, -0.7856956, 
--0.7862224, -0.7862883, -0.7858553, -0.7851649, -0.7846037, -0.7844865, -0.7848802, -0.7855652, -0.7861583, -0.7863266, 
--0.7859748, -0.7852988, -0.7846768, -0.7844578, -0.7847655, -0.7854287, -0.7860764, -0.7863454, -0.786084, -0.7854374, 
--0.7847672, -0.7844491, -0.7846624, -0.7852887, -0.785978, -0.7863439, -0.7861804, -0.785578, -0.7848732, -0.784461, 
--0.7845732, -0.7851483, -0.7858649, -0.7863217, -0.7862617, -0.7857174, -0.7849927, -0.7844935, -0.7845003, -0.7850105, 
--0.7857394, -0.7862789, -0.7863259, -0.7858528, -0.7851236, -0.7845464, -0.7844454, -0.7848783, -0.7856038, -0.786216, 
--0.7863711, -0.7859811, -0.7852632, -0.7846191, -0.7844101, -0.7847547, -0.7854609, -0.7861339, -0.786396, -0.7860994, 
--0.7854087, -0.7847103, -0.7843957, -0.7846424, -0.7853136, -0.7860339, -0.7863997, -0.7862049, -0.7855571, -0.7848185, 
--0.7844029, -0.7845443, -0.7851649, -0.785918, -0.7863816, -0.7862951, -0.7857053, -0.7849417, -0.784432, -0.7844627, 
--0.785018, -0.7857881, -0.7863416, -0.7863676, -0.78585, -0.7850776, -0.7844828, -0.7843996, -0.7848762, -0.7856468, 
--0.7862802, -0.7864207, -0.7859882, -0.7852236, -0.7845547, -0.784357, -0.7847426, -0.7854969, -0.786198, -0.7864526, 
--0.7861165, -0.7853767, -0.7846468, -0.7843361, -0.7846202, -0.7853414, -0.7860965, -0.7864622, -0.7862322, -0.7855338, 
--0.7847573, -0.784338, -0.7845119, -0.7851834, -0.7859773, -0.7864487, -0.7863323, -0.7856917, -0.7848845, -0.784363, 
--0.7844205, -0.7850265, -0.7858427, -0.786412, -0.7864145, -0.7858469, -0.785026, -0.7844113, -0.7843483, -0.7848738, 
--0.7856951, -0.7863523, -0.7864763, -0.7859961, -0.785179, -0.7844824, -0.7842972, -0.784729, -0.7855374, -0.7862702, 
--0.7865162, -0.7861359, -0.7853407, -0.7845752, -0.784269, -0.7845951, -0.7853727, -0.786167, -0.7865325, -0.786263, 
--0.7855076, -0.7846884, -0.7842647, -0.7844754, -0.7852044, -0.7860443, -0.7865245, -0.7863745, -0.7856763, -0.78482, 
--0.7842851, -0.7843729, -0.785036, -0.7859044, -0.7864916, -0.7864674, -0.7858434, -0.7849676, -0.7843305, -0.7842901, 
--0.7848712, -0.7857497, -0.786434, -0.7865394, -0.7860051, -0.7851285, -0.7844003, -0.7842294, -0.7847135, -0.7855833, 
--0.7863521, -0.7865884, -0.7861578, -0.7852997, -0.7844939, -0.7841927, -0.7845666, -0.7854083, -0.7862471, -0.7866126, 
--0.7862981, -0.7854777, -0.7846099, -0.7841813, -0.7844339, -0.7852282, -0.7861207, -0.7866109, -0.7864225, -0.7856588, 
--0.7847463, -0.7841962, -0.7843185, -0.7850469, -0.7859749, -0.7865826, -0.786528, -0.7858394, -0.7849008, -0.784238, 
--0.7842236, -0.7848681, -0.7858123, -0.7865275, -0.7866117, -0.7860154, -0.7850707, -0.7843063, -0.7841517, -0.7846958, 
--0.785636, -0.7864461, -0.7866713, -0.786183, -0.7852527, -0.7844005, -0.784105, -0.7845338, -0.7854492, -0.7863393, 
--0.7867047, -0.7863384, -0.7854433, -0.7845194, -0.7840852, -0.784386, -0.7852557, -0.7862087, -0.7867105, -0.7864779, 
--0.7856386, -0.7846612, -0.7840936, -0.7842558, -0.7850595, -0.7860563, -0.7866877, -0.786598, -0.7858347, -0.7848235, 
--0.7841309, -0.7841466, -0.7848646, -0.7858848, -0.7866359, -0.7866954, -0.7860273, -0.7850035, -0.7841972, -0.7840615, 
--0.7846753, -0.7856971, -0.7865553, -0.7867676, -0.7862123, -0.785198, -0.7842919, -0.7840029, -0.7844957, -0.7854969, 
--0.7864467, -0.786812, -0.7863854, -0.7854031, -0.784414, -0.7839731, -0.7843301, -0.7852879, -0.7863115, -0.7868269, 
--0.7865426, -0.7856149, -0.7845618, -0.7839736, -0.7841824, -0.7850743, -0.7861517, -0.7868108, -0.7866799, -0.7858292, 
--0.7847329, -0.7840053, -0.7840563, -0.7848605, -0.78597, -0.7867632, -0.7867938, -0.7860413, -0.7849246, -0.7840688, 
--0.7839554, -0.7846512, -0.7857693, -0.786684, -0.7868811, -0.7862468, -0.7851334, -0.7841637, -0.7838825, -0.7844508, 
--0.7855533, -0.7865736, -0.7869388, -0.786441, -0.7853556, -0.7842892, -0.7838404, -0.7842639, -0.785326, -0.7864334, 
--0.7869648, -0.7866193, -0.7855868, -0.7844436, -0.783831, -0.7840951, -0.7850919, -0.7862652, -0.7869573, -0.7867775, 
--0.7858225, -0.7846249, -0.7838557, -0.7839487, -0.7848557, -0.7860716, -0.7869153, -0.7869113, -0.786058, -0.7848301, 
--0.7839153, -0.7838284, -0.7846223, -0.7858557, -0.7868381, -0.7870171, -0.786288, -0.7850559, -0.7840098, -0.783738, 
--0.7843968, -0.7856211, -0.7867263, -0.7870914, -0.7865077, -0.7852982, -0.7841388, -0.7836805, -0.7841843, -0.7853721, 
--0.7865806, -0.7871314, -0.7867119, -0.7855527, -0.7843007, -0.7836585, -0.7839897, -0.7851134, -0.7864028, -0.7871349, 
--0.7868957, -0.7858144, -0.7844937, -0.7836739, -0.7838179, -0.78485, -0.7861954, -0.7871003, -0.7870543, -0.7860781, 
--0.7847149, -0.783728, -0.7836736, -0.7845873, -0.7859613, -0.7870266, -0.7871833, -0.7863384, -0.7849609, -0.7838213, 
--0.7835609, -0.7843308, -0.7857044, -0.7869137, -0.7872787, -0.7865897, -0.7852276, -0.7839536, -0.7834837, -0.7840862, 
--0.785429, -0.7867622, -0.787337, -0.7868262, -0.7855104, -0.784124, -0.7834451, -0.7838592, -0.7851401, -0.7865734, 
--0.7873551, -0.7870423, -0.7858041, -0.7843306, -0.7834479, -0.7836554, -0.784843, -0.7863496, -0.7873309, -0.7872325, 
--0.7861031, -0.7845709, -0.7834939, -0.7834801, -0.7845436, -0.7860937, -0.7872627, -0.7873916, -0.7864015, -0.7848415, 
--0.7835844, -0.7833383, -0.7842479, -0.7858094, -0.7871499, -0.7875148, -0.7866929, -0.7851383, -0.7837197, -0.7832349, 
--0.7839624, -0.7855013, -0.7869923, -0.7875975, -0.7869709, -0.7854565, -0.7838993, -0.7831739, -0.7836934, -0.7851743, 
--0.786791, -0.7876359, -0.7872292, -0.7857908, -0.7841219, -0.7831588, -0.7834474, -0.7848343, -0.7865476, -0.7876269, 
--0.7874612, -0.786135, -0.7843854, -0.7831925, -0.7832309, -0.7844875, -0.7862649, -0.7875679, -0.7876608, -0.7864827, 
--0.7846865, -0.7832772, -0.7830497, -0.7841406, -0.7859463, -0.7874573, -0.787822, -0.786827, -0.7850214, -0.783414, 
--0.7829099, -0.7838007, -0.7855963, -0.7872942, -0.7879391, -0.7871606, -0.7853853, -0.7836034, -0.7828167, -0.7834752, 
--0.7852199, -0.7870786, -0.7880072, -0.7874762, -0.7857726, -0.7838448, -0.782775, -0.7831715, -0.7848232, -0.7868117, 
--0.7880215, -0.7877661, -0.786177, -0.7841368, -0.7827889, -0.7828972, -0.7844128, -0.7864953, -0.7879784, -0.788023, 
--0.7865916, -0.7844768, -0.782862, -0.7826597, -0.7839959, -0.7861325, -0.7878748, -0.7882393, -0.7870089, -0.7848615, 
--0.7829968, -0.7824663, -0.7835803, -0.7857271, -0.7877083, -0.7884079, -0.7874207, -0.7852864, -0.7831953, -0.7823241, 
--0.7831744, -0.7852839, -0.7874776, -0.788522, -0.7878186, -0.7857464, -0.7834583, -0.7822397, -0.7827867, -0.7848088, 
--0.7871823, -0.7885752, -0.7881938, -0.7862351, -0.7837857, -0.7822192, -0.7824262, -0.7843082, -0.786823, -0.7885616, 
--0.7885373, -0.7867456, -0.7841766, -0.7822683, -0.782102, -0.7837897, -0.7864011, -0.7884757, -0.7888399, -0.78727, 
--0.784629, -0.782392, -0.7818233, -0.7832615, -0.785919, -0.7883131, -0.7890924, -0.7877999, -0.7851398, -0.7825947, 
--0.7815993, -0.7827323, -0.7853803, -0.7880695, -0.7892856, -0.788326, -0.7857053, -0.78288, -0.7814393, -0.7822117, 
--0.7847892, -0.7877417, -0.7894102, -0.7888385, -0.7863207, -0.783251, -0.7813523, -0.7817098, -0.784151, -0.787327, 
--0.7894572, -0.7893271, -0.7869802, -0.78371, -0.7813476, -0.7812372, -0.7834717, -0.7868232, -0.7894174, -0.789781, 
--0.7876777, -0.7842589, -0.7814341, -0.780805, -0.7827579, -0.7862287, -0.7892818, -0.7901887, -0.788406, -0.7848992, 
--0.7816211, -0.7804248, -0.782017, -0.7855423, -0.7890411, -0.7905384, -0.7891575, -0.7856322, -0.7819181, -0.7801088, 
--0.7812568, -0.7847625, -0.7886854, -0.7908174, -0.7899243, -0.7864592, -0.7823351, -0.7798701, -0.7804855, -0.7838878, 
--0.7882042, -0.7910123, -0.7906981, -0.7873823, -0.7828835, -0.7797226, -0.7797113, -0.7829156, -0.7875853, -0.7911084, 
--0.7914705, -0.7884046, -0.7835766, -0.779682, -0.7789427, -0.7818417, -0.7868139, -0.7910892, -0.7922332, -0.7895318, 
--0.7844309, -0.779766, -0.7781878, -0.7806589, -0.7858712, -0.790935, -0.7929784, -0.7907732, -0.7854685, -0.7799963, 
--0.7774542, -0.779355, -0.7847312, -0.7906218, -0.7936989, -0.7921447, -0.7867199, -0.7804003, -0.7767484, -0.7779095, 
--0.7833572, -0.7901177, -0.7943888, -0.7936725, -0.7882304, -0.7810154, -0.7760753, -0.7762883, -0.781693, -0.7893784, 
--0.7950446, -0.7954013, -0.7900701, -0.7818956, -0.7754367, -0.7744331, -0.7796497, -0.7883366, -0.7956669, -0.7974081, 
--0.7923537, -0.7831255, -0.7748285, -0.7722409, -0.7770768, -0.7868836, -0.7962648, -0.7998323, -0.7952822, -0.7848482, 
--0.7742343, -0.7695194, -0.7737004, -0.7848269, -0.7968664, -0.8029449, -0.7992384, -0.7873299, -0.7736069, -0.7658762, 
--0.7689697, -0.781787, -0.7975515, -0.8073342, -0.8050438, -0.7911316, -0.7728068, -0.7603901, -0.7616027, -0.7768968, 
--0.7985766, -0.8145267, -0.8148169, -0.7976692, -0.7713237, -0.7503327, -0.7478201, -0.767671, -0.8010814, -0.8299499, 
--0.8360721, -0.811755, -0.7661244, -0.7229732, -0.7099503, -0.7434072, -0.8160204, -0.8938317, -0.9255307, -0.8612613, 
--0.6735256, -0.3711808, 0.0, 0.3711809, 0.6735258, 0.8612618, 0.9255315, 0.8938323, 0.8160202, 0.7434061, 
-0.7099487, 0.7229719, 0.7661243, 0.8117564, 0.8360744, 0.8299519, 0.8010819, 0.7676694, 0.7478171, 0.7503299, 
-0.7713228, 0.797671, 0.8148206, 0.8145303, 0.798578, 0.776895, 0.7615984, 0.7603856, 0.7728048, 0.7911333, 
-0.8050486, 0.8073396, 0.7975543, 0.7817854, 0.7689645, 0.7658701, 0.7736033, 0.7873311, 0.799244, 0.8029519, 
-0.7968709, 0.7848262, 0.7736946, 0.7695116, 0.7742289, 0.7848484, 0.7952882, 0.799841, 0.7962712, 0.7868841, 
-0.7770708, 0.7722315, 0.7748211, 0.7831242, 0.7923597, 0.7974182, 0.7956755, 0.7883387, 0.779644, 0.7744224, 
-0.775427, 0.7818924, 0.7900755, 0.7954125, 0.7950553, 0.7893826, 0.7816881, 0.7762768, 0.7760635, 0.78101, 
-0.7882348, 0.7936844, 0.7944016, 0.7901243, 0.7833535, 0.7778975, 0.7767345, 0.7803925, 0.7867227, 0.7921568, 
-0.7937137, 0.790631, 0.7847295, 0.7793429, 0.7774385, 0.7799857, 0.7854691, 0.790785, 0.792995, 0.790947, 
-0.7858717, 0.7806474, 0.7781706, 0.7797526, 0.784429, 0.7895427, 0.7922511, 0.791104, 0.7868173, 0.7818314, 
-0.7789243, 0.7796657, 0.7835717, 0.7884141, 0.7914893, 0.7911261, 0.7875918, 0.7829071, 0.7796923, 0.7797036, 
-0.7828753, 0.7873897, 0.7907173, 0.7910326, 0.7882142, 0.7838816, 0.7804664, 0.7798486, 0.7823234, 0.786464, 
-0.7899432, 0.79084, 0.788699, 0.7847592, 0.7812383, 0.7800852, 0.7819027, 0.7856338, 0.7891755, 0.7905628, 
-0.7890583, 0.7855425, 0.7819998, 0.7803995, 0.781602, 0.7848971, 0.7884223, 0.7902146, 0.7893028, 0.7862329, 
-0.7827426, 0.7807786, 0.7814114, 0.7842527, 0.7876917, 0.7898076, 0.7894418, 0.7868316, 0.7834591, 0.7812105, 
-0.7813216, 0.7836994, 0.7869912, 0.7893539, 0.7894848, 0.7873399, 0.7841418, 0.7816834, 0.7813233, 0.7832357, 
-0.786328, 0.7888645, 0.7894405, 0.7877593, 0.784784, 0.7821864, 0.7814078, 0.7828601, 0.7857083, 0.7883505, 
-0.7893181, 0.7880917, 0.7853796, 0.7827088, 0.781566, 0.7825702, 0.785138, 0.7878221, 0.7891264, 0.7883398, 
-0.7859234, 0.7832408, 0.7817889, 0.7823631, 0.7846219, 0.7872891, 0.7888746, 0.7885067, 0.7864109, 0.7837726, 
-0.7820673, 0.7822354, 0.784164, 0.7867607, 0.7885719, 0.7885964, 0.7868384, 0.7842954, 0.7823921, 0.7821827, 
-0.7837674, 0.7862455, 0.7882273, 0.7886132, 0.7872035, 0.784801, 0.7827541, 0.7822003, 0.7834342, 0.7857513, 
-0.78785, 0.7885626, 0.7875045, 0.7852819, 0.7831443, 0.7822826, 0.7831657, 0.7852854, 0.7874491, 0.7884501, 
-0.7877406, 0.7857313, 0.7835538, 0.7824236, 0.7829619, 0.7848541, 0.7870334, 0.7882822, 0.7879122, 0.7861433, 
-0.7839737, 0.7826167, 0.7828222, 0.7844627, 0.7866113, 0.7880656, 0.7880204, 0.7865129, 0.784396, 0.7828551, 
-0.782745, 0.7841158, 0.7861909, 0.7878074, 0.7880673, 0.7868362, 0.7848125, 0.7831313, 0.7827277, 0.783817, 
-0.78578, 0.787515, 0.7880558, 0.7871098, 0.785216, 0.7834381, 0.782767, 0.7835689, 0.7853855, 0.7871958, 
-0.7879897, 0.7873318, 0.7855998, 0.7837678, 0.7828588, 0.7833733, 0.785014, 0.7868575, 0.7878734, 0.7875009, 
-0.7859576, 0.7841129, 0.7829983, 0.7832308, 0.7846712, 0.7865074, 0.7877119, 0.7876169, 0.7862842, 0.784466, 
-0.7831804, 0.7831413, 0.784362, 0.786153, 0.7875107, 0.7876803, 0.786575, 0.78482, 0.7833993, 0.7831035, 
-0.7840906, 0.7858011, 0.7872757, 0.7876928, 0.7868262, 0.785168, 0.7836488, 0.7831157, 0.7838602, 0.7854586, 
-0.7870133, 0.7876566, 0.7870351, 0.7855036, 0.7839226, 0.7831751, 0.7836733, 0.7851315, 0.7867298, 0.7875749, 
-0.7871996, 0.7858208, 0.7842142, 0.7832782, 0.7835315, 0.7848255, 0.7864317, 0.7874514, 0.7873187, 0.7861143, 
-0.784517, 0.783421, 0.7834353, 0.7845456, 0.7861257, 0.7872905, 0.787392, 0.7863795, 0.7848247, 0.7835988, 
-0.7833846, 0.7842961, 0.785818, 0.787097, 0.7874202, 0.7866124, 0.7851308, 0.7838066, 0.7833785, 0.7840806, 
-0.7855148, 0.7868762, 0.7874048, 0.7868098, 0.7854296, 0.7840391, 0.783415, 0.7839019, 0.785222, 0.7866336, 
-0.7873478, 0.7869693, 0.7857152, 0.7842905, 0.7834917, 0.783762, 0.7849448, 0.7863749, 0.7872521, 0.7870894, 
-0.7859827, 0.784555, 0.7836055, 0.7836621, 0.7846882, 0.7861059, 0.7871212, 0.7871691, 0.7862274, 0.784827, 
-0.7837525, 0.7836026, 0.7844565, 0.7858324, 0.7869591, 0.7872084, 0.7864452, 0.7851006, 0.7839287, 0.7835832, 
-0.7842534, 0.78556, 0.7867701, 0.7872081, 0.7866328, 0.7853704, 0.7841292, 0.7836028, 0.7840818, 0.7852942, 
-0.7865592, 0.7871697, 0.7867876, 0.7856309, 0.7843494, 0.7836595, 0.7839442, 0.7850401, 0.7863312, 0.7870953, 
-0.7869077, 0.7858774, 0.7845839, 0.7837509, 0.7838421, 0.7848024, 0.7860915, 0.7869876, 0.7869917, 0.7861053, 
-0.7848275, 0.783874, 0.7837763, 0.7845853, 0.7858452, 0.78685, 0.7870393, 0.7863106, 0.7850751, 0.7840252, 
-0.7837469, 0.7843926, 0.7855976, 0.7866862, 0.7870506, 0.78649, 0.7853215, 0.7842005, 0.7837534, 0.7842273, 
-0.7853537, 0.7865005, 0.7870266, 0.7866406, 0.7855616, 0.7843956, 0.7837944, 0.784092, 0.7851184, 0.7862972, 
-0.786969, 0.7867602, 0.7857909, 0.7846058, 0.7838681, 0.7839884, 0.7848963, 0.7860812, 0.7868799, 0.7868474, 
-0.7860049, 0.7848265, 0.783972, 0.7839178, 0.7846913, 0.7858571, 0.786762, 0.7869013, 0.7861998, 0.7850528, 
-0.784103, 0.7838806, 0.7845073, 0.7856298, 0.7866187, 0.7869219, 0.7863721, 0.7852799, 0.7842576, 0.7838766, 
-0.7843474, 0.785404, 0.7864536, 0.7869096, 0.786519, 0.7855032, 0.7844322, 0.7839049, 0.7842142, 0.7851843, 
-0.7862707, 0.7868656, 0.7866381, 0.7857182, 0.7846224, 0.7839641, 0.7841097, 0.7849751, 0.7860742, 0.7867917, 
-0.7867277, 0.7859206, 0.7848241, 0.7840521, 0.7840352, 0.7847804, 0.7858686, 0.7866902, 0.7867868, 0.7861067, 
-0.7850327, 0.7841664, 0.7839916, 0.7846037, 0.7856582, 0.7865639, 0.786815, 0.7862731, 0.7852437, 0.7843039, 
-0.7839789, 0.7844484, 0.7854475, 0.786416, 0.7868124, 0.7864168, 0.7854529, 0.7844613, 0.7839966, 0.784317, 
-0.785241, 0.7862501, 0.7867798, 0.7865354, 0.7856558, 0.7846348, 0.7840436, 0.7842117, 0.7850427, 0.78607, 
-0.7867187, 0.786627, 0.7858485, 0.7848204, 0.7841183, 0.784134, 0.7848565, 0.7858799, 0.7866309, 0.7866905, 
-0.7860272, 0.785014, 0.7842185, 0.7840849, 0.7846861, 0.7856838, 0.786519, 0.786725, 0.7861885, 0.7852115, 
-0.7843416, 0.7840649, 0.7845346, 0.7854859, 0.7863856, 0.7867307, 0.7863296, 0.7854087, 0.7844844, 0.7840736, 
-0.7844047, 0.7852905, 0.7862342, 0.7867078, 0.7864478, 0.7856014, 0.7846436, 0.7841103, 0.7842986, 0.7851015, 
-0.7860682, 0.7866576, 0.7865412, 0.7857858, 0.7848155, 0.7841736, 0.7842182, 0.7849226, 0.7858913, 0.7865817, 
-0.7866084, 0.7859582, 0.7849964, 0.7842617, 0.7841644, 0.7847574, 0.7857074, 0.786482, 0.7866486, 0.7861153, 
-0.7851822, 0.7843722, 0.7841379, 0.7846091, 0.7855205, 0.7863613, 0.7866613, 0.7862541, 0.7853691, 0.7845024, 
-0.7841388, 0.7844804, 0.7853346, 0.7862223, 0.786647, 0.7863721, 0.7855531, 0.7846493, 0.7841665, 0.7843737, 
-0.7851535, 0.7860684, 0.7866063, 0.7864672, 0.7857305, 0.7848095, 0.7842198, 0.7842906, 0.7849808, 0.7859029, 
-0.7865406, 0.7865379, 0.7858976, 0.7849793, 0.7842974, 0.7842327, 0.7848201, 0.7857296, 0.7864518, 0.786583, 
-0.7860511, 0.7851552, 0.784397, 0.7842005, 0.7846744, 0.7855522, 0.786342, 0.7866021, 0.7861882, 0.7853332, 
-0.7845163, 0.7841944, 0.7845466, 0.7853744, 0.7862139, 0.7865953, 0.7863062, 0.7855097, 0.7846524, 0.7842141, 
-0.784439, 0.7852001, 0.7860705, 0.786563, 0.7864029, 0.785681, 0.7848023, 0.7842587, 0.7843536, 0.7850327, 
-0.785915, 0.7865064, 0.7864767, 0.7858436, 0.7849625, 0.7843269, 0.7842917, 0.7848757, 0.7857509, 0.7864271, 
-0.7865263, 0.7859943, 0.7851297, 0.7844169, 0.7842544, 0.7847322, 0.7855817, 0.7863269, 0.7865512, 0.78613, 
-0.7853, 0.7845265, 0.7842421, 0.784605, 0.785411, 0.7862084, 0.7865511, 0.7862481, 0.7854701, 0.7846532, 
-0.7842545, 0.7844964, 0.7852425, 0.7860743, 0.7865264, 0.7863465, 0.7856362, 0.784794, 0.7842912, 0.7844087, 
-0.7850796, 0.7859276, 0.786478, 0.7864232, 0.785795, 0.7849458, 0.7843511, 0.7843432, 0.7849257, 0.7857716, 
-0.7864071, 0.7864771, 0.7859433, 0.7851053, 0.7844325, 0.7843011, 0.7847838, 0.7856095, 0.7863157, 0.7865073, 
-0.786078, 0.785269, 0.7845335, 0.784283, 0.7846569, 0.785445, 0.7862057, 0.7865134, 0.7861966, 0.7854334, 
-0.7846517, 0.7842889, 0.7845473, 0.7852815, 0.7860799, 0.7864956, 0.7862966, 0.7855951, 0.7847845, 0.7843184, 
-0.7844572, 0.7851224, 0.7859409, 0.7864546, 0.7863763, 0.7857508, 0.7849288, 0.7843706, 0.7843883, 0.784971, 
-0.785792, 0.7863915, 0.7864342, 0.7858972, 0.7850816, 0.7844443, 0.7843416, 0.7848304, 0.7856363, 0.7863078, 
-0.7864694, 0.7860313, 0.7852394, 0.7845375, 0.7843181, 0.7847035, 0.7854771, 0.7862055, 0.7864812, 0.7861504, 
-0.7853991, 0.7846481, 0.7843179, 0.7845927, 0.7853179, 0.7860871, 0.7864698, 0.7862523, 0.785557, 0.7847737, 
-0.7843408, 0.7845002, 0.7851619, 0.7859551, 0.7864356, 0.7863349, 0.7857101, 0.7849114, 0.7843861, 0.7844278, 
-0.7850126, 0.7858124, 0.7863795, 0.7863967, 0.785855, 0.7850582, 0.7844526, 0.7843769, 0.7848728, 0.7856622, 
-0.786303, 0.7864366, 0.7859889, 0.785211, 0.7845388, 0.7843483, 0.7847456, 0.7855077, 0.7862077, 0.7864539, 
-0.7861089, 0.7853665, 0.7846426, 0.7843423, 0.7846334, 0.7853522, 0.786096, 0.7864484, 0.7862127, 0.7855213, 
-0.7847617, 0.7843591, 0.7845385, 0.7851989, 0.7859702, 0.7864206, 0.7862982, 0.7856722, 0.7848934, 0.7843979, 
-0.7844627, 0.7850511, 0.7858332, 0.786371, 0.7863639, 0.7858162, 0.785035, 0.7844578, 0.7844075, 0.7849118, 
-0.7856878, 0.786301, 0.7864083, 0.7859501, 0.7851833, 0.7845375, 0.784374, 0.7847839, 0.7855373, 0.7862122, 
-0.7864308, 0.7860712, 0.7853352, 0.784635, 0.7843626, 0.7846701, 0.7853849, 0.7861065, 0.786431, 0.7861771, 
-0.7854874, 0.7847482, 0.7843735, 0.7845727, 0.7852338, 0.7859864, 0.7864091, 0.7862657, 0.7856367, 0.7848746, 
-0.7844063, 0.7844935, 0.7850871, 0.7858544, 0.7863657, 0.7863351, 0.78578, 0.7850115, 0.7844601, 0.7844341, 
-0.7849479, 0.7857133, 0.7863018, 0.786384, 0.7859143, 0.7851559, 0.7845337, 0.7843958, 0.7848192, 0.7855664, 
-0.7862189, 0.7864116, 0.7860368, 0.7853047, 0.7846254, 0.7843792, 0.7847035, 0.7854165, 0.7861188, 0.7864173, 
-0.786145, 0.7854548, 0.7847333, 0.7843844, 0.7846033, 0.785267, 0.7860038, 0.7864011, 0.7862367, 0.7856029, 
-0.7848549, 0.7844114, 0.7845206, 0.7851211, 0.7858763, 0.7863634, 0.7863099, 0.785746, 0.7849876, 0.7844595, 
-0.7844571, 0.7849816, 0.7857391, 0.7863053, 0.7863634, 0.785881, 0.7851286, 0.7845274, 0.7844141, 0.7848517, 
-0.7855951, 0.7862279, 0.7863959, 0.7860052, 0.7852748, 0.7846138, 0.7843923, 0.784734, 0.7854474, 0.786133, 
-0.7864069, 0.7861159, 0.7854232, 0.7847167, 0.7843921, 0.7846309, 0.7852992, 0.7860226, 0.7863962, 0.7862108, 
-0.7855705, 0.784834, 0.7844136, 0.7845446, 0.7851535, 0.7858992, 0.7863641, 0.786288, 0.7857138, 0.784963, 
-0.7844561, 0.7844768, 0.7850134, 0.7857653, 0.7863114, 0.786346, 0.7858498, 0.785101, 0.7845187, 0.784429, 
-0.784882, 0.7856239, 0.7862392, 0.7863834, 0.7859759, 0.7852451, 0.7846001, 0.7844021, 0.7847619, 0.7854779, 
-0.7861491, 0.7863996, 0.7860894, 0.7853921, 0.7846984, 0.7843967, 0.7846557, 0.7853305, 0.786043, 0.7863943, 
-0.7861878, 0.7855391, 0.7848117, 0.7844127, 0.7845656, 0.7851847, 0.7859232, 0.7863676, 0.7862691, 0.7856829, 
-0.7849373, 0.7844499, 0.7844935, 0.7850437, 0.7857923, 0.7863201, 0.7863316, 0.7858204, 0.7850728, 0.7845074, 
-0.7844409, 0.7849104, 0.785653, 0.7862529, 0.786374, 0.7859487, 0.7852151, 0.7845841, 0.7844089, 0.7847877, 
-0.7855084, 0.7861673, 0.7863955, 0.7860652, 0.7853614, 0.7846782, 0.7843982, 0.7846782, 0.7853614, 0.7860652, 
-0.7863955, 0.7861673, 0.7855084, 0.7847877, 0.7844089, 0.7845841, 0.7852151, 0.7859487, 0.786374, 0.7862529, 
-0.785653, 0.7849104, 0.7844409, 0.7845074, 0.7850728, 0.7858204, 0.7863316, 0.7863201, 0.7857923, 0.7850437, 
-0.7844935, 0.7844499, 0.7849373, 0.7856829, 0.7862691, 0.7863676, 0.7859232, 0.7851847, 0.7845656, 0.7844127, 
-0.7848117, 0.7855391, 0.7861878, 0.7863943, 0.786043, 0.7853305, 0.7846557, 0.7843967, 0.7846984, 0.7853921, 
-0.7860894, 0.7863996, 0.7861491, 0.7854779, 0.7847619, 0.7844021, 0.7846001, 0.7852451, 0.7859759, 0.7863834, 
-0.7862392, 0.7856239, 0.784882, 0.784429, 0.7845187, 0.785101, 0.7858498, 0.786346, 0.7863114, 0.7857653, 
-0.7850134, 0.7844768, 0.7844561, 0.784963, 0.7857138, 0.786288, 0.7863641, 0.7858992, 0.7851535, 0.7845446, 
-0.7844136, 0.784834, 0.7855705, 0.7862108, 0.7863962, 0.7860226, 0.7852992, 0.7846309, 0.7843921, 0.7847167, 
-0.7854232, 0.7861159, 0.7864069, 0.786133, 0.7854474, 0.784734, 0.7843923, 0.7846138, 0.7852748, 0.7860052, 
-0.7863959, 0.7862279, 0.7855951, 0.7848517, 0.7844141, 0.7845274, 0.7851286, 0.785881, 0.7863634, 0.7863053, 
-0.7857391, 0.7849816, 0.7844571, 0.7844595, 0.7849876, 0.785746, 0.7863099, 0.7863634, 0.7858763, 0.7851211, 
-0.7845206, 0.7844114, 0.7848549, 0.7856029, 0.7862367, 0.7864011, 0.7860038, 0.785267, 0.7846033, 0.7843844, 
-0.7847333, 0.7854548, 0.786145, 0.7864173, 0.7861188, 0.7854165, 0.7847035, 0.7843792, 0.7846254, 0.7853047, 
-0.7860368, 0.7864116, 0.7862189, 0.7855664, 0.7848192, 0.7843958, 0.7845337, 0.7851559, 0.7859143, 0.786384, 
-0.7863018, 0.7857133, 0.7849479, 0.7844341, 0.7844601, 0.7850115, 0.78578, 0.7863351, 0.7863657, 0.7858544, 
-0.7850871, 0.7844935, 0.7844063, 0.7848746, 0.7856367, 0.7862657, 0.7864091, 0.7859864, 0.7852338, 0.7845727, 
-0.7843735, 0.7847482, 0.7854874, 0.7861771, 0.786431, 0.7861065, 0.7853849, 0.7846701, 0.7843626, 0.784635, 
-0.7853352, 0.7860712, 0.7864308, 0.7862122, 0.7855373, 0.7847839, 0.784374, 0.7845375, 0.7851833, 0.7859501, 
-0.7864083, 0.786301, 0.7856878, 0.7849118, 0.7844075, 0.7844578, 0.785035, 0.7858162, 0.7863639, 0.786371, 
-0.7858332, 0.7850511, 0.7844627, 0.7843979, 0.7848934, 0.7856722, 0.7862982, 0.7864206, 0.7859702, 0.7851989, 
-0.7845385, 0.7843591, 0.7847617, 0.7855213, 0.7862127, 0.7864484, 0.786096, 0.7853522, 0.7846334, 0.7843423, 
-0.7846426, 0.7853665, 0.7861089, 0.7864539, 0.7862077, 0.7855077, 0.7847456, 0.7843483, 0.7845388, 0.785211, 
-0.7859889, 0.7864366, 0.786303, 0.7856622, 0.7848728, 0.7843769, 0.7844526, 0.7850582, 0.785855, 0.7863967, 
-0.7863795, 0.7858124, 0.7850126, 0.7844278, 0.7843861, 0.7849114, 0.7857101, 0.7863349, 0.7864356, 0.7859551, 
-0.7851619, 0.7845002, 0.7843408, 0.7847737, 0.785557, 0.7862523, 0.7864698, 0.7860871, 0.7853179, 0.7845927, 
-0.7843179, 0.7846481, 0.7853991, 0.7861504, 0.7864812, 0.7862055, 0.7854771, 0.7847035, 0.7843181, 0.7845375, 
-0.7852394, 0.7860313, 0.7864694, 0.7863078, 0.7856363, 0.7848304, 0.7843416, 0.7844443, 0.7850816, 0.7858972, 
-0.7864342, 0.7863915, 0.785792, 0.784971, 0.7843883, 0.7843706, 0.7849288, 0.7857508, 0.7863763, 0.7864546, 
-0.7859409, 0.7851224, 0.7844572, 0.7843184, 0.7847845, 0.7855951, 0.7862966, 0.7864956, 0.7860799, 0.7852815, 
-0.7845473, 0.7842889, 0.7846517, 0.7854334, 0.7861966, 0.7865134, 0.7862057, 0.785445, 0.7846569, 0.784283, 
-0.7845335, 0.785269, 0.786078, 0.7865073, 0.7863157, 0.7856095, 0.7847838, 0.7843011, 0.7844325, 0.7851053, 
-0.7859433, 0.7864771, 0.7864071, 0.7857716, 0.7849257, 0.7843432, 0.7843511, 0.7849458, 0.785795, 0.7864232, 
-0.786478, 0.7859276, 0.7850796, 0.7844087, 0.7842912, 0.784794, 0.7856362, 0.7863465, 0.7865264, 0.7860743, 
-0.7852425, 0.7844964, 0.7842545, 0.7846532, 0.7854701, 0.7862481, 0.7865511, 0.7862084, 0.785411, 0.784605, 
-0.7842421, 0.7845265, 0.7853, 0.78613, 0.7865512, 0.7863269, 0.7855817, 0.7847322, 0.7842544, 0.7844169, 
-0.7851297, 0.7859943, 0.7865263, 0.7864271, 0.7857509, 0.7848757, 0.7842917, 0.7843269, 0.7849625, 0.7858436, 
-0.7864767, 0.7865064, 0.785915, 0.7850327, 0.7843536, 0.7842587, 0.7848023, 0.785681, 0.7864029, 0.786563, 
-0.7860705, 0.7852001, 0.784439, 0.7842141, 0.7846524, 0.7855097, 0.7863062, 0.7865953, 0.7862139, 0.7853744, 
-0.7845466, 0.7841944, 0.7845163, 0.7853332, 0.7861882, 0.7866021, 0.786342, 0.7855522, 0.7846744, 0.7842005, 
-0.784397, 0.7851552, 0.7860511, 0.786583, 0.7864518, 0.7857296, 0.7848201, 0.7842327, 0.7842974, 0.7849793, 
-0.7858976, 0.7865379, 0.7865406, 0.7859029, 0.7849808, 0.7842906, 0.7842198, 0.7848095, 0.7857305, 0.7864672, 
-0.7866063, 0.7860684, 0.7851535, 0.7843737, 0.7841665, 0.7846493, 0.7855531, 0.7863721, 0.786647, 0.7862223, 
-0.7853346, 0.7844804, 0.7841388, 0.7845024, 0.7853691, 0.7862541, 0.7866613, 0.7863613, 0.7855205, 0.7846091, 
-0.7841379, 0.7843722, 0.7851822, 0.7861153, 0.7866486, 0.786482, 0.7857074, 0.7847574, 0.7841644, 0.7842617, 
-0.7849964, 0.7859582, 0.7866084, 0.7865817, 0.7858913, 0.7849226, 0.7842182, 0.7841736, 0.7848155, 0.7857858, 
-0.7865412, 0.7866576, 0.7860682, 0.7851015, 0.7842986, 0.7841103, 0.7846436, 0.7856014, 0.7864478, 0.7867078, 
-0.7862342, 0.7852905, 0.7844047, 0.7840736, 0.7844844, 0.7854087, 0.7863296, 0.7867307, 0.7863856, 0.7854859, 
-0.7845346, 0.7840649, 0.7843416, 0.7852115, 0.7861885, 0.786725, 0.786519, 0.7856838, 0.7846861, 0.7840849, 
-0.7842185, 0.785014, 0.7860272, 0.7866905, 0.7866309, 0.7858799, 0.7848565, 0.784134, 0.7841183, 0.7848204, 
-0.7858485, 0.786627, 0.7867187, 0.78607, 0.7850427, 0.7842117, 0.7840436, 0.7846348, 0.7856558, 0.7865354, 
-0.7867798, 0.7862501, 0.785241, 0.784317, 0.7839966, 0.7844613, 0.7854529, 0.7864168, 0.7868124, 0.786416, 
-0.7854475, 0.7844484, 0.7839789, 0.7843039, 0.7852437, 0.7862731, 0.786815, 0.7865639, 0.7856582, 0.7846037, 
-0.7839916, 0.7841664, 0.7850327, 0.7861067, 0.7867868, 0.7866902, 0.7858686, 0.7847804, 0.7840352, 0.7840521, 
-0.7848241, 0.7859206, 0.7867277, 0.7867917, 0.7860742, 0.7849751, 0.7841097, 0.7839641, 0.7846224, 0.7857182, 
-0.7866381, 0.7868656, 0.7862707, 0.7851843, 0.7842142, 0.7839049, 0.7844322, 0.7855032, 0.786519, 0.7869096, 
-0.7864536, 0.785404, 0.7843474, 0.7838766, 0.7842576, 0.7852799, 0.7863721, 0.7869219, 0.7866187, 0.7856298, 
-0.7845073, 0.7838806, 0.784103, 0.7850528, 0.7861998, 0.7869013, 0.786762, 0.7858571, 0.7846913, 0.7839178, 
-0.783972, 0.7848265, 0.7860049, 0.7868474, 0.7868799, 0.7860812, 0.7848963, 0.7839884, 0.7838681, 0.7846058, 
-0.7857909, 0.7867602, 0.786969, 0.7862972, 0.7851184, 0.784092, 0.7837944, 0.7843956, 0.7855616, 0.7866406, 
-0.7870266, 0.7865005, 0.7853537, 0.7842273, 0.7837534, 0.7842005, 0.7853215, 0.78649, 0.7870506, 0.7866862, 
-0.7855976, 0.7843926, 0.7837469, 0.7840252, 0.7850751, 0.7863106, 0.7870393, 0.78685, 0.7858452, 0.7845853, 
-0.7837763, 0.783874, 0.7848275, 0.7861053, 0.7869917, 0.7869876, 0.7860915, 0.7848024, 0.7838421, 0.7837509, 
-0.7845839, 0.7858774, 0.7869077, 0.7870953, 0.7863312, 0.7850401, 0.7839442, 0.7836595, 0.7843494, 0.7856309, 
-0.7867876, 0.7871697, 0.7865592, 0.7852942, 0.7840818, 0.7836028, 0.7841292, 0.7853704, 0.7866328, 0.7872081, 
-0.7867701, 0.78556, 0.7842534, 0.7835832, 0.7839287, 0.7851006, 0.7864452, 0.7872084, 0.7869591, 0.7858324, 
-0.7844565, 0.7836026, 0.7837525, 0.784827, 0.7862274, 0.7871691, 0.7871212, 0.7861059, 0.7846882, 0.7836621, 
-0.7836055, 0.784555, 0.7859827, 0.7870894, 0.7872521, 0.7863749, 0.7849448, 0.783762, 0.7834917, 0.7842905, 
-0.7857152, 0.7869693, 0.7873478, 0.7866336, 0.785222, 0.7839019, 0.783415, 0.7840391, 0.7854296, 0.7868098, 
-0.7874048, 0.7868762, 0.7855148, 0.7840806, 0.7833785, 0.7838066, 0.7851308, 0.7866124, 0.7874202, 0.787097, 
-0.785818, 0.7842961, 0.7833846, 0.7835988, 0.7848247, 0.7863795, 0.787392, 0.7872905, 0.7861257, 0.7845456, 
-0.7834353, 0.783421, 0.784517, 0.7861143, 0.7873187, 0.7874514, 0.7864317, 0.7848255, 0.7835315, 0.7832782, 
-0.7842142, 0.7858208, 0.7871996, 0.7875749, 0.7867298, 0.7851315, 0.7836733, 0.7831751, 0.7839226, 0.7855036, 
-0.7870351, 0.7876566, 0.7870133, 0.7854586, 0.7838602, 0.7831157, 0.7836488, 0.785168, 0.7868262, 0.7876928, 
-0.7872757, 0.7858011, 0.7840906, 0.7831035, 0.7833993, 0.78482, 0.786575, 0.7876803, 0.7875107, 0.786153, 
-0.784362, 0.7831413, 0.7831804, 0.784466, 0.7862842, 0.7876169, 0.7877119, 0.7865074, 0.7846712, 0.7832308, 
-0.7829983, 0.7841129, 0.7859576, 0.7875009, 0.7878734, 0.7868575, 0.785014, 0.7833733, 0.7828588, 0.7837678, 
-0.7855998, 0.7873318, 0.7879897, 0.7871958, 0.7853855, 0.7835689, 0.782767, 0.7834381, 0.785216, 0.7871098, 
-0.7880558, 0.787515, 0.78578, 0.783817, 0.7827277, 0.7831313, 0.7848125, 0.7868362, 0.7880673, 0.7878074, 
-0.7861909, 0.7841158, 0.782745, 0.7828551, 0.784396, 0.7865129, 0.7880204, 0.7880656, 0.7866113, 0.7844627, 
-0.7828222, 0.7826167, 0.7839737, 0.7861433, 0.7879122, 0.7882822, 0.7870334, 0.7848541, 0.7829619, 0.7824236, 
-0.7835538, 0.7857313, 0.7877406, 0.7884501, 0.7874491, 0.7852854, 0.7831657, 0.7822826, 0.7831443, 0.7852819, 
-0.7875045, 0.7885626, 0.78785, 0.7857513, 0.7834342, 0.7822003, 0.7827541, 0.784801, 0.7872035, 0.7886132, 
-0.7882273, 0.7862455, 0.7837674, 0.7821827, 0.7823921, 0.7842954, 0.7868384, 0.7885964, 0.7885719, 0.7867607, 
-0.784164, 0.7822354, 0.7820673, 0.7837726, 0.7864109, 0.7885067, 0.7888746, 0.7872891, 0.7846219, 0.7823631, 
-0.7817889, 0.7832408, 0.7859234, 0.7883398, 0.7891264, 0.7878221, 0.785138, 0.7825702, 0.781566, 0.7827088, 
-0.7853796, 0.7880917, 0.7893181, 0.7883505, 0.7857083, 0.7828601, 0.7814078, 0.7821864, 0.784784, 0.7877593, 
-0.7894405, 0.7888645, 0.786328, 0.7832357, 0.7813233, 0.7816834, 0.7841418, 0.7873399, 0.7894848, 0.7893539, 
-0.7869912, 0.7836994, 0.7813216, 0.7812105, 0.7834591, 0.7868316, 0.7894418, 0.7898076, 0.7876917, 0.7842527, 
-0.7814114, 0.7807786, 0.7827426, 0.7862329, 0.7893028, 0.7902146, 0.7884223, 0.7848971, 0.781602, 0.7803995, 
-0.7819998, 0.7855425, 0.7890583, 0.7905628, 0.7891755, 0.7856338, 0.7819027, 0.7800852, 0.7812383, 0.7847592, 
-0.788699, 0.79084, 0.7899432, 0.786464, 0.7823234, 0.7798486, 0.7804664, 0.7838816, 0.7882142, 0.7910326, 
-0.7907173, 0.7873897, 0.7828753, 0.7797036, 0.7796923, 0.7829071, 0.7875918, 0.7911261, 0.7914893, 0.7884141, 
-0.7835717, 0.7796657, 0.7789243, 0.7818314, 0.7868173, 0.791104, 0.7922511, 0.7895427, 0.784429, 0.7797526, 
-0.7781706, 0.7806474, 0.7858717, 0.790947, 0.792995, 0.790785, 0.7854691, 0.7799857, 0.7774385, 0.7793429, 
-0.7847295, 0.790631, 0.7937137, 0.7921568, 0.7867227, 0.7803925, 0.7767345, 0.7778975, 0.7833535, 0.7901243, 
-0.7944016, 0.7936844, 0.7882348, 0.78101, 0.7760635, 0.7762768, 0.7816881, 0.7893826, 0.7950553, 0.7954125, 
-0.7900755, 0.7818924, 0.775427, 0.7744224, 0.779644, 0.7883387, 0.7956755, 0.7974182, 0.7923597, 0.7831242, 
-0.7748211, 0.7722315, 0.7770708, 0.7868841, 0.7962712, 0.799841, 0.7952882, 0.7848484, 0.7742289, 0.7695116, 
-0.7736946, 0.7848262, 0.7968709, 0.8029519, 0.799244, 0.7873311, 0.7736033, 0.7658701, 0.7689645, 0.7817854, 
-0.7975543, 0.8073396, 0.8050486, 0.7911333, 0.7728048, 0.7603856, 0.7615984, 0.776895, 0.798578, 0.8145303, 
-0.8148206, 0.797671, 0.7713228, 0.7503299, 0.7478171, 0.7676694, 0.8010819, 0.8299519, 0.8360744, 0.8117564, 
-0.7661243, 0.7229719, 0.7099487, 0.7434061, 0.8160202, 0.8938323, 0.9255315, 0.8612618, 0.6735258, 0.3711809, 
-0.0, -0.3711809, -0.6735258, -0.8612618, -0.9255315, -0.8938323, -0.8160202, -0.7434061, -0.7099487, -0.7229719, 
--0.7661243, -0.8117564, -0.8360744, -0.8299519, -0.8010819, -0.7676694, -0.7478171, -0.7503299, -0.7713228, -0.797671, 
--0.8148206, -0.8145303, -0.798578, -0.776895, -0.7615984, -0.7603856, -0.7728048, -0.7911333, -0.8050486, -0.8073396, 
--0.7975543, -0.7817854, -0.7689645, -0.7658701, -0.7736033, -0.7873311, -0.799244, -0.8029519, -0.7968709, -0.7848262, 
--0.7736946, -0.7695116, -0.7742289, -0.7848484, -0.7952882, -0.799841, -0.7962712, -0.7868841, -0.7770708, -0.7722315, 
--0.7748211, -0.7831242, -0.7923597, -0.7974182, -0.7956755, -0.7883387, -0.779644, -0.7744224, -0.775427, -0.7818924, 
--0.7900755, -0.7954125, -0.7950553, -0.7893826, -0.7816881, -0.7762768, -0.7760635, -0.78101, -0.7882348, -0.7936844, 
--0.7944016, -0.7901243, -0.7833535, -0.7778975, -0.7767345, -0.7803925, -0.7867227, -0.7921568, -0.7937137, -0.790631, 
--0.7847295, -0.7793429, -0.7774385, -0.7799857, -0.7854691, -0.790785, -0.792995, -0.790947, -0.7858717, -0.7806474, 
--0.7781706, -0.7797526, -0.784429, -0.7895427, -0.7922511, -0.791104, -0.7868173, -0.7818314, -0.7789243, -0.7796657, 
--0.7835717, -0.7884141, -0.7914893, -0.7911261, -0.7875918, -0.7829071, -0.7796923, -0.7797036, -0.7828753, -0.7873897, 
--0.7907173, -0.7910326, -0.7882142, -0.7838816, -0.7804664, -0.7798486, -0.7823234, -0.786464, -0.7899432, -0.79084, 
--0.788699, -0.7847592, -0.7812383, -0.7800852, -0.7819027, -0.7856338, -0.7891755, -0.7905628, -0.7890583, -0.7855425, 
--0.7819998, -0.7803995, -0.781602, -0.7848971, -0.7884223, -0.7902146, -0.7893028, -0.7862329, -0.7827426, -0.7807786, 
--0.7814114, -0.7842527, -0.7876917, -0.7898076, -0.7894418, -0.7868316, -0.7834591, -0.7812105, -0.7813216, -0.7836994, 
--0.7869912, -0.7893539, -0.7894848, -0.7873399, -0.7841418, -0.7816834, -0.7813233, -0.7832357, -0.786328, -0.7888645, 
--0.7894405, -0.7877593, -0.784784, -0.7821864, -0.7814078, -0.7828601, -0.7857083, -0.7883505, -0.7893181, -0.7880917, 
--0.7853796, -0.7827088, -0.781566, -0.7825702, -0.785138, -0.7878221, -0.7891264, -0.7883398, -0.7859234, -0.7832408, 
--0.7817889, -0.7823631, -0.7846219, -0.7872891, -0.7888746, -0.7885067, -0.7864109, -0.7837726, -0.7820673, -0.7822354, 
--0.784164, -0.7867607, -0.7885719, -0.7885964, -0.7868384, -0.7842954, -0.7823921, -0.7821827, -0.7837674, -0.7862455, 
--0.7882273, -0.7886132, -0.7872035, -0.784801, -0.7827541, -0.7822003, -0.7834342, -0.7857513, -0.78785, -0.7885626, 
--0.7875045, -0.7852819, -0.7831443, -0.7822826, -0.7831657, -0.7852854, -0.7874491, -0.7884501, -0.7877406, -0.7857313, 
--0.7835538, -0.7824236, -0.7829619, -0.7848541, -0.7870334, -0.7882822, -0.7879122, -0.7861433, -0.7839737, -0.7826167, 
--0.7828222, -0.7844627, -0.7866113, -0.7880656, -0.7880204, -0.7865129, -0.784396, -0.7828551, -0.782745, -0.7841158, 
--0.7861909, -0.7878074, -0.7880673, -0.7868362, -0.7848125, -0.7831313, -0.7827277, -0.783817, -0.78578, -0.787515, 
--0.7880558, -0.7871098, -0.785216, -0.7834381, -0.782767, -0.7835689, -0.7853855, -0.7871958, -0.7879897, -0.7873318, 
--0.7855998, -0.7837678, -0.7828588, -0.7833733, -0.785014, -0.7868575, -0.7878734, -0.7875009, -0.7859576, -0.7841129, 
--0.7829983, -0.7832308, -0.7846712, -0.7865074, -0.7877119, -0.7876169, -0.7862842, -0.784466, -0.7831804, -0.7831413, 
--0.784362, -0.786153, -0.7875107, -0.7876803, -0.786575, -0.78482, -0.7833993, -0.7831035, -0.7840906, -0.7858011, 
--0.7872757, -0.7876928, -0.7868262, -0.785168, -0.7836488, -0.7831157, -0.7838602, -0.7854586, -0.7870133, -0.7876566, 
--0.7870351, -0.7855036, -0.7839226, -0.7831751, -0.7836733, -0.7851315, -0.7867298, -0.7875749, -0.7871996, -0.7858208, 
--0.7842142, -0.7832782, -0.7835315, -0.7848255, -0.7864317, -0.7874514, -0.7873187, -0.7861143, -0.784517, -0.783421, 
--0.7834353, -0.7845456, -0.7861257, -0.7872905, -0.787392, -0.7863795, -0.7848247, -0.7835988, -0.7833846, -0.7842961, 
--0.785818, -0.787097, -0.7874202, -0.7866124, -0.7851308, -0.7838066, -0.7833785, -0.7840806, -0.7855148, -0.7868762, 
--0.7874048, -0.7868098, -0.7854296, -0.7840391, -0.783415, -0.7839019, -0.785222, -0.7866336, -0.7873478, -0.7869693, 
--0.7857152, -0.7842905, -0.7834917, -0.783762, -0.7849448, -0.7863749, -0.7872521, -0.7870894, -0.7859827, -0.784555, 
--0.7836055, -0.7836621, -0.7846882, -0.7861059, -0.7871212, -0.7871691, -0.7862274, -0.784827, -0.7837525, -0.7836026, 
--0.7844565, -0.7858324, -0.7869591, -0.7872084, -0.7864452, -0.7851006, -0.7839287, -0.7835832, -0.7842534, -0.78556, 
--0.7867701, -0.7872081, -0.7866328, -0.7853704, -0.7841292, -0.7836028, -0.7840818, -0.7852942, -0.7865592, -0.7871697, 
--0.7867876, -0.7856309, -0.7843494, -0.7836595, -0.7839442, -0.7850401, -0.7863312, -0.7870953, -0.7869077, -0.7858774, 
--0.7845839, -0.7837509, -0.7838421, -0.7848024, -0.7860915, -0.7869876, -0.7869917, -0.7861053, -0.7848275, -0.783874, 
--0.7837763, -0.7845853, -0.7858452, -0.78685, -0.7870393, -0.7863106, -0.7850751, -0.7840252, -0.7837469, -0.7843926, 
--0.7855976, -0.7866862, -0.7870506, -0.78649, -0.7853215, -0.7842005, -0.7837534, -0.7842273, -0.7853537, -0.7865005, 
--0.7870266, -0.7866406, -0.7855616, -0.7843956, -0.7837944, -0.784092, -0.7851184, -0.7862972, -0.786969, -0.7867602, 
--0.7857909, -0.7846058, -0.7838681, -0.7839884, -0.7848963, -0.7860812, -0.7868799, -0.7868474, -0.7860049, -0.7848265, 
--0.783972, -0.7839178, -0.7846913, -0.7858571, -0.786762, -0.7869013, -0.7861998, -0.7850528, -0.784103, -0.7838806, 
--0.7845073, -0.7856298, -0.7866187, -0.7869219, -0.7863721, -0.7852799, -0.7842576, -0.7838766, -0.7843474, -0.785404, 
--0.7864536, -0.7869096, -0.786519, -0.7855032, -0.7844322, -0.7839049, -0.7842142, -0.7851843, -0.7862707, -0.7868656, 
--0.7866381, -0.7857182, -0.7846224, -0.7839641, -0.7841097, -0.7849751, -0.7860742, -0.7867917, -0.7867277, -0.7859206, 
--0.7848241, -0.7840521, -0.7840352, -0.7847804, -0.7858686, -0.7866902, -0.7867868, -0.7861067, -0.7850327, -0.7841664, 
--0.7839916, -0.7846037, -0.7856582, -0.7865639, -0.786815, -0.7862731, -0.7852437, -0.7843039, -0.7839789, -0.7844484, 
--0.7854475, -0.786416, -0.7868124, -0.7864168, -0.7854529, -0.7844613, -0.7839966, -0.784317, -0.785241, -0.7862501, 
--0.7867798, -0.7865354, -0.7856558, -0.7846348, -0.7840436, -0.7842117, -0.7850427, -0.78607, -0.7867187, -0.786627, 
--0.7858485, -0.7848204, -0.7841183, -0.784134, -0.7848565, -0.7858799, -0.7866309, -0.7866905, -0.7860272, -0.785014, 
--0.7842185, -0.7840849, -0.7846861, -0.7856838, -0.786519, -0.786725, -0.7861885, -0.7852115, -0.7843416, -0.7840649, 
--0.7845346, -0.7854859, -0.7863856, -0.7867307, -0.7863296, -0.7854087, -0.7844844, -0.7840736, -0.7844047, -0.7852905, 
--0.7862342, -0.7867078, -0.7864478, -0.7856014, -0.7846436, -0.7841103, -0.7842986, -0.7851015, -0.7860682, -0.7866576, 
--0.7865412, -0.7857858, -0.7848155, -0.7841736, -0.7842182, -0.7849226, -0.7858913, -0.7865817, -0.7866084, -0.7859582, 
--0.7849964, -0.7842617, -0.7841644, -0.7847574, -0.7857074, -0.786482, -0.7866486, -0.7861153, -0.7851822, -0.7843722, 
--0.7841379, -0.7846091, -0.7855205, -0.7863613, -0.7866613, -0.7862541, -0.7853691, -0.7845024, -0.7841388, -0.7844804, 
--0.7853346, -0.7862223, -0.786647, -0.7863721, -0.7855531, -0.7846493, -0.7841665, -0.7843737, -0.7851535, -0.7860684, 
--0.7866063, -0.7864672, -0.7857305, -0.7848095, -0.7842198, -0.7842906, -0.7849808, -0.7859029, -0.7865406, -0.7865379, 
--0.7858976, -0.7849793, -0.7842974, -0.7842327, -0.7848201, -0.7857296, -0.7864518, -0.786583, -0.7860511, -0.7851552, 
--0.784397, -0.7842005, -0.7846744, -0.7855522, -0.786342, -0.7866021, -0.7861882, -0.7853332, -0.7845163, -0.7841944, 
--0.7845466, -0.7853744, -0.7862139, -0.7865953, -0.7863062, -0.7855097, -0.7846524, -0.7842141, -0.784439, -0.7852001, 
--0.7860705, -0.786563, -0.7864029, -0.785681, -0.7848023, -0.7842587, -0.7843536, -0.7850327, -0.785915, -0.7865064, 
--0.7864767, -0.7858436, -0.7849625, -0.7843269, -0.7842917, -0.7848757, -0.7857509, -0.7864271, -0.7865263, -0.7859943, 
--0.7851297, -0.7844169, -0.7842544, -0.7847322, -0.7855817, -0.7863269, -0.7865512, -0.78613, -0.7853, -0.7845265, 
--0.7842421, -0.784605, -0.785411, -0.7862084, -0.7865511, -0.7862481, -0.7854701, -0.7846532, -0.7842545, -0.7844964, 
--0.7852425, -0.7860743, -0.7865264, -0.7863465, -0.7856362, -0.784794, -0.7842912, -0.7844087, -0.7850796, -0.7859276, 
--0.786478, -0.7864232, -0.785795, -0.7849458, -0.7843511, -0.7843432, -0.7849257, -0.7857716, -0.7864071, -0.7864771, 
--0.7859433, -0.7851053, -0.7844325, -0.7843011, -0.7847838, -0.7856095, -0.7863157, -0.7865073, -0.786078, -0.785269, 
--0.7845335, -0.784283, -0.7846569, -0.785445, -0.7862057, -0.7865134, -0.7861966, -0.7854334, -0.7846517, -0.7842889, 
--0.7845473, -0.7852815, -0.7860799, -0.7864956, -0.7862966, -0.7855951, -0.7847845, -0.7843184, -0.7844572, -0.7851224, 
--0.7859409, -0.7864546, -0.7863763, -0.7857508, -0.7849288, -0.7843706, -0.7843883, -0.784971, -0.785792, -0.7863915, 
--0.7864342, -0.7858972, -0.7850816, -0.7844443, -0.7843416, -0.7848304, -0.7856363, -0.7863078, -0.7864694, -0.7860313, 
--0.7852394, -0.7845375, -0.7843181, -0.7847035, -0.7854771, -0.7862055, -0.7864812, -0.7861504, -0.7853991, -0.7846481, 
--0.7843179, -0.7845927, -0.7853179, -0.7860871, -0.7864698, -0.7862523, -0.785557, -0.7847737, -0.7843408, -0.7845002, 
--0.7851619, -0.7859551, -0.7864356, -0.7863349, -0.7857101, -0.7849114, -0.7843861, -0.7844278, -0.7850126, -0.7858124, 
--0.7863795, -0.7863967, -0.785855, -0.7850582, -0.7844526, -0.7843769, -0.7848728, -0.7856622, -0.786303, -0.7864366, 
--0.7859889, -0.785211, -0.7845388, -0.7843483, -0.7847456, -0.7855077, -0.7862077, -0.7864539, -0.7861089, -0.7853665, 
--0.7846426, -0.7843423, -0.7846334, -0.7853522, -0.786096, -0.7864484, -0.7862127, -0.7855213, -0.7847617, -0.7843591, 
--0.7845385, -0.7851989, -0.7859702, -0.7864206, -0.7862982, -0.7856722, -0.7848934, -0.7843979, -0.7844627, -0.7850511, 
--0.7858332, -0.786371, -0.7863639, -0.7858162, -0.785035, -0.7844578, -0.7844075, -0.7849118, -0.7856878, -0.786301, 
--0.7864083, -0.7859501, -0.7851833, -0.7845375, -0.784374, -0.7847839, -0.7855373, -0.7862122, -0.7864308, -0.7860712, 
--0.7853352, -0.784635, -0.7843626, -0.7846701, -0.7853849, -0.7861065, -0.786431, -0.7861771, -0.7854874, -0.7847482, 
--0.7843735, -0.7845727, -0.7852338, -0.7859864, -0.7864091, -0.7862657, -0.7856367, -0.7848746, -0.7844063, -0.7844935, 
--0.7850871, -0.7858544, -0.7863657, -0.7863351, -0.78578, -0.7850115, -0.7844601, -0.7844341, -0.7849479, -0.7857133, 
--0.7863018, -0.786384, -0.7859143, -0.7851559, -0.7845337, -0.7843958, -0.7848192, -0.7855664, -0.7862189, -0.7864116, 
--0.7860368, -0.7853047, -0.7846254, -0.7843792, -0.7847035, -0.7854165, -0.7861188, -0.7864173, -0.786145, -0.7854548, 
--0.7847333, -0.7843844, -0.7846033, -0.785267, -0.7860038, -0.7864011, -0.7862367, -0.7856029, -0.7848549, -0.7844114, 
--0.7845206, -0.7851211, -0.7858763, -0.7863634, -0.7863099, -0.785746, -0.7849876, -0.7844595, -0.7844571, -0.7849816, 
--0.7857391, -0.7863053, -0.7863634, -0.785881, -0.7851286, -0.7845274, -0.7844141, -0.7848517, -0.7855951, -0.7862279, 
--0.7863959, -0.7860052, -0.7852748, -0.7846138, -0.7843923, -0.784734, -0.7854474, -0.786133, -0.7864069, -0.7861159, 
--0.7854232, -0.7847167, -0.7843921, -0.7846309, -0.7852992, -0.7860226, -0.7863962, -0.7862108, -0.7855705, -0.784834, 
--0.7844136, -0.7845446, -0.7851535, -0.7858992, -0.7863641, -0.786288, -0.7857138, -0.784963, -0.7844561, -0.7844768, 
--0.7850134, -0.7857653, -0.7863114, -0.786346, -0.7858498, -0.785101, -0.7845187, -0.784429, -0.784882, -0.7856239, 
--0.7862392, -0.7863834, -0.7859759, -0.7852451, -0.7846001, -0.7844021, -0.7847619, -0.7854779, -0.7861491, -0.7863996, 
--0.7860894, -0.7853921, -0.7846984, -0.7843967, -0.7846557, -0.7853305, -0.786043, -0.7863943, -0.7861878, -0.7855391, 
--0.7848117, -0.7844127, -0.7845656, -0.7851847, -0.7859232, -0.7863676, -0.7862691, -0.7856829, -0.7849373, -0.7844499, 
--0.7844935, -0.7850437, -0.7857923, -0.7863201, -0.7863316, -0.7858204, -0.7850728, -0.7845074, -0.7844409, -0.7849104, 
--0.785653, -0.7862529, -0.786374, -0.7859487, -0.7852151, -0.7845841, -0.7844089, -0.7847877, -0.7855084, -0.7861673, 
--0.7863955, -0.7860652, -0.7853614, -0.7846782, -0.7843982, -0.7846782, -0.7853614, -0.7860652, -0.7863955, -0.7861673, 
--0.7855084, -0.7847877, -0.7844089, -0.7845841, -0.7852151, -0.7859487, -0.786374, -0.7862529, -0.785653, -0.7849104, 
--0.7844409, -0.7845074, -0.7850728, -0.7858204, -0.7863316, -0.7863201, -0.7857923, -0.7850437, -0.7844935, -0.7844499, 
--0.7849373, -0.7856829, -0.7862691, -0.7863676, -0.7859232, -0.7851847, -0.7845656, -0.7844127, -0.7848117, -0.7855391, 
--0.7861878, -0.7863943, -0.786043, -0.7853305, -0.7846557, -0.7843967, -0.7846984, -0.7853921, -0.7860894, -0.7863996, 
--0.7861491, -0.7854779, -0.7847619, -0.7844021, -0.7846001, -0.7852451, -0.7859759, -0.7863834, -0.7862392, -0.7856239, 
--0.784882, -0.784429, -0.7845187, -0.785101, -0.7858498, -0.786346, -0.7863114, -0.7857653, -0.7850134, -0.7844768, 
--0.7844561, -0.784963, -0.7857138, -0.786288, -0.7863641, -0.7858992, -0.7851535, -0.7845446, -0.7844136, -0.784834, 
--0.7855705, -0.7862108, -0.7863962, -0.7860226, -0.7852992, -0.7846309, -0.7843921, -0.7847167, -0.7854232, -0.7861159, 
--0.7864069, -0.786133, -0.7854474, -0.784734, -0.7843923, -0.7846138, -0.7852748, -0.7860052, -0.7863959, -0.7862279, 
--0.7855951, -0.7848517, -0.7844141, -0.7845274, -0.7851286, -0.785881, -0.7863634, -0.7863053, -0.7857391, -0.7849816, 
--0.7844571, -0.7844595, -0.7849876, -0.785746, -0.7863099, -0.7863634, -0.7858763, -0.7851211, -0.7845206, -0.7844114, 
--0.7848549, -0.7856029, -0.7862367, -0.7864011, -0.7860038, -0.785267, -0.7846033, -0.7843844, -0.7847333, -0.7854548, 
--0.786145, -0.7864173, -0.7861188, -0.7854165, -0.7847035, -0.7843792, -0.7846254, -0.7853047, -0.7860368, -0.7864116, 
--0.7862189, -0.7855664, -0.7848192, -0.7843958, -0.7845337, -0.7851559, -0.7859143, -0.786384, -0.7863018, -0.7857133, 
--0.7849479, -0.7844341, -0.7844601, -0.7850115, -0.78578, -0.7863351, -0.7863657, -0.7858544, -0.7850871, -0.7844935, 
--0.7844063, -0.7848746, -0.7856367, -0.7862657, -0.7864091, -0.7859864, -0.7852338, -0.7845727, -0.7843735, -0.7847482, 
--0.7854874, -0.7861771, -0.786431, -0.7861065, -0.7853849, -0.7846701, -0.7843626, -0.784635, -0.7853352, -0.7860712, 
--0.7864308, -0.7862122, -0.7855373, -0.7847839, -0.784374, -0.7845375, -0.7851833, -0.7859501, -0.7864083, -0.786301, 
--0.7856878, -0.7849118, -0.7844075, -0.7844578, -0.785035, -0.7858162, -0.7863639, -0.786371, -0.7858332, -0.7850511, 
--0.7844627, -0.7843979, -0.7848934, -0.7856722, -0.7862982, -0.7864206, -0.7859702, -0.7851989, -0.7845385, -0.7843591, 
--0.7847617, -0.7855213, -0.7862127, -0.7864484, -0.786096, -0.7853522, -0.7846334, -0.7843423, -0.7846426, -0.7853665, 
--0.7861089, -0.7864539, -0.7862077, -0.7855077, -0.7847456, -0.7843483, -0.7845388, -0.785211, -0.7859889, -0.7864366, 
--0.786303, -0.7856622, -0.7848728, -0.7843769, -0.7844526, -0.7850582, -0.785855, -0.7863967, -0.7863795, -0.7858124, 
--0.7850126, -0.7844278, -0.7843861, -0.7849114, -0.7857101, -0.7863349, -0.7864356, -0.7859551, -0.7851619, -0.7845002, 
--0.7843408, -0.7847737, -0.785557, -0.7862523, -0.7864698, -0.7860871, -0.7853179, -0.7845927, -0.7843179, -0.7846481, 
--0.7853991, -0.7861504, -0.7864812, -0.7862055, -0.7854771, -0.7847035, -0.7843181, -0.7845375, -0.7852394, -0.7860313, 
--0.7864694, -0.7863078, -0.7856363, -0.7848304, -0.7843416, -0.7844443, -0.7850816, -0.7858972, -0.7864342, -0.7863915, 
--0.785792, -0.784971, -0.7843883, -0.7843706, -0.7849288, -0.7857508, -0.7863763, -0.7864546, -0.7859409, -0.7851224, 
--0.7844572, -0.7843184, -0.7847845, -0.7855951, -0.7862966, -0.7864956, -0.7860799, -0.7852815, -0.7845473, -0.7842889, 
--0.7846517, -0.7854334, -0.7861966, -0.7865134, -0.7862057, -0.785445, -0.7846569, -0.784283, -0.7845335, -0.785269, 
--0.786078, -0.7865073, -0.7863157, -0.7856095, -0.7847838, -0.7843011, -0.7844325, -0.7851053, -0.7859433, -0.7864771, 
--0.7864071, -0.7857716, -0.7849257, -0.7843432, -0.7843511, -0.7849458, -0.785795, -0.7864232, -0.786478, -0.7859276, 
--0.7850796, -0.7844087, -0.7842912, -0.784794, -0.7856362, -0.7863465, -0.7865264, -0.7860743, -0.7852425, -0.7844964, 
--0.7842545, -0.7846532, -0.7854701, -0.7862481, -0.7865511, -0.7862084, -0.785411, -0.784605, -0.7842421, -0.7845265, 
--0.7853, -0.78613, -0.7865512, -0.7863269, -0.7855817, -0.7847322, -0.7842544, -0.7844169, -0.7851297, -0.7859943, 
--0.7865263, -0.7864271, -0.7857509, -0.7848757, -0.7842917, -0.7843269, -0.7849625, -0.7858436, -0.7864767, -0.7865064, 
--0.785915, -0.7850327, -0.7843536, -0.7842587, -0.7848023, -0.785681, -0.7864029, -0.786563, -0.7860705, -0.7852001, 
--0.784439, -0.7842141, -0.7846524, -0.7855097, -0.7863062, -0.7865953, -0.7862139, -0.7853744, -0.7845466, -0.7841944, 
--0.7845163, -0.7853332, -0.7861882, -0.7866021, -0.786342, -0.7855522, -0.7846744, -0.7842005, -0.784397, -0.7851552, 
--0.7860511, -0.786583, -0.7864518, -0.7857296, -0.7848201, -0.7842327, -0.7842974, -0.7849793, -0.7858976, -0.7865379, 
--0.7865406, -0.7859029, -0.7849808, -0.7842906, -0.7842198, -0.7848095, -0.7857305, -0.7864672, -0.7866063, -0.7860684, 
--0.7851535, -0.7843737, -0.7841665, -0.7846493, -0.7855531, -0.7863721, -0.786647, -0.7862223, -0.7853346, -0.7844804, 
--0.7841388, -0.7845024, -0.7853691, -0.7862541, -0.7866613, -0.7863613, -0.7855205, -0.7846091, -0.7841379, -0.7843722, 
--0.7851822, -0.7861153, -0.7866486, -0.786482, -0.7857074, -0.7847574, -0.7841644, -0.7842617, -0.7849964, -0.7859582, 
--0.7866084, -0.7865817, -0.7858913, -0.7849226, -0.7842182, -0.7841736, -0.7848155, -0.7857858, -0.7865412, -0.7866576, 
--0.7860682, -0.7851015, -0.7842986, -0.7841103, -0.7846436, -0.7856014, -0.7864478, -0.7867078, -0.7862342, -0.7852905, 
--0.7844047, -0.7840736, -0.7844844, -0.7854087, -0.7863296, -0.7867307, -0.7863856, -0.7854859, -0.7845346, -0.7840649, 
--0.7843416, -0.7852115, -0.7861885, -0.786725, -0.786519, -0.7856838, -0.7846861, -0.7840849, -0.7842185, -0.785014, 
--0.7860272, -0.7866905, -0.7866309, -0.7858799, -0.7848565, -0.784134, -0.7841183, -0.7848204, -0.7858485, -0.786627, 
--0.7867187, -0.78607, -0.7850427, -0.7842117, -0.7840436, -0.7846348, -0.7856558, -0.7865354, -0.7867798, -0.7862501, 
--0.785241, -0.784317, -0.7839966, -0.7844613, -0.7854529, -0.7864168, -0.7868124, -0.786416, -0.7854475, -0.7844484, 
--0.7839789, -0.7843039, -0.7852437, -0.7862731, -0.786815, -0.7865639, -0.7856582, -0.7846037, -0.7839916, -0.7841664, 
--0.7850327, -0.7861067, -0.7867868, -0.7866902, -0.7858686, -0.7847804, -0.7840352, -0.7840521, -0.7848241, -0.7859206, 
--0.7867277, -0.7867917, -0.7860742, -0.7849751, -0.7841097, -0.7839641, -0.7846224, -0.7857182, -0.7866381, -0.7868656, 
--0.7862707, -0.7851843, -0.7842142, -0.7839049, -0.7844322, -0.7855032, -0.786519, -0.7869096, -0.7864536, -0.785404, 
--0.7843474, -0.7838766, -0.7842576, -0.7852799, -0.7863721, -0.7869219, -0.7866187, -0.7856298, -0.7845073, -0.7838806, 
--0.784103, -0.7850528, -0.7861998, -0.7869013, -0.786762, -0.7858571, -0.7846913, -0.7839178, -0.783972, -0.7848265, 
--0.7860049, -0.7868474, -0.7868799, -0.7860812, -0.7848963, -0.7839884, -0.7838681, -0.7846058, -0.7857909, -0.7867602, 
--0.786969, -0.7862972, -0.7851184, -0.784092, -0.7837944, -0.7843956, -0.7855616, -0.7866406, -0.7870266, -0.7865005, 
--0.7853537, -0.7842273, -0.7837534, -0.7842005, -0.7853215, -0.78649, -0.7870506, -0.7866862, -0.7855976, -0.7843926, 
--0.7837469, -0.7840252, -0.7850751, -0.7863106, -0.7870393, -0.78685, -0.7858452, -0.7845853, -0.7837763, -0.783874, 
--0.7848275, -0.7861053, -0.7869917, -0.7869876, -0.7860915, -0.7848024, -0.7838421, -0.7837509, -0.7845839, -0.7858774, 
--0.7869077, -0.7870953, -0.7863312, -0.7850401, -0.7839442, -0.7836595, -0.7843494, -0.7856309, -0.7867876, -0.7871697, 
--0.7865592, -0.7852942, -0.7840818, -0.7836028, -0.7841292, -0.7853704, -0.7866328, -0.7872081, -0.7867701, -0.78556, 
--0.7842534, -0.7835832, -0.7839287, -0.7851006, -0.7864452, -0.7872084, -0.7869591, -0.7858324, -0.7844565, -0.7836026, 
--0.7837525, -0.784827, -0.7862274, -0.7871691, -0.7871212, -0.7861059, -0.7846882, -0.7836621, -0.7836055, -0.784555, 
--0.7859827, -0.7870894, -0.7872521, -0.7863749, -0.7849448, -0.783762, -0.7834917, -0.7842905, -0.7857152, -0.7869693, 
--0.7873478, -0.7866336, -0.785222, -0.7839019, -0.783415, -0.7840391, -0.7854296, -0.7868098, -0.7874048, -0.7868762, 
--0.7855148, -0.7840806, -0.7833785, -0.7838066, -0.7851308, -0.7866124, -0.7874202, -0.787097, -0.785818, -0.7842961, 
--0.7833846, -0.7835988, -0.7848247, -0.7863795, -0.787392, -0.7872905, -0.7861257, -0.7845456, -0.7834353, -0.783421, 
--0.784517, -0.7861143, -0.7873187, -0.7874514, -0.7864317, -0.7848255, -0.7835315, -0.7832782, -0.7842142, -0.7858208, 
--0.7871996, -0.7875749, -0.7867298, -0.7851315, -0.7836733, -0.7831751, -0.7839226, -0.7855036, -0.7870351, -0.7876566, 
--0.7870133, -0.7854586, -0.7838602, -0.7831157, -0.7836488, -0.785168, -0.7868262, -0.7876928, -0.7872757, -0.7858011, 
--0.7840906, -0.7831035, -0.7833993, -0.78482, -0.786575, -0.7876803, -0.7875107, -0.786153, -0.784362, -0.7831413, 
--0.7831804, -0.784466, -0.7862842, -0.7876169, -0.7877119, -0.7865074, -0.7846712, -0.7832308, -0.7829983, -0.7841129, 
--0.7859576, -0.7875009, -0.7878734, -0.7868575, -0.785014, -0.7833733, -0.7828588, -0.7837678, -0.7855998, -0.7873318, 
--0.7879897, -0.7871958, -0.7853855, -0.7835689, -0.782767, -0.7834381, -0.785216, -0.7871098, -0.7880558, -0.787515, 
--0.78578, -0.783817, -0.7827277, -0.7831313, -0.7848125, -0.7868362, -0.7880673, -0.7878074, -0.7861909, -0.7841158, 
--0.782745, -0.7828551, -0.784396, -0.7865129, -0.7880204, -0.7880656, -0.7866113, -0.7844627, -0.7828222, -0.7826167, 
--0.7839737, -0.7861433, -0.7879122, -0.7882822, -0.7870334, -0.7848541, -0.7829619, -0.7824236, -0.7835538, -0.7857313, 
--0.7877406, -0.7884501, -0.7874491, -0.7852854, -0.7831657, -0.7822826, -0.7831443, -0.7852819, -0.7875045, -0.7885626, 
--0.78785, -0.7857513, -0.7834342, -0.7822003, -0.7827541, -0.784801, -0.7872035, -0.7886132, -0.7882273, -0.7862455, 
--0.7837674, -0.7821827, -0.7823921, -0.7842954, -0.7868384, -0.7885964, -0.7885719, -0.7867607, -0.784164, -0.7822354, 
--0.7820673, -0.7837726, -0.7864109, -0.7885067, -0.7888746, -0.7872891, -0.7846219, -0.7823631, -0.7817889, -0.7832408, 
--0.7859234, -0.7883398, -0.7891264, -0.7878221, -0.785138, -0.7825702, -0.781566, -0.7827088, -0.7853796, -0.7880917, 
--0.7893181, -0.7883505, -0.7857083, -0.7828601, -0.7814078, -0.7821864, -0.784784, -0.7877593, -0.7894405, -0.7888645, 
--0.786328, -0.7832357, -0.7813233, -0.7816834, -0.7841418, -0.7873399, -0.7894848, -0.7893539, -0.7869912, -0.7836994, 
--0.7813216, -0.7812105, -0.7834591, -0.7868316, -0.7894418, -0.7898076, -0.7876917, -0.7842527, -0.7814114, -0.7807786, 
--0.7827426, -0.7862329, -0.7893028, -0.7902146, -0.7884223, -0.7848971, -0.781602, -0.7803995, -0.7819998, -0.7855425, 
--0.7890583, -0.7905628, -0.7891755, -0.7856338, -0.7819027, -0.7800852, -0.7812383, -0.7847592, -0.788699, -0.79084, 
--0.7899432, -0.786464, -0.7823234, -0.7798486, -0.7804664, -0.7838816, -0.7882142, -0.7910326, -0.7907173, -0.7873897, 
--0.7828753, -0.7797036, -0.7796923, -0.7829071, -0.7875918, -0.7911261, -0.7914893, -0.7884141, -0.7835717, -0.7796657, 
--0.7789243, -0.7818314, -0.7868173, -0.791104, -0.7922511, -0.7895427, -0.784429, -0.7797526, -0.7781706, -0.7806474, 
--0.7858717, -0.790947, -0.792995, -0.790785, -0.7854691, -0.7799857, -0.7774385, -0.7793429, -0.7847295, -0.790631, 
--0.7937137, -0.7921568, -0.7867227, -0.7803925, -0.7767345, -0.7778975, -0.7833535, -0.7901243, -0.7944016, -0.7936844, 
--0.7882348, -0.78101, -0.7760635, -0.7762768, -0.7816881, -0.7893826, -0.7950553, -0.7954125, -0.7900755, -0.7818924, 
--0.775427, -0.7744224, -0.779644, -0.7883387, -0.7956755, -0.7974182, -0.7923597, -0.7831242, -0.7748211, -0.7722315, 
--0.7770708, -0.7868841, -0.7962712, -0.799841, -0.7952882, -0.7848484, -0.7742289, -0.7695116, -0.7736946, -0.7848262, 
--0.7968709, -0.8029519, -0.799244, -0.7873311, -0.7736033, -0.7658701, -0.7689645, -0.7817854, -0.7975543, -0.8073396, 
--0.8050486, -0.7911333, -0.7728048, -0.7603856, -0.7615984, -0.776895, -0.798578, -0.8145303, -0.8148206, -0.797671, 
--0.7713228, -0.7503299, -0.7478171, -0.7676694, -0.8010819, -0.8299519, -0.8360744, -0.8117564, -0.7661243, -0.7229719, 
--0.7099487, -0.7434061, -0.8160202, -0.8938323, -0.9255315, -0.8612618, -0.6735258, -0.3711809, 0.0, 0.371181, 
-0.6735268, 0.8612641, 0.9255346, 0.8938346, 0.8160198, 0.7434021, 0.7099425, 0.7229669, 0.7661239, 0.8117619, 
-0.8360836, 0.8299599, 0.8010836, 0.7676629, 0.7478051, 0.7503188, 0.7713193, 0.7976781, 0.8148352, 0.8145448, 
-0.7985838, 0.7768878, 0.7615813, 0.7603677, 0.7727965, 0.7911402, 0.8050678, 0.8073609, 0.7975655, 0.7817794, 
-0.7689435, 0.7658453, 0.7735888, 0.7873359, 0.7992664, 0.8029801, 0.7968889, 0.7848231, 0.7736711, 0.7694801, 
-0.774207, 0.7848492, 0.7953123, 0.7998756, 0.7962971, 0.786886, 0.7770466, 0.7721939, 0.774791, 0.7831192, 
-0.7923836, 0.7974584, 0.7957098, 0.7883473, 0.7796209, 0.7743798, 0.7753884, 0.7818799, 0.7900972, 0.7954572, 
-0.7950984, 0.7893994, 0.7816682, 0.7762304, 0.7760161, 0.7809885, 0.7882522, 0.793732, 0.7944533, 0.7901507, 
-0.783339, 0.7778491, 0.7766788, 0.7803608, 0.7867337, 0.7922054, 0.7937734, 0.7906681, 0.7847224, 0.7792946, 
-0.7773752, 0.779943, 0.7854718, 0.7908326, 0.7930616, 0.7909954, 0.7858741, 0.7806013, 0.7781009, 0.7796984, 
-0.7844213, 0.7895869, 0.7923234, 0.791164, 0.7868308, 0.7817898, 0.77885, 0.7796, 0.783552, 0.7884525, 
-0.7915653, 0.7911974, 0.7876181, 0.7828725, 0.7796152, 0.7796268, 0.7828422, 0.7874198, 0.7907948, 0.7911146, 
-0.7882544, 0.7838565, 0.7803889, 0.7797616, 0.7822758, 0.7864834, 0.7900199, 0.7909316, 0.7887541, 0.784746, 
-0.7811631, 0.7799894, 0.78184, 0.7856403, 0.7892486, 0.7906624, 0.7891286, 0.7855433, 0.7819295, 0.7802967, 
-0.7815242, 0.7848886, 0.788489, 0.79032, 0.7893881, 0.7862496, 0.7826802, 0.7806712, 0.7813188, 0.7842274, 
-0.787749, 0.7899165, 0.7895416, 0.7868658, 0.7834075, 0.7811009, 0.781215, 0.783656, 0.7870363, 0.7894633, 
-0.7895977, 0.7873927, 0.7841039, 0.7815748, 0.7812044, 0.7831733, 0.786358, 0.7889714, 0.789565, 0.7878314, 
-0.7847624, 0.782082, 0.7812784, 0.7827782, 0.7857208, 0.7884515, 0.7894518, 0.7881833, 0.7853768, 0.7826121, 
-0.7814286, 0.782469, 0.7851306, 0.7879138, 0.7892668, 0.7884504, 0.7859415, 0.783155, 0.7816464, 0.7822435, 
-0.7845928, 0.7873679, 0.7890184, 0.7886352, 0.7864514, 0.7837014, 0.7819231, 0.7820986, 0.7841117, 0.7868233, 
-0.7887155, 0.788741, 0.7869027, 0.7842421, 0.7822499, 0.7820308, 0.7836911, 0.7862886, 0.788367, 0.7887719, 
-0.787292, 0.7847687, 0.7826179, 0.7820358, 0.7833337, 0.7857721, 0.7879818, 0.7887323, 0.7876171, 0.7852733, 
-0.7830181, 0.7821086, 0.7830413, 0.7852812, 0.7875688, 0.7886276, 0.7878766, 0.7857488, 0.7834417, 0.7822438, 
-0.7828148, 0.7848228, 0.7871368, 0.7884635, 0.78807, 0.7861887, 0.78388, 0.7824352, 0.7826542, 0.7844028, 
-0.7866944, 0.7882464, 0.788198, 0.7865874, 0.7843244, 0.7826762, 0.7825586, 0.7840265, 0.7862501, 0.7879831, 
-0.7882618, 0.7869402, 0.7847667, 0.7829599, 0.782526, 0.7836981, 0.7858117, 0.7876808, 0.7882637, 0.7872433, 
-0.7851992, 0.783279, 0.7825539, 0.7834211, 0.7853869, 0.7873469, 0.7882069, 0.7874936, 0.7856146, 0.7836259, 
-0.7826386, 0.783198, 0.7849826, 0.7869889, 0.7880953, 0.7876892, 0.7860061, 0.7839931, 0.7827761, 0.7830302, 
-0.7846053, 0.7866145, 0.7879333, 0.7878291, 0.7863678, 0.7843728, 0.7829613, 0.7829184, 0.7842607, 0.7862312, 
-0.7877262, 0.787913, 0.7866941, 0.7847577, 0.7831889, 0.7828622, 0.7839537, 0.7858467, 0.7874796, 0.7879417, 
-0.7869806, 0.7851402, 0.7834528, 0.7828604, 0.7836886, 0.7854679, 0.7871998, 0.787917, 0.7872235, 0.7855134, 
-0.7837469, 0.7829111, 0.7834687, 0.7851019, 0.7868933, 0.7878412, 0.7874198, 0.7858706, 0.7840643, 0.7830112, 
-0.7832965, 0.784755, 0.7865667, 0.7877176, 0.7875676, 0.7862058, 0.7843983, 0.7831571, 0.7831735, 0.7844331, 
-0.7862269, 0.7875503, 0.7876656, 0.7865132, 0.7847421, 0.7833447, 0.7831004, 0.7841414, 0.7858808, 0.7873438, 
-0.7877137, 0.786788, 0.7850888, 0.7835689, 0.7830772, 0.7838846, 0.7855351, 0.7871031, 0.7877124, 0.7870258, 
-0.7854318, 0.7838245, 0.7831026, 0.7836665, 0.7851965, 0.786834, 0.7876632, 0.7872233, 0.7857645, 0.7841057, 
-0.783175, 0.7834903, 0.7848713, 0.7865424, 0.7875684, 0.7873777, 0.7860808, 0.7844063, 0.7832915, 0.7833581, 
-0.7845652, 0.7862344, 0.7874309, 0.7874872, 0.7863752, 0.7847201, 0.783449, 0.7832715, 0.7842838, 0.7859163, 
-0.7872545, 0.7875508, 0.7866424, 0.7850408, 0.7836434, 0.7832311, 0.7840319, 0.7855947, 0.7870434, 0.7875682, 
-0.7868779, 0.7853619, 0.78387, 0.7832366, 0.7838138, 0.7852757, 0.7868025, 0.7875401, 0.7870779, 0.7856773, 
-0.7841239, 0.7832869, 0.7836329, 0.7849654, 0.786537, 0.7874679, 0.787239, 0.7859808, 0.7843995, 0.7833803, 
-0.7834921, 0.7846699, 0.7862526, 0.787354, 0.7873589, 0.786267, 0.7846912, 0.7835141, 0.7833934, 0.7843945, 
-0.7859551, 0.7872011, 0.787436, 0.7865303, 0.7849929, 0.7836851, 0.7833381, 0.7841444, 0.7856507, 0.787013, 
-0.7874694, 0.7867661, 0.7852986, 0.7838893, 0.7833266, 0.783924, 0.7853452, 0.7867938, 0.7874591, 0.7869701, 
-0.7856023, 0.7841223, 0.7833585, 0.7837372, 0.7850448, 0.7865482, 0.7874059, 0.7871388, 0.785898, 0.7843792, 
-0.7834327, 0.7835874, 0.7847553, 0.7862814, 0.7873113, 0.7872692, 0.78618, 0.7846546, 0.7835471, 0.783477, 
-0.7844822, 0.7859989, 0.7871777, 0.7873592, 0.7864429, 0.7849429, 0.7836992, 0.7834078, 0.7842307, 0.7857063, 
-0.787008, 0.7874074, 0.7866817, 0.7852383, 0.7838856, 0.7833808, 0.7840057, 0.7854095, 0.7868058, 0.7874131, 
-0.7868919, 0.785535, 0.7841024, 0.7833963, 0.7838113, 0.7851144, 0.7865755, 0.7873765, 0.7870696, 0.7858271, 
-0.7843452, 0.7834536, 0.7836512, 0.7848268, 0.7863216, 0.7872987, 0.7872113, 0.7861088, 0.7846089, 0.7835515, 
-0.7835285, 0.7845523, 0.7860493, 0.7871813, 0.7873144, 0.7863746, 0.7848883, 0.7836879, 0.7834454, 0.7842964, 
-0.7857642, 0.7870267, 0.7873771, 0.7866193, 0.7851778, 0.7838599, 0.7834035, 0.7840641, 0.7854717, 0.7868381, 
-0.7873981, 0.7868381, 0.7854717, 0.7840641, 0.7834035, 0.7838599, 0.7851778, 0.7866193, 0.7873771, 0.7870267, 
-0.7857642, 0.7842964, 0.7834454, 0.7836879, 0.7848883, 0.7863746, 0.7873144, 0.7871813, 0.7860493, 0.7845523, 
-0.7835285, 0.7835515, 0.7846089, 0.7861088, 0.7872113, 0.7872987, 0.7863216, 0.7848268, 0.7836512, 0.7834536, 
-0.7843452, 0.7858271, 0.7870696, 0.7873765, 0.7865755, 0.7851144, 0.7838113, 0.7833963, 0.7841024, 0.785535, 
-0.7868919, 0.7874131, 0.7868058, 0.7854095, 0.7840057, 0.7833808, 0.7838856, 0.7852383, 0.7866817, 0.7874074, 
-0.787008, 0.7857063, 0.7842307, 0.7834078, 0.7836992, 0.7849429, 0.7864429, 0.7873592, 0.7871777, 0.7859989, 
-0.7844822, 0.783477, 0.7835471, 0.7846546, 0.78618, 0.7872692, 0.7873113, 0.7862814, 0.7847553, 0.7835874, 
-0.7834327, 0.7843792, 0.785898, 0.7871388, 0.7874059, 0.7865482, 0.7850448, 0.7837372, 0.7833585, 0.7841223, 
-0.7856023, 0.7869701, 0.7874591, 0.7867938, 0.7853452, 0.783924, 0.7833266, 0.7838893, 0.7852986, 0.7867661, 
-0.7874694, 0.787013, 0.7856507, 0.7841444, 0.7833381, 0.7836851, 0.7849929, 0.7865303, 0.787436, 0.7872011, 
-0.7859551, 0.7843945, 0.7833934, 0.7835141, 0.7846912, 0.786267, 0.7873589, 0.787354, 0.7862526, 0.7846699, 
-0.7834921, 0.7833803, 0.7843995, 0.7859808, 0.787239, 0.7874679, 0.786537, 0.7849654, 0.7836329, 0.7832869, 
-0.7841239, 0.7856773, 0.7870779, 0.7875401, 0.7868025, 0.7852757, 0.7838138, 0.7832366, 0.78387, 0.7853619, 
-0.7868779, 0.7875682, 0.7870434, 0.7855947, 0.7840319, 0.7832311, 0.7836434, 0.7850408, 0.7866424, 0.7875508, 
-0.7872545, 0.7859163, 0.7842838, 0.7832715, 0.783449, 0.7847201, 0.7863752, 0.7874872, 0.7874309, 0.7862344, 
-0.7845652, 0.7833581, 0.7832915, 0.7844063, 0.7860808, 0.7873777, 0.7875684, 0.7865424, 0.7848713, 0.7834903, 
-0.783175, 0.7841057, 0.7857645, 0.7872233, 0.7876632, 0.786834, 0.7851965, 0.7836665, 0.7831026, 0.7838245, 
-0.7854318, 0.7870258, 0.7877124, 0.7871031, 0.7855351, 0.7838846, 0.7830772, 0.7835689, 0.7850888, 0.786788, 
-0.7877137, 0.7873438, 0.7858808, 0.7841414, 0.7831004, 0.7833447, 0.7847421, 0.7865132, 0.7876656, 0.7875503, 
-0.7862269, 0.7844331, 0.7831735, 0.7831571, 0.7843983, 0.7862058, 0.7875676, 0.7877176, 0.7865667, 0.784755, 
-0.7832965, 0.7830112, 0.7840643, 0.7858706, 0.7874198, 0.7878412, 0.7868933, 0.7851019, 0.7834687, 0.7829111, 
-0.7837469, 0.7855134, 0.7872235, 0.787917, 0.7871998, 0.7854679, 0.7836886, 0.7828604, 0.7834528, 0.7851402, 
-0.7869806, 0.7879417, 0.7874796, 0.7858467, 0.7839537, 0.7828622, 0.7831889, 0.7847577, 0.7866941, 0.787913, 
-0.7877262, 0.7862312, 0.7842607, 0.7829184, 0.7829613, 0.7843728, 0.7863678, 0.7878291, 0.7879333, 0.7866145, 
-0.7846053, 0.7830302, 0.7827761, 0.7839931, 0.7860061, 0.7876892, 0.7880953, 0.7869889, 0.7849826, 0.783198, 
-0.7826386, 0.7836259, 0.7856146, 0.7874936, 0.7882069, 0.7873469, 0.7853869, 0.7834211, 0.7825539, 0.783279, 
-0.7851992, 0.7872433, 0.7882637, 0.7876808, 0.7858117, 0.7836981, 0.782526, 0.7829599, 0.7847667, 0.7869402, 
-0.7882618, 0.7879831, 0.7862501, 0.7840265, 0.7825586, 0.7826762, 0.7843244, 0.7865874, 0.788198, 0.7882464, 
-0.7866944, 0.7844028, 0.7826542, 0.7824352, 0.78388, 0.7861887, 0.78807, 0.7884635, 0.7871368, 0.7848228, 
-0.7828148, 0.7822438, 0.7834417, 0.7857488, 0.7878766, 0.7886276, 0.7875688, 0.7852812, 0.7830413, 0.7821086, 
-0.7830181, 0.7852733, 0.7876171, 0.7887323, 0.7879818, 0.7857721, 0.7833337, 0.7820358, 0.7826179, 0.7847687, 
-0.787292, 0.7887719, 0.788367, 0.7862886, 0.7836911, 0.7820308, 0.7822499, 0.7842421, 0.7869027, 0.788741, 
-0.7887155, 0.7868233, 0.7841117, 0.7820986, 0.7819231, 0.7837014, 0.7864514, 0.7886352, 0.7890184, 0.7873679, 
-0.7845928, 0.7822435, 0.7816464, 0.783155, 0.7859415, 0.7884504, 0.7892668, 0.7879138, 0.7851306, 0.782469, 
-0.7814286, 0.7826121, 0.7853768, 0.7881833, 0.7894518, 0.7884515, 0.7857208, 0.7827782, 0.7812784, 0.782082, 
-0.7847624, 0.7878314, 0.789565, 0.7889714, 0.786358, 0.7831733, 0.7812044, 0.7815748, 0.7841039, 0.7873927, 
-0.7895977, 0.7894633, 0.7870363, 0.783656, 0.781215, 0.7811009, 0.7834075, 0.7868658, 0.7895416, 0.7899165, 
-0.787749, 0.7842274, 0.7813188, 0.7806712, 0.7826802, 0.7862496, 0.7893881, 0.79032, 0.788489, 0.7848886, 
-0.7815242, 0.7802967, 0.7819295, 0.7855433, 0.7891286, 0.7906624, 0.7892486, 0.7856403, 0.78184, 0.7799894, 
-0.7811631, 0.784746, 0.7887541, 0.7909316, 0.7900199, 0.7864834, 0.7822758, 0.7797616, 0.7803889, 0.7838565, 
-0.7882544, 0.7911146, 0.7907948, 0.7874198, 0.7828422, 0.7796268, 0.7796152, 0.7828725, 0.7876181, 0.7911974, 
-0.7915653, 0.7884525, 0.783552, 0.7796, 0.77885, 0.7817898, 0.7868308, 0.791164, 0.7923234, 0.7895869, 
-0.7844213, 0.7796984, 0.7781009, 0.7806013, 0.7858741, 0.7909954, 0.7930616, 0.7908326, 0.7854718, 0.779943, 
-0.7773752, 0.7792946, 0.7847224, 0.7906681, 0.7937734, 0.7922054, 0.7867337, 0.7803608, 0.7766788, 0.7778491, 
-0.783339, 0.7901507, 0.7944533, 0.793732, 0.7882522, 0.7809885, 0.7760161, 0.7762304, 0.7816682, 0.7893994, 
-0.7950984, 0.7954572, 0.7900972, 0.7818799, 0.7753884, 0.7743798, 0.7796209, 0.7883473, 0.7957098, 0.7974584, 
-0.7923836, 0.7831192, 0.774791, 0.7721939, 0.7770466, 0.786886, 0.7962971, 0.7998756, 0.7953123, 0.7848492, 
-0.774207, 0.7694801, 0.7736711, 0.7848231, 0.7968889, 0.8029801, 0.7992664, 0.7873359, 0.7735888, 0.7658453, 
-0.7689435, 0.7817794, 0.7975655, 0.8073609, 0.8050678, 0.7911402, 0.7727965, 0.7603677, 0.7615813, 0.7768878, 
-0.7985838, 0.8145448, 0.8148352, 0.7976781, 0.7713193, 0.7503188, 0.7478051, 0.7676629, 0.8010836, 0.8299599, 
-0.8360836, 0.8117619, 0.7661239, 0.7229669, 0.7099425, 0.7434021, 0.8160198, 0.8938346, 0.9255346, 0.8612641, 
-0.6735268, 0.371181, 0.0, -0.371181, -0.6735268, -0.8612641, -0.9255346, -0.8938346, -0.8160198, -0.7434021, 
--0.7099425, -0.7229669, -0.7661239, -0.8117619, -0.8360836, -0.8299599, -0.8010836, -0.7676629, -0.7478051, -0.7503188, 
--0.7713193, -0.7976781, -0.8148352, -0.8145448, -0.7985838, -0.7768878, -0.7615813, -0.7603677, -0.7727965, -0.7911402, 
--0.8050678, -0.8073609, -0.7975655, -0.7817794, -0.7689435, -0.7658453, -0.7735888, -0.7873359, -0.7992664, -0.8029801, 
--0.7968889, -0.7848231, -0.7736711, -0.7694801, -0.774207, -0.7848492, -0.7953123, -0.7998756, -0.7962971, -0.786886, 
--0.7770466, -0.7721939, -0.774791, -0.7831192, -0.7923836, -0.7974584, -0.7957098, -0.7883473, -0.7796209, -0.7743798, 
--0.7753884, -0.7818799, -0.7900972, -0.7954572, -0.7950984, -0.7893994, -0.7816682, -0.7762304, -0.7760161, -0.7809885, 
--0.7882522, -0.793732, -0.7944533, -0.7901507, -0.783339, -0.7778491, -0.7766788, -0.7803608, -0.7867337, -0.7922054, 
--0.7937734, -0.7906681, -0.7847224, -0.7792946, -0.7773752, -0.779943, -0.7854718, -0.7908326, -0.7930616, -0.7909954, 
--0.7858741, -0.7806013, -0.7781009, -0.7796984, -0.7844213, -0.7895869, -0.7923234, -0.791164, -0.7868308, -0.7817898, 
--0.77885, -0.7796, -0.783552, -0.7884525, -0.7915653, -0.7911974, -0.7876181, -0.7828725, -0.7796152, -0.7796268, 
--0.7828422, -0.7874198, -0.7907948, -0.7911146, -0.7882544, -0.7838565, -0.7803889, -0.7797616, -0.7822758, -0.7864834, 
--0.7900199, -0.7909316, -0.7887541, -0.784746, -0.7811631, -0.7799894, -0.78184, -0.7856403, -0.7892486, -0.7906624, 
--0.7891286, -0.7855433, -0.7819295, -0.7802967, -0.7815242, -0.7848886, -0.788489, -0.79032, -0.7893881, -0.7862496, 
--0.7826802, -0.7806712, -0.7813188, -0.7842274, -0.787749, -0.7899165, -0.7895416, -0.7868658, -0.7834075, -0.7811009, 
--0.781215, -0.783656, -0.7870363, -0.7894633, -0.7895977, -0.7873927, -0.7841039, -0.7815748, -0.7812044, -0.7831733, 
--0.786358, -0.7889714, -0.789565, -0.7878314, -0.7847624, -0.782082, -0.7812784, -0.7827782, -0.7857208, -0.7884515, 
--0.7894518, -0.7881833, -0.7853768, -0.7826121, -0.7814286, -0.782469, -0.7851306, -0.7879138, -0.7892668, -0.7884504, 
--0.7859415, -0.783155, -0.7816464, -0.7822435, -0.7845928, -0.7873679, -0.7890184, -0.7886352, -0.7864514, -0.7837014, 
--0.7819231, -0.7820986, -0.7841117, -0.7868233, -0.7887155, -0.788741, -0.7869027, -0.7842421, -0.7822499, -0.7820308, 
--0.7836911, -0.7862886, -0.788367, -0.7887719, -0.787292, -0.7847687, -0.7826179, -0.7820358, -0.7833337, -0.7857721, 
--0.7879818, -0.7887323, -0.7876171, -0.7852733, -0.7830181, -0.7821086, -0.7830413, -0.7852812, -0.7875688, -0.7886276, 
--0.7878766, -0.7857488, -0.7834417, -0.7822438, -0.7828148, -0.7848228, -0.7871368, -0.7884635, -0.78807, -0.7861887, 
--0.78388, -0.7824352, -0.7826542, -0.7844028, -0.7866944, -0.7882464, -0.788198, -0.7865874, -0.7843244, -0.7826762, 
--0.7825586, -0.7840265, -0.7862501, -0.7879831, -0.7882618, -0.7869402, -0.7847667, -0.7829599, -0.782526, -0.7836981, 
--0.7858117, -0.7876808, -0.7882637, -0.7872433, -0.7851992, -0.783279, -0.7825539, -0.7834211, -0.7853869, -0.7873469, 
--0.7882069, -0.7874936, -0.7856146, -0.7836259, -0.7826386, -0.783198, -0.7849826, -0.7869889, -0.7880953, -0.7876892, 
--0.7860061, -0.7839931, -0.7827761, -0.7830302, -0.7846053, -0.7866145, -0.7879333, -0.7878291, -0.7863678, -0.7843728, 
--0.7829613, -0.7829184, -0.7842607, -0.7862312, -0.7877262, -0.787913, -0.7866941, -0.7847577, -0.7831889, -0.7828622, 
--0.7839537, -0.7858467, -0.7874796, -0.7879417, -0.7869806, -0.7851402, -0.7834528, -0.7828604, -0.7836886, -0.7854679, 
--0.7871998, -0.787917, -0.7872235, -0.7855134, -0.7837469, -0.7829111, -0.7834687, -0.7851019, -0.7868933, -0.7878412, 
--0.7874198, -0.7858706, -0.7840643, -0.7830112, -0.7832965, -0.784755, -0.7865667, -0.7877176, -0.7875676, -0.7862058, 
--0.7843983, -0.7831571, -0.7831735, -0.7844331, -0.7862269, -0.7875503, -0.7876656, -0.7865132, -0.7847421, -0.7833447, 
--0.7831004, -0.7841414, -0.7858808, -0.7873438, -0.7877137, -0.786788, -0.7850888, -0.7835689, -0.7830772, -0.7838846, 
--0.7855351, -0.7871031, -0.7877124, -0.7870258, -0.7854318, -0.7838245, -0.7831026, -0.7836665, -0.7851965, -0.786834, 
--0.7876632, -0.7872233, -0.7857645, -0.7841057, -0.783175, -0.7834903, -0.7848713, -0.7865424, -0.7875684, -0.7873777, 
--0.7860808, -0.7844063, -0.7832915, -0.7833581, -0.7845652, -0.7862344, -0.7874309, -0.7874872, -0.7863752, -0.7847201, 
--0.783449, -0.7832715, -0.7842838, -0.7859163, -0.7872545, -0.7875508, -0.7866424, -0.7850408, -0.7836434, -0.7832311, 
--0.7840319, -0.7855947, -0.7870434, -0.7875682, -0.7868779, -0.7853619, -0.78387, -0.7832366, -0.7838138, -0.7852757, 
--0.7868025, -0.7875401, -0.7870779, -0.7856773, -0.7841239, -0.7832869, -0.7836329, -0.7849654, -0.786537, -0.7874679, 
--0.787239, -0.7859808, -0.7843995, -0.7833803, -0.7834921, -0.7846699, -0.7862526, -0.787354, -0.7873589, -0.786267, 
--0.7846912, -0.7835141, -0.7833934, -0.7843945, -0.7859551, -0.7872011, -0.787436, -0.7865303, -0.7849929, -0.7836851, 
--0.7833381, -0.7841444, -0.7856507, -0.787013, -0.7874694, -0.7867661, -0.7852986, -0.7838893, -0.7833266, -0.783924, 
--0.7853452, -0.7867938, -0.7874591, -0.7869701, -0.7856023, -0.7841223, -0.7833585, -0.7837372, -0.7850448, -0.7865482, 
--0.7874059, -0.7871388, -0.785898, -0.7843792, -0.7834327, -0.7835874, -0.7847553, -0.7862814, -0.7873113, -0.7872692, 
--0.78618, -0.7846546, -0.7835471, -0.783477, -0.7844822, -0.7859989, -0.7871777, -0.7873592, -0.7864429, -0.7849429, 
--0.7836992, -0.7834078, -0.7842307, -0.7857063, -0.787008, -0.7874074, -0.7866817, -0.7852383, -0.7838856, -0.7833808, 
--0.7840057, -0.7854095, -0.7868058, -0.7874131, -0.7868919, -0.785535, -0.7841024, -0.7833963, -0.7838113, -0.7851144, 
--0.7865755, -0.7873765, -0.7870696, -0.7858271, -0.7843452, -0.7834536, -0.7836512, -0.7848268, -0.7863216, -0.7872987, 
--0.7872113, -0.7861088, -0.7846089, -0.7835515, -0.7835285, -0.7845523, -0.7860493, -0.7871813, -0.7873144, -0.7863746, 
--0.7848883, -0.7836879, -0.7834454, -0.7842964, -0.7857642, -0.7870267, -0.7873771, -0.7866193, -0.7851778, -0.7838599, 
--0.7834035, -0.7840641, -0.7854717, -0.7868381, -0.7873981, -0.7868381, -0.7854717, -0.7840641, -0.7834035, -0.7838599, 
--0.7851778, -0.7866193, -0.7873771, -0.7870267, -0.7857642, -0.7842964, -0.7834454, -0.7836879, -0.7848883, -0.7863746, 
--0.7873144, -0.7871813, -0.7860493, -0.7845523, -0.7835285, -0.7835515, -0.7846089, -0.7861088, -0.7872113, -0.7872987, 
--0.7863216, -0.7848268, -0.7836512, -0.7834536, -0.7843452, -0.7858271, -0.7870696, -0.7873765, -0.7865755, -0.7851144, 
--0.7838113, -0.7833963, -0.7841024, -0.785535, -0.7868919, -0.7874131, -0.7868058, -0.7854095, -0.7840057, -0.7833808, 
--0.7838856, -0.7852383, -0.7866817, -0.7874074, -0.787008, -0.7857063, -0.7842307, -0.7834078, -0.7836992, -0.7849429, 
--0.7864429, -0.7873592, -0.7871777, -0.7859989, -0.7844822, -0.783477, -0.7835471, -0.7846546, -0.78618, -0.7872692, 
--0.7873113, -0.7862814, -0.7847553, -0.7835874, -0.7834327, -0.7843792, -0.785898, -0.7871388, -0.7874059, -0.7865482, 
--0.7850448, -0.7837372, -0.7833585, -0.7841223, -0.7856023, -0.7869701, -0.7874591, -0.7867938, -0.7853452, -0.783924, 
--0.7833266, -0.7838893, -0.7852986, -0.7867661, -0.7874694, -0.787013, -0.7856507, -0.7841444, -0.7833381, -0.7836851, 
--0.7849929, -0.7865303, -0.787436, -0.7872011, -0.7859551, -0.7843945, -0.7833934, -0.7835141, -0.7846912, -0.786267, 
--0.7873589, -0.787354, -0.7862526, -0.7846699, -0.7834921, -0.7833803, -0.7843995, -0.7859808, -0.787239, -0.7874679, 
--0.786537, -0.7849654, -0.7836329, -0.7832869, -0.7841239, -0.7856773, -0.7870779, -0.7875401, -0.7868025, -0.7852757, 
--0.7838138, -0.7832366, -0.78387, -0.7853619, -0.7868779, -0.7875682, -0.7870434, -0.7855947, -0.7840319, -0.7832311, 
--0.7836434, -0.7850408, -0.7866424, -0.7875508, -0.7872545, -0.7859163, -0.7842838, -0.7832715, -0.783449, -0.7847201, 
--0.7863752, -0.7874872, -0.7874309, -0.7862344, -0.7845652, -0.7833581, -0.7832915, -0.7844063, -0.7860808, -0.7873777, 
--0.7875684, -0.7865424, -0.7848713, -0.7834903, -0.783175, -0.7841057, -0.7857645, -0.7872233, -0.7876632, -0.786834, 
--0.7851965, -0.7836665, -0.7831026, -0.7838245, -0.7854318, -0.7870258, -0.7877124, -0.7871031, -0.7855351, -0.7838846, 
--0.7830772, -0.7835689, -0.7850888, -0.786788, -0.7877137, -0.7873438, -0.7858808, -0.7841414, -0.7831004, -0.7833447, 
--0.7847421, -0.7865132, -0.7876656, -0.7875503, -0.7862269, -0.7844331, -0.7831735, -0.7831571, -0.7843983, -0.7862058, 
--0.7875676, -0.7877176, -0.7865667, -0.784755, -0.7832965, -0.7830112, -0.7840643, -0.7858706, -0.7874198, -0.7878412, 
--0.7868933, -0.7851019, -0.7834687, -0.7829111, -0.7837469, -0.7855134, -0.7872235, -0.787917, -0.7871998, -0.7854679, 
--0.7836886, -0.7828604, -0.7834528, -0.7851402, -0.7869806, -0.7879417, -0.7874796, -0.7858467, -0.7839537, -0.7828622, 
--0.7831889, -0.7847577, -0.7866941, -0.787913, -0.7877262, -0.7862312, -0.7842607, -0.7829184, -0.7829613, -0.7843728, 
--0.7863678, -0.7878291, -0.7879333, -0.7866145, -0.7846053, -0.7830302, -0.7827761, -0.7839931, -0.7860061, -0.7876892, 
--0.7880953, -0.7869889, -0.7849826, -0.783198, -0.7826386, -0.7836259, -0.7856146, -0.7874936, -0.7882069, -0.7873469, 
--0.7853869, -0.7834211, -0.7825539, -0.783279, -0.7851992, -0.7872433, -0.7882637, -0.7876808, -0.7858117, -0.7836981, 
--0.782526, -0.7829599, -0.7847667, -0.7869402, -0.7882618, -0.7879831, -0.7862501, -0.7840265, -0.7825586, -0.7826762, 
--0.7843244, -0.7865874, -0.788198, -0.7882464, -0.7866944, -0.7844028, -0.7826542, -0.7824352, -0.78388, -0.7861887, 
--0.78807, -0.7884635, -0.7871368, -0.7848228, -0.7828148, -0.7822438, -0.7834417, -0.7857488, -0.7878766, -0.7886276, 
--0.7875688, -0.7852812, -0.7830413, -0.7821086, -0.7830181, -0.7852733, -0.7876171, -0.7887323, -0.7879818, -0.7857721, 
--0.7833337, -0.7820358, -0.7826179, -0.7847687, -0.787292, -0.7887719, -0.788367, -0.7862886, -0.7836911, -0.7820308, 
--0.7822499, -0.7842421, -0.7869027, -0.788741, -0.7887155, -0.7868233, -0.7841117, -0.7820986, -0.7819231, -0.7837014, 
--0.7864514, -0.7886352, -0.7890184, -0.7873679, -0.7845928, -0.7822435, -0.7816464, -0.783155, -0.7859415, -0.7884504, 
--0.7892668, -0.7879138, -0.7851306, -0.782469, -0.7814286, -0.7826121, -0.7853768, -0.7881833, -0.7894518, -0.7884515, 
--0.7857208, -0.7827782, -0.7812784, -0.782082, -0.7847624, -0.7878314, -0.789565, -0.7889714, -0.786358, -0.7831733, 
--0.7812044, -0.7815748, -0.7841039, -0.7873927, -0.7895977, -0.7894633, -0.7870363, -0.783656, -0.781215, -0.7811009, 
--0.7834075, -0.7868658, -0.7895416, -0.7899165, -0.787749, -0.7842274, -0.7813188, -0.7806712, -0.7826802, -0.7862496, 
--0.7893881, -0.79032, -0.788489, -0.7848886, -0.7815242, -0.7802967, -0.7819295, -0.7855433, -0.7891286, -0.7906624, 
--0.7892486, -0.7856403, -0.78184, -0.7799894, -0.7811631, -0.784746, -0.7887541, -0.7909316, -0.7900199, -0.7864834, 
--0.7822758, -0.7797616, -0.7803889, -0.7838565, -0.7882544, -0.7911146, -0.7907948, -0.7874198, -0.7828422, -0.7796268, 
--0.7796152, -0.7828725, -0.7876181, -0.7911974, -0.7915653, -0.7884525, -0.783552, -0.7796, -0.77885, -0.7817898, 
--0.7868308, -0.791164, -0.7923234, -0.7895869, -0.7844213, -0.7796984, -0.7781009, -0.7806013, -0.7858741, -0.7909954, 
--0.7930616, -0.7908326, -0.7854718, -0.779943, -0.7773752, -0.7792946, -0.7847224, -0.7906681, -0.7937734, -0.7922054, 
--0.7867337, -0.7803608, -0.7766788, -0.7778491, -0.783339, -0.7901507, -0.7944533, -0.793732, -0.7882522, -0.7809885, 
--0.7760161, -0.7762304, -0.7816682, -0.7893994, -0.7950984, -0.7954572, -0.7900972, -0.7818799, -0.7753884, -0.7743798, 
--0.7796209, -0.7883473, -0.7957098, -0.7974584, -0.7923836, -0.7831192, -0.774791, -0.7721939, -0.7770466, -0.786886, 
--0.7962971, -0.7998756, -0.7953123, -0.7848492, -0.774207, -0.7694801, -0.7736711, -0.7848231, -0.7968889, -0.8029801, 
--0.7992664, -0.7873359, -0.7735888, -0.7658453, -0.7689435, -0.7817794, -0.7975655, -0.8073609, -0.8050678, -0.7911402, 
--0.7727965, -0.7603677, -0.7615813, -0.7768878, -0.7985838, -0.8145448, -0.8148352, -0.7976781, -0.7713193, -0.7503188, 
--0.7478051, -0.7676629, -0.8010836, -0.8299599, -0.8360836, -0.8117619, -0.7661239, -0.7229669, -0.7099425, -0.7434021, 
--0.8160198, -0.8938346, -0.9255346, -0.8612641, -0.6735268, -0.371181, 0.0, 0.3684034, 0.6695182, 0.8582565, 
-0.9252028, 0.8963634, 0.8200012, 0.7466193, 0.710604, 0.7207041, 0.7621965, 0.8083567, 0.8350968, 0.8319413, 
-0.8049303, 0.7712331, 0.7491107, 0.7486324, 0.7675794, 0.7939669, 0.8132194, 0.8159246, 0.8021914, 0.7807149, 
-0.7634967, 0.7593042, 0.7693456, 0.787223, 0.8028657, 0.8081006, 0.8008361, 0.7857602, 0.7714179, 0.7654348, 
-0.7705209, 0.7833182, 0.796536, 0.8030581, 0.7997329, 0.7888504, 0.7766393, 0.7697357, 0.7716065, 0.7808396, 
-0.792126, 0.7992875, 0.798636, 0.7908508, 0.7804299, 0.7731111, 0.77273, 0.7792263, 0.7888259, 0.7962176, 
-0.7974783, 0.7921418, 0.7833293, 0.7759365, 0.7739251, 0.7782098, 0.7862629, 0.7935942, 0.7962457, 0.7929199, 
-0.7856028, 0.7783878, 0.7751934, 0.7776419, 0.7842438, 0.791294, 0.7949448, 0.7933002, 0.7873943, 0.780552, 
-0.7765228, 0.7774305, 0.7826591, 0.789255, 0.7935916, 0.7933585, 0.7887889, 0.7824732, 0.7778946, 0.7775115, 
-0.7814411, 0.7874464, 0.7922068, 0.7931505, 0.7898414, 0.7841727, 0.7792867, 0.7778355, 0.7805445, 0.7858537, 
-0.7908134, 0.7927208, 0.7905903, 0.7856601, 0.7806753, 0.7783612, 0.7799359, 0.7844708, 0.7894357, 0.7921083, 
-0.7910655, 0.7869389, 0.7820361, 0.7790516, 0.7795877, 0.7832959, 0.7880977, 0.7913486, 0.7912928, 0.7880101, 
-0.7833452, 0.7798722, 0.7794753, 0.7823283, 0.7868231, 0.7904753, 0.7912962, 0.7888744, 0.7845799, 0.7807901, 
-0.7795749, 0.781567, 0.7856338, 0.7895206, 0.7910995, 0.7895334, 0.7857188, 0.7817738, 0.7798627, 0.7810094, 
-0.78455, 0.7885157, 0.7907269, 0.7899906, 0.786743, 0.7827926, 0.7803139, 0.780651, 0.7835895, 0.7874903, 
-0.7902035, 0.7902521, 0.7876361, 0.7838173, 0.7809031, 0.7804843, 0.7827671, 0.7864732, 0.7895551, 0.7903265, 
-0.7883848, 0.7848202, 0.781604, 0.7804993, 0.7820946, 0.7854911, 0.7888084, 0.7902253, 0.788979, 0.7857753, 
-0.7823896, 0.780683, 0.7815804, 0.7845688, 0.7879908, 0.7899629, 0.7894121, 0.7866592, 0.7832325, 0.7810199, 
-0.7812291, 0.7837287, 0.7871295, 0.7895562, 0.7896813, 0.7874506, 0.7841054, 0.7814916, 0.7810419, 0.7829904, 
-0.7862516, 0.7890246, 0.7897873, 0.7881316, 0.7849816, 0.7820778, 0.781016, 0.7823704, 0.7853836, 0.7883895, 
-0.7897346, 0.7886872, 0.7858351, 0.7827561, 0.7811452, 0.781882, 0.7845506, 0.787674, 0.7895314, 0.789106, 
-0.7866416, 0.7835027, 0.7814196, 0.7815347, 0.7837763, 0.7869024, 0.789189, 0.7893803, 0.7873785, 0.784293, 
-0.7818263, 0.7813344, 0.7830819, 0.7860997, 0.788722, 0.7895061, 0.7880255, 0.7851018, 0.7823492, 0.7812832, 
-0.7824866, 0.785291, 0.7881478, 0.7894833, 0.7885651, 0.785904, 0.7829697, 0.7813792, 0.7820063, 0.7845013, 
-0.7874862, 0.7893154, 0.7889829, 0.7866752, 0.783667, 0.781617, 0.7816538, 0.7837545, 0.7867589, 0.78901, 
-0.7892677, 0.787392, 0.7844186, 0.7819875, 0.7814386, 0.7830732, 0.785989, 0.7885777, 0.789412, 0.7880327, 
-0.7852007, 0.7824781, 0.7813662, 0.7824781, 0.7852007, 0.7880327, 0.789412, 0.7885777, 0.785989, 0.7830732, 
-0.7814386, 0.7819875, 0.7844186, 0.787392, 0.7892677, 0.78901, 0.7867589, 0.7837545, 0.7816538, 0.781617, 
-0.783667, 0.7866752, 0.7889829, 0.7893154, 0.7874862, 0.7845013, 0.7820063, 0.7813792, 0.7829697, 0.785904, 
-0.7885651, 0.7894833, 0.7881478, 0.785291, 0.7824866, 0.7812832, 0.7823492, 0.7851018, 0.7880255, 0.7895061, 
-0.788722, 0.7860997, 0.7830819, 0.7813344, 0.7818263, 0.784293, 0.7873785, 0.7893803, 0.789189, 0.7869024, 
-0.7837763, 0.7815347, 0.7814196, 0.7835027, 0.7866416, 0.789106, 0.7895314, 0.787674, 0.7845506, 0.781882, 
-0.7811452, 0.7827561, 0.7858351, 0.7886872, 0.7897346, 0.7883895, 0.7853836, 0.7823704, 0.781016, 0.7820778, 
-0.7849816, 0.7881316, 0.7897873, 0.7890246, 0.7862516, 0.7829904, 0.7810419, 0.7814916, 0.7841054, 0.7874506, 
-0.7896813, 0.7895562, 0.7871295, 0.7837287, 0.7812291, 0.7810199, 0.7832325, 0.7866592, 0.7894121, 0.7899629, 
-0.7879908, 0.7845688, 0.7815804, 0.780683, 0.7823896, 0.7857753, 0.788979, 0.7902253, 0.7888084, 0.7854911, 
-0.7820946, 0.7804993, 0.781604, 0.7848202, 0.7883848, 0.7903265, 0.7895551, 0.7864732, 0.7827671, 0.7804843, 
-0.7809031, 0.7838173, 0.7876361, 0.7902521, 0.7902035, 0.7874903, 0.7835895, 0.780651, 0.7803139, 0.7827926, 
-0.786743, 0.7899906, 0.7907269, 0.7885157, 0.78455, 0.7810094, 0.7798627, 0.7817738, 0.7857188, 0.7895334, 
-0.7910995, 0.7895206, 0.7856338, 0.781567, 0.7795749, 0.7807901, 0.7845799, 0.7888744, 0.7912962, 0.7904753, 
-0.7868231, 0.7823283, 0.7794753, 0.7798722, 0.7833452, 0.7880101, 0.7912928, 0.7913486, 0.7880977, 0.7832959, 
-0.7795877, 0.7790516, 0.7820361, 0.7869389, 0.7910655, 0.7921083, 0.7894357, 0.7844708, 0.7799359, 0.7783612, 
-0.7806753, 0.7856601, 0.7905903, 0.7927208, 0.7908134, 0.7858537, 0.7805445, 0.7778355, 0.7792867, 0.7841727, 
-0.7898414, 0.7931505, 0.7922068, 0.7874464, 0.7814411, 0.7775115, 0.7778946, 0.7824732, 0.7887889, 0.7933585, 
-0.7935916, 0.789255, 0.7826591, 0.7774305, 0.7765228, 0.780552, 0.7873943, 0.7933002, 0.7949448, 0.791294, 
-0.7842438, 0.7776419, 0.7751934, 0.7783878, 0.7856028, 0.7929199, 0.7962457, 0.7935942, 0.7862629, 0.7782098, 
-0.7739251, 0.7759365, 0.7833293, 0.7921418, 0.7974783, 0.7962176, 0.7888259, 0.7792263, 0.77273, 0.7731111, 
-0.7804299, 0.7908508, 0.798636, 0.7992875, 0.792126, 0.7808396, 0.7716065, 0.7697357, 0.7766393, 0.7888504, 
-0.7997329, 0.8030581, 0.796536, 0.7833182, 0.7705209, 0.7654348, 0.7714179, 0.7857602, 0.8008361, 0.8081006, 
-0.8028657, 0.787223, 0.7693456, 0.7593042, 0.7634967, 0.7807149, 0.8021914, 0.8159246, 0.8132194, 0.7939669, 
-0.7675794, 0.7486324, 0.7491107, 0.7712331, 0.8049303, 0.8319413, 0.8350968, 0.8083567, 0.7621965, 0.7207041, 
-0.710604, 0.7466193, 0.8200012, 0.8963634, 0.9252028, 0.8582565, 0.6695182, 0.3684034, 0.0, -0.3684034, 
--0.6695182, -0.8582565, -0.9252028, -0.8963634, -0.8200012, -0.7466193, -0.710604, -0.7207041, -0.7621965, -0.8083567, 
--0.8350968, -0.8319413, -0.8049303, -0.7712331, -0.7491107, -0.7486324, -0.7675794, -0.7939669, -0.8132194, -0.8159246, 
--0.8021914, -0.7807149, -0.7634967, -0.7593042, -0.7693456, -0.787223, -0.8028657, -0.8081006, -0.8008361, -0.7857602, 
--0.7714179, -0.7654348, -0.7705209, -0.7833182, -0.796536, -0.8030581, -0.7997329, -0.7888504, -0.7766393, -0.7697357, 
--0.7716065, -0.7808396, -0.792126, -0.7992875, -0.798636, -0.7908508, -0.7804299, -0.7731111, -0.77273, -0.7792263, 
--0.7888259, -0.7962176, -0.7974783, -0.7921418, -0.7833293, -0.7759365, -0.7739251, -0.7782098, -0.7862629, -0.7935942, 
--0.7962457, -0.7929199, -0.7856028, -0.7783878, -0.7751934, -0.7776419, -0.7842438, -0.791294, -0.7949448, -0.7933002, 
--0.7873943, -0.780552, -0.7765228, -0.7774305, -0.7826591, -0.789255, -0.7935916, -0.7933585, -0.7887889, -0.7824732, 
--0.7778946, -0.7775115, -0.7814411, -0.7874464, -0.7922068, -0.7931505, -0.7898414, -0.7841727, -0.7792867, -0.7778355, 
--0.7805445, -0.7858537, -0.7908134, -0.7927208, -0.7905903, -0.7856601, -0.7806753, -0.7783612, -0.7799359, -0.7844708, 
--0.7894357, -0.7921083, -0.7910655, -0.7869389, -0.7820361, -0.7790516, -0.7795877, -0.7832959, -0.7880977, -0.7913486, 
--0.7912928, -0.7880101, -0.7833452, -0.7798722, -0.7794753, -0.7823283, -0.7868231, -0.7904753, -0.7912962, -0.7888744, 
--0.7845799, -0.7807901, -0.7795749, -0.781567, -0.7856338, -0.7895206, -0.7910995, -0.7895334, -0.7857188, -0.7817738, 
--0.7798627, -0.7810094, -0.78455, -0.7885157, -0.7907269, -0.7899906, -0.786743, -0.7827926, -0.7803139, -0.780651, 
--0.7835895, -0.7874903, -0.7902035, -0.7902521, -0.7876361, -0.7838173, -0.7809031, -0.7804843, -0.7827671, -0.7864732, 
--0.7895551, -0.7903265, -0.7883848, -0.7848202, -0.781604, -0.7804993, -0.7820946, -0.7854911, -0.7888084, -0.7902253, 
--0.788979, -0.7857753, -0.7823896, -0.780683, -0.7815804, -0.7845688, -0.7879908, -0.7899629, -0.7894121, -0.7866592, 
--0.7832325, -0.7810199, -0.7812291, -0.7837287, -0.7871295, -0.7895562, -0.7896813, -0.7874506, -0.7841054, -0.7814916, 
--0.7810419, -0.7829904, -0.7862516, -0.7890246, -0.7897873, -0.7881316, -0.7849816, -0.7820778, -0.781016, -0.7823704, 
--0.7853836, -0.7883895, -0.7897346, -0.7886872, -0.7858351, -0.7827561, -0.7811452, -0.781882, -0.7845506, -0.787674, 
--0.7895314, -0.789106, -0.7866416, -0.7835027, -0.7814196, -0.7815347, -0.7837763, -0.7869024, -0.789189, -0.7893803, 
--0.7873785, -0.784293, -0.7818263, -0.7813344, -0.7830819, -0.7860997, -0.788722, -0.7895061, -0.7880255, -0.7851018, 
--0.7823492, -0.7812832, -0.7824866, -0.785291, -0.7881478, -0.7894833, -0.7885651, -0.785904, -0.7829697, -0.7813792, 
--0.7820063, -0.7845013, -0.7874862, -0.7893154, -0.7889829, -0.7866752, -0.783667, -0.781617, -0.7816538, -0.7837545, 
--0.7867589, -0.78901, -0.7892677, -0.787392, -0.7844186, -0.7819875, -0.7814386, -0.7830732, -0.785989, -0.7885777, 
--0.789412, -0.7880327, -0.7852007, -0.7824781, -0.7813662, -0.7824781, -0.7852007, -0.7880327, -0.789412, -0.7885777, 
--0.785989, -0.7830732, -0.7814386, -0.7819875, -0.7844186, -0.787392, -0.7892677, -0.78901, -0.7867589, -0.7837545, 
--0.7816538, -0.781617, -0.783667, -0.7866752, -0.7889829, -0.7893154, -0.7874862, -0.7845013, -0.7820063, -0.7813792, 
--0.7829697, -0.785904, -0.7885651, -0.7894833, -0.7881478, -0.785291, -0.7824866, -0.7812832, -0.7823492, -0.7851018, 
--0.7880255, -0.7895061, -0.788722, -0.7860997, -0.7830819, -0.7813344, -0.7818263, -0.784293, -0.7873785, -0.7893803, 
--0.789189, -0.7869024, -0.7837763, -0.7815347, -0.7814196, -0.7835027, -0.7866416, -0.789106, -0.7895314, -0.787674, 
--0.7845506, -0.781882, -0.7811452, -0.7827561, -0.7858351, -0.7886872, -0.7897346, -0.7883895, -0.7853836, -0.7823704, 
--0.781016, -0.7820778, -0.7849816, -0.7881316, -0.7897873, -0.7890246, -0.7862516, -0.7829904, -0.7810419, -0.7814916, 
--0.7841054, -0.7874506, -0.7896813, -0.7895562, -0.7871295, -0.7837287, -0.7812291, -0.7810199, -0.7832325, -0.7866592, 
--0.7894121, -0.7899629, -0.7879908, -0.7845688, -0.7815804, -0.780683, -0.7823896, -0.7857753, -0.788979, -0.7902253, 
--0.7888084, -0.7854911, -0.7820946, -0.7804993, -0.781604, -0.7848202, -0.7883848, -0.7903265, -0.7895551, -0.7864732, 
--0.7827671, -0.7804843, -0.7809031, -0.7838173, -0.7876361, -0.7902521, -0.7902035, -0.7874903, -0.7835895, -0.780651, 
--0.7803139, -0.7827926, -0.786743, -0.7899906, -0.7907269, -0.7885157, -0.78455, -0.7810094, -0.7798627, -0.7817738, 
--0.7857188, -0.7895334, -0.7910995, -0.7895206, -0.7856338, -0.781567, -0.7795749, -0.7807901, -0.7845799, -0.7888744, 
--0.7912962, -0.7904753, -0.7868231, -0.7823283, -0.7794753, -0.7798722, -0.7833452, -0.7880101, -0.7912928, -0.7913486, 
--0.7880977, -0.7832959, -0.7795877, -0.7790516, -0.7820361, -0.7869389, -0.7910655, -0.7921083, -0.7894357, -0.7844708, 
--0.7799359, -0.7783612, -0.7806753, -0.7856601, -0.7905903, -0.7927208, -0.7908134, -0.7858537, -0.7805445, -0.7778355, 
--0.7792867, -0.7841727, -0.7898414, -0.7931505, -0.7922068, -0.7874464, -0.7814411, -0.7775115, -0.7778946, -0.7824732, 
--0.7887889, -0.7933585, -0.7935916, -0.789255, -0.7826591, -0.7774305, -0.7765228, -0.780552, -0.7873943, -0.7933002, 
--0.7949448, -0.791294, -0.7842438, -0.7776419, -0.7751934, -0.7783878, -0.7856028, -0.7929199, -0.7962457, -0.7935942, 
--0.7862629, -0.7782098, -0.7739251, -0.7759365, -0.7833293, -0.7921418, -0.7974783, -0.7962176, -0.7888259, -0.7792263, 
--0.77273, -0.7731111, -0.7804299, -0.7908508, -0.798636, -0.7992875, -0.792126, -0.7808396, -0.7716065, -0.7697357, 
--0.7766393, -0.7888504, -0.7997329, -0.8030581, -0.796536, -0.7833182, -0.7705209, -0.7654348, -0.7714179, -0.7857602, 
--0.8008361, -0.8081006, -0.8028657, -0.787223, -0.7693456, -0.7593042, -0.7634967, -0.7807149, -0.8021914, -0.8159246, 
--0.8132194, -0.7939669, -0.7675794, -0.7486324, -0.7491107, -0.7712331, -0.8049303, -0.8319413, -0.8350968, -0.8083567, 
--0.7621965, -0.7207041, -0.710604, -0.7466193, -0.8200012, -0.8963634, -0.9252028, -0.8582565, -0.6695182, -0.3684034, 
-0.0, 0.3684057, 0.6695332, 0.8582931, 0.9252536, 0.8964021, 0.819996, 0.7465561, 0.7105037, 0.7206186, 
-0.7621823, 0.8084381, 0.835244, 0.832078, 0.8049734, 0.7711425, 0.7489205, 0.7484409, 0.7674985, 0.794057, 
-0.8134474, 0.8161729, 0.8023184, 0.7806354, 0.7632373, 0.7589983, 0.7691648, 0.7872815, 0.8031489, 0.8084637, 
-0.8010775, 0.7857333, 0.7711194, 0.7650164, 0.7702131, 0.7833031, 0.7968404, 0.8035284, 0.800112, 0.788918, 
-0.7763396, 0.7692182, 0.7711526, 0.7807095, 0.7924101, 0.7998461, 0.7991671, 0.791053, 0.7801733, 0.7725189, 
-0.7721209, 0.778943, 0.7890427, 0.7968345, 0.7981649, 0.7925145, 0.7831648, 0.7753051, 0.773163, 0.7777405, 
-0.7863622, 0.7942287, 0.7970796, 0.7934921, 0.7855816, 0.7777627, 0.774293, 0.7769618, 0.7841741, 0.7918961, 
-0.7959047, 0.7940919, 0.7875674, 0.7799876, 0.775512, 0.776525, 0.7823705, 0.7897663, 0.7946429, 0.7943784, 
-0.7892044, 0.7820313, 0.7768148, 0.7763783, 0.780888, 0.7878022, 0.7933013, 0.794394, 0.7905418, 0.7839203, 
-0.7781928, 0.7764866, 0.7796883, 0.7859852, 0.7918897, 0.7941681, 0.7916095, 0.7856672, 0.7796351, 0.7768245, 
-0.778748, 0.7843076, 0.7904197, 0.7937232, 0.792426, 0.7872756, 0.7811296, 0.7773722, 0.7780525, 0.7827688, 
-0.788904, 0.7930768, 0.7930027, 0.788744, 0.782663, 0.7781136, 0.7775929, 0.7813723, 0.7873563, 0.7922437, 
-0.7933464, 0.7900669, 0.7842215, 0.7790351, 0.7773643, 0.7801248, 0.7857907, 0.7912367, 0.7934606, 0.7912367, 
-0.7857907, 0.7801248, 0.7773643, 0.7790351, 0.7842215, 0.7900669, 0.7933464, 0.7922437, 0.7873563, 0.7813723, 
-0.7775929, 0.7781136, 0.782663, 0.788744, 0.7930027, 0.7930768, 0.788904, 0.7827688, 0.7780525, 0.7773722, 
-0.7811296, 0.7872756, 0.792426, 0.7937232, 0.7904197, 0.7843076, 0.778748, 0.7768245, 0.7796351, 0.7856672, 
-0.7916095, 0.7941681, 0.7918897, 0.7859852, 0.7796883, 0.7764866, 0.7781928, 0.7839203, 0.7905418, 0.794394, 
-0.7933013, 0.7878022, 0.780888, 0.7763783, 0.7768148, 0.7820313, 0.7892044, 0.7943784, 0.7946429, 0.7897663, 
-0.7823705, 0.776525, 0.775512, 0.7799876, 0.7875674, 0.7940919, 0.7959047, 0.7918961, 0.7841741, 0.7769618, 
-0.774293, 0.7777627, 0.7855816, 0.7934921, 0.7970796, 0.7942287, 0.7863622, 0.7777405, 0.773163, 0.7753051, 
-0.7831648, 0.7925145, 0.7981649, 0.7968345, 0.7890427, 0.778943, 0.7721209, 0.7725189, 0.7801733, 0.791053, 
-0.7991671, 0.7998461, 0.7924101, 0.7807095, 0.7711526, 0.7692182, 0.7763396, 0.788918, 0.800112, 0.8035284, 
-0.7968404, 0.7833031, 0.7702131, 0.7650164, 0.7711194, 0.7857333, 0.8010775, 0.8084637, 0.8031489, 0.7872815, 
-0.7691648, 0.7589983, 0.7632373, 0.7806354, 0.8023184, 0.8161729, 0.8134474, 0.794057, 0.7674985, 0.7484409, 
-0.7489205, 0.7711425, 0.8049734, 0.832078, 0.835244, 0.8084381, 0.7621823, 0.7206186, 0.7105037, 0.7465561, 
-0.819996, 0.8964021, 0.9252536, 0.8582931, 0.6695332, 0.3684057, 0.0, -0.3684057, -0.6695332, -0.8582931, 
--0.9252536, -0.8964021, -0.819996, -0.7465561, -0.7105037, -0.7206186, -0.7621823, -0.8084381, -0.835244, -0.832078, 
--0.8049734, -0.7711425, -0.7489205, -0.7484409, -0.7674985, -0.794057, -0.8134474, -0.8161729, -0.8023184, -0.7806354, 
--0.7632373, -0.7589983, -0.7691648, -0.7872815, -0.8031489, -0.8084637, -0.8010775, -0.7857333, -0.7711194, -0.7650164, 
--0.7702131, -0.7833031, -0.7968404, -0.8035284, -0.800112, -0.788918, -0.7763396, -0.7692182, -0.7711526, -0.7807095, 
--0.7924101, -0.7998461, -0.7991671, -0.791053, -0.7801733, -0.7725189, -0.7721209, -0.778943, -0.7890427, -0.7968345, 
--0.7981649, -0.7925145, -0.7831648, -0.7753051, -0.773163, -0.7777405, -0.7863622, -0.7942287, -0.7970796, -0.7934921, 
--0.7855816, -0.7777627, -0.774293, -0.7769618, -0.7841741, -0.7918961, -0.7959047, -0.7940919, -0.7875674, -0.7799876, 
--0.775512, -0.776525, -0.7823705, -0.7897663, -0.7946429, -0.7943784, -0.7892044, -0.7820313, -0.7768148, -0.7763783, 
--0.780888, -0.7878022, -0.7933013, -0.794394, -0.7905418, -0.7839203, -0.7781928, -0.7764866, -0.7796883, -0.7859852, 
--0.7918897, -0.7941681, -0.7916095, -0.7856672, -0.7796351, -0.7768245, -0.778748, -0.7843076, -0.7904197, -0.7937232, 
--0.792426, -0.7872756, -0.7811296, -0.7773722, -0.7780525, -0.7827688, -0.788904, -0.7930768, -0.7930027, -0.788744, 
--0.782663, -0.7781136, -0.7775929, -0.7813723, -0.7873563, -0.7922437, -0.7933464, -0.7900669, -0.7842215, -0.7790351, 
--0.7773643, -0.7801248, -0.7857907, -0.7912367, -0.7934606, -0.7912367, -0.7857907, -0.7801248, -0.7773643, -0.7790351, 
--0.7842215, -0.7900669, -0.7933464, -0.7922437, -0.7873563, -0.7813723, -0.7775929, -0.7781136, -0.782663, -0.788744, 
--0.7930027, -0.7930768, -0.788904, -0.7827688, -0.7780525, -0.7773722, -0.7811296, -0.7872756, -0.792426, -0.7937232, 
--0.7904197, -0.7843076, -0.778748, -0.7768245, -0.7796351, -0.7856672, -0.7916095, -0.7941681, -0.7918897, -0.7859852, 
--0.7796883, -0.7764866, -0.7781928, -0.7839203, -0.7905418, -0.794394, -0.7933013, -0.7878022, -0.780888, -0.7763783, 
--0.7768148, -0.7820313, -0.7892044, -0.7943784, -0.7946429, -0.7897663, -0.7823705, -0.776525, -0.775512, -0.7799876, 
--0.7875674, -0.7940919, -0.7959047, -0.7918961, -0.7841741, -0.7769618, -0.774293, -0.7777627, -0.7855816, -0.7934921, 
--0.7970796, -0.7942287, -0.7863622, -0.7777405, -0.773163, -0.7753051, -0.7831648, -0.7925145, -0.7981649, -0.7968345, 
--0.7890427, -0.778943, -0.7721209, -0.7725189, -0.7801733, -0.791053, -0.7991671, -0.7998461, -0.7924101, -0.7807095, 
--0.7711526, -0.7692182, -0.7763396, -0.788918, -0.800112, -0.8035284, -0.7968404, -0.7833031, -0.7702131, -0.7650164, 
--0.7711194, -0.7857333, -0.8010775, -0.8084637, -0.8031489, -0.7872815, -0.7691648, -0.7589983, -0.7632373, -0.7806354, 
--0.8023184, -0.8161729, -0.8134474, -0.794057, -0.7674985, -0.7484409, -0.7489205, -0.7711425, -0.8049734, -0.832078, 
--0.835244, -0.8084381, -0.7621823, -0.7206186, -0.7105037, -0.7465561, -0.819996, -0.8964021, -0.9252536, -0.8582931, 
--0.6695332, -0.3684057, 0.0, 0.357257, 0.6532433, 0.8456413, 0.9230625, 0.9058601, 0.8360134, 0.7605025, 
-0.7148557, 0.7130161, 0.7467072, 0.7934242, 0.8287912, 0.8376851, 0.8196422, 0.7869805, 0.7573846, 0.7449432, 
-0.7538913, 0.7776524, 0.8030903, 0.817475, 0.8146198, 0.7973379, 0.7753414, 0.7599491, 0.7583995, 0.7705587, 
-0.7894704, 0.8052321, 0.8100927, 0.8021928, 0.7861746, 0.7705264, 0.7631433, 0.7673939, 0.7806298, 0.7957733, 
-0.8050616, 0.8039888, 0.7934621, 0.7791543, 0.7684753, 0.7667634, 0.7746392, 0.787824, 0.7994442, 0.8035921, 
-0.7983104, 0.7865014, 0.7743462, 0.7680871, 0.7708384, 0.7810478, 0.7933617, 0.801419, 0.801122, 0.79271, 
-0.7805921, 0.7710461, 0.7689805, 0.7754212, 0.7870049, 0.7977283, 0.8020464, 0.7977283, 0.7870049, 0.7754212, 
-0.7689805, 0.7710461, 0.7805921, 0.79271, 0.801122, 0.801419, 0.7933617, 0.7810478, 0.7708384, 0.7680871, 
-0.7743462, 0.7865014, 0.7983104, 0.8035921, 0.7994442, 0.787824, 0.7746392, 0.7667634, 0.7684753, 0.7791543, 
-0.7934621, 0.8039888, 0.8050616, 0.7957733, 0.7806298, 0.7673939, 0.7631433, 0.7705264, 0.7861746, 0.8021928, 
-0.8100927, 0.8052321, 0.7894704, 0.7705587, 0.7583995, 0.7599491, 0.7753414, 0.7973379, 0.8146198, 0.817475, 
-0.8030903, 0.7776524, 0.7538913, 0.7449432, 0.7573846, 0.7869805, 0.8196422, 0.8376851, 0.8287912, 0.7934242, 
-0.7467072, 0.7130161, 0.7148557, 0.7605025, 0.8360134, 0.9058601, 0.9230625, 0.8456413, 0.6532433, 0.357257, 
-0.0, -0.357257, -0.6532433, -0.8456413, -0.9230625, -0.9058601, -0.8360134, -0.7605025, -0.7148557, -0.7130161, 
--0.7467072, -0.7934242, -0.8287912, -0.8376851, -0.8196422, -0.7869805, -0.7573846, -0.7449432, -0.7538913, -0.7776524, 
--0.8030903, -0.817475, -0.8146198, -0.7973379, -0.7753414, -0.7599491, -0.7583995, -0.7705587, -0.7894704, -0.8052321, 
--0.8100927, -0.8021928, -0.7861746, -0.7705264, -0.7631433, -0.7673939, -0.7806298, -0.7957733, -0.8050616, -0.8039888, 
--0.7934621, -0.7791543, -0.7684753, -0.7667634, -0.7746392, -0.787824, -0.7994442, -0.8035921, -0.7983104, -0.7865014, 
--0.7743462, -0.7680871, -0.7708384, -0.7810478, -0.7933617, -0.801419, -0.801122, -0.79271, -0.7805921, -0.7710461, 
--0.7689805, -0.7754212, -0.7870049, -0.7977283, -0.8020464, -0.7977283, -0.7870049, -0.7754212, -0.7689805, -0.7710461, 
--0.7805921, -0.79271, -0.801122, -0.801419, -0.7933617, -0.7810478, -0.7708384, -0.7680871, -0.7743462, -0.7865014, 
--0.7983104, -0.8035921, -0.7994442, -0.787824, -0.7746392, -0.7667634, -0.7684753, -0.7791543, -0.7934621, -0.8039888, 
--0.8050616, -0.7957733, -0.7806298, -0.7673939, -0.7631433, -0.7705264, -0.7861746, -0.8021928, -0.8100927, -0.8052321, 
--0.7894704, -0.7705587, -0.7583995, -0.7599491, -0.7753414, -0.7973379, -0.8146198, -0.817475, -0.8030903, -0.7776524, 
--0.7538913, -0.7449432, -0.7573846, -0.7869805, -0.8196422, -0.8376851, -0.8287912, -0.7934242, -0.7467072, -0.7130161, 
--0.7148557, -0.7605025, -0.8360134, -0.9058601, -0.9230625, -0.8456413, -0.6532433, -0.357257, 0.0, 0.3795373, 
-0.6857068, 0.8706478, 0.926993, 0.8865189, 0.8038518, 0.7329854, 0.7069989, 0.7292099, 0.7782685, 0.823238, 
-0.8405684, 0.8248418, 0.7889719, 0.7550765, 0.741689, 0.754236, 0.7833915, 0.8114567, 0.8227158, 0.811934, 
-0.7865528, 0.7617938, 0.7517458, 0.7615277, 0.7847918, 0.8077305, 0.8171289, 0.8078509, 0.7855878, 0.7634263, 
-0.754268, 0.7634263, 0.7855878, 0.8078509, 0.8171289, 0.8077305, 0.7847918, 0.7615277, 0.7517458, 0.7617938, 
-0.7865528, 0.811934, 0.8227158, 0.8114567, 0.7833915, 0.754236, 0.741689, 0.7550765, 0.7889719, 0.8248418, 
-0.8405684, 0.823238, 0.7782685, 0.7292099, 0.7069989, 0.7329854, 0.8038518, 0.8865189, 0.926993, 0.8706478, 
-0.6857068, 0.3795373, 0.0, -0.3795373, -0.6857068, -0.8706478, -0.926993, -0.8865189, -0.8038518, -0.7329854, 
--0.7069989, -0.7292099, -0.7782685, -0.823238, -0.8405684, -0.8248418, -0.7889719, -0.7550765, -0.741689, -0.754236, 
--0.7833915, -0.8114567, -0.8227158, -0.811934, -0.7865528, -0.7617938, -0.7517458, -0.7615277, -0.7847918, -0.8077305, 
--0.8171289, -0.8078509, -0.7855878, -0.7634263, -0.754268, -0.7634263, -0.7855878, -0.8078509, -0.8171289, -0.8077305, 
--0.7847918, -0.7615277, -0.7517458, -0.7617938, -0.7865528, -0.811934, -0.8227158, -0.8114567, -0.7833915, -0.754236, 
--0.741689, -0.7550765, -0.7889719, -0.8248418, -0.8405684, -0.823238, -0.7782685, -0.7292099, -0.7069989, -0.7329854, 
--0.8038518, -0.8865189, -0.926993, -0.8706478, -0.6857068, -0.3795373, 0.0, 0.3796857, 0.6866865, 0.8729805, 
-0.9300882, 0.8885344, 0.8027354, 0.7281409, 0.7003724, 0.7247522, 0.7797098, 0.8313526, 0.8517645, 0.8324217, 
-0.7868727, 0.7421588, 0.7238095, 0.7421588, 0.7868727, 0.8324217, 0.8517645, 0.8313526, 0.7797098, 0.7247522, 
-0.7003724, 0.7281409, 0.8027354, 0.8885344, 0.9300882, 0.8729805, 0.6866865, 0.3796857, 0.0, -0.3796857, 
--0.6866865, -0.8729805, -0.9300882, -0.8885344, -0.8027354, -0.7281409, -0.7003724, -0.7247522, -0.7797098, -0.8313526, 
--0.8517645, -0.8324217, -0.7868727, -0.7421588, -0.7238095, -0.7421588, -0.7868727, -0.8324217, -0.8517645, -0.8313526, 
--0.7797098, -0.7247522, -0.7003724, -0.7281409, -0.8027354, -0.8885344, -0.9300882, -0.8729805, -0.6866865, -0.3796857, 
-0.0, 0.3802804, 0.6906433, 0.8824987, 0.942809, 0.8964997, 0.7963184, 0.7036287, 0.6666667, 0.7036287, 
-0.7963184, 0.8964997, 0.942809, 0.8824987, 0.6906433, 0.3802804, 0.0, -0.3802804, -0.6906433, -0.8824987, 
--0.942809, -0.8964997, -0.7963184, -0.7036287, -0.6666667, -0.7036287, -0.7963184, -0.8964997, -0.942809, -0.8824987, 
--0.6906433, -0.3802804, 0.0, 0.3826834, 0.7071068, 0.9238795, 1.0, 0.9238795, 0.7071068, 0.3826834, 
-0.0, -0.3826834, -0.7071068, -0.9238795, -1.0, -0.9238795, -0.7071068, -0.3826834, 0.0 };
-
-
-constexpr float triangle[] = 
-{0.0, 0.0004816, 0.0009634, 0.0014454, 0.0019276, 0.0024098, 0.0028919, 0.0033737, 0.0038554, 0.004337, 
-0.0048187, 0.0053007, 0.0057829, 0.0062651, 0.0067472, 0.0072291, 0.0077107, 0.0081924, 0.0086741, 0.009156, 
-0.0096381, 0.0101204, 0.0106025, 0.0110844, 0.0115661, 0.0120477, 0.0125294, 0.0130113, 0.0134934, 0.0139756, 
-0.0144578, 0.0149397, 0.0154215, 0.0159031, 0.0163848, 0.0168666, 0.0173487, 0.0178309, 0.018313, 0.0187951, 
-0.0192768, 0.0197585, 0.0202401, 0.0207219, 0.0212039, 0.0216861, 0.0221683, 0.0226504, 0.0231322, 0.0236138, 
-0.0240955, 0.0245772, 0.0250592, 0.0255414, 0.0260236, 0.0265057, 0.0269875, 0.0274692, 0.0279508, 0.0284326, 
-0.0289145, 0.0293966, 0.0298789, 0.030361, 0.0308429, 0.0313246, 0.0318062, 0.0322879, 0.0327698, 0.0332519, 
-0.0337341, 0.0342163, 0.0346982, 0.03518, 0.0356616, 0.0361432, 0.0366251, 0.0371072, 0.0375894, 0.0380715, 
-0.0385535, 0.0390353, 0.0395169, 0.0399986, 0.0404804, 0.0409624, 0.0414446, 0.0419268, 0.0424089, 0.0428907, 
-0.0433723, 0.0438539, 0.0443357, 0.0448177, 0.0452999, 0.0457821, 0.0462642, 0.046746, 0.0472277, 0.0477093, 
-0.048191, 0.048673, 0.0491551, 0.0496373, 0.0501195, 0.0506014, 0.0510831, 0.0515647, 0.0520464, 0.0525283, 
-0.0530104, 0.0534926, 0.0539748, 0.0544567, 0.0549384, 0.05542, 0.0559017, 0.0563836, 0.0568657, 0.0573479, 
-0.05783, 0.058312, 0.0587938, 0.0592754, 0.0597571, 0.0602389, 0.0607209, 0.0612031, 0.0616853, 0.0621673, 
-0.0626492, 0.0631308, 0.0636124, 0.0640942, 0.0645762, 0.0650584, 0.0655406, 0.0660227, 0.0665045, 0.0669862, 
-0.0674678, 0.0679495, 0.0684315, 0.0689136, 0.0693958, 0.069878, 0.0703598, 0.0708415, 0.0713231, 0.0718049, 
-0.0722868, 0.0727689, 0.0732511, 0.0737332, 0.0742152, 0.0746969, 0.0751785, 0.0756602, 0.0761421, 0.0766242, 
-0.0771064, 0.0775885, 0.0780705, 0.0785523, 0.0790339, 0.0795155, 0.0799974, 0.0804794, 0.0809616, 0.0814438, 
-0.0819258, 0.0824076, 0.0828893, 0.0833709, 0.0838527, 0.0843347, 0.0848169, 0.0852991, 0.0857811, 0.086263, 
-0.0867446, 0.0872263, 0.087708, 0.08819, 0.0886721, 0.0891543, 0.0896364, 0.0901183, 0.0906, 0.0910816, 
-0.0915633, 0.0920453, 0.0925274, 0.0930096, 0.0934917, 0.0939737, 0.0944554, 0.094937, 0.0954187, 0.0959006, 
-0.0963826, 0.0968649, 0.097347, 0.097829, 0.0983107, 0.0987924, 0.099274, 0.0997559, 0.1002379, 0.1007201, 
-0.1012023, 0.1016843, 0.1021661, 0.1026477, 0.1031294, 0.1036112, 0.1040932, 0.1045754, 0.1050576, 0.1055396, 
-0.1060215, 0.1065031, 0.1069847, 0.1074665, 0.1079485, 0.1084306, 0.1089128, 0.1093949, 0.1098768, 0.1103585, 
-0.1108401, 0.1113218, 0.1118037, 0.1122859, 0.1127681, 0.1132502, 0.1137321, 0.1142139, 0.1146955, 0.1151771, 
-0.115659, 0.1161411, 0.1166234, 0.1171055, 0.1175875, 0.1180692, 0.1185508, 0.1190325, 0.1195143, 0.1199964, 
-0.1204786, 0.1209608, 0.1214428, 0.1219246, 0.1224062, 0.1228878, 0.1233696, 0.1238517, 0.1243339, 0.1248161, 
-0.1252981, 0.1257799, 0.1262616, 0.1267432, 0.127225, 0.127707, 0.1281891, 0.1286713, 0.1291534, 0.1296353, 
-0.130117, 0.1305986, 0.1310803, 0.1315622, 0.1320444, 0.1325266, 0.1330087, 0.1334906, 0.1339723, 0.1344539, 
-0.1349356, 0.1354175, 0.1358996, 0.1363819, 0.136864, 0.137346, 0.1378277, 0.1383093, 0.138791, 0.1392728, 
-0.1397549, 0.1402371, 0.1407193, 0.1412013, 0.1416831, 0.1421647, 0.1426463, 0.1431281, 0.1436102, 0.1440924, 
-0.1445746, 0.1450566, 0.1455384, 0.1460201, 0.1465017, 0.1469834, 0.1474654, 0.1479476, 0.1484298, 0.1489119, 
-0.1493938, 0.1498754, 0.150357, 0.1508388, 0.1513207, 0.1518029, 0.1522851, 0.1527672, 0.1532491, 0.1537308, 
-0.1542124, 0.1546941, 0.155176, 0.1556581, 0.1561404, 0.1566225, 0.1571045, 0.1575862, 0.1580678, 0.1585494, 
-0.1590313, 0.1595134, 0.1599956, 0.1604778, 0.1609598, 0.1614415, 0.1619232, 0.1624048, 0.1628866, 0.1633687, 
-0.1638509, 0.1643331, 0.1648151, 0.1652969, 0.1657785, 0.1662602, 0.1667419, 0.1672239, 0.1677061, 0.1681883, 
-0.1686704, 0.1691523, 0.1696339, 0.1701155, 0.1705973, 0.1710792, 0.1715614, 0.1720436, 0.1725257, 0.1730076, 
-0.1734893, 0.1739709, 0.1744526, 0.1749345, 0.1754166, 0.1758989, 0.176381, 0.1768629, 0.1773447, 0.1778263, 
-0.1783079, 0.1787898, 0.1792719, 0.1797541, 0.1802363, 0.1807183, 0.1812, 0.1816816, 0.1821633, 0.1826451, 
-0.1831272, 0.1836094, 0.1840916, 0.1845736, 0.1850554, 0.185537, 0.1860186, 0.1865004, 0.1869824, 0.1874646, 
-0.1879468, 0.1884289, 0.1889107, 0.1893924, 0.189874, 0.1903557, 0.1908377, 0.1913199, 0.1918021, 0.1922842, 
-0.1927661, 0.1932478, 0.1937294, 0.1942111, 0.194693, 0.1951751, 0.1956574, 0.1961395, 0.1966214, 0.1971031, 
-0.1975847, 0.1980664, 0.1985483, 0.1990304, 0.1995126, 0.1999948, 0.2004768, 0.2009585, 0.2014401, 0.2019217, 
-0.2024036, 0.2028856, 0.2033679, 0.2038501, 0.2043321, 0.2048139, 0.2052955, 0.2057771, 0.2062589, 0.2067409, 
-0.2072231, 0.2077053, 0.2081874, 0.2086692, 0.2091509, 0.2096325, 0.2101142, 0.2105962, 0.2110784, 0.2115606, 
-0.2120427, 0.2125246, 0.2130062, 0.2134878, 0.2139695, 0.2144515, 0.2149336, 0.2154159, 0.215898, 0.2163799, 
-0.2168616, 0.2173432, 0.2178249, 0.2183068, 0.2187889, 0.2192711, 0.2197533, 0.2202352, 0.220717, 0.2211986, 
-0.2216802, 0.2221621, 0.2226441, 0.2231264, 0.2236086, 0.2240906, 0.2245723, 0.2250539, 0.2255356, 0.2260174, 
-0.2264994, 0.2269816, 0.2274638, 0.2279459, 0.2284277, 0.2289093, 0.2293909, 0.2298727, 0.2303547, 0.2308369, 
-0.2313191, 0.2318012, 0.232283, 0.2327647, 0.2332463, 0.233728, 0.23421, 0.2346921, 0.2351744, 0.2356565, 
-0.2361384, 0.2366201, 0.2371017, 0.2375833, 0.2380652, 0.2385474, 0.2390296, 0.2395118, 0.2399937, 0.2404754, 
-0.240957, 0.2414387, 0.2419205, 0.2424026, 0.2428849, 0.2433671, 0.2438491, 0.2443308, 0.2448124, 0.245294, 
-0.2457758, 0.2462579, 0.2467401, 0.2472223, 0.2477044, 0.2481862, 0.2486678, 0.2491494, 0.2496312, 0.2501132, 
-0.2505954, 0.2510776, 0.2515597, 0.2520415, 0.2525232, 0.2530048, 0.2534865, 0.2539684, 0.2544506, 0.2549329, 
-0.255415, 0.2558969, 0.2563786, 0.2568601, 0.2573418, 0.2578237, 0.2583059, 0.2587881, 0.2592703, 0.2597522, 
-0.2602339, 0.2607155, 0.2611972, 0.261679, 0.2621611, 0.2626434, 0.2631256, 0.2636075, 0.2640893, 0.2645709, 
-0.2650525, 0.2655343, 0.2660164, 0.2664986, 0.2669808, 0.2674629, 0.2679447, 0.2684263, 0.2689079, 0.2693896, 
-0.2698717, 0.2703539, 0.2708361, 0.2713182, 0.2718, 0.2722816, 0.2727632, 0.273245, 0.2737269, 0.2742091, 
-0.2746914, 0.2751735, 0.2756554, 0.276137, 0.2766186, 0.2771003, 0.2775822, 0.2780644, 0.2785466, 0.2790288, 
-0.2795107, 0.2799924, 0.280474, 0.2809556, 0.2814375, 0.2819196, 0.2824019, 0.282884, 0.283366, 0.2838478, 
-0.2843294, 0.284811, 0.2852928, 0.2857749, 0.2862571, 0.2867393, 0.2872214, 0.2877031, 0.2881847, 0.2886663, 
-0.2891481, 0.2896301, 0.2901124, 0.2905946, 0.2910767, 0.2915585, 0.2920401, 0.2925217, 0.2930034, 0.2934854, 
-0.2939676, 0.2944499, 0.294932, 0.2954138, 0.2958955, 0.2963771, 0.2968588, 0.2973407, 0.2978229, 0.2983051, 
-0.2987873, 0.2992692, 0.2997509, 0.3002325, 0.3007141, 0.301196, 0.3016781, 0.3021604, 0.3026425, 0.3031245, 
-0.3036062, 0.3040878, 0.3045695, 0.3050513, 0.3055334, 0.3060156, 0.3064978, 0.3069798, 0.3074616, 0.3079432, 
-0.3084248, 0.3089066, 0.3093886, 0.3098709, 0.3103531, 0.3108352, 0.311317, 0.3117986, 0.3122802, 0.3127619, 
-0.3132439, 0.3137261, 0.3142084, 0.3146905, 0.3151723, 0.315654, 0.3161356, 0.3166172, 0.3170992, 0.3175814, 
-0.3180636, 0.3185458, 0.3190277, 0.3195094, 0.3199909, 0.3204726, 0.3209545, 0.3214366, 0.3219189, 0.322401, 
-0.322883, 0.3233647, 0.3238463, 0.3243279, 0.3248098, 0.3252919, 0.3257741, 0.3262563, 0.3267383, 0.3272201, 
-0.3277017, 0.3281833, 0.3286651, 0.3291471, 0.3296294, 0.3301116, 0.3305937, 0.3310755, 0.3315571, 0.3320386, 
-0.3325204, 0.3330024, 0.3334846, 0.3339669, 0.334449, 0.3349308, 0.3354124, 0.335894, 0.3363757, 0.3368577, 
-0.3373398, 0.3378221, 0.3383043, 0.3387862, 0.3392678, 0.3397494, 0.3402311, 0.340713, 0.3411951, 0.3416774, 
-0.3421595, 0.3426415, 0.3431232, 0.3436048, 0.3440864, 0.3445682, 0.3450504, 0.3455326, 0.3460148, 0.3464968, 
-0.3469786, 0.3474602, 0.3479418, 0.3484236, 0.3489056, 0.3493879, 0.3498701, 0.3503522, 0.3508339, 0.3513155, 
-0.3517971, 0.3522789, 0.3527609, 0.3532431, 0.3537254, 0.3542075, 0.3546893, 0.3551709, 0.3556525, 0.3561342, 
-0.3566162, 0.3570983, 0.3575806, 0.3580628, 0.3585447, 0.3590263, 0.3595079, 0.3599895, 0.3604714, 0.3609536, 
-0.3614359, 0.361918, 0.3624, 0.3628817, 0.3633632, 0.3638449, 0.3643267, 0.3648088, 0.3652911, 0.3657733, 
-0.3662553, 0.3667371, 0.3672186, 0.3677002, 0.368182, 0.3686641, 0.3691464, 0.3696286, 0.3701106, 0.3705924, 
-0.371074, 0.3715556, 0.3720373, 0.3725194, 0.3730016, 0.3734839, 0.373966, 0.3744478, 0.3749294, 0.375411, 
-0.3758927, 0.3763746, 0.3768568, 0.3773391, 0.3778213, 0.3783031, 0.3787848, 0.3792663, 0.379748, 0.3802299, 
-0.3807121, 0.3811944, 0.3816765, 0.3821585, 0.3826402, 0.3831217, 0.3836033, 0.3840852, 0.3845673, 0.3850496, 
-0.3855318, 0.3860138, 0.3864955, 0.3869771, 0.3874587, 0.3879405, 0.3884226, 0.3889049, 0.3893871, 0.3898691, 
-0.3903509, 0.3908325, 0.3913141, 0.3917958, 0.3922779, 0.3927601, 0.3932424, 0.3937245, 0.3942063, 0.3946879, 
-0.3951694, 0.3956511, 0.3961331, 0.3966153, 0.3970976, 0.3975798, 0.3980616, 0.3985433, 0.3990248, 0.3995065, 
-0.3999884, 0.4004706, 0.4009529, 0.4014351, 0.401917, 0.4023986, 0.4028802, 0.4033618, 0.4038437, 0.4043258, 
-0.4048081, 0.4052903, 0.4057723, 0.406254, 0.4067356, 0.4072172, 0.407699, 0.4081811, 0.4086634, 0.4091456, 
-0.4096276, 0.4101094, 0.410591, 0.4110725, 0.4115543, 0.4120363, 0.4125186, 0.4130009, 0.413483, 0.4139648, 
-0.4144463, 0.4149279, 0.4154096, 0.4158916, 0.4163738, 0.4168561, 0.4173383, 0.4178201, 0.4183017, 0.4187833, 
-0.4192649, 0.4197469, 0.4202291, 0.4207114, 0.4211936, 0.4216755, 0.4221571, 0.4226386, 0.4231203, 0.4236022, 
-0.4240843, 0.4245666, 0.4250488, 0.4255308, 0.4260125, 0.426494, 0.4269756, 0.4274575, 0.4279396, 0.4284219, 
-0.4289041, 0.4293861, 0.4298679, 0.4303494, 0.430831, 0.4313128, 0.4317948, 0.4322771, 0.4327594, 0.4332415, 
-0.4337232, 0.4342048, 0.4346864, 0.4351681, 0.4356501, 0.4361323, 0.4366146, 0.4370968, 0.4375786, 0.4380602, 
-0.4385417, 0.4390234, 0.4395054, 0.4399876, 0.4404699, 0.4409521, 0.441434, 0.4419156, 0.4423971, 0.4428787, 
-0.4433606, 0.4438428, 0.4443251, 0.4448073, 0.4452893, 0.445771, 0.4462525, 0.4467341, 0.4472159, 0.4476981, 
-0.4481804, 0.4486626, 0.4491446, 0.4496264, 0.4501079, 0.4505894, 0.4510712, 0.4515533, 0.4520356, 0.4525179, 
-0.453, 0.4534817, 0.4539633, 0.4544448, 0.4549265, 0.4554086, 0.4558908, 0.4563731, 0.4568553, 0.4573371, 
-0.4578187, 0.4583002, 0.4587819, 0.4592638, 0.4597461, 0.4602284, 0.4607106, 0.4611924, 0.4616741, 0.4621556, 
-0.4626372, 0.4631191, 0.4636013, 0.4640836, 0.4645658, 0.4650478, 0.4655295, 0.466011, 0.4664926, 0.4669744, 
-0.4674566, 0.4679389, 0.4684211, 0.4689031, 0.4693848, 0.4698664, 0.4703479, 0.4708297, 0.4713118, 0.4717941, 
-0.4722764, 0.4727585, 0.4732402, 0.4737218, 0.4742033, 0.474685, 0.4751671, 0.4756493, 0.4761316, 0.4766138, 
-0.4770956, 0.4775771, 0.4780587, 0.4785403, 0.4790223, 0.4795046, 0.4799869, 0.4804691, 0.4809509, 0.4814325, 
-0.481914, 0.4823957, 0.4828776, 0.4833598, 0.4838421, 0.4843244, 0.4848063, 0.4852879, 0.4857694, 0.486251, 
-0.4867329, 0.487215, 0.4876974, 0.4881796, 0.4886616, 0.4891433, 0.4896248, 0.4901064, 0.4905882, 0.4910703, 
-0.4915526, 0.4920349, 0.492517, 0.4929987, 0.4934802, 0.4939617, 0.4944435, 0.4949255, 0.4954078, 0.4958902, 
-0.4963723, 0.4968541, 0.4973356, 0.4978171, 0.4982988, 0.4987808, 0.4992631, 0.4997454, 0.5002276, 0.5007094, 
-0.501191, 0.5016725, 0.5021541, 0.5026361, 0.5031183, 0.5036006, 0.5040829, 0.5045648, 0.5050464, 0.5055279, 
-0.5060095, 0.5064914, 0.5069735, 0.5074559, 0.5079381, 0.5084201, 0.5089018, 0.5093833, 0.5098648, 0.5103466, 
-0.5108288, 0.5113111, 0.5117934, 0.5122755, 0.5127572, 0.5132387, 0.5137202, 0.5142019, 0.514684, 0.5151663, 
-0.5156487, 0.5161308, 0.5166126, 0.5170941, 0.5175756, 0.5180573, 0.5185393, 0.5190216, 0.5195039, 0.5199861, 
-0.5204679, 0.5209495, 0.521431, 0.5219126, 0.5223945, 0.5228768, 0.5233592, 0.5238414, 0.5243233, 0.5248049, 
-0.5252864, 0.5257679, 0.5262498, 0.526732, 0.5272144, 0.5276967, 0.5281786, 0.5286603, 0.5291418, 0.5296233, 
-0.5301051, 0.5305873, 0.5310696, 0.5315519, 0.532034, 0.5325157, 0.5329972, 0.5334787, 0.5339604, 0.5344425, 
-0.5349248, 0.5354072, 0.5358893, 0.536371, 0.5368526, 0.537334, 0.5378157, 0.5382978, 0.5387801, 0.5392624, 
-0.5397446, 0.5402264, 0.540708, 0.5411894, 0.5416711, 0.542153, 0.5426353, 0.5431177, 0.5435999, 0.5440818, 
-0.5445634, 0.5450448, 0.5455264, 0.5460083, 0.5464905, 0.5469729, 0.5474552, 0.5479371, 0.5484188, 0.5489002, 
-0.5493817, 0.5498636, 0.5503458, 0.5508281, 0.5513104, 0.5517925, 0.5522742, 0.5527556, 0.5532371, 0.5537189, 
-0.554201, 0.5546833, 0.5551657, 0.5556478, 0.5561295, 0.556611, 0.5570925, 0.5575742, 0.5580562, 0.5585386, 
-0.5590209, 0.5595031, 0.5599849, 0.5604664, 0.5609479, 0.5614295, 0.5619115, 0.5623938, 0.5628762, 0.5633584, 
-0.5638403, 0.5643218, 0.5648033, 0.5652849, 0.5657668, 0.566249, 0.5667314, 0.5672137, 0.5676956, 0.5681772, 
-0.5686587, 0.5691402, 0.569622, 0.5701042, 0.5705866, 0.571069, 0.571551, 0.5720326, 0.5725141, 0.5729956, 
-0.5734773, 0.5739595, 0.5744419, 0.5749242, 0.5754063, 0.575888, 0.5763695, 0.5768509, 0.5773326, 0.5778147, 
-0.5782971, 0.5787795, 0.5792616, 0.5797434, 0.5802249, 0.5807063, 0.581188, 0.58167, 0.5821523, 0.5826347, 
-0.5831169, 0.5835988, 0.5840803, 0.5845617, 0.5850433, 0.5855252, 0.5860075, 0.5864899, 0.5869722, 0.5874541, 
-0.5879357, 0.5884171, 0.5888987, 0.5893805, 0.5898627, 0.5903451, 0.5908275, 0.5913095, 0.5917911, 0.5922725, 
-0.592754, 0.5932358, 0.593718, 0.5942004, 0.5946827, 0.5951648, 0.5956465, 0.596128, 0.5966094, 0.5970911, 
-0.5975732, 0.5980556, 0.598538, 0.5990201, 0.5995019, 0.5999834, 0.6004648, 0.6009464, 0.6014284, 0.6019108, 
-0.6023932, 0.6028754, 0.6033573, 0.6038388, 0.6043202, 0.6048018, 0.6052837, 0.605766, 0.6062484, 0.6067307, 
-0.6072126, 0.6076942, 0.6081756, 0.6086571, 0.609139, 0.6096212, 0.6101037, 0.610586, 0.611068, 0.6115496, 
-0.612031, 0.6125125, 0.6129943, 0.6134764, 0.6139589, 0.6144413, 0.6149233, 0.615405, 0.6158864, 0.6163678, 
-0.6168496, 0.6173317, 0.6178141, 0.6182965, 0.6187787, 0.6192604, 0.6197418, 0.6202232, 0.6207049, 0.6211869, 
-0.6216693, 0.6221517, 0.622634, 0.6231158, 0.6235973, 0.6240786, 0.6245602, 0.6250422, 0.6255245, 0.626007, 
-0.6264892, 0.6269712, 0.6274527, 0.627934, 0.6284155, 0.6288974, 0.6293797, 0.6298622, 0.6303445, 0.6308265, 
-0.6313081, 0.6317895, 0.6322709, 0.6327527, 0.6332349, 0.6337174, 0.6341998, 0.6346819, 0.6351635, 0.6356449, 
-0.6361263, 0.636608, 0.6370901, 0.6375726, 0.638055, 0.6385372, 0.6390189, 0.6395003, 0.6399817, 0.6404633, 
-0.6409454, 0.6414278, 0.6419103, 0.6423925, 0.6428743, 0.6433557, 0.6438371, 0.6443186, 0.6448006, 0.645283, 
-0.6457655, 0.6462478, 0.6467297, 0.6472112, 0.6476925, 0.648174, 0.6486559, 0.6491382, 0.6496207, 0.6501031, 
-0.650585, 0.6510666, 0.6515479, 0.6520293, 0.6525112, 0.6529934, 0.6534759, 0.6539583, 0.6544404, 0.654922, 
-0.6554033, 0.6558847, 0.6563665, 0.6568486, 0.6573311, 0.6578136, 0.6582957, 0.6587774, 0.6592588, 0.6597401, 
-0.6602218, 0.6607038, 0.6611863, 0.6616688, 0.662151, 0.6626328, 0.6631142, 0.6635955, 0.6640771, 0.6645591, 
-0.6650415, 0.665524, 0.6660063, 0.6664882, 0.6669696, 0.6674509, 0.6679324, 0.6684143, 0.6688967, 0.6693792, 
-0.6698616, 0.6703435, 0.6708251, 0.6713064, 0.6717878, 0.6722696, 0.6727519, 0.6732344, 0.6737169, 0.6741989, 
-0.6746805, 0.6751618, 0.6756432, 0.6761249, 0.6766071, 0.6770896, 0.6775721, 0.6780542, 0.6785359, 0.6790172, 
-0.6794985, 0.6799802, 0.6804623, 0.6809448, 0.6814273, 0.6819096, 0.6823913, 0.6828727, 0.683354, 0.6838355, 
-0.6843175, 0.6848, 0.6852825, 0.6857649, 0.6862467, 0.6867281, 0.6872094, 0.6876909, 0.6881728, 0.6886552, 
-0.6891377, 0.6896201, 0.6901021, 0.6905835, 0.6910648, 0.6915462, 0.6920281, 0.6925104, 0.6929929, 0.6934754, 
-0.6939574, 0.694439, 0.6949202, 0.6954016, 0.6958833, 0.6963656, 0.6968481, 0.6973306, 0.6978128, 0.6982944, 
-0.6987757, 0.699257, 0.6997386, 0.7002208, 0.7007033, 0.7011859, 0.7016681, 0.7021498, 0.7026311, 0.7031124, 
-0.7035939, 0.704076, 0.7045585, 0.7050411, 0.7055234, 0.7060052, 0.7064866, 0.7069678, 0.7074493, 0.7079312, 
-0.7084137, 0.7088963, 0.7093787, 0.7098606, 0.710342, 0.7108232, 0.7113046, 0.7117865, 0.7122689, 0.7127515, 
-0.7132339, 0.713716, 0.7141975, 0.7146787, 0.71516, 0.7156418, 0.716124, 0.7166066, 0.7170892, 0.7175713, 
-0.7180529, 0.7185341, 0.7190154, 0.719497, 0.7199792, 0.7204618, 0.7209444, 0.7214266, 0.7219083, 0.7223896, 
-0.7228708, 0.7233524, 0.7238345, 0.724317, 0.7247996, 0.725282, 0.7257637, 0.7262451, 0.7267262, 0.7272077, 
-0.7276897, 0.7281722, 0.7286548, 0.7291372, 0.7296191, 0.7301005, 0.7305817, 0.731063, 0.7315449, 0.7320273, 
-0.73251, 0.7329925, 0.7334745, 0.733956, 0.7344371, 0.7349184, 0.7354002, 0.7358825, 0.7363652, 0.7368478, 
-0.7373299, 0.7378114, 0.7382926, 0.7387738, 0.7392555, 0.7397377, 0.7402203, 0.740703, 0.7411852, 0.7416669, 
-0.7421481, 0.7426292, 0.7431108, 0.7435929, 0.7440755, 0.7445582, 0.7450405, 0.7455223, 0.7460035, 0.7464847, 
-0.7469661, 0.7474481, 0.7479307, 0.7484134, 0.7488958, 0.7493777, 0.749859, 0.7503401, 0.7508214, 0.7513033, 
-0.7517858, 0.7522685, 0.7527511, 0.7532331, 0.7537145, 0.7541956, 0.7546768, 0.7551586, 0.755641, 0.7561237, 
-0.7566063, 0.7570884, 0.7575699, 0.758051, 0.7585322, 0.7590139, 0.7594961, 0.7599789, 0.7604615, 0.7609438, 
-0.7614254, 0.7619065, 0.7623876, 0.7628692, 0.7633513, 0.763834, 0.7643167, 0.7647991, 0.7652808, 0.765762, 
-0.7662431, 0.7667245, 0.7672065, 0.7676891, 0.7681719, 0.7686544, 0.7691362, 0.7696175, 0.7700985, 0.7705798, 
-0.7710617, 0.7715443, 0.7720271, 0.7725097, 0.7729916, 0.773473, 0.773954, 0.7744352, 0.774917, 0.7753994, 
-0.7758822, 0.7763649, 0.776847, 0.7773284, 0.7778095, 0.7782906, 0.7787722, 0.7792546, 0.7797374, 0.7802201, 
-0.7807024, 0.7811839, 0.781665, 0.782146, 0.7826275, 0.7831098, 0.7835925, 0.7840753, 0.7845577, 0.7850394, 
-0.7855205, 0.7860015, 0.7864828, 0.7869649, 0.7874476, 0.7879305, 0.788413, 0.7888948, 0.789376, 0.7898569, 
-0.7903382, 0.7908201, 0.7913028, 0.7917857, 0.7922683, 0.7927502, 0.7932315, 0.7937124, 0.7941936, 0.7946754, 
-0.7951579, 0.7956408, 0.7961235, 0.7966056, 0.797087, 0.7975679, 0.798049, 0.7985306, 0.799013, 0.7994959, 
-0.7999787, 0.800461, 0.8009425, 0.8014234, 0.8019044, 0.8023859, 0.8028682, 0.803351, 0.8038339, 0.8043163, 
-0.8047979, 0.8052789, 0.8057598, 0.8062412, 0.8067233, 0.8072061, 0.8076891, 0.8081716, 0.8086534, 0.8091345, 
-0.8096153, 0.8100965, 0.8105785, 0.8110612, 0.8115442, 0.8120269, 0.8125088, 0.81299, 0.8134708, 0.8139519, 
-0.8144337, 0.8149163, 0.8153994, 0.8158822, 0.8163642, 0.8168455, 0.8173263, 0.8178073, 0.818289, 0.8187715, 
-0.8192545, 0.8197374, 0.8202196, 0.820701, 0.8211818, 0.8216627, 0.8221442, 0.8226266, 0.8231096, 0.8235926, 
-0.824075, 0.8245565, 0.8250374, 0.8255182, 0.8259995, 0.8264817, 0.8269646, 0.8274477, 0.8279303, 0.828412, 
-0.8288929, 0.8293737, 0.8298548, 0.8303369, 0.8308197, 0.8313028, 0.8317856, 0.8322675, 0.8327485, 0.8332292, 
-0.8337102, 0.8341921, 0.8346748, 0.835158, 0.8356408, 0.8361229, 0.836604, 0.8370847, 0.8375656, 0.8380473, 
-0.8385299, 0.839013, 0.839496, 0.8399783, 0.8404596, 0.8409403, 0.841421, 0.8419025, 0.842385, 0.8428681, 
-0.8433512, 0.8438337, 0.8443151, 0.8447958, 0.8452765, 0.8457578, 0.8462401, 0.8467231, 0.8472064, 0.847689, 
-0.8481706, 0.8486514, 0.849132, 0.8496131, 0.8500952, 0.8505782, 0.8510615, 0.8515443, 0.8520261, 0.852507, 
-0.8529875, 0.8534684, 0.8539503, 0.8544332, 0.8549166, 0.8553996, 0.8558816, 0.8563626, 0.8568431, 0.8573238, 
-0.8578055, 0.8582883, 0.8587716, 0.8592548, 0.859737, 0.8602182, 0.8606987, 0.8611793, 0.8616607, 0.8621433, 
-0.8626267, 0.86311, 0.8635924, 0.8640738, 0.8645543, 0.8650347, 0.865516, 0.8659984, 0.8664817, 0.8669651, 
-0.8674478, 0.8679293, 0.8684099, 0.8688902, 0.8693713, 0.8698534, 0.8703367, 0.8708202, 0.8713031, 0.8717849, 
-0.8722655, 0.8727458, 0.8732266, 0.8737085, 0.8741916, 0.8746752, 0.8751584, 0.8756404, 0.8761212, 0.8766014, 
-0.877082, 0.8775637, 0.8780466, 0.8785303, 0.8790136, 0.8794959, 0.8799768, 0.880457, 0.8809374, 0.8814188, 
-0.8819016, 0.8823852, 0.8828688, 0.8833513, 0.8838325, 0.8843127, 0.8847929, 0.885274, 0.8857566, 0.8862402, 
-0.8867239, 0.8872067, 0.8876881, 0.8881684, 0.8886484, 0.8891293, 0.8896116, 0.8900951, 0.890579, 0.891062, 
-0.8915437, 0.8920241, 0.892504, 0.8929846, 0.8934666, 0.89395, 0.894434, 0.8949173, 0.8953993, 0.8958798, 
-0.8963596, 0.89684, 0.8973217, 0.8978049, 0.8982889, 0.8987726, 0.8992548, 0.8997355, 0.9002153, 0.9006954, 
-0.9011768, 0.9016598, 0.9021439, 0.9026277, 0.9031104, 0.9035913, 0.9040711, 0.9045509, 0.9050319, 0.9055147, 
-0.9059987, 0.9064829, 0.9069658, 0.907447, 0.9079268, 0.9084064, 0.9088871, 0.9093696, 0.9098536, 0.9103379, 
-0.9108212, 0.9113027, 0.9117827, 0.9122621, 0.9127424, 0.9132245, 0.9137084, 0.9141929, 0.9146766, 0.9151584, 
-0.9156385, 0.9161178, 0.9165977, 0.9170795, 0.9175631, 0.9180478, 0.9185318, 0.9190141, 0.9194944, 0.9199735, 
-0.9204531, 0.9209344, 0.9214179, 0.9219026, 0.922387, 0.9228697, 0.9233503, 0.9238294, 0.9243086, 0.9247895, 
-0.9252726, 0.9257573, 0.9262421, 0.9267253, 0.9272062, 0.9276853, 0.9281642, 0.9286445, 0.9291273, 0.929612, 
-0.9300971, 0.9305809, 0.9310621, 0.9315413, 0.9320198, 0.9324997, 0.932982, 0.9334666, 0.9339521, 0.9344363, 
-0.9349181, 0.9353973, 0.9358756, 0.9363549, 0.9368367, 0.9373211, 0.9378069, 0.9382917, 0.938774, 0.9392535, 
-0.9397315, 0.9402102, 0.9406914, 0.9411756, 0.9416615, 0.942147, 0.9426299, 0.9431097, 0.9435875, 0.9440655, 
-0.9445461, 0.9450299, 0.9455161, 0.9460022, 0.9464858, 0.946966, 0.9474437, 0.9479211, 0.9484008, 0.9488842, 
-0.9493704, 0.9498572, 0.9503417, 0.9508225, 0.9513, 0.9517767, 0.9522555, 0.9527383, 0.9532246, 0.9537121, 
-0.9541976, 0.9546791, 0.9551566, 0.9556325, 0.9561103, 0.9565923, 0.9570786, 0.9575668, 0.9580535, 0.9585358, 
-0.9590134, 0.9594885, 0.9599651, 0.960446, 0.9609322, 0.9614213, 0.9619094, 0.9623928, 0.9628706, 0.9633448, 
-0.9638198, 0.9642995, 0.9647854, 0.9652755, 0.9657652, 0.9662502, 0.9667283, 0.9672015, 0.9676745, 0.9681525, 
-0.9686379, 0.9691291, 0.9696212, 0.9701082, 0.970587, 0.9710588, 0.9715291, 0.9720045, 0.9724891, 0.972982, 
-0.9734774, 0.9739675, 0.9744473, 0.9749171, 0.9753833, 0.9758547, 0.976338, 0.9768335, 0.9773343, 0.9778298, 
-0.9783113, 0.9787775, 0.9792359, 0.9796999, 0.9801809, 0.980682, 0.9811946, 0.9817017, 0.9821863, 0.9826423, 
-0.9830798, 0.9835232, 0.9840003, 0.9845258, 0.9850878, 0.9856419, 0.9861192, 0.9864447, 0.9865604, 0.9864447, 
-0.9861192, 0.9856419, 0.9850878, 0.9845258, 0.9840003, 0.9835232, 0.9830798, 0.9826423, 0.9821863, 0.9817017, 
-0.9811946, 0.980682, 0.9801809, 0.9796999, 0.9792359, 0.9787775, 0.9783113, 0.9778298, 0.9773343, 0.9768335, 
-0.976338, 0.9758547, 0.9753833, 0.9749171, 0.9744473, 0.9739675, 0.9734774, 0.972982, 0.9724891, 0.9720045, 
-0.9715291, 0.9710588, 0.970587, 0.9701082, 0.9696212, 0.9691291, 0.9686379, 0.9681525, 0.9676745, 0.9672015, 
-0.9667283, 0.9662502, 0.9657652, 0.9652755, 0.9647854, 0.9642995, 0.9638198, 0.9633448, 0.9628706, 0.9623928, 
-0.9619094, 0.9614213, 0.9609322, 0.960446, 0.9599651, 0.9594885, 0.9590134, 0.9585358, 0.9580535, 0.9575668, 
-0.9570786, 0.9565923, 0.9561103, 0.9556325, 0.9551566, 0.9546791, 0.9541976, 0.9537121, 0.9532246, 0.9527383, 
-0.9522555, 0.9517767, 0.9513, 0.9508225, 0.9503417, 0.9498572, 0.9493704, 0.9488842, 0.9484008, 0.9479211, 
-0.9474437, 0.946966, 0.9464858, 0.9460022, 0.9455161, 0.9450299, 0.9445461, 0.9440655, 0.9435875, 0.9431097, 
-0.9426299, 0.942147, 0.9416615, 0.9411756, 0.9406914, 0.9402102, 0.9397315, 0.9392535, 0.938774, 0.9382917, 
-0.9378069, 0.9373211, 0.9368367, 0.9363549, 0.9358756, 0.9353973, 0.9349181, 0.9344363, 0.9339521, 0.9334666, 
-0.932982, 0.9324997, 0.9320198, 0.9315413, 0.9310621, 0.9305809, 0.9300971, 0.929612, 0.9291273, 0.9286445, 
-0.9281642, 0.9276853, 0.9272062, 0.9267253, 0.9262421, 0.9257573, 0.9252726, 0.9247895, 0.9243086, 0.9238294, 
-0.9233503, 0.9228697, 0.922387, 0.9219026, 0.9214179, 0.9209344, 0.9204531, 0.9199735, 0.9194944, 0.9190141, 
-0.9185318, 0.9180478, 0.9175631, 0.9170795, 0.9165977, 0.9161178, 0.9156385, 0.9151584, 0.9146766, 0.9141929, 
-0.9137084, 0.9132245, 0.9127424, 0.9122621, 0.9117827, 0.9113027, 0.9108212, 0.9103379, 0.9098536, 0.9093696, 
-0.9088871, 0.9084064, 0.9079268, 0.907447, 0.9069658, 0.9064829, 0.9059987, 0.9055147, 0.9050319, 0.9045509, 
-0.9040711, 0.9035913, 0.9031104, 0.9026277, 0.9021439, 0.9016598, 0.9011768, 0.9006954, 0.9002153, 0.8997355, 
-0.8992548, 0.8987726, 0.8982889, 0.8978049, 0.8973217, 0.89684, 0.8963596, 0.8958798, 0.8953993, 0.8949173, 
-0.894434, 0.89395, 0.8934666, 0.8929846, 0.892504, 0.8920241, 0.8915437, 0.891062, 0.890579, 0.8900951, 
-0.8896116, 0.8891293, 0.8886484, 0.8881684, 0.8876881, 0.8872067, 0.8867239, 0.8862402, 0.8857566, 0.885274, 
-0.8847929, 0.8843127, 0.8838325, 0.8833513, 0.8828688, 0.8823852, 0.8819016, 0.8814188, 0.8809374, 0.880457, 
-0.8799768, 0.8794959, 0.8790136, 0.8785303, 0.8780466, 0.8775637, 0.877082, 0.8766014, 0.8761212, 0.8756404, 
-0.8751584, 0.8746752, 0.8741916, 0.8737085, 0.8732266, 0.8727458, 0.8722655, 0.8717849, 0.8713031, 0.8708202, 
-0.8703367, 0.8698534, 0.8693713, 0.8688902, 0.8684099, 0.8679293, 0.8674478, 0.8669651, 0.8664817, 0.8659984, 
-0.865516, 0.8650347, 0.8645543, 0.8640738, 0.8635924, 0.86311, 0.8626267, 0.8621433, 0.8616607, 0.8611793, 
-0.8606987, 0.8602182, 0.859737, 0.8592548, 0.8587716, 0.8582883, 0.8578055, 0.8573238, 0.8568431, 0.8563626, 
-0.8558816, 0.8553996, 0.8549166, 0.8544332, 0.8539503, 0.8534684, 0.8529875, 0.852507, 0.8520261, 0.8515443, 
-0.8510615, 0.8505782, 0.8500952, 0.8496131, 0.849132, 0.8486514, 0.8481706, 0.847689, 0.8472064, 0.8467231, 
-0.8462401, 0.8457578, 0.8452765, 0.8447958, 0.8443151, 0.8438337, 0.8433512, 0.8428681, 0.842385, 0.8419025, 
-0.841421, 0.8409403, 0.8404596, 0.8399783, 0.839496, 0.839013, 0.8385299, 0.8380473, 0.8375656, 0.8370847, 
-0.836604, 0.8361229, 0.8356408, 0.835158, 0.8346748, 0.8341921, 0.8337102, 0.8332292, 0.8327485, 0.8322675, 
-0.8317856, 0.8313028, 0.8308197, 0.8303369, 0.8298548, 0.8293737, 0.8288929, 0.828412, 0.8279303, 0.8274477, 
-0.8269646, 0.8264817, 0.8259995, 0.8255182, 0.8250374, 0.8245565, 0.824075, 0.8235926, 0.8231096, 0.8226266, 
-0.8221442, 0.8216627, 0.8211818, 0.820701, 0.8202196, 0.8197374, 0.8192545, 0.8187715, 0.818289, 0.8178073, 
-0.8173263, 0.8168455, 0.8163642, 0.8158822, 0.8153994, 0.8149163, 0.8144337, 0.8139519, 0.8134708, 0.81299, 
-0.8125088, 0.8120269, 0.8115442, 0.8110612, 0.8105785, 0.8100965, 0.8096153, 0.8091345, 0.8086534, 0.8081716, 
-0.8076891, 0.8072061, 0.8067233, 0.8062412, 0.8057598, 0.8052789, 0.8047979, 0.8043163, 0.8038339, 0.803351, 
-0.8028682, 0.8023859, 0.8019044, 0.8014234, 0.8009425, 0.800461, 0.7999787, 0.7994959, 0.799013, 0.7985306, 
-0.798049, 0.7975679, 0.797087, 0.7966056, 0.7961235, 0.7956408, 0.7951579, 0.7946754, 0.7941936, 0.7937124, 
-0.7932315, 0.7927502, 0.7922683, 0.7917857, 0.7913028, 0.7908201, 0.7903382, 0.7898569, 0.789376, 0.7888948, 
-0.788413, 0.7879305, 0.7874476, 0.7869649, 0.7864828, 0.7860015, 0.7855205, 0.7850394, 0.7845577, 0.7840753, 
-0.7835925, 0.7831098, 0.7826275, 0.782146, 0.781665, 0.7811839, 0.7807024, 0.7802201, 0.7797374, 0.7792546, 
-0.7787722, 0.7782906, 0.7778095, 0.7773284, 0.776847, 0.7763649, 0.7758822, 0.7753994, 0.774917, 0.7744352, 
-0.773954, 0.773473, 0.7729916, 0.7725097, 0.7720271, 0.7715443, 0.7710617, 0.7705798, 0.7700985, 0.7696175, 
-0.7691362, 0.7686544, 0.7681719, 0.7676891, 0.7672065, 0.7667245, 0.7662431, 0.765762, 0.7652808, 0.7647991, 
-0.7643167, 0.763834, 0.7633513, 0.7628692, 0.7623876, 0.7619065, 0.7614254, 0.7609438, 0.7604615, 0.7599789, 
-0.7594961, 0.7590139, 0.7585322, 0.758051, 0.7575699, 0.7570884, 0.7566063, 0.7561237, 0.755641, 0.7551586, 
-0.7546768, 0.7541956, 0.7537145, 0.7532331, 0.7527511, 0.7522685, 0.7517858, 0.7513033, 0.7508214, 0.7503401, 
-0.749859, 0.7493777, 0.7488958, 0.7484134, 0.7479307, 0.7474481, 0.7469661, 0.7464847, 0.7460035, 0.7455223, 
-0.7450405, 0.7445582, 0.7440755, 0.7435929, 0.7431108, 0.7426292, 0.7421481, 0.7416669, 0.7411852, 0.740703, 
-0.7402203, 0.7397377, 0.7392555, 0.7387738, 0.7382926, 0.7378114, 0.7373299, 0.7368478, 0.7363652, 0.7358825, 
-0.7354002, 0.7349184, 0.7344371, 0.733956, 0.7334745, 0.7329925, 0.73251, 0.7320273, 0.7315449, 0.731063, 
-0.7305817, 0.7301005, 0.7296191, 0.7291372, 0.7286548, 0.7281722, 0.7276897, 0.7272077, 0.7267262, 0.7262451, 
-0.7257637, 0.725282, 0.7247996, 0.724317, 0.7238345, 0.7233524, 0.7228708, 0.7223896, 0.7219083, 0.7214266, 
-0.7209444, 0.7204618, 0.7199792, 0.719497, 0.7190154, 0.7185341, 0.7180529, 0.7175713, 0.7170892, 0.7166066, 
-0.716124, 0.7156418, 0.71516, 0.7146787, 0.7141975, 0.713716, 0.7132339, 0.7127515, 0.7122689, 0.7117865, 
-0.7113046, 0.7108232, 0.710342, 0.7098606, 0.7093787, 0.7088963, 0.7084137, 0.7079312, 0.7074493, 0.7069678, 
-0.7064866, 0.7060052, 0.7055234, 0.7050411, 0.7045585, 0.704076, 0.7035939, 0.7031124, 0.7026311, 0.7021498, 
-0.7016681, 0.7011859, 0.7007033, 0.7002208, 0.6997386, 0.699257, 0.6987757, 0.6982944, 0.6978128, 0.6973306, 
-0.6968481, 0.6963656, 0.6958833, 0.6954016, 0.6949202, 0.694439, 0.6939574, 0.6934754, 0.6929929, 0.6925104, 
-0.6920281, 0.6915462, 0.6910648, 0.6905835, 0.6901021, 0.6896201, 0.6891377, 0.6886552, 0.6881728, 0.6876909, 
-0.6872094, 0.6867281, 0.6862467, 0.6857649, 0.6852825, 0.6848, 0.6843175, 0.6838355, 0.683354, 0.6828727, 
-0.6823913, 0.6819096, 0.6814273, 0.6809448, 0.6804623, 0.6799802, 0.6794985, 0.6790172, 0.6785359, 0.6780542, 
-0.6775721, 0.6770896, 0.6766071, 0.6761249, 0.6756432, 0.6751618, 0.6746805, 0.6741989, 0.6737169, 0.6732344, 
-0.6727519, 0.6722696, 0.6717878, 0.6713064, 0.6708251, 0.6703435, 0.6698616, 0.6693792, 0.6688967, 0.6684143, 
-0.6679324, 0.6674509, 0.6669696, 0.6664882, 0.6660063, 0.665524, 0.6650415, 0.6645591, 0.6640771, 0.6635955, 
-0.6631142, 0.6626328, 0.662151, 0.6616688, 0.6611863, 0.6607038, 0.6602218, 0.6597401, 0.6592588, 0.6587774, 
-0.6582957, 0.6578136, 0.6573311, 0.6568486, 0.6563665, 0.6558847, 0.6554033, 0.654922, 0.6544404, 0.6539583, 
-0.6534759, 0.6529934, 0.6525112, 0.6520293, 0.6515479, 0.6510666, 0.650585, 0.6501031, 0.6496207, 0.6491382, 
-0.6486559, 0.648174, 0.6476925, 0.6472112, 0.6467297, 0.6462478, 0.6457655, 0.645283, 0.6448006, 0.6443186, 
-0.6438371, 0.6433557, 0.6428743, 0.6423925, 0.6419103, 0.6414278, 0.6409454, 0.6404633, 0.6399817, 0.6395003, 
-0.6390189, 0.6385372, 0.638055, 0.6375726, 0.6370901, 0.636608, 0.6361263, 0.6356449, 0.6351635, 0.6346819, 
-0.6341998, 0.6337174, 0.6332349, 0.6327527, 0.6322709, 0.6317895, 0.6313081, 0.6308265, 0.6303445, 0.6298622, 
-0.6293797, 0.6288974, 0.6284155, 0.627934, 0.6274527, 0.6269712, 0.6264892, 0.626007, 0.6255245, 0.6250422, 
-0.6245602, 0.6240786, 0.6235973, 0.6231158, 0.622634, 0.6221517, 0.6216693, 0.6211869, 0.6207049, 0.6202232, 
-0.6197418, 0.6192604, 0.6187787, 0.6182965, 0.6178141, 0.6173317, 0.6168496, 0.6163678, 0.6158864, 0.615405, 
-0.6149233, 0.6144413, 0.6139589, 0.6134764, 0.6129943, 0.6125125, 0.612031, 0.6115496, 0.611068, 0.610586, 
-0.6101037, 0.6096212, 0.609139, 0.6086571, 0.6081756, 0.6076942, 0.6072126, 0.6067307, 0.6062484, 0.605766, 
-0.6052837, 0.6048018, 0.6043202, 0.6038388, 0.6033573, 0.6028754, 0.6023932, 0.6019108, 0.6014284, 0.6009464, 
-0.6004648, 0.5999834, 0.5995019, 0.5990201, 0.598538, 0.5980556, 0.5975732, 0.5970911, 0.5966094, 0.596128, 
-0.5956465, 0.5951648, 0.5946827, 0.5942004, 0.593718, 0.5932358, 0.592754, 0.5922725, 0.5917911, 0.5913095, 
-0.5908275, 0.5903451, 0.5898627, 0.5893805, 0.5888987, 0.5884171, 0.5879357, 0.5874541, 0.5869722, 0.5864899, 
-0.5860075, 0.5855252, 0.5850433, 0.5845617, 0.5840803, 0.5835988, 0.5831169, 0.5826347, 0.5821523, 0.58167, 
-0.581188, 0.5807063, 0.5802249, 0.5797434, 0.5792616, 0.5787795, 0.5782971, 0.5778147, 0.5773326, 0.5768509, 
-0.5763695, 0.575888, 0.5754063, 0.5749242, 0.5744419, 0.5739595, 0.5734773, 0.5729956, 0.5725141, 0.5720326, 
-0.571551, 0.571069, 0.5705866, 0.5701042, 0.569622, 0.5691402, 0.5686587, 0.5681772, 0.5676956, 0.5672137, 
-0.5667314, 0.566249, 0.5657668, 0.5652849, 0.5648033, 0.5643218, 0.5638403, 0.5633584, 0.5628762, 0.5623938, 
-0.5619115, 0.5614295, 0.5609479, 0.5604664, 0.5599849, 0.5595031, 0.5590209, 0.5585386, 0.5580562, 0.5575742, 
-0.5570925, 0.556611, 0.5561295, 0.5556478, 0.5551657, 0.5546833, 0.554201, 0.5537189, 0.5532371, 0.5527556, 
-0.5522742, 0.5517925, 0.5513104, 0.5508281, 0.5503458, 0.5498636, 0.5493817, 0.5489002, 0.5484188, 0.5479371, 
-0.5474552, 0.5469729, 0.5464905, 0.5460083, 0.5455264, 0.5450448, 0.5445634, 0.5440818, 0.5435999, 0.5431177, 
-0.5426353, 0.542153, 0.5416711, 0.5411894, 0.540708, 0.5402264, 0.5397446, 0.5392624, 0.5387801, 0.5382978, 
-0.5378157, 0.537334, 0.5368526, 0.536371, 0.5358893, 0.5354072, 0.5349248, 0.5344425, 0.5339604, 0.5334787, 
-0.5329972, 0.5325157, 0.532034, 0.5315519, 0.5310696, 0.5305873, 0.5301051, 0.5296233, 0.5291418, 0.5286603, 
-0.5281786, 0.5276967, 0.5272144, 0.526732, 0.5262498, 0.5257679, 0.5252864, 0.5248049, 0.5243233, 0.5238414, 
-0.5233592, 0.5228768, 0.5223945, 0.5219126, 0.521431, 0.5209495, 0.5204679, 0.5199861, 0.5195039, 0.5190216, 
-0.5185393, 0.5180573, 0.5175756, 0.5170941, 0.5166126, 0.5161308, 0.5156487, 0.5151663, 0.514684, 0.5142019, 
-0.5137202, 0.5132387, 0.5127572, 0.5122755, 0.5117934, 0.5113111, 0.5108288, 0.5103466, 0.5098648, 0.5093833, 
-0.5089018, 0.5084201, 0.5079381, 0.5074559, 0.5069735, 0.5064914, 0.5060095, 0.5055279, 0.5050464, 0.5045648, 
-0.5040829, 0.5036006, 0.5031183, 0.5026361, 0.5021541, 0.5016725, 0.501191, 0.5007094, 0.5002276, 0.4997454, 
-0.4992631, 0.4987808, 0.4982988, 0.4978171, 0.4973356, 0.4968541, 0.4963723, 0.4958902, 0.4954078, 0.4949255, 
-0.4944435, 0.4939617, 0.4934802, 0.4929987, 0.492517, 0.4920349, 0.4915526, 0.4910703, 0.4905882, 0.4901064, 
-0.4896248, 0.4891433, 0.4886616, 0.4881796, 0.4876974, 0.487215, 0.4867329, 0.486251, 0.4857694, 0.4852879, 
-0.4848063, 0.4843244, 0.4838421, 0.4833598, 0.4828776, 0.4823957, 0.481914, 0.4814325, 0.4809509, 0.4804691, 
-0.4799869, 0.4795046, 0.4790223, 0.4785403, 0.4780587, 0.4775771, 0.4770956, 0.4766138, 0.4761316, 0.4756493, 
-0.4751671, 0.474685, 0.4742033, 0.4737218, 0.4732402, 0.4727585, 0.4722764, 0.4717941, 0.4713118, 0.4708297, 
-0.4703479, 0.4698664, 0.4693848, 0.4689031, 0.4684211, 0.4679389, 0.4674566, 0.4669744, 0.4664926, 0.466011, 
-0.4655295, 0.4650478, 0.4645658, 0.4640836, 0.4636013, 0.4631191, 0.4626372, 0.4621556, 0.4616741, 0.4611924, 
-0.4607106, 0.4602284, 0.4597461, 0.4592638, 0.4587819, 0.4583002, 0.4578187, 0.4573371, 0.4568553, 0.4563731, 
-0.4558908, 0.4554086, 0.4549265, 0.4544448, 0.4539633, 0.4534817, 0.453, 0.4525179, 0.4520356, 0.4515533, 
-0.4510712, 0.4505894, 0.4501079, 0.4496264, 0.4491446, 0.4486626, 0.4481804, 0.4476981, 0.4472159, 0.4467341, 
-0.4462525, 0.445771, 0.4452893, 0.4448073, 0.4443251, 0.4438428, 0.4433606, 0.4428787, 0.4423971, 0.4419156, 
-0.441434, 0.4409521, 0.4404699, 0.4399876, 0.4395054, 0.4390234, 0.4385417, 0.4380602, 0.4375786, 0.4370968, 
-0.4366146, 0.4361323, 0.4356501, 0.4351681, 0.4346864, 0.4342048, 0.4337232, 0.4332415, 0.4327594, 0.4322771, 
-0.4317948, 0.4313128, 0.430831, 0.4303494, 0.4298679, 0.4293861, 0.4289041, 0.4284219, 0.4279396, 0.4274575, 
-0.4269756, 0.426494, 0.4260125, 0.4255308, 0.4250488, 0.4245666, 0.4240843, 0.4236022, 0.4231203, 0.4226386, 
-0.4221571, 0.4216755, 0.4211936, 0.4207114, 0.4202291, 0.4197469, 0.4192649, 0.4187833, 0.4183017, 0.4178201, 
-0.4173383, 0.4168561, 0.4163738, 0.4158916, 0.4154096, 0.4149279, 0.4144463, 0.4139648, 0.413483, 0.4130009, 
-0.4125186, 0.4120363, 0.4115543, 0.4110725, 0.410591, 0.4101094, 0.4096276, 0.4091456, 0.4086634, 0.4081811, 
-0.407699, 0.4072172, 0.4067356, 0.406254, 0.4057723, 0.4052903, 0.4048081, 0.4043258, 0.4038437, 0.4033618, 
-0.4028802, 0.4023986, 0.401917, 0.4014351, 0.4009529, 0.4004706, 0.3999884, 0.3995065, 0.3990248, 0.3985433, 
-0.3980616, 0.3975798, 0.3970976, 0.3966153, 0.3961331, 0.3956511, 0.3951694, 0.3946879, 0.3942063, 0.3937245, 
-0.3932424, 0.3927601, 0.3922779, 0.3917958, 0.3913141, 0.3908325, 0.3903509, 0.3898691, 0.3893871, 0.3889049, 
-0.3884226, 0.3879405, 0.3874587, 0.3869771, 0.3864955, 0.3860138, 0.3855318, 0.3850496, 0.3845673, 0.3840852, 
-0.3836033, 0.3831217, 0.3826402, 0.3821585, 0.3816765, 0.3811944, 0.3807121, 0.3802299, 0.379748, 0.3792663, 
-0.3787848, 0.3783031, 0.3778213, 0.3773391, 0.3768568, 0.3763746, 0.3758927, 0.375411, 0.3749294, 0.3744478, 
-0.373966, 0.3734839, 0.3730016, 0.3725194, 0.3720373, 0.3715556, 0.371074, 0.3705924, 0.3701106, 0.3696286, 
-0.3691464, 0.3686641, 0.368182, 0.3677002, 0.3672186, 0.3667371, 0.3662553, 0.3657733, 0.3652911, 0.3648088, 
-0.3643267, 0.3638449, 0.3633632, 0.3628817, 0.3624, 0.361918, 0.3614359, 0.3609536, 0.3604714, 0.3599895, 
-0.3595079, 0.3590263, 0.3585447, 0.3580628, 0.3575806, 0.3570983, 0.3566162, 0.3561342, 0.3556525, 0.3551709, 
-0.3546893, 0.3542075, 0.3537254, 0.3532431, 0.3527609, 0.3522789, 0.3517971, 0.3513155, 0.3508339, 0.3503522, 
-0.3498701, 0.3493879, 0.3489056, 0.3484236, 0.3479418, 0.3474602, 0.3469786, 0.3464968, 0.3460148, 0.3455326, 
-0.3450504, 0.3445682, 0.3440864, 0.3436048, 0.3431232, 0.3426415, 0.3421595, 0.3416774, 0.3411951, 0.340713, 
-0.3402311, 0.3397494, 0.3392678, 0.3387862, 0.3383043, 0.3378221, 0.3373398, 0.3368577, 0.3363757, 0.335894, 
-0.3354124, 0.3349308, 0.334449, 0.3339669, 0.3334846, 0.3330024, 0.3325204, 0.3320386, 0.3315571, 0.3310755, 
-0.3305937, 0.3301116, 0.3296294, 0.3291471, 0.3286651, 0.3281833, 0.3277017, 0.3272201, 0.3267383, 0.3262563, 
-0.3257741, 0.3252919, 0.3248098, 0.3243279, 0.3238463, 0.3233647, 0.322883, 0.322401, 0.3219189, 0.3214366, 
-0.3209545, 0.3204726, 0.3199909, 0.3195094, 0.3190277, 0.3185458, 0.3180636, 0.3175814, 0.3170992, 0.3166172, 
-0.3161356, 0.315654, 0.3151723, 0.3146905, 0.3142084, 0.3137261, 0.3132439, 0.3127619, 0.3122802, 0.3117986, 
-0.311317, 0.3108352, 0.3103531, 0.3098709, 0.3093886, 0.3089066, 0.3084248, 0.3079432, 0.3074616, 0.3069798, 
-0.3064978, 0.3060156, 0.3055334, 0.3050513, 0.3045695, 0.3040878, 0.3036062, 0.3031245, 0.3026425, 0.3021604, 
-0.3016781, 0.301196, 0.3007141, 0.3002325, 0.2997509, 0.2992692, 0.2987873, 0.2983051, 0.2978229, 0.2973407, 
-0.2968588, 0.2963771, 0.2958955, 0.2954138, 0.294932, 0.2944499, 0.2939676, 0.2934854, 0.2930034, 0.2925217, 
-0.2920401, 0.2915585, 0.2910767, 0.2905946, 0.2901124, 0.2896301, 0.2891481, 0.2886663, 0.2881847, 0.2877031, 
-0.2872214, 0.2867393, 0.2862571, 0.2857749, 0.2852928, 0.284811, 0.2843294, 0.2838478, 0.283366, 0.282884, 
-0.2824019, 0.2819196, 0.2814375, 0.2809556, 0.280474, 0.2799924, 0.2795107, 0.2790288, 0.2785466, 0.2780644, 
-0.2775822, 0.2771003, 0.2766186, 0.276137, 0.2756554, 0.2751735, 0.2746914, 0.2742091, 0.2737269, 0.273245, 
-0.2727632, 0.2722816, 0.2718, 0.2713182, 0.2708361, 0.2703539, 0.2698717, 0.2693896, 0.2689079, 0.2684263, 
-0.2679447, 0.2674629, 0.2669808, 0.2664986, 0.2660164, 0.2655343, 0.2650525, 0.2645709, 0.2640893, 0.2636075, 
-0.2631256, 0.2626434, 0.2621611, 0.261679, 0.2611972, 0.2607155, 0.2602339, 0.2597522, 0.2592703, 0.2587881, 
-0.2583059, 0.2578237, 0.2573418, 0.2568601, 0.2563786, 0.2558969, 0.255415, 0.2549329, 0.2544506, 0.2539684, 
-0.2534865, 0.2530048, 0.2525232, 0.2520415, 0.2515597, 0.2510776, 0.2505954, 0.2501132, 0.2496312, 0.2491494, 
-0.2486678, 0.2481862, 0.2477044, 0.2472223, 0.2467401, 0.2462579, 0.2457758, 0.245294, 0.2448124, 0.2443308, 
-0.2438491, 0.2433671, 0.2428849, 0.2424026, 0.2419205, 0.2414387, 0.240957, 0.2404754, 0.2399937, 0.2395118, 
-0.2390296, 0.2385474, 0.2380652, 0.2375833, 0.2371017, 0.2366201, 0.2361384, 0.2356565, 0.2351744, 0.2346921, 
-0.23421, 0.233728, 0.2332463, 0.2327647, 0.232283, 0.2318012, 0.2313191, 0.2308369, 0.2303547, 0.2298727, 
-0.2293909, 0.2289093, 0.2284277, 0.2279459, 0.2274638, 0.2269816, 0.2264994, 0.2260174, 0.2255356, 0.2250539, 
-0.2245723, 0.2240906, 0.2236086, 0.2231264, 0.2226441, 0.2221621, 0.2216802, 0.2211986, 0.220717, 0.2202352, 
-0.2197533, 0.2192711, 0.2187889, 0.2183068, 0.2178249, 0.2173432, 0.2168616, 0.2163799, 0.215898, 0.2154159, 
-0.2149336, 0.2144515, 0.2139695, 0.2134878, 0.2130062, 0.2125246, 0.2120427, 0.2115606, 0.2110784, 0.2105962, 
-0.2101142, 0.2096325, 0.2091509, 0.2086692, 0.2081874, 0.2077053, 0.2072231, 0.2067409, 0.2062589, 0.2057771, 
-0.2052955, 0.2048139, 0.2043321, 0.2038501, 0.2033679, 0.2028856, 0.2024036, 0.2019217, 0.2014401, 0.2009585, 
-0.2004768, 0.1999948, 0.1995126, 0.1990304, 0.1985483, 0.1980664, 0.1975847, 0.1971031, 0.1966214, 0.1961395, 
-0.1956574, 0.1951751, 0.194693, 0.1942111, 0.1937294, 0.1932478, 0.1927661, 0.1922842, 0.1918021, 0.1913199, 
-0.1908377, 0.1903557, 0.189874, 0.1893924, 0.1889107, 0.1884289, 0.1879468, 0.1874646, 0.1869824, 0.1865004, 
-0.1860186, 0.185537, 0.1850554, 0.1845736, 0.1840916, 0.1836094, 0.1831272, 0.1826451, 0.1821633, 0.1816816, 
-0.1812, 0.1807183, 0.1802363, 0.1797541, 0.1792719, 0.1787898, 0.1783079, 0.1778263, 0.1773447, 0.1768629, 
-0.176381, 0.1758989, 0.1754166, 0.1749345, 0.1744526, 0.1739709, 0.1734893, 0.1730076, 0.1725257, 0.1720436, 
-0.1715614, 0.1710792, 0.1705973, 0.1701155, 0.1696339, 0.1691523, 0.1686704, 0.1681883, 0.1677061, 0.1672239, 
-0.1667419, 0.1662602, 0.1657785, 0.1652969, 0.1648151, 0.1643331, 0.1638509, 0.1633687, 0.1628866, 0.1624048, 
-0.1619232, 0.1614415, 0.1609598, 0.1604778, 0.1599956, 0.1595134, 0.1590313, 0.1585494, 0.1580678, 0.1575862, 
-0.1571045, 0.1566225, 0.1561404, 0.1556581, 0.155176, 0.1546941, 0.1542124, 0.1537308, 0.1532491, 0.1527672, 
-0.1522851, 0.1518029, 0.1513207, 0.1508388, 0.150357, 0.1498754, 0.1493938, 0.1489119, 0.1484298, 0.1479476, 
-0.1474654, 0.1469834, 0.1465017, 0.1460201, 0.1455384, 0.1450566, 0.1445746, 0.1440924, 0.1436102, 0.1431281, 
-0.1426463, 0.1421647, 0.1416831, 0.1412013, 0.1407193, 0.1402371, 0.1397549, 0.1392728, 0.138791, 0.1383093, 
-0.1378277, 0.137346, 0.136864, 0.1363819, 0.1358996, 0.1354175, 0.1349356, 0.1344539, 0.1339723, 0.1334906, 
-0.1330087, 0.1325266, 0.1320444, 0.1315622, 0.1310803, 0.1305986, 0.130117, 0.1296353, 0.1291534, 0.1286713, 
-0.1281891, 0.127707, 0.127225, 0.1267432, 0.1262616, 0.1257799, 0.1252981, 0.1248161, 0.1243339, 0.1238517, 
-0.1233696, 0.1228878, 0.1224062, 0.1219246, 0.1214428, 0.1209608, 0.1204786, 0.1199964, 0.1195143, 0.1190325, 
-0.1185508, 0.1180692, 0.1175875, 0.1171055, 0.1166234, 0.1161411, 0.115659, 0.1151771, 0.1146955, 0.1142139, 
-0.1137321, 0.1132502, 0.1127681, 0.1122859, 0.1118037, 0.1113218, 0.1108401, 0.1103585, 0.1098768, 0.1093949, 
-0.1089128, 0.1084306, 0.1079485, 0.1074665, 0.1069847, 0.1065031, 0.1060215, 0.1055396, 0.1050576, 0.1045754, 
-0.1040932, 0.1036112, 0.1031294, 0.1026477, 0.1021661, 0.1016843, 0.1012023, 0.1007201, 0.1002379, 0.0997559, 
-0.099274, 0.0987924, 0.0983107, 0.097829, 0.097347, 0.0968649, 0.0963826, 0.0959006, 0.0954187, 0.094937, 
-0.0944554, 0.0939737, 0.0934917, 0.0930096, 0.0925274, 0.0920453, 0.0915633, 0.0910816, 0.0906, 0.0901183, 
-0.0896364, 0.0891543, 0.0886721, 0.08819, 0.087708, 0.0872263, 0.0867446, 0.086263, 0.0857811, 0.0852991, 
-0.0848169, 0.0843347, 0.0838527, 0.0833709, 0.0828893, 0.0824076, 0.0819258, 0.0814438, 0.0809616, 0.0804794, 
-0.0799974, 0.0795155, 0.0790339, 0.0785523, 0.0780705, 0.0775885, 0.0771064, 0.0766242, 0.0761421, 0.0756602, 
-0.0751785, 0.0746969, 0.0742152, 0.0737332, 0.0732511, 0.0727689, 0.0722868, 0.0718049, 0.0713231, 0.0708415, 
-0.0703598, 0.069878, 0.0693958, 0.0689136, 0.0684315, 0.0679495, 0.0674678, 0.0669862, 0.0665045, 0.0660227, 
-0.0655406, 0.0650584, 0.0645762, 0.0640942, 0.0636124, 0.0631308, 0.0626492, 0.0621673, 0.0616853, 0.0612031, 
-0.0607209, 0.0602389, 0.0597571, 0.0592754, 0.0587938, 0.058312, 0.05783, 0.0573479, 0.0568657, 0.0563836, 
-0.0559017, 0.05542, 0.0549384, 0.0544567, 0.0539748, 0.0534926, 0.0530104, 0.0525283, 0.0520464, 0.0515647, 
-0.0510831, 0.0506014, 0.0501195, 0.0496373, 0.0491551, 0.048673, 0.048191, 0.0477093, 0.0472277, 0.046746, 
-0.0462642, 0.0457821, 0.0452999, 0.0448177, 0.0443357, 0.0438539, 0.0433723, 0.0428907, 0.0424089, 0.0419268, 
-0.0414446, 0.0409624, 0.0404804, 0.0399986, 0.0395169, 0.0390353, 0.0385535, 0.0380715, 0.0375894, 0.0371072, 
-0.0366251, 0.0361432, 0.0356616, 0.03518, 0.0346982, 0.0342163, 0.0337341, 0.0332519, 0.0327698, 0.0322879, 
-0.0318062, 0.0313246, 0.0308429, 0.030361, 0.0298789, 0.0293966, 0.0289145, 0.0284326, 0.0279508, 0.0274692, 
-0.0269875, 0.0265057, 0.0260236, 0.0255414, 0.0250592, 0.0245772, 0.0240955, 0.0236138, 0.0231322, 0.0226504, 
-0.0221683, 0.0216861, 0.0212039, 0.0207219, 0.0202401, 0.0197585, 0.0192768, 0.0187951, 0.018313, 0.0178309, 
-0.0173487, 0.0168666, 0.0163848, 0.0159031, 0.0154215, 0.0149397, 0.0144578, 0.0139756, 0.0134934, 0.0130113, 
-0.0125294, 0.0120477, 0.0115661, 0.0110844, 0.0106025, 0.0101204, 0.0096381, 0.009156, 0.0086741, 0.0081924, 
-0.0077107, 0.0072291, 0.0067472, 0.0062651, 0.0057829, 0.0053007, 0.0048187, 0.004337, 0.0038554, 0.0033737, 
-0.0028919, 0.0024098, 0.0019276, 0.0014454, 0.0009634, 0.0004816, 0.0, -0.0004816, -0.0009634, -0.0014454, 
--0.0019276, -0.0024098, -0.0028919, -0.0033737, -0.0038554, -0.004337, -0.0048187, -0.0053007, -0.0057829, -0.0062651, 
--0.0067472, -0.0072291, -0.0077107, -0.0081924, -0.0086741, -0.009156, -0.0096381, -0.0101204, -0.0106025, -0.0110844, 
--0.0115661, -0.0120477, -0.0125294, -0.0130113, -0.0134934, -0.0139756, -0.0144578, -0.0149397, -0.0154215, -0.0159031, 
--0.0163848, -0.0168666, -0.0173487, -0.0178309, -0.018313, -0.0187951, -0.0192768, -0.0197585, -0.0202401, -0.0207219, 
--0.0212039, -0.0216861, -0.0221683, -0.0226504, -0.0231322, -0.0236138, -0.0240955, -0.0245772, -0.0250592, -0.0255414, 
--0.0260236, -0.0265057, -0.0269875, -0.0274692, -0.0279508, -0.0284326, -0.0289145, -0.0293966, -0.0298789, -0.030361, 
--0.0308429, -0.0313246, -0.0318062, -0.0322879, -0.0327698, -0.0332519, -0.0337341, -0.0342163, -0.0346982, -0.03518, 
--0.0356616, -0.0361432, -0.0366251, -0.0371072, -0.0375894, -0.0380715, -0.0385535, -0.0390353, -0.0395169, -0.0399986, 
--0.0404804, -0.0409624, -0.0414446, -0.0419268, -0.0424089, -0.0428907, -0.0433723, -0.0438539, -0.0443357, -0.0448177, 
--0.0452999, -0.0457821, -0.0462642, -0.046746, -0.0472277, -0.0477093, -0.048191, -0.048673, -0.0491551, -0.0496373, 
--0.0501195, -0.0506014, -0.0510831, -0.0515647, -0.0520464, -0.0525283, -0.0530104, -0.0534926, -0.0539748, -0.0544567, 
--0.0549384, -0.05542, -0.0559017, -0.0563836, -0.0568657, -0.0573479, -0.05783, -0.058312, -0.0587938, -0.0592754, 
--0.0597571, -0.0602389, -0.0607209, -0.0612031, -0.0616853, -0.0621673, -0.0626492, -0.0631308, -0.0636124, -0.0640942, 
--0.0645762, -0.0650584, -0.0655406, -0.0660227, -0.0665045, -0.0669862, -0.0674678, -0.0679495, -0.0684315, -0.0689136, 
--0.0693958, -0.069878, -0.0703598, -0.0708415, -0.0713231, -0.0718049, -0.0722868, -0.0727689, -0.0732511, -0.0737332, 
--0.0742152, -0.0746969, -0.0751785, -0.0756602, -0.0761421, -0.0766242, -0.0771064, -0.0775885, -0.0780705, -0.0785523, 
--0.0790339, -0.0795155, -0.0799974, -0.0804794, -0.0809616, -0.0814438, -0.0819258, -0.0824076, -0.0828893, -0.0833709, 
--0.0838527, -0.0843347, -0.0848169, -0.0852991, -0.0857811, -0.086263, -0.0867446, -0.0872263, -0.087708, -0.08819, 
--0.0886721, -0.0891543, -0.0896364, -0.0901183, -0.0906, -0.0910816, -0.0915633, -0.0920453, -0.0925274, -0.0930096, 
--0.0934917, -0.0939737, -0.0944554, -0.094937, -0.0954187, -0.0959006, -0.0963826, -0.0968649, -0.097347, -0.097829, 
--0.0983107, -0.0987924, -0.099274, -0.0997559, -0.1002379, -0.1007201, -0.1012023, -0.1016843, -0.1021661, -0.1026477, 
--0.1031294, -0.1036112, -0.1040932, -0.1045754, -0.1050576, -0.1055396, -0.1060215, -0.1065031, -0.1069847, -0.1074665, 
--0.1079485, -0.1084306, -0.1089128, -0.1093949, -0.1098768, -0.1103585, -0.1108401, -0.1113218, -0.1118037, -0.1122859, 
--0.1127681, -0.1132502, -0.1137321, -0.1142139, -0.1146955, -0.1151771, -0.115659, -0.1161411, -0.1166234, -0.1171055, 
--0.1175875, -0.1180692, -0.1185508, -0.1190325, -0.1195143, -0.1199964, -0.1204786, -0.1209608, -0.1214428, -0.1219246, 
--0.1224062, -0.1228878, -0.1233696, -0.1238517, -0.1243339, -0.1248161, -0.1252981, -0.1257799, -0.1262616, -0.1267432, 
--0.127225, -0.127707, -0.1281891, -0.1286713, -0.1291534, -0.1296353, -0.130117, -0.1305986, -0.1310803, -0.1315622, 
--0.1320444, -0.1325266, -0.1330087, -0.1334906, -0.1339723, -0.1344539, -0.1349356, -0.1354175, -0.1358996, -0.1363819, 
--0.136864, -0.137346, -0.1378277, -0.1383093, -0.138791, -0.1392728, -0.1397549, -0.1402371, -0.1407193, -0.1412013, 
--0.1416831, -0.1421647, -0.1426463, -0.1431281, -0.1436102, -0.1440924, -0.1445746, -0.1450566, -0.1455384, -0.1460201, 
--0.1465017, -0.1469834, -0.1474654, -0.1479476, -0.1484298, -0.1489119, -0.1493938, -0.1498754, -0.150357, -0.1508388, 
--0.1513207, -0.1518029, -0.1522851, -0.1527672, -0.1532491, -0.1537308, -0.1542124, -0.1546941, -0.155176, -0.1556581, 
--0.1561404, -0.1566225, -0.1571045, -0.1575862, -0.1580678, -0.1585494, -0.1590313, -0.1595134, -0.1599956, -0.1604778, 
--0.1609598, -0.1614415, -0.1619232, -0.1624048, -0.1628866, -0.1633687, -0.1638509, -0.1643331, -0.1648151, -0.1652969, 
--0.1657785, -0.1662602, -0.1667419, -0.1672239, -0.1677061, -0.1681883, -0.1686704, -0.1691523, -0.1696339, -0.1701155, 
--0.1705973, -0.1710792, -0.1715614, -0.1720436, -0.1725257, -0.1730076, -0.1734893, -0.1739709, -0.1744526, -0.1749345, 
--0.1754166, -0.1758989, -0.176381, -0.1768629, -0.1773447, -0.1778263, -0.1783079, -0.1787898, -0.1792719, -0.1797541, 
--0.1802363, -0.1807183, -0.1812, -0.1816816, -0.1821633, -0.1826451, -0.1831272, -0.1836094, -0.1840916, -0.1845736, 
--0.1850554, -0.185537, -0.1860186, -0.1865004, -0.1869824, -0.1874646, -0.1879468, -0.1884289, -0.1889107, -0.1893924, 
--0.189874, -0.1903557, -0.1908377, -0.1913199, -0.1918021, -0.1922842, -0.1927661, -0.1932478, -0.1937294, -0.1942111, 
--0.194693, -0.1951751, -0.1956574, -0.1961395, -0.1966214, -0.1971031, -0.1975847, -0.1980664, -0.1985483, -0.1990304, 
--0.1995126, -0.1999948, -0.2004768, -0.2009585, -0.2014401, -0.2019217, -0.2024036, -0.2028856, -0.2033679, -0.2038501, 
--0.2043321, -0.2048139, -0.2052955, -0.2057771, -0.2062589, -0.2067409, -0.2072231, -0.2077053, -0.2081874, -0.2086692, 
--0.2091509, -0.2096325, -0.2101142, -0.2105962, -0.2110784, -0.2115606, -0.2120427, -0.2125246, -0.2130062, -0.2134878, 
--0.2139695, -0.2144515, -0.2149336, -0.2154159, -0.215898, -0.2163799, -0.2168616, -0.2173432, -0.2178249, -0.2183068, 
--0.2187889, -0.2192711, -0.2197533, -0.2202352, -0.220717, -0.2211986, -0.2216802, -0.2221621, -0.2226441, -0.2231264, 
--0.2236086, -0.2240906, -0.2245723, -0.2250539, -0.2255356, -0.2260174, -0.2264994, -0.2269816, -0.2274638, -0.2279459, 
--0.2284277, -0.2289093, -0.2293909, -0.2298727, -0.2303547, -0.2308369, -0.2313191, -0.2318012, -0.232283, -0.2327647, 
--0.2332463, -0.233728, -0.23421, -0.2346921, -0.2351744, -0.2356565, -0.2361384, -0.2366201, -0.2371017, -0.2375833, 
--0.2380652, -0.2385474, -0.2390296, -0.2395118, -0.2399937, -0.2404754, -0.240957, -0.2414387, -0.2419205, -0.2424026, 
--0.2428849, -0.2433671, -0.2438491, -0.2443308, -0.2448124, -0.245294, -0.2457758, -0.2462579, -0.2467401, -0.2472223, 
--0.2477044, -0.2481862, -0.2486678, -0.2491494, -0.2496312, -0.2501132, -0.2505954, -0.2510776, -0.2515597, -0.2520415, 
--0.2525232, -0.2530048, -0.2534865, -0.2539684, -0.2544506, -0.2549329, -0.255415, -0.2558969, -0.2563786, -0.2568601, 
--0.2573418, -0.2578237, -0.2583059, -0.2587881, -0.2592703, -0.2597522, -0.2602339, -0.2607155, -0.2611972, -0.261679, 
--0.2621611, -0.2626434, -0.2631256, -0.2636075, -0.2640893, -0.2645709, -0.2650525, -0.2655343, -0.2660164, -0.2664986, 
--0.2669808, -0.2674629, -0.2679447, -0.2684263, -0.2689079, -0.2693896, -0.2698717, -0.2703539, -0.2708361, -0.2713182, 
--0.2718, -0.2722816, -0.2727632, -0.273245, -0.2737269, -0.2742091, -0.2746914, -0.2751735, -0.2756554, -0.276137, 
--0.2766186, -0.2771003, -0.2775822, -0.2780644, -0.2785466, -0.2790288, -0.2795107, -0.2799924, -0.280474, -0.2809556, 
--0.2814375, -0.2819196, -0.2824019, -0.282884, -0.283366, -0.2838478, -0.2843294, -0.284811, -0.2852928, -0.2857749, 
--0.2862571, -0.2867393, -0.2872214, -0.2877031, -0.2881847, -0.2886663, -0.2891481, -0.2896301, -0.2901124, -0.2905946, 
--0.2910767, -0.2915585, -0.2920401, -0.2925217, -0.2930034, -0.2934854, -0.2939676, -0.2944499, -0.294932, -0.2954138, 
--0.2958955, -0.2963771, -0.2968588, -0.2973407, -0.2978229, -0.2983051, -0.2987873, -0.2992692, -0.2997509, -0.3002325, 
--0.3007141, -0.301196, -0.3016781, -0.3021604, -0.3026425, -0.3031245, -0.3036062, -0.3040878, -0.3045695, -0.3050513, 
--0.3055334, -0.3060156, -0.3064978, -0.3069798, -0.3074616, -0.3079432, -0.3084248, -0.3089066, -0.3093886, -0.3098709, 
--0.3103531, -0.3108352, -0.311317, -0.3117986, -0.3122802, -0.3127619, -0.3132439, -0.3137261, -0.3142084, -0.3146905, 
--0.3151723, -0.315654, -0.3161356, -0.3166172, -0.3170992, -0.3175814, -0.3180636, -0.3185458, -0.3190277, -0.3195094, 
--0.3199909, -0.3204726, -0.3209545, -0.3214366, -0.3219189, -0.322401, -0.322883, -0.3233647, -0.3238463, -0.3243279, 
--0.3248098, -0.3252919, -0.3257741, -0.3262563, -0.3267383, -0.3272201, -0.3277017, -0.3281833, -0.3286651, -0.3291471, 
--0.3296294, -0.3301116, -0.3305937, -0.3310755, -0.3315571, -0.3320386, -0.3325204, -0.3330024, -0.3334846, -0.3339669, 
--0.334449, -0.3349308, -0.3354124, -0.335894, -0.3363757, -0.3368577, -0.3373398, -0.3378221, -0.3383043, -0.3387862, 
--0.3392678, -0.3397494, -0.3402311, -0.340713, -0.3411951, -0.3416774, -0.3421595, -0.3426415, -0.3431232, -0.3436048, 
--0.3440864, -0.3445682, -0.3450504, -0.3455326, -0.3460148, -0.3464968, -0.3469786, -0.3474602, -0.3479418, -0.3484236, 
--0.3489056, -0.3493879, -0.3498701, -0.3503522, -0.3508339, -0.3513155, -0.3517971, -0.3522789, -0.3527609, -0.3532431, 
--0.3537254, -0.3542075, -0.3546893, -0.3551709, -0.3556525, -0.3561342, -0.3566162, -0.3570983, -0.3575806, -0.3580628, 
--0.3585447, -0.3590263, -0.3595079, -0.3599895, -0.3604714, -0.3609536, -0.3614359, -0.361918, -0.3624, -0.3628817, 
--0.3633632, -0.3638449, -0.3643267, -0.3648088, -0.3652911, -0.3657733, -0.3662553, -0.3667371, -0.3672186, -0.3677002, 
--0.368182, -0.3686641, -0.3691464, -0.3696286, -0.3701106, -0.3705924, -0.371074, -0.3715556, -0.3720373, -0.3725194, 
--0.3730016, -0.3734839, -0.373966, -0.3744478, -0.3749294, -0.375411, -0.3758927, -0.3763746, -0.3768568, -0.3773391, 
--0.3778213, -0.3783031, -0.3787848, -0.3792663, -0.379748, -0.3802299, -0.3807121, -0.3811944, -0.3816765, -0.3821585, 
--0.3826402, -0.3831217, -0.3836033, -0.3840852, -0.3845673, -0.3850496, -0.3855318, -0.3860138, -0.3864955, -0.3869771, 
--0.3874587, -0.3879405, -0.3884226, -0.3889049, -0.3893871, -0.3898691, -0.3903509, -0.3908325, -0.3913141, -0.3917958, 
--0.3922779, -0.3927601, -0.3932424, -0.3937245, -0.3942063, -0.3946879, -0.3951694, -0.3956511, -0.3961331, -0.3966153, 
--0.3970976, -0.3975798, -0.3980616, -0.3985433, -0.3990248, -0.3995065, -0.3999884, -0.4004706, -0.4009529, -0.4014351, 
--0.401917, -0.4023986, -0.4028802, -0.4033618, -0.4038437, -0.4043258, -0.4048081, -0.4052903, -0.4057723, -0.406254, 
--0.4067356, -0.4072172, -0.407699, -0.4081811, -0.4086634, -0.4091456, -0.4096276, -0.4101094, -0.410591, -0.4110725, 
--0.4115543, -0.4120363, -0.4125186, -0.4130009, -0.413483, -0.4139648, -0.4144463, -0.4149279, -0.4154096, -0.4158916, 
--0.4163738, -0.4168561, -0.4173383, -0.4178201, -0.4183017, -0.4187833, -0.4192649, -0.4197469, -0.4202291, -0.4207114, 
--0.4211936, -0.4216755, -0.4221571, -0.4226386, -0.4231203, -0.4236022, -0.4240843, -0.4245666, -0.4250488, -0.4255308, 
--0.4260125, -0.426494, -0.4269756, -0.4274575, -0.4279396, -0.4284219, -0.4289041, -0.4293861, -0.4298679, -0.4303494, 
--0.430831, -0.4313128, -0.4317948, -0.4322771, -0.4327594, -0.4332415, -0.4337232, -0.4342048, -0.4346864, -0.4351681, 
--0.4356501, -0.4361323, -0.4366146, -0.4370968, -0.4375786, -0.4380602, -0.4385417, -0.4390234, -0.4395054, -0.4399876, 
--0.4404699, -0.4409521, -0.441434, -0.4419156, -0.4423971, -0.4428787, -0.4433606, -0.4438428, -0.4443251, -0.4448073, 
--0.4452893, -0.445771, -0.4462525, -0.4467341, -0.4472159, -0.4476981, -0.4481804, -0.4486626, -0.4491446, -0.4496264, 
--0.4501079, -0.4505894, -0.4510712, -0.4515533, -0.4520356, -0.4525179, -0.453, -0.4534817, -0.4539633, -0.4544448, 
--0.4549265, -0.4554086, -0.4558908, -0.4563731, -0.4568553, -0.4573371, -0.4578187, -0.4583002, -0.4587819, -0.4592638, 
--0.4597461, -0.4602284, -0.4607106, -0.4611924, -0.4616741, -0.4621556, -0.4626372, -0.4631191, -0.4636013, -0.4640836, 
--0.4645658, -0.4650478, -0.4655295, -0.466011, -0.4664926, -0.4669744, -0.4674566, -0.4679389, -0.4684211, -0.4689031, 
--0.4693848, -0.4698664, -0.4703479, -0.4708297, -0.4713118, -0.4717941, -0.4722764, -0.4727585, -0.4732402, -0.4737218, 
--0.4742033, -0.474685, -0.4751671, -0.4756493, -0.4761316, -0.4766138, -0.4770956, -0.4775771, -0.4780587, -0.4785403, 
--0.4790223, -0.4795046, -0.4799869, -0.4804691, -0.4809509, -0.4814325, -0.481914, -0.4823957, -0.4828776, -0.4833598, 
--0.4838421, -0.4843244, -0.4848063, -0.4852879, -0.4857694, -0.486251, -0.4867329, -0.487215, -0.4876974, -0.4881796, 
--0.4886616, -0.4891433, -0.4896248, -0.4901064, -0.4905882, -0.4910703, -0.4915526, -0.4920349, -0.492517, -0.4929987, 
--0.4934802, -0.4939617, -0.4944435, -0.4949255, -0.4954078, -0.4958902, -0.4963723, -0.4968541, -0.4973356, -0.4978171, 
--0.4982988, -0.4987808, -0.4992631, -0.4997454, -0.5002276, -0.5007094, -0.501191, -0.5016725, -0.5021541, -0.5026361, 
--0.5031183, -0.5036006, -0.5040829, -0.5045648, -0.5050464, -0.5055279, -0.5060095, -0.5064914, -0.5069735, -0.5074559, 
--0.5079381, -0.5084201, -0.5089018, -0.5093833, -0.5098648, -0.5103466, -0.5108288, -0.5113111, -0.5117934, -0.5122755, 
--0.5127572, -0.5132387, -0.5137202, -0.5142019, -0.514684, -0.5151663, -0.5156487, -0.5161308, -0.5166126, -0.5170941, 
--0.5175756, -0.5180573, -0.5185393, -0.5190216, -0.5195039, -0.5199861, -0.5204679, -0.5209495, -0.521431, -0.5219126, 
--0.5223945, -0.5228768, -0.5233592, -0.5238414, -0.5243233, -0.5248049, -0.5252864, -0.5257679, -0.5262498, -0.526732, 
--0.5272144, -0.5276967, -0.5281786, -0.5286603, -0.5291418, -0.5296233, -0.5301051, -0.5305873, -0.5310696, -0.5315519, 
--0.532034, -0.5325157, -0.5329972, -0.5334787, -0.5339604, -0.5344425, -0.5349248, -0.5354072, -0.5358893, -0.536371, 
--0.5368526, -0.537334, -0.5378157, -0.5382978, -0.5387801, -0.5392624, -0.5397446, -0.5402264, -0.540708, -0.5411894, 
--0.5416711, -0.542153, -0.5426353, -0.5431177, -0.5435999, -0.5440818, -0.5445634, -0.5450448, -0.5455264, -0.5460083, 
--0.5464905, -0.5469729, -0.5474552, -0.5479371, -0.5484188, -0.5489002, -0.5493817, -0.5498636, -0.5503458, -0.5508281, 
--0.5513104, -0.5517925, -0.5522742, -0.5527556, -0.5532371, -0.5537189, -0.554201, -0.5546833, -0.5551657, -0.5556478, 
--0.5561295, -0.556611, -0.5570925, -0.5575742, -0.5580562, -0.5585386, -0.5590209, -0.5595031, -0.5599849, -0.5604664, 
--0.5609479, -0.5614295, -0.5619115, -0.5623938, -0.5628762, -0.5633584, -0.5638403, -0.5643218, -0.5648033, -0.5652849, 
--0.5657668, -0.566249, -0.5667314, -0.5672137, -0.5676956, -0.5681772, -0.5686587, -0.5691402, -0.569622, -0.5701042, 
--0.5705866, -0.571069, -0.571551, -0.5720326, -0.5725141, -0.5729956, -0.5734773, -0.5739595, -0.5744419, -0.5749242, 
--0.5754063, -0.575888, -0.5763695, -0.5768509, -0.5773326, -0.5778147, -0.5782971, -0.5787795, -0.5792616, -0.5797434, 
--0.5802249, -0.5807063, -0.581188, -0.58167, -0.5821523, -0.5826347, -0.5831169, -0.5835988, -0.5840803, -0.5845617, 
--0.5850433, -0.5855252, -0.5860075, -0.5864899, -0.5869722, -0.5874541, -0.5879357, -0.5884171, -0.5888987, -0.5893805, 
--0.5898627, -0.5903451, -0.5908275, -0.5913095, -0.5917911, -0.5922725, -0.592754, -0.5932358, -0.593718, -0.5942004, 
--0.5946827, -0.5951648, -0.5956465, -0.596128, -0.5966094, -0.5970911, -0.5975732, -0.5980556, -0.598538, -0.5990201, 
--0.5995019, -0.5999834, -0.6004648, -0.6009464, -0.6014284, -0.6019108, -0.6023932, -0.6028754, -0.6033573, -0.6038388, 
--0.6043202, -0.6048018, -0.6052837, -0.605766, -0.6062484, -0.6067307, -0.6072126, -0.6076942, -0.6081756, -0.6086571, 
--0.609139, -0.6096212, -0.6101037, -0.610586, -0.611068, -0.6115496, -0.612031, -0.6125125, -0.6129943, -0.6134764, 
--0.6139589, -0.6144413, -0.6149233, -0.615405, -0.6158864, -0.6163678, -0.6168496, -0.6173317, -0.6178141, -0.6182965, 
--0.6187787, -0.6192604, -0.6197418, -0.6202232, -0.6207049, -0.6211869, -0.6216693, -0.6221517, -0.622634, -0.6231158, 
--0.6235973, -0.6240786, -0.6245602, -0.6250422, -0.6255245, -0.626007, -0.6264892, -0.6269712, -0.6274527, -0.627934, 
--0.6284155, -0.6288974, -0.6293797, -0.6298622, -0.6303445, -0.6308265, -0.6313081, -0.6317895, -0.6322709, -0.6327527, 
--0.6332349, -0.6337174, -0.6341998, -0.6346819, -0.6351635, -0.6356449, -0.6361263, -0.636608, -0.6370901, -0.6375726, 
--0.638055, -0.6385372, -0.6390189, -0.6395003, -0.6399817, -0.6404633, -0.6409454, -0.6414278, -0.6419103, -0.6423925, 
--0.6428743, -0.6433557, -0.6438371, -0.6443186, -0.6448006, -0.645283, -0.6457655, -0.6462478, -0.6467297, -0.6472112, 
--0.6476925, -0.648174, -0.6486559, -0.6491382, -0.6496207, -0.6501031, -0.650585, -0.6510666, -0.6515479, -0.6520293, 
--0.6525112, -0.6529934, -0.6534759, -0.6539583, -0.6544404, -0.654922, -0.6554033, -0.6558847, -0.6563665, -0.6568486, 
--0.6573311, -0.6578136, -0.6582957, -0.6587774, -0.6592588, -0.6597401, -0.6602218, -0.6607038, -0.6611863, -0.6616688, 
--0.662151, -0.6626328, -0.6631142, -0.6635955, -0.6640771, -0.6645591, -0.6650415, -0.665524, -0.6660063, -0.6664882, 
--0.6669696, -0.6674509, -0.6679324, -0.6684143, -0.6688967, -0.6693792, -0.6698616, -0.6703435, -0.6708251, -0.6713064, 
--0.6717878, -0.6722696, -0.6727519, -0.6732344, -0.6737169, -0.6741989, -0.6746805, -0.6751618, -0.6756432, -0.6761249, 
--0.6766071, -0.6770896, -0.6775721, -0.6780542, -0.6785359, -0.6790172, -0.6794985, -0.6799802, -0.6804623, -0.6809448, 
--0.6814273, -0.6819096, -0.6823913, -0.6828727, -0.683354, -0.6838355, -0.6843175, -0.6848, -0.6852825, -0.6857649, 
--0.6862467, -0.6867281, -0.6872094, -0.6876909, -0.6881728, -0.6886552, -0.6891377, -0.6896201, -0.6901021, -0.6905835, 
--0.6910648, -0.6915462, -0.6920281, -0.6925104, -0.6929929, -0.6934754, -0.6939574, -0.694439, -0.6949202, -0.6954016, 
--0.6958833, -0.6963656, -0.6968481, -0.6973306, -0.6978128, -0.6982944, -0.6987757, -0.699257, -0.6997386, -0.7002208, 
--0.7007033, -0.7011859, -0.7016681, -0.7021498, -0.7026311, -0.7031124, -0.7035939, -0.704076, -0.7045585, -0.7050411, 
--0.7055234, -0.7060052, -0.7064866, -0.7069678, -0.7074493, -0.7079312, -0.7084137, -0.7088963, -0.7093787, -0.7098606, 
--0.710342, -0.7108232, -0.7113046, -0.7117865, -0.7122689, -0.7127515, -0.7132339, -0.713716, -0.7141975, -0.7146787, 
--0.71516, -0.7156418, -0.716124, -0.7166066, -0.7170892, -0.7175713, -0.7180529, -0.7185341, -0.7190154, -0.719497, 
--0.7199792, -0.7204618, -0.7209444, -0.7214266, -0.7219083, -0.7223896, -0.7228708, -0.7233524, -0.7238345, -0.724317, 
--0.7247996, -0.725282, -0.7257637, -0.7262451, -0.7267262, -0.7272077, -0.7276897, -0.7281722, -0.7286548, -0.7291372, 
--0.7296191, -0.7301005, -0.7305817, -0.731063, -0.7315449, -0.7320273, -0.73251, -0.7329925, -0.7334745, -0.733956, 
--0.7344371, -0.7349184, -0.7354002, -0.7358825, -0.7363652, -0.7368478, -0.7373299, -0.7378114, -0.7382926, -0.7387738, 
--0.7392555, -0.7397377, -0.7402203, -0.740703, -0.7411852, -0.7416669, -0.7421481, -0.7426292, -0.7431108, -0.7435929, 
--0.7440755, -0.7445582, -0.7450405, -0.7455223, -0.7460035, -0.7464847, -0.7469661, -0.7474481, -0.7479307, -0.7484134, 
--0.7488958, -0.7493777, -0.749859, -0.7503401, -0.7508214, -0.7513033, -0.7517858, -0.7522685, -0.7527511, -0.7532331, 
--0.7537145, -0.7541956, -0.7546768, -0.7551586, -0.755641, -0.7561237, -0.7566063, -0.7570884, -0.7575699, -0.758051, 
--0.7585322, -0.7590139, -0.7594961, -0.7599789, -0.7604615, -0.7609438, -0.7614254, -0.7619065, -0.7623876, -0.7628692, 
--0.7633513, -0.763834, -0.7643167, -0.7647991, -0.7652808, -0.765762, -0.7662431, -0.7667245, -0.7672065, -0.7676891, 
--0.7681719, -0.7686544, -0.7691362, -0.7696175, -0.7700985, -0.7705798, -0.7710617, -0.7715443, -0.7720271, -0.7725097, 
--0.7729916, -0.773473, -0.773954, -0.7744352, -0.774917, -0.7753994, -0.7758822, -0.7763649, -0.776847, -0.7773284, 
--0.7778095, -0.7782906, -0.7787722, -0.7792546, -0.7797374, -0.7802201, -0.7807024, -0.7811839, -0.781665, -0.782146, 
--0.7826275, -0.7831098, -0.7835925, -0.7840753, -0.7845577, -0.7850394, -0.7855205, -0.7860015, -0.7864828, -0.7869649, 
--0.7874476, -0.7879305, -0.788413, -0.7888948, -0.789376, -0.7898569, -0.7903382, -0.7908201, -0.7913028, -0.7917857, 
--0.7922683, -0.7927502, -0.7932315, -0.7937124, -0.7941936, -0.7946754, -0.7951579, -0.7956408, -0.7961235, -0.7966056, 
--0.797087, -0.7975679, -0.798049, -0.7985306, -0.799013, -0.7994959, -0.7999787, -0.800461, -0.8009425, -0.8014234, 
--0.8019044, -0.8023859, -0.8028682, -0.803351, -0.8038339, -0.8043163, -0.8047979, -0.8052789, -0.8057598, -0.8062412, 
--0.8067233, -0.8072061, -0.8076891, -0.8081716, -0.8086534, -0.8091345, -0.8096153, -0.8100965, -0.8105785, -0.8110612, 
--0.8115442, -0.8120269, -0.8125088, -0.81299, -0.8134708, -0.8139519, -0.8144337, -0.8149163, -0.8153994, -0.8158822, 
--0.8163642, -0.8168455, -0.8173263, -0.8178073, -0.818289, -0.8187715, -0.8192545, -0.8197374, -0.8202196, -0.820701, 
--0.8211818, -0.8216627, -0.8221442, -0.8226266, -0.8231096, -0.8235926, -0.824075, -0.8245565, -0.8250374, -0.8255182, 
--0.8259995, -0.8264817, -0.8269646, -0.8274477, -0.8279303, -0.828412, -0.8288929, -0.8293737, -0.8298548, -0.8303369, 
--0.8308197, -0.8313028, -0.8317856, -0.8322675, -0.8327485, -0.8332292, -0.8337102, -0.8341921, -0.8346748, -0.835158, 
--0.8356408, -0.8361229, -0.836604, -0.8370847, -0.8375656, -0.8380473, -0.8385299, -0.839013, -0.839496, -0.8399783, 
--0.8404596, -0.8409403, -0.841421, -0.8419025, -0.842385, -0.8428681, -0.8433512, -0.8438337, -0.8443151, -0.8447958, 
--0.8452765, -0.8457578, -0.8462401, -0.8467231, -0.8472064, -0.847689, -0.8481706, -0.8486514, -0.849132, -0.8496131, 
--0.8500952, -0.8505782, -0.8510615, -0.8515443, -0.8520261, -0.852507, -0.8529875, -0.8534684, -0.8539503, -0.8544332, 
--0.8549166, -0.8553996, -0.8558816, -0.8563626, -0.8568431, -0.8573238, -0.8578055, -0.8582883, -0.8587716, -0.8592548, 
--0.859737, -0.8602182, -0.8606987, -0.8611793, -0.8616607, -0.8621433, -0.8626267, -0.86311, -0.8635924, -0.8640738, 
--0.8645543, -0.8650347, -0.865516, -0.8659984, -0.8664817, -0.8669651, -0.8674478, -0.8679293, -0.8684099, -0.8688902, 
--0.8693713, -0.8698534, -0.8703367, -0.8708202, -0.8713031, -0.8717849, -0.8722655, -0.8727458, -0.8732266, -0.8737085, 
--0.8741916, -0.8746752, -0.8751584, -0.8756404, -0.8761212, -0.8766014, -0.877082, -0.8775637, -0.8780466, -0.8785303, 
--0.8790136, -0.8794959, -0.8799768, -0.880457, -0.8809374, -0.8814188, -0.8819016, -0.8823852, -0.8828688, -0.8833513, 
--0.8838325, -0.8843127, -0.8847929, -0.885274, -0.8857566, -0.8862402, -0.8867239, -0.8872067, -0.8876881, -0.8881684, 
--0.8886484, -0.8891293, -0.8896116, -0.8900951, -0.890579, -0.891062, -0.8915437, -0.8920241, -0.892504, -0.8929846, 
--0.8934666, -0.89395, -0.894434, -0.8949173, -0.8953993, -0.8958798, -0.8963596, -0.89684, -0.8973217, -0.8978049, 
--0.8982889, -0.8987726, -0.8992548, -0.8997355, -0.9002153, -0.9006954, -0.9011768, -0.9016598, -0.9021439, -0.9026277, 
--0.9031104, -0.9035913, -0.9040711, -0.9045509, -0.9050319, -0.9055147, -0.9059987, -0.9064829, -0.9069658, -0.907447, 
--0.9079268, -0.9084064, -0.9088871, -0.9093696, -0.9098536, -0.9103379, -0.9108212, -0.9113027, -0.9117827, -0.9122621, 
--0.9127424, -0.9132245, -0.9137084, -0.9141929, -0.9146766, -0.9151584, -0.9156385, -0.9161178, -0.9165977, -0.9170795, 
--0.9175631, -0.9180478, -0.9185318, -0.9190141, -0.9194944, -0.9199735, -0.9204531, -0.9209344, -0.9214179, -0.9219026, 
--0.922387, -0.9228697, -0.9233503, -0.9238294, -0.9243086, -0.9247895, -0.9252726, -0.9257573, -0.9262421, -0.9267253, 
--0.9272062, -0.9276853, -0.9281642, -0.9286445, -0.9291273, -0.929612, -0.9300971, -0.9305809, -0.9310621, -0.9315413, 
--0.9320198, -0.9324997, -0.932982, -0.9334666, -0.9339521, -0.9344363, -0.9349181, -0.9353973, -0.9358756, -0.9363549, 
--0.9368367, -0.9373211, -0.9378069, -0.9382917, -0.938774, -0.9392535, -0.9397315, -0.9402102, -0.9406914, -0.9411756, 
--0.9416615, -0.942147, -0.9426299, -0.9431097, -0.9435875, -0.9440655, -0.9445461, -0.9450299, -0.9455161, -0.9460022, 
--0.9464858, -0.946966, -0.9474437, -0.9479211, -0.9484008, -0.9488842, -0.9493704, -0.9498572, -0.9503417, -0.9508225, 
--0.9513, -0.9517767, -0.9522555, -0.9527383, -0.9532246, -0.9537121, -0.9541976, -0.9546791, -0.9551566, -0.9556325, 
--0.9561103, -0.9565923, -0.9570786, -0.9575668, -0.9580535, -0.9585358, -0.9590134, -0.9594885, -0.9599651, -0.960446, 
--0.9609322, -0.9614213, -0.9619094, -0.9623928, -0.9628706, -0.9633448, -0.9638198, -0.9642995, -0.9647854, -0.9652755, 
--0.9657652, -0.9662502, -0.9667283, -0.9672015, -0.9676745, -0.9681525, -0.9686379, -0.9691291, -0.9696212, -0.9701082, 
--0.970587, -0.9710588, -0.9715291, -0.9720045, -0.9724891, -0.972982, -0.9734774, -0.9739675, -0.9744473, -0.9749171, 
--0.9753833, -0.9758547, -0.976338, -0.9768335, -0.9773343, -0.9778298, -0.9783113, -0.9787775, -0.9792359, -0.9796999, 
--0.9801809, -0.980682, -0.9811946, -0.9817017, -0.9821863, -0.9826423, -0.9830798, -0.9835232, -0.9840003, -0.9845258, 
--0.9850878, -0.9856419, -0.9861192, -0.9864447, -0.9865604, -0.9864447, -0.9861192, -0.9856419, -0.9850878, -0.9845258, 
--0.9840003, -0.9835232, -0.9830798, -0.9826423, -0.9821863, -0.9817017, -0.9811946, -0.980682, -0.9801809, -0.9796999, 
--0.9792359, -0.9787775, -0.9783113, -0.9778298, -0.9773343, -0.9768335, -0.976338, -0.9758547, -0.9753833, -0.9749171, 
--0.9744473, -0.9739675, -0.9734774, -0.972982, -0.9724891, -0.9720045, -0.9715291, -0.9710588, -0.970587, -0.9701082, 
--0.9696212, -0.9691291, -0.9686379, -0.9681525, -0.9676745, -0.9672015, -0.9667283, -0.9662502, -0.9657652, -0.9652755, 
--0.9647854, -0.9642995, -0.9638198, -0.9633448, -0.9628706, -0.9623928, -0.9619094, -0.9614213, -0.9609322, -0.960446, 
--0.9599651, -0.9594885, -0.9590134, -0.9585358, -0.9580535, -0.9575668, -0.9570786, -0.9565923, -0.9561103, -0.9556325, 
--0.9551566, -0.9546791, -0.9541976, -0.9537121, -0.9532246, -0.9527383, -0.9522555, -0.9517767, -0.9513, -0.9508225, 
--0.9503417, -0.9498572, -0.9493704, -0.9488842, -0.9484008, -0.9479211, -0.9474437, -0.946966, -0.9464858, -0.9460022, 
--0.9455161, -0.9450299, -0.9445461, -0.9440655, -0.9435875, -0.9431097, -0.9426299, -0.942147, -0.9416615, -0.9411756, 
--0.9406914, -0.9402102, -0.9397315, -0.9392535, -0.938774, -0.9382917, -0.9378069, -0.9373211, -0.9368367, -0.9363549, 
--0.9358756, -0.9353973, -0.9349181, -0.9344363, -0.9339521, -0.9334666, -0.932982, -0.9324997, -0.9320198, -0.9315413, 
--0.9310621, -0.9305809, -0.9300971, -0.929612, -0.9291273, -0.9286445, -0.9281642, -0.9276853, -0.9272062, -0.9267253, 
--0.9262421, -0.9257573, -0.9252726, -0.9247895, -0.9243086, -0.9238294, -0.9233503, -0.9228697, -0.922387, -0.9219026, 
--0.9214179, -0.9209344, -0.9204531, -0.9199735, -0.9194944, -0.9190141, -0.9185318, -0.9180478, -0.9175631, -0.9170795, 
--0.9165977, -0.9161178, -0.9156385, -0.9151584, -0.9146766, -0.9141929, -0.9137084, -0.9132245, -0.9127424, -0.9122621, 
--0.9117827, -0.9113027, -0.9108212, -0.9103379, -0.9098536, -0.9093696, -0.9088871, -0.9084064, -0.9079268, -0.907447, 
--0.9069658, -0.9064829, -0.9059987, -0.9055147, -0.9050319, -0.9045509, -0.9040711, -0.9035913, -0.9031104, -0.9026277, 
--0.9021439, -0.9016598, -0.9011768, -0.9006954, -0.9002153, -0.8997355, -0.8992548, -0.8987726, -0.8982889, -0.8978049, 
--0.8973217, -0.89684, -0.8963596, -0.8958798, -0.8953993, -0.8949173, -0.894434, -0.89395, -0.8934666, -0.8929846, 
--0.892504, -0.8920241, -0.8915437, -0.891062, -0.890579, -0.8900951, -0.8896116, -0.8891293, -0.8886484, -0.8881684, 
--0.8876881, -0.8872067, -0.8867239, -0.8862402, -0.8857566, -0.885274, -0.8847929, -0.8843127, -0.8838325, -0.8833513, 
--0.8828688, -0.8823852, -0.8819016, -0.8814188, -0.8809374, -0.880457, -0.8799768, -0.8794959, -0.8790136, -0.8785303, 
--0.8780466, -0.8775637, -0.877082, -0.8766014, -0.8761212, -0.8756404, -0.8751584, -0.8746752, -0.8741916, -0.8737085, 
--0.8732266, -0.8727458, -0.8722655, -0.8717849, -0.8713031, -0.8708202, -0.8703367, -0.8698534, -0.8693713, -0.8688902, 
--0.8684099, -0.8679293, -0.8674478, -0.8669651, -0.8664817, -0.8659984, -0.865516, -0.8650347, -0.8645543, -0.8640738, 
--0.8635924, -0.86311, -0.8626267, -0.8621433, -0.8616607, -0.8611793, -0.8606987, -0.8602182, -0.859737, -0.8592548, 
--0.8587716, -0.8582883, -0.8578055, -0.8573238, -0.8568431, -0.8563626, -0.8558816, -0.8553996, -0.8549166, -0.8544332, 
--0.8539503, -0.8534684, -0.8529875, -0.852507, -0.8520261, -0.8515443, -0.8510615, -0.8505782, -0.8500952, -0.8496131, 
--0.849132, -0.8486514, -0.8481706, -0.847689, -0.8472064, -0.8467231, -0.8462401, -0.8457578, -0.8452765, -0.8447958, 
--0.8443151, -0.8438337, -0.8433512, -0.8428681, -0.842385, -0.8419025, -0.841421, -0.8409403, -0.8404596, -0.8399783, 
--0.839496, -0.839013, -0.8385299, -0.8380473, -0.8375656, -0.8370847, -0.836604, -0.8361229, -0.8356408, -0.835158, 
--0.8346748, -0.8341921, -0.8337102, -0.8332292, -0.8327485, -0.8322675, -0.8317856, -0.8313028, -0.8308197, -0.8303369, 
--0.8298548, -0.8293737, -0.8288929, -0.828412, -0.8279303, -0.8274477, -0.8269646, -0.8264817, -0.8259995, -0.8255182, 
--0.8250374, -0.8245565, -0.824075, -0.8235926, -0.8231096, -0.8226266, -0.8221442, -0.8216627, -0.8211818, -0.820701, 
--0.8202196, -0.8197374, -0.8192545, -0.8187715, -0.818289, -0.8178073, -0.8173263, -0.8168455, -0.8163642, -0.8158822, 
--0.8153994, -0.8149163, -0.8144337, -0.8139519, -0.8134708, -0.81299, -0.8125088, -0.8120269, -0.8115442, -0.8110612, 
--0.8105785, -0.8100965, -0.8096153, -0.8091345, -0.8086534, -0.8081716, -0.8076891, -0.8072061, -0.8067233, -0.8062412, 
--0.8057598, -0.8052789, -0.8047979, -0.8043163, -0.8038339, -0.803351, -0.8028682, -0.8023859, -0.8019044, -0.8014234, 
--0.8009425, -0.800461, -0.7999787, -0.7994959, -0.799013, -0.7985306, -0.798049, -0.7975679, -0.797087, -0.7966056, 
--0.7961235, -0.7956408, -0.7951579, -0.7946754, -0.7941936, -0.7937124, -0.7932315, -0.7927502, -0.7922683, -0.7917857, 
--0.7913028, -0.7908201, -0.7903382, -0.7898569, -0.789376, -0.7888948, -0.788413, -0.7879305, -0.7874476, -0.7869649, 
--0.7864828, -0.7860015, -0.7855205, -0.7850394, -0.7845577, -0.7840753, -0.7835925, -0.7831098, -0.7826275, -0.782146, 
--0.781665, -0.7811839, -0.7807024, -0.7802201, -0.7797374, -0.7792546, -0.7787722, -0.7782906, -0.7778095, -0.7773284, 
--0.776847, -0.7763649, -0.7758822, -0.7753994, -0.774917, -0.7744352, -0.773954, -0.773473, -0.7729916, -0.7725097, 
--0.7720271, -0.7715443, -0.7710617, -0.7705798, -0.7700985, -0.7696175, -0.7691362, -0.7686544, -0.7681719, -0.7676891, 
--0.7672065, -0.7667245, -0.7662431, -0.765762, -0.7652808, -0.7647991, -0.7643167, -0.763834, -0.7633513, -0.7628692, 
--0.7623876, -0.7619065, -0.7614254, -0.7609438, -0.7604615, -0.7599789, -0.7594961, -0.7590139, -0.7585322, -0.758051, 
--0.7575699, -0.7570884, -0.7566063, -0.7561237, -0.755641, -0.7551586, -0.7546768, -0.7541956, -0.7537145, -0.7532331, 
--0.7527511, -0.7522685, -0.7517858, -0.7513033, -0.7508214, -0.7503401, -0.749859, -0.7493777, -0.7488958, -0.7484134, 
--0.7479307, -0.7474481, -0.7469661, -0.7464847, -0.7460035, -0.7455223, -0.7450405, -0.7445582, -0.7440755, -0.7435929, 
--0.7431108, -0.7426292, -0.7421481, -0.7416669, -0.7411852, -0.740703, -0.7402203, -0.7397377, -0.7392555, -0.7387738, 
--0.7382926, -0.7378114, -0.7373299, -0.7368478, -0.7363652, -0.7358825, -0.7354002, -0.7349184, -0.7344371, -0.733956, 
--0.7334745, -0.7329925, -0.73251, -0.7320273, -0.7315449, -0.731063, -0.7305817, -0.7301005, -0.7296191, -0.7291372, 
--0.7286548, -0.7281722, -0.7276897, -0.7272077, -0.7267262, -0.7262451, -0.7257637, -0.725282, -0.7247996, -0.724317, 
--0.7238345, -0.7233524, -0.7228708, -0.7223896, -0.7219083, -0.7214266, -0.7209444, -0.7204618, -0.7199792, -0.719497, 
--0.7190154, -0.7185341, -0.7180529, -0.7175713, -0.7170892, -0.7166066, -0.716124, -0.7156418, -0.71516, -0.7146787, 
--0.7141975, -0.713716, -0.7132339, -0.7127515, -0.7122689, -0.7117865, -0.7113046, -0.7108232, -0.710342, -0.7098606, 
--0.7093787, -0.7088963, -0.7084137, -0.7079312, -0.7074493, -0.7069678, -0.7064866, -0.7060052, -0.7055234, -0.7050411, 
--0.7045585, -0.704076, -0.7035939, -0.7031124, -0.7026311, -0.7021498, -0.7016681, -0.7011859, -0.7007033, -0.7002208, 
--0.6997386, -0.699257, -0.6987757, -0.6982944, -0.6978128, -0.6973306, -0.6968481, -0.6963656, -0.6958833, -0.6954016, 
--0.6949202, -0.694439, -0.6939574, -0.6934754, -0.6929929, -0.6925104, -0.6920281, -0.6915462, -0.6910648, -0.6905835, 
--0.6901021, -0.6896201, -0.6891377, -0.6886552, -0.6881728, -0.6876909, -0.6872094, -0.6867281, -0.6862467, -0.6857649, 
--0.6852825, -0.6848, -0.6843175, -0.6838355, -0.683354, -0.6828727, -0.6823913, -0.6819096, -0.6814273, -0.6809448, 
--0.6804623, -0.6799802, -0.6794985, -0.6790172, -0.6785359, -0.6780542, -0.6775721, -0.6770896, -0.6766071, -0.6761249, 
--0.6756432, -0.6751618, -0.6746805, -0.6741989, -0.6737169, -0.6732344, -0.6727519, -0.6722696, -0.6717878, -0.6713064, 
--0.6708251, -0.6703435, -0.6698616, -0.6693792, -0.6688967, -0.6684143, -0.6679324, -0.6674509, -0.6669696, -0.6664882, 
--0.6660063, -0.665524, -0.6650415, -0.6645591, -0.6640771, -0.6635955, -0.6631142, -0.6626328, -0.662151, -0.6616688, 
--0.6611863, -0.6607038, -0.6602218, -0.6597401, -0.6592588, -0.6587774, -0.6582957, -0.6578136, -0.6573311, -0.6568486, 
--0.6563665, -0.6558847, -0.6554033, -0.654922, -0.6544404, -0.6539583, -0.6534759, -0.6529934, -0.6525112, -0.6520293, 
--0.6515479, -0.6510666, -0.650585, -0.6501031, -0.6496207, -0.6491382, -0.6486559, -0.648174, -0.6476925, -0.6472112, 
--0.6467297, -0.6462478, -0.6457655, -0.645283, -0.6448006, -0.6443186, -0.6438371, -0.6433557, -0.6428743, -0.6423925, 
--0.6419103, -0.6414278, -0.6409454, -0.6404633, -0.6399817, -0.6395003, -0.6390189, -0.6385372, -0.638055, -0.6375726, 
--0.6370901, -0.636608, -0.6361263, -0.6356449, -0.6351635, -0.6346819, -0.6341998, -0.6337174, -0.6332349, -0.6327527, 
--0.6322709, -0.6317895, -0.6313081, -0.6308265, -0.6303445, -0.6298622, -0.6293797, -0.6288974, -0.6284155, -0.627934, 
--0.6274527, -0.6269712, -0.6264892, -0.626007, -0.6255245, -0.6250422, -0.6245602, -0.6240786, -0.6235973, -0.6231158, 
--0.622634, -0.6221517, -0.6216693, -0.6211869, -0.6207049, -0.6202232, -0.6197418, -0.6192604, -0.6187787, -0.6182965, 
--0.6178141, -0.6173317, -0.6168496, -0.6163678, -0.6158864, -0.615405, -0.6149233, -0.6144413, -0.6139589, -0.6134764, 
--0.6129943, -0.6125125, -0.612031, -0.6115496, -0.611068, -0.610586, -0.6101037, -0.6096212, -0.609139, -0.6086571, 
--0.6081756, -0.6076942, -0.6072126, -0.6067307, -0.6062484, -0.605766, -0.6052837, -0.6048018, -0.6043202, -0.6038388, 
--0.6033573, -0.6028754, -0.6023932, -0.6019108, -0.6014284, -0.6009464, -0.6004648, -0.5999834, -0.5995019, -0.5990201, 
--0.598538, -0.5980556, -0.5975732, -0.5970911, -0.5966094, -0.596128, -0.5956465, -0.5951648, -0.5946827, -0.5942004, 
--0.593718, -0.5932358, -0.592754, -0.5922725, -0.5917911, -0.5913095, -0.5908275, -0.5903451, -0.5898627, -0.5893805, 
--0.5888987, -0.5884171, -0.5879357, -0.5874541, -0.5869722, -0.5864899, -0.5860075, -0.5855252, -0.5850433, -0.5845617, 
--0.5840803, -0.5835988, -0.5831169, -0.5826347, -0.5821523, -0.58167, -0.581188, -0.5807063, -0.5802249, -0.5797434, 
--0.5792616, -0.5787795, -0.5782971, -0.5778147, -0.5773326, -0.5768509, -0.5763695, -0.575888, -0.5754063, -0.5749242, 
--0.5744419, -0.5739595, -0.5734773, -0.5729956, -0.5725141, -0.5720326, -0.571551, -0.571069, -0.5705866, -0.5701042, 
--0.569622, -0.5691402, -0.5686587, -0.5681772, -0.5676956, -0.5672137, -0.5667314, -0.566249, -0.5657668, -0.5652849, 
--0.5648033, -0.5643218, -0.5638403, -0.5633584, -0.5628762, -0.5623938, -0.5619115, -0.5614295, -0.5609479, -0.5604664, 
--0.5599849, -0.5595031, -0.5590209, -0.5585386, -0.5580562, -0.5575742, -0.5570925, -0.556611, -0.5561295, -0.5556478, 
--0.5551657, -0.5546833, -0.554201, -0.5537189, -0.5532371, -0.5527556, -0.5522742, -0.5517925, -0.5513104, -0.5508281, 
--0.5503458, -0.5498636, -0.5493817, -0.5489002, -0.5484188, -0.5479371, -0.5474552, -0.5469729, -0.5464905, -0.5460083, 
--0.5455264, -0.5450448, -0.5445634, -0.5440818, -0.5435999, -0.5431177, -0.5426353, -0.542153, -0.5416711, -0.5411894, 
--0.540708, -0.5402264, -0.5397446, -0.5392624, -0.5387801, -0.5382978, -0.5378157, -0.537334, -0.5368526, -0.536371, 
--0.5358893, -0.5354072, -0.5349248, -0.5344425, -0.5339604, -0.5334787, -0.5329972, -0.5325157, -0.532034, -0.5315519, 
--0.5310696, -0.5305873, -0.5301051, -0.5296233, -0.5291418, -0.5286603, -0.5281786, -0.5276967, -0.5272144, -0.526732, 
--0.5262498, -0.5257679, -0.5252864, -0.5248049, -0.5243233, -0.5238414, -0.5233592, -0.5228768, -0.5223945, -0.5219126, 
--0.521431, -0.5209495, -0.5204679, -0.5199861, -0.5195039, -0.5190216, -0.5185393, -0.5180573, -0.5175756, -0.5170941, 
--0.5166126, -0.5161308, -0.5156487, -0.5151663, -0.514684, -0.5142019, -0.5137202, -0.5132387, -0.5127572, -0.5122755, 
--0.5117934, -0.5113111, -0.5108288, -0.5103466, -0.5098648, -0.5093833, -0.5089018, -0.5084201, -0.5079381, -0.5074559, 
--0.5069735, -0.5064914, -0.5060095, -0.5055279, -0.5050464, -0.5045648, -0.5040829, -0.5036006, -0.5031183, -0.5026361, 
--0.5021541, -0.5016725, -0.501191, -0.5007094, -0.5002276, -0.4997454, -0.4992631, -0.4987808, -0.4982988, -0.4978171, 
--0.4973356, -0.4968541, -0.4963723, -0.4958902, -0.4954078, -0.4949255, -0.4944435, -0.4939617, -0.4934802, -0.4929987, 
--0.492517, -0.4920349, -0.4915526, -0.4910703, -0.4905882, -0.4901064, -0.4896248, -0.4891433, -0.4886616, -0.4881796, 
--0.4876974, -0.487215, -0.4867329, -0.486251, -0.4857694, -0.4852879, -0.4848063, -0.4843244, -0.4838421, -0.4833598, 
--0.4828776, -0.4823957, -0.481914, -0.4814325, -0.4809509, -0.4804691, -0.4799869, -0.4795046, -0.4790223, -0.4785403, 
--0.4780587, -0.4775771, -0.4770956, -0.4766138, -0.4761316, -0.4756493, -0.4751671, -0.474685, -0.4742033, -0.4737218, 
--0.4732402, -0.4727585, -0.4722764, -0.4717941, -0.4713118, -0.4708297, -0.4703479, -0.4698664, -0.4693848, -0.4689031, 
--0.4684211, -0.4679389, -0.4674566, -0.4669744, -0.4664926, -0.466011, -0.4655295, -0.4650478, -0.4645658, -0.4640836, 
--0.4636013, -0.4631191, -0.4626372, -0.4621556, -0.4616741, -0.4611924, -0.4607106, -0.4602284, -0.4597461, -0.4592638, 
--0.4587819, -0.4583002, -0.4578187, -0.4573371, -0.4568553, -0.4563731, -0.4558908, -0.4554086, -0.4549265, -0.4544448, 
--0.4539633, -0.4534817, -0.453, -0.4525179, -0.4520356, -0.4515533, -0.4510712, -0.4505894, -0.4501079, -0.4496264, 
--0.4491446, -0.4486626, -0.4481804, -0.4476981, -0.4472159, -0.4467341, -0.4462525, -0.445771, -0.4452893, -0.4448073, 
--0.4443251, -0.4438428, -0.4433606, -0.4428787, -0.4423971, -0.4419156, -0.441434, -0.4409521, -0.4404699, -0.4399876, 
--0.4395054, -0.4390234, -0.4385417, -0.4380602, -0.4375786, -0.4370968, -0.4366146, -0.4361323, -0.4356501, -0.4351681, 
--0.4346864, -0.4342048, -0.4337232, -0.4332415, -0.4327594, -0.4322771, -0.4317948, -0.4313128, -0.430831, -0.4303494, 
--0.4298679, -0.4293861, -0.4289041, -0.4284219, -0.4279396, -0.4274575, -0.4269756, -0.426494, -0.4260125, -0.4255308, 
--0.4250488, -0.4245666, -0.4240843, -0.4236022, -0.4231203, -0.4226386, -0.4221571, -0.4216755, -0.4211936, -0.4207114, 
--0.4202291, -0.4197469, -0.4192649, -0.4187833, -0.4183017, -0.4178201, -0.4173383, -0.4168561, -0.4163738, -0.4158916, 
--0.4154096, -0.4149279, -0.4144463, -0.4139648, -0.413483, -0.4130009, -0.4125186, -0.4120363, -0.4115543, -0.4110725, 
--0.410591, -0.4101094, -0.4096276, -0.4091456, -0.4086634, -0.4081811, -0.407699, -0.4072172, -0.4067356, -0.406254, 
--0.4057723, -0.4052903, -0.4048081, -0.4043258, -0.4038437, -0.4033618, -0.4028802, -0.4023986, -0.401917, -0.4014351, 
--0.4009529, -0.4004706, -0.3999884, -0.3995065, -0.3990248, -0.3985433, -0.3980616, -0.3975798, -0.3970976, -0.3966153, 
--0.3961331, -0.3956511, -0.3951694, -0.3946879, -0.3942063, -0.3937245, -0.3932424, -0.3927601, -0.3922779, -0.3917958, 
--0.3913141, -0.3908325, -0.3903509, -0.3898691, -0.3893871, -0.3889049, -0.3884226, -0.3879405, -0.3874587, -0.3869771, 
--0.3864955, -0.3860138, -0.3855318, -0.3850496, -0.3845673, -0.3840852, -0.3836033, -0.3831217, -0.3826402, -0.3821585, 
--0.3816765, -0.3811944, -0.3807121, -0.3802299, -0.379748, -0.3792663, -0.3787848, -0.3783031, -0.3778213, -0.3773391, 
--0.3768568, -0.3763746, -0.3758927, -0.375411, -0.3749294, -0.3744478, -0.373966, -0.3734839, -0.3730016, -0.3725194, 
--0.3720373, -0.3715556, -0.371074, -0.3705924, -0.3701106, -0.3696286, -0.3691464, -0.3686641, -0.368182, -0.3677002, 
--0.3672186, -0.3667371, -0.3662553, -0.3657733, -0.3652911, -0.3648088, -0.3643267, -0.3638449, -0.3633632, -0.3628817, 
--0.3624, -0.361918, -0.3614359, -0.3609536, -0.3604714, -0.3599895, -0.3595079, -0.3590263, -0.3585447, -0.3580628, 
--0.3575806, -0.3570983, -0.3566162, -0.3561342, -0.3556525, -0.3551709, -0.3546893, -0.3542075, -0.3537254, -0.3532431, 
--0.3527609, -0.3522789, -0.3517971, -0.3513155, -0.3508339, -0.3503522, -0.3498701, -0.3493879, -0.3489056, -0.3484236, 
--0.3479418, -0.3474602, -0.3469786, -0.3464968, -0.3460148, -0.3455326, -0.3450504, -0.3445682, -0.3440864, -0.3436048, 
--0.3431232, -0.3426415, -0.3421595, -0.3416774, -0.3411951, -0.340713, -0.3402311, -0.3397494, -0.3392678, -0.3387862, 
--0.3383043, -0.3378221, -0.3373398, -0.3368577, -0.3363757, -0.335894, -0.3354124, -0.3349308, -0.334449, -0.3339669, 
--0.3334846, -0.3330024, -0.3325204, -0.3320386, -0.3315571, -0.3310755, -0.3305937, -0.3301116, -0.3296294, -0.3291471, 
--0.3286651, -0.3281833, -0.3277017, -0.3272201, -0.3267383, -0.3262563, -0.3257741, -0.3252919, -0.3248098, -0.3243279, 
--0.3238463, -0.3233647, -0.322883, -0.322401, -0.3219189, -0.3214366, -0.3209545, -0.3204726, -0.3199909, -0.3195094, 
--0.3190277, -0.3185458, -0.3180636, -0.3175814, -0.3170992, -0.3166172, -0.3161356, -0.315654, -0.3151723, -0.3146905, 
--0.3142084, -0.3137261, -0.3132439, -0.3127619, -0.3122802, -0.3117986, -0.311317, -0.3108352, -0.3103531, -0.3098709, 
--0.3093886, -0.3089066, -0.3084248, -0.3079432, -0.3074616, -0.3069798, -0.3064978, -0.3060156, -0.3055334, -0.3050513, 
--0.3045695, -0.3040878, -0.3036062, -0.3031245, -0.3026425, -0.3021604, -0.3016781, -0.301196, -0.3007141, -0.3002325, 
--0.2997509, -0.2992692, -0.2987873, -0.2983051, -0.2978229, -0.2973407, -0.2968588, -0.2963771, -0.2958955, -0.2954138, 
--0.294932, -0.2944499, -0.2939676, -0.2934854, -0.2930034, -0.2925217, -0.2920401, -0.2915585, -0.2910767, -0.2905946, 
--0.2901124, -0.2896301, -0.2891481, -0.2886663, -0.2881847, -0.2877031, -0.2872214, -0.2867393, -0.2862571, -0.2857749, 
--0.2852928, -0.284811, -0.2843294, -0.2838478, -0.283366, -0.282884, -0.2824019, -0.2819196, -0.2814375, -0.2809556, 
--0.280474, -0.2799924, -0.2795107, -0.2790288, -0.2785466, -0.2780644, -0.2775822, -0.2771003, -0.2766186, -0.276137, 
--0.2756554, -0.2751735, -0.2746914, -0.2742091, -0.2737269, -0.273245, -0.2727632, -0.2722816, -0.2718, -0.2713182, 
--0.2708361, -0.2703539, -0.2698717, -0.2693896, -0.2689079, -0.2684263, -0.2679447, -0.2674629, -0.2669808, -0.2664986, 
--0.2660164, -0.2655343, -0.2650525, -0.2645709, -0.2640893, -0.2636075, -0.2631256, -0.2626434, -0.2621611, -0.261679, 
--0.2611972, -0.2607155, -0.2602339, -0.2597522, -0.2592703, -0.2587881, -0.2583059, -0.2578237, -0.2573418, -0.2568601, 
--0.2563786, -0.2558969, -0.255415, -0.2549329, -0.2544506, -0.2539684, -0.2534865, -0.2530048, -0.2525232, -0.2520415, 
--0.2515597, -0.2510776, -0.2505954, -0.2501132, -0.2496312, -0.2491494, -0.2486678, -0.2481862, -0.2477044, -0.2472223, 
--0.2467401, -0.2462579, -0.2457758, -0.245294, -0.2448124, -0.2443308, -0.2438491, -0.2433671, -0.2428849, -0.2424026, 
--0.2419205, -0.2414387, -0.240957, -0.2404754, -0.2399937, -0.2395118, -0.2390296, -0.2385474, -0.2380652, -0.2375833, 
--0.2371017, -0.2366201, -0.2361384, -0.2356565, -0.2351744, -0.2346921, -0.23421, -0.233728, -0.2332463, -0.2327647, 
--0.232283, -0.2318012, -0.2313191, -0.2308369, -0.2303547, -0.2298727, -0.2293909, -0.2289093, -0.2284277, -0.2279459, 
--0.2274638, -0.2269816, -0.2264994, -0.2260174, -0.2255356, -0.2250539, -0.2245723, -0.2240906, -0.2236086, -0.2231264, 
--0.2226441, -0.2221621, -0.2216802, -0.2211986, -0.220717, -0.2202352, -0.2197533, -0.2192711, -0.2187889, -0.2183068, 
--0.2178249, -0.2173432, -0.2168616, -0.2163799, -0.215898, -0.2154159, -0.2149336, -0.2144515, -0.2139695, -0.2134878, 
--0.2130062, -0.2125246, -0.2120427, -0.2115606, -0.2110784, -0.2105962, -0.2101142, -0.2096325, -0.2091509, -0.2086692, 
--0.2081874, -0.2077053, -0.2072231, -0.2067409, -0.2062589, -0.2057771, -0.2052955, -0.2048139, -0.2043321, -0.2038501, 
--0.2033679, -0.2028856, -0.2024036, -0.2019217, -0.2014401, -0.2009585, -0.2004768, -0.1999948, -0.1995126, -0.1990304, 
--0.1985483, -0.1980664, -0.1975847, -0.1971031, -0.1966214, -0.1961395, -0.1956574, -0.1951751, -0.194693, -0.1942111, 
--0.1937294, -0.1932478, -0.1927661, -0.1922842, -0.1918021, -0.1913199, -0.1908377, -0.1903557, -0.189874, -0.1893924, 
--0.1889107, -0.1884289, -0.1879468, -0.1874646, -0.1869824, -0.1865004, -0.1860186, -0.185537, -0.1850554, -0.1845736, 
--0.1840916, -0.1836094, -0.1831272, -0.1826451, -0.1821633, -0.1816816, -0.1812, -0.1807183, -0.1802363, -0.1797541, 
--0.1792719, -0.1787898, -0.1783079, -0.1778263, -0.1773447, -0.1768629, -0.176381, -0.1758989, -0.1754166, -0.1749345, 
--0.1744526, -0.1739709, -0.1734893, -0.1730076, -0.1725257, -0.1720436, -0.1715614, -0.1710792, -0.1705973, -0.1701155, 
--0.1696339, -0.1691523, -0.1686704, -0.1681883, -0.1677061, -0.1672239, -0.1667419, -0.1662602, -0.1657785, -0.1652969, 
--0.1648151, -0.1643331, -0.1638509, -0.1633687, -0.1628866, -0.1624048, -0.1619232, -0.1614415, -0.1609598, -0.1604778, 
--0.1599956, -0.1595134, -0.1590313, -0.1585494, -0.1580678, -0.1575862, -0.1571045, -0.1566225, -0.1561404, -0.1556581, 
--0.155176, -0.1546941, -0.1542124, -0.1537308, -0.1532491, -0.1527672, -0.1522851, -0.1518029, -0.1513207, -0.1508388, 
--0.150357, -0.1498754, -0.1493938, -0.1489119, -0.1484298, -0.1479476, -0.1474654, -0.1469834, -0.1465017, -0.1460201, 
--0.1455384, -0.1450566, -0.1445746, -0.1440924, -0.1436102, -0.1431281, -0.1426463, -0.1421647, -0.1416831, -0.1412013, 
--0.1407193, -0.1402371, -0.1397549, -0.1392728, -0.138791, -0.1383093, -0.1378277, -0.137346, -0.136864, -0.1363819, 
--0.1358996, -0.1354175, -0.1349356, -0.1344539, -0.1339723, -0.1334906, -0.1330087, -0.1325266, -0.1320444, -0.1315622, 
--0.1310803, -0.1305986, -0.130117, -0.1296353, -0.1291534, -0.1286713, -0.1281891, -0.127707, -0.127225, -0.1267432, 
--0.1262616, -0.1257799, -0.1252981, -0.1248161, -0.1243339, -0.1238517, -0.1233696, -0.1228878, -0.1224062, -0.1219246, 
--0.1214428, -0.1209608, -0.1204786, -0.1199964, -0.1195143, -0.1190325, -0.1185508, -0.1180692, -0.1175875, -0.1171055, 
--0.1166234, -0.1161411, -0.115659, -0.1151771, -0.1146955, -0.1142139, -0.1137321, -0.1132502, -0.1127681, -0.1122859, 
--0.1118037, -0.1113218, -0.1108401, -0.1103585, -0.1098768, -0.1093949, -0.1089128, -0.1084306, -0.1079485, -0.1074665, 
--0.1069847, -0.1065031, -0.1060215, -0.1055396, -0.1050576, -0.1045754, -0.1040932, -0.1036112, -0.1031294, -0.1026477, 
--0.1021661, -0.1016843, -0.1012023, -0.1007201, -0.1002379, -0.0997559, -0.099274, -0.0987924, -0.0983107, -0.097829, 
--0.097347, -0.0968649, -0.0963826, -0.0959006, -0.0954187, -0.094937, -0.0944554, -0.0939737, -0.0934917, -0.0930096, 
--0.0925274, -0.0920453, -0.0915633, -0.0910816, -0.0906, -0.0901183, -0.0896364, -0.0891543, -0.0886721, -0.08819, 
--0.087708, -0.0872263, -0.0867446, -0.086263, -0.0857811, -0.0852991, -0.0848169, -0.0843347, -0.0838527, -0.0833709, 
--0.0828893, -0.0824076, -0.0819258, -0.0814438, -0.0809616, -0.0804794, -0.0799974, -0.0795155, -0.0790339, -0.0785523, 
--0.0780705, -0.0775885, -0.0771064, -0.0766242, -0.0761421, -0.0756602, -0.0751785, -0.0746969, -0.0742152, -0.0737332, 
--0.0732511, -0.0727689, -0.0722868, -0.0718049, -0.0713231, -0.0708415, -0.0703598, -0.069878, -0.0693958, -0.0689136, 
--0.0684315, -0.0679495, -0.0674678, -0.0669862, -0.0665045, -0.0660227, -0.0655406, -0.0650584, -0.0645762, -0.0640942, 
--0.0636124, -0.0631308, -0.0626492, -0.0621673, -0.0616853, -0.0612031, -0.0607209, -0.0602389, -0.0597571, -0.0592754, 
--0.0587938, -0.058312, -0.05783, -0.0573479, -0.0568657, -0.0563836, -0.0559017, -0.05542, -0.0549384, -0.0544567, 
--0.0539748, -0.0534926, -0.0530104, -0.0525283, -0.0520464, -0.0515647, -0.0510831, -0.0506014, -0.0501195, -0.0496373, 
--0.0491551, -0.048673, -0.048191, -0.0477093, -0.0472277, -0.046746, -0.0462642, -0.0457821, -0.0452999, -0.0448177, 
--0.0443357, -0.0438539, -0.0433723, -0.0428907, -0.0424089, -0.0419268, -0.0414446, -0.0409624, -0.0404804, -0.0399986, 
--0.0395169, -0.0390353, -0.0385535, -0.0380715, -0.0375894, -0.0371072, -0.0366251, -0.0361432, -0.0356616, -0.03518, 
--0.0346982, -0.0342163, -0.0337341, -0.0332519, -0.0327698, -0.0322879, -0.0318062, -0.0313246, -0.0308429, -0.030361, 
--0.0298789, -0.0293966, -0.0289145, -0.0284326, -0.0279508, -0.0274692, -0.0269875, -0.0265057, -0.0260236, -0.0255414, 
--0.0250592, -0.0245772, -0.0240955, -0.0236138, -0.0231322, -0.0226504, -0.0221683, -0.0216861, -0.0212039, -0.0207219, 
--0.0202401, -0.0197585, -0.0192768, -0.0187951, -0.018313, -0.0178309, -0.0173487, -0.0168666, -0.0163848, -0.0159031, 
--0.0154215, -0.0149397, -0.0144578, -0.0139756, -0.0134934, -0.0130113, -0.0125294, -0.0120477, -0.0115661, -0.0110844, 
--0.0106025, -0.0101204, -0.0096381, -0.009156, -0.0086741, -0.0081924, -0.0077107, -0.0072291, -0.0067472, -0.0062651, 
--0.0057829, -0.0053007, -0.0048187, -0.004337, -0.0038554, -0.0033737, -0.0028919, -0.0024098, -0.0019276, -0.0014454, 
--0.0009634, -0.0004816, 0.0, 0.0009627, 0.0019261, 0.0028903, 0.0038552, 0.0048202, 0.0057846, 0.0067481, 
-0.0077109, 0.0086735, 0.0096367, 0.0106008, 0.0115656, 0.0125306, 0.0134951, 0.0144588, 0.0154217, 0.0163844, 
-0.0173474, 0.0183113, 0.019276, 0.020241, 0.0212057, 0.0221696, 0.0231326, 0.0240952, 0.0250581, 0.0260218, 
-0.0269864, 0.0279514, 0.0289162, 0.0298803, 0.0308434, 0.0318061, 0.0327689, 0.0337324, 0.0346968, 0.0356618, 
-0.0366267, 0.0375909, 0.0385542, 0.0395169, 0.0404797, 0.041443, 0.0424073, 0.0433722, 0.0443372, 0.0453015, 
-0.046265, 0.0472278, 0.0481905, 0.0491537, 0.0501178, 0.0510826, 0.0520476, 0.0530121, 0.0539758, 0.0549386, 
-0.0559013, 0.0568644, 0.0578283, 0.058793, 0.059758, 0.0607227, 0.0616865, 0.0626495, 0.0636121, 0.0645751, 
-0.0655388, 0.0665034, 0.0674684, 0.0684332, 0.0693972, 0.0703603, 0.071323, 0.0722858, 0.0732494, 0.0742138, 
-0.0751788, 0.0761437, 0.0771079, 0.0780712, 0.0790338, 0.0799966, 0.08096, 0.0819243, 0.0828892, 0.0838542, 
-0.0848185, 0.085782, 0.0867447, 0.0877074, 0.0886706, 0.0896348, 0.0905996, 0.0915646, 0.0925291, 0.0934927, 
-0.0944556, 0.0954182, 0.0963813, 0.0973453, 0.09831, 0.0992751, 0.1002397, 0.1012035, 0.1021664, 0.103129, 
-0.104092, 0.1050558, 0.1060204, 0.1069855, 0.1079502, 0.1089142, 0.1098773, 0.1108399, 0.1118027, 0.1127663, 
-0.1137309, 0.1146959, 0.1156607, 0.1166249, 0.1175881, 0.1185508, 0.1195135, 0.1204769, 0.1214413, 0.1224063, 
-0.1233712, 0.1243355, 0.1252989, 0.1262616, 0.1272243, 0.1281876, 0.1291518, 0.1301166, 0.1310817, 0.1320461, 
-0.1330097, 0.1339725, 0.1349351, 0.1358982, 0.1368622, 0.137827, 0.1387921, 0.1397567, 0.1407204, 0.1416834, 
-0.142646, 0.1436089, 0.1445728, 0.1455374, 0.1465025, 0.1474672, 0.1484312, 0.1493942, 0.1503568, 0.1513197, 
-0.1522833, 0.1532479, 0.1542129, 0.1551778, 0.1561419, 0.157105, 0.1580677, 0.1590304, 0.1599939, 0.1609583, 
-0.1619233, 0.1628882, 0.1638525, 0.1648159, 0.1657786, 0.1667412, 0.1677045, 0.1686687, 0.1696337, 0.1705987, 
-0.1715631, 0.1725267, 0.1734894, 0.174452, 0.1754152, 0.1763792, 0.1773441, 0.1783091, 0.1792737, 0.1802374, 
-0.1812003, 0.1821629, 0.1831259, 0.1840897, 0.1850544, 0.1860195, 0.1869843, 0.1879481, 0.1889111, 0.1898737, 
-0.1908366, 0.1918003, 0.1927648, 0.1937299, 0.1946948, 0.1956588, 0.196622, 0.1975846, 0.1985473, 0.1995108, 
-0.2004753, 0.2014403, 0.2024053, 0.2033695, 0.2043328, 0.2052955, 0.2062581, 0.2072214, 0.2081857, 0.2091507, 
-0.2101157, 0.2110801, 0.2120436, 0.2130063, 0.2139689, 0.2149321, 0.2158962, 0.2168611, 0.2178261, 0.2187907, 
-0.2197544, 0.2207172, 0.2216798, 0.2226428, 0.2236067, 0.2245715, 0.2255366, 0.2265013, 0.2274651, 0.2284281, 
-0.2293906, 0.2303535, 0.2313172, 0.2322818, 0.233247, 0.2342118, 0.2351758, 0.2361389, 0.2371015, 0.2380642, 
-0.2390278, 0.2399923, 0.2409573, 0.2419223, 0.2428865, 0.2438498, 0.2448124, 0.245775, 0.2467384, 0.2477027, 
-0.2486677, 0.2496328, 0.2505972, 0.2515606, 0.2525233, 0.2534858, 0.254449, 0.2554132, 0.2563781, 0.2573432, 
-0.2583078, 0.2592714, 0.2602342, 0.2611967, 0.2621597, 0.2631236, 0.2640885, 0.2650536, 0.2660183, 0.2669821, 
-0.267945, 0.2689075, 0.2698704, 0.2708342, 0.2717988, 0.272764, 0.2737288, 0.2746928, 0.2756559, 0.2766184, 
-0.2775812, 0.2785447, 0.2795092, 0.2804744, 0.2814393, 0.2824035, 0.2833667, 0.2843293, 0.2852919, 0.2862553, 
-0.2872197, 0.2881847, 0.2891498, 0.2901142, 0.2910776, 0.2920402, 0.2930027, 0.2939659, 0.2949301, 0.2958951, 
-0.2968602, 0.2978248, 0.2987884, 0.2997511, 0.3007136, 0.3016766, 0.3026406, 0.3036055, 0.3045706, 0.3055354, 
-0.3064991, 0.307462, 0.3084244, 0.3093873, 0.3103511, 0.3113158, 0.312281, 0.3132459, 0.3142099, 0.3151728, 
-0.3161353, 0.317098, 0.3180616, 0.3190262, 0.3199914, 0.3209564, 0.3219206, 0.3228837, 0.3238462, 0.3248088, 
-0.3257722, 0.3267366, 0.3277018, 0.3286669, 0.3296312, 0.3305945, 0.3315571, 0.3325196, 0.3334828, 0.3344471, 
-0.3354121, 0.3363773, 0.3373418, 0.3383054, 0.339268, 0.3402305, 0.3411935, 0.3421575, 0.3431225, 0.3440877, 
-0.3450524, 0.3460161, 0.3469789, 0.3479413, 0.3489042, 0.349868, 0.3508328, 0.3517981, 0.352763, 0.3537269, 
-0.3546898, 0.3556522, 0.3566149, 0.3575785, 0.3585432, 0.3595084, 0.3604735, 0.3614376, 0.3624007, 0.3633631, 
-0.3643257, 0.3652891, 0.3662536, 0.3672188, 0.3681839, 0.3691483, 0.3701115, 0.371074, 0.3720365, 0.3729997, 
-0.373964, 0.3749291, 0.3758944, 0.3768589, 0.3778223, 0.3787849, 0.3797473, 0.3807104, 0.3816745, 0.3826395, 
-0.3836048, 0.3845695, 0.3855331, 0.3864958, 0.3874582, 0.3884211, 0.3893849, 0.3903498, 0.3913151, 0.39228, 
-0.3932439, 0.3942068, 0.3951691, 0.3961318, 0.3970955, 0.3980602, 0.3990255, 0.3999905, 0.4009546, 0.4019176, 
-0.40288, 0.4038426, 0.404806, 0.4057706, 0.4067358, 0.407701, 0.4086653, 0.4096285, 0.4105909, 0.4115534, 
-0.4125166, 0.413481, 0.4144462, 0.4154114, 0.416376, 0.4173394, 0.4183019, 0.4192642, 0.4202272, 0.4211914, 
-0.4221565, 0.4231218, 0.4240866, 0.4250502, 0.4260128, 0.4269751, 0.4279379, 0.4289019, 0.4298668, 0.4308322, 
-0.4317971, 0.4327609, 0.4337237, 0.434686, 0.4356486, 0.4366123, 0.4375772, 0.4385425, 0.4395076, 0.4404717, 
-0.4414346, 0.4423969, 0.4433594, 0.4443229, 0.4452875, 0.4462529, 0.4472181, 0.4481824, 0.4491455, 0.4501078, 
-0.4510702, 0.4520335, 0.4529979, 0.4539632, 0.4549285, 0.455893, 0.4568564, 0.4578188, 0.4587811, 0.4597441, 
-0.4607083, 0.4616735, 0.4626389, 0.4636036, 0.4645672, 0.4655297, 0.4664919, 0.4674548, 0.4684187, 0.4693838, 
-0.4703493, 0.4713142, 0.472278, 0.4732407, 0.4742029, 0.4751655, 0.4761292, 0.4770941, 0.4780596, 0.4790247, 
-0.4799888, 0.4809516, 0.4819138, 0.4828762, 0.4838397, 0.4848045, 0.4857699, 0.4867352, 0.4876995, 0.4886625, 
-0.4896247, 0.4905871, 0.4915503, 0.4925148, 0.4934802, 0.4944456, 0.4954101, 0.4963734, 0.4973357, 0.4982979, 
-0.4992609, 0.5002252, 0.5011905, 0.502156, 0.5031208, 0.5040843, 0.5050467, 0.5060088, 0.5069716, 0.5079356, 
-0.5089008, 0.5098664, 0.5108313, 0.5117951, 0.5127576, 0.5137197, 0.5146823, 0.5156461, 0.5166111, 0.5175767, 
-0.5185419, 0.5195059, 0.5204686, 0.5214306, 0.522393, 0.5233566, 0.5243214, 0.525287, 0.5262523, 0.5272166, 
-0.5281795, 0.5291416, 0.5301039, 0.5310671, 0.5320317, 0.5329973, 0.5339628, 0.5349273, 0.5358904, 0.5368526, 
-0.5378147, 0.5387777, 0.5397421, 0.5407075, 0.5416731, 0.5426379, 0.5436013, 0.5445636, 0.5455256, 0.5464884, 
-0.5474525, 0.5484178, 0.5493835, 0.5503485, 0.5513122, 0.5522746, 0.5532365, 0.5541991, 0.5551629, 0.5561281, 
-0.5570938, 0.558059, 0.559023, 0.5599856, 0.5609475, 0.5619098, 0.5628734, 0.5638384, 0.5648041, 0.5657695, 
-0.5667337, 0.5676965, 0.5686585, 0.5696206, 0.5705839, 0.5715487, 0.5725143, 0.5734799, 0.5744444, 0.5754075, 
-0.5763695, 0.5773315, 0.5782945, 0.579259, 0.5802246, 0.5811903, 0.5821551, 0.5831184, 0.5840805, 0.5850424, 
-0.5860051, 0.5869693, 0.5879348, 0.5889006, 0.5898657, 0.5908293, 0.5917915, 0.5927533, 0.5937158, 0.5946797, 
-0.595645, 0.5966109, 0.5975762, 0.5985401, 0.5995026, 0.6004643, 0.6014266, 0.6023902, 0.6033553, 0.6043212, 
-0.6052867, 0.6062509, 0.6072136, 0.6081753, 0.6091374, 0.6101007, 0.6110655, 0.6120314, 0.6129971, 0.6139616, 
-0.6149246, 0.6158864, 0.6168482, 0.6178112, 0.6187758, 0.6197416, 0.6207075, 0.6216723, 0.6226355, 0.6235974, 
-0.6245591, 0.6255218, 0.6264861, 0.6274518, 0.6284178, 0.6293829, 0.6303464, 0.6313085, 0.6322701, 0.6332325, 
-0.6341965, 0.635162, 0.6361281, 0.6370935, 0.6380573, 0.6390196, 0.6399811, 0.6409432, 0.6419069, 0.6428722, 
-0.6438383, 0.644804, 0.6457681, 0.6467306, 0.6476922, 0.648654, 0.6496174, 0.6505824, 0.6515485, 0.6525144, 
-0.6534789, 0.6544417, 0.6554032, 0.6563649, 0.6573279, 0.6582926, 0.6592587, 0.6602248, 0.6611896, 0.6621527, 
-0.6631143, 0.6640758, 0.6650385, 0.6660029, 0.6669688, 0.6679351, 0.6689002, 0.6698636, 0.6708255, 0.6717868, 
-0.6727491, 0.6737132, 0.674679, 0.6756453, 0.6766108, 0.6775746, 0.6785366, 0.6794979, 0.6804598, 0.6814236, 
-0.6823891, 0.6833555, 0.6843213, 0.6852854, 0.6862477, 0.6872089, 0.6881706, 0.689134, 0.6900992, 0.6910656, 
-0.6920317, 0.6929963, 0.6939588, 0.6949201, 0.6958815, 0.6968445, 0.6978094, 0.6987758, 0.6997421, 0.700707, 
-0.7016699, 0.7026312, 0.7035925, 0.704555, 0.7055196, 0.7064858, 0.7074524, 0.7084177, 0.7093809, 0.7103424, 
-0.7113035, 0.7122656, 0.7132298, 0.7141959, 0.7151626, 0.7161283, 0.7170919, 0.7180536, 0.7190145, 0.7199763, 
-0.7209401, 0.721906, 0.7228727, 0.7238388, 0.7248028, 0.7257648, 0.7267257, 0.7276871, 0.7286505, 0.729616, 
-0.7305828, 0.7315492, 0.7325137, 0.733476, 0.7344369, 0.735398, 0.7363609, 0.7373261, 0.7382929, 0.7392595, 
-0.7402245, 0.7411872, 0.7421481, 0.743109, 0.7440714, 0.7450362, 0.7460029, 0.7469698, 0.7479352, 0.7488983, 
-0.7498594, 0.75082, 0.751782, 0.7527464, 0.7537128, 0.75468, 0.7556459, 0.7566094, 0.7575707, 0.7585311, 
-0.7594927, 0.7604566, 0.7614228, 0.7623901, 0.7633564, 0.7643204, 0.765282, 0.7662423, 0.7672034, 0.7681668, 
-0.7691328, 0.7701001, 0.7710668, 0.7720314, 0.7729933, 0.7739536, 0.7749143, 0.7758772, 0.7768427, 0.77781, 
-0.7787772, 0.7797422, 0.7807046, 0.7816649, 0.7826253, 0.7835876, 0.7845527, 0.7855199, 0.7864874, 0.787453, 
-0.7884158, 0.7893763, 0.7903364, 0.7912981, 0.7922627, 0.7932298, 0.7941975, 0.7951637, 0.796127, 0.7970877, 
-0.7980476, 0.7990087, 0.7999728, 0.8009396, 0.8019075, 0.8028743, 0.8038382, 0.8047992, 0.8057588, 0.8067195, 
-0.8076829, 0.8086494, 0.8096175, 0.8105848, 0.8115493, 0.8125107, 0.8134702, 0.8144303, 0.8153931, 0.8163592, 
-0.8173273, 0.8182951, 0.8192603, 0.8202222, 0.8211817, 0.8221413, 0.8231034, 0.8240689, 0.825037, 0.8260053, 
-0.8269712, 0.8279336, 0.8288932, 0.8298524, 0.8308138, 0.8317787, 0.8327467, 0.8337154, 0.834682, 0.8356451, 
-0.8366049, 0.8375637, 0.8385243, 0.8394886, 0.8404563, 0.8414253, 0.8423927, 0.8433565, 0.8443166, 0.8452751, 
-0.8462349, 0.8471984, 0.8481658, 0.8491351, 0.8501032, 0.8510678, 0.8520283, 0.8529866, 0.8539457, 0.8549084, 
-0.8558753, 0.8568447, 0.8578136, 0.8587791, 0.8597401, 0.8606983, 0.8616567, 0.8626184, 0.8635847, 0.8645542, 
-0.8655238, 0.8664903, 0.867452, 0.8684101, 0.8693678, 0.8703286, 0.8712941, 0.8722636, 0.8732339, 0.8742013, 
-0.8751639, 0.8761221, 0.8770792, 0.8780388, 0.8790035, 0.8799728, 0.8809437, 0.8819122, 0.8828757, 0.8838343, 
-0.8847907, 0.8857493, 0.8867129, 0.8876818, 0.8886533, 0.889623, 0.8905876, 0.8915466, 0.8925025, 0.8934598, 
-0.8944223, 0.8953907, 0.8963626, 0.8973336, 0.8982994, 0.899259, 0.9002145, 0.9011706, 0.9021317, 0.9030994, 
-0.9040717, 0.9050439, 0.9060113, 0.9069717, 0.9079269, 0.9088817, 0.9098411, 0.9108079, 0.9117805, 0.912754, 
-0.9137231, 0.9146845, 0.9156396, 0.916593, 0.9175506, 0.9185161, 0.9194888, 0.9204638, 0.9214348, 0.9223977, 
-0.9233527, 0.9243046, 0.9252601, 0.9262241, 0.9271967, 0.9281732, 0.9291466, 0.9301112, 0.9310663, 0.9320166, 
-0.9329697, 0.9339316, 0.934904, 0.9358822, 0.9368583, 0.9378252, 0.9387807, 0.9397293, 0.9406792, 0.9416386, 
-0.9426103, 0.9435905, 0.94457, 0.9455399, 0.9464963, 0.9474426, 0.9483886, 0.9493445, 0.9503153, 0.9512978, 
-0.9522819, 0.953256, 0.9542136, 0.9551572, 0.9560978, 0.9570486, 0.9580178, 0.9590036, 0.9599943, 0.9609747, 
-0.9619342, 0.9628739, 0.9638062, 0.964749, 0.9657156, 0.9667066, 0.9677083, 0.9686992, 0.9696622, 0.9705945, 
-0.9715115, 0.9724393, 0.9734013, 0.9744036, 0.9754288, 0.9764429, 0.9774123, 0.9783242, 0.9791992, 0.980086, 
-0.9810402, 0.9820912, 0.9832151, 0.9843233, 0.9852779, 0.9859289, 0.9861604, 0.9859289, 0.9852779, 0.9843233, 
-0.9832151, 0.9820912, 0.9810402, 0.980086, 0.9791992, 0.9783242, 0.9774123, 0.9764429, 0.9754288, 0.9744036, 
-0.9734013, 0.9724393, 0.9715115, 0.9705945, 0.9696622, 0.9686992, 0.9677083, 0.9667066, 0.9657156, 0.964749, 
-0.9638062, 0.9628739, 0.9619342, 0.9609747, 0.9599943, 0.9590036, 0.9580178, 0.9570486, 0.9560978, 0.9551572, 
-0.9542136, 0.953256, 0.9522819, 0.9512978, 0.9503153, 0.9493445, 0.9483886, 0.9474426, 0.9464963, 0.9455399, 
-0.94457, 0.9435905, 0.9426103, 0.9416386, 0.9406792, 0.9397293, 0.9387807, 0.9378252, 0.9368583, 0.9358822, 
-0.934904, 0.9339316, 0.9329697, 0.9320166, 0.9310663, 0.9301112, 0.9291466, 0.9281732, 0.9271967, 0.9262241, 
-0.9252601, 0.9243046, 0.9233527, 0.9223977, 0.9214348, 0.9204638, 0.9194888, 0.9185161, 0.9175506, 0.916593, 
-0.9156396, 0.9146845, 0.9137231, 0.912754, 0.9117805, 0.9108079, 0.9098411, 0.9088817, 0.9079269, 0.9069717, 
-0.9060113, 0.9050439, 0.9040717, 0.9030994, 0.9021317, 0.9011706, 0.9002145, 0.899259, 0.8982994, 0.8973336, 
-0.8963626, 0.8953907, 0.8944223, 0.8934598, 0.8925025, 0.8915466, 0.8905876, 0.889623, 0.8886533, 0.8876818, 
-0.8867129, 0.8857493, 0.8847907, 0.8838343, 0.8828757, 0.8819122, 0.8809437, 0.8799728, 0.8790035, 0.8780388, 
-0.8770792, 0.8761221, 0.8751639, 0.8742013, 0.8732339, 0.8722636, 0.8712941, 0.8703286, 0.8693678, 0.8684101, 
-0.867452, 0.8664903, 0.8655238, 0.8645542, 0.8635847, 0.8626184, 0.8616567, 0.8606983, 0.8597401, 0.8587791, 
-0.8578136, 0.8568447, 0.8558753, 0.8549084, 0.8539457, 0.8529866, 0.8520283, 0.8510678, 0.8501032, 0.8491351, 
-0.8481658, 0.8471984, 0.8462349, 0.8452751, 0.8443166, 0.8433565, 0.8423927, 0.8414253, 0.8404563, 0.8394886, 
-0.8385243, 0.8375637, 0.8366049, 0.8356451, 0.834682, 0.8337154, 0.8327467, 0.8317787, 0.8308138, 0.8298524, 
-0.8288932, 0.8279336, 0.8269712, 0.8260053, 0.825037, 0.8240689, 0.8231034, 0.8221413, 0.8211817, 0.8202222, 
-0.8192603, 0.8182951, 0.8173273, 0.8163592, 0.8153931, 0.8144303, 0.8134702, 0.8125107, 0.8115493, 0.8105848, 
-0.8096175, 0.8086494, 0.8076829, 0.8067195, 0.8057588, 0.8047992, 0.8038382, 0.8028743, 0.8019075, 0.8009396, 
-0.7999728, 0.7990087, 0.7980476, 0.7970877, 0.796127, 0.7951637, 0.7941975, 0.7932298, 0.7922627, 0.7912981, 
-0.7903364, 0.7893763, 0.7884158, 0.787453, 0.7864874, 0.7855199, 0.7845527, 0.7835876, 0.7826253, 0.7816649, 
-0.7807046, 0.7797422, 0.7787772, 0.77781, 0.7768427, 0.7758772, 0.7749143, 0.7739536, 0.7729933, 0.7720314, 
-0.7710668, 0.7701001, 0.7691328, 0.7681668, 0.7672034, 0.7662423, 0.765282, 0.7643204, 0.7633564, 0.7623901, 
-0.7614228, 0.7604566, 0.7594927, 0.7585311, 0.7575707, 0.7566094, 0.7556459, 0.75468, 0.7537128, 0.7527464, 
-0.751782, 0.75082, 0.7498594, 0.7488983, 0.7479352, 0.7469698, 0.7460029, 0.7450362, 0.7440714, 0.743109, 
-0.7421481, 0.7411872, 0.7402245, 0.7392595, 0.7382929, 0.7373261, 0.7363609, 0.735398, 0.7344369, 0.733476, 
-0.7325137, 0.7315492, 0.7305828, 0.729616, 0.7286505, 0.7276871, 0.7267257, 0.7257648, 0.7248028, 0.7238388, 
-0.7228727, 0.721906, 0.7209401, 0.7199763, 0.7190145, 0.7180536, 0.7170919, 0.7161283, 0.7151626, 0.7141959, 
-0.7132298, 0.7122656, 0.7113035, 0.7103424, 0.7093809, 0.7084177, 0.7074524, 0.7064858, 0.7055196, 0.704555, 
-0.7035925, 0.7026312, 0.7016699, 0.700707, 0.6997421, 0.6987758, 0.6978094, 0.6968445, 0.6958815, 0.6949201, 
-0.6939588, 0.6929963, 0.6920317, 0.6910656, 0.6900992, 0.689134, 0.6881706, 0.6872089, 0.6862477, 0.6852854, 
-0.6843213, 0.6833555, 0.6823891, 0.6814236, 0.6804598, 0.6794979, 0.6785366, 0.6775746, 0.6766108, 0.6756453, 
-0.674679, 0.6737132, 0.6727491, 0.6717868, 0.6708255, 0.6698636, 0.6689002, 0.6679351, 0.6669688, 0.6660029, 
-0.6650385, 0.6640758, 0.6631143, 0.6621527, 0.6611896, 0.6602248, 0.6592587, 0.6582926, 0.6573279, 0.6563649, 
-0.6554032, 0.6544417, 0.6534789, 0.6525144, 0.6515485, 0.6505824, 0.6496174, 0.648654, 0.6476922, 0.6467306, 
-0.6457681, 0.644804, 0.6438383, 0.6428722, 0.6419069, 0.6409432, 0.6399811, 0.6390196, 0.6380573, 0.6370935, 
-0.6361281, 0.635162, 0.6341965, 0.6332325, 0.6322701, 0.6313085, 0.6303464, 0.6293829, 0.6284178, 0.6274518, 
-0.6264861, 0.6255218, 0.6245591, 0.6235974, 0.6226355, 0.6216723, 0.6207075, 0.6197416, 0.6187758, 0.6178112, 
-0.6168482, 0.6158864, 0.6149246, 0.6139616, 0.6129971, 0.6120314, 0.6110655, 0.6101007, 0.6091374, 0.6081753, 
-0.6072136, 0.6062509, 0.6052867, 0.6043212, 0.6033553, 0.6023902, 0.6014266, 0.6004643, 0.5995026, 0.5985401, 
-0.5975762, 0.5966109, 0.595645, 0.5946797, 0.5937158, 0.5927533, 0.5917915, 0.5908293, 0.5898657, 0.5889006, 
-0.5879348, 0.5869693, 0.5860051, 0.5850424, 0.5840805, 0.5831184, 0.5821551, 0.5811903, 0.5802246, 0.579259, 
-0.5782945, 0.5773315, 0.5763695, 0.5754075, 0.5744444, 0.5734799, 0.5725143, 0.5715487, 0.5705839, 0.5696206, 
-0.5686585, 0.5676965, 0.5667337, 0.5657695, 0.5648041, 0.5638384, 0.5628734, 0.5619098, 0.5609475, 0.5599856, 
-0.559023, 0.558059, 0.5570938, 0.5561281, 0.5551629, 0.5541991, 0.5532365, 0.5522746, 0.5513122, 0.5503485, 
-0.5493835, 0.5484178, 0.5474525, 0.5464884, 0.5455256, 0.5445636, 0.5436013, 0.5426379, 0.5416731, 0.5407075, 
-0.5397421, 0.5387777, 0.5378147, 0.5368526, 0.5358904, 0.5349273, 0.5339628, 0.5329973, 0.5320317, 0.5310671, 
-0.5301039, 0.5291416, 0.5281795, 0.5272166, 0.5262523, 0.525287, 0.5243214, 0.5233566, 0.522393, 0.5214306, 
-0.5204686, 0.5195059, 0.5185419, 0.5175767, 0.5166111, 0.5156461, 0.5146823, 0.5137197, 0.5127576, 0.5117951, 
-0.5108313, 0.5098664, 0.5089008, 0.5079356, 0.5069716, 0.5060088, 0.5050467, 0.5040843, 0.5031208, 0.502156, 
-0.5011905, 0.5002252, 0.4992609, 0.4982979, 0.4973357, 0.4963734, 0.4954101, 0.4944456, 0.4934802, 0.4925148, 
-0.4915503, 0.4905871, 0.4896247, 0.4886625, 0.4876995, 0.4867352, 0.4857699, 0.4848045, 0.4838397, 0.4828762, 
-0.4819138, 0.4809516, 0.4799888, 0.4790247, 0.4780596, 0.4770941, 0.4761292, 0.4751655, 0.4742029, 0.4732407, 
-0.472278, 0.4713142, 0.4703493, 0.4693838, 0.4684187, 0.4674548, 0.4664919, 0.4655297, 0.4645672, 0.4636036, 
-0.4626389, 0.4616735, 0.4607083, 0.4597441, 0.4587811, 0.4578188, 0.4568564, 0.455893, 0.4549285, 0.4539632, 
-0.4529979, 0.4520335, 0.4510702, 0.4501078, 0.4491455, 0.4481824, 0.4472181, 0.4462529, 0.4452875, 0.4443229, 
-0.4433594, 0.4423969, 0.4414346, 0.4404717, 0.4395076, 0.4385425, 0.4375772, 0.4366123, 0.4356486, 0.434686, 
-0.4337237, 0.4327609, 0.4317971, 0.4308322, 0.4298668, 0.4289019, 0.4279379, 0.4269751, 0.4260128, 0.4250502, 
-0.4240866, 0.4231218, 0.4221565, 0.4211914, 0.4202272, 0.4192642, 0.4183019, 0.4173394, 0.416376, 0.4154114, 
-0.4144462, 0.413481, 0.4125166, 0.4115534, 0.4105909, 0.4096285, 0.4086653, 0.407701, 0.4067358, 0.4057706, 
-0.404806, 0.4038426, 0.40288, 0.4019176, 0.4009546, 0.3999905, 0.3990255, 0.3980602, 0.3970955, 0.3961318, 
-0.3951691, 0.3942068, 0.3932439, 0.39228, 0.3913151, 0.3903498, 0.3893849, 0.3884211, 0.3874582, 0.3864958, 
-0.3855331, 0.3845695, 0.3836048, 0.3826395, 0.3816745, 0.3807104, 0.3797473, 0.3787849, 0.3778223, 0.3768589, 
-0.3758944, 0.3749291, 0.373964, 0.3729997, 0.3720365, 0.371074, 0.3701115, 0.3691483, 0.3681839, 0.3672188, 
-0.3662536, 0.3652891, 0.3643257, 0.3633631, 0.3624007, 0.3614376, 0.3604735, 0.3595084, 0.3585432, 0.3575785, 
-0.3566149, 0.3556522, 0.3546898, 0.3537269, 0.352763, 0.3517981, 0.3508328, 0.349868, 0.3489042, 0.3479413, 
-0.3469789, 0.3460161, 0.3450524, 0.3440877, 0.3431225, 0.3421575, 0.3411935, 0.3402305, 0.339268, 0.3383054, 
-0.3373418, 0.3363773, 0.3354121, 0.3344471, 0.3334828, 0.3325196, 0.3315571, 0.3305945, 0.3296312, 0.3286669, 
-0.3277018, 0.3267366, 0.3257722, 0.3248088, 0.3238462, 0.3228837, 0.3219206, 0.3209564, 0.3199914, 0.3190262, 
-0.3180616, 0.317098, 0.3161353, 0.3151728, 0.3142099, 0.3132459, 0.312281, 0.3113158, 0.3103511, 0.3093873, 
-0.3084244, 0.307462, 0.3064991, 0.3055354, 0.3045706, 0.3036055, 0.3026406, 0.3016766, 0.3007136, 0.2997511, 
-0.2987884, 0.2978248, 0.2968602, 0.2958951, 0.2949301, 0.2939659, 0.2930027, 0.2920402, 0.2910776, 0.2901142, 
-0.2891498, 0.2881847, 0.2872197, 0.2862553, 0.2852919, 0.2843293, 0.2833667, 0.2824035, 0.2814393, 0.2804744, 
-0.2795092, 0.2785447, 0.2775812, 0.2766184, 0.2756559, 0.2746928, 0.2737288, 0.272764, 0.2717988, 0.2708342, 
-0.2698704, 0.2689075, 0.267945, 0.2669821, 0.2660183, 0.2650536, 0.2640885, 0.2631236, 0.2621597, 0.2611967, 
-0.2602342, 0.2592714, 0.2583078, 0.2573432, 0.2563781, 0.2554132, 0.254449, 0.2534858, 0.2525233, 0.2515606, 
-0.2505972, 0.2496328, 0.2486677, 0.2477027, 0.2467384, 0.245775, 0.2448124, 0.2438498, 0.2428865, 0.2419223, 
-0.2409573, 0.2399923, 0.2390278, 0.2380642, 0.2371015, 0.2361389, 0.2351758, 0.2342118, 0.233247, 0.2322818, 
-0.2313172, 0.2303535, 0.2293906, 0.2284281, 0.2274651, 0.2265013, 0.2255366, 0.2245715, 0.2236067, 0.2226428, 
-0.2216798, 0.2207172, 0.2197544, 0.2187907, 0.2178261, 0.2168611, 0.2158962, 0.2149321, 0.2139689, 0.2130063, 
-0.2120436, 0.2110801, 0.2101157, 0.2091507, 0.2081857, 0.2072214, 0.2062581, 0.2052955, 0.2043328, 0.2033695, 
-0.2024053, 0.2014403, 0.2004753, 0.1995108, 0.1985473, 0.1975846, 0.196622, 0.1956588, 0.1946948, 0.1937299, 
-0.1927648, 0.1918003, 0.1908366, 0.1898737, 0.1889111, 0.1879481, 0.1869843, 0.1860195, 0.1850544, 0.1840897, 
-0.1831259, 0.1821629, 0.1812003, 0.1802374, 0.1792737, 0.1783091, 0.1773441, 0.1763792, 0.1754152, 0.174452, 
-0.1734894, 0.1725267, 0.1715631, 0.1705987, 0.1696337, 0.1686687, 0.1677045, 0.1667412, 0.1657786, 0.1648159, 
-0.1638525, 0.1628882, 0.1619233, 0.1609583, 0.1599939, 0.1590304, 0.1580677, 0.157105, 0.1561419, 0.1551778, 
-0.1542129, 0.1532479, 0.1522833, 0.1513197, 0.1503568, 0.1493942, 0.1484312, 0.1474672, 0.1465025, 0.1455374, 
-0.1445728, 0.1436089, 0.142646, 0.1416834, 0.1407204, 0.1397567, 0.1387921, 0.137827, 0.1368622, 0.1358982, 
-0.1349351, 0.1339725, 0.1330097, 0.1320461, 0.1310817, 0.1301166, 0.1291518, 0.1281876, 0.1272243, 0.1262616, 
-0.1252989, 0.1243355, 0.1233712, 0.1224063, 0.1214413, 0.1204769, 0.1195135, 0.1185508, 0.1175881, 0.1166249, 
-0.1156607, 0.1146959, 0.1137309, 0.1127663, 0.1118027, 0.1108399, 0.1098773, 0.1089142, 0.1079502, 0.1069855, 
-0.1060204, 0.1050558, 0.104092, 0.103129, 0.1021664, 0.1012035, 0.1002397, 0.0992751, 0.09831, 0.0973453, 
-0.0963813, 0.0954182, 0.0944556, 0.0934927, 0.0925291, 0.0915646, 0.0905996, 0.0896348, 0.0886706, 0.0877074, 
-0.0867447, 0.085782, 0.0848185, 0.0838542, 0.0828892, 0.0819243, 0.08096, 0.0799966, 0.0790338, 0.0780712, 
-0.0771079, 0.0761437, 0.0751788, 0.0742138, 0.0732494, 0.0722858, 0.071323, 0.0703603, 0.0693972, 0.0684332, 
-0.0674684, 0.0665034, 0.0655388, 0.0645751, 0.0636121, 0.0626495, 0.0616865, 0.0607227, 0.059758, 0.058793, 
-0.0578283, 0.0568644, 0.0559013, 0.0549386, 0.0539758, 0.0530121, 0.0520476, 0.0510826, 0.0501178, 0.0491537, 
-0.0481905, 0.0472278, 0.046265, 0.0453015, 0.0443372, 0.0433722, 0.0424073, 0.041443, 0.0404797, 0.0395169, 
-0.0385542, 0.0375909, 0.0366267, 0.0356618, 0.0346968, 0.0337324, 0.0327689, 0.0318061, 0.0308434, 0.0298803, 
-0.0289162, 0.0279514, 0.0269864, 0.0260218, 0.0250581, 0.0240952, 0.0231326, 0.0221696, 0.0212057, 0.020241, 
-0.019276, 0.0183113, 0.0173474, 0.0163844, 0.0154217, 0.0144588, 0.0134951, 0.0125306, 0.0115656, 0.0106008, 
-0.0096367, 0.0086735, 0.0077109, 0.0067481, 0.0057846, 0.0048202, 0.0038552, 0.0028903, 0.0019261, 0.0009627, 
-0.0, -0.0009627, -0.0019261, -0.0028903, -0.0038552, -0.0048202, -0.0057846, -0.0067481, -0.0077109, -0.0086735, 
--0.0096367, -0.0106008, -0.0115656, -0.0125306, -0.0134951, -0.0144588, -0.0154217, -0.0163844, -0.0173474, -0.0183113, 
--0.019276, -0.020241, -0.0212057, -0.0221696, -0.0231326, -0.0240952, -0.0250581, -0.0260218, -0.0269864, -0.0279514, 
--0.0289162, -0.0298803, -0.0308434, -0.0318061, -0.0327689, -0.0337324, -0.0346968, -0.0356618, -0.0366267, -0.0375909, 
--0.0385542, -0.0395169, -0.0404797, -0.041443, -0.0424073, -0.0433722, -0.0443372, -0.0453015, -0.046265, -0.0472278, 
--0.0481905, -0.0491537, -0.0501178, -0.0510826, -0.0520476, -0.0530121, -0.0539758, -0.0549386, -0.0559013, -0.0568644, 
--0.0578283, -0.058793, -0.059758, -0.0607227, -0.0616865, -0.0626495, -0.0636121, -0.0645751, -0.0655388, -0.0665034, 
--0.0674684, -0.0684332, -0.0693972, -0.0703603, -0.071323, -0.0722858, -0.0732494, -0.0742138, -0.0751788, -0.0761437, 
--0.0771079, -0.0780712, -0.0790338, -0.0799966, -0.08096, -0.0819243, -0.0828892, -0.0838542, -0.0848185, -0.085782, 
--0.0867447, -0.0877074, -0.0886706, -0.0896348, -0.0905996, -0.0915646, -0.0925291, -0.0934927, -0.0944556, -0.0954182, 
--0.0963813, -0.0973453, -0.09831, -0.0992751, -0.1002397, -0.1012035, -0.1021664, -0.103129, -0.104092, -0.1050558, 
--0.1060204, -0.1069855, -0.1079502, -0.1089142, -0.1098773, -0.1108399, -0.1118027, -0.1127663, -0.1137309, -0.1146959, 
--0.1156607, -0.1166249, -0.1175881, -0.1185508, -0.1195135, -0.1204769, -0.1214413, -0.1224063, -0.1233712, -0.1243355, 
--0.1252989, -0.1262616, -0.1272243, -0.1281876, -0.1291518, -0.1301166, -0.1310817, -0.1320461, -0.1330097, -0.1339725, 
--0.1349351, -0.1358982, -0.1368622, -0.137827, -0.1387921, -0.1397567, -0.1407204, -0.1416834, -0.142646, -0.1436089, 
--0.1445728, -0.1455374, -0.1465025, -0.1474672, -0.1484312, -0.1493942, -0.1503568, -0.1513197, -0.1522833, -0.1532479, 
--0.1542129, -0.1551778, -0.1561419, -0.157105, -0.1580677, -0.1590304, -0.1599939, -0.1609583, -0.1619233, -0.1628882, 
--0.1638525, -0.1648159, -0.1657786, -0.1667412, -0.1677045, -0.1686687, -0.1696337, -0.1705987, -0.1715631, -0.1725267, 
--0.1734894, -0.174452, -0.1754152, -0.1763792, -0.1773441, -0.1783091, -0.1792737, -0.1802374, -0.1812003, -0.1821629, 
--0.1831259, -0.1840897, -0.1850544, -0.1860195, -0.1869843, -0.1879481, -0.1889111, -0.1898737, -0.1908366, -0.1918003, 
--0.1927648, -0.1937299, -0.1946948, -0.1956588, -0.196622, -0.1975846, -0.1985473, -0.1995108, -0.2004753, -0.2014403, 
--0.2024053, -0.2033695, -0.2043328, -0.2052955, -0.2062581, -0.2072214, -0.2081857, -0.2091507, -0.2101157, -0.2110801, 
--0.2120436, -0.2130063, -0.2139689, -0.2149321, -0.2158962, -0.2168611, -0.2178261, -0.2187907, -0.2197544, -0.2207172, 
--0.2216798, -0.2226428, -0.2236067, -0.2245715, -0.2255366, -0.2265013, -0.2274651, -0.2284281, -0.2293906, -0.2303535, 
--0.2313172, -0.2322818, -0.233247, -0.2342118, -0.2351758, -0.2361389, -0.2371015, -0.2380642, -0.2390278, -0.2399923, 
--0.2409573, -0.2419223, -0.2428865, -0.2438498, -0.2448124, -0.245775, -0.2467384, -0.2477027, -0.2486677, -0.2496328, 
--0.2505972, -0.2515606, -0.2525233, -0.2534858, -0.254449, -0.2554132, -0.2563781, -0.2573432, -0.2583078, -0.2592714, 
--0.2602342, -0.2611967, -0.2621597, -0.2631236, -0.2640885, -0.2650536, -0.2660183, -0.2669821, -0.267945, -0.2689075, 
--0.2698704, -0.2708342, -0.2717988, -0.272764, -0.2737288, -0.2746928, -0.2756559, -0.2766184, -0.2775812, -0.2785447, 
--0.2795092, -0.2804744, -0.2814393, -0.2824035, -0.2833667, -0.2843293, -0.2852919, -0.2862553, -0.2872197, -0.2881847, 
--0.2891498, -0.2901142, -0.2910776, -0.2920402, -0.2930027, -0.2939659, -0.2949301, -0.2958951, -0.2968602, -0.2978248, 
--0.2987884, -0.2997511, -0.3007136, -0.3016766, -0.3026406, -0.3036055, -0.3045706, -0.3055354, -0.3064991, -0.307462, 
--0.3084244, -0.3093873, -0.3103511, -0.3113158, -0.312281, -0.3132459, -0.3142099, -0.3151728, -0.3161353, -0.317098, 
--0.3180616, -0.3190262, -0.3199914, -0.3209564, -0.3219206, -0.3228837, -0.3238462, -0.3248088, -0.3257722, -0.3267366, 
--0.3277018, -0.3286669, -0.3296312, -0.3305945, -0.3315571, -0.3325196, -0.3334828, -0.3344471, -0.3354121, -0.3363773, 
--0.3373418, -0.3383054, -0.339268, -0.3402305, -0.3411935, -0.3421575, -0.3431225, -0.3440877, -0.3450524, -0.3460161, 
--0.3469789, -0.3479413, -0.3489042, -0.349868, -0.3508328, -0.3517981, -0.352763, -0.3537269, -0.3546898, -0.3556522, 
--0.3566149, -0.3575785, -0.3585432, -0.3595084, -0.3604735, -0.3614376, -0.3624007, -0.3633631, -0.3643257, -0.3652891, 
--0.3662536, -0.3672188, -0.3681839, -0.3691483, -0.3701115, -0.371074, -0.3720365, -0.3729997, -0.373964, -0.3749291, 
--0.3758944, -0.3768589, -0.3778223, -0.3787849, -0.3797473, -0.3807104, -0.3816745, -0.3826395, -0.3836048, -0.3845695, 
--0.3855331, -0.3864958, -0.3874582, -0.3884211, -0.3893849, -0.3903498, -0.3913151, -0.39228, -0.3932439, -0.3942068, 
--0.3951691, -0.3961318, -0.3970955, -0.3980602, -0.3990255, -0.3999905, -0.4009546, -0.4019176, -0.40288, -0.4038426, 
--0.404806, -0.4057706, -0.4067358, -0.407701, -0.4086653, -0.4096285, -0.4105909, -0.4115534, -0.4125166, -0.413481, 
--0.4144462, -0.4154114, -0.416376, -0.4173394, -0.4183019, -0.4192642, -0.4202272, -0.4211914, -0.4221565, -0.4231218, 
--0.4240866, -0.4250502, -0.4260128, -0.4269751, -0.4279379, -0.4289019, -0.4298668, -0.4308322, -0.4317971, -0.4327609, 
--0.4337237, -0.434686, -0.4356486, -0.4366123, -0.4375772, -0.4385425, -0.4395076, -0.4404717, -0.4414346, -0.4423969, 
--0.4433594, -0.4443229, -0.4452875, -0.4462529, -0.4472181, -0.4481824, -0.4491455, -0.4501078, -0.4510702, -0.4520335, 
--0.4529979, -0.4539632, -0.4549285, -0.455893, -0.4568564, -0.4578188, -0.4587811, -0.4597441, -0.4607083, -0.4616735, 
--0.4626389, -0.4636036, -0.4645672, -0.4655297, -0.4664919, -0.4674548, -0.4684187, -0.4693838, -0.4703493, -0.4713142, 
--0.472278, -0.4732407, -0.4742029, -0.4751655, -0.4761292, -0.4770941, -0.4780596, -0.4790247, -0.4799888, -0.4809516, 
--0.4819138, -0.4828762, -0.4838397, -0.4848045, -0.4857699, -0.4867352, -0.4876995, -0.4886625, -0.4896247, -0.4905871, 
--0.4915503, -0.4925148, -0.4934802, -0.4944456, -0.4954101, -0.4963734, -0.4973357, -0.4982979, -0.4992609, -0.5002252, 
--0.5011905, -0.502156, -0.5031208, -0.5040843, -0.5050467, -0.5060088, -0.5069716, -0.5079356, -0.5089008, -0.5098664, 
--0.5108313, -0.5117951, -0.5127576, -0.5137197, -0.5146823, -0.5156461, -0.5166111, -0.5175767, -0.5185419, -0.5195059, 
--0.5204686, -0.5214306, -0.522393, -0.5233566, -0.5243214, -0.525287, -0.5262523, -0.5272166, -0.5281795, -0.5291416, 
--0.5301039, -0.5310671, -0.5320317, -0.5329973, -0.5339628, -0.5349273, -0.5358904, -0.5368526, -0.5378147, -0.5387777, 
--0.5397421, -0.5407075, -0.5416731, -0.5426379, -0.5436013, -0.5445636, -0.5455256, -0.5464884, -0.5474525, -0.5484178, 
--0.5493835, -0.5503485, -0.5513122, -0.5522746, -0.5532365, -0.5541991, -0.5551629, -0.5561281, -0.5570938, -0.558059, 
--0.559023, -0.5599856, -0.5609475, -0.5619098, -0.5628734, -0.5638384, -0.5648041, -0.5657695, -0.5667337, -0.5676965, 
--0.5686585, -0.5696206, -0.5705839, -0.5715487, -0.5725143, -0.5734799, -0.5744444, -0.5754075, -0.5763695, -0.5773315, 
--0.5782945, -0.579259, -0.5802246, -0.5811903, -0.5821551, -0.5831184, -0.5840805, -0.5850424, -0.5860051, -0.5869693, 
--0.5879348, -0.5889006, -0.5898657, -0.5908293, -0.5917915, -0.5927533, -0.5937158, -0.5946797, -0.595645, -0.5966109, 
--0.5975762, -0.5985401, -0.5995026, -0.6004643, -0.6014266, -0.6023902, -0.6033553, -0.6043212, -0.6052867, -0.6062509, 
--0.6072136, -0.6081753, -0.6091374, -0.6101007, -0.6110655, -0.6120314, -0.6129971, -0.6139616, -0.6149246, -0.6158864, 
--0.6168482, -0.6178112, -0.6187758, -0.6197416, -0.6207075, -0.6216723, -0.6226355, -0.6235974, -0.6245591, -0.6255218, 
--0.6264861, -0.6274518, -0.6284178, -0.6293829, -0.6303464, -0.6313085, -0.6322701, -0.6332325, -0.6341965, -0.635162, 
--0.6361281, -0.6370935, -0.6380573, -0.6390196, -0.6399811, -0.6409432, -0.6419069, -0.6428722, -0.6438383, -0.644804, 
--0.6457681, -0.6467306, -0.6476922, -0.648654, -0.6496174, -0.6505824, -0.6515485, -0.6525144, -0.6534789, -0.6544417, 
--0.6554032, -0.6563649, -0.6573279, -0.6582926, -0.6592587, -0.6602248, -0.6611896, -0.6621527, -0.6631143, -0.6640758, 
--0.6650385, -0.6660029, -0.6669688, -0.6679351, -0.6689002, -0.6698636, -0.6708255, -0.6717868, -0.6727491, -0.6737132, 
--0.674679, -0.6756453, -0.6766108, -0.6775746, -0.6785366, -0.6794979, -0.6804598, -0.6814236, -0.6823891, -0.6833555, 
--0.6843213, -0.6852854, -0.6862477, -0.6872089, -0.6881706, -0.689134, -0.6900992, -0.6910656, -0.6920317, -0.6929963, 
--0.6939588, -0.6949201, -0.6958815, -0.6968445, -0.6978094, -0.6987758, -0.6997421, -0.700707, -0.7016699, -0.7026312, 
--0.7035925, -0.704555, -0.7055196, -0.7064858, -0.7074524, -0.7084177, -0.7093809, -0.7103424, -0.7113035, -0.7122656, 
--0.7132298, -0.7141959, -0.7151626, -0.7161283, -0.7170919, -0.7180536, -0.7190145, -0.7199763, -0.7209401, -0.721906, 
--0.7228727, -0.7238388, -0.7248028, -0.7257648, -0.7267257, -0.7276871, -0.7286505, -0.729616, -0.7305828, -0.7315492, 
--0.7325137, -0.733476, -0.7344369, -0.735398, -0.7363609, -0.7373261, -0.7382929, -0.7392595, -0.7402245, -0.7411872, 
--0.7421481, -0.743109, -0.7440714, -0.7450362, -0.7460029, -0.7469698, -0.7479352, -0.7488983, -0.7498594, -0.75082, 
--0.751782, -0.7527464, -0.7537128, -0.75468, -0.7556459, -0.7566094, -0.7575707, -0.7585311, -0.7594927, -0.7604566, 
--0.7614228, -0.7623901, -0.7633564, -0.7643204, -0.765282, -0.7662423, -0.7672034, -0.7681668, -0.7691328, -0.7701001, 
--0.7710668, -0.7720314, -0.7729933, -0.7739536, -0.7749143, -0.7758772, -0.7768427, -0.77781, -0.7787772, -0.7797422, 
--0.7807046, -0.7816649, -0.7826253, -0.7835876, -0.7845527, -0.7855199, -0.7864874, -0.787453, -0.7884158, -0.7893763, 
--0.7903364, -0.7912981, -0.7922627, -0.7932298, -0.7941975, -0.7951637, -0.796127, -0.7970877, -0.7980476, -0.7990087, 
--0.7999728, -0.8009396, -0.8019075, -0.8028743, -0.8038382, -0.8047992, -0.8057588, -0.8067195, -0.8076829, -0.8086494, 
--0.8096175, -0.8105848, -0.8115493, -0.8125107, -0.8134702, -0.8144303, -0.8153931, -0.8163592, -0.8173273, -0.8182951, 
--0.8192603, -0.8202222, -0.8211817, -0.8221413, -0.8231034, -0.8240689, -0.825037, -0.8260053, -0.8269712, -0.8279336, 
--0.8288932, -0.8298524, -0.8308138, -0.8317787, -0.8327467, -0.8337154, -0.834682, -0.8356451, -0.8366049, -0.8375637, 
--0.8385243, -0.8394886, -0.8404563, -0.8414253, -0.8423927, -0.8433565, -0.8443166, -0.8452751, -0.8462349, -0.8471984, 
--0.8481658, -0.8491351, -0.8501032, -0.8510678, -0.8520283, -0.8529866, -0.8539457, -0.8549084, -0.8558753, -0.8568447, 
--0.8578136, -0.8587791, -0.8597401, -0.8606983, -0.8616567, -0.8626184, -0.8635847, -0.8645542, -0.8655238, -0.8664903, 
--0.867452, -0.8684101, -0.8693678, -0.8703286, -0.8712941, -0.8722636, -0.8732339, -0.8742013, -0.8751639, -0.8761221, 
--0.8770792, -0.8780388, -0.8790035, -0.8799728, -0.8809437, -0.8819122, -0.8828757, -0.8838343, -0.8847907, -0.8857493, 
--0.8867129, -0.8876818, -0.8886533, -0.889623, -0.8905876, -0.8915466, -0.8925025, -0.8934598, -0.8944223, -0.8953907, 
--0.8963626, -0.8973336, -0.8982994, -0.899259, -0.9002145, -0.9011706, -0.9021317, -0.9030994, -0.9040717, -0.9050439, 
--0.9060113, -0.9069717, -0.9079269, -0.9088817, -0.9098411, -0.9108079, -0.9117805, -0.912754, -0.9137231, -0.9146845, 
--0.9156396, -0.916593, -0.9175506, -0.9185161, -0.9194888, -0.9204638, -0.9214348, -0.9223977, -0.9233527, -0.9243046, 
--0.9252601, -0.9262241, -0.9271967, -0.9281732, -0.9291466, -0.9301112, -0.9310663, -0.9320166, -0.9329697, -0.9339316, 
--0.934904, -0.9358822, -0.9368583, -0.9378252, -0.9387807, -0.9397293, -0.9406792, -0.9416386, -0.9426103, -0.9435905, 
--0.94457, -0.9455399, -0.9464963, -0.9474426, -0.9483886, -0.9493445, -0.9503153, -0.9512978, -0.9522819, -0.953256, 
--0.9542136, -0.9551572, -0.9560978, -0.9570486, -0.9580178, -0.9590036, -0.9599943, -0.9609747, -0.9619342, -0.9628739, 
--0.9638062, -0.964749, -0.9657156, -0.9667066, -0.9677083, -0.9686992, -0.9696622, -0.9705945, -0.9715115, -0.9724393, 
--0.9734013, -0.9744036, -0.9754288, -0.9764429, -0.9774123, -0.9783242, -0.9791992, -0.980086, -0.9810402, -0.9820912, 
--0.9832151, -0.9843233, -0.9852779, -0.9859289, -0.9861604, -0.9859289, -0.9852779, -0.9843233, -0.9832151, -0.9820912, 
--0.9810402, -0.980086, -0.9791992, -0.9783242, -0.9774123, -0.9764429, -0.9754288, -0.9744036, -0.9734013, -0.9724393, 
--0.9715115, -0.9705945, -0.9696622, -0.9686992, -0.9677083, -0.9667066, -0.9657156, -0.964749, -0.9638062, -0.9628739, 
--0.9619342, -0.9609747, -0.9599943, -0.9590036, -0.9580178, -0.9570486, -0.9560978, -0.9551572, -0.9542136, -0.953256, 
--0.9522819, -0.9512978, -0.9503153, -0.9493445, -0.9483886, -0.9474426, -0.9464963, -0.9455399, -0.94457, -0.9435905, 
--0.9426103, -0.9416386, -0.9406792, -0.9397293, -0.9387807, -0.9378252, -0.9368583, -0.9358822, -0.934904, -0.9339316, 
--0.9329697, -0.9320166, -0.9310663, -0.9301112, -0.9291466, -0.9281732, -0.9271967, -0.9262241, -0.9252601, -0.9243046, 
--0.9233527, -0.9223977, -0.9214348, -0.9204638, -0.9194888, -0.9185161, -0.9175506, -0.916593, -0.9156396, -0.9146845, 
--0.9137231, -0.912754, -0.9117805, -0.9108079, -0.9098411, -0.9088817, -0.9079269, -0.9069717, -0.9060113, -0.9050439, 
--0.9040717, -0.9030994, -0.9021317, -0.9011706, -0.9002145, -0.899259, -0.8982994, -0.8973336, -0.8963626, -0.8953907, 
--0.8944223, -0.8934598, -0.8925025, -0.8915466, -0.8905876, -0.889623, -0.8886533, -0.8876818, -0.8867129, -0.8857493, 
--0.8847907, -0.8838343, -0.8828757, -0.8819122, -0.8809437, -0.8799728, -0.8790035, -0.8780388, -0.8770792, -0.8761221, 
--0.8751639, -0.8742013, -0.8732339, -0.8722636, -0.8712941, -0.8703286, -0.8693678, -0.8684101, -0.867452, -0.8664903, 
--0.8655238, -0.8645542, -0.8635847, -0.8626184, -0.8616567, -0.8606983, -0.8597401, -0.8587791, -0.8578136, -0.8568447, 
--0.8558753, -0.8549084, -0.8539457, -0.8529866, -0.8520283, -0.8510678, -0.8501032, -0.8491351, -0.8481658, -0.8471984, 
--0.8462349, -0.8452751, -0.8443166, -0.8433565, -0.8423927, -0.8414253, -0.8404563, -0.8394886, -0.8385243, -0.8375637, 
--0.8366049, -0.8356451, -0.834682, -0.8337154, -0.8327467, -0.8317787, -0.8308138, -0.8298524, -0.8288932, -0.8279336, 
--0.8269712, -0.8260053, -0.825037, -0.8240689, -0.8231034, -0.8221413, -0.8211817, -0.8202222, -0.8192603, -0.8182951, 
--0.8173273, -0.8163592, -0.8153931, -0.8144303, -0.8134702, -0.8125107, -0.8115493, -0.8105848, -0.8096175, -0.8086494, 
--0.8076829, -0.8067195, -0.8057588, -0.8047992, -0.8038382, -0.8028743, -0.8019075, -0.8009396, -0.7999728, -0.7990087, 
--0.7980476, -0.7970877, -0.796127, -0.7951637, -0.7941975, -0.7932298, -0.7922627, -0.7912981, -0.7903364, -0.7893763, 
--0.7884158, -0.787453, -0.7864874, -0.7855199, -0.7845527, -0.7835876, -0.7826253, -0.7816649, -0.7807046, -0.7797422, 
--0.7787772, -0.77781, -0.7768427, -0.7758772, -0.7749143, -0.7739536, -0.7729933, -0.7720314, -0.7710668, -0.7701001, 
--0.7691328, -0.7681668, -0.7672034, -0.7662423, -0.765282, -0.7643204, -0.7633564, -0.7623901, -0.7614228, -0.7604566, 
--0.7594927, -0.7585311, -0.7575707, -0.7566094, -0.7556459, -0.75468, -0.7537128, -0.7527464, -0.751782, -0.75082, 
--0.7498594, -0.7488983, -0.7479352, -0.7469698, -0.7460029, -0.7450362, -0.7440714, -0.743109, -0.7421481, -0.7411872, 
--0.7402245, -0.7392595, -0.7382929, -0.7373261, -0.7363609, -0.735398, -0.7344369, -0.733476, -0.7325137, -0.7315492, 
--0.7305828, -0.729616, -0.7286505, -0.7276871, -0.7267257, -0.7257648, -0.7248028, -0.7238388, -0.7228727, -0.721906, 
--0.7209401, -0.7199763, -0.7190145, -0.7180536, -0.7170919, -0.7161283, -0.7151626, -0.7141959, -0.7132298, -0.7122656, 
--0.7113035, -0.7103424, -0.7093809, -0.7084177, -0.7074524, -0.7064858, -0.7055196, -0.704555, -0.7035925, -0.7026312, 
--0.7016699, -0.700707, -0.6997421, -0.6987758, -0.6978094, -0.6968445, -0.6958815, -0.6949201, -0.6939588, -0.6929963, 
--0.6920317, -0.6910656, -0.6900992, -0.689134, -0.6881706, -0.6872089, -0.6862477, -0.6852854, -0.6843213, -0.6833555, 
--0.6823891, -0.6814236, -0.6804598, -0.6794979, -0.6785366, -0.6775746, -0.6766108, -0.6756453, -0.674679, -0.6737132, 
--0.6727491, -0.6717868, -0.6708255, -0.6698636, -0.6689002, -0.6679351, -0.6669688, -0.6660029, -0.6650385, -0.6640758, 
--0.6631143, -0.6621527, -0.6611896, -0.6602248, -0.6592587, -0.6582926, -0.6573279, -0.6563649, -0.6554032, -0.6544417, 
--0.6534789, -0.6525144, -0.6515485, -0.6505824, -0.6496174, -0.648654, -0.6476922, -0.6467306, -0.6457681, -0.644804, 
--0.6438383, -0.6428722, -0.6419069, -0.6409432, -0.6399811, -0.6390196, -0.6380573, -0.6370935, -0.6361281, -0.635162, 
--0.6341965, -0.6332325, -0.6322701, -0.6313085, -0.6303464, -0.6293829, -0.6284178, -0.6274518, -0.6264861, -0.6255218, 
--0.6245591, -0.6235974, -0.6226355, -0.6216723, -0.6207075, -0.6197416, -0.6187758, -0.6178112, -0.6168482, -0.6158864, 
--0.6149246, -0.6139616, -0.6129971, -0.6120314, -0.6110655, -0.6101007, -0.6091374, -0.6081753, -0.6072136, -0.6062509, 
--0.6052867, -0.6043212, -0.6033553, -0.6023902, -0.6014266, -0.6004643, -0.5995026, -0.5985401, -0.5975762, -0.5966109, 
--0.595645, -0.5946797, -0.5937158, -0.5927533, -0.5917915, -0.5908293, -0.5898657, -0.5889006, -0.5879348, -0.5869693, 
--0.5860051, -0.5850424, -0.5840805, -0.5831184, -0.5821551, -0.5811903, -0.5802246, -0.579259, -0.5782945, -0.5773315, 
--0.5763695, -0.5754075, -0.5744444, -0.5734799, -0.5725143, -0.5715487, -0.5705839, -0.5696206, -0.5686585, -0.5676965, 
--0.5667337, -0.5657695, -0.5648041, -0.5638384, -0.5628734, -0.5619098, -0.5609475, -0.5599856, -0.559023, -0.558059, 
--0.5570938, -0.5561281, -0.5551629, -0.5541991, -0.5532365, -0.5522746, -0.5513122, -0.5503485, -0.5493835, -0.5484178, 
--0.5474525, -0.5464884, -0.5455256, -0.5445636, -0.5436013, -0.5426379, -0.5416731, -0.5407075, -0.5397421, -0.5387777, 
--0.5378147, -0.5368526, -0.5358904, -0.5349273, -0.5339628, -0.5329973, -0.5320317, -0.5310671, -0.5301039, -0.5291416, 
--0.5281795, -0.5272166, -0.5262523, -0.525287, -0.5243214, -0.5233566, -0.522393, -0.5214306, -0.5204686, -0.5195059, 
--0.5185419, -0.5175767, -0.5166111, -0.5156461, -0.5146823, -0.5137197, -0.5127576, -0.5117951, -0.5108313, -0.5098664, 
--0.5089008, -0.5079356, -0.5069716, -0.5060088, -0.5050467, -0.5040843, -0.5031208, -0.502156, -0.5011905, -0.5002252, 
--0.4992609, -0.4982979, -0.4973357, -0.4963734, -0.4954101, -0.4944456, -0.4934802, -0.4925148, -0.4915503, -0.4905871, 
--0.4896247, -0.4886625, -0.4876995, -0.4867352, -0.4857699, -0.4848045, -0.4838397, -0.4828762, -0.4819138, -0.4809516, 
--0.4799888, -0.4790247, -0.4780596, -0.4770941, -0.4761292, -0.4751655, -0.4742029, -0.4732407, -0.472278, -0.4713142, 
--0.4703493, -0.4693838, -0.4684187, -0.4674548, -0.4664919, -0.4655297, -0.4645672, -0.4636036, -0.4626389, -0.4616735, 
--0.4607083, -0.4597441, -0.4587811, -0.4578188, -0.4568564, -0.455893, -0.4549285, -0.4539632, -0.4529979, -0.4520335, 
--0.4510702, -0.4501078, -0.4491455, -0.4481824, -0.4472181, -0.4462529, -0.4452875, -0.4443229, -0.4433594, -0.4423969, 
--0.4414346, -0.4404717, -0.4395076, -0.4385425, -0.4375772, -0.4366123, -0.4356486, -0.434686, -0.4337237, -0.4327609, 
--0.4317971, -0.4308322, -0.4298668, -0.4289019, -0.4279379, -0.4269751, -0.4260128, -0.4250502, -0.4240866, -0.4231218, 
--0.4221565, -0.4211914, -0.4202272, -0.4192642, -0.4183019, -0.4173394, -0.416376, -0.4154114, -0.4144462, -0.413481, 
--0.4125166, -0.4115534, -0.4105909, -0.4096285, -0.4086653, -0.407701, -0.4067358, -0.4057706, -0.404806, -0.4038426, 
--0.40288, -0.4019176, -0.4009546, -0.3999905, -0.3990255, -0.3980602, -0.3970955, -0.3961318, -0.3951691, -0.3942068, 
--0.3932439, -0.39228, -0.3913151, -0.3903498, -0.3893849, -0.3884211, -0.3874582, -0.3864958, -0.3855331, -0.3845695, 
--0.3836048, -0.3826395, -0.3816745, -0.3807104, -0.3797473, -0.3787849, -0.3778223, -0.3768589, -0.3758944, -0.3749291, 
--0.373964, -0.3729997, -0.3720365, -0.371074, -0.3701115, -0.3691483, -0.3681839, -0.3672188, -0.3662536, -0.3652891, 
--0.3643257, -0.3633631, -0.3624007, -0.3614376, -0.3604735, -0.3595084, -0.3585432, -0.3575785, -0.3566149, -0.3556522, 
--0.3546898, -0.3537269, -0.352763, -0.3517981, -0.3508328, -0.349868, -0.3489042, -0.3479413, -0.3469789, -0.3460161, 
--0.3450524, -0.3440877, -0.3431225, -0.3421575, -0.3411935, -0.3402305, -0.339268, -0.3383054, -0.3373418, -0.3363773, 
--0.3354121, -0.3344471, -0.3334828, -0.3325196, -0.3315571, -0.3305945, -0.3296312, -0.3286669, -0.3277018, -0.3267366, 
--0.3257722, -0.3248088, -0.3238462, -0.3228837, -0.3219206, -0.3209564, -0.3199914, -0.3190262, -0.3180616, -0.317098, 
--0.3161353, -0.3151728, -0.3142099, -0.3132459, -0.312281, -0.3113158, -0.3103511, -0.3093873, -0.3084244, -0.307462, 
--0.3064991, -0.3055354, -0.3045706, -0.3036055, -0.3026406, -0.3016766, -0.3007136, -0.2997511, -0.2987884, -0.2978248, 
--0.2968602, -0.2958951, -0.2949301, -0.2939659, -0.2930027, -0.2920402, -0.2910776, -0.2901142, -0.2891498, -0.2881847, 
--0.2872197, -0.2862553, -0.2852919, -0.2843293, -0.2833667, -0.2824035, -0.2814393, -0.2804744, -0.2795092, -0.2785447, 
--0.2775812, -0.2766184, -0.2756559, -0.2746928, -0.2737288, -0.272764, -0.2717988, -0.2708342, -0.2698704, -0.2689075, 
--0.267945, -0.2669821, -0.2660183, -0.2650536, -0.2640885, -0.2631236, -0.2621597, -0.2611967, -0.2602342, -0.2592714, 
--0.2583078, -0.2573432, -0.2563781, -0.2554132, -0.254449, -0.2534858, -0.2525233, -0.2515606, -0.2505972, -0.2496328, 
--0.2486677, -0.2477027, -0.2467384, -0.245775, -0.2448124, -0.2438498, -0.2428865, -0.2419223, -0.2409573, -0.2399923, 
--0.2390278, -0.2380642, -0.2371015, -0.2361389, -0.2351758, -0.2342118, -0.233247, -0.2322818, -0.2313172, -0.2303535, 
--0.2293906, -0.2284281, -0.2274651, -0.2265013, -0.2255366, -0.2245715, -0.2236067, -0.2226428, -0.2216798, -0.2207172, 
--0.2197544, -0.2187907, -0.2178261, -0.2168611, -0.2158962, -0.2149321, -0.2139689, -0.2130063, -0.2120436, -0.2110801, 
--0.2101157, -0.2091507, -0.2081857, -0.2072214, -0.2062581, -0.2052955, -0.2043328, -0.2033695, -0.2024053, -0.2014403, 
--0.2004753, -0.1995108, -0.1985473, -0.1975846, -0.196622, -0.1956588, -0.1946948, -0.1937299, -0.1927648, -0.1918003, 
--0.1908366, -0.1898737, -0.1889111, -0.1879481, -0.1869843, -0.1860195, -0.1850544, -0.1840897, -0.1831259, -0.1821629, 
--0.1812003, -0.1802374, -0.1792737, -0.1783091, -0.1773441, -0.1763792, -0.1754152, -0.174452, -0.1734894, -0.1725267, 
--0.1715631, -0.1705987, -0.1696337, -0.1686687, -0.1677045, -0.1667412, -0.1657786, -0.1648159, -0.1638525, -0.1628882, 
--0.1619233, -0.1609583, -0.1599939, -0.1590304, -0.1580677, -0.157105, -0.1561419, -0.1551778, -0.1542129, -0.1532479, 
--0.1522833, -0.1513197, -0.1503568, -0.1493942, -0.1484312, -0.1474672, -0.1465025, -0.1455374, -0.1445728, -0.1436089, 
--0.142646, -0.1416834, -0.1407204, -0.1397567, -0.1387921, -0.137827, -0.1368622, -0.1358982, -0.1349351, -0.1339725, 
--0.1330097, -0.1320461, -0.1310817, -0.1301166, -0.1291518, -0.1281876, -0.1272243, -0.1262616, -0.1252989, -0.1243355, 
--0.1233712, -0.1224063, -0.1214413, -0.1204769, -0.1195135, -0.1185508, -0.1175881, -0.1166249, -0.1156607, -0.1146959, 
--0.1137309, -0.1127663, -0.1118027, -0.1108399, -0.1098773, -0.1089142, -0.1079502, -0.1069855, -0.1060204, -0.1050558, 
--0.104092, -0.103129, -0.1021664, -0.1012035, -0.1002397, -0.0992751, -0.09831, -0.0973453, -0.0963813, -0.0954182, 
--0.0944556, -0.0934927, -0.0925291, -0.0915646, -0.0905996, -0.0896348, -0.0886706, -0.0877074, -0.0867447, -0.085782, 
--0.0848185, -0.0838542, -0.0828892, -0.0819243, -0.08096, -0.0799966, -0.0790338, -0.0780712, -0.0771079, -0.0761437, 
--0.0751788, -0.0742138, -0.0732494, -0.0722858, -0.071323, -0.0703603, -0.0693972, -0.0684332, -0.0674684, -0.0665034, 
--0.0655388, -0.0645751, -0.0636121, -0.0626495, -0.0616865, -0.0607227, -0.059758, -0.058793, -0.0578283, -0.0568644, 
--0.0559013, -0.0549386, -0.0539758, -0.0530121, -0.0520476, -0.0510826, -0.0501178, -0.0491537, -0.0481905, -0.0472278, 
--0.046265, -0.0453015, -0.0443372, -0.0433722, -0.0424073, -0.041443, -0.0404797, -0.0395169, -0.0385542, -0.0375909, 
--0.0366267, -0.0356618, -0.0346968, -0.0337324, -0.0327689, -0.0318061, -0.0308434, -0.0298803, -0.0289162, -0.0279514, 
--0.0269864, -0.0260218, -0.0250581, -0.0240952, -0.0231326, -0.0221696, -0.0212057, -0.020241, -0.019276, -0.0183113, 
--0.0173474, -0.0163844, -0.0154217, -0.0144588, -0.0134951, -0.0125306, -0.0115656, -0.0106008, -0.0096367, -0.0086735, 
--0.0077109, -0.0067481, -0.0057846, -0.0048202, -0.0038552, -0.0028903, -0.0019261, -0.0009627, 0.0, 0.0019321, 
-0.0038617, 0.0057877, 0.0077111, 0.0096342, 0.0115596, 0.0134885, 0.0154203, 0.0173526, 0.0192829, 0.0212096, 
-0.0231333, 0.0250562, 0.026981, 0.0289093, 0.0308407, 0.0327731, 0.0347039, 0.0366313, 0.0385554, 0.0404783, 
-0.0424026, 0.0443301, 0.046261, 0.0481935, 0.0501248, 0.0520529, 0.0539776, 0.0559005, 0.0578242, 0.0597511, 
-0.0616815, 0.0636138, 0.0655456, 0.0674744, 0.0693996, 0.0713226, 0.073246, 0.0751722, 0.077102, 0.0790341, 
-0.0809662, 0.0828957, 0.0848216, 0.0867448, 0.0886679, 0.0905934, 0.0925225, 0.0944545, 0.0963868, 0.0983169, 
-0.1002435, 0.102167, 0.1040899, 0.1060148, 0.1079432, 0.1098748, 0.1118073, 0.113738, 0.1156652, 0.1175892, 
-0.119512, 0.1214363, 0.123364, 0.1252951, 0.1272277, 0.1291589, 0.1310869, 0.1330114, 0.1349342, 0.136858, 
-0.138785, 0.1407155, 0.142648, 0.1445797, 0.1465084, 0.1484335, 0.1503564, 0.1522797, 0.154206, 0.156136, 
-0.1580683, 0.1600004, 0.1619298, 0.1638555, 0.1657786, 0.1677016, 0.1696272, 0.1715565, 0.1734886, 0.175421, 
-0.1773511, 0.1792774, 0.1812008, 0.1831236, 0.1850485, 0.1869771, 0.1889089, 0.1908415, 0.1927722, 0.1946993, 
-0.196623, 0.1985457, 0.20047, 0.2023979, 0.2043292, 0.2062619, 0.2081932, 0.210121, 0.2120452, 0.2139678, 
-0.2158916, 0.2178187, 0.2197495, 0.2216822, 0.223614, 0.2255426, 0.2274674, 0.22939, 0.2313133, 0.2332397, 
-0.2351699, 0.2371025, 0.2390347, 0.240964, 0.2428895, 0.2448123, 0.2467352, 0.2486608, 0.2505904, 0.2525227, 
-0.2544553, 0.2563853, 0.2583115, 0.2602346, 0.2621572, 0.2640821, 0.2660109, 0.2679429, 0.2698758, 0.2718065, 
-0.2737334, 0.2756569, 0.2775793, 0.2795035, 0.2814316, 0.2833632, 0.2852962, 0.2872275, 0.2891552, 0.2910791, 
-0.2930014, 0.2949251, 0.2968524, 0.2987834, 0.3007165, 0.3026484, 0.3045769, 0.3065014, 0.3084237, 0.3103468, 
-0.3122733, 0.3142038, 0.3161367, 0.3180691, 0.3199984, 0.3219235, 0.323846, 0.3257687, 0.3276943, 0.3296241, 
-0.3315569, 0.3334897, 0.3354198, 0.3373456, 0.3392683, 0.3411906, 0.3431155, 0.3450446, 0.346977, 0.3489102, 
-0.350841, 0.3527676, 0.3546907, 0.3566128, 0.3585369, 0.3604652, 0.3623972, 0.3643305, 0.366262, 0.3681895, 
-0.3701131, 0.372035, 0.3739584, 0.3758858, 0.3778173, 0.3797508, 0.381683, 0.3836113, 0.3855354, 0.3874573, 
-0.3893801, 0.3913067, 0.3932375, 0.395171, 0.3971037, 0.3990329, 0.4009577, 0.4028797, 0.404802, 0.4067276, 
-0.4086578, 0.4105911, 0.4125243, 0.4144544, 0.4163799, 0.4183021, 0.420224, 0.4221488, 0.4240781, 0.4260111, 
-0.4279447, 0.4298757, 0.431802, 0.4337246, 0.4356461, 0.4375701, 0.4394986, 0.4414311, 0.4433651, 0.4452968, 
-0.4472241, 0.4491471, 0.4510684, 0.4529915, 0.4549191, 0.4568512, 0.4587852, 0.4607177, 0.462646, 0.4645695, 
-0.4664907, 0.4684132, 0.4703398, 0.4722712, 0.4742053, 0.4761385, 0.4780677, 0.479992, 0.4819132, 0.483835, 
-0.4857607, 0.4876913, 0.4896253, 0.4915591, 0.4934893, 0.4954144, 0.4973358, 0.499257, 0.5011817, 0.5031115, 
-0.5050452, 0.5069795, 0.5089107, 0.5108367, 0.5127584, 0.5146792, 0.5166029, 0.5185317, 0.5204651, 0.5223998, 
-0.5243319, 0.5262589, 0.5281811, 0.5301016, 0.5320243, 0.5339521, 0.5358849, 0.5378199, 0.5397529, 0.5416809, 
-0.5436038, 0.5455241, 0.5474459, 0.5493726, 0.5513048, 0.5532398, 0.5551737, 0.5571029, 0.5590264, 0.5609467, 
-0.5628677, 0.5647933, 0.5667246, 0.5686597, 0.5705943, 0.5725246, 0.5744491, 0.5763694, 0.5782898, 0.5802142, 
-0.5821445, 0.5840794, 0.5860147, 0.5879461, 0.5898716, 0.5917923, 0.593712, 0.5956353, 0.5975645, 0.599499, 
-0.6014348, 0.6033675, 0.6052941, 0.6072152, 0.6091344, 0.6110565, 0.6129846, 0.6149186, 0.6168548, 0.6187886, 
-0.6207164, 0.6226382, 0.6245571, 0.6264781, 0.6284049, 0.6303381, 0.6322746, 0.6342095, 0.6361386, 0.6380612, 
-0.6399799, 0.6418998, 0.6438253, 0.6457576, 0.6476942, 0.6496301, 0.6515606, 0.6534842, 0.6554029, 0.6573219, 
-0.6592459, 0.6611771, 0.6631136, 0.6650504, 0.6669824, 0.6689071, 0.6708261, 0.6727442, 0.6746667, 0.6765967, 
-0.6785329, 0.6804705, 0.682404, 0.6843301, 0.6862494, 0.6881667, 0.6900878, 0.6920163, 0.693952, 0.6958903, 
-0.6978253, 0.6997529, 0.7016729, 0.7035896, 0.7055091, 0.7074361, 0.709371, 0.7113098, 0.7132464, 0.7151755, 
-0.7170964, 0.7190127, 0.7209308, 0.722856, 0.7247899, 0.7267291, 0.7286671, 0.7305981, 0.7325201, 0.7344361, 
-0.7363527, 0.7382761, 0.7402087, 0.742148, 0.7440874, 0.7460204, 0.7479438, 0.7498599, 0.7517751, 0.7536964, 
-0.7556275, 0.7575667, 0.7595074, 0.7614425, 0.7633675, 0.7652839, 0.7671978, 0.769117, 0.7710463, 0.772985, 
-0.774927, 0.7768643, 0.7787913, 0.7807082, 0.7826209, 0.7845378, 0.7864651, 0.7884031, 0.7903462, 0.7922858, 
-0.794215, 0.7961328, 0.7980445, 0.799959, 0.8018839, 0.8038208, 0.8057648, 0.8077069, 0.8096387, 0.8115577, 
-0.8134686, 0.8153807, 0.8173027, 0.8192382, 0.821183, 0.8231275, 0.8250623, 0.8269831, 0.8288933, 0.8308027, 
-0.8327216, 0.8346552, 0.8366004, 0.8385477, 0.8404859, 0.8424088, 0.8443187, 0.8462254, 0.8481406, 0.8500717, 
-0.8520171, 0.8539673, 0.8559094, 0.8578351, 0.859745, 0.8616487, 0.8635596, 0.8654876, 0.8674329, 0.8693861, 
-0.8713328, 0.8732621, 0.8751723, 0.8770728, 0.8789788, 0.8809027, 0.8828474, 0.8848039, 0.8867562, 0.88869, 
-0.8906011, 0.8924981, 0.8943978, 0.8963166, 0.8982601, 0.9002205, 0.9021797, 0.9041196, 0.9060322, 0.9079249, 
-0.9098168, 0.9117284, 0.91367, 0.9156352, 0.9176035, 0.9195517, 0.9214668, 0.923354, 0.9252352, 0.9271367, 
-0.9290752, 0.9310468, 0.9330282, 0.9349889, 0.936908, 0.9387873, 0.9406518, 0.9425375, 0.9444707, 0.9464528, 
-0.9484561, 0.950438, 0.952364, 0.9542286, 0.9560625, 0.9579181, 0.9598421, 0.9618467, 0.9638972, 0.9659254, 
-0.9678641, 0.969688, 0.9714379, 0.9732116, 0.9751199, 0.977222, 0.9794697, 0.9816861, 0.9835954, 0.9848974, 
-0.9853604, 0.9848974, 0.9835954, 0.9816861, 0.9794697, 0.977222, 0.9751199, 0.9732116, 0.9714379, 0.969688, 
-0.9678641, 0.9659254, 0.9638972, 0.9618467, 0.9598421, 0.9579181, 0.9560625, 0.9542286, 0.952364, 0.950438, 
-0.9484561, 0.9464528, 0.9444707, 0.9425375, 0.9406518, 0.9387873, 0.936908, 0.9349889, 0.9330282, 0.9310468, 
-0.9290752, 0.9271367, 0.9252352, 0.923354, 0.9214668, 0.9195517, 0.9176035, 0.9156352, 0.91367, 0.9117284, 
-0.9098168, 0.9079249, 0.9060322, 0.9041196, 0.9021797, 0.9002205, 0.8982601, 0.8963166, 0.8943978, 0.8924981, 
-0.8906011, 0.88869, 0.8867562, 0.8848039, 0.8828474, 0.8809027, 0.8789788, 0.8770728, 0.8751723, 0.8732621, 
-0.8713328, 0.8693861, 0.8674329, 0.8654876, 0.8635596, 0.8616487, 0.859745, 0.8578351, 0.8559094, 0.8539673, 
-0.8520171, 0.8500717, 0.8481406, 0.8462254, 0.8443187, 0.8424088, 0.8404859, 0.8385477, 0.8366004, 0.8346552, 
-0.8327216, 0.8308027, 0.8288933, 0.8269831, 0.8250623, 0.8231275, 0.821183, 0.8192382, 0.8173027, 0.8153807, 
-0.8134686, 0.8115577, 0.8096387, 0.8077069, 0.8057648, 0.8038208, 0.8018839, 0.799959, 0.7980445, 0.7961328, 
-0.794215, 0.7922858, 0.7903462, 0.7884031, 0.7864651, 0.7845378, 0.7826209, 0.7807082, 0.7787913, 0.7768643, 
-0.774927, 0.772985, 0.7710463, 0.769117, 0.7671978, 0.7652839, 0.7633675, 0.7614425, 0.7595074, 0.7575667, 
-0.7556275, 0.7536964, 0.7517751, 0.7498599, 0.7479438, 0.7460204, 0.7440874, 0.742148, 0.7402087, 0.7382761, 
-0.7363527, 0.7344361, 0.7325201, 0.7305981, 0.7286671, 0.7267291, 0.7247899, 0.722856, 0.7209308, 0.7190127, 
-0.7170964, 0.7151755, 0.7132464, 0.7113098, 0.709371, 0.7074361, 0.7055091, 0.7035896, 0.7016729, 0.6997529, 
-0.6978253, 0.6958903, 0.693952, 0.6920163, 0.6900878, 0.6881667, 0.6862494, 0.6843301, 0.682404, 0.6804705, 
-0.6785329, 0.6765967, 0.6746667, 0.6727442, 0.6708261, 0.6689071, 0.6669824, 0.6650504, 0.6631136, 0.6611771, 
-0.6592459, 0.6573219, 0.6554029, 0.6534842, 0.6515606, 0.6496301, 0.6476942, 0.6457576, 0.6438253, 0.6418998, 
-0.6399799, 0.6380612, 0.6361386, 0.6342095, 0.6322746, 0.6303381, 0.6284049, 0.6264781, 0.6245571, 0.6226382, 
-0.6207164, 0.6187886, 0.6168548, 0.6149186, 0.6129846, 0.6110565, 0.6091344, 0.6072152, 0.6052941, 0.6033675, 
-0.6014348, 0.599499, 0.5975645, 0.5956353, 0.593712, 0.5917923, 0.5898716, 0.5879461, 0.5860147, 0.5840794, 
-0.5821445, 0.5802142, 0.5782898, 0.5763694, 0.5744491, 0.5725246, 0.5705943, 0.5686597, 0.5667246, 0.5647933, 
-0.5628677, 0.5609467, 0.5590264, 0.5571029, 0.5551737, 0.5532398, 0.5513048, 0.5493726, 0.5474459, 0.5455241, 
-0.5436038, 0.5416809, 0.5397529, 0.5378199, 0.5358849, 0.5339521, 0.5320243, 0.5301016, 0.5281811, 0.5262589, 
-0.5243319, 0.5223998, 0.5204651, 0.5185317, 0.5166029, 0.5146792, 0.5127584, 0.5108367, 0.5089107, 0.5069795, 
-0.5050452, 0.5031115, 0.5011817, 0.499257, 0.4973358, 0.4954144, 0.4934893, 0.4915591, 0.4896253, 0.4876913, 
-0.4857607, 0.483835, 0.4819132, 0.479992, 0.4780677, 0.4761385, 0.4742053, 0.4722712, 0.4703398, 0.4684132, 
-0.4664907, 0.4645695, 0.462646, 0.4607177, 0.4587852, 0.4568512, 0.4549191, 0.4529915, 0.4510684, 0.4491471, 
-0.4472241, 0.4452968, 0.4433651, 0.4414311, 0.4394986, 0.4375701, 0.4356461, 0.4337246, 0.431802, 0.4298757, 
-0.4279447, 0.4260111, 0.4240781, 0.4221488, 0.420224, 0.4183021, 0.4163799, 0.4144544, 0.4125243, 0.4105911, 
-0.4086578, 0.4067276, 0.404802, 0.4028797, 0.4009577, 0.3990329, 0.3971037, 0.395171, 0.3932375, 0.3913067, 
-0.3893801, 0.3874573, 0.3855354, 0.3836113, 0.381683, 0.3797508, 0.3778173, 0.3758858, 0.3739584, 0.372035, 
-0.3701131, 0.3681895, 0.366262, 0.3643305, 0.3623972, 0.3604652, 0.3585369, 0.3566128, 0.3546907, 0.3527676, 
-0.350841, 0.3489102, 0.346977, 0.3450446, 0.3431155, 0.3411906, 0.3392683, 0.3373456, 0.3354198, 0.3334897, 
-0.3315569, 0.3296241, 0.3276943, 0.3257687, 0.323846, 0.3219235, 0.3199984, 0.3180691, 0.3161367, 0.3142038, 
-0.3122733, 0.3103468, 0.3084237, 0.3065014, 0.3045769, 0.3026484, 0.3007165, 0.2987834, 0.2968524, 0.2949251, 
-0.2930014, 0.2910791, 0.2891552, 0.2872275, 0.2852962, 0.2833632, 0.2814316, 0.2795035, 0.2775793, 0.2756569, 
-0.2737334, 0.2718065, 0.2698758, 0.2679429, 0.2660109, 0.2640821, 0.2621572, 0.2602346, 0.2583115, 0.2563853, 
-0.2544553, 0.2525227, 0.2505904, 0.2486608, 0.2467352, 0.2448123, 0.2428895, 0.240964, 0.2390347, 0.2371025, 
-0.2351699, 0.2332397, 0.2313133, 0.22939, 0.2274674, 0.2255426, 0.223614, 0.2216822, 0.2197495, 0.2178187, 
-0.2158916, 0.2139678, 0.2120452, 0.210121, 0.2081932, 0.2062619, 0.2043292, 0.2023979, 0.20047, 0.1985457, 
-0.196623, 0.1946993, 0.1927722, 0.1908415, 0.1889089, 0.1869771, 0.1850485, 0.1831236, 0.1812008, 0.1792774, 
-0.1773511, 0.175421, 0.1734886, 0.1715565, 0.1696272, 0.1677016, 0.1657786, 0.1638555, 0.1619298, 0.1600004, 
-0.1580683, 0.156136, 0.154206, 0.1522797, 0.1503564, 0.1484335, 0.1465084, 0.1445797, 0.142648, 0.1407155, 
-0.138785, 0.136858, 0.1349342, 0.1330114, 0.1310869, 0.1291589, 0.1272277, 0.1252951, 0.123364, 0.1214363, 
-0.119512, 0.1175892, 0.1156652, 0.113738, 0.1118073, 0.1098748, 0.1079432, 0.1060148, 0.1040899, 0.102167, 
-0.1002435, 0.0983169, 0.0963868, 0.0944545, 0.0925225, 0.0905934, 0.0886679, 0.0867448, 0.0848216, 0.0828957, 
-0.0809662, 0.0790341, 0.077102, 0.0751722, 0.073246, 0.0713226, 0.0693996, 0.0674744, 0.0655456, 0.0636138, 
-0.0616815, 0.0597511, 0.0578242, 0.0559005, 0.0539776, 0.0520529, 0.0501248, 0.0481935, 0.046261, 0.0443301, 
-0.0424026, 0.0404783, 0.0385554, 0.0366313, 0.0347039, 0.0327731, 0.0308407, 0.0289093, 0.026981, 0.0250562, 
-0.0231333, 0.0212096, 0.0192829, 0.0173526, 0.0154203, 0.0134885, 0.0115596, 0.0096342, 0.0077111, 0.0057877, 
-0.0038617, 0.0019321, 0.0, -0.0019321, -0.0038617, -0.0057877, -0.0077111, -0.0096342, -0.0115596, -0.0134885, 
--0.0154203, -0.0173526, -0.0192829, -0.0212096, -0.0231333, -0.0250562, -0.026981, -0.0289093, -0.0308407, -0.0327731, 
--0.0347039, -0.0366313, -0.0385554, -0.0404783, -0.0424026, -0.0443301, -0.046261, -0.0481935, -0.0501248, -0.0520529, 
--0.0539776, -0.0559005, -0.0578242, -0.0597511, -0.0616815, -0.0636138, -0.0655456, -0.0674744, -0.0693996, -0.0713226, 
--0.073246, -0.0751722, -0.077102, -0.0790341, -0.0809662, -0.0828957, -0.0848216, -0.0867448, -0.0886679, -0.0905934, 
--0.0925225, -0.0944545, -0.0963868, -0.0983169, -0.1002435, -0.102167, -0.1040899, -0.1060148, -0.1079432, -0.1098748, 
--0.1118073, -0.113738, -0.1156652, -0.1175892, -0.119512, -0.1214363, -0.123364, -0.1252951, -0.1272277, -0.1291589, 
--0.1310869, -0.1330114, -0.1349342, -0.136858, -0.138785, -0.1407155, -0.142648, -0.1445797, -0.1465084, -0.1484335, 
--0.1503564, -0.1522797, -0.154206, -0.156136, -0.1580683, -0.1600004, -0.1619298, -0.1638555, -0.1657786, -0.1677016, 
--0.1696272, -0.1715565, -0.1734886, -0.175421, -0.1773511, -0.1792774, -0.1812008, -0.1831236, -0.1850485, -0.1869771, 
--0.1889089, -0.1908415, -0.1927722, -0.1946993, -0.196623, -0.1985457, -0.20047, -0.2023979, -0.2043292, -0.2062619, 
--0.2081932, -0.210121, -0.2120452, -0.2139678, -0.2158916, -0.2178187, -0.2197495, -0.2216822, -0.223614, -0.2255426, 
--0.2274674, -0.22939, -0.2313133, -0.2332397, -0.2351699, -0.2371025, -0.2390347, -0.240964, -0.2428895, -0.2448123, 
--0.2467352, -0.2486608, -0.2505904, -0.2525227, -0.2544553, -0.2563853, -0.2583115, -0.2602346, -0.2621572, -0.2640821, 
--0.2660109, -0.2679429, -0.2698758, -0.2718065, -0.2737334, -0.2756569, -0.2775793, -0.2795035, -0.2814316, -0.2833632, 
--0.2852962, -0.2872275, -0.2891552, -0.2910791, -0.2930014, -0.2949251, -0.2968524, -0.2987834, -0.3007165, -0.3026484, 
--0.3045769, -0.3065014, -0.3084237, -0.3103468, -0.3122733, -0.3142038, -0.3161367, -0.3180691, -0.3199984, -0.3219235, 
--0.323846, -0.3257687, -0.3276943, -0.3296241, -0.3315569, -0.3334897, -0.3354198, -0.3373456, -0.3392683, -0.3411906, 
--0.3431155, -0.3450446, -0.346977, -0.3489102, -0.350841, -0.3527676, -0.3546907, -0.3566128, -0.3585369, -0.3604652, 
--0.3623972, -0.3643305, -0.366262, -0.3681895, -0.3701131, -0.372035, -0.3739584, -0.3758858, -0.3778173, -0.3797508, 
--0.381683, -0.3836113, -0.3855354, -0.3874573, -0.3893801, -0.3913067, -0.3932375, -0.395171, -0.3971037, -0.3990329, 
--0.4009577, -0.4028797, -0.404802, -0.4067276, -0.4086578, -0.4105911, -0.4125243, -0.4144544, -0.4163799, -0.4183021, 
--0.420224, -0.4221488, -0.4240781, -0.4260111, -0.4279447, -0.4298757, -0.431802, -0.4337246, -0.4356461, -0.4375701, 
--0.4394986, -0.4414311, -0.4433651, -0.4452968, -0.4472241, -0.4491471, -0.4510684, -0.4529915, -0.4549191, -0.4568512, 
--0.4587852, -0.4607177, -0.462646, -0.4645695, -0.4664907, -0.4684132, -0.4703398, -0.4722712, -0.4742053, -0.4761385, 
--0.4780677, -0.479992, -0.4819132, -0.483835, -0.4857607, -0.4876913, -0.4896253, -0.4915591, -0.4934893, -0.4954144, 
--0.4973358, -0.499257, -0.5011817, -0.5031115, -0.5050452, -0.5069795, -0.5089107, -0.5108367, -0.5127584, -0.5146792, 
--0.5166029, -0.5185317, -0.5204651, -0.5223998, -0.5243319, -0.5262589, -0.5281811, -0.5301016, -0.5320243, -0.5339521, 
--0.5358849, -0.5378199, -0.5397529, -0.5416809, -0.5436038, -0.5455241, -0.5474459, -0.5493726, -0.5513048, -0.5532398, 
--0.5551737, -0.5571029, -0.5590264, -0.5609467, -0.5628677, -0.5647933, -0.5667246, -0.5686597, -0.5705943, -0.5725246, 
--0.5744491, -0.5763694, -0.5782898, -0.5802142, -0.5821445, -0.5840794, -0.5860147, -0.5879461, -0.5898716, -0.5917923, 
--0.593712, -0.5956353, -0.5975645, -0.599499, -0.6014348, -0.6033675, -0.6052941, -0.6072152, -0.6091344, -0.6110565, 
--0.6129846, -0.6149186, -0.6168548, -0.6187886, -0.6207164, -0.6226382, -0.6245571, -0.6264781, -0.6284049, -0.6303381, 
--0.6322746, -0.6342095, -0.6361386, -0.6380612, -0.6399799, -0.6418998, -0.6438253, -0.6457576, -0.6476942, -0.6496301, 
--0.6515606, -0.6534842, -0.6554029, -0.6573219, -0.6592459, -0.6611771, -0.6631136, -0.6650504, -0.6669824, -0.6689071, 
--0.6708261, -0.6727442, -0.6746667, -0.6765967, -0.6785329, -0.6804705, -0.682404, -0.6843301, -0.6862494, -0.6881667, 
--0.6900878, -0.6920163, -0.693952, -0.6958903, -0.6978253, -0.6997529, -0.7016729, -0.7035896, -0.7055091, -0.7074361, 
--0.709371, -0.7113098, -0.7132464, -0.7151755, -0.7170964, -0.7190127, -0.7209308, -0.722856, -0.7247899, -0.7267291, 
--0.7286671, -0.7305981, -0.7325201, -0.7344361, -0.7363527, -0.7382761, -0.7402087, -0.742148, -0.7440874, -0.7460204, 
--0.7479438, -0.7498599, -0.7517751, -0.7536964, -0.7556275, -0.7575667, -0.7595074, -0.7614425, -0.7633675, -0.7652839, 
--0.7671978, -0.769117, -0.7710463, -0.772985, -0.774927, -0.7768643, -0.7787913, -0.7807082, -0.7826209, -0.7845378, 
--0.7864651, -0.7884031, -0.7903462, -0.7922858, -0.794215, -0.7961328, -0.7980445, -0.799959, -0.8018839, -0.8038208, 
--0.8057648, -0.8077069, -0.8096387, -0.8115577, -0.8134686, -0.8153807, -0.8173027, -0.8192382, -0.821183, -0.8231275, 
--0.8250623, -0.8269831, -0.8288933, -0.8308027, -0.8327216, -0.8346552, -0.8366004, -0.8385477, -0.8404859, -0.8424088, 
--0.8443187, -0.8462254, -0.8481406, -0.8500717, -0.8520171, -0.8539673, -0.8559094, -0.8578351, -0.859745, -0.8616487, 
--0.8635596, -0.8654876, -0.8674329, -0.8693861, -0.8713328, -0.8732621, -0.8751723, -0.8770728, -0.8789788, -0.8809027, 
--0.8828474, -0.8848039, -0.8867562, -0.88869, -0.8906011, -0.8924981, -0.8943978, -0.8963166, -0.8982601, -0.9002205, 
--0.9021797, -0.9041196, -0.9060322, -0.9079249, -0.9098168, -0.9117284, -0.91367, -0.9156352, -0.9176035, -0.9195517, 
--0.9214668, -0.923354, -0.9252352, -0.9271367, -0.9290752, -0.9310468, -0.9330282, -0.9349889, -0.936908, -0.9387873, 
--0.9406518, -0.9425375, -0.9444707, -0.9464528, -0.9484561, -0.950438, -0.952364, -0.9542286, -0.9560625, -0.9579181, 
--0.9598421, -0.9618467, -0.9638972, -0.9659254, -0.9678641, -0.969688, -0.9714379, -0.9732116, -0.9751199, -0.977222, 
--0.9794697, -0.9816861, -0.9835954, -0.9848974, -0.9853604, -0.9848974, -0.9835954, -0.9816861, -0.9794697, -0.977222, 
--0.9751199, -0.9732116, -0.9714379, -0.969688, -0.9678641, -0.9659254, -0.9638972, -0.9618467, -0.9598421, -0.9579181, 
--0.9560625, -0.9542286, -0.952364, -0.950438, -0.9484561, -0.9464528, -0.9444707, -0.9425375, -0.9406518, -0.9387873, 
--0.936908, -0.9349889, -0.9330282, -0.9310468, -0.9290752, -0.9271367, -0.9252352, -0.923354, -0.9214668, -0.9195517, 
--0.9176035, -0.9156352, -0.91367, -0.9117284, -0.9098168, -0.9079249, -0.9060322, -0.9041196, -0.9021797, -0.9002205, 
--0.8982601, -0.8963166, -0.8943978, -0.8924981, -0.8906011, -0.88869, -0.8867562, -0.8848039, -0.8828474, -0.8809027, 
--0.8789788, -0.8770728, -0.8751723, -0.8732621, -0.8713328, -0.8693861, -0.8674329, -0.8654876, -0.8635596, -0.8616487, 
--0.859745, -0.8578351, -0.8559094, -0.8539673, -0.8520171, -0.8500717, -0.8481406, -0.8462254, -0.8443187, -0.8424088, 
--0.8404859, -0.8385477, -0.8366004, -0.8346552, -0.8327216, -0.8308027, -0.8288933, -0.8269831, -0.8250623, -0.8231275, 
--0.821183, -0.8192382, -0.8173027, -0.8153807, -0.8134686, -0.8115577, -0.8096387, -0.8077069, -0.8057648, -0.8038208, 
--0.8018839, -0.799959, -0.7980445, -0.7961328, -0.794215, -0.7922858, -0.7903462, -0.7884031, -0.7864651, -0.7845378, 
--0.7826209, -0.7807082, -0.7787913, -0.7768643, -0.774927, -0.772985, -0.7710463, -0.769117, -0.7671978, -0.7652839, 
--0.7633675, -0.7614425, -0.7595074, -0.7575667, -0.7556275, -0.7536964, -0.7517751, -0.7498599, -0.7479438, -0.7460204, 
--0.7440874, -0.742148, -0.7402087, -0.7382761, -0.7363527, -0.7344361, -0.7325201, -0.7305981, -0.7286671, -0.7267291, 
--0.7247899, -0.722856, -0.7209308, -0.7190127, -0.7170964, -0.7151755, -0.7132464, -0.7113098, -0.709371, -0.7074361, 
--0.7055091, -0.7035896, -0.7016729, -0.6997529, -0.6978253, -0.6958903, -0.693952, -0.6920163, -0.6900878, -0.6881667, 
--0.6862494, -0.6843301, -0.682404, -0.6804705, -0.6785329, -0.6765967, -0.6746667, -0.6727442, -0.6708261, -0.6689071, 
--0.6669824, -0.6650504, -0.6631136, -0.6611771, -0.6592459, -0.6573219, -0.6554029, -0.6534842, -0.6515606, -0.6496301, 
--0.6476942, -0.6457576, -0.6438253, -0.6418998, -0.6399799, -0.6380612, -0.6361386, -0.6342095, -0.6322746, -0.6303381, 
--0.6284049, -0.6264781, -0.6245571, -0.6226382, -0.6207164, -0.6187886, -0.6168548, -0.6149186, -0.6129846, -0.6110565, 
--0.6091344, -0.6072152, -0.6052941, -0.6033675, -0.6014348, -0.599499, -0.5975645, -0.5956353, -0.593712, -0.5917923, 
--0.5898716, -0.5879461, -0.5860147, -0.5840794, -0.5821445, -0.5802142, -0.5782898, -0.5763694, -0.5744491, -0.5725246, 
--0.5705943, -0.5686597, -0.5667246, -0.5647933, -0.5628677, -0.5609467, -0.5590264, -0.5571029, -0.5551737, -0.5532398, 
--0.5513048, -0.5493726, -0.5474459, -0.5455241, -0.5436038, -0.5416809, -0.5397529, -0.5378199, -0.5358849, -0.5339521, 
--0.5320243, -0.5301016, -0.5281811, -0.5262589, -0.5243319, -0.5223998, -0.5204651, -0.5185317, -0.5166029, -0.5146792, 
--0.5127584, -0.5108367, -0.5089107, -0.5069795, -0.5050452, -0.5031115, -0.5011817, -0.499257, -0.4973358, -0.4954144, 
--0.4934893, -0.4915591, -0.4896253, -0.4876913, -0.4857607, -0.483835, -0.4819132, -0.479992, -0.4780677, -0.4761385, 
--0.4742053, -0.4722712, -0.4703398, -0.4684132, -0.4664907, -0.4645695, -0.462646, -0.4607177, -0.4587852, -0.4568512, 
--0.4549191, -0.4529915, -0.4510684, -0.4491471, -0.4472241, -0.4452968, -0.4433651, -0.4414311, -0.4394986, -0.4375701, 
--0.4356461, -0.4337246, -0.431802, -0.4298757, -0.4279447, -0.4260111, -0.4240781, -0.4221488, -0.420224, -0.4183021, 
--0.4163799, -0.4144544, -0.4125243, -0.4105911, -0.4086578, -0.4067276, -0.404802, -0.4028797, -0.4009577, -0.3990329, 
--0.3971037, -0.395171, -0.3932375, -0.3913067, -0.3893801, -0.3874573, -0.3855354, -0.3836113, -0.381683, -0.3797508, 
--0.3778173, -0.3758858, -0.3739584, -0.372035, -0.3701131, -0.3681895, -0.366262, -0.3643305, -0.3623972, -0.3604652, 
--0.3585369, -0.3566128, -0.3546907, -0.3527676, -0.350841, -0.3489102, -0.346977, -0.3450446, -0.3431155, -0.3411906, 
--0.3392683, -0.3373456, -0.3354198, -0.3334897, -0.3315569, -0.3296241, -0.3276943, -0.3257687, -0.323846, -0.3219235, 
--0.3199984, -0.3180691, -0.3161367, -0.3142038, -0.3122733, -0.3103468, -0.3084237, -0.3065014, -0.3045769, -0.3026484, 
--0.3007165, -0.2987834, -0.2968524, -0.2949251, -0.2930014, -0.2910791, -0.2891552, -0.2872275, -0.2852962, -0.2833632, 
--0.2814316, -0.2795035, -0.2775793, -0.2756569, -0.2737334, -0.2718065, -0.2698758, -0.2679429, -0.2660109, -0.2640821, 
--0.2621572, -0.2602346, -0.2583115, -0.2563853, -0.2544553, -0.2525227, -0.2505904, -0.2486608, -0.2467352, -0.2448123, 
--0.2428895, -0.240964, -0.2390347, -0.2371025, -0.2351699, -0.2332397, -0.2313133, -0.22939, -0.2274674, -0.2255426, 
--0.223614, -0.2216822, -0.2197495, -0.2178187, -0.2158916, -0.2139678, -0.2120452, -0.210121, -0.2081932, -0.2062619, 
--0.2043292, -0.2023979, -0.20047, -0.1985457, -0.196623, -0.1946993, -0.1927722, -0.1908415, -0.1889089, -0.1869771, 
--0.1850485, -0.1831236, -0.1812008, -0.1792774, -0.1773511, -0.175421, -0.1734886, -0.1715565, -0.1696272, -0.1677016, 
--0.1657786, -0.1638555, -0.1619298, -0.1600004, -0.1580683, -0.156136, -0.154206, -0.1522797, -0.1503564, -0.1484335, 
--0.1465084, -0.1445797, -0.142648, -0.1407155, -0.138785, -0.136858, -0.1349342, -0.1330114, -0.1310869, -0.1291589, 
--0.1272277, -0.1252951, -0.123364, -0.1214363, -0.119512, -0.1175892, -0.1156652, -0.113738, -0.1118073, -0.1098748, 
--0.1079432, -0.1060148, -0.1040899, -0.102167, -0.1002435, -0.0983169, -0.0963868, -0.0944545, -0.0925225, -0.0905934, 
--0.0886679, -0.0867448, -0.0848216, -0.0828957, -0.0809662, -0.0790341, -0.077102, -0.0751722, -0.073246, -0.0713226, 
--0.0693996, -0.0674744, -0.0655456, -0.0636138, -0.0616815, -0.0597511, -0.0578242, -0.0559005, -0.0539776, -0.0520529, 
--0.0501248, -0.0481935, -0.046261, -0.0443301, -0.0424026, -0.0404783, -0.0385554, -0.0366313, -0.0347039, -0.0327731, 
--0.0308407, -0.0289093, -0.026981, -0.0250562, -0.0231333, -0.0212096, -0.0192829, -0.0173526, -0.0154203, -0.0134885, 
--0.0115596, -0.0096342, -0.0077111, -0.0057877, -0.0038617, -0.0019321, 0.0, 0.0038374, 0.0076846, 0.0115462, 
-0.0154187, 0.0192926, 0.0231576, 0.0270085, 0.0308476, 0.0346839, 0.0385279, 0.0423858, 0.0462562, 0.0501308, 
-0.053999, 0.0578536, 0.061695, 0.0655309, 0.069372, 0.0732261, 0.077094, 0.0809686, 0.0848395, 0.0886978, 
-0.0925421, 0.0963783, 0.100217, 0.1040673, 0.1079321, 0.1118061, 0.1156791, 0.1195412, 0.1233887, 0.1272259, 
-0.1310628, 0.1349094, 0.1387708, 0.1426435, 0.1465179, 0.1503837, 0.1542348, 0.1580737, 0.1619093, 0.1657525, 
-0.1696101, 0.1734808, 0.1773561, 0.1812251, 0.1850801, 0.1889213, 0.1927564, 0.1965965, 0.2004502, 0.2043183, 
-0.2081938, 0.2120657, 0.2159247, 0.2197687, 0.223604, 0.2274415, 0.2312911, 0.2351561, 0.239031, 0.2429053, 
-0.2467683, 0.2506157, 0.2544519, 0.2582874, 0.262133, 0.2659943, 0.269868, 0.273744, 0.2776109, 0.2814622, 
-0.2853001, 0.2891341, 0.292976, 0.2968332, 0.3007049, 0.304582, 0.3084525, 0.312308, 0.3161482, 0.3199815, 
-0.3238199, 0.3276729, 0.3315418, 0.3354192, 0.339293, 0.3431529, 0.3469962, 0.3508295, 0.3546649, 0.3585134, 
-0.3623789, 0.3662559, 0.3701325, 0.3739969, 0.3778439, 0.3816781, 0.385511, 0.389355, 0.3932165, 0.3970922, 
-0.400971, 0.4048398, 0.4086911, 0.412527, 0.416358, 0.4201976, 0.4240546, 0.4279282, 0.4318085, 0.4356816, 
-0.4395377, 0.4433761, 0.447206, 0.4510415, 0.4548935, 0.4587641, 0.4626451, 0.4665222, 0.4703834, 0.4742252, 
-0.4780549, 0.4818866, 0.4857333, 0.4896001, 0.4934808, 0.4973615, 0.5012281, 0.5050741, 0.5089045, 0.5127329, 
-0.5165742, 0.5204364, 0.5243159, 0.5281995, 0.5320716, 0.5359227, 0.5397548, 0.5435806, 0.5474163, 0.5512731, 
-0.5551503, 0.5590362, 0.5629138, 0.5667707, 0.5706057, 0.5744296, 0.5782598, 0.5821104, 0.5859843, 0.5898716, 
-0.5937546, 0.597618, 0.6014569, 0.6052799, 0.6091049, 0.6129487, 0.616818, 0.6207056, 0.6245938, 0.6284643, 
-0.6323083, 0.6361316, 0.6399516, 0.643788, 0.6476515, 0.6515383, 0.6554312, 0.6593094, 0.6631598, 0.6669846, 
-0.6708002, 0.6746286, 0.678485, 0.6823696, 0.6862666, 0.690153, 0.6940113, 0.697839, 0.7016509, 0.7054708, 
-0.7093187, 0.7131994, 0.7170998, 0.720995, 0.7248626, 0.728695, 0.732504, 0.7363149, 0.7401525, 0.7440277, 
-0.7479303, 0.7518348, 0.7557136, 0.7595527, 0.76336, 0.7671612, 0.7709867, 0.7748539, 0.7787577, 0.7826721, 
-0.7865643, 0.7904127, 0.7942195, 0.7980105, 0.8018211, 0.8056775, 0.8095809, 0.8135062, 0.8174148, 0.821276, 
-0.8250841, 0.8288635, 0.8326556, 0.836497, 0.840398, 0.8443357, 0.8482655, 0.8521445, 0.8559564, 0.859722, 
-0.8634895, 0.8673093, 0.871205, 0.8751585, 0.8791176, 0.8830232, 0.8868424, 0.8905893, 0.8943206, 0.8981066, 
-0.9019924, 0.9059693, 0.9099753, 0.9139254, 0.9177581, 0.9214734, 0.9251401, 0.9288639, 0.9327311, 0.9367553, 
-0.940859, 0.944904, 0.9487624, 0.9523943, 0.95589, 0.9594474, 0.9632825, 0.9675036, 0.9720047, 0.9764288, 
-0.9802293, 0.9828158, 0.9837347, 0.9828158, 0.9802293, 0.9764288, 0.9720047, 0.9675036, 0.9632825, 0.9594474, 
-0.95589, 0.9523943, 0.9487624, 0.944904, 0.940859, 0.9367553, 0.9327311, 0.9288639, 0.9251401, 0.9214734, 
-0.9177581, 0.9139254, 0.9099753, 0.9059693, 0.9019924, 0.8981066, 0.8943206, 0.8905893, 0.8868424, 0.8830232, 
-0.8791176, 0.8751585, 0.871205, 0.8673093, 0.8634895, 0.859722, 0.8559564, 0.8521445, 0.8482655, 0.8443357, 
-0.840398, 0.836497, 0.8326556, 0.8288635, 0.8250841, 0.821276, 0.8174148, 0.8135062, 0.8095809, 0.8056775, 
-0.8018211, 0.7980105, 0.7942195, 0.7904127, 0.7865643, 0.7826721, 0.7787577, 0.7748539, 0.7709867, 0.7671612, 
-0.76336, 0.7595527, 0.7557136, 0.7518348, 0.7479303, 0.7440277, 0.7401525, 0.7363149, 0.732504, 0.728695, 
-0.7248626, 0.720995, 0.7170998, 0.7131994, 0.7093187, 0.7054708, 0.7016509, 0.697839, 0.6940113, 0.690153, 
-0.6862666, 0.6823696, 0.678485, 0.6746286, 0.6708002, 0.6669846, 0.6631598, 0.6593094, 0.6554312, 0.6515383, 
-0.6476515, 0.643788, 0.6399516, 0.6361316, 0.6323083, 0.6284643, 0.6245938, 0.6207056, 0.616818, 0.6129487, 
-0.6091049, 0.6052799, 0.6014569, 0.597618, 0.5937546, 0.5898716, 0.5859843, 0.5821104, 0.5782598, 0.5744296, 
-0.5706057, 0.5667707, 0.5629138, 0.5590362, 0.5551503, 0.5512731, 0.5474163, 0.5435806, 0.5397548, 0.5359227, 
-0.5320716, 0.5281995, 0.5243159, 0.5204364, 0.5165742, 0.5127329, 0.5089045, 0.5050741, 0.5012281, 0.4973615, 
-0.4934808, 0.4896001, 0.4857333, 0.4818866, 0.4780549, 0.4742252, 0.4703834, 0.4665222, 0.4626451, 0.4587641, 
-0.4548935, 0.4510415, 0.447206, 0.4433761, 0.4395377, 0.4356816, 0.4318085, 0.4279282, 0.4240546, 0.4201976, 
-0.416358, 0.412527, 0.4086911, 0.4048398, 0.400971, 0.3970922, 0.3932165, 0.389355, 0.385511, 0.3816781, 
-0.3778439, 0.3739969, 0.3701325, 0.3662559, 0.3623789, 0.3585134, 0.3546649, 0.3508295, 0.3469962, 0.3431529, 
-0.339293, 0.3354192, 0.3315418, 0.3276729, 0.3238199, 0.3199815, 0.3161482, 0.312308, 0.3084525, 0.304582, 
-0.3007049, 0.2968332, 0.292976, 0.2891341, 0.2853001, 0.2814622, 0.2776109, 0.273744, 0.269868, 0.2659943, 
-0.262133, 0.2582874, 0.2544519, 0.2506157, 0.2467683, 0.2429053, 0.239031, 0.2351561, 0.2312911, 0.2274415, 
-0.223604, 0.2197687, 0.2159247, 0.2120657, 0.2081938, 0.2043183, 0.2004502, 0.1965965, 0.1927564, 0.1889213, 
-0.1850801, 0.1812251, 0.1773561, 0.1734808, 0.1696101, 0.1657525, 0.1619093, 0.1580737, 0.1542348, 0.1503837, 
-0.1465179, 0.1426435, 0.1387708, 0.1349094, 0.1310628, 0.1272259, 0.1233887, 0.1195412, 0.1156791, 0.1118061, 
-0.1079321, 0.1040673, 0.100217, 0.0963783, 0.0925421, 0.0886978, 0.0848395, 0.0809686, 0.077094, 0.0732261, 
-0.069372, 0.0655309, 0.061695, 0.0578536, 0.053999, 0.0501308, 0.0462562, 0.0423858, 0.0385279, 0.0346839, 
-0.0308476, 0.0270085, 0.0231576, 0.0192926, 0.0154187, 0.0115462, 0.0076846, 0.0038374, -0.0, -0.0038374, 
--0.0076846, -0.0115462, -0.0154187, -0.0192926, -0.0231576, -0.0270085, -0.0308476, -0.0346839, -0.0385279, -0.0423858, 
--0.0462562, -0.0501308, -0.053999, -0.0578536, -0.061695, -0.0655309, -0.069372, -0.0732261, -0.077094, -0.0809686, 
--0.0848395, -0.0886978, -0.0925421, -0.0963783, -0.100217, -0.1040673, -0.1079321, -0.1118061, -0.1156791, -0.1195412, 
--0.1233887, -0.1272259, -0.1310628, -0.1349094, -0.1387708, -0.1426435, -0.1465179, -0.1503837, -0.1542348, -0.1580737, 
--0.1619093, -0.1657525, -0.1696101, -0.1734808, -0.1773561, -0.1812251, -0.1850801, -0.1889213, -0.1927564, -0.1965965, 
--0.2004502, -0.2043183, -0.2081938, -0.2120657, -0.2159247, -0.2197687, -0.223604, -0.2274415, -0.2312911, -0.2351561, 
--0.239031, -0.2429053, -0.2467683, -0.2506157, -0.2544519, -0.2582874, -0.262133, -0.2659943, -0.269868, -0.273744, 
--0.2776109, -0.2814622, -0.2853001, -0.2891341, -0.292976, -0.2968332, -0.3007049, -0.304582, -0.3084525, -0.312308, 
--0.3161482, -0.3199815, -0.3238199, -0.3276729, -0.3315418, -0.3354192, -0.339293, -0.3431529, -0.3469962, -0.3508295, 
--0.3546649, -0.3585134, -0.3623789, -0.3662559, -0.3701325, -0.3739969, -0.3778439, -0.3816781, -0.385511, -0.389355, 
--0.3932165, -0.3970922, -0.400971, -0.4048398, -0.4086911, -0.412527, -0.416358, -0.4201976, -0.4240546, -0.4279282, 
--0.4318085, -0.4356816, -0.4395377, -0.4433761, -0.447206, -0.4510415, -0.4548935, -0.4587641, -0.4626451, -0.4665222, 
--0.4703834, -0.4742252, -0.4780549, -0.4818866, -0.4857333, -0.4896001, -0.4934808, -0.4973615, -0.5012281, -0.5050741, 
--0.5089045, -0.5127329, -0.5165742, -0.5204364, -0.5243159, -0.5281995, -0.5320716, -0.5359227, -0.5397548, -0.5435806, 
--0.5474163, -0.5512731, -0.5551503, -0.5590362, -0.5629138, -0.5667707, -0.5706057, -0.5744296, -0.5782598, -0.5821104, 
--0.5859843, -0.5898716, -0.5937546, -0.597618, -0.6014569, -0.6052799, -0.6091049, -0.6129487, -0.616818, -0.6207056, 
--0.6245938, -0.6284643, -0.6323083, -0.6361316, -0.6399516, -0.643788, -0.6476515, -0.6515383, -0.6554312, -0.6593094, 
--0.6631598, -0.6669846, -0.6708002, -0.6746286, -0.678485, -0.6823696, -0.6862666, -0.690153, -0.6940113, -0.697839, 
--0.7016509, -0.7054708, -0.7093187, -0.7131994, -0.7170998, -0.720995, -0.7248626, -0.728695, -0.732504, -0.7363149, 
--0.7401525, -0.7440277, -0.7479303, -0.7518348, -0.7557136, -0.7595527, -0.76336, -0.7671612, -0.7709867, -0.7748539, 
--0.7787577, -0.7826721, -0.7865643, -0.7904127, -0.7942195, -0.7980105, -0.8018211, -0.8056775, -0.8095809, -0.8135062, 
--0.8174148, -0.821276, -0.8250841, -0.8288635, -0.8326556, -0.836497, -0.840398, -0.8443357, -0.8482655, -0.8521445, 
--0.8559564, -0.859722, -0.8634895, -0.8673093, -0.871205, -0.8751585, -0.8791176, -0.8830232, -0.8868424, -0.8905893, 
--0.8943206, -0.8981066, -0.9019924, -0.9059693, -0.9099753, -0.9139254, -0.9177581, -0.9214734, -0.9251401, -0.9288639, 
--0.9327311, -0.9367553, -0.940859, -0.944904, -0.9487624, -0.9523943, -0.95589, -0.9594474, -0.9632825, -0.9675036, 
--0.9720047, -0.9764288, -0.9802293, -0.9828158, -0.9837347, -0.9828158, -0.9802293, -0.9764288, -0.9720047, -0.9675036, 
--0.9632825, -0.9594474, -0.95589, -0.9523943, -0.9487624, -0.944904, -0.940859, -0.9367553, -0.9327311, -0.9288639, 
--0.9251401, -0.9214734, -0.9177581, -0.9139254, -0.9099753, -0.9059693, -0.9019924, -0.8981066, -0.8943206, -0.8905893, 
--0.8868424, -0.8830232, -0.8791176, -0.8751585, -0.871205, -0.8673093, -0.8634895, -0.859722, -0.8559564, -0.8521445, 
--0.8482655, -0.8443357, -0.840398, -0.836497, -0.8326556, -0.8288635, -0.8250841, -0.821276, -0.8174148, -0.8135062, 
--0.8095809, -0.8056775, -0.8018211, -0.7980105, -0.7942195, -0.7904127, -0.7865643, -0.7826721, -0.7787577, -0.7748539, 
--0.7709867, -0.7671612, -0.76336, -0.7595527, -0.7557136, -0.7518348, -0.7479303, -0.7440277, -0.7401525, -0.7363149, 
--0.732504, -0.728695, -0.7248626, -0.720995, -0.7170998, -0.7131994, -0.7093187, -0.7054708, -0.7016509, -0.697839, 
--0.6940113, -0.690153, -0.6862666, -0.6823696, -0.678485, -0.6746286, -0.6708002, -0.6669846, -0.6631598, -0.6593094, 
--0.6554312, -0.6515383, -0.6476515, -0.643788, -0.6399516, -0.6361316, -0.6323083, -0.6284643, -0.6245938, -0.6207056, 
--0.616818, -0.6129487, -0.6091049, -0.6052799, -0.6014569, -0.597618, -0.5937546, -0.5898716, -0.5859843, -0.5821104, 
--0.5782598, -0.5744296, -0.5706057, -0.5667707, -0.5629138, -0.5590362, -0.5551503, -0.5512731, -0.5474163, -0.5435806, 
--0.5397548, -0.5359227, -0.5320716, -0.5281995, -0.5243159, -0.5204364, -0.5165742, -0.5127329, -0.5089045, -0.5050741, 
--0.5012281, -0.4973615, -0.4934808, -0.4896001, -0.4857333, -0.4818866, -0.4780549, -0.4742252, -0.4703834, -0.4665222, 
--0.4626451, -0.4587641, -0.4548935, -0.4510415, -0.447206, -0.4433761, -0.4395377, -0.4356816, -0.4318085, -0.4279282, 
--0.4240546, -0.4201976, -0.416358, -0.412527, -0.4086911, -0.4048398, -0.400971, -0.3970922, -0.3932165, -0.389355, 
--0.385511, -0.3816781, -0.3778439, -0.3739969, -0.3701325, -0.3662559, -0.3623789, -0.3585134, -0.3546649, -0.3508295, 
--0.3469962, -0.3431529, -0.339293, -0.3354192, -0.3315418, -0.3276729, -0.3238199, -0.3199815, -0.3161482, -0.312308, 
--0.3084525, -0.304582, -0.3007049, -0.2968332, -0.292976, -0.2891341, -0.2853001, -0.2814622, -0.2776109, -0.273744, 
--0.269868, -0.2659943, -0.262133, -0.2582874, -0.2544519, -0.2506157, -0.2467683, -0.2429053, -0.239031, -0.2351561, 
--0.2312911, -0.2274415, -0.223604, -0.2197687, -0.2159247, -0.2120657, -0.2081938, -0.2043183, -0.2004502, -0.1965965, 
--0.1927564, -0.1889213, -0.1850801, -0.1812251, -0.1773561, -0.1734808, -0.1696101, -0.1657525, -0.1619093, -0.1580737, 
--0.1542348, -0.1503837, -0.1465179, -0.1426435, -0.1387708, -0.1349094, -0.1310628, -0.1272259, -0.1233887, -0.1195412, 
--0.1156791, -0.1118061, -0.1079321, -0.1040673, -0.100217, -0.0963783, -0.0925421, -0.0886978, -0.0848395, -0.0809686, 
--0.077094, -0.0732261, -0.069372, -0.0655309, -0.061695, -0.0578536, -0.053999, -0.0501308, -0.0462562, -0.0423858, 
--0.0385279, -0.0346839, -0.0308476, -0.0270085, -0.0231576, -0.0192926, -0.0154187, -0.0115462, -0.0076846, -0.0038374, 
-0.0, 0.0077824, 0.0155251, 0.0232106, 0.0308526, 0.0384889, 0.0461606, 0.0538892, 0.061665, 0.0694519, 
-0.077208, 0.084908, 0.0925576, 0.1001903, 0.1078492, 0.115563, 0.1233301, 0.1311196, 0.138888, 0.1466032, 
-0.1542623, 0.1618936, 0.1695408, 0.1772391, 0.1849956, 0.1927855, 0.200565, 0.2082959, 0.2159667, 0.2235987, 
-0.2312354, 0.2389176, 0.2466616, 0.2544495, 0.2622389, 0.2699861, 0.2776704, 0.2853056, 0.2929331, 0.3005988, 
-0.3083283, 0.3161118, 0.3239097, 0.3316736, 0.3393734, 0.3470143, 0.3546341, 0.3622829, 0.3699957, 0.3777723, 
-0.3855769, 0.3933579, 0.4010756, 0.4087249, 0.4163387, 0.4239703, 0.4316641, 0.4394307, 0.4472403, 0.4550388, 
-0.4627768, 0.4704377, 0.4780475, 0.4856614, 0.4933334, 0.5010866, 0.5088992, 0.5167157, 0.5244771, 0.5321534, 
-0.5397614, 0.5473568, 0.5550036, 0.5627392, 0.5705523, 0.5783878, 0.5861765, 0.5938729, 0.6014819, 0.6090576, 
-0.6166745, 0.624387, 0.6321976, 0.6400538, 0.6478755, 0.6555985, 0.6632118, 0.6707655, 0.6783456, 0.6860271, 
-0.6938314, 0.7017113, 0.7095749, 0.7173344, 0.7249565, 0.7324838, 0.7400152, 0.7476531, 0.7554456, 0.7633557, 
-0.7712773, 0.7790903, 0.786728, 0.7942192, 0.8016789, 0.8092493, 0.8170211, 0.8249768, 0.8329913, 0.8408931, 
-0.8485585, 0.8559878, 0.8633192, 0.8707654, 0.8784995, 0.8865489, 0.8947577, 0.9028489, 0.9105661, 0.9178293, 
-0.9248197, 0.9319338, 0.9396036, 0.9480459, 0.9570486, 0.9658972, 0.9734985, 0.9786716, 0.9805094, 0.9786716, 
-0.9734985, 0.9658972, 0.9570486, 0.9480459, 0.9396036, 0.9319338, 0.9248197, 0.9178293, 0.9105661, 0.9028489, 
-0.8947577, 0.8865489, 0.8784995, 0.8707654, 0.8633192, 0.8559878, 0.8485585, 0.8408931, 0.8329913, 0.8249768, 
-0.8170211, 0.8092493, 0.8016789, 0.7942192, 0.786728, 0.7790903, 0.7712773, 0.7633557, 0.7554456, 0.7476531, 
-0.7400152, 0.7324838, 0.7249565, 0.7173344, 0.7095749, 0.7017113, 0.6938314, 0.6860271, 0.6783456, 0.6707655, 
-0.6632118, 0.6555985, 0.6478755, 0.6400538, 0.6321976, 0.624387, 0.6166745, 0.6090576, 0.6014819, 0.5938729, 
-0.5861765, 0.5783878, 0.5705523, 0.5627392, 0.5550036, 0.5473568, 0.5397614, 0.5321534, 0.5244771, 0.5167157, 
-0.5088992, 0.5010866, 0.4933334, 0.4856614, 0.4780475, 0.4704377, 0.4627768, 0.4550388, 0.4472403, 0.4394307, 
-0.4316641, 0.4239703, 0.4163387, 0.4087249, 0.4010756, 0.3933579, 0.3855769, 0.3777723, 0.3699957, 0.3622829, 
-0.3546341, 0.3470143, 0.3393734, 0.3316736, 0.3239097, 0.3161118, 0.3083283, 0.3005988, 0.2929331, 0.2853056, 
-0.2776704, 0.2699861, 0.2622389, 0.2544495, 0.2466616, 0.2389176, 0.2312354, 0.2235987, 0.2159667, 0.2082959, 
-0.200565, 0.1927855, 0.1849956, 0.1772391, 0.1695408, 0.1618936, 0.1542623, 0.1466032, 0.138888, 0.1311196, 
-0.1233301, 0.115563, 0.1078492, 0.1001903, 0.0925576, 0.084908, 0.077208, 0.0694519, 0.061665, 0.0538892, 
-0.0461606, 0.0384889, 0.0308526, 0.0232106, 0.0155251, 0.0077824, -0.0, -0.0077824, -0.0155251, -0.0232106, 
--0.0308526, -0.0384889, -0.0461606, -0.0538892, -0.061665, -0.0694519, -0.077208, -0.084908, -0.0925576, -0.1001903, 
--0.1078492, -0.115563, -0.1233301, -0.1311196, -0.138888, -0.1466032, -0.1542623, -0.1618936, -0.1695408, -0.1772391, 
--0.1849956, -0.1927855, -0.200565, -0.2082959, -0.2159667, -0.2235987, -0.2312354, -0.2389176, -0.2466616, -0.2544495, 
--0.2622389, -0.2699861, -0.2776704, -0.2853056, -0.2929331, -0.3005988, -0.3083283, -0.3161118, -0.3239097, -0.3316736, 
--0.3393734, -0.3470143, -0.3546341, -0.3622829, -0.3699957, -0.3777723, -0.3855769, -0.3933579, -0.4010756, -0.4087249, 
--0.4163387, -0.4239703, -0.4316641, -0.4394307, -0.4472403, -0.4550388, -0.4627768, -0.4704377, -0.4780475, -0.4856614, 
--0.4933334, -0.5010866, -0.5088992, -0.5167157, -0.5244771, -0.5321534, -0.5397614, -0.5473568, -0.5550036, -0.5627392, 
--0.5705523, -0.5783878, -0.5861765, -0.5938729, -0.6014819, -0.6090576, -0.6166745, -0.624387, -0.6321976, -0.6400538, 
--0.6478755, -0.6555985, -0.6632118, -0.6707655, -0.6783456, -0.6860271, -0.6938314, -0.7017113, -0.7095749, -0.7173344, 
--0.7249565, -0.7324838, -0.7400152, -0.7476531, -0.7554456, -0.7633557, -0.7712773, -0.7790903, -0.786728, -0.7942192, 
--0.8016789, -0.8092493, -0.8170211, -0.8249768, -0.8329913, -0.8408931, -0.8485585, -0.8559878, -0.8633192, -0.8707654, 
--0.8784995, -0.8865489, -0.8947577, -0.9028489, -0.9105661, -0.9178293, -0.9248197, -0.9319338, -0.9396036, -0.9480459, 
--0.9570486, -0.9658972, -0.9734985, -0.9786716, -0.9805094, -0.9786716, -0.9734985, -0.9658972, -0.9570486, -0.9480459, 
--0.9396036, -0.9319338, -0.9248197, -0.9178293, -0.9105661, -0.9028489, -0.8947577, -0.8865489, -0.8784995, -0.8707654, 
--0.8633192, -0.8559878, -0.8485585, -0.8408931, -0.8329913, -0.8249768, -0.8170211, -0.8092493, -0.8016789, -0.7942192, 
--0.786728, -0.7790903, -0.7712773, -0.7633557, -0.7554456, -0.7476531, -0.7400152, -0.7324838, -0.7249565, -0.7173344, 
--0.7095749, -0.7017113, -0.6938314, -0.6860271, -0.6783456, -0.6707655, -0.6632118, -0.6555985, -0.6478755, -0.6400538, 
--0.6321976, -0.624387, -0.6166745, -0.6090576, -0.6014819, -0.5938729, -0.5861765, -0.5783878, -0.5705523, -0.5627392, 
--0.5550036, -0.5473568, -0.5397614, -0.5321534, -0.5244771, -0.5167157, -0.5088992, -0.5010866, -0.4933334, -0.4856614, 
--0.4780475, -0.4704377, -0.4627768, -0.4550388, -0.4472403, -0.4394307, -0.4316641, -0.4239703, -0.4163387, -0.4087249, 
--0.4010756, -0.3933579, -0.3855769, -0.3777723, -0.3699957, -0.3622829, -0.3546341, -0.3470143, -0.3393734, -0.3316736, 
--0.3239097, -0.3161118, -0.3083283, -0.3005988, -0.2929331, -0.2853056, -0.2776704, -0.2699861, -0.2622389, -0.2544495, 
--0.2466616, -0.2389176, -0.2312354, -0.2235987, -0.2159667, -0.2082959, -0.200565, -0.1927855, -0.1849956, -0.1772391, 
--0.1695408, -0.1618936, -0.1542623, -0.1466032, -0.138888, -0.1311196, -0.1233301, -0.115563, -0.1078492, -0.1001903, 
--0.0925576, -0.084908, -0.077208, -0.0694519, -0.061665, -0.0538892, -0.0461606, -0.0384889, -0.0308526, -0.0232106, 
--0.0155251, -0.0077824, 0.0, 0.0157194, 0.031284, 0.0466192, 0.061769, 0.0768737, 0.0920978, 0.1075447, 
-0.1232027, 0.1389506, 0.1546187, 0.1700774, 0.1853044, 0.2003979, 0.2155272, 0.2308457, 0.2464107, 0.2621518, 
-0.2779049, 0.2934961, 0.3088322, 0.3239514, 0.3390068, 0.3541892, 0.3696283, 0.3853232, 0.4011379, 0.4168688, 
-0.4323488, 0.4475367, 0.4625441, 0.4775828, 0.4928578, 0.5084584, 0.5243058, 0.5401856, 0.5558544, 0.5711669, 
-0.5861591, 0.6010405, 0.6160945, 0.6315323, 0.6473747, 0.6634263, 0.6793619, 0.6948897, 0.7099111, 0.7245934, 
-0.7393075, 0.7544504, 0.7702331, 0.7865408, 0.8029496, 0.8189107, 0.8340309, 0.8483194, 0.8622667, 0.8766836, 
-0.892332, 0.9094793, 0.9275594, 0.9451037, 0.9600079, 0.9700715, 0.973632, 0.9700715, 0.9600079, 0.9451037, 
-0.9275594, 0.9094793, 0.892332, 0.8766836, 0.8622667, 0.8483194, 0.8340309, 0.8189107, 0.8029496, 0.7865408, 
-0.7702331, 0.7544504, 0.7393075, 0.7245934, 0.7099111, 0.6948897, 0.6793619, 0.6634263, 0.6473747, 0.6315323, 
-0.6160945, 0.6010405, 0.5861591, 0.5711669, 0.5558544, 0.5401856, 0.5243058, 0.5084584, 0.4928578, 0.4775828, 
-0.4625441, 0.4475367, 0.4323488, 0.4168688, 0.4011379, 0.3853232, 0.3696283, 0.3541892, 0.3390068, 0.3239514, 
-0.3088322, 0.2934961, 0.2779049, 0.2621518, 0.2464107, 0.2308457, 0.2155272, 0.2003979, 0.1853044, 0.1700774, 
-0.1546187, 0.1389506, 0.1232027, 0.1075447, 0.0920978, 0.0768737, 0.061769, 0.0466192, 0.031284, 0.0157194, 
--0.0, -0.0157194, -0.031284, -0.0466192, -0.061769, -0.0768737, -0.0920978, -0.1075447, -0.1232027, -0.1389506, 
--0.1546187, -0.1700774, -0.1853044, -0.2003979, -0.2155272, -0.2308457, -0.2464107, -0.2621518, -0.2779049, -0.2934961, 
--0.3088322, -0.3239514, -0.3390068, -0.3541892, -0.3696283, -0.3853232, -0.4011379, -0.4168688, -0.4323488, -0.4475367, 
--0.4625441, -0.4775828, -0.4928578, -0.5084584, -0.5243058, -0.5401856, -0.5558544, -0.5711669, -0.5861591, -0.6010405, 
--0.6160945, -0.6315323, -0.6473747, -0.6634263, -0.6793619, -0.6948897, -0.7099111, -0.7245934, -0.7393075, -0.7544504, 
--0.7702331, -0.7865408, -0.8029496, -0.8189107, -0.8340309, -0.8483194, -0.8622667, -0.8766836, -0.892332, -0.9094793, 
--0.9275594, -0.9451037, -0.9600079, -0.9700715, -0.973632, -0.9700715, -0.9600079, -0.9451037, -0.9275594, -0.9094793, 
--0.892332, -0.8766836, -0.8622667, -0.8483194, -0.8340309, -0.8189107, -0.8029496, -0.7865408, -0.7702331, -0.7544504, 
--0.7393075, -0.7245934, -0.7099111, -0.6948897, -0.6793619, -0.6634263, -0.6473747, -0.6315323, -0.6160945, -0.6010405, 
--0.5861591, -0.5711669, -0.5558544, -0.5401856, -0.5243058, -0.5084584, -0.4928578, -0.4775828, -0.4625441, -0.4475367, 
--0.4323488, -0.4168688, -0.4011379, -0.3853232, -0.3696283, -0.3541892, -0.3390068, -0.3239514, -0.3088322, -0.2934961, 
--0.2779049, -0.2621518, -0.2464107, -0.2308457, -0.2155272, -0.2003979, -0.1853044, -0.1700774, -0.1546187, -0.1389506, 
--0.1232027, -0.1075447, -0.0920978, -0.0768737, -0.061769, -0.0466192, -0.031284, -0.0157194, 0.0, 0.0297424, 
-0.0601331, 0.0914438, 0.1234082, 0.1553714, 0.1866661, 0.2170042, 0.2466563, 0.2763111, 0.3066843, 0.3380955, 
-0.3702587, 0.402417, 0.4337654, 0.4639292, 0.4932243, 0.5225277, 0.5528024, 0.584521, 0.6173175, 0.6500979, 
-0.6816041, 0.7111658, 0.7392319, 0.7673356, 0.7974016, 0.8306342, 0.8664768, 0.9021624, 0.9331561, 0.9544122, 
-0.9619928, 0.9544122, 0.9331561, 0.9021624, 0.8664768, 0.8306342, 0.7974016, 0.7673356, 0.7392319, 0.7111658, 
-0.6816041, 0.6500979, 0.6173175, 0.584521, 0.5528024, 0.5225277, 0.4932243, 0.4639292, 0.4337654, 0.402417, 
-0.3702587, 0.3380955, 0.3066843, 0.2763111, 0.2466563, 0.2170042, 0.1866661, 0.1553714, 0.1234082, 0.0914438, 
-0.0601331, 0.0297424, 0.0, -0.0297424, -0.0601331, -0.0914438, -0.1234082, -0.1553714, -0.1866661, -0.2170042, 
--0.2466563, -0.2763111, -0.3066843, -0.3380955, -0.3702587, -0.402417, -0.4337654, -0.4639292, -0.4932243, -0.5225277, 
--0.5528024, -0.584521, -0.6173175, -0.6500979, -0.6816041, -0.7111658, -0.7392319, -0.7673356, -0.7974016, -0.8306342, 
--0.8664768, -0.9021624, -0.9331561, -0.9544122, -0.9619928, -0.9544122, -0.9331561, -0.9021624, -0.8664768, -0.8306342, 
--0.7974016, -0.7673356, -0.7392319, -0.7111658, -0.6816041, -0.6500979, -0.6173175, -0.584521, -0.5528024, -0.5225277, 
--0.4932243, -0.4639292, -0.4337654, -0.402417, -0.3702587, -0.3380955, -0.3066843, -0.2763111, -0.2466563, -0.2170042, 
--0.1866661, -0.1553714, -0.1234082, -0.0914438, -0.0601331, -0.0297424, 0.0, 0.0573379, 0.1172824, 0.1809629, 
-0.2473404, 0.3136965, 0.3770932, 0.4360804, 0.4917487, 0.5474846, 0.6073787, 0.6738898, 0.7457903, 0.8173831, 
-0.8795, 0.9220512, 0.9372154, 0.9220512, 0.8795, 0.8173831, 0.7457903, 0.6738898, 0.6073787, 0.5474846, 
-0.4917487, 0.4360804, 0.3770932, 0.3136965, 0.2473404, 0.1809629, 0.1172824, 0.0573379, 0.0, -0.0573379, 
--0.1172824, -0.1809629, -0.2473404, -0.3136965, -0.3770932, -0.4360804, -0.4917487, -0.5474846, -0.6073787, -0.6738898, 
--0.7457903, -0.8173831, -0.8795, -0.9220512, -0.9372154, -0.9220512, -0.8795, -0.8173831, -0.7457903, -0.6738898, 
--0.6073787, -0.5474846, -0.4917487, -0.4360804, -0.3770932, -0.3136965, -0.2473404, -0.1809629, -0.1172824, -0.0573379, 
-0.0, 0.1066882, 0.2240241, 0.3572753, 0.5028315, 0.6478343, 0.7731199, 0.8585366, 0.8888889, 0.8585366, 
-0.7731199, 0.6478343, 0.5028315, 0.3572753, 0.2240241, 0.1066882, 0.0, -0.1066882, -0.2240241, -0.3572753, 
--0.5028315, -0.6478343, -0.7731199, -0.8585366, -0.8888889, -0.8585366, -0.7731199, -0.6478343, -0.5028315, -0.3572753, 
--0.2240241, -0.1066882, 0.0, 0.3061467, 0.5656854, 0.7391036, 0.8, 0.7391036, 0.5656854, 0.3061467, 
-0.0, -0.3061467, -0.5656854, -0.7391036, -0.8, -0.7391036, -0.5656854, -0.3061467, 0.0 };
-
-
-constexpr float sine[] = 
-{0.0, 0.0003835, 0.000767, 0.0011505, 0.001534, 0.0019175, 0.002301, 0.0026845, 0.0030679, 0.0034514, 
-0.0038349, 0.0042184, 0.0046019, 0.0049854, 0.0053688, 0.0057523, 0.0061358, 0.0065192, 0.0069027, 0.0072862, 
-0.0076696, 0.0080531, 0.0084365, 0.0088199, 0.0092034, 0.0095868, 0.0099702, 0.0103536, 0.010737, 0.0111204, 
-0.0115038, 0.0118872, 0.0122706, 0.012654, 0.0130374, 0.0134207, 0.0138041, 0.0141874, 0.0145708, 0.0149541, 
-0.0153374, 0.0157207, 0.016104, 0.0164873, 0.0168706, 0.0172539, 0.0176371, 0.0180204, 0.0184036, 0.0187868, 
-0.0191701, 0.0195533, 0.0199365, 0.0203196, 0.0207028, 0.021086, 0.0214691, 0.0218523, 0.0222354, 0.0226185, 
-0.0230016, 0.0233847, 0.0237677, 0.0241508, 0.0245338, 0.0249169, 0.0252999, 0.0256829, 0.0260659, 0.0264488, 
-0.0268318, 0.0272147, 0.0275976, 0.0279805, 0.0283634, 0.0287463, 0.0291291, 0.029512, 0.0298948, 0.0302776, 
-0.0306604, 0.0310431, 0.0314259, 0.0318086, 0.0321913, 0.032574, 0.0329567, 0.0333393, 0.033722, 0.0341046, 
-0.0344872, 0.0348697, 0.0352523, 0.0356348, 0.0360173, 0.0363998, 0.0367823, 0.0371647, 0.0375472, 0.0379296, 
-0.0383119, 0.0386943, 0.0390766, 0.0394589, 0.0398412, 0.0402235, 0.0406057, 0.0409879, 0.0413701, 0.0417523, 
-0.0421344, 0.0425166, 0.0428987, 0.0432807, 0.0436628, 0.0440448, 0.0444268, 0.0448087, 0.0451907, 0.0455726, 
-0.0459545, 0.0463363, 0.0467182, 0.0471, 0.0474817, 0.0478635, 0.0482452, 0.0486269, 0.0490086, 0.0493902, 
-0.0497718, 0.0501534, 0.0505349, 0.0509164, 0.0512979, 0.0516794, 0.0520608, 0.0524422, 0.0528236, 0.0532049, 
-0.0535862, 0.0539675, 0.0543487, 0.0547299, 0.0551111, 0.0554922, 0.0558734, 0.0562544, 0.0566355, 0.0570165, 
-0.0573975, 0.0577784, 0.0581593, 0.0585402, 0.058921, 0.0593018, 0.0596826, 0.0600633, 0.060444, 0.0608247, 
-0.0612053, 0.0615859, 0.0619665, 0.062347, 0.0627275, 0.0631079, 0.0634883, 0.0638687, 0.0642491, 0.0646294, 
-0.0650096, 0.0653898, 0.06577, 0.0661502, 0.0665303, 0.0669103, 0.0672904, 0.0676703, 0.0680503, 0.0684302, 
-0.0688101, 0.0691899, 0.0695697, 0.0699494, 0.0703291, 0.0707088, 0.0710884, 0.071468, 0.0718475, 0.072227, 
-0.0726065, 0.0729859, 0.0733652, 0.0737446, 0.0741238, 0.0745031, 0.0748823, 0.0752614, 0.0756405, 0.0760196, 
-0.0763986, 0.0767776, 0.0771565, 0.0775354, 0.0779142, 0.078293, 0.0786717, 0.0790504, 0.0794291, 0.0798077, 
-0.0801862, 0.0805647, 0.0809432, 0.0813216, 0.0817, 0.0820783, 0.0824566, 0.0828348, 0.083213, 0.0835911, 
-0.0839691, 0.0843472, 0.0847251, 0.0851031, 0.0854809, 0.0858588, 0.0862365, 0.0866143, 0.0869919, 0.0873696, 
-0.0877471, 0.0881246, 0.0885021, 0.0888795, 0.0892569, 0.0896342, 0.0900115, 0.0903887, 0.0907658, 0.0911429, 
-0.0915199, 0.0918969, 0.0922739, 0.0926507, 0.0930276, 0.0934043, 0.0937811, 0.0941577, 0.0945343, 0.0949109, 
-0.0952874, 0.0956638, 0.0960402, 0.0964165, 0.0967928, 0.097169, 0.0975452, 0.0979213, 0.0982973, 0.0986733, 
-0.0990492, 0.0994251, 0.0998009, 0.1001766, 0.1005523, 0.1009279, 0.1013035, 0.101679, 0.1020545, 0.1024299, 
-0.1028052, 0.1031805, 0.1035557, 0.1039308, 0.1043059, 0.104681, 0.1050559, 0.1054308, 0.1058057, 0.1061804, 
-0.1065552, 0.1069298, 0.1073044, 0.1076789, 0.1080534, 0.1084278, 0.1088021, 0.1091764, 0.1095506, 0.1099248, 
-0.1102988, 0.1106729, 0.1110468, 0.1114207, 0.1117945, 0.1121683, 0.112542, 0.1129156, 0.1132891, 0.1136626, 
-0.114036, 0.1144094, 0.1147827, 0.1151559, 0.1155291, 0.1159021, 0.1162752, 0.1166481, 0.117021, 0.1173938, 
-0.1177665, 0.1181392, 0.1185118, 0.1188843, 0.1192568, 0.1196292, 0.1200015, 0.1203738, 0.1207459, 0.1211181, 
-0.1214901, 0.1218621, 0.122234, 0.1226058, 0.1229775, 0.1233492, 0.1237208, 0.1240923, 0.1244638, 0.1248352, 
-0.1252065, 0.1255777, 0.1259489, 0.12632, 0.126691, 0.127062, 0.1274328, 0.1278036, 0.1281743, 0.128545, 
-0.1289156, 0.129286, 0.1296565, 0.1300268, 0.1303971, 0.1307672, 0.1311374, 0.1315074, 0.1318773, 0.1322472, 
-0.132617, 0.1329867, 0.1333564, 0.1337259, 0.1340954, 0.1344648, 0.1348342, 0.1352034, 0.1355726, 0.1359417, 
-0.1363107, 0.1366796, 0.1370485, 0.1374172, 0.1377859, 0.1381545, 0.138523, 0.1388915, 0.1392598, 0.1396281, 
-0.1399963, 0.1403644, 0.1407325, 0.1411004, 0.1414683, 0.1418361, 0.1422038, 0.1425714, 0.1429389, 0.1433064, 
-0.1436737, 0.144041, 0.1444082, 0.1447753, 0.1451423, 0.1455093, 0.1458761, 0.1462429, 0.1466096, 0.1469762, 
-0.1473427, 0.1477091, 0.1480754, 0.1484417, 0.1488079, 0.1491739, 0.1495399, 0.1499058, 0.1502716, 0.1506373, 
-0.151003, 0.1513685, 0.151734, 0.1520993, 0.1524646, 0.1528298, 0.1531949, 0.1535599, 0.1539248, 0.1542896, 
-0.1546544, 0.155019, 0.1553836, 0.155748, 0.1561124, 0.1564767, 0.1568409, 0.157205, 0.157569, 0.1579329, 
-0.1582967, 0.1586604, 0.159024, 0.1593876, 0.159751, 0.1601144, 0.1604776, 0.1608408, 0.1612038, 0.1615668, 
-0.1619297, 0.1622925, 0.1626551, 0.1630177, 0.1633802, 0.1637426, 0.1641049, 0.1644671, 0.1648292, 0.1651912, 
-0.1655532, 0.165915, 0.1662767, 0.1666383, 0.1669998, 0.1673612, 0.1677226, 0.1680838, 0.1684449, 0.168806, 
-0.1691669, 0.1695277, 0.1698884, 0.1702491, 0.1706096, 0.17097, 0.1713304, 0.1716906, 0.1720507, 0.1724107, 
-0.1727707, 0.1731305, 0.1734902, 0.1738498, 0.1742093, 0.1745688, 0.1749281, 0.1752873, 0.1756464, 0.1760054, 
-0.1763643, 0.1767231, 0.1770818, 0.1774403, 0.1777988, 0.1781572, 0.1785155, 0.1788736, 0.1792317, 0.1795897, 
-0.1799475, 0.1803053, 0.1806629, 0.1810204, 0.1813779, 0.1817352, 0.1820924, 0.1824495, 0.1828065, 0.1831634, 
-0.1835202, 0.1838768, 0.1842334, 0.1845899, 0.1849462, 0.1853025, 0.1856586, 0.1860146, 0.1863705, 0.1867263, 
-0.187082, 0.1874376, 0.1877931, 0.1881485, 0.1885037, 0.1888588, 0.1892139, 0.1895688, 0.1899236, 0.1902783, 
-0.1906329, 0.1909874, 0.1913417, 0.191696, 0.1920501, 0.1924041, 0.192758, 0.1931118, 0.1934655, 0.1938191, 
-0.1941725, 0.1945259, 0.1948791, 0.1952322, 0.1955852, 0.1959381, 0.1962908, 0.1966435, 0.196996, 0.1973484, 
-0.1977007, 0.1980529, 0.198405, 0.1987569, 0.1991088, 0.1994605, 0.1998121, 0.2001636, 0.2005149, 0.2008662, 
-0.2012173, 0.2015683, 0.2019192, 0.20227, 0.2026207, 0.2029712, 0.2033216, 0.2036719, 0.2040221, 0.2043721, 
-0.2047221, 0.2050719, 0.2054216, 0.2057712, 0.2061206, 0.2064699, 0.2068192, 0.2071682, 0.2075172, 0.2078661, 
-0.2082148, 0.2085634, 0.2089119, 0.2092602, 0.2096084, 0.2099566, 0.2103045, 0.2106524, 0.2110001, 0.2113477, 
-0.2116952, 0.2120426, 0.2123898, 0.212737, 0.2130839, 0.2134308, 0.2137775, 0.2141242, 0.2144706, 0.214817, 
-0.2151632, 0.2155093, 0.2158553, 0.2162012, 0.2165469, 0.2168925, 0.217238, 0.2175833, 0.2179285, 0.2182736, 
-0.2186186, 0.2189634, 0.2193081, 0.2196527, 0.2199971, 0.2203414, 0.2206856, 0.2210297, 0.2213736, 0.2217174, 
-0.2220611, 0.2224046, 0.222748, 0.2230913, 0.2234344, 0.2237774, 0.2241203, 0.2244631, 0.2248057, 0.2251481, 
-0.2254905, 0.2258327, 0.2261748, 0.2265167, 0.2268586, 0.2272002, 0.2275418, 0.2278832, 0.2282245, 0.2285656, 
-0.2289067, 0.2292475, 0.2295883, 0.2299289, 0.2302694, 0.2306097, 0.2309499, 0.23129, 0.2316299, 0.2319697, 
-0.2323093, 0.2326489, 0.2329882, 0.2333275, 0.2336666, 0.2340056, 0.2343444, 0.2346831, 0.2350217, 0.2353601, 
-0.2356984, 0.2360365, 0.2363745, 0.2367124, 0.2370501, 0.2373877, 0.2377251, 0.2380624, 0.2383996, 0.2387366, 
-0.2390735, 0.2394103, 0.2397469, 0.2400833, 0.2404197, 0.2407558, 0.2410919, 0.2414278, 0.2417635, 0.2420992, 
-0.2424346, 0.24277, 0.2431051, 0.2434402, 0.2437751, 0.2441098, 0.2444444, 0.2447789, 0.2451132, 0.2454474, 
-0.2457815, 0.2461153, 0.2464491, 0.2467827, 0.2471162, 0.2474495, 0.2477826, 0.2481157, 0.2484485, 0.2487813, 
-0.2491138, 0.2494463, 0.2497786, 0.2501107, 0.2504427, 0.2507745, 0.2511062, 0.2514378, 0.2517692, 0.2521004, 
-0.2524316, 0.2527625, 0.2530933, 0.253424, 0.2537545, 0.2540849, 0.2544151, 0.2547451, 0.255075, 0.2554048, 
-0.2557344, 0.2560639, 0.2563932, 0.2567224, 0.2570514, 0.2573802, 0.2577089, 0.2580375, 0.2583659, 0.2586942, 
-0.2590223, 0.2593502, 0.259678, 0.2600056, 0.2603331, 0.2606605, 0.2609876, 0.2613147, 0.2616416, 0.2619683, 
-0.2622948, 0.2626213, 0.2629475, 0.2632736, 0.2635996, 0.2639254, 0.264251, 0.2645765, 0.2649018, 0.265227, 
-0.265552, 0.2658769, 0.2662016, 0.2665261, 0.2668505, 0.2671747, 0.2674988, 0.2678227, 0.2681465, 0.2684701, 
-0.2687935, 0.2691168, 0.26944, 0.2697629, 0.2700857, 0.2704084, 0.2707309, 0.2710532, 0.2713754, 0.2716974, 
-0.2720193, 0.272341, 0.2726625, 0.2729839, 0.2733051, 0.2736261, 0.273947, 0.2742678, 0.2745883, 0.2749087, 
-0.275229, 0.2755491, 0.275869, 0.2761888, 0.2765084, 0.2768278, 0.2771471, 0.2774662, 0.2777851, 0.2781039, 
-0.2784225, 0.278741, 0.2790593, 0.2793774, 0.2796954, 0.2800132, 0.2803308, 0.2806483, 0.2809656, 0.2812827, 
-0.2815997, 0.2819165, 0.2822331, 0.2825496, 0.2828659, 0.283182, 0.283498, 0.2838138, 0.2841295, 0.284445, 
-0.2847603, 0.2850754, 0.2853904, 0.2857052, 0.2860198, 0.2863343, 0.2866486, 0.2869627, 0.2872767, 0.2875905, 
-0.2879041, 0.2882176, 0.2885308, 0.288844, 0.2891569, 0.2894697, 0.2897823, 0.2900947, 0.290407, 0.2907191, 
-0.291031, 0.2913427, 0.2916543, 0.2919657, 0.292277, 0.292588, 0.2928989, 0.2932096, 0.2935202, 0.2938306, 
-0.2941408, 0.2944508, 0.2947607, 0.2950703, 0.2953799, 0.2956892, 0.2959983, 0.2963073, 0.2966161, 0.2969248, 
-0.2972332, 0.2975415, 0.2978497, 0.2981576, 0.2984654, 0.2987729, 0.2990804, 0.2993876, 0.2996946, 0.3000015, 
-0.3003082, 0.3006148, 0.3009211, 0.3012273, 0.3015333, 0.3018391, 0.3021448, 0.3024502, 0.3027555, 0.3030606, 
-0.3033656, 0.3036703, 0.3039749, 0.3042793, 0.3045835, 0.3048875, 0.3051914, 0.3054951, 0.3057986, 0.3061019, 
-0.306405, 0.306708, 0.3070108, 0.3073134, 0.3076158, 0.307918, 0.3082201, 0.308522, 0.3088237, 0.3091252, 
-0.3094265, 0.3097276, 0.3100286, 0.3103294, 0.31063, 0.3109304, 0.3112306, 0.3115307, 0.3118306, 0.3121302, 
-0.3124297, 0.3127291, 0.3130282, 0.3133271, 0.3136259, 0.3139245, 0.3142229, 0.3145211, 0.3148191, 0.315117, 
-0.3154146, 0.3157121, 0.3160094, 0.3163065, 0.3166034, 0.3169001, 0.3171966, 0.317493, 0.3177892, 0.3180851, 
-0.3183809, 0.3186765, 0.318972, 0.3192672, 0.3195622, 0.3198571, 0.3201517, 0.3204462, 0.3207405, 0.3210346, 
-0.3213285, 0.3216222, 0.3219158, 0.3222091, 0.3225023, 0.3227952, 0.323088, 0.3233806, 0.323673, 0.3239652, 
-0.3242572, 0.324549, 0.3248407, 0.3251321, 0.3254233, 0.3257144, 0.3260053, 0.3262959, 0.3265864, 0.3268767, 
-0.3271668, 0.3274567, 0.3277464, 0.3280359, 0.3283253, 0.3286144, 0.3289033, 0.3291921, 0.3294806, 0.329769, 
-0.3300572, 0.3303451, 0.3306329, 0.3309205, 0.3312079, 0.3314951, 0.3317821, 0.3320689, 0.3323555, 0.3326419, 
-0.3329281, 0.3332141, 0.3335, 0.3337856, 0.334071, 0.3343563, 0.3346413, 0.3349261, 0.3352108, 0.3354952, 
-0.3357795, 0.3360635, 0.3363474, 0.336631, 0.3369145, 0.3371978, 0.3374808, 0.3377637, 0.3380464, 0.3383288, 
-0.3386111, 0.3388932, 0.339175, 0.3394567, 0.3397382, 0.3400194, 0.3403005, 0.3405814, 0.340862, 0.3411425, 
-0.3414228, 0.3417028, 0.3419827, 0.3422624, 0.3425418, 0.3428211, 0.3431002, 0.343379, 0.3436577, 0.3439361, 
-0.3442144, 0.3444924, 0.3447703, 0.3450479, 0.3453254, 0.3456026, 0.3458796, 0.3461565, 0.3464331, 0.3467095, 
-0.3469857, 0.3472617, 0.3475376, 0.3478132, 0.3480886, 0.3483638, 0.3486388, 0.3489135, 0.3491881, 0.3494625, 
-0.3497367, 0.3500106, 0.3502844, 0.350558, 0.3508313, 0.3511044, 0.3513774, 0.3516501, 0.3519226, 0.3521949, 
-0.352467, 0.3527389, 0.3530106, 0.3532821, 0.3535534, 0.3538245, 0.3540953, 0.354366, 0.3546364, 0.3549066, 
-0.3551767, 0.3554465, 0.3557161, 0.3559855, 0.3562547, 0.3565237, 0.3567924, 0.357061, 0.3573293, 0.3575975, 
-0.3578654, 0.3581331, 0.3584006, 0.3586679, 0.358935, 0.3592019, 0.3594686, 0.359735, 0.3600013, 0.3602673, 
-0.3605331, 0.3607987, 0.3610641, 0.3613293, 0.3615942, 0.361859, 0.3621235, 0.3623879, 0.362652, 0.3629159, 
-0.3631796, 0.3634431, 0.3637063, 0.3639694, 0.3642322, 0.3644948, 0.3647572, 0.3650194, 0.3652814, 0.3655431, 
-0.3658047, 0.366066, 0.3663271, 0.366588, 0.3668487, 0.3671092, 0.3673694, 0.3676295, 0.3678893, 0.3681489, 
-0.3684083, 0.3686675, 0.3689264, 0.3691851, 0.3694437, 0.369702, 0.36996, 0.3702179, 0.3704756, 0.370733, 
-0.3709902, 0.3712472, 0.371504, 0.3717605, 0.3720169, 0.372273, 0.3725289, 0.3727846, 0.37304, 0.3732953, 
-0.3735503, 0.3738051, 0.3740597, 0.3743141, 0.3745682, 0.3748221, 0.3750758, 0.3753293, 0.3755826, 0.3758356, 
-0.3760884, 0.376341, 0.3765934, 0.3768456, 0.3770975, 0.3773492, 0.3776007, 0.377852, 0.378103, 0.3783538, 
-0.3786044, 0.3788548, 0.379105, 0.3793549, 0.3796046, 0.3798541, 0.3801033, 0.3803524, 0.3806012, 0.3808498, 
-0.3810981, 0.3813463, 0.3815942, 0.3818419, 0.3820894, 0.3823366, 0.3825836, 0.3828304, 0.383077, 0.3833233, 
-0.3835695, 0.3838153, 0.384061, 0.3843065, 0.3845517, 0.3847967, 0.3850414, 0.385286, 0.3855303, 0.3857743, 
-0.3860182, 0.3862618, 0.3865052, 0.3867484, 0.3869913, 0.3872341, 0.3874766, 0.3877188, 0.3879608, 0.3882027, 
-0.3884442, 0.3886856, 0.3889267, 0.3891676, 0.3894083, 0.3896487, 0.3898889, 0.3901289, 0.3903686, 0.3906081, 
-0.3908474, 0.3910865, 0.3913253, 0.3915639, 0.3918023, 0.3920404, 0.3922783, 0.392516, 0.3927534, 0.3929906, 
-0.3932276, 0.3934644, 0.3937009, 0.3939372, 0.3941732, 0.394409, 0.3946446, 0.39488, 0.3951151, 0.39535, 
-0.3955847, 0.3958191, 0.3960533, 0.3962873, 0.396521, 0.3967545, 0.3969877, 0.3972208, 0.3974536, 0.3976861, 
-0.3979185, 0.3981505, 0.3983824, 0.398614, 0.3988454, 0.3990766, 0.3993075, 0.3995382, 0.3997686, 0.3999989, 
-0.4002288, 0.4004586, 0.4006881, 0.4009174, 0.4011464, 0.4013752, 0.4016038, 0.4018321, 0.4020602, 0.402288, 
-0.4025157, 0.402743, 0.4029702, 0.4031971, 0.4034238, 0.4036502, 0.4038764, 0.4041024, 0.4043281, 0.4045536, 
-0.4047788, 0.4050038, 0.4052286, 0.4054531, 0.4056774, 0.4059015, 0.4061253, 0.4063489, 0.4065722, 0.4067953, 
-0.4070182, 0.4072408, 0.4074632, 0.4076853, 0.4079072, 0.4081289, 0.4083503, 0.4085715, 0.4087924, 0.4090131, 
-0.4092336, 0.4094538, 0.4096738, 0.4098935, 0.410113, 0.4103322, 0.4105513, 0.41077, 0.4109886, 0.4112068, 
-0.4114249, 0.4116427, 0.4118603, 0.4120776, 0.4122947, 0.4125115, 0.4127281, 0.4129444, 0.4131605, 0.4133764, 
-0.413592, 0.4138074, 0.4140225, 0.4142374, 0.4144521, 0.4146665, 0.4148806, 0.4150945, 0.4153082, 0.4155216, 
-0.4157348, 0.4159477, 0.4161604, 0.4163729, 0.4165851, 0.416797, 0.4170088, 0.4172202, 0.4174314, 0.4176424, 
-0.4178531, 0.4180636, 0.4182739, 0.4184839, 0.4186936, 0.4189031, 0.4191124, 0.4193214, 0.4195301, 0.4197386, 
-0.4199469, 0.4201549, 0.4203627, 0.4205702, 0.4207775, 0.4209845, 0.4211913, 0.4213978, 0.4216041, 0.4218102, 
-0.4220159, 0.4222215, 0.4224268, 0.4226318, 0.4228366, 0.4230412, 0.4232455, 0.4234495, 0.4236533, 0.4238569, 
-0.4240602, 0.4242632, 0.424466, 0.4246686, 0.4248709, 0.4250729, 0.4252747, 0.4254763, 0.4256776, 0.4258786, 
-0.4260795, 0.42628, 0.4264803, 0.4266804, 0.4268802, 0.4270797, 0.427279, 0.427478, 0.4276768, 0.4278754, 
-0.4280737, 0.4282717, 0.4284695, 0.428667, 0.4288643, 0.4290613, 0.4292581, 0.4294546, 0.4296509, 0.4298469, 
-0.4300427, 0.4302382, 0.4304335, 0.4306285, 0.4308232, 0.4310177, 0.431212, 0.431406, 0.4315997, 0.4317932, 
-0.4319864, 0.4321794, 0.4323721, 0.4325646, 0.4327568, 0.4329488, 0.4331405, 0.4333319, 0.4335231, 0.4337141, 
-0.4339047, 0.4340952, 0.4342854, 0.4344753, 0.4346649, 0.4348543, 0.4350435, 0.4352324, 0.435421, 0.4356094, 
-0.4357975, 0.4359854, 0.436173, 0.4363604, 0.4365475, 0.4367343, 0.4369209, 0.4371073, 0.4372933, 0.4374791, 
-0.4376647, 0.43785, 0.438035, 0.4382198, 0.4384044, 0.4385886, 0.4387726, 0.4389564, 0.4391399, 0.4393231, 
-0.4395061, 0.4396888, 0.4398713, 0.4400535, 0.4402354, 0.4404171, 0.4405986, 0.4407797, 0.4409606, 0.4411413, 
-0.4413217, 0.4415018, 0.4416817, 0.4418613, 0.4420406, 0.4422197, 0.4423985, 0.4425771, 0.4427554, 0.4429335, 
-0.4431113, 0.4432888, 0.4434661, 0.4436431, 0.4438198, 0.4439963, 0.4441725, 0.4443485, 0.4445242, 0.4446996, 
-0.4448748, 0.4450497, 0.4452244, 0.4453988, 0.4455729, 0.4457467, 0.4459204, 0.4460937, 0.4462668, 0.4464396, 
-0.4466122, 0.4467844, 0.4469565, 0.4471282, 0.4472997, 0.447471, 0.447642, 0.4478127, 0.4479831, 0.4481533, 
-0.4483232, 0.4484929, 0.4486623, 0.4488314, 0.4490003, 0.4491689, 0.4493372, 0.4495053, 0.4496731, 0.4498407, 
-0.4500079, 0.450175, 0.4503417, 0.4505082, 0.4506744, 0.4508404, 0.4510061, 0.4511715, 0.4513367, 0.4515016, 
-0.4516662, 0.4518305, 0.4519946, 0.4521585, 0.452322, 0.4524853, 0.4526484, 0.4528111, 0.4529736, 0.4531359, 
-0.4532979, 0.4534596, 0.453621, 0.4537822, 0.4539431, 0.4541037, 0.4542641, 0.4544242, 0.454584, 0.4547436, 
-0.4549029, 0.4550619, 0.4552206, 0.4553791, 0.4555374, 0.4556953, 0.455853, 0.4560104, 0.4561676, 0.4563245, 
-0.4564811, 0.4566374, 0.4567935, 0.4569493, 0.4571049, 0.4572602, 0.4574152, 0.4575699, 0.4577244, 0.4578786, 
-0.4580325, 0.4581861, 0.4583395, 0.4584926, 0.4586455, 0.4587981, 0.4589504, 0.4591024, 0.4592542, 0.4594057, 
-0.4595569, 0.4597079, 0.4598586, 0.460009, 0.4601591, 0.460309, 0.4604586, 0.460608, 0.460757, 0.4609058, 
-0.4610543, 0.4612026, 0.4613506, 0.4614983, 0.4616457, 0.4617929, 0.4619398, 0.4620864, 0.4622327, 0.4623788, 
-0.4625246, 0.4626702, 0.4628154, 0.4629604, 0.4631051, 0.4632496, 0.4633937, 0.4635376, 0.4636813, 0.4638246, 
-0.4639677, 0.4641105, 0.464253, 0.4643953, 0.4645373, 0.464679, 0.4648204, 0.4649616, 0.4651025, 0.4652431, 
-0.4653835, 0.4655236, 0.4656634, 0.4658029, 0.4659421, 0.4660811, 0.4662198, 0.4663582, 0.4664964, 0.4666343, 
-0.4667719, 0.4669092, 0.4670463, 0.4671831, 0.4673196, 0.4674558, 0.4675918, 0.4677274, 0.4678628, 0.467998, 
-0.4681328, 0.4682674, 0.4684017, 0.4685358, 0.4686695, 0.468803, 0.4689362, 0.4690691, 0.4692018, 0.4693341, 
-0.4694662, 0.4695981, 0.4697296, 0.4698609, 0.4699919, 0.4701226, 0.470253, 0.4703832, 0.4705131, 0.4706427, 
-0.470772, 0.4709011, 0.4710299, 0.4711584, 0.4712866, 0.4714145, 0.4715422, 0.4716696, 0.4717967, 0.4719236, 
-0.4720501, 0.4721764, 0.4723024, 0.4724281, 0.4725536, 0.4726788, 0.4728037, 0.4729283, 0.4730526, 0.4731767, 
-0.4733005, 0.473424, 0.4735472, 0.4736701, 0.4737928, 0.4739152, 0.4740373, 0.4741591, 0.4742807, 0.4744019, 
-0.4745229, 0.4746437, 0.4747641, 0.4748842, 0.4750041, 0.4751237, 0.475243, 0.4753621, 0.4754808, 0.4755993, 
-0.4757175, 0.4758354, 0.4759531, 0.4760704, 0.4761875, 0.4763043, 0.4764208, 0.4765371, 0.476653, 0.4767687, 
-0.4768841, 0.4769992, 0.477114, 0.4772286, 0.4773429, 0.4774569, 0.4775706, 0.477684, 0.4777972, 0.47791, 
-0.4780226, 0.4781349, 0.478247, 0.4783587, 0.4784702, 0.4785813, 0.4786923, 0.4788029, 0.4789132, 0.4790233, 
-0.479133, 0.4792425, 0.4793517, 0.4794607, 0.4795693, 0.4796777, 0.4797858, 0.4798936, 0.4800011, 0.4801083, 
-0.4802153, 0.4803219, 0.4804283, 0.4805344, 0.4806402, 0.4807458, 0.480851, 0.480956, 0.4810607, 0.4811651, 
-0.4812692, 0.4813731, 0.4814766, 0.4815799, 0.4816829, 0.4817856, 0.481888, 0.4819902, 0.482092, 0.4821936, 
-0.4822949, 0.4823959, 0.4824966, 0.4825971, 0.4826972, 0.4827971, 0.4828967, 0.482996, 0.483095, 0.4831937, 
-0.4832922, 0.4833904, 0.4834882, 0.4835858, 0.4836831, 0.4837802, 0.4838769, 0.4839734, 0.4840696, 0.4841654, 
-0.484261, 0.4843564, 0.4844514, 0.4845462, 0.4846406, 0.4847348, 0.4848287, 0.4849223, 0.4850156, 0.4851087, 
-0.4852014, 0.4852939, 0.4853861, 0.485478, 0.4855696, 0.4856609, 0.4857519, 0.4858427, 0.4859332, 0.4860234, 
-0.4861132, 0.4862029, 0.4862922, 0.4863812, 0.48647, 0.4865584, 0.4866466, 0.4867345, 0.4868221, 0.4869094, 
-0.4869965, 0.4870832, 0.4871697, 0.4872559, 0.4873418, 0.4874274, 0.4875127, 0.4875977, 0.4876824, 0.4877669, 
-0.4878511, 0.4879349, 0.4880185, 0.4881018, 0.4881849, 0.4882676, 0.48835, 0.4884322, 0.4885141, 0.4885957, 
-0.488677, 0.488758, 0.4888387, 0.4889191, 0.4889993, 0.4890791, 0.4891587, 0.489238, 0.489317, 0.4893957, 
-0.4894741, 0.4895522, 0.4896301, 0.4897076, 0.4897849, 0.4898619, 0.4899386, 0.490015, 0.4900911, 0.4901669, 
-0.4902424, 0.4903177, 0.4903926, 0.4904673, 0.4905417, 0.4906158, 0.4906896, 0.4907631, 0.4908363, 0.4909093, 
-0.4909819, 0.4910543, 0.4911264, 0.4911982, 0.4912697, 0.4913409, 0.4914118, 0.4914824, 0.4915527, 0.4916228, 
-0.4916926, 0.491762, 0.4918312, 0.4919001, 0.4919687, 0.492037, 0.492105, 0.4921728, 0.4922402, 0.4923074, 
-0.4923743, 0.4924408, 0.4925071, 0.4925731, 0.4926388, 0.4927042, 0.4927694, 0.4928342, 0.4928988, 0.492963, 
-0.493027, 0.4930907, 0.493154, 0.4932171, 0.49328, 0.4933425, 0.4934047, 0.4934666, 0.4935283, 0.4935896, 
-0.4936507, 0.4937115, 0.493772, 0.4938322, 0.4938921, 0.4939517, 0.494011, 0.49407, 0.4941288, 0.4941872, 
-0.4942454, 0.4943033, 0.4943608, 0.4944181, 0.4944751, 0.4945318, 0.4945883, 0.4946444, 0.4947002, 0.4947558, 
-0.494811, 0.494866, 0.4949206, 0.494975, 0.4950291, 0.4950829, 0.4951364, 0.4951896, 0.4952425, 0.4952952, 
-0.4953475, 0.4953996, 0.4954513, 0.4955028, 0.495554, 0.4956048, 0.4956554, 0.4957057, 0.4957557, 0.4958055, 
-0.4958549, 0.495904, 0.4959529, 0.4960014, 0.4960497, 0.4960976, 0.4961453, 0.4961927, 0.4962398, 0.4962866, 
-0.4963331, 0.4963793, 0.4964252, 0.4964708, 0.4965162, 0.4965612, 0.496606, 0.4966504, 0.4966946, 0.4967385, 
-0.4967821, 0.4968254, 0.4968684, 0.4969111, 0.4969535, 0.4969956, 0.4970374, 0.497079, 0.4971202, 0.4971612, 
-0.4972018, 0.4972422, 0.4972823, 0.4973221, 0.4973616, 0.4974008, 0.4974397, 0.4974783, 0.4975166, 0.4975546, 
-0.4975924, 0.4976298, 0.497667, 0.4977038, 0.4977404, 0.4977766, 0.4978126, 0.4978483, 0.4978837, 0.4979188, 
-0.4979536, 0.4979881, 0.4980224, 0.4980563, 0.4980899, 0.4981233, 0.4981563, 0.4981891, 0.4982215, 0.4982537, 
-0.4982856, 0.4983172, 0.4983484, 0.4983794, 0.4984101, 0.4984406, 0.4984707, 0.4985005, 0.49853, 0.4985593, 
-0.4985882, 0.4986169, 0.4986452, 0.4986733, 0.4987011, 0.4987285, 0.4987557, 0.4987826, 0.4988092, 0.4988355, 
-0.4988615, 0.4988873, 0.4989127, 0.4989378, 0.4989626, 0.4989872, 0.4990114, 0.4990354, 0.4990591, 0.4990824, 
-0.4991055, 0.4991283, 0.4991508, 0.499173, 0.4991949, 0.4992165, 0.4992378, 0.4992588, 0.4992795, 0.4993, 
-0.4993201, 0.49934, 0.4993595, 0.4993788, 0.4993977, 0.4994164, 0.4994348, 0.4994529, 0.4994706, 0.4994881, 
-0.4995053, 0.4995223, 0.4995389, 0.4995552, 0.4995712, 0.4995869, 0.4996024, 0.4996175, 0.4996324, 0.4996469, 
-0.4996612, 0.4996752, 0.4996888, 0.4997022, 0.4997153, 0.4997281, 0.4997406, 0.4997528, 0.4997647, 0.4997763, 
-0.4997876, 0.4997987, 0.4998094, 0.4998199, 0.49983, 0.4998399, 0.4998494, 0.4998587, 0.4998676, 0.4998763, 
-0.4998847, 0.4998928, 0.4999006, 0.4999081, 0.4999153, 0.4999222, 0.4999288, 0.4999351, 0.4999412, 0.4999469, 
-0.4999524, 0.4999575, 0.4999624, 0.4999669, 0.4999712, 0.4999751, 0.4999788, 0.4999822, 0.4999853, 0.4999881, 
-0.4999906, 0.4999928, 0.4999947, 0.4999963, 0.4999976, 0.4999987, 0.4999994, 0.4999999, 0.5, 0.4999999, 
-0.4999994, 0.4999987, 0.4999976, 0.4999963, 0.4999947, 0.4999928, 0.4999906, 0.4999881, 0.4999853, 0.4999822, 
-0.4999788, 0.4999751, 0.4999712, 0.4999669, 0.4999624, 0.4999575, 0.4999524, 0.4999469, 0.4999412, 0.4999351, 
-0.4999288, 0.4999222, 0.4999153, 0.4999081, 0.4999006, 0.4998928, 0.4998847, 0.4998763, 0.4998676, 0.4998587, 
-0.4998494, 0.4998399, 0.49983, 0.4998199, 0.4998094, 0.4997987, 0.4997876, 0.4997763, 0.4997647, 0.4997528, 
-0.4997406, 0.4997281, 0.4997153, 0.4997022, 0.4996888, 0.4996752, 0.4996612, 0.4996469, 0.4996324, 0.4996175, 
-0.4996024, 0.4995869, 0.4995712, 0.4995552, 0.4995389, 0.4995223, 0.4995053, 0.4994881, 0.4994706, 0.4994529, 
-0.4994348, 0.4994164, 0.4993977, 0.4993788, 0.4993595, 0.49934, 0.4993201, 0.4993, 0.4992795, 0.4992588, 
-0.4992378, 0.4992165, 0.4991949, 0.499173, 0.4991508, 0.4991283, 0.4991055, 0.4990824, 0.4990591, 0.4990354, 
-0.4990114, 0.4989872, 0.4989626, 0.4989378, 0.4989127, 0.4988873, 0.4988615, 0.4988355, 0.4988092, 0.4987826, 
-0.4987557, 0.4987285, 0.4987011, 0.4986733, 0.4986452, 0.4986169, 0.4985882, 0.4985593, 0.49853, 0.4985005, 
-0.4984707, 0.4984406, 0.4984101, 0.4983794, 0.4983484, 0.4983172, 0.4982856, 0.4982537, 0.4982215, 0.4981891, 
-0.4981563, 0.4981233, 0.4980899, 0.4980563, 0.4980224, 0.4979881, 0.4979536, 0.4979188, 0.4978837, 0.4978483, 
-0.4978126, 0.4977766, 0.4977404, 0.4977038, 0.497667, 0.4976298, 0.4975924, 0.4975546, 0.4975166, 0.4974783, 
-0.4974397, 0.4974008, 0.4973616, 0.4973221, 0.4972823, 0.4972422, 0.4972018, 0.4971612, 0.4971202, 0.497079, 
-0.4970374, 0.4969956, 0.4969535, 0.4969111, 0.4968684, 0.4968254, 0.4967821, 0.4967385, 0.4966946, 0.4966504, 
-0.496606, 0.4965612, 0.4965162, 0.4964708, 0.4964252, 0.4963793, 0.4963331, 0.4962866, 0.4962398, 0.4961927, 
-0.4961453, 0.4960976, 0.4960497, 0.4960014, 0.4959529, 0.495904, 0.4958549, 0.4958055, 0.4957557, 0.4957057, 
-0.4956554, 0.4956048, 0.495554, 0.4955028, 0.4954513, 0.4953996, 0.4953475, 0.4952952, 0.4952425, 0.4951896, 
-0.4951364, 0.4950829, 0.4950291, 0.494975, 0.4949206, 0.494866, 0.494811, 0.4947558, 0.4947002, 0.4946444, 
-0.4945883, 0.4945318, 0.4944751, 0.4944181, 0.4943608, 0.4943033, 0.4942454, 0.4941872, 0.4941288, 0.49407, 
-0.494011, 0.4939517, 0.4938921, 0.4938322, 0.493772, 0.4937115, 0.4936507, 0.4935896, 0.4935283, 0.4934666, 
-0.4934047, 0.4933425, 0.49328, 0.4932171, 0.493154, 0.4930907, 0.493027, 0.492963, 0.4928988, 0.4928342, 
-0.4927694, 0.4927042, 0.4926388, 0.4925731, 0.4925071, 0.4924408, 0.4923743, 0.4923074, 0.4922402, 0.4921728, 
-0.492105, 0.492037, 0.4919687, 0.4919001, 0.4918312, 0.491762, 0.4916926, 0.4916228, 0.4915527, 0.4914824, 
-0.4914118, 0.4913409, 0.4912697, 0.4911982, 0.4911264, 0.4910543, 0.4909819, 0.4909093, 0.4908363, 0.4907631, 
-0.4906896, 0.4906158, 0.4905417, 0.4904673, 0.4903926, 0.4903177, 0.4902424, 0.4901669, 0.4900911, 0.490015, 
-0.4899386, 0.4898619, 0.4897849, 0.4897076, 0.4896301, 0.4895522, 0.4894741, 0.4893957, 0.489317, 0.489238, 
-0.4891587, 0.4890791, 0.4889993, 0.4889191, 0.4888387, 0.488758, 0.488677, 0.4885957, 0.4885141, 0.4884322, 
-0.48835, 0.4882676, 0.4881849, 0.4881018, 0.4880185, 0.4879349, 0.4878511, 0.4877669, 0.4876824, 0.4875977, 
-0.4875127, 0.4874274, 0.4873418, 0.4872559, 0.4871697, 0.4870832, 0.4869965, 0.4869094, 0.4868221, 0.4867345, 
-0.4866466, 0.4865584, 0.48647, 0.4863812, 0.4862922, 0.4862029, 0.4861132, 0.4860234, 0.4859332, 0.4858427, 
-0.4857519, 0.4856609, 0.4855696, 0.485478, 0.4853861, 0.4852939, 0.4852014, 0.4851087, 0.4850156, 0.4849223, 
-0.4848287, 0.4847348, 0.4846406, 0.4845462, 0.4844514, 0.4843564, 0.484261, 0.4841654, 0.4840696, 0.4839734, 
-0.4838769, 0.4837802, 0.4836831, 0.4835858, 0.4834882, 0.4833904, 0.4832922, 0.4831937, 0.483095, 0.482996, 
-0.4828967, 0.4827971, 0.4826972, 0.4825971, 0.4824966, 0.4823959, 0.4822949, 0.4821936, 0.482092, 0.4819902, 
-0.481888, 0.4817856, 0.4816829, 0.4815799, 0.4814766, 0.4813731, 0.4812692, 0.4811651, 0.4810607, 0.480956, 
-0.480851, 0.4807458, 0.4806402, 0.4805344, 0.4804283, 0.4803219, 0.4802153, 0.4801083, 0.4800011, 0.4798936, 
-0.4797858, 0.4796777, 0.4795693, 0.4794607, 0.4793517, 0.4792425, 0.479133, 0.4790233, 0.4789132, 0.4788029, 
-0.4786923, 0.4785813, 0.4784702, 0.4783587, 0.478247, 0.4781349, 0.4780226, 0.47791, 0.4777972, 0.477684, 
-0.4775706, 0.4774569, 0.4773429, 0.4772286, 0.477114, 0.4769992, 0.4768841, 0.4767687, 0.476653, 0.4765371, 
-0.4764208, 0.4763043, 0.4761875, 0.4760704, 0.4759531, 0.4758354, 0.4757175, 0.4755993, 0.4754808, 0.4753621, 
-0.475243, 0.4751237, 0.4750041, 0.4748842, 0.4747641, 0.4746437, 0.4745229, 0.4744019, 0.4742807, 0.4741591, 
-0.4740373, 0.4739152, 0.4737928, 0.4736701, 0.4735472, 0.473424, 0.4733005, 0.4731767, 0.4730526, 0.4729283, 
-0.4728037, 0.4726788, 0.4725536, 0.4724281, 0.4723024, 0.4721764, 0.4720501, 0.4719236, 0.4717967, 0.4716696, 
-0.4715422, 0.4714145, 0.4712866, 0.4711584, 0.4710299, 0.4709011, 0.470772, 0.4706427, 0.4705131, 0.4703832, 
-0.470253, 0.4701226, 0.4699919, 0.4698609, 0.4697296, 0.4695981, 0.4694662, 0.4693341, 0.4692018, 0.4690691, 
-0.4689362, 0.468803, 0.4686695, 0.4685358, 0.4684017, 0.4682674, 0.4681328, 0.467998, 0.4678628, 0.4677274, 
-0.4675918, 0.4674558, 0.4673196, 0.4671831, 0.4670463, 0.4669092, 0.4667719, 0.4666343, 0.4664964, 0.4663582, 
-0.4662198, 0.4660811, 0.4659421, 0.4658029, 0.4656634, 0.4655236, 0.4653835, 0.4652431, 0.4651025, 0.4649616, 
-0.4648204, 0.464679, 0.4645373, 0.4643953, 0.464253, 0.4641105, 0.4639677, 0.4638246, 0.4636813, 0.4635376, 
-0.4633937, 0.4632496, 0.4631051, 0.4629604, 0.4628154, 0.4626702, 0.4625246, 0.4623788, 0.4622327, 0.4620864, 
-0.4619398, 0.4617929, 0.4616457, 0.4614983, 0.4613506, 0.4612026, 0.4610543, 0.4609058, 0.460757, 0.460608, 
-0.4604586, 0.460309, 0.4601591, 0.460009, 0.4598586, 0.4597079, 0.4595569, 0.4594057, 0.4592542, 0.4591024, 
-0.4589504, 0.4587981, 0.4586455, 0.4584926, 0.4583395, 0.4581861, 0.4580325, 0.4578786, 0.4577244, 0.4575699, 
-0.4574152, 0.4572602, 0.4571049, 0.4569493, 0.4567935, 0.4566374, 0.4564811, 0.4563245, 0.4561676, 0.4560104, 
-0.455853, 0.4556953, 0.4555374, 0.4553791, 0.4552206, 0.4550619, 0.4549029, 0.4547436, 0.454584, 0.4544242, 
-0.4542641, 0.4541037, 0.4539431, 0.4537822, 0.453621, 0.4534596, 0.4532979, 0.4531359, 0.4529736, 0.4528111, 
-0.4526484, 0.4524853, 0.452322, 0.4521585, 0.4519946, 0.4518305, 0.4516662, 0.4515016, 0.4513367, 0.4511715, 
-0.4510061, 0.4508404, 0.4506744, 0.4505082, 0.4503417, 0.450175, 0.4500079, 0.4498407, 0.4496731, 0.4495053, 
-0.4493372, 0.4491689, 0.4490003, 0.4488314, 0.4486623, 0.4484929, 0.4483232, 0.4481533, 0.4479831, 0.4478127, 
-0.447642, 0.447471, 0.4472997, 0.4471282, 0.4469565, 0.4467844, 0.4466122, 0.4464396, 0.4462668, 0.4460937, 
-0.4459204, 0.4457467, 0.4455729, 0.4453988, 0.4452244, 0.4450497, 0.4448748, 0.4446996, 0.4445242, 0.4443485, 
-0.4441725, 0.4439963, 0.4438198, 0.4436431, 0.4434661, 0.4432888, 0.4431113, 0.4429335, 0.4427554, 0.4425771, 
-0.4423985, 0.4422197, 0.4420406, 0.4418613, 0.4416817, 0.4415018, 0.4413217, 0.4411413, 0.4409606, 0.4407797, 
-0.4405986, 0.4404171, 0.4402354, 0.4400535, 0.4398713, 0.4396888, 0.4395061, 0.4393231, 0.4391399, 0.4389564, 
-0.4387726, 0.4385886, 0.4384044, 0.4382198, 0.438035, 0.43785, 0.4376647, 0.4374791, 0.4372933, 0.4371073, 
-0.4369209, 0.4367343, 0.4365475, 0.4363604, 0.436173, 0.4359854, 0.4357975, 0.4356094, 0.435421, 0.4352324, 
-0.4350435, 0.4348543, 0.4346649, 0.4344753, 0.4342854, 0.4340952, 0.4339047, 0.4337141, 0.4335231, 0.4333319, 
-0.4331405, 0.4329488, 0.4327568, 0.4325646, 0.4323721, 0.4321794, 0.4319864, 0.4317932, 0.4315997, 0.431406, 
-0.431212, 0.4310177, 0.4308232, 0.4306285, 0.4304335, 0.4302382, 0.4300427, 0.4298469, 0.4296509, 0.4294546, 
-0.4292581, 0.4290613, 0.4288643, 0.428667, 0.4284695, 0.4282717, 0.4280737, 0.4278754, 0.4276768, 0.427478, 
-0.427279, 0.4270797, 0.4268802, 0.4266804, 0.4264803, 0.42628, 0.4260795, 0.4258786, 0.4256776, 0.4254763, 
-0.4252747, 0.4250729, 0.4248709, 0.4246686, 0.424466, 0.4242632, 0.4240602, 0.4238569, 0.4236533, 0.4234495, 
-0.4232455, 0.4230412, 0.4228366, 0.4226318, 0.4224268, 0.4222215, 0.4220159, 0.4218102, 0.4216041, 0.4213978, 
-0.4211913, 0.4209845, 0.4207775, 0.4205702, 0.4203627, 0.4201549, 0.4199469, 0.4197386, 0.4195301, 0.4193214, 
-0.4191124, 0.4189031, 0.4186936, 0.4184839, 0.4182739, 0.4180636, 0.4178531, 0.4176424, 0.4174314, 0.4172202, 
-0.4170088, 0.416797, 0.4165851, 0.4163729, 0.4161604, 0.4159477, 0.4157348, 0.4155216, 0.4153082, 0.4150945, 
-0.4148806, 0.4146665, 0.4144521, 0.4142374, 0.4140225, 0.4138074, 0.413592, 0.4133764, 0.4131605, 0.4129444, 
-0.4127281, 0.4125115, 0.4122947, 0.4120776, 0.4118603, 0.4116427, 0.4114249, 0.4112068, 0.4109886, 0.41077, 
-0.4105513, 0.4103322, 0.410113, 0.4098935, 0.4096738, 0.4094538, 0.4092336, 0.4090131, 0.4087924, 0.4085715, 
-0.4083503, 0.4081289, 0.4079072, 0.4076853, 0.4074632, 0.4072408, 0.4070182, 0.4067953, 0.4065722, 0.4063489, 
-0.4061253, 0.4059015, 0.4056774, 0.4054531, 0.4052286, 0.4050038, 0.4047788, 0.4045536, 0.4043281, 0.4041024, 
-0.4038764, 0.4036502, 0.4034238, 0.4031971, 0.4029702, 0.402743, 0.4025157, 0.402288, 0.4020602, 0.4018321, 
-0.4016038, 0.4013752, 0.4011464, 0.4009174, 0.4006881, 0.4004586, 0.4002288, 0.3999989, 0.3997686, 0.3995382, 
-0.3993075, 0.3990766, 0.3988454, 0.398614, 0.3983824, 0.3981505, 0.3979185, 0.3976861, 0.3974536, 0.3972208, 
-0.3969877, 0.3967545, 0.396521, 0.3962873, 0.3960533, 0.3958191, 0.3955847, 0.39535, 0.3951151, 0.39488, 
-0.3946446, 0.394409, 0.3941732, 0.3939372, 0.3937009, 0.3934644, 0.3932276, 0.3929906, 0.3927534, 0.392516, 
-0.3922783, 0.3920404, 0.3918023, 0.3915639, 0.3913253, 0.3910865, 0.3908474, 0.3906081, 0.3903686, 0.3901289, 
-0.3898889, 0.3896487, 0.3894083, 0.3891676, 0.3889267, 0.3886856, 0.3884442, 0.3882027, 0.3879608, 0.3877188, 
-0.3874766, 0.3872341, 0.3869913, 0.3867484, 0.3865052, 0.3862618, 0.3860182, 0.3857743, 0.3855303, 0.385286, 
-0.3850414, 0.3847967, 0.3845517, 0.3843065, 0.384061, 0.3838153, 0.3835695, 0.3833233, 0.383077, 0.3828304, 
-0.3825836, 0.3823366, 0.3820894, 0.3818419, 0.3815942, 0.3813463, 0.3810981, 0.3808498, 0.3806012, 0.3803524, 
-0.3801033, 0.3798541, 0.3796046, 0.3793549, 0.379105, 0.3788548, 0.3786044, 0.3783538, 0.378103, 0.377852, 
-0.3776007, 0.3773492, 0.3770975, 0.3768456, 0.3765934, 0.376341, 0.3760884, 0.3758356, 0.3755826, 0.3753293, 
-0.3750758, 0.3748221, 0.3745682, 0.3743141, 0.3740597, 0.3738051, 0.3735503, 0.3732953, 0.37304, 0.3727846, 
-0.3725289, 0.372273, 0.3720169, 0.3717605, 0.371504, 0.3712472, 0.3709902, 0.370733, 0.3704756, 0.3702179, 
-0.36996, 0.369702, 0.3694437, 0.3691851, 0.3689264, 0.3686675, 0.3684083, 0.3681489, 0.3678893, 0.3676295, 
-0.3673694, 0.3671092, 0.3668487, 0.366588, 0.3663271, 0.366066, 0.3658047, 0.3655431, 0.3652814, 0.3650194, 
-0.3647572, 0.3644948, 0.3642322, 0.3639694, 0.3637063, 0.3634431, 0.3631796, 0.3629159, 0.362652, 0.3623879, 
-0.3621235, 0.361859, 0.3615942, 0.3613293, 0.3610641, 0.3607987, 0.3605331, 0.3602673, 0.3600013, 0.359735, 
-0.3594686, 0.3592019, 0.358935, 0.3586679, 0.3584006, 0.3581331, 0.3578654, 0.3575975, 0.3573293, 0.357061, 
-0.3567924, 0.3565237, 0.3562547, 0.3559855, 0.3557161, 0.3554465, 0.3551767, 0.3549066, 0.3546364, 0.354366, 
-0.3540953, 0.3538245, 0.3535534, 0.3532821, 0.3530106, 0.3527389, 0.352467, 0.3521949, 0.3519226, 0.3516501, 
-0.3513774, 0.3511044, 0.3508313, 0.350558, 0.3502844, 0.3500106, 0.3497367, 0.3494625, 0.3491881, 0.3489135, 
-0.3486388, 0.3483638, 0.3480886, 0.3478132, 0.3475376, 0.3472617, 0.3469857, 0.3467095, 0.3464331, 0.3461565, 
-0.3458796, 0.3456026, 0.3453254, 0.3450479, 0.3447703, 0.3444924, 0.3442144, 0.3439361, 0.3436577, 0.343379, 
-0.3431002, 0.3428211, 0.3425418, 0.3422624, 0.3419827, 0.3417028, 0.3414228, 0.3411425, 0.340862, 0.3405814, 
-0.3403005, 0.3400194, 0.3397382, 0.3394567, 0.339175, 0.3388932, 0.3386111, 0.3383288, 0.3380464, 0.3377637, 
-0.3374808, 0.3371978, 0.3369145, 0.336631, 0.3363474, 0.3360635, 0.3357795, 0.3354952, 0.3352108, 0.3349261, 
-0.3346413, 0.3343563, 0.334071, 0.3337856, 0.3335, 0.3332141, 0.3329281, 0.3326419, 0.3323555, 0.3320689, 
-0.3317821, 0.3314951, 0.3312079, 0.3309205, 0.3306329, 0.3303451, 0.3300572, 0.329769, 0.3294806, 0.3291921, 
-0.3289033, 0.3286144, 0.3283253, 0.3280359, 0.3277464, 0.3274567, 0.3271668, 0.3268767, 0.3265864, 0.3262959, 
-0.3260053, 0.3257144, 0.3254233, 0.3251321, 0.3248407, 0.324549, 0.3242572, 0.3239652, 0.323673, 0.3233806, 
-0.323088, 0.3227952, 0.3225023, 0.3222091, 0.3219158, 0.3216222, 0.3213285, 0.3210346, 0.3207405, 0.3204462, 
-0.3201517, 0.3198571, 0.3195622, 0.3192672, 0.318972, 0.3186765, 0.3183809, 0.3180851, 0.3177892, 0.317493, 
-0.3171966, 0.3169001, 0.3166034, 0.3163065, 0.3160094, 0.3157121, 0.3154146, 0.315117, 0.3148191, 0.3145211, 
-0.3142229, 0.3139245, 0.3136259, 0.3133271, 0.3130282, 0.3127291, 0.3124297, 0.3121302, 0.3118306, 0.3115307, 
-0.3112306, 0.3109304, 0.31063, 0.3103294, 0.3100286, 0.3097276, 0.3094265, 0.3091252, 0.3088237, 0.308522, 
-0.3082201, 0.307918, 0.3076158, 0.3073134, 0.3070108, 0.306708, 0.306405, 0.3061019, 0.3057986, 0.3054951, 
-0.3051914, 0.3048875, 0.3045835, 0.3042793, 0.3039749, 0.3036703, 0.3033656, 0.3030606, 0.3027555, 0.3024502, 
-0.3021448, 0.3018391, 0.3015333, 0.3012273, 0.3009211, 0.3006148, 0.3003082, 0.3000015, 0.2996946, 0.2993876, 
-0.2990804, 0.2987729, 0.2984654, 0.2981576, 0.2978497, 0.2975415, 0.2972332, 0.2969248, 0.2966161, 0.2963073, 
-0.2959983, 0.2956892, 0.2953799, 0.2950703, 0.2947607, 0.2944508, 0.2941408, 0.2938306, 0.2935202, 0.2932096, 
-0.2928989, 0.292588, 0.292277, 0.2919657, 0.2916543, 0.2913427, 0.291031, 0.2907191, 0.290407, 0.2900947, 
-0.2897823, 0.2894697, 0.2891569, 0.288844, 0.2885308, 0.2882176, 0.2879041, 0.2875905, 0.2872767, 0.2869627, 
-0.2866486, 0.2863343, 0.2860198, 0.2857052, 0.2853904, 0.2850754, 0.2847603, 0.284445, 0.2841295, 0.2838138, 
-0.283498, 0.283182, 0.2828659, 0.2825496, 0.2822331, 0.2819165, 0.2815997, 0.2812827, 0.2809656, 0.2806483, 
-0.2803308, 0.2800132, 0.2796954, 0.2793774, 0.2790593, 0.278741, 0.2784225, 0.2781039, 0.2777851, 0.2774662, 
-0.2771471, 0.2768278, 0.2765084, 0.2761888, 0.275869, 0.2755491, 0.275229, 0.2749087, 0.2745883, 0.2742678, 
-0.273947, 0.2736261, 0.2733051, 0.2729839, 0.2726625, 0.272341, 0.2720193, 0.2716974, 0.2713754, 0.2710532, 
-0.2707309, 0.2704084, 0.2700857, 0.2697629, 0.26944, 0.2691168, 0.2687935, 0.2684701, 0.2681465, 0.2678227, 
-0.2674988, 0.2671747, 0.2668505, 0.2665261, 0.2662016, 0.2658769, 0.265552, 0.265227, 0.2649018, 0.2645765, 
-0.264251, 0.2639254, 0.2635996, 0.2632736, 0.2629475, 0.2626213, 0.2622948, 0.2619683, 0.2616416, 0.2613147, 
-0.2609876, 0.2606605, 0.2603331, 0.2600056, 0.259678, 0.2593502, 0.2590223, 0.2586942, 0.2583659, 0.2580375, 
-0.2577089, 0.2573802, 0.2570514, 0.2567224, 0.2563932, 0.2560639, 0.2557344, 0.2554048, 0.255075, 0.2547451, 
-0.2544151, 0.2540849, 0.2537545, 0.253424, 0.2530933, 0.2527625, 0.2524316, 0.2521004, 0.2517692, 0.2514378, 
-0.2511062, 0.2507745, 0.2504427, 0.2501107, 0.2497786, 0.2494463, 0.2491138, 0.2487813, 0.2484485, 0.2481157, 
-0.2477826, 0.2474495, 0.2471162, 0.2467827, 0.2464491, 0.2461153, 0.2457815, 0.2454474, 0.2451132, 0.2447789, 
-0.2444444, 0.2441098, 0.2437751, 0.2434402, 0.2431051, 0.24277, 0.2424346, 0.2420992, 0.2417635, 0.2414278, 
-0.2410919, 0.2407558, 0.2404197, 0.2400833, 0.2397469, 0.2394103, 0.2390735, 0.2387366, 0.2383996, 0.2380624, 
-0.2377251, 0.2373877, 0.2370501, 0.2367124, 0.2363745, 0.2360365, 0.2356984, 0.2353601, 0.2350217, 0.2346831, 
-0.2343444, 0.2340056, 0.2336666, 0.2333275, 0.2329882, 0.2326489, 0.2323093, 0.2319697, 0.2316299, 0.23129, 
-0.2309499, 0.2306097, 0.2302694, 0.2299289, 0.2295883, 0.2292475, 0.2289067, 0.2285656, 0.2282245, 0.2278832, 
-0.2275418, 0.2272002, 0.2268586, 0.2265167, 0.2261748, 0.2258327, 0.2254905, 0.2251481, 0.2248057, 0.2244631, 
-0.2241203, 0.2237774, 0.2234344, 0.2230913, 0.222748, 0.2224046, 0.2220611, 0.2217174, 0.2213736, 0.2210297, 
-0.2206856, 0.2203414, 0.2199971, 0.2196527, 0.2193081, 0.2189634, 0.2186186, 0.2182736, 0.2179285, 0.2175833, 
-0.217238, 0.2168925, 0.2165469, 0.2162012, 0.2158553, 0.2155093, 0.2151632, 0.214817, 0.2144706, 0.2141242, 
-0.2137775, 0.2134308, 0.2130839, 0.212737, 0.2123898, 0.2120426, 0.2116952, 0.2113477, 0.2110001, 0.2106524, 
-0.2103045, 0.2099566, 0.2096084, 0.2092602, 0.2089119, 0.2085634, 0.2082148, 0.2078661, 0.2075172, 0.2071682, 
-0.2068192, 0.2064699, 0.2061206, 0.2057712, 0.2054216, 0.2050719, 0.2047221, 0.2043721, 0.2040221, 0.2036719, 
-0.2033216, 0.2029712, 0.2026207, 0.20227, 0.2019192, 0.2015683, 0.2012173, 0.2008662, 0.2005149, 0.2001636, 
-0.1998121, 0.1994605, 0.1991088, 0.1987569, 0.198405, 0.1980529, 0.1977007, 0.1973484, 0.196996, 0.1966435, 
-0.1962908, 0.1959381, 0.1955852, 0.1952322, 0.1948791, 0.1945259, 0.1941725, 0.1938191, 0.1934655, 0.1931118, 
-0.192758, 0.1924041, 0.1920501, 0.191696, 0.1913417, 0.1909874, 0.1906329, 0.1902783, 0.1899236, 0.1895688, 
-0.1892139, 0.1888588, 0.1885037, 0.1881485, 0.1877931, 0.1874376, 0.187082, 0.1867263, 0.1863705, 0.1860146, 
-0.1856586, 0.1853025, 0.1849462, 0.1845899, 0.1842334, 0.1838768, 0.1835202, 0.1831634, 0.1828065, 0.1824495, 
-0.1820924, 0.1817352, 0.1813779, 0.1810204, 0.1806629, 0.1803053, 0.1799475, 0.1795897, 0.1792317, 0.1788736, 
-0.1785155, 0.1781572, 0.1777988, 0.1774403, 0.1770818, 0.1767231, 0.1763643, 0.1760054, 0.1756464, 0.1752873, 
-0.1749281, 0.1745688, 0.1742093, 0.1738498, 0.1734902, 0.1731305, 0.1727707, 0.1724107, 0.1720507, 0.1716906, 
-0.1713304, 0.17097, 0.1706096, 0.1702491, 0.1698884, 0.1695277, 0.1691669, 0.168806, 0.1684449, 0.1680838, 
-0.1677226, 0.1673612, 0.1669998, 0.1666383, 0.1662767, 0.165915, 0.1655532, 0.1651912, 0.1648292, 0.1644671, 
-0.1641049, 0.1637426, 0.1633802, 0.1630177, 0.1626551, 0.1622925, 0.1619297, 0.1615668, 0.1612038, 0.1608408, 
-0.1604776, 0.1601144, 0.159751, 0.1593876, 0.159024, 0.1586604, 0.1582967, 0.1579329, 0.157569, 0.157205, 
-0.1568409, 0.1564767, 0.1561124, 0.155748, 0.1553836, 0.155019, 0.1546544, 0.1542896, 0.1539248, 0.1535599, 
-0.1531949, 0.1528298, 0.1524646, 0.1520993, 0.151734, 0.1513685, 0.151003, 0.1506373, 0.1502716, 0.1499058, 
-0.1495399, 0.1491739, 0.1488079, 0.1484417, 0.1480754, 0.1477091, 0.1473427, 0.1469762, 0.1466096, 0.1462429, 
-0.1458761, 0.1455093, 0.1451423, 0.1447753, 0.1444082, 0.144041, 0.1436737, 0.1433064, 0.1429389, 0.1425714, 
-0.1422038, 0.1418361, 0.1414683, 0.1411004, 0.1407325, 0.1403644, 0.1399963, 0.1396281, 0.1392598, 0.1388915, 
-0.138523, 0.1381545, 0.1377859, 0.1374172, 0.1370485, 0.1366796, 0.1363107, 0.1359417, 0.1355726, 0.1352034, 
-0.1348342, 0.1344648, 0.1340954, 0.1337259, 0.1333564, 0.1329867, 0.132617, 0.1322472, 0.1318773, 0.1315074, 
-0.1311374, 0.1307672, 0.1303971, 0.1300268, 0.1296565, 0.129286, 0.1289156, 0.128545, 0.1281743, 0.1278036, 
-0.1274328, 0.127062, 0.126691, 0.12632, 0.1259489, 0.1255777, 0.1252065, 0.1248352, 0.1244638, 0.1240923, 
-0.1237208, 0.1233492, 0.1229775, 0.1226058, 0.122234, 0.1218621, 0.1214901, 0.1211181, 0.1207459, 0.1203738, 
-0.1200015, 0.1196292, 0.1192568, 0.1188843, 0.1185118, 0.1181392, 0.1177665, 0.1173938, 0.117021, 0.1166481, 
-0.1162752, 0.1159021, 0.1155291, 0.1151559, 0.1147827, 0.1144094, 0.114036, 0.1136626, 0.1132891, 0.1129156, 
-0.112542, 0.1121683, 0.1117945, 0.1114207, 0.1110468, 0.1106729, 0.1102988, 0.1099248, 0.1095506, 0.1091764, 
-0.1088021, 0.1084278, 0.1080534, 0.1076789, 0.1073044, 0.1069298, 0.1065552, 0.1061804, 0.1058057, 0.1054308, 
-0.1050559, 0.104681, 0.1043059, 0.1039308, 0.1035557, 0.1031805, 0.1028052, 0.1024299, 0.1020545, 0.101679, 
-0.1013035, 0.1009279, 0.1005523, 0.1001766, 0.0998009, 0.0994251, 0.0990492, 0.0986733, 0.0982973, 0.0979213, 
-0.0975452, 0.097169, 0.0967928, 0.0964165, 0.0960402, 0.0956638, 0.0952874, 0.0949109, 0.0945343, 0.0941577, 
-0.0937811, 0.0934043, 0.0930276, 0.0926507, 0.0922739, 0.0918969, 0.0915199, 0.0911429, 0.0907658, 0.0903887, 
-0.0900115, 0.0896342, 0.0892569, 0.0888795, 0.0885021, 0.0881246, 0.0877471, 0.0873696, 0.0869919, 0.0866143, 
-0.0862365, 0.0858588, 0.0854809, 0.0851031, 0.0847251, 0.0843472, 0.0839691, 0.0835911, 0.083213, 0.0828348, 
-0.0824566, 0.0820783, 0.0817, 0.0813216, 0.0809432, 0.0805647, 0.0801862, 0.0798077, 0.0794291, 0.0790504, 
-0.0786717, 0.078293, 0.0779142, 0.0775354, 0.0771565, 0.0767776, 0.0763986, 0.0760196, 0.0756405, 0.0752614, 
-0.0748823, 0.0745031, 0.0741238, 0.0737446, 0.0733652, 0.0729859, 0.0726065, 0.072227, 0.0718475, 0.071468, 
-0.0710884, 0.0707088, 0.0703291, 0.0699494, 0.0695697, 0.0691899, 0.0688101, 0.0684302, 0.0680503, 0.0676703, 
-0.0672904, 0.0669103, 0.0665303, 0.0661502, 0.06577, 0.0653898, 0.0650096, 0.0646294, 0.0642491, 0.0638687, 
-0.0634883, 0.0631079, 0.0627275, 0.062347, 0.0619665, 0.0615859, 0.0612053, 0.0608247, 0.060444, 0.0600633, 
-0.0596826, 0.0593018, 0.058921, 0.0585402, 0.0581593, 0.0577784, 0.0573975, 0.0570165, 0.0566355, 0.0562544, 
-0.0558734, 0.0554922, 0.0551111, 0.0547299, 0.0543487, 0.0539675, 0.0535862, 0.0532049, 0.0528236, 0.0524422, 
-0.0520608, 0.0516794, 0.0512979, 0.0509164, 0.0505349, 0.0501534, 0.0497718, 0.0493902, 0.0490086, 0.0486269, 
-0.0482452, 0.0478635, 0.0474817, 0.0471, 0.0467182, 0.0463363, 0.0459545, 0.0455726, 0.0451907, 0.0448087, 
-0.0444268, 0.0440448, 0.0436628, 0.0432807, 0.0428987, 0.0425166, 0.0421344, 0.0417523, 0.0413701, 0.0409879, 
-0.0406057, 0.0402235, 0.0398412, 0.0394589, 0.0390766, 0.0386943, 0.0383119, 0.0379296, 0.0375472, 0.0371647, 
-0.0367823, 0.0363998, 0.0360173, 0.0356348, 0.0352523, 0.0348697, 0.0344872, 0.0341046, 0.033722, 0.0333393, 
-0.0329567, 0.032574, 0.0321913, 0.0318086, 0.0314259, 0.0310431, 0.0306604, 0.0302776, 0.0298948, 0.029512, 
-0.0291291, 0.0287463, 0.0283634, 0.0279805, 0.0275976, 0.0272147, 0.0268318, 0.0264488, 0.0260659, 0.0256829, 
-0.0252999, 0.0249169, 0.0245338, 0.0241508, 0.0237677, 0.0233847, 0.0230016, 0.0226185, 0.0222354, 0.0218523, 
-0.0214691, 0.021086, 0.0207028, 0.0203196, 0.0199365, 0.0195533, 0.0191701, 0.0187868, 0.0184036, 0.0180204, 
-0.0176371, 0.0172539, 0.0168706, 0.0164873, 0.016104, 0.0157207, 0.0153374, 0.0149541, 0.0145708, 0.0141874, 
-0.0138041, 0.0134207, 0.0130374, 0.012654, 0.0122706, 0.0118872, 0.0115038, 0.0111204, 0.010737, 0.0103536, 
-0.0099702, 0.0095868, 0.0092034, 0.0088199, 0.0084365, 0.0080531, 0.0076696, 0.0072862, 0.0069027, 0.0065192, 
-0.0061358, 0.0057523, 0.0053688, 0.0049854, 0.0046019, 0.0042184, 0.0038349, 0.0034514, 0.0030679, 0.0026845, 
-0.002301, 0.0019175, 0.001534, 0.0011505, 0.000767, 0.0003835, 0.0, -0.0003835, -0.000767, -0.0011505, 
--0.001534, -0.0019175, -0.002301, -0.0026845, -0.0030679, -0.0034514, -0.0038349, -0.0042184, -0.0046019, -0.0049854, 
--0.0053688, -0.0057523, -0.0061358, -0.0065192, -0.0069027, -0.0072862, -0.0076696, -0.0080531, -0.0084365, -0.0088199, 
--0.0092034, -0.0095868, -0.0099702, -0.0103536, -0.010737, -0.0111204, -0.0115038, -0.0118872, -0.0122706, -0.012654, 
--0.0130374, -0.0134207, -0.0138041, -0.0141874, -0.0145708, -0.0149541, -0.0153374, -0.0157207, -0.016104, -0.0164873, 
--0.0168706, -0.0172539, -0.0176371, -0.0180204, -0.0184036, -0.0187868, -0.0191701, -0.0195533, -0.0199365, -0.0203196, 
--0.0207028, -0.021086, -0.0214691, -0.0218523, -0.0222354, -0.0226185, -0.0230016, -0.0233847, -0.0237677, -0.0241508, 
--0.0245338, -0.0249169, -0.0252999, -0.0256829, -0.0260659, -0.0264488, -0.0268318, -0.0272147, -0.0275976, -0.0279805, 
--0.0283634, -0.0287463, -0.0291291, -0.029512, -0.0298948, -0.0302776, -0.0306604, -0.0310431, -0.0314259, -0.0318086, 
--0.0321913, -0.032574, -0.0329567, -0.0333393, -0.033722, -0.0341046, -0.0344872, -0.0348697, -0.0352523, -0.0356348, 
--0.0360173, -0.0363998, -0.0367823, -0.0371647, -0.0375472, -0.0379296, -0.0383119, -0.0386943, -0.0390766, -0.0394589, 
--0.0398412, -0.0402235, -0.0406057, -0.0409879, -0.0413701, -0.0417523, -0.0421344, -0.0425166, -0.0428987, -0.0432807, 
--0.0436628, -0.0440448, -0.0444268, -0.0448087, -0.0451907, -0.0455726, -0.0459545, -0.0463363, -0.0467182, -0.0471, 
--0.0474817, -0.0478635, -0.0482452, -0.0486269, -0.0490086, -0.0493902, -0.0497718, -0.0501534, -0.0505349, -0.0509164, 
--0.0512979, -0.0516794, -0.0520608, -0.0524422, -0.0528236, -0.0532049, -0.0535862, -0.0539675, -0.0543487, -0.0547299, 
--0.0551111, -0.0554922, -0.0558734, -0.0562544, -0.0566355, -0.0570165, -0.0573975, -0.0577784, -0.0581593, -0.0585402, 
--0.058921, -0.0593018, -0.0596826, -0.0600633, -0.060444, -0.0608247, -0.0612053, -0.0615859, -0.0619665, -0.062347, 
--0.0627275, -0.0631079, -0.0634883, -0.0638687, -0.0642491, -0.0646294, -0.0650096, -0.0653898, -0.06577, -0.0661502, 
--0.0665303, -0.0669103, -0.0672904, -0.0676703, -0.0680503, -0.0684302, -0.0688101, -0.0691899, -0.0695697, -0.0699494, 
--0.0703291, -0.0707088, -0.0710884, -0.071468, -0.0718475, -0.072227, -0.0726065, -0.0729859, -0.0733652, -0.0737446, 
--0.0741238, -0.0745031, -0.0748823, -0.0752614, -0.0756405, -0.0760196, -0.0763986, -0.0767776, -0.0771565, -0.0775354, 
--0.0779142, -0.078293, -0.0786717, -0.0790504, -0.0794291, -0.0798077, -0.0801862, -0.0805647, -0.0809432, -0.0813216, 
--0.0817, -0.0820783, -0.0824566, -0.0828348, -0.083213, -0.0835911, -0.0839691, -0.0843472, -0.0847251, -0.0851031, 
--0.0854809, -0.0858588, -0.0862365, -0.0866143, -0.0869919, -0.0873696, -0.0877471, -0.0881246, -0.0885021, -0.0888795, 
--0.0892569, -0.0896342, -0.0900115, -0.0903887, -0.0907658, -0.0911429, -0.0915199, -0.0918969, -0.0922739, -0.0926507, 
--0.0930276, -0.0934043, -0.0937811, -0.0941577, -0.0945343, -0.0949109, -0.0952874, -0.0956638, -0.0960402, -0.0964165, 
--0.0967928, -0.097169, -0.0975452, -0.0979213, -0.0982973, -0.0986733, -0.0990492, -0.0994251, -0.0998009, -0.1001766, 
--0.1005523, -0.1009279, -0.1013035, -0.101679, -0.1020545, -0.1024299, -0.1028052, -0.1031805, -0.1035557, -0.1039308, 
--0.1043059, -0.104681, -0.1050559, -0.1054308, -0.1058057, -0.1061804, -0.1065552, -0.1069298, -0.1073044, -0.1076789, 
--0.1080534, -0.1084278, -0.1088021, -0.1091764, -0.1095506, -0.1099248, -0.1102988, -0.1106729, -0.1110468, -0.1114207, 
--0.1117945, -0.1121683, -0.112542, -0.1129156, -0.1132891, -0.1136626, -0.114036, -0.1144094, -0.1147827, -0.1151559, 
--0.1155291, -0.1159021, -0.1162752, -0.1166481, -0.117021, -0.1173938, -0.1177665, -0.1181392, -0.1185118, -0.1188843, 
--0.1192568, -0.1196292, -0.1200015, -0.1203738, -0.1207459, -0.1211181, -0.1214901, -0.1218621, -0.122234, -0.1226058, 
--0.1229775, -0.1233492, -0.1237208, -0.1240923, -0.1244638, -0.1248352, -0.1252065, -0.1255777, -0.1259489, -0.12632, 
--0.126691, -0.127062, -0.1274328, -0.1278036, -0.1281743, -0.128545, -0.1289156, -0.129286, -0.1296565, -0.1300268, 
--0.1303971, -0.1307672, -0.1311374, -0.1315074, -0.1318773, -0.1322472, -0.132617, -0.1329867, -0.1333564, -0.1337259, 
--0.1340954, -0.1344648, -0.1348342, -0.1352034, -0.1355726, -0.1359417, -0.1363107, -0.1366796, -0.1370485, -0.1374172, 
--0.1377859, -0.1381545, -0.138523, -0.1388915, -0.1392598, -0.1396281, -0.1399963, -0.1403644, -0.1407325, -0.1411004, 
--0.1414683, -0.1418361, -0.1422038, -0.1425714, -0.1429389, -0.1433064, -0.1436737, -0.144041, -0.1444082, -0.1447753, 
--0.1451423, -0.1455093, -0.1458761, -0.1462429, -0.1466096, -0.1469762, -0.1473427, -0.1477091, -0.1480754, -0.1484417, 
--0.1488079, -0.1491739, -0.1495399, -0.1499058, -0.1502716, -0.1506373, -0.151003, -0.1513685, -0.151734, -0.1520993, 
--0.1524646, -0.1528298, -0.1531949, -0.1535599, -0.1539248, -0.1542896, -0.1546544, -0.155019, -0.1553836, -0.155748, 
--0.1561124, -0.1564767, -0.1568409, -0.157205, -0.157569, -0.1579329, -0.1582967, -0.1586604, -0.159024, -0.1593876, 
--0.159751, -0.1601144, -0.1604776, -0.1608408, -0.1612038, -0.1615668, -0.1619297, -0.1622925, -0.1626551, -0.1630177, 
--0.1633802, -0.1637426, -0.1641049, -0.1644671, -0.1648292, -0.1651912, -0.1655532, -0.165915, -0.1662767, -0.1666383, 
--0.1669998, -0.1673612, -0.1677226, -0.1680838, -0.1684449, -0.168806, -0.1691669, -0.1695277, -0.1698884, -0.1702491, 
--0.1706096, -0.17097, -0.1713304, -0.1716906, -0.1720507, -0.1724107, -0.1727707, -0.1731305, -0.1734902, -0.1738498, 
--0.1742093, -0.1745688, -0.1749281, -0.1752873, -0.1756464, -0.1760054, -0.1763643, -0.1767231, -0.1770818, -0.1774403, 
--0.1777988, -0.1781572, -0.1785155, -0.1788736, -0.1792317, -0.1795897, -0.1799475, -0.1803053, -0.1806629, -0.1810204, 
--0.1813779, -0.1817352, -0.1820924, -0.1824495, -0.1828065, -0.1831634, -0.1835202, -0.1838768, -0.1842334, -0.1845899, 
--0.1849462, -0.1853025, -0.1856586, -0.1860146, -0.1863705, -0.1867263, -0.187082, -0.1874376, -0.1877931, -0.1881485, 
--0.1885037, -0.1888588, -0.1892139, -0.1895688, -0.1899236, -0.1902783, -0.1906329, -0.1909874, -0.1913417, -0.191696, 
--0.1920501, -0.1924041, -0.192758, -0.1931118, -0.1934655, -0.1938191, -0.1941725, -0.1945259, -0.1948791, -0.1952322, 
--0.1955852, -0.1959381, -0.1962908, -0.1966435, -0.196996, -0.1973484, -0.1977007, -0.1980529, -0.198405, -0.1987569, 
--0.1991088, -0.1994605, -0.1998121, -0.2001636, -0.2005149, -0.2008662, -0.2012173, -0.2015683, -0.2019192, -0.20227, 
--0.2026207, -0.2029712, -0.2033216, -0.2036719, -0.2040221, -0.2043721, -0.2047221, -0.2050719, -0.2054216, -0.2057712, 
--0.2061206, -0.2064699, -0.2068192, -0.2071682, -0.2075172, -0.2078661, -0.2082148, -0.2085634, -0.2089119, -0.2092602, 
--0.2096084, -0.2099566, -0.2103045, -0.2106524, -0.2110001, -0.2113477, -0.2116952, -0.2120426, -0.2123898, -0.212737, 
--0.2130839, -0.2134308, -0.2137775, -0.2141242, -0.2144706, -0.214817, -0.2151632, -0.2155093, -0.2158553, -0.2162012, 
--0.2165469, -0.2168925, -0.217238, -0.2175833, -0.2179285, -0.2182736, -0.2186186, -0.2189634, -0.2193081, -0.2196527, 
--0.2199971, -0.2203414, -0.2206856, -0.2210297, -0.2213736, -0.2217174, -0.2220611, -0.2224046, -0.222748, -0.2230913, 
--0.2234344, -0.2237774, -0.2241203, -0.2244631, -0.2248057, -0.2251481, -0.2254905, -0.2258327, -0.2261748, -0.2265167, 
--0.2268586, -0.2272002, -0.2275418, -0.2278832, -0.2282245, -0.2285656, -0.2289067, -0.2292475, -0.2295883, -0.2299289, 
--0.2302694, -0.2306097, -0.2309499, -0.23129, -0.2316299, -0.2319697, -0.2323093, -0.2326489, -0.2329882, -0.2333275, 
--0.2336666, -0.2340056, -0.2343444, -0.2346831, -0.2350217, -0.2353601, -0.2356984, -0.2360365, -0.2363745, -0.2367124, 
--0.2370501, -0.2373877, -0.2377251, -0.2380624, -0.2383996, -0.2387366, -0.2390735, -0.2394103, -0.2397469, -0.2400833, 
--0.2404197, -0.2407558, -0.2410919, -0.2414278, -0.2417635, -0.2420992, -0.2424346, -0.24277, -0.2431051, -0.2434402, 
--0.2437751, -0.2441098, -0.2444444, -0.2447789, -0.2451132, -0.2454474, -0.2457815, -0.2461153, -0.2464491, -0.2467827, 
--0.2471162, -0.2474495, -0.2477826, -0.2481157, -0.2484485, -0.2487813, -0.2491138, -0.2494463, -0.2497786, -0.2501107, 
--0.2504427, -0.2507745, -0.2511062, -0.2514378, -0.2517692, -0.2521004, -0.2524316, -0.2527625, -0.2530933, -0.253424, 
--0.2537545, -0.2540849, -0.2544151, -0.2547451, -0.255075, -0.2554048, -0.2557344, -0.2560639, -0.2563932, -0.2567224, 
--0.2570514, -0.2573802, -0.2577089, -0.2580375, -0.2583659, -0.2586942, -0.2590223, -0.2593502, -0.259678, -0.2600056, 
--0.2603331, -0.2606605, -0.2609876, -0.2613147, -0.2616416, -0.2619683, -0.2622948, -0.2626213, -0.2629475, -0.2632736, 
--0.2635996, -0.2639254, -0.264251, -0.2645765, -0.2649018, -0.265227, -0.265552, -0.2658769, -0.2662016, -0.2665261, 
--0.2668505, -0.2671747, -0.2674988, -0.2678227, -0.2681465, -0.2684701, -0.2687935, -0.2691168, -0.26944, -0.2697629, 
--0.2700857, -0.2704084, -0.2707309, -0.2710532, -0.2713754, -0.2716974, -0.2720193, -0.272341, -0.2726625, -0.2729839, 
--0.2733051, -0.2736261, -0.273947, -0.2742678, -0.2745883, -0.2749087, -0.275229, -0.2755491, -0.275869, -0.2761888, 
--0.2765084, -0.2768278, -0.2771471, -0.2774662, -0.2777851, -0.2781039, -0.2784225, -0.278741, -0.2790593, -0.2793774, 
--0.2796954, -0.2800132, -0.2803308, -0.2806483, -0.2809656, -0.2812827, -0.2815997, -0.2819165, -0.2822331, -0.2825496, 
--0.2828659, -0.283182, -0.283498, -0.2838138, -0.2841295, -0.284445, -0.2847603, -0.2850754, -0.2853904, -0.2857052, 
--0.2860198, -0.2863343, -0.2866486, -0.2869627, -0.2872767, -0.2875905, -0.2879041, -0.2882176, -0.2885308, -0.288844, 
--0.2891569, -0.2894697, -0.2897823, -0.2900947, -0.290407, -0.2907191, -0.291031, -0.2913427, -0.2916543, -0.2919657, 
--0.292277, -0.292588, -0.2928989, -0.2932096, -0.2935202, -0.2938306, -0.2941408, -0.2944508, -0.2947607, -0.2950703, 
--0.2953799, -0.2956892, -0.2959983, -0.2963073, -0.2966161, -0.2969248, -0.2972332, -0.2975415, -0.2978497, -0.2981576, 
--0.2984654, -0.2987729, -0.2990804, -0.2993876, -0.2996946, -0.3000015, -0.3003082, -0.3006148, -0.3009211, -0.3012273, 
--0.3015333, -0.3018391, -0.3021448, -0.3024502, -0.3027555, -0.3030606, -0.3033656, -0.3036703, -0.3039749, -0.3042793, 
--0.3045835, -0.3048875, -0.3051914, -0.3054951, -0.3057986, -0.3061019, -0.306405, -0.306708, -0.3070108, -0.3073134, 
--0.3076158, -0.307918, -0.3082201, -0.308522, -0.3088237, -0.3091252, -0.3094265, -0.3097276, -0.3100286, -0.3103294, 
--0.31063, -0.3109304, -0.3112306, -0.3115307, -0.3118306, -0.3121302, -0.3124297, -0.3127291, -0.3130282, -0.3133271, 
--0.3136259, -0.3139245, -0.3142229, -0.3145211, -0.3148191, -0.315117, -0.3154146, -0.3157121, -0.3160094, -0.3163065, 
--0.3166034, -0.3169001, -0.3171966, -0.317493, -0.3177892, -0.3180851, -0.3183809, -0.3186765, -0.318972, -0.3192672, 
--0.3195622, -0.3198571, -0.3201517, -0.3204462, -0.3207405, -0.3210346, -0.3213285, -0.3216222, -0.3219158, -0.3222091, 
--0.3225023, -0.3227952, -0.323088, -0.3233806, -0.323673, -0.3239652, -0.3242572, -0.324549, -0.3248407, -0.3251321, 
--0.3254233, -0.3257144, -0.3260053, -0.3262959, -0.3265864, -0.3268767, -0.3271668, -0.3274567, -0.3277464, -0.3280359, 
--0.3283253, -0.3286144, -0.3289033, -0.3291921, -0.3294806, -0.329769, -0.3300572, -0.3303451, -0.3306329, -0.3309205, 
--0.3312079, -0.3314951, -0.3317821, -0.3320689, -0.3323555, -0.3326419, -0.3329281, -0.3332141, -0.3335, -0.3337856, 
--0.334071, -0.3343563, -0.3346413, -0.3349261, -0.3352108, -0.3354952, -0.3357795, -0.3360635, -0.3363474, -0.336631, 
--0.3369145, -0.3371978, -0.3374808, -0.3377637, -0.3380464, -0.3383288, -0.3386111, -0.3388932, -0.339175, -0.3394567, 
--0.3397382, -0.3400194, -0.3403005, -0.3405814, -0.340862, -0.3411425, -0.3414228, -0.3417028, -0.3419827, -0.3422624, 
--0.3425418, -0.3428211, -0.3431002, -0.343379, -0.3436577, -0.3439361, -0.3442144, -0.3444924, -0.3447703, -0.3450479, 
--0.3453254, -0.3456026, -0.3458796, -0.3461565, -0.3464331, -0.3467095, -0.3469857, -0.3472617, -0.3475376, -0.3478132, 
--0.3480886, -0.3483638, -0.3486388, -0.3489135, -0.3491881, -0.3494625, -0.3497367, -0.3500106, -0.3502844, -0.350558, 
--0.3508313, -0.3511044, -0.3513774, -0.3516501, -0.3519226, -0.3521949, -0.352467, -0.3527389, -0.3530106, -0.3532821, 
--0.3535534, -0.3538245, -0.3540953, -0.354366, -0.3546364, -0.3549066, -0.3551767, -0.3554465, -0.3557161, -0.3559855, 
--0.3562547, -0.3565237, -0.3567924, -0.357061, -0.3573293, -0.3575975, -0.3578654, -0.3581331, -0.3584006, -0.3586679, 
--0.358935, -0.3592019, -0.3594686, -0.359735, -0.3600013, -0.3602673, -0.3605331, -0.3607987, -0.3610641, -0.3613293, 
--0.3615942, -0.361859, -0.3621235, -0.3623879, -0.362652, -0.3629159, -0.3631796, -0.3634431, -0.3637063, -0.3639694, 
--0.3642322, -0.3644948, -0.3647572, -0.3650194, -0.3652814, -0.3655431, -0.3658047, -0.366066, -0.3663271, -0.366588, 
--0.3668487, -0.3671092, -0.3673694, -0.3676295, -0.3678893, -0.3681489, -0.3684083, -0.3686675, -0.3689264, -0.3691851, 
--0.3694437, -0.369702, -0.36996, -0.3702179, -0.3704756, -0.370733, -0.3709902, -0.3712472, -0.371504, -0.3717605, 
--0.3720169, -0.372273, -0.3725289, -0.3727846, -0.37304, -0.3732953, -0.3735503, -0.3738051, -0.3740597, -0.3743141, 
--0.3745682, -0.3748221, -0.3750758, -0.3753293, -0.3755826, -0.3758356, -0.3760884, -0.376341, -0.3765934, -0.3768456, 
--0.3770975, -0.3773492, -0.3776007, -0.377852, -0.378103, -0.3783538, -0.3786044, -0.3788548, -0.379105, -0.3793549, 
--0.3796046, -0.3798541, -0.3801033, -0.3803524, -0.3806012, -0.3808498, -0.3810981, -0.3813463, -0.3815942, -0.3818419, 
--0.3820894, -0.3823366, -0.3825836, -0.3828304, -0.383077, -0.3833233, -0.3835695, -0.3838153, -0.384061, -0.3843065, 
--0.3845517, -0.3847967, -0.3850414, -0.385286, -0.3855303, -0.3857743, -0.3860182, -0.3862618, -0.3865052, -0.3867484, 
--0.3869913, -0.3872341, -0.3874766, -0.3877188, -0.3879608, -0.3882027, -0.3884442, -0.3886856, -0.3889267, -0.3891676, 
--0.3894083, -0.3896487, -0.3898889, -0.3901289, -0.3903686, -0.3906081, -0.3908474, -0.3910865, -0.3913253, -0.3915639, 
--0.3918023, -0.3920404, -0.3922783, -0.392516, -0.3927534, -0.3929906, -0.3932276, -0.3934644, -0.3937009, -0.3939372, 
--0.3941732, -0.394409, -0.3946446, -0.39488, -0.3951151, -0.39535, -0.3955847, -0.3958191, -0.3960533, -0.3962873, 
--0.396521, -0.3967545, -0.3969877, -0.3972208, -0.3974536, -0.3976861, -0.3979185, -0.3981505, -0.3983824, -0.398614, 
--0.3988454, -0.3990766, -0.3993075, -0.3995382, -0.3997686, -0.3999989, -0.4002288, -0.4004586, -0.4006881, -0.4009174, 
--0.4011464, -0.4013752, -0.4016038, -0.4018321, -0.4020602, -0.402288, -0.4025157, -0.402743, -0.4029702, -0.4031971, 
--0.4034238, -0.4036502, -0.4038764, -0.4041024, -0.4043281, -0.4045536, -0.4047788, -0.4050038, -0.4052286, -0.4054531, 
--0.4056774, -0.4059015, -0.4061253, -0.4063489, -0.4065722, -0.4067953, -0.4070182, -0.4072408, -0.4074632, -0.4076853, 
--0.4079072, -0.4081289, -0.4083503, -0.4085715, -0.4087924, -0.4090131, -0.4092336, -0.4094538, -0.4096738, -0.4098935, 
--0.410113, -0.4103322, -0.4105513, -0.41077, -0.4109886, -0.4112068, -0.4114249, -0.4116427, -0.4118603, -0.4120776, 
--0.4122947, -0.4125115, -0.4127281, -0.4129444, -0.4131605, -0.4133764, -0.413592, -0.4138074, -0.4140225, -0.4142374, 
--0.4144521, -0.4146665, -0.4148806, -0.4150945, -0.4153082, -0.4155216, -0.4157348, -0.4159477, -0.4161604, -0.4163729, 
--0.4165851, -0.416797, -0.4170088, -0.4172202, -0.4174314, -0.4176424, -0.4178531, -0.4180636, -0.4182739, -0.4184839, 
--0.4186936, -0.4189031, -0.4191124, -0.4193214, -0.4195301, -0.4197386, -0.4199469, -0.4201549, -0.4203627, -0.4205702, 
--0.4207775, -0.4209845, -0.4211913, -0.4213978, -0.4216041, -0.4218102, -0.4220159, -0.4222215, -0.4224268, -0.4226318, 
--0.4228366, -0.4230412, -0.4232455, -0.4234495, -0.4236533, -0.4238569, -0.4240602, -0.4242632, -0.424466, -0.4246686, 
--0.4248709, -0.4250729, -0.4252747, -0.4254763, -0.4256776, -0.4258786, -0.4260795, -0.42628, -0.4264803, -0.4266804, 
--0.4268802, -0.4270797, -0.427279, -0.427478, -0.4276768, -0.4278754, -0.4280737, -0.4282717, -0.4284695, -0.428667, 
--0.4288643, -0.4290613, -0.4292581, -0.4294546, -0.4296509, -0.4298469, -0.4300427, -0.4302382, -0.4304335, -0.4306285, 
--0.4308232, -0.4310177, -0.431212, -0.431406, -0.4315997, -0.4317932, -0.4319864, -0.4321794, -0.4323721, -0.4325646, 
--0.4327568, -0.4329488, -0.4331405, -0.4333319, -0.4335231, -0.4337141, -0.4339047, -0.4340952, -0.4342854, -0.4344753, 
--0.4346649, -0.4348543, -0.4350435, -0.4352324, -0.435421, -0.4356094, -0.4357975, -0.4359854, -0.436173, -0.4363604, 
--0.4365475, -0.4367343, -0.4369209, -0.4371073, -0.4372933, -0.4374791, -0.4376647, -0.43785, -0.438035, -0.4382198, 
--0.4384044, -0.4385886, -0.4387726, -0.4389564, -0.4391399, -0.4393231, -0.4395061, -0.4396888, -0.4398713, -0.4400535, 
--0.4402354, -0.4404171, -0.4405986, -0.4407797, -0.4409606, -0.4411413, -0.4413217, -0.4415018, -0.4416817, -0.4418613, 
--0.4420406, -0.4422197, -0.4423985, -0.4425771, -0.4427554, -0.4429335, -0.4431113, -0.4432888, -0.4434661, -0.4436431, 
--0.4438198, -0.4439963, -0.4441725, -0.4443485, -0.4445242, -0.4446996, -0.4448748, -0.4450497, -0.4452244, -0.4453988, 
--0.4455729, -0.4457467, -0.4459204, -0.4460937, -0.4462668, -0.4464396, -0.4466122, -0.4467844, -0.4469565, -0.4471282, 
--0.4472997, -0.447471, -0.447642, -0.4478127, -0.4479831, -0.4481533, -0.4483232, -0.4484929, -0.4486623, -0.4488314, 
--0.4490003, -0.4491689, -0.4493372, -0.4495053, -0.4496731, -0.4498407, -0.4500079, -0.450175, -0.4503417, -0.4505082, 
--0.4506744, -0.4508404, -0.4510061, -0.4511715, -0.4513367, -0.4515016, -0.4516662, -0.4518305, -0.4519946, -0.4521585, 
--0.452322, -0.4524853, -0.4526484, -0.4528111, -0.4529736, -0.4531359, -0.4532979, -0.4534596, -0.453621, -0.4537822, 
--0.4539431, -0.4541037, -0.4542641, -0.4544242, -0.454584, -0.4547436, -0.4549029, -0.4550619, -0.4552206, -0.4553791, 
--0.4555374, -0.4556953, -0.455853, -0.4560104, -0.4561676, -0.4563245, -0.4564811, -0.4566374, -0.4567935, -0.4569493, 
--0.4571049, -0.4572602, -0.4574152, -0.4575699, -0.4577244, -0.4578786, -0.4580325, -0.4581861, -0.4583395, -0.4584926, 
--0.4586455, -0.4587981, -0.4589504, -0.4591024, -0.4592542, -0.4594057, -0.4595569, -0.4597079, -0.4598586, -0.460009, 
--0.4601591, -0.460309, -0.4604586, -0.460608, -0.460757, -0.4609058, -0.4610543, -0.4612026, -0.4613506, -0.4614983, 
--0.4616457, -0.4617929, -0.4619398, -0.4620864, -0.4622327, -0.4623788, -0.4625246, -0.4626702, -0.4628154, -0.4629604, 
--0.4631051, -0.4632496, -0.4633937, -0.4635376, -0.4636813, -0.4638246, -0.4639677, -0.4641105, -0.464253, -0.4643953, 
--0.4645373, -0.464679, -0.4648204, -0.4649616, -0.4651025, -0.4652431, -0.4653835, -0.4655236, -0.4656634, -0.4658029, 
--0.4659421, -0.4660811, -0.4662198, -0.4663582, -0.4664964, -0.4666343, -0.4667719, -0.4669092, -0.4670463, -0.4671831, 
--0.4673196, -0.4674558, -0.4675918, -0.4677274, -0.4678628, -0.467998, -0.4681328, -0.4682674, -0.4684017, -0.4685358, 
--0.4686695, -0.468803, -0.4689362, -0.4690691, -0.4692018, -0.4693341, -0.4694662, -0.4695981, -0.4697296, -0.4698609, 
--0.4699919, -0.4701226, -0.470253, -0.4703832, -0.4705131, -0.4706427, -0.470772, -0.4709011, -0.4710299, -0.4711584, 
--0.4712866, -0.4714145, -0.4715422, -0.4716696, -0.4717967, -0.4719236, -0.4720501, -0.4721764, -0.4723024, -0.4724281, 
--0.4725536, -0.4726788, -0.4728037, -0.4729283, -0.4730526, -0.4731767, -0.4733005, -0.473424, -0.4735472, -0.4736701, 
--0.4737928, -0.4739152, -0.4740373, -0.4741591, -0.4742807, -0.4744019, -0.4745229, -0.4746437, -0.4747641, -0.4748842, 
--0.4750041, -0.4751237, -0.475243, -0.4753621, -0.4754808, -0.4755993, -0.4757175, -0.4758354, -0.4759531, -0.4760704, 
--0.4761875, -0.4763043, -0.4764208, -0.4765371, -0.476653, -0.4767687, -0.4768841, -0.4769992, -0.477114, -0.4772286, 
--0.4773429, -0.4774569, -0.4775706, -0.477684, -0.4777972, -0.47791, -0.4780226, -0.4781349, -0.478247, -0.4783587, 
--0.4784702, -0.4785813, -0.4786923, -0.4788029, -0.4789132, -0.4790233, -0.479133, -0.4792425, -0.4793517, -0.4794607, 
--0.4795693, -0.4796777, -0.4797858, -0.4798936, -0.4800011, -0.4801083, -0.4802153, -0.4803219, -0.4804283, -0.4805344, 
--0.4806402, -0.4807458, -0.480851, -0.480956, -0.4810607, -0.4811651, -0.4812692, -0.4813731, -0.4814766, -0.4815799, 
--0.4816829, -0.4817856, -0.481888, -0.4819902, -0.482092, -0.4821936, -0.4822949, -0.4823959, -0.4824966, -0.4825971, 
--0.4826972, -0.4827971, -0.4828967, -0.482996, -0.483095, -0.4831937, -0.4832922, -0.4833904, -0.4834882, -0.4835858, 
--0.4836831, -0.4837802, -0.4838769, -0.4839734, -0.4840696, -0.4841654, -0.484261, -0.4843564, -0.4844514, -0.4845462, 
--0.4846406, -0.4847348, -0.4848287, -0.4849223, -0.4850156, -0.4851087, -0.4852014, -0.4852939, -0.4853861, -0.485478, 
--0.4855696, -0.4856609, -0.4857519, -0.4858427, -0.4859332, -0.4860234, -0.4861132, -0.4862029, -0.4862922, -0.4863812, 
--0.48647, -0.4865584, -0.4866466, -0.4867345, -0.4868221, -0.4869094, -0.4869965, -0.4870832, -0.4871697, -0.4872559, 
--0.4873418, -0.4874274, -0.4875127, -0.4875977, -0.4876824, -0.4877669, -0.4878511, -0.4879349, -0.4880185, -0.4881018, 
--0.4881849, -0.4882676, -0.48835, -0.4884322, -0.4885141, -0.4885957, -0.488677, -0.488758, -0.4888387, -0.4889191, 
--0.4889993, -0.4890791, -0.4891587, -0.489238, -0.489317, -0.4893957, -0.4894741, -0.4895522, -0.4896301, -0.4897076, 
--0.4897849, -0.4898619, -0.4899386, -0.490015, -0.4900911, -0.4901669, -0.4902424, -0.4903177, -0.4903926, -0.4904673, 
--0.4905417, -0.4906158, -0.4906896, -0.4907631, -0.4908363, -0.4909093, -0.4909819, -0.4910543, -0.4911264, -0.4911982, 
--0.4912697, -0.4913409, -0.4914118, -0.4914824, -0.4915527, -0.4916228, -0.4916926, -0.491762, -0.4918312, -0.4919001, 
--0.4919687, -0.492037, -0.492105, -0.4921728, -0.4922402, -0.4923074, -0.4923743, -0.4924408, -0.4925071, -0.4925731, 
--0.4926388, -0.4927042, -0.4927694, -0.4928342, -0.4928988, -0.492963, -0.493027, -0.4930907, -0.493154, -0.4932171, 
--0.49328, -0.4933425, -0.4934047, -0.4934666, -0.4935283, -0.4935896, -0.4936507, -0.4937115, -0.493772, -0.4938322, 
--0.4938921, -0.4939517, -0.494011, -0.49407, -0.4941288, -0.4941872, -0.4942454, -0.4943033, -0.4943608, -0.4944181, 
--0.4944751, -0.4945318, -0.4945883, -0.4946444, -0.4947002, -0.4947558, -0.494811, -0.494866, -0.4949206, -0.494975, 
--0.4950291, -0.4950829, -0.4951364, -0.4951896, -0.4952425, -0.4952952, -0.4953475, -0.4953996, -0.4954513, -0.4955028, 
--0.495554, -0.4956048, -0.4956554, -0.4957057, -0.4957557, -0.4958055, -0.4958549, -0.495904, -0.4959529, -0.4960014, 
--0.4960497, -0.4960976, -0.4961453, -0.4961927, -0.4962398, -0.4962866, -0.4963331, -0.4963793, -0.4964252, -0.4964708, 
--0.4965162, -0.4965612, -0.496606, -0.4966504, -0.4966946, -0.4967385, -0.4967821, -0.4968254, -0.4968684, -0.4969111, 
--0.4969535, -0.4969956, -0.4970374, -0.497079, -0.4971202, -0.4971612, -0.4972018, -0.4972422, -0.4972823, -0.4973221, 
--0.4973616, -0.4974008, -0.4974397, -0.4974783, -0.4975166, -0.4975546, -0.4975924, -0.4976298, -0.497667, -0.4977038, 
--0.4977404, -0.4977766, -0.4978126, -0.4978483, -0.4978837, -0.4979188, -0.4979536, -0.4979881, -0.4980224, -0.4980563, 
--0.4980899, -0.4981233, -0.4981563, -0.4981891, -0.4982215, -0.4982537, -0.4982856, -0.4983172, -0.4983484, -0.4983794, 
--0.4984101, -0.4984406, -0.4984707, -0.4985005, -0.49853, -0.4985593, -0.4985882, -0.4986169, -0.4986452, -0.4986733, 
--0.4987011, -0.4987285, -0.4987557, -0.4987826, -0.4988092, -0.4988355, -0.4988615, -0.4988873, -0.4989127, -0.4989378, 
--0.4989626, -0.4989872, -0.4990114, -0.4990354, -0.4990591, -0.4990824, -0.4991055, -0.4991283, -0.4991508, -0.499173, 
--0.4991949, -0.4992165, -0.4992378, -0.4992588, -0.4992795, -0.4993, -0.4993201, -0.49934, -0.4993595, -0.4993788, 
--0.4993977, -0.4994164, -0.4994348, -0.4994529, -0.4994706, -0.4994881, -0.4995053, -0.4995223, -0.4995389, -0.4995552, 
--0.4995712, -0.4995869, -0.4996024, -0.4996175, -0.4996324, -0.4996469, -0.4996612, -0.4996752, -0.4996888, -0.4997022, 
--0.4997153, -0.4997281, -0.4997406, -0.4997528, -0.4997647, -0.4997763, -0.4997876, -0.4997987, -0.4998094, -0.4998199, 
--0.49983, -0.4998399, -0.4998494, -0.4998587, -0.4998676, -0.4998763, -0.4998847, -0.4998928, -0.4999006, -0.4999081, 
--0.4999153, -0.4999222, -0.4999288, -0.4999351, -0.4999412, -0.4999469, -0.4999524, -0.4999575, -0.4999624, -0.4999669, 
--0.4999712, -0.4999751, -0.4999788, -0.4999822, -0.4999853, -0.4999881, -0.4999906, -0.4999928, -0.4999947, -0.4999963, 
--0.4999976, -0.4999987, -0.4999994, -0.4999999, -0.5, -0.4999999, -0.4999994, -0.4999987, -0.4999976, -0.4999963, 
--0.4999947, -0.4999928, -0.4999906, -0.4999881, -0.4999853, -0.4999822, -0.4999788, -0.4999751, -0.4999712, -0.4999669, 
--0.4999624, -0.4999575, -0.4999524, -0.4999469, -0.4999412, -0.4999351, -0.4999288, -0.4999222, -0.4999153, -0.4999081, 
--0.4999006, -0.4998928, -0.4998847, -0.4998763, -0.4998676, -0.4998587, -0.4998494, -0.4998399, -0.49983, -0.4998199, 
--0.4998094, -0.4997987, -0.4997876, -0.4997763, -0.4997647, -0.4997528, -0.4997406, -0.4997281, -0.4997153, -0.4997022, 
--0.4996888, -0.4996752, -0.4996612, -0.4996469, -0.4996324, -0.4996175, -0.4996024, -0.4995869, -0.4995712, -0.4995552, 
--0.4995389, -0.4995223, -0.4995053, -0.4994881, -0.4994706, -0.4994529, -0.4994348, -0.4994164, -0.4993977, -0.4993788, 
--0.4993595, -0.49934, -0.4993201, -0.4993, -0.4992795, -0.4992588, -0.4992378, -0.4992165, -0.4991949, -0.499173, 
--0.4991508, -0.4991283, -0.4991055, -0.4990824, -0.4990591, -0.4990354, -0.4990114, -0.4989872, -0.4989626, -0.4989378, 
--0.4989127, -0.4988873, -0.4988615, -0.4988355, -0.4988092, -0.4987826, -0.4987557, -0.4987285, -0.4987011, -0.4986733, 
--0.4986452, -0.4986169, -0.4985882, -0.4985593, -0.49853, -0.4985005, -0.4984707, -0.4984406, -0.4984101, -0.4983794, 
--0.4983484, -0.4983172, -0.4982856, -0.4982537, -0.4982215, -0.4981891, -0.4981563, -0.4981233, -0.4980899, -0.4980563, 
--0.4980224, -0.4979881, -0.4979536, -0.4979188, -0.4978837, -0.4978483, -0.4978126, -0.4977766, -0.4977404, -0.4977038, 
--0.497667, -0.4976298, -0.4975924, -0.4975546, -0.4975166, -0.4974783, -0.4974397, -0.4974008, -0.4973616, -0.4973221, 
--0.4972823, -0.4972422, -0.4972018, -0.4971612, -0.4971202, -0.497079, -0.4970374, -0.4969956, -0.4969535, -0.4969111, 
--0.4968684, -0.4968254, -0.4967821, -0.4967385, -0.4966946, -0.4966504, -0.496606, -0.4965612, -0.4965162, -0.4964708, 
--0.4964252, -0.4963793, -0.4963331, -0.4962866, -0.4962398, -0.4961927, -0.4961453, -0.4960976, -0.4960497, -0.4960014, 
--0.4959529, -0.495904, -0.4958549, -0.4958055, -0.4957557, -0.4957057, -0.4956554, -0.4956048, -0.495554, -0.4955028, 
--0.4954513, -0.4953996, -0.4953475, -0.4952952, -0.4952425, -0.4951896, -0.4951364, -0.4950829, -0.4950291, -0.494975, 
--0.4949206, -0.494866, -0.494811, -0.4947558, -0.4947002, -0.4946444, -0.4945883, -0.4945318, -0.4944751, -0.4944181, 
--0.4943608, -0.4943033, -0.4942454, -0.4941872, -0.4941288, -0.49407, -0.494011, -0.4939517, -0.4938921, -0.4938322, 
--0.493772, -0.4937115, -0.4936507, -0.4935896, -0.4935283, -0.4934666, -0.4934047, -0.4933425, -0.49328, -0.4932171, 
--0.493154, -0.4930907, -0.493027, -0.492963, -0.4928988, -0.4928342, -0.4927694, -0.4927042, -0.4926388, -0.4925731, 
--0.4925071, -0.4924408, -0.4923743, -0.4923074, -0.4922402, -0.4921728, -0.492105, -0.492037, -0.4919687, -0.4919001, 
--0.4918312, -0.491762, -0.4916926, -0.4916228, -0.4915527, -0.4914824, -0.4914118, -0.4913409, -0.4912697, -0.4911982, 
--0.4911264, -0.4910543, -0.4909819, -0.4909093, -0.4908363, -0.4907631, -0.4906896, -0.4906158, -0.4905417, -0.4904673, 
--0.4903926, -0.4903177, -0.4902424, -0.4901669, -0.4900911, -0.490015, -0.4899386, -0.4898619, -0.4897849, -0.4897076, 
--0.4896301, -0.4895522, -0.4894741, -0.4893957, -0.489317, -0.489238, -0.4891587, -0.4890791, -0.4889993, -0.4889191, 
--0.4888387, -0.488758, -0.488677, -0.4885957, -0.4885141, -0.4884322, -0.48835, -0.4882676, -0.4881849, -0.4881018, 
--0.4880185, -0.4879349, -0.4878511, -0.4877669, -0.4876824, -0.4875977, -0.4875127, -0.4874274, -0.4873418, -0.4872559, 
--0.4871697, -0.4870832, -0.4869965, -0.4869094, -0.4868221, -0.4867345, -0.4866466, -0.4865584, -0.48647, -0.4863812, 
--0.4862922, -0.4862029, -0.4861132, -0.4860234, -0.4859332, -0.4858427, -0.4857519, -0.4856609, -0.4855696, -0.485478, 
--0.4853861, -0.4852939, -0.4852014, -0.4851087, -0.4850156, -0.4849223, -0.4848287, -0.4847348, -0.4846406, -0.4845462, 
--0.4844514, -0.4843564, -0.484261, -0.4841654, -0.4840696, -0.4839734, -0.4838769, -0.4837802, -0.4836831, -0.4835858, 
--0.4834882, -0.4833904, -0.4832922, -0.4831937, -0.483095, -0.482996, -0.4828967, -0.4827971, -0.4826972, -0.4825971, 
--0.4824966, -0.4823959, -0.4822949, -0.4821936, -0.482092, -0.4819902, -0.481888, -0.4817856, -0.4816829, -0.4815799, 
--0.4814766, -0.4813731, -0.4812692, -0.4811651, -0.4810607, -0.480956, -0.480851, -0.4807458, -0.4806402, -0.4805344, 
--0.4804283, -0.4803219, -0.4802153, -0.4801083, -0.4800011, -0.4798936, -0.4797858, -0.4796777, -0.4795693, -0.4794607, 
--0.4793517, -0.4792425, -0.479133, -0.4790233, -0.4789132, -0.4788029, -0.4786923, -0.4785813, -0.4784702, -0.4783587, 
--0.478247, -0.4781349, -0.4780226, -0.47791, -0.4777972, -0.477684, -0.4775706, -0.4774569, -0.4773429, -0.4772286, 
--0.477114, -0.4769992, -0.4768841, -0.4767687, -0.476653, -0.4765371, -0.4764208, -0.4763043, -0.4761875, -0.4760704, 
--0.4759531, -0.4758354, -0.4757175, -0.4755993, -0.4754808, -0.4753621, -0.475243, -0.4751237, -0.4750041, -0.4748842, 
--0.4747641, -0.4746437, -0.4745229, -0.4744019, -0.4742807, -0.4741591, -0.4740373, -0.4739152, -0.4737928, -0.4736701, 
--0.4735472, -0.473424, -0.4733005, -0.4731767, -0.4730526, -0.4729283, -0.4728037, -0.4726788, -0.4725536, -0.4724281, 
--0.4723024, -0.4721764, -0.4720501, -0.4719236, -0.4717967, -0.4716696, -0.4715422, -0.4714145, -0.4712866, -0.4711584, 
--0.4710299, -0.4709011, -0.470772, -0.4706427, -0.4705131, -0.4703832, -0.470253, -0.4701226, -0.4699919, -0.4698609, 
--0.4697296, -0.4695981, -0.4694662, -0.4693341, -0.4692018, -0.4690691, -0.4689362, -0.468803, -0.4686695, -0.4685358, 
--0.4684017, -0.4682674, -0.4681328, -0.467998, -0.4678628, -0.4677274, -0.4675918, -0.4674558, -0.4673196, -0.4671831, 
--0.4670463, -0.4669092, -0.4667719, -0.4666343, -0.4664964, -0.4663582, -0.4662198, -0.4660811, -0.4659421, -0.4658029, 
--0.4656634, -0.4655236, -0.4653835, -0.4652431, -0.4651025, -0.4649616, -0.4648204, -0.464679, -0.4645373, -0.4643953, 
--0.464253, -0.4641105, -0.4639677, -0.4638246, -0.4636813, -0.4635376, -0.4633937, -0.4632496, -0.4631051, -0.4629604, 
--0.4628154, -0.4626702, -0.4625246, -0.4623788, -0.4622327, -0.4620864, -0.4619398, -0.4617929, -0.4616457, -0.4614983, 
--0.4613506, -0.4612026, -0.4610543, -0.4609058, -0.460757, -0.460608, -0.4604586, -0.460309, -0.4601591, -0.460009, 
--0.4598586, -0.4597079, -0.4595569, -0.4594057, -0.4592542, -0.4591024, -0.4589504, -0.4587981, -0.4586455, -0.4584926, 
--0.4583395, -0.4581861, -0.4580325, -0.4578786, -0.4577244, -0.4575699, -0.4574152, -0.4572602, -0.4571049, -0.4569493, 
--0.4567935, -0.4566374, -0.4564811, -0.4563245, -0.4561676, -0.4560104, -0.455853, -0.4556953, -0.4555374, -0.4553791, 
--0.4552206, -0.4550619, -0.4549029, -0.4547436, -0.454584, -0.4544242, -0.4542641, -0.4541037, -0.4539431, -0.4537822, 
--0.453621, -0.4534596, -0.4532979, -0.4531359, -0.4529736, -0.4528111, -0.4526484, -0.4524853, -0.452322, -0.4521585, 
--0.4519946, -0.4518305, -0.4516662, -0.4515016, -0.4513367, -0.4511715, -0.4510061, -0.4508404, -0.4506744, -0.4505082, 
--0.4503417, -0.450175, -0.4500079, -0.4498407, -0.4496731, -0.4495053, -0.4493372, -0.4491689, -0.4490003, -0.4488314, 
--0.4486623, -0.4484929, -0.4483232, -0.4481533, -0.4479831, -0.4478127, -0.447642, -0.447471, -0.4472997, -0.4471282, 
--0.4469565, -0.4467844, -0.4466122, -0.4464396, -0.4462668, -0.4460937, -0.4459204, -0.4457467, -0.4455729, -0.4453988, 
--0.4452244, -0.4450497, -0.4448748, -0.4446996, -0.4445242, -0.4443485, -0.4441725, -0.4439963, -0.4438198, -0.4436431, 
--0.4434661, -0.4432888, -0.4431113, -0.4429335, -0.4427554, -0.4425771, -0.4423985, -0.4422197, -0.4420406, -0.4418613, 
--0.4416817, -0.4415018, -0.4413217, -0.4411413, -0.4409606, -0.4407797, -0.4405986, -0.4404171, -0.4402354, -0.4400535, 
--0.4398713, -0.4396888, -0.4395061, -0.4393231, -0.4391399, -0.4389564, -0.4387726, -0.4385886, -0.4384044, -0.4382198, 
--0.438035, -0.43785, -0.4376647, -0.4374791, -0.4372933, -0.4371073, -0.4369209, -0.4367343, -0.4365475, -0.4363604, 
--0.436173, -0.4359854, -0.4357975, -0.4356094, -0.435421, -0.4352324, -0.4350435, -0.4348543, -0.4346649, -0.4344753, 
--0.4342854, -0.4340952, -0.4339047, -0.4337141, -0.4335231, -0.4333319, -0.4331405, -0.4329488, -0.4327568, -0.4325646, 
--0.4323721, -0.4321794, -0.4319864, -0.4317932, -0.4315997, -0.431406, -0.431212, -0.4310177, -0.4308232, -0.4306285, 
--0.4304335, -0.4302382, -0.4300427, -0.4298469, -0.4296509, -0.4294546, -0.4292581, -0.4290613, -0.4288643, -0.428667, 
--0.4284695, -0.4282717, -0.4280737, -0.4278754, -0.4276768, -0.427478, -0.427279, -0.4270797, -0.4268802, -0.4266804, 
--0.4264803, -0.42628, -0.4260795, -0.4258786, -0.4256776, -0.4254763, -0.4252747, -0.4250729, -0.4248709, -0.4246686, 
--0.424466, -0.4242632, -0.4240602, -0.4238569, -0.4236533, -0.4234495, -0.4232455, -0.4230412, -0.4228366, -0.4226318, 
--0.4224268, -0.4222215, -0.4220159, -0.4218102, -0.4216041, -0.4213978, -0.4211913, -0.4209845, -0.4207775, -0.4205702, 
--0.4203627, -0.4201549, -0.4199469, -0.4197386, -0.4195301, -0.4193214, -0.4191124, -0.4189031, -0.4186936, -0.4184839, 
--0.4182739, -0.4180636, -0.4178531, -0.4176424, -0.4174314, -0.4172202, -0.4170088, -0.416797, -0.4165851, -0.4163729, 
--0.4161604, -0.4159477, -0.4157348, -0.4155216, -0.4153082, -0.4150945, -0.4148806, -0.4146665, -0.4144521, -0.4142374, 
--0.4140225, -0.4138074, -0.413592, -0.4133764, -0.4131605, -0.4129444, -0.4127281, -0.4125115, -0.4122947, -0.4120776, 
--0.4118603, -0.4116427, -0.4114249, -0.4112068, -0.4109886, -0.41077, -0.4105513, -0.4103322, -0.410113, -0.4098935, 
--0.4096738, -0.4094538, -0.4092336, -0.4090131, -0.4087924, -0.4085715, -0.4083503, -0.4081289, -0.4079072, -0.4076853, 
--0.4074632, -0.4072408, -0.4070182, -0.4067953, -0.4065722, -0.4063489, -0.4061253, -0.4059015, -0.4056774, -0.4054531, 
--0.4052286, -0.4050038, -0.4047788, -0.4045536, -0.4043281, -0.4041024, -0.4038764, -0.4036502, -0.4034238, -0.4031971, 
--0.4029702, -0.402743, -0.4025157, -0.402288, -0.4020602, -0.4018321, -0.4016038, -0.4013752, -0.4011464, -0.4009174, 
--0.4006881, -0.4004586, -0.4002288, -0.3999989, -0.3997686, -0.3995382, -0.3993075, -0.3990766, -0.3988454, -0.398614, 
--0.3983824, -0.3981505, -0.3979185, -0.3976861, -0.3974536, -0.3972208, -0.3969877, -0.3967545, -0.396521, -0.3962873, 
--0.3960533, -0.3958191, -0.3955847, -0.39535, -0.3951151, -0.39488, -0.3946446, -0.394409, -0.3941732, -0.3939372, 
--0.3937009, -0.3934644, -0.3932276, -0.3929906, -0.3927534, -0.392516, -0.3922783, -0.3920404, -0.3918023, -0.3915639, 
--0.3913253, -0.3910865, -0.3908474, -0.3906081, -0.3903686, -0.3901289, -0.3898889, -0.3896487, -0.3894083, -0.3891676, 
--0.3889267, -0.3886856, -0.3884442, -0.3882027, -0.3879608, -0.3877188, -0.3874766, -0.3872341, -0.3869913, -0.3867484, 
--0.3865052, -0.3862618, -0.3860182, -0.3857743, -0.3855303, -0.385286, -0.3850414, -0.3847967, -0.3845517, -0.3843065, 
--0.384061, -0.3838153, -0.3835695, -0.3833233, -0.383077, -0.3828304, -0.3825836, -0.3823366, -0.3820894, -0.3818419, 
--0.3815942, -0.3813463, -0.3810981, -0.3808498, -0.3806012, -0.3803524, -0.3801033, -0.3798541, -0.3796046, -0.3793549, 
--0.379105, -0.3788548, -0.3786044, -0.3783538, -0.378103, -0.377852, -0.3776007, -0.3773492, -0.3770975, -0.3768456, 
--0.3765934, -0.376341, -0.3760884, -0.3758356, -0.3755826, -0.3753293, -0.3750758, -0.3748221, -0.3745682, -0.3743141, 
--0.3740597, -0.3738051, -0.3735503, -0.3732953, -0.37304, -0.3727846, -0.3725289, -0.372273, -0.3720169, -0.3717605, 
--0.371504, -0.3712472, -0.3709902, -0.370733, -0.3704756, -0.3702179, -0.36996, -0.369702, -0.3694437, -0.3691851, 
--0.3689264, -0.3686675, -0.3684083, -0.3681489, -0.3678893, -0.3676295, -0.3673694, -0.3671092, -0.3668487, -0.366588, 
--0.3663271, -0.366066, -0.3658047, -0.3655431, -0.3652814, -0.3650194, -0.3647572, -0.3644948, -0.3642322, -0.3639694, 
--0.3637063, -0.3634431, -0.3631796, -0.3629159, -0.362652, -0.3623879, -0.3621235, -0.361859, -0.3615942, -0.3613293, 
--0.3610641, -0.3607987, -0.3605331, -0.3602673, -0.3600013, -0.359735, -0.3594686, -0.3592019, -0.358935, -0.3586679, 
--0.3584006, -0.3581331, -0.3578654, -0.3575975, -0.3573293, -0.357061, -0.3567924, -0.3565237, -0.3562547, -0.3559855, 
--0.3557161, -0.3554465, -0.3551767, -0.3549066, -0.3546364, -0.354366, -0.3540953, -0.3538245, -0.3535534, -0.3532821, 
--0.3530106, -0.3527389, -0.352467, -0.3521949, -0.3519226, -0.3516501, -0.3513774, -0.3511044, -0.3508313, -0.350558, 
--0.3502844, -0.3500106, -0.3497367, -0.3494625, -0.3491881, -0.3489135, -0.3486388, -0.3483638, -0.3480886, -0.3478132, 
--0.3475376, -0.3472617, -0.3469857, -0.3467095, -0.3464331, -0.3461565, -0.3458796, -0.3456026, -0.3453254, -0.3450479, 
--0.3447703, -0.3444924, -0.3442144, -0.3439361, -0.3436577, -0.343379, -0.3431002, -0.3428211, -0.3425418, -0.3422624, 
--0.3419827, -0.3417028, -0.3414228, -0.3411425, -0.340862, -0.3405814, -0.3403005, -0.3400194, -0.3397382, -0.3394567, 
--0.339175, -0.3388932, -0.3386111, -0.3383288, -0.3380464, -0.3377637, -0.3374808, -0.3371978, -0.3369145, -0.336631, 
--0.3363474, -0.3360635, -0.3357795, -0.3354952, -0.3352108, -0.3349261, -0.3346413, -0.3343563, -0.334071, -0.3337856, 
--0.3335, -0.3332141, -0.3329281, -0.3326419, -0.3323555, -0.3320689, -0.3317821, -0.3314951, -0.3312079, -0.3309205, 
--0.3306329, -0.3303451, -0.3300572, -0.329769, -0.3294806, -0.3291921, -0.3289033, -0.3286144, -0.3283253, -0.3280359, 
--0.3277464, -0.3274567, -0.3271668, -0.3268767, -0.3265864, -0.3262959, -0.3260053, -0.3257144, -0.3254233, -0.3251321, 
--0.3248407, -0.324549, -0.3242572, -0.3239652, -0.323673, -0.3233806, -0.323088, -0.3227952, -0.3225023, -0.3222091, 
--0.3219158, -0.3216222, -0.3213285, -0.3210346, -0.3207405, -0.3204462, -0.3201517, -0.3198571, -0.3195622, -0.3192672, 
--0.318972, -0.3186765, -0.3183809, -0.3180851, -0.3177892, -0.317493, -0.3171966, -0.3169001, -0.3166034, -0.3163065, 
--0.3160094, -0.3157121, -0.3154146, -0.315117, -0.3148191, -0.3145211, -0.3142229, -0.3139245, -0.3136259, -0.3133271, 
--0.3130282, -0.3127291, -0.3124297, -0.3121302, -0.3118306, -0.3115307, -0.3112306, -0.3109304, -0.31063, -0.3103294, 
--0.3100286, -0.3097276, -0.3094265, -0.3091252, -0.3088237, -0.308522, -0.3082201, -0.307918, -0.3076158, -0.3073134, 
--0.3070108, -0.306708, -0.306405, -0.3061019, -0.3057986, -0.3054951, -0.3051914, -0.3048875, -0.3045835, -0.3042793, 
--0.3039749, -0.3036703, -0.3033656, -0.3030606, -0.3027555, -0.3024502, -0.3021448, -0.3018391, -0.3015333, -0.3012273, 
--0.3009211, -0.3006148, -0.3003082, -0.3000015, -0.2996946, -0.2993876, -0.2990804, -0.2987729, -0.2984654, -0.2981576, 
--0.2978497, -0.2975415, -0.2972332, -0.2969248, -0.2966161, -0.2963073, -0.2959983, -0.2956892, -0.2953799, -0.2950703, 
--0.2947607, -0.2944508, -0.2941408, -0.2938306, -0.2935202, -0.2932096, -0.2928989, -0.292588, -0.292277, -0.2919657, 
--0.2916543, -0.2913427, -0.291031, -0.2907191, -0.290407, -0.2900947, -0.2897823, -0.2894697, -0.2891569, -0.288844, 
--0.2885308, -0.2882176, -0.2879041, -0.2875905, -0.2872767, -0.2869627, -0.2866486, -0.2863343, -0.2860198, -0.2857052, 
--0.2853904, -0.2850754, -0.2847603, -0.284445, -0.2841295, -0.2838138, -0.283498, -0.283182, -0.2828659, -0.2825496, 
--0.2822331, -0.2819165, -0.2815997, -0.2812827, -0.2809656, -0.2806483, -0.2803308, -0.2800132, -0.2796954, -0.2793774, 
--0.2790593, -0.278741, -0.2784225, -0.2781039, -0.2777851, -0.2774662, -0.2771471, -0.2768278, -0.2765084, -0.2761888, 
--0.275869, -0.2755491, -0.275229, -0.2749087, -0.2745883, -0.2742678, -0.273947, -0.2736261, -0.2733051, -0.2729839, 
--0.2726625, -0.272341, -0.2720193, -0.2716974, -0.2713754, -0.2710532, -0.2707309, -0.2704084, -0.2700857, -0.2697629, 
--0.26944, -0.2691168, -0.2687935, -0.2684701, -0.2681465, -0.2678227, -0.2674988, -0.2671747, -0.2668505, -0.2665261, 
--0.2662016, -0.2658769, -0.265552, -0.265227, -0.2649018, -0.2645765, -0.264251, -0.2639254, -0.2635996, -0.2632736, 
--0.2629475, -0.2626213, -0.2622948, -0.2619683, -0.2616416, -0.2613147, -0.2609876, -0.2606605, -0.2603331, -0.2600056, 
--0.259678, -0.2593502, -0.2590223, -0.2586942, -0.2583659, -0.2580375, -0.2577089, -0.2573802, -0.2570514, -0.2567224, 
--0.2563932, -0.2560639, -0.2557344, -0.2554048, -0.255075, -0.2547451, -0.2544151, -0.2540849, -0.2537545, -0.253424, 
--0.2530933, -0.2527625, -0.2524316, -0.2521004, -0.2517692, -0.2514378, -0.2511062, -0.2507745, -0.2504427, -0.2501107, 
--0.2497786, -0.2494463, -0.2491138, -0.2487813, -0.2484485, -0.2481157, -0.2477826, -0.2474495, -0.2471162, -0.2467827, 
--0.2464491, -0.2461153, -0.2457815, -0.2454474, -0.2451132, -0.2447789, -0.2444444, -0.2441098, -0.2437751, -0.2434402, 
--0.2431051, -0.24277, -0.2424346, -0.2420992, -0.2417635, -0.2414278, -0.2410919, -0.2407558, -0.2404197, -0.2400833, 
--0.2397469, -0.2394103, -0.2390735, -0.2387366, -0.2383996, -0.2380624, -0.2377251, -0.2373877, -0.2370501, -0.2367124, 
--0.2363745, -0.2360365, -0.2356984, -0.2353601, -0.2350217, -0.2346831, -0.2343444, -0.2340056, -0.2336666, -0.2333275, 
--0.2329882, -0.2326489, -0.2323093, -0.2319697, -0.2316299, -0.23129, -0.2309499, -0.2306097, -0.2302694, -0.2299289, 
--0.2295883, -0.2292475, -0.2289067, -0.2285656, -0.2282245, -0.2278832, -0.2275418, -0.2272002, -0.2268586, -0.2265167, 
--0.2261748, -0.2258327, -0.2254905, -0.2251481, -0.2248057, -0.2244631, -0.2241203, -0.2237774, -0.2234344, -0.2230913, 
--0.222748, -0.2224046, -0.2220611, -0.2217174, -0.2213736, -0.2210297, -0.2206856, -0.2203414, -0.2199971, -0.2196527, 
--0.2193081, -0.2189634, -0.2186186, -0.2182736, -0.2179285, -0.2175833, -0.217238, -0.2168925, -0.2165469, -0.2162012, 
--0.2158553, -0.2155093, -0.2151632, -0.214817, -0.2144706, -0.2141242, -0.2137775, -0.2134308, -0.2130839, -0.212737, 
--0.2123898, -0.2120426, -0.2116952, -0.2113477, -0.2110001, -0.2106524, -0.2103045, -0.2099566, -0.2096084, -0.2092602, 
--0.2089119, -0.2085634, -0.2082148, -0.2078661, -0.2075172, -0.2071682, -0.2068192, -0.2064699, -0.2061206, -0.2057712, 
--0.2054216, -0.2050719, -0.2047221, -0.2043721, -0.2040221, -0.2036719, -0.2033216, -0.2029712, -0.2026207, -0.20227, 
--0.2019192, -0.2015683, -0.2012173, -0.2008662, -0.2005149, -0.2001636, -0.1998121, -0.1994605, -0.1991088, -0.1987569, 
--0.198405, -0.1980529, -0.1977007, -0.1973484, -0.196996, -0.1966435, -0.1962908, -0.1959381, -0.1955852, -0.1952322, 
--0.1948791, -0.1945259, -0.1941725, -0.1938191, -0.1934655, -0.1931118, -0.192758, -0.1924041, -0.1920501, -0.191696, 
--0.1913417, -0.1909874, -0.1906329, -0.1902783, -0.1899236, -0.1895688, -0.1892139, -0.1888588, -0.1885037, -0.1881485, 
--0.1877931, -0.1874376, -0.187082, -0.1867263, -0.1863705, -0.1860146, -0.1856586, -0.1853025, -0.1849462, -0.1845899, 
--0.1842334, -0.1838768, -0.1835202, -0.1831634, -0.1828065, -0.1824495, -0.1820924, -0.1817352, -0.1813779, -0.1810204, 
--0.1806629, -0.1803053, -0.1799475, -0.1795897, -0.1792317, -0.1788736, -0.1785155, -0.1781572, -0.1777988, -0.1774403, 
--0.1770818, -0.1767231, -0.1763643, -0.1760054, -0.1756464, -0.1752873, -0.1749281, -0.1745688, -0.1742093, -0.1738498, 
--0.1734902, -0.1731305, -0.1727707, -0.1724107, -0.1720507, -0.1716906, -0.1713304, -0.17097, -0.1706096, -0.1702491, 
--0.1698884, -0.1695277, -0.1691669, -0.168806, -0.1684449, -0.1680838, -0.1677226, -0.1673612, -0.1669998, -0.1666383, 
--0.1662767, -0.165915, -0.1655532, -0.1651912, -0.1648292, -0.1644671, -0.1641049, -0.1637426, -0.1633802, -0.1630177, 
--0.1626551, -0.1622925, -0.1619297, -0.1615668, -0.1612038, -0.1608408, -0.1604776, -0.1601144, -0.159751, -0.1593876, 
--0.159024, -0.1586604, -0.1582967, -0.1579329, -0.157569, -0.157205, -0.1568409, -0.1564767, -0.1561124, -0.155748, 
--0.1553836, -0.155019, -0.1546544, -0.1542896, -0.1539248, -0.1535599, -0.1531949, -0.1528298, -0.1524646, -0.1520993, 
--0.151734, -0.1513685, -0.151003, -0.1506373, -0.1502716, -0.1499058, -0.1495399, -0.1491739, -0.1488079, -0.1484417, 
--0.1480754, -0.1477091, -0.1473427, -0.1469762, -0.1466096, -0.1462429, -0.1458761, -0.1455093, -0.1451423, -0.1447753, 
--0.1444082, -0.144041, -0.1436737, -0.1433064, -0.1429389, -0.1425714, -0.1422038, -0.1418361, -0.1414683, -0.1411004, 
--0.1407325, -0.1403644, -0.1399963, -0.1396281, -0.1392598, -0.1388915, -0.138523, -0.1381545, -0.1377859, -0.1374172, 
--0.1370485, -0.1366796, -0.1363107, -0.1359417, -0.1355726, -0.1352034, -0.1348342, -0.1344648, -0.1340954, -0.1337259, 
--0.1333564, -0.1329867, -0.132617, -0.1322472, -0.1318773, -0.1315074, -0.1311374, -0.1307672, -0.1303971, -0.1300268, 
--0.1296565, -0.129286, -0.1289156, -0.128545, -0.1281743, -0.1278036, -0.1274328, -0.127062, -0.126691, -0.12632, 
--0.1259489, -0.1255777, -0.1252065, -0.1248352, -0.1244638, -0.1240923, -0.1237208, -0.1233492, -0.1229775, -0.1226058, 
--0.122234, -0.1218621, -0.1214901, -0.1211181, -0.1207459, -0.1203738, -0.1200015, -0.1196292, -0.1192568, -0.1188843, 
--0.1185118, -0.1181392, -0.1177665, -0.1173938, -0.117021, -0.1166481, -0.1162752, -0.1159021, -0.1155291, -0.1151559, 
--0.1147827, -0.1144094, -0.114036, -0.1136626, -0.1132891, -0.1129156, -0.112542, -0.1121683, -0.1117945, -0.1114207, 
--0.1110468, -0.1106729, -0.1102988, -0.1099248, -0.1095506, -0.1091764, -0.1088021, -0.1084278, -0.1080534, -0.1076789, 
--0.1073044, -0.1069298, -0.1065552, -0.1061804, -0.1058057, -0.1054308, -0.1050559, -0.104681, -0.1043059, -0.1039308, 
--0.1035557, -0.1031805, -0.1028052, -0.1024299, -0.1020545, -0.101679, -0.1013035, -0.1009279, -0.1005523, -0.1001766, 
--0.0998009, -0.0994251, -0.0990492, -0.0986733, -0.0982973, -0.0979213, -0.0975452, -0.097169, -0.0967928, -0.0964165, 
--0.0960402, -0.0956638, -0.0952874, -0.0949109, -0.0945343, -0.0941577, -0.0937811, -0.0934043, -0.0930276, -0.0926507, 
--0.0922739, -0.0918969, -0.0915199, -0.0911429, -0.0907658, -0.0903887, -0.0900115, -0.0896342, -0.0892569, -0.0888795, 
--0.0885021, -0.0881246, -0.0877471, -0.0873696, -0.0869919, -0.0866143, -0.0862365, -0.0858588, -0.0854809, -0.0851031, 
--0.0847251, -0.0843472, -0.0839691, -0.0835911, -0.083213, -0.0828348, -0.0824566, -0.0820783, -0.0817, -0.0813216, 
--0.0809432, -0.0805647, -0.0801862, -0.0798077, -0.0794291, -0.0790504, -0.0786717, -0.078293, -0.0779142, -0.0775354, 
--0.0771565, -0.0767776, -0.0763986, -0.0760196, -0.0756405, -0.0752614, -0.0748823, -0.0745031, -0.0741238, -0.0737446, 
--0.0733652, -0.0729859, -0.0726065, -0.072227, -0.0718475, -0.071468, -0.0710884, -0.0707088, -0.0703291, -0.0699494, 
--0.0695697, -0.0691899, -0.0688101, -0.0684302, -0.0680503, -0.0676703, -0.0672904, -0.0669103, -0.0665303, -0.0661502, 
--0.06577, -0.0653898, -0.0650096, -0.0646294, -0.0642491, -0.0638687, -0.0634883, -0.0631079, -0.0627275, -0.062347, 
--0.0619665, -0.0615859, -0.0612053, -0.0608247, -0.060444, -0.0600633, -0.0596826, -0.0593018, -0.058921, -0.0585402, 
--0.0581593, -0.0577784, -0.0573975, -0.0570165, -0.0566355, -0.0562544, -0.0558734, -0.0554922, -0.0551111, -0.0547299, 
--0.0543487, -0.0539675, -0.0535862, -0.0532049, -0.0528236, -0.0524422, -0.0520608, -0.0516794, -0.0512979, -0.0509164, 
--0.0505349, -0.0501534, -0.0497718, -0.0493902, -0.0490086, -0.0486269, -0.0482452, -0.0478635, -0.0474817, -0.0471, 
--0.0467182, -0.0463363, -0.0459545, -0.0455726, -0.0451907, -0.0448087, -0.0444268, -0.0440448, -0.0436628, -0.0432807, 
--0.0428987, -0.0425166, -0.0421344, -0.0417523, -0.0413701, -0.0409879, -0.0406057, -0.0402235, -0.0398412, -0.0394589, 
--0.0390766, -0.0386943, -0.0383119, -0.0379296, -0.0375472, -0.0371647, -0.0367823, -0.0363998, -0.0360173, -0.0356348, 
--0.0352523, -0.0348697, -0.0344872, -0.0341046, -0.033722, -0.0333393, -0.0329567, -0.032574, -0.0321913, -0.0318086, 
--0.0314259, -0.0310431, -0.0306604, -0.0302776, -0.0298948, -0.029512, -0.0291291, -0.0287463, -0.0283634, -0.0279805, 
--0.0275976, -0.0272147, -0.0268318, -0.0264488, -0.0260659, -0.0256829, -0.0252999, -0.0249169, -0.0245338, -0.0241508, 
--0.0237677, -0.0233847, -0.0230016, -0.0226185, -0.0222354, -0.0218523, -0.0214691, -0.021086, -0.0207028, -0.0203196, 
--0.0199365, -0.0195533, -0.0191701, -0.0187868, -0.0184036, -0.0180204, -0.0176371, -0.0172539, -0.0168706, -0.0164873, 
--0.016104, -0.0157207, -0.0153374, -0.0149541, -0.0145708, -0.0141874, -0.0138041, -0.0134207, -0.0130374, -0.012654, 
--0.0122706, -0.0118872, -0.0115038, -0.0111204, -0.010737, -0.0103536, -0.0099702, -0.0095868, -0.0092034, -0.0088199, 
--0.0084365, -0.0080531, -0.0076696, -0.0072862, -0.0069027, -0.0065192, -0.0061358, -0.0057523, -0.0053688, -0.0049854, 
--0.0046019, -0.0042184, -0.0038349, -0.0034514, -0.0030679, -0.0026845, -0.002301, -0.0019175, -0.001534, -0.0011505, 
--0.000767, -0.0003835, 0.0, 0.000767, 0.001534, 0.002301, 0.0030679, 0.0038349, 0.0046019, 0.0053688, 
-0.0061358, 0.0069027, 0.0076696, 0.0084365, 0.0092034, 0.0099702, 0.010737, 0.0115038, 0.0122706, 0.0130374, 
-0.0138041, 0.0145708, 0.0153374, 0.016104, 0.0168706, 0.0176371, 0.0184036, 0.0191701, 0.0199365, 0.0207028, 
-0.0214691, 0.0222354, 0.0230016, 0.0237677, 0.0245338, 0.0252999, 0.0260659, 0.0268318, 0.0275976, 0.0283634, 
-0.0291291, 0.0298948, 0.0306604, 0.0314259, 0.0321913, 0.0329567, 0.033722, 0.0344872, 0.0352523, 0.0360173, 
-0.0367823, 0.0375472, 0.0383119, 0.0390766, 0.0398412, 0.0406057, 0.0413701, 0.0421344, 0.0428987, 0.0436628, 
-0.0444268, 0.0451907, 0.0459545, 0.0467182, 0.0474817, 0.0482452, 0.0490086, 0.0497718, 0.0505349, 0.0512979, 
-0.0520608, 0.0528236, 0.0535862, 0.0543487, 0.0551111, 0.0558734, 0.0566355, 0.0573975, 0.0581593, 0.058921, 
-0.0596826, 0.060444, 0.0612053, 0.0619665, 0.0627275, 0.0634883, 0.0642491, 0.0650096, 0.06577, 0.0665303, 
-0.0672904, 0.0680503, 0.0688101, 0.0695697, 0.0703291, 0.0710884, 0.0718475, 0.0726065, 0.0733652, 0.0741238, 
-0.0748823, 0.0756405, 0.0763986, 0.0771565, 0.0779142, 0.0786717, 0.0794291, 0.0801862, 0.0809432, 0.0817, 
-0.0824566, 0.083213, 0.0839691, 0.0847251, 0.0854809, 0.0862365, 0.0869919, 0.0877471, 0.0885021, 0.0892569, 
-0.0900115, 0.0907658, 0.0915199, 0.0922739, 0.0930276, 0.0937811, 0.0945343, 0.0952874, 0.0960402, 0.0967928, 
-0.0975452, 0.0982973, 0.0990492, 0.0998009, 0.1005523, 0.1013035, 0.1020545, 0.1028052, 0.1035557, 0.1043059, 
-0.1050559, 0.1058057, 0.1065552, 0.1073044, 0.1080534, 0.1088021, 0.1095506, 0.1102988, 0.1110468, 0.1117945, 
-0.112542, 0.1132891, 0.114036, 0.1147827, 0.1155291, 0.1162752, 0.117021, 0.1177665, 0.1185118, 0.1192568, 
-0.1200015, 0.1207459, 0.1214901, 0.122234, 0.1229775, 0.1237208, 0.1244638, 0.1252065, 0.1259489, 0.126691, 
-0.1274328, 0.1281743, 0.1289156, 0.1296565, 0.1303971, 0.1311374, 0.1318773, 0.132617, 0.1333564, 0.1340954, 
-0.1348342, 0.1355726, 0.1363107, 0.1370485, 0.1377859, 0.138523, 0.1392598, 0.1399963, 0.1407325, 0.1414683, 
-0.1422038, 0.1429389, 0.1436737, 0.1444082, 0.1451423, 0.1458761, 0.1466096, 0.1473427, 0.1480754, 0.1488079, 
-0.1495399, 0.1502716, 0.151003, 0.151734, 0.1524646, 0.1531949, 0.1539248, 0.1546544, 0.1553836, 0.1561124, 
-0.1568409, 0.157569, 0.1582967, 0.159024, 0.159751, 0.1604776, 0.1612038, 0.1619297, 0.1626551, 0.1633802, 
-0.1641049, 0.1648292, 0.1655532, 0.1662767, 0.1669998, 0.1677226, 0.1684449, 0.1691669, 0.1698884, 0.1706096, 
-0.1713304, 0.1720507, 0.1727707, 0.1734902, 0.1742093, 0.1749281, 0.1756464, 0.1763643, 0.1770818, 0.1777988, 
-0.1785155, 0.1792317, 0.1799475, 0.1806629, 0.1813779, 0.1820924, 0.1828065, 0.1835202, 0.1842334, 0.1849462, 
-0.1856586, 0.1863705, 0.187082, 0.1877931, 0.1885037, 0.1892139, 0.1899236, 0.1906329, 0.1913417, 0.1920501, 
-0.192758, 0.1934655, 0.1941725, 0.1948791, 0.1955852, 0.1962908, 0.196996, 0.1977007, 0.198405, 0.1991088, 
-0.1998121, 0.2005149, 0.2012173, 0.2019192, 0.2026207, 0.2033216, 0.2040221, 0.2047221, 0.2054216, 0.2061206, 
-0.2068192, 0.2075172, 0.2082148, 0.2089119, 0.2096084, 0.2103045, 0.2110001, 0.2116952, 0.2123898, 0.2130839, 
-0.2137775, 0.2144706, 0.2151632, 0.2158553, 0.2165469, 0.217238, 0.2179285, 0.2186186, 0.2193081, 0.2199971, 
-0.2206856, 0.2213736, 0.2220611, 0.222748, 0.2234344, 0.2241203, 0.2248057, 0.2254905, 0.2261748, 0.2268586, 
-0.2275418, 0.2282245, 0.2289067, 0.2295883, 0.2302694, 0.2309499, 0.2316299, 0.2323093, 0.2329882, 0.2336666, 
-0.2343444, 0.2350217, 0.2356984, 0.2363745, 0.2370501, 0.2377251, 0.2383996, 0.2390735, 0.2397469, 0.2404197, 
-0.2410919, 0.2417635, 0.2424346, 0.2431051, 0.2437751, 0.2444444, 0.2451132, 0.2457815, 0.2464491, 0.2471162, 
-0.2477826, 0.2484485, 0.2491138, 0.2497786, 0.2504427, 0.2511062, 0.2517692, 0.2524316, 0.2530933, 0.2537545, 
-0.2544151, 0.255075, 0.2557344, 0.2563932, 0.2570514, 0.2577089, 0.2583659, 0.2590223, 0.259678, 0.2603331, 
-0.2609876, 0.2616416, 0.2622948, 0.2629475, 0.2635996, 0.264251, 0.2649018, 0.265552, 0.2662016, 0.2668505, 
-0.2674988, 0.2681465, 0.2687935, 0.26944, 0.2700857, 0.2707309, 0.2713754, 0.2720193, 0.2726625, 0.2733051, 
-0.273947, 0.2745883, 0.275229, 0.275869, 0.2765084, 0.2771471, 0.2777851, 0.2784225, 0.2790593, 0.2796954, 
-0.2803308, 0.2809656, 0.2815997, 0.2822331, 0.2828659, 0.283498, 0.2841295, 0.2847603, 0.2853904, 0.2860198, 
-0.2866486, 0.2872767, 0.2879041, 0.2885308, 0.2891569, 0.2897823, 0.290407, 0.291031, 0.2916543, 0.292277, 
-0.2928989, 0.2935202, 0.2941408, 0.2947607, 0.2953799, 0.2959983, 0.2966161, 0.2972332, 0.2978497, 0.2984654, 
-0.2990804, 0.2996946, 0.3003082, 0.3009211, 0.3015333, 0.3021448, 0.3027555, 0.3033656, 0.3039749, 0.3045835, 
-0.3051914, 0.3057986, 0.306405, 0.3070108, 0.3076158, 0.3082201, 0.3088237, 0.3094265, 0.3100286, 0.31063, 
-0.3112306, 0.3118306, 0.3124297, 0.3130282, 0.3136259, 0.3142229, 0.3148191, 0.3154146, 0.3160094, 0.3166034, 
-0.3171966, 0.3177892, 0.3183809, 0.318972, 0.3195622, 0.3201517, 0.3207405, 0.3213285, 0.3219158, 0.3225023, 
-0.323088, 0.323673, 0.3242572, 0.3248407, 0.3254233, 0.3260053, 0.3265864, 0.3271668, 0.3277464, 0.3283253, 
-0.3289033, 0.3294806, 0.3300572, 0.3306329, 0.3312079, 0.3317821, 0.3323555, 0.3329281, 0.3335, 0.334071, 
-0.3346413, 0.3352108, 0.3357795, 0.3363474, 0.3369145, 0.3374808, 0.3380464, 0.3386111, 0.339175, 0.3397382, 
-0.3403005, 0.340862, 0.3414228, 0.3419827, 0.3425418, 0.3431002, 0.3436577, 0.3442144, 0.3447703, 0.3453254, 
-0.3458796, 0.3464331, 0.3469857, 0.3475376, 0.3480886, 0.3486388, 0.3491881, 0.3497367, 0.3502844, 0.3508313, 
-0.3513774, 0.3519226, 0.352467, 0.3530106, 0.3535534, 0.3540953, 0.3546364, 0.3551767, 0.3557161, 0.3562547, 
-0.3567924, 0.3573293, 0.3578654, 0.3584006, 0.358935, 0.3594686, 0.3600013, 0.3605331, 0.3610641, 0.3615942, 
-0.3621235, 0.362652, 0.3631796, 0.3637063, 0.3642322, 0.3647572, 0.3652814, 0.3658047, 0.3663271, 0.3668487, 
-0.3673694, 0.3678893, 0.3684083, 0.3689264, 0.3694437, 0.36996, 0.3704756, 0.3709902, 0.371504, 0.3720169, 
-0.3725289, 0.37304, 0.3735503, 0.3740597, 0.3745682, 0.3750758, 0.3755826, 0.3760884, 0.3765934, 0.3770975, 
-0.3776007, 0.378103, 0.3786044, 0.379105, 0.3796046, 0.3801033, 0.3806012, 0.3810981, 0.3815942, 0.3820894, 
-0.3825836, 0.383077, 0.3835695, 0.384061, 0.3845517, 0.3850414, 0.3855303, 0.3860182, 0.3865052, 0.3869913, 
-0.3874766, 0.3879608, 0.3884442, 0.3889267, 0.3894083, 0.3898889, 0.3903686, 0.3908474, 0.3913253, 0.3918023, 
-0.3922783, 0.3927534, 0.3932276, 0.3937009, 0.3941732, 0.3946446, 0.3951151, 0.3955847, 0.3960533, 0.396521, 
-0.3969877, 0.3974536, 0.3979185, 0.3983824, 0.3988454, 0.3993075, 0.3997686, 0.4002288, 0.4006881, 0.4011464, 
-0.4016038, 0.4020602, 0.4025157, 0.4029702, 0.4034238, 0.4038764, 0.4043281, 0.4047788, 0.4052286, 0.4056774, 
-0.4061253, 0.4065722, 0.4070182, 0.4074632, 0.4079072, 0.4083503, 0.4087924, 0.4092336, 0.4096738, 0.410113, 
-0.4105513, 0.4109886, 0.4114249, 0.4118603, 0.4122947, 0.4127281, 0.4131605, 0.413592, 0.4140225, 0.4144521, 
-0.4148806, 0.4153082, 0.4157348, 0.4161604, 0.4165851, 0.4170088, 0.4174314, 0.4178531, 0.4182739, 0.4186936, 
-0.4191124, 0.4195301, 0.4199469, 0.4203627, 0.4207775, 0.4211913, 0.4216041, 0.4220159, 0.4224268, 0.4228366, 
-0.4232455, 0.4236533, 0.4240602, 0.424466, 0.4248709, 0.4252747, 0.4256776, 0.4260795, 0.4264803, 0.4268802, 
-0.427279, 0.4276768, 0.4280737, 0.4284695, 0.4288643, 0.4292581, 0.4296509, 0.4300427, 0.4304335, 0.4308232, 
-0.431212, 0.4315997, 0.4319864, 0.4323721, 0.4327568, 0.4331405, 0.4335231, 0.4339047, 0.4342854, 0.4346649, 
-0.4350435, 0.435421, 0.4357975, 0.436173, 0.4365475, 0.4369209, 0.4372933, 0.4376647, 0.438035, 0.4384044, 
-0.4387726, 0.4391399, 0.4395061, 0.4398713, 0.4402354, 0.4405986, 0.4409606, 0.4413217, 0.4416817, 0.4420406, 
-0.4423985, 0.4427554, 0.4431113, 0.4434661, 0.4438198, 0.4441725, 0.4445242, 0.4448748, 0.4452244, 0.4455729, 
-0.4459204, 0.4462668, 0.4466122, 0.4469565, 0.4472997, 0.447642, 0.4479831, 0.4483232, 0.4486623, 0.4490003, 
-0.4493372, 0.4496731, 0.4500079, 0.4503417, 0.4506744, 0.4510061, 0.4513367, 0.4516662, 0.4519946, 0.452322, 
-0.4526484, 0.4529736, 0.4532979, 0.453621, 0.4539431, 0.4542641, 0.454584, 0.4549029, 0.4552206, 0.4555374, 
-0.455853, 0.4561676, 0.4564811, 0.4567935, 0.4571049, 0.4574152, 0.4577244, 0.4580325, 0.4583395, 0.4586455, 
-0.4589504, 0.4592542, 0.4595569, 0.4598586, 0.4601591, 0.4604586, 0.460757, 0.4610543, 0.4613506, 0.4616457, 
-0.4619398, 0.4622327, 0.4625246, 0.4628154, 0.4631051, 0.4633937, 0.4636813, 0.4639677, 0.464253, 0.4645373, 
-0.4648204, 0.4651025, 0.4653835, 0.4656634, 0.4659421, 0.4662198, 0.4664964, 0.4667719, 0.4670463, 0.4673196, 
-0.4675918, 0.4678628, 0.4681328, 0.4684017, 0.4686695, 0.4689362, 0.4692018, 0.4694662, 0.4697296, 0.4699919, 
-0.470253, 0.4705131, 0.470772, 0.4710299, 0.4712866, 0.4715422, 0.4717967, 0.4720501, 0.4723024, 0.4725536, 
-0.4728037, 0.4730526, 0.4733005, 0.4735472, 0.4737928, 0.4740373, 0.4742807, 0.4745229, 0.4747641, 0.4750041, 
-0.475243, 0.4754808, 0.4757175, 0.4759531, 0.4761875, 0.4764208, 0.476653, 0.4768841, 0.477114, 0.4773429, 
-0.4775706, 0.4777972, 0.4780226, 0.478247, 0.4784702, 0.4786923, 0.4789132, 0.479133, 0.4793517, 0.4795693, 
-0.4797858, 0.4800011, 0.4802153, 0.4804283, 0.4806402, 0.480851, 0.4810607, 0.4812692, 0.4814766, 0.4816829, 
-0.481888, 0.482092, 0.4822949, 0.4824966, 0.4826972, 0.4828967, 0.483095, 0.4832922, 0.4834882, 0.4836831, 
-0.4838769, 0.4840696, 0.484261, 0.4844514, 0.4846406, 0.4848287, 0.4850156, 0.4852014, 0.4853861, 0.4855696, 
-0.4857519, 0.4859332, 0.4861132, 0.4862922, 0.48647, 0.4866466, 0.4868221, 0.4869965, 0.4871697, 0.4873418, 
-0.4875127, 0.4876824, 0.4878511, 0.4880185, 0.4881849, 0.48835, 0.4885141, 0.488677, 0.4888387, 0.4889993, 
-0.4891587, 0.489317, 0.4894741, 0.4896301, 0.4897849, 0.4899386, 0.4900911, 0.4902424, 0.4903926, 0.4905417, 
-0.4906896, 0.4908363, 0.4909819, 0.4911264, 0.4912697, 0.4914118, 0.4915527, 0.4916926, 0.4918312, 0.4919687, 
-0.492105, 0.4922402, 0.4923743, 0.4925071, 0.4926388, 0.4927694, 0.4928988, 0.493027, 0.493154, 0.49328, 
-0.4934047, 0.4935283, 0.4936507, 0.493772, 0.4938921, 0.494011, 0.4941288, 0.4942454, 0.4943608, 0.4944751, 
-0.4945883, 0.4947002, 0.494811, 0.4949206, 0.4950291, 0.4951364, 0.4952425, 0.4953475, 0.4954513, 0.495554, 
-0.4956554, 0.4957557, 0.4958549, 0.4959529, 0.4960497, 0.4961453, 0.4962398, 0.4963331, 0.4964252, 0.4965162, 
-0.496606, 0.4966946, 0.4967821, 0.4968684, 0.4969535, 0.4970374, 0.4971202, 0.4972018, 0.4972823, 0.4973616, 
-0.4974397, 0.4975166, 0.4975924, 0.497667, 0.4977404, 0.4978126, 0.4978837, 0.4979536, 0.4980224, 0.4980899, 
-0.4981563, 0.4982215, 0.4982856, 0.4983484, 0.4984101, 0.4984707, 0.49853, 0.4985882, 0.4986452, 0.4987011, 
-0.4987557, 0.4988092, 0.4988615, 0.4989127, 0.4989626, 0.4990114, 0.4990591, 0.4991055, 0.4991508, 0.4991949, 
-0.4992378, 0.4992795, 0.4993201, 0.4993595, 0.4993977, 0.4994348, 0.4994706, 0.4995053, 0.4995389, 0.4995712, 
-0.4996024, 0.4996324, 0.4996612, 0.4996888, 0.4997153, 0.4997406, 0.4997647, 0.4997876, 0.4998094, 0.49983, 
-0.4998494, 0.4998676, 0.4998847, 0.4999006, 0.4999153, 0.4999288, 0.4999412, 0.4999524, 0.4999624, 0.4999712, 
-0.4999788, 0.4999853, 0.4999906, 0.4999947, 0.4999976, 0.4999994, 0.5, 0.4999994, 0.4999976, 0.4999947, 
-0.4999906, 0.4999853, 0.4999788, 0.4999712, 0.4999624, 0.4999524, 0.4999412, 0.4999288, 0.4999153, 0.4999006, 
-0.4998847, 0.4998676, 0.4998494, 0.49983, 0.4998094, 0.4997876, 0.4997647, 0.4997406, 0.4997153, 0.4996888, 
-0.4996612, 0.4996324, 0.4996024, 0.4995712, 0.4995389, 0.4995053, 0.4994706, 0.4994348, 0.4993977, 0.4993595, 
-0.4993201, 0.4992795, 0.4992378, 0.4991949, 0.4991508, 0.4991055, 0.4990591, 0.4990114, 0.4989626, 0.4989127, 
-0.4988615, 0.4988092, 0.4987557, 0.4987011, 0.4986452, 0.4985882, 0.49853, 0.4984707, 0.4984101, 0.4983484, 
-0.4982856, 0.4982215, 0.4981563, 0.4980899, 0.4980224, 0.4979536, 0.4978837, 0.4978126, 0.4977404, 0.497667, 
-0.4975924, 0.4975166, 0.4974397, 0.4973616, 0.4972823, 0.4972018, 0.4971202, 0.4970374, 0.4969535, 0.4968684, 
-0.4967821, 0.4966946, 0.496606, 0.4965162, 0.4964252, 0.4963331, 0.4962398, 0.4961453, 0.4960497, 0.4959529, 
-0.4958549, 0.4957557, 0.4956554, 0.495554, 0.4954513, 0.4953475, 0.4952425, 0.4951364, 0.4950291, 0.4949206, 
-0.494811, 0.4947002, 0.4945883, 0.4944751, 0.4943608, 0.4942454, 0.4941288, 0.494011, 0.4938921, 0.493772, 
-0.4936507, 0.4935283, 0.4934047, 0.49328, 0.493154, 0.493027, 0.4928988, 0.4927694, 0.4926388, 0.4925071, 
-0.4923743, 0.4922402, 0.492105, 0.4919687, 0.4918312, 0.4916926, 0.4915527, 0.4914118, 0.4912697, 0.4911264, 
-0.4909819, 0.4908363, 0.4906896, 0.4905417, 0.4903926, 0.4902424, 0.4900911, 0.4899386, 0.4897849, 0.4896301, 
-0.4894741, 0.489317, 0.4891587, 0.4889993, 0.4888387, 0.488677, 0.4885141, 0.48835, 0.4881849, 0.4880185, 
-0.4878511, 0.4876824, 0.4875127, 0.4873418, 0.4871697, 0.4869965, 0.4868221, 0.4866466, 0.48647, 0.4862922, 
-0.4861132, 0.4859332, 0.4857519, 0.4855696, 0.4853861, 0.4852014, 0.4850156, 0.4848287, 0.4846406, 0.4844514, 
-0.484261, 0.4840696, 0.4838769, 0.4836831, 0.4834882, 0.4832922, 0.483095, 0.4828967, 0.4826972, 0.4824966, 
-0.4822949, 0.482092, 0.481888, 0.4816829, 0.4814766, 0.4812692, 0.4810607, 0.480851, 0.4806402, 0.4804283, 
-0.4802153, 0.4800011, 0.4797858, 0.4795693, 0.4793517, 0.479133, 0.4789132, 0.4786923, 0.4784702, 0.478247, 
-0.4780226, 0.4777972, 0.4775706, 0.4773429, 0.477114, 0.4768841, 0.476653, 0.4764208, 0.4761875, 0.4759531, 
-0.4757175, 0.4754808, 0.475243, 0.4750041, 0.4747641, 0.4745229, 0.4742807, 0.4740373, 0.4737928, 0.4735472, 
-0.4733005, 0.4730526, 0.4728037, 0.4725536, 0.4723024, 0.4720501, 0.4717967, 0.4715422, 0.4712866, 0.4710299, 
-0.470772, 0.4705131, 0.470253, 0.4699919, 0.4697296, 0.4694662, 0.4692018, 0.4689362, 0.4686695, 0.4684017, 
-0.4681328, 0.4678628, 0.4675918, 0.4673196, 0.4670463, 0.4667719, 0.4664964, 0.4662198, 0.4659421, 0.4656634, 
-0.4653835, 0.4651025, 0.4648204, 0.4645373, 0.464253, 0.4639677, 0.4636813, 0.4633937, 0.4631051, 0.4628154, 
-0.4625246, 0.4622327, 0.4619398, 0.4616457, 0.4613506, 0.4610543, 0.460757, 0.4604586, 0.4601591, 0.4598586, 
-0.4595569, 0.4592542, 0.4589504, 0.4586455, 0.4583395, 0.4580325, 0.4577244, 0.4574152, 0.4571049, 0.4567935, 
-0.4564811, 0.4561676, 0.455853, 0.4555374, 0.4552206, 0.4549029, 0.454584, 0.4542641, 0.4539431, 0.453621, 
-0.4532979, 0.4529736, 0.4526484, 0.452322, 0.4519946, 0.4516662, 0.4513367, 0.4510061, 0.4506744, 0.4503417, 
-0.4500079, 0.4496731, 0.4493372, 0.4490003, 0.4486623, 0.4483232, 0.4479831, 0.447642, 0.4472997, 0.4469565, 
-0.4466122, 0.4462668, 0.4459204, 0.4455729, 0.4452244, 0.4448748, 0.4445242, 0.4441725, 0.4438198, 0.4434661, 
-0.4431113, 0.4427554, 0.4423985, 0.4420406, 0.4416817, 0.4413217, 0.4409606, 0.4405986, 0.4402354, 0.4398713, 
-0.4395061, 0.4391399, 0.4387726, 0.4384044, 0.438035, 0.4376647, 0.4372933, 0.4369209, 0.4365475, 0.436173, 
-0.4357975, 0.435421, 0.4350435, 0.4346649, 0.4342854, 0.4339047, 0.4335231, 0.4331405, 0.4327568, 0.4323721, 
-0.4319864, 0.4315997, 0.431212, 0.4308232, 0.4304335, 0.4300427, 0.4296509, 0.4292581, 0.4288643, 0.4284695, 
-0.4280737, 0.4276768, 0.427279, 0.4268802, 0.4264803, 0.4260795, 0.4256776, 0.4252747, 0.4248709, 0.424466, 
-0.4240602, 0.4236533, 0.4232455, 0.4228366, 0.4224268, 0.4220159, 0.4216041, 0.4211913, 0.4207775, 0.4203627, 
-0.4199469, 0.4195301, 0.4191124, 0.4186936, 0.4182739, 0.4178531, 0.4174314, 0.4170088, 0.4165851, 0.4161604, 
-0.4157348, 0.4153082, 0.4148806, 0.4144521, 0.4140225, 0.413592, 0.4131605, 0.4127281, 0.4122947, 0.4118603, 
-0.4114249, 0.4109886, 0.4105513, 0.410113, 0.4096738, 0.4092336, 0.4087924, 0.4083503, 0.4079072, 0.4074632, 
-0.4070182, 0.4065722, 0.4061253, 0.4056774, 0.4052286, 0.4047788, 0.4043281, 0.4038764, 0.4034238, 0.4029702, 
-0.4025157, 0.4020602, 0.4016038, 0.4011464, 0.4006881, 0.4002288, 0.3997686, 0.3993075, 0.3988454, 0.3983824, 
-0.3979185, 0.3974536, 0.3969877, 0.396521, 0.3960533, 0.3955847, 0.3951151, 0.3946446, 0.3941732, 0.3937009, 
-0.3932276, 0.3927534, 0.3922783, 0.3918023, 0.3913253, 0.3908474, 0.3903686, 0.3898889, 0.3894083, 0.3889267, 
-0.3884442, 0.3879608, 0.3874766, 0.3869913, 0.3865052, 0.3860182, 0.3855303, 0.3850414, 0.3845517, 0.384061, 
-0.3835695, 0.383077, 0.3825836, 0.3820894, 0.3815942, 0.3810981, 0.3806012, 0.3801033, 0.3796046, 0.379105, 
-0.3786044, 0.378103, 0.3776007, 0.3770975, 0.3765934, 0.3760884, 0.3755826, 0.3750758, 0.3745682, 0.3740597, 
-0.3735503, 0.37304, 0.3725289, 0.3720169, 0.371504, 0.3709902, 0.3704756, 0.36996, 0.3694437, 0.3689264, 
-0.3684083, 0.3678893, 0.3673694, 0.3668487, 0.3663271, 0.3658047, 0.3652814, 0.3647572, 0.3642322, 0.3637063, 
-0.3631796, 0.362652, 0.3621235, 0.3615942, 0.3610641, 0.3605331, 0.3600013, 0.3594686, 0.358935, 0.3584006, 
-0.3578654, 0.3573293, 0.3567924, 0.3562547, 0.3557161, 0.3551767, 0.3546364, 0.3540953, 0.3535534, 0.3530106, 
-0.352467, 0.3519226, 0.3513774, 0.3508313, 0.3502844, 0.3497367, 0.3491881, 0.3486388, 0.3480886, 0.3475376, 
-0.3469857, 0.3464331, 0.3458796, 0.3453254, 0.3447703, 0.3442144, 0.3436577, 0.3431002, 0.3425418, 0.3419827, 
-0.3414228, 0.340862, 0.3403005, 0.3397382, 0.339175, 0.3386111, 0.3380464, 0.3374808, 0.3369145, 0.3363474, 
-0.3357795, 0.3352108, 0.3346413, 0.334071, 0.3335, 0.3329281, 0.3323555, 0.3317821, 0.3312079, 0.3306329, 
-0.3300572, 0.3294806, 0.3289033, 0.3283253, 0.3277464, 0.3271668, 0.3265864, 0.3260053, 0.3254233, 0.3248407, 
-0.3242572, 0.323673, 0.323088, 0.3225023, 0.3219158, 0.3213285, 0.3207405, 0.3201517, 0.3195622, 0.318972, 
-0.3183809, 0.3177892, 0.3171966, 0.3166034, 0.3160094, 0.3154146, 0.3148191, 0.3142229, 0.3136259, 0.3130282, 
-0.3124297, 0.3118306, 0.3112306, 0.31063, 0.3100286, 0.3094265, 0.3088237, 0.3082201, 0.3076158, 0.3070108, 
-0.306405, 0.3057986, 0.3051914, 0.3045835, 0.3039749, 0.3033656, 0.3027555, 0.3021448, 0.3015333, 0.3009211, 
-0.3003082, 0.2996946, 0.2990804, 0.2984654, 0.2978497, 0.2972332, 0.2966161, 0.2959983, 0.2953799, 0.2947607, 
-0.2941408, 0.2935202, 0.2928989, 0.292277, 0.2916543, 0.291031, 0.290407, 0.2897823, 0.2891569, 0.2885308, 
-0.2879041, 0.2872767, 0.2866486, 0.2860198, 0.2853904, 0.2847603, 0.2841295, 0.283498, 0.2828659, 0.2822331, 
-0.2815997, 0.2809656, 0.2803308, 0.2796954, 0.2790593, 0.2784225, 0.2777851, 0.2771471, 0.2765084, 0.275869, 
-0.275229, 0.2745883, 0.273947, 0.2733051, 0.2726625, 0.2720193, 0.2713754, 0.2707309, 0.2700857, 0.26944, 
-0.2687935, 0.2681465, 0.2674988, 0.2668505, 0.2662016, 0.265552, 0.2649018, 0.264251, 0.2635996, 0.2629475, 
-0.2622948, 0.2616416, 0.2609876, 0.2603331, 0.259678, 0.2590223, 0.2583659, 0.2577089, 0.2570514, 0.2563932, 
-0.2557344, 0.255075, 0.2544151, 0.2537545, 0.2530933, 0.2524316, 0.2517692, 0.2511062, 0.2504427, 0.2497786, 
-0.2491138, 0.2484485, 0.2477826, 0.2471162, 0.2464491, 0.2457815, 0.2451132, 0.2444444, 0.2437751, 0.2431051, 
-0.2424346, 0.2417635, 0.2410919, 0.2404197, 0.2397469, 0.2390735, 0.2383996, 0.2377251, 0.2370501, 0.2363745, 
-0.2356984, 0.2350217, 0.2343444, 0.2336666, 0.2329882, 0.2323093, 0.2316299, 0.2309499, 0.2302694, 0.2295883, 
-0.2289067, 0.2282245, 0.2275418, 0.2268586, 0.2261748, 0.2254905, 0.2248057, 0.2241203, 0.2234344, 0.222748, 
-0.2220611, 0.2213736, 0.2206856, 0.2199971, 0.2193081, 0.2186186, 0.2179285, 0.217238, 0.2165469, 0.2158553, 
-0.2151632, 0.2144706, 0.2137775, 0.2130839, 0.2123898, 0.2116952, 0.2110001, 0.2103045, 0.2096084, 0.2089119, 
-0.2082148, 0.2075172, 0.2068192, 0.2061206, 0.2054216, 0.2047221, 0.2040221, 0.2033216, 0.2026207, 0.2019192, 
-0.2012173, 0.2005149, 0.1998121, 0.1991088, 0.198405, 0.1977007, 0.196996, 0.1962908, 0.1955852, 0.1948791, 
-0.1941725, 0.1934655, 0.192758, 0.1920501, 0.1913417, 0.1906329, 0.1899236, 0.1892139, 0.1885037, 0.1877931, 
-0.187082, 0.1863705, 0.1856586, 0.1849462, 0.1842334, 0.1835202, 0.1828065, 0.1820924, 0.1813779, 0.1806629, 
-0.1799475, 0.1792317, 0.1785155, 0.1777988, 0.1770818, 0.1763643, 0.1756464, 0.1749281, 0.1742093, 0.1734902, 
-0.1727707, 0.1720507, 0.1713304, 0.1706096, 0.1698884, 0.1691669, 0.1684449, 0.1677226, 0.1669998, 0.1662767, 
-0.1655532, 0.1648292, 0.1641049, 0.1633802, 0.1626551, 0.1619297, 0.1612038, 0.1604776, 0.159751, 0.159024, 
-0.1582967, 0.157569, 0.1568409, 0.1561124, 0.1553836, 0.1546544, 0.1539248, 0.1531949, 0.1524646, 0.151734, 
-0.151003, 0.1502716, 0.1495399, 0.1488079, 0.1480754, 0.1473427, 0.1466096, 0.1458761, 0.1451423, 0.1444082, 
-0.1436737, 0.1429389, 0.1422038, 0.1414683, 0.1407325, 0.1399963, 0.1392598, 0.138523, 0.1377859, 0.1370485, 
-0.1363107, 0.1355726, 0.1348342, 0.1340954, 0.1333564, 0.132617, 0.1318773, 0.1311374, 0.1303971, 0.1296565, 
-0.1289156, 0.1281743, 0.1274328, 0.126691, 0.1259489, 0.1252065, 0.1244638, 0.1237208, 0.1229775, 0.122234, 
-0.1214901, 0.1207459, 0.1200015, 0.1192568, 0.1185118, 0.1177665, 0.117021, 0.1162752, 0.1155291, 0.1147827, 
-0.114036, 0.1132891, 0.112542, 0.1117945, 0.1110468, 0.1102988, 0.1095506, 0.1088021, 0.1080534, 0.1073044, 
-0.1065552, 0.1058057, 0.1050559, 0.1043059, 0.1035557, 0.1028052, 0.1020545, 0.1013035, 0.1005523, 0.0998009, 
-0.0990492, 0.0982973, 0.0975452, 0.0967928, 0.0960402, 0.0952874, 0.0945343, 0.0937811, 0.0930276, 0.0922739, 
-0.0915199, 0.0907658, 0.0900115, 0.0892569, 0.0885021, 0.0877471, 0.0869919, 0.0862365, 0.0854809, 0.0847251, 
-0.0839691, 0.083213, 0.0824566, 0.0817, 0.0809432, 0.0801862, 0.0794291, 0.0786717, 0.0779142, 0.0771565, 
-0.0763986, 0.0756405, 0.0748823, 0.0741238, 0.0733652, 0.0726065, 0.0718475, 0.0710884, 0.0703291, 0.0695697, 
-0.0688101, 0.0680503, 0.0672904, 0.0665303, 0.06577, 0.0650096, 0.0642491, 0.0634883, 0.0627275, 0.0619665, 
-0.0612053, 0.060444, 0.0596826, 0.058921, 0.0581593, 0.0573975, 0.0566355, 0.0558734, 0.0551111, 0.0543487, 
-0.0535862, 0.0528236, 0.0520608, 0.0512979, 0.0505349, 0.0497718, 0.0490086, 0.0482452, 0.0474817, 0.0467182, 
-0.0459545, 0.0451907, 0.0444268, 0.0436628, 0.0428987, 0.0421344, 0.0413701, 0.0406057, 0.0398412, 0.0390766, 
-0.0383119, 0.0375472, 0.0367823, 0.0360173, 0.0352523, 0.0344872, 0.033722, 0.0329567, 0.0321913, 0.0314259, 
-0.0306604, 0.0298948, 0.0291291, 0.0283634, 0.0275976, 0.0268318, 0.0260659, 0.0252999, 0.0245338, 0.0237677, 
-0.0230016, 0.0222354, 0.0214691, 0.0207028, 0.0199365, 0.0191701, 0.0184036, 0.0176371, 0.0168706, 0.016104, 
-0.0153374, 0.0145708, 0.0138041, 0.0130374, 0.0122706, 0.0115038, 0.010737, 0.0099702, 0.0092034, 0.0084365, 
-0.0076696, 0.0069027, 0.0061358, 0.0053688, 0.0046019, 0.0038349, 0.0030679, 0.002301, 0.001534, 0.000767, 
-0.0, -0.000767, -0.001534, -0.002301, -0.0030679, -0.0038349, -0.0046019, -0.0053688, -0.0061358, -0.0069027, 
--0.0076696, -0.0084365, -0.0092034, -0.0099702, -0.010737, -0.0115038, -0.0122706, -0.0130374, -0.0138041, -0.0145708, 
--0.0153374, -0.016104, -0.0168706, -0.0176371, -0.0184036, -0.0191701, -0.0199365, -0.0207028, -0.0214691, -0.0222354, 
--0.0230016, -0.0237677, -0.0245338, -0.0252999, -0.0260659, -0.0268318, -0.0275976, -0.0283634, -0.0291291, -0.0298948, 
--0.0306604, -0.0314259, -0.0321913, -0.0329567, -0.033722, -0.0344872, -0.0352523, -0.0360173, -0.0367823, -0.0375472, 
--0.0383119, -0.0390766, -0.0398412, -0.0406057, -0.0413701, -0.0421344, -0.0428987, -0.0436628, -0.0444268, -0.0451907, 
--0.0459545, -0.0467182, -0.0474817, -0.0482452, -0.0490086, -0.0497718, -0.0505349, -0.0512979, -0.0520608, -0.0528236, 
--0.0535862, -0.0543487, -0.0551111, -0.0558734, -0.0566355, -0.0573975, -0.0581593, -0.058921, -0.0596826, -0.060444, 
--0.0612053, -0.0619665, -0.0627275, -0.0634883, -0.0642491, -0.0650096, -0.06577, -0.0665303, -0.0672904, -0.0680503, 
--0.0688101, -0.0695697, -0.0703291, -0.0710884, -0.0718475, -0.0726065, -0.0733652, -0.0741238, -0.0748823, -0.0756405, 
--0.0763986, -0.0771565, -0.0779142, -0.0786717, -0.0794291, -0.0801862, -0.0809432, -0.0817, -0.0824566, -0.083213, 
--0.0839691, -0.0847251, -0.0854809, -0.0862365, -0.0869919, -0.0877471, -0.0885021, -0.0892569, -0.0900115, -0.0907658, 
--0.0915199, -0.0922739, -0.0930276, -0.0937811, -0.0945343, -0.0952874, -0.0960402, -0.0967928, -0.0975452, -0.0982973, 
--0.0990492, -0.0998009, -0.1005523, -0.1013035, -0.1020545, -0.1028052, -0.1035557, -0.1043059, -0.1050559, -0.1058057, 
--0.1065552, -0.1073044, -0.1080534, -0.1088021, -0.1095506, -0.1102988, -0.1110468, -0.1117945, -0.112542, -0.1132891, 
--0.114036, -0.1147827, -0.1155291, -0.1162752, -0.117021, -0.1177665, -0.1185118, -0.1192568, -0.1200015, -0.1207459, 
--0.1214901, -0.122234, -0.1229775, -0.1237208, -0.1244638, -0.1252065, -0.1259489, -0.126691, -0.1274328, -0.1281743, 
--0.1289156, -0.1296565, -0.1303971, -0.1311374, -0.1318773, -0.132617, -0.1333564, -0.1340954, -0.1348342, -0.1355726, 
--0.1363107, -0.1370485, -0.1377859, -0.138523, -0.1392598, -0.1399963, -0.1407325, -0.1414683, -0.1422038, -0.1429389, 
--0.1436737, -0.1444082, -0.1451423, -0.1458761, -0.1466096, -0.1473427, -0.1480754, -0.1488079, -0.1495399, -0.1502716, 
--0.151003, -0.151734, -0.1524646, -0.1531949, -0.1539248, -0.1546544, -0.1553836, -0.1561124, -0.1568409, -0.157569, 
--0.1582967, -0.159024, -0.159751, -0.1604776, -0.1612038, -0.1619297, -0.1626551, -0.1633802, -0.1641049, -0.1648292, 
--0.1655532, -0.1662767, -0.1669998, -0.1677226, -0.1684449, -0.1691669, -0.1698884, -0.1706096, -0.1713304, -0.1720507, 
--0.1727707, -0.1734902, -0.1742093, -0.1749281, -0.1756464, -0.1763643, -0.1770818, -0.1777988, -0.1785155, -0.1792317, 
--0.1799475, -0.1806629, -0.1813779, -0.1820924, -0.1828065, -0.1835202, -0.1842334, -0.1849462, -0.1856586, -0.1863705, 
--0.187082, -0.1877931, -0.1885037, -0.1892139, -0.1899236, -0.1906329, -0.1913417, -0.1920501, -0.192758, -0.1934655, 
--0.1941725, -0.1948791, -0.1955852, -0.1962908, -0.196996, -0.1977007, -0.198405, -0.1991088, -0.1998121, -0.2005149, 
--0.2012173, -0.2019192, -0.2026207, -0.2033216, -0.2040221, -0.2047221, -0.2054216, -0.2061206, -0.2068192, -0.2075172, 
--0.2082148, -0.2089119, -0.2096084, -0.2103045, -0.2110001, -0.2116952, -0.2123898, -0.2130839, -0.2137775, -0.2144706, 
--0.2151632, -0.2158553, -0.2165469, -0.217238, -0.2179285, -0.2186186, -0.2193081, -0.2199971, -0.2206856, -0.2213736, 
--0.2220611, -0.222748, -0.2234344, -0.2241203, -0.2248057, -0.2254905, -0.2261748, -0.2268586, -0.2275418, -0.2282245, 
--0.2289067, -0.2295883, -0.2302694, -0.2309499, -0.2316299, -0.2323093, -0.2329882, -0.2336666, -0.2343444, -0.2350217, 
--0.2356984, -0.2363745, -0.2370501, -0.2377251, -0.2383996, -0.2390735, -0.2397469, -0.2404197, -0.2410919, -0.2417635, 
--0.2424346, -0.2431051, -0.2437751, -0.2444444, -0.2451132, -0.2457815, -0.2464491, -0.2471162, -0.2477826, -0.2484485, 
--0.2491138, -0.2497786, -0.2504427, -0.2511062, -0.2517692, -0.2524316, -0.2530933, -0.2537545, -0.2544151, -0.255075, 
--0.2557344, -0.2563932, -0.2570514, -0.2577089, -0.2583659, -0.2590223, -0.259678, -0.2603331, -0.2609876, -0.2616416, 
--0.2622948, -0.2629475, -0.2635996, -0.264251, -0.2649018, -0.265552, -0.2662016, -0.2668505, -0.2674988, -0.2681465, 
--0.2687935, -0.26944, -0.2700857, -0.2707309, -0.2713754, -0.2720193, -0.2726625, -0.2733051, -0.273947, -0.2745883, 
--0.275229, -0.275869, -0.2765084, -0.2771471, -0.2777851, -0.2784225, -0.2790593, -0.2796954, -0.2803308, -0.2809656, 
--0.2815997, -0.2822331, -0.2828659, -0.283498, -0.2841295, -0.2847603, -0.2853904, -0.2860198, -0.2866486, -0.2872767, 
--0.2879041, -0.2885308, -0.2891569, -0.2897823, -0.290407, -0.291031, -0.2916543, -0.292277, -0.2928989, -0.2935202, 
--0.2941408, -0.2947607, -0.2953799, -0.2959983, -0.2966161, -0.2972332, -0.2978497, -0.2984654, -0.2990804, -0.2996946, 
--0.3003082, -0.3009211, -0.3015333, -0.3021448, -0.3027555, -0.3033656, -0.3039749, -0.3045835, -0.3051914, -0.3057986, 
--0.306405, -0.3070108, -0.3076158, -0.3082201, -0.3088237, -0.3094265, -0.3100286, -0.31063, -0.3112306, -0.3118306, 
--0.3124297, -0.3130282, -0.3136259, -0.3142229, -0.3148191, -0.3154146, -0.3160094, -0.3166034, -0.3171966, -0.3177892, 
--0.3183809, -0.318972, -0.3195622, -0.3201517, -0.3207405, -0.3213285, -0.3219158, -0.3225023, -0.323088, -0.323673, 
--0.3242572, -0.3248407, -0.3254233, -0.3260053, -0.3265864, -0.3271668, -0.3277464, -0.3283253, -0.3289033, -0.3294806, 
--0.3300572, -0.3306329, -0.3312079, -0.3317821, -0.3323555, -0.3329281, -0.3335, -0.334071, -0.3346413, -0.3352108, 
--0.3357795, -0.3363474, -0.3369145, -0.3374808, -0.3380464, -0.3386111, -0.339175, -0.3397382, -0.3403005, -0.340862, 
--0.3414228, -0.3419827, -0.3425418, -0.3431002, -0.3436577, -0.3442144, -0.3447703, -0.3453254, -0.3458796, -0.3464331, 
--0.3469857, -0.3475376, -0.3480886, -0.3486388, -0.3491881, -0.3497367, -0.3502844, -0.3508313, -0.3513774, -0.3519226, 
--0.352467, -0.3530106, -0.3535534, -0.3540953, -0.3546364, -0.3551767, -0.3557161, -0.3562547, -0.3567924, -0.3573293, 
--0.3578654, -0.3584006, -0.358935, -0.3594686, -0.3600013, -0.3605331, -0.3610641, -0.3615942, -0.3621235, -0.362652, 
--0.3631796, -0.3637063, -0.3642322, -0.3647572, -0.3652814, -0.3658047, -0.3663271, -0.3668487, -0.3673694, -0.3678893, 
--0.3684083, -0.3689264, -0.3694437, -0.36996, -0.3704756, -0.3709902, -0.371504, -0.3720169, -0.3725289, -0.37304, 
--0.3735503, -0.3740597, -0.3745682, -0.3750758, -0.3755826, -0.3760884, -0.3765934, -0.3770975, -0.3776007, -0.378103, 
--0.3786044, -0.379105, -0.3796046, -0.3801033, -0.3806012, -0.3810981, -0.3815942, -0.3820894, -0.3825836, -0.383077, 
--0.3835695, -0.384061, -0.3845517, -0.3850414, -0.3855303, -0.3860182, -0.3865052, -0.3869913, -0.3874766, -0.3879608, 
--0.3884442, -0.3889267, -0.3894083, -0.3898889, -0.3903686, -0.3908474, -0.3913253, -0.3918023, -0.3922783, -0.3927534, 
--0.3932276, -0.3937009, -0.3941732, -0.3946446, -0.3951151, -0.3955847, -0.3960533, -0.396521, -0.3969877, -0.3974536, 
--0.3979185, -0.3983824, -0.3988454, -0.3993075, -0.3997686, -0.4002288, -0.4006881, -0.4011464, -0.4016038, -0.4020602, 
--0.4025157, -0.4029702, -0.4034238, -0.4038764, -0.4043281, -0.4047788, -0.4052286, -0.4056774, -0.4061253, -0.4065722, 
--0.4070182, -0.4074632, -0.4079072, -0.4083503, -0.4087924, -0.4092336, -0.4096738, -0.410113, -0.4105513, -0.4109886, 
--0.4114249, -0.4118603, -0.4122947, -0.4127281, -0.4131605, -0.413592, -0.4140225, -0.4144521, -0.4148806, -0.4153082, 
--0.4157348, -0.4161604, -0.4165851, -0.4170088, -0.4174314, -0.4178531, -0.4182739, -0.4186936, -0.4191124, -0.4195301, 
--0.4199469, -0.4203627, -0.4207775, -0.4211913, -0.4216041, -0.4220159, -0.4224268, -0.4228366, -0.4232455, -0.4236533, 
--0.4240602, -0.424466, -0.4248709, -0.4252747, -0.4256776, -0.4260795, -0.4264803, -0.4268802, -0.427279, -0.4276768, 
--0.4280737, -0.4284695, -0.4288643, -0.4292581, -0.4296509, -0.4300427, -0.4304335, -0.4308232, -0.431212, -0.4315997, 
--0.4319864, -0.4323721, -0.4327568, -0.4331405, -0.4335231, -0.4339047, -0.4342854, -0.4346649, -0.4350435, -0.435421, 
--0.4357975, -0.436173, -0.4365475, -0.4369209, -0.4372933, -0.4376647, -0.438035, -0.4384044, -0.4387726, -0.4391399, 
--0.4395061, -0.4398713, -0.4402354, -0.4405986, -0.4409606, -0.4413217, -0.4416817, -0.4420406, -0.4423985, -0.4427554, 
--0.4431113, -0.4434661, -0.4438198, -0.4441725, -0.4445242, -0.4448748, -0.4452244, -0.4455729, -0.4459204, -0.4462668, 
--0.4466122, -0.4469565, -0.4472997, -0.447642, -0.4479831, -0.4483232, -0.4486623, -0.4490003, -0.4493372, -0.4496731, 
--0.4500079, -0.4503417, -0.4506744, -0.4510061, -0.4513367, -0.4516662, -0.4519946, -0.452322, -0.4526484, -0.4529736, 
--0.4532979, -0.453621, -0.4539431, -0.4542641, -0.454584, -0.4549029, -0.4552206, -0.4555374, -0.455853, -0.4561676, 
--0.4564811, -0.4567935, -0.4571049, -0.4574152, -0.4577244, -0.4580325, -0.4583395, -0.4586455, -0.4589504, -0.4592542, 
--0.4595569, -0.4598586, -0.4601591, -0.4604586, -0.460757, -0.4610543, -0.4613506, -0.4616457, -0.4619398, -0.4622327, 
--0.4625246, -0.4628154, -0.4631051, -0.4633937, -0.4636813, -0.4639677, -0.464253, -0.4645373, -0.4648204, -0.4651025, 
--0.4653835, -0.4656634, -0.4659421, -0.4662198, -0.4664964, -0.4667719, -0.4670463, -0.4673196, -0.4675918, -0.4678628, 
--0.4681328, -0.4684017, -0.4686695, -0.4689362, -0.4692018, -0.4694662, -0.4697296, -0.4699919, -0.470253, -0.4705131, 
--0.470772, -0.4710299, -0.4712866, -0.4715422, -0.4717967, -0.4720501, -0.4723024, -0.4725536, -0.4728037, -0.4730526, 
--0.4733005, -0.4735472, -0.4737928, -0.4740373, -0.4742807, -0.4745229, -0.4747641, -0.4750041, -0.475243, -0.4754808, 
--0.4757175, -0.4759531, -0.4761875, -0.4764208, -0.476653, -0.4768841, -0.477114, -0.4773429, -0.4775706, -0.4777972, 
--0.4780226, -0.478247, -0.4784702, -0.4786923, -0.4789132, -0.479133, -0.4793517, -0.4795693, -0.4797858, -0.4800011, 
--0.4802153, -0.4804283, -0.4806402, -0.480851, -0.4810607, -0.4812692, -0.4814766, -0.4816829, -0.481888, -0.482092, 
--0.4822949, -0.4824966, -0.4826972, -0.4828967, -0.483095, -0.4832922, -0.4834882, -0.4836831, -0.4838769, -0.4840696, 
--0.484261, -0.4844514, -0.4846406, -0.4848287, -0.4850156, -0.4852014, -0.4853861, -0.4855696, -0.4857519, -0.4859332, 
--0.4861132, -0.4862922, -0.48647, -0.4866466, -0.4868221, -0.4869965, -0.4871697, -0.4873418, -0.4875127, -0.4876824, 
--0.4878511, -0.4880185, -0.4881849, -0.48835, -0.4885141, -0.488677, -0.4888387, -0.4889993, -0.4891587, -0.489317, 
--0.4894741, -0.4896301, -0.4897849, -0.4899386, -0.4900911, -0.4902424, -0.4903926, -0.4905417, -0.4906896, -0.4908363, 
--0.4909819, -0.4911264, -0.4912697, -0.4914118, -0.4915527, -0.4916926, -0.4918312, -0.4919687, -0.492105, -0.4922402, 
--0.4923743, -0.4925071, -0.4926388, -0.4927694, -0.4928988, -0.493027, -0.493154, -0.49328, -0.4934047, -0.4935283, 
--0.4936507, -0.493772, -0.4938921, -0.494011, -0.4941288, -0.4942454, -0.4943608, -0.4944751, -0.4945883, -0.4947002, 
--0.494811, -0.4949206, -0.4950291, -0.4951364, -0.4952425, -0.4953475, -0.4954513, -0.495554, -0.4956554, -0.4957557, 
--0.4958549, -0.4959529, -0.4960497, -0.4961453, -0.4962398, -0.4963331, -0.4964252, -0.4965162, -0.496606, -0.4966946, 
--0.4967821, -0.4968684, -0.4969535, -0.4970374, -0.4971202, -0.4972018, -0.4972823, -0.4973616, -0.4974397, -0.4975166, 
--0.4975924, -0.497667, -0.4977404, -0.4978126, -0.4978837, -0.4979536, -0.4980224, -0.4980899, -0.4981563, -0.4982215, 
--0.4982856, -0.4983484, -0.4984101, -0.4984707, -0.49853, -0.4985882, -0.4986452, -0.4987011, -0.4987557, -0.4988092, 
--0.4988615, -0.4989127, -0.4989626, -0.4990114, -0.4990591, -0.4991055, -0.4991508, -0.4991949, -0.4992378, -0.4992795, 
--0.4993201, -0.4993595, -0.4993977, -0.4994348, -0.4994706, -0.4995053, -0.4995389, -0.4995712, -0.4996024, -0.4996324, 
--0.4996612, -0.4996888, -0.4997153, -0.4997406, -0.4997647, -0.4997876, -0.4998094, -0.49983, -0.4998494, -0.4998676, 
--0.4998847, -0.4999006, -0.4999153, -0.4999288, -0.4999412, -0.4999524, -0.4999624, -0.4999712, -0.4999788, -0.4999853, 
--0.4999906, -0.4999947, -0.4999976, -0.4999994, -0.5, -0.4999994, -0.4999976, -0.4999947, -0.4999906, -0.4999853, 
--0.4999788, -0.4999712, -0.4999624, -0.4999524, -0.4999412, -0.4999288, -0.4999153, -0.4999006, -0.4998847, -0.4998676, 
--0.4998494, -0.49983, -0.4998094, -0.4997876, -0.4997647, -0.4997406, -0.4997153, -0.4996888, -0.4996612, -0.4996324, 
--0.4996024, -0.4995712, -0.4995389, -0.4995053, -0.4994706, -0.4994348, -0.4993977, -0.4993595, -0.4993201, -0.4992795, 
--0.4992378, -0.4991949, -0.4991508, -0.4991055, -0.4990591, -0.4990114, -0.4989626, -0.4989127, -0.4988615, -0.4988092, 
--0.4987557, -0.4987011, -0.4986452, -0.4985882, -0.49853, -0.4984707, -0.4984101, -0.4983484, -0.4982856, -0.4982215, 
--0.4981563, -0.4980899, -0.4980224, -0.4979536, -0.4978837, -0.4978126, -0.4977404, -0.497667, -0.4975924, -0.4975166, 
--0.4974397, -0.4973616, -0.4972823, -0.4972018, -0.4971202, -0.4970374, -0.4969535, -0.4968684, -0.4967821, -0.4966946, 
--0.496606, -0.4965162, -0.4964252, -0.4963331, -0.4962398, -0.4961453, -0.4960497, -0.4959529, -0.4958549, -0.4957557, 
--0.4956554, -0.495554, -0.4954513, -0.4953475, -0.4952425, -0.4951364, -0.4950291, -0.4949206, -0.494811, -0.4947002, 
--0.4945883, -0.4944751, -0.4943608, -0.4942454, -0.4941288, -0.494011, -0.4938921, -0.493772, -0.4936507, -0.4935283, 
--0.4934047, -0.49328, -0.493154, -0.493027, -0.4928988, -0.4927694, -0.4926388, -0.4925071, -0.4923743, -0.4922402, 
--0.492105, -0.4919687, -0.4918312, -0.4916926, -0.4915527, -0.4914118, -0.4912697, -0.4911264, -0.4909819, -0.4908363, 
--0.4906896, -0.4905417, -0.4903926, -0.4902424, -0.4900911, -0.4899386, -0.4897849, -0.4896301, -0.4894741, -0.489317, 
--0.4891587, -0.4889993, -0.4888387, -0.488677, -0.4885141, -0.48835, -0.4881849, -0.4880185, -0.4878511, -0.4876824, 
--0.4875127, -0.4873418, -0.4871697, -0.4869965, -0.4868221, -0.4866466, -0.48647, -0.4862922, -0.4861132, -0.4859332, 
--0.4857519, -0.4855696, -0.4853861, -0.4852014, -0.4850156, -0.4848287, -0.4846406, -0.4844514, -0.484261, -0.4840696, 
--0.4838769, -0.4836831, -0.4834882, -0.4832922, -0.483095, -0.4828967, -0.4826972, -0.4824966, -0.4822949, -0.482092, 
--0.481888, -0.4816829, -0.4814766, -0.4812692, -0.4810607, -0.480851, -0.4806402, -0.4804283, -0.4802153, -0.4800011, 
--0.4797858, -0.4795693, -0.4793517, -0.479133, -0.4789132, -0.4786923, -0.4784702, -0.478247, -0.4780226, -0.4777972, 
--0.4775706, -0.4773429, -0.477114, -0.4768841, -0.476653, -0.4764208, -0.4761875, -0.4759531, -0.4757175, -0.4754808, 
--0.475243, -0.4750041, -0.4747641, -0.4745229, -0.4742807, -0.4740373, -0.4737928, -0.4735472, -0.4733005, -0.4730526, 
--0.4728037, -0.4725536, -0.4723024, -0.4720501, -0.4717967, -0.4715422, -0.4712866, -0.4710299, -0.470772, -0.4705131, 
--0.470253, -0.4699919, -0.4697296, -0.4694662, -0.4692018, -0.4689362, -0.4686695, -0.4684017, -0.4681328, -0.4678628, 
--0.4675918, -0.4673196, -0.4670463, -0.4667719, -0.4664964, -0.4662198, -0.4659421, -0.4656634, -0.4653835, -0.4651025, 
--0.4648204, -0.4645373, -0.464253, -0.4639677, -0.4636813, -0.4633937, -0.4631051, -0.4628154, -0.4625246, -0.4622327, 
--0.4619398, -0.4616457, -0.4613506, -0.4610543, -0.460757, -0.4604586, -0.4601591, -0.4598586, -0.4595569, -0.4592542, 
--0.4589504, -0.4586455, -0.4583395, -0.4580325, -0.4577244, -0.4574152, -0.4571049, -0.4567935, -0.4564811, -0.4561676, 
--0.455853, -0.4555374, -0.4552206, -0.4549029, -0.454584, -0.4542641, -0.4539431, -0.453621, -0.4532979, -0.4529736, 
--0.4526484, -0.452322, -0.4519946, -0.4516662, -0.4513367, -0.4510061, -0.4506744, -0.4503417, -0.4500079, -0.4496731, 
--0.4493372, -0.4490003, -0.4486623, -0.4483232, -0.4479831, -0.447642, -0.4472997, -0.4469565, -0.4466122, -0.4462668, 
--0.4459204, -0.4455729, -0.4452244, -0.4448748, -0.4445242, -0.4441725, -0.4438198, -0.4434661, -0.4431113, -0.4427554, 
--0.4423985, -0.4420406, -0.4416817, -0.4413217, -0.4409606, -0.4405986, -0.4402354, -0.4398713, -0.4395061, -0.4391399, 
--0.4387726, -0.4384044, -0.438035, -0.4376647, -0.4372933, -0.4369209, -0.4365475, -0.436173, -0.4357975, -0.435421, 
--0.4350435, -0.4346649, -0.4342854, -0.4339047, -0.4335231, -0.4331405, -0.4327568, -0.4323721, -0.4319864, -0.4315997, 
--0.431212, -0.4308232, -0.4304335, -0.4300427, -0.4296509, -0.4292581, -0.4288643, -0.4284695, -0.4280737, -0.4276768, 
--0.427279, -0.4268802, -0.4264803, -0.4260795, -0.4256776, -0.4252747, -0.4248709, -0.424466, -0.4240602, -0.4236533, 
--0.4232455, -0.4228366, -0.4224268, -0.4220159, -0.4216041, -0.4211913, -0.4207775, -0.4203627, -0.4199469, -0.4195301, 
--0.4191124, -0.4186936, -0.4182739, -0.4178531, -0.4174314, -0.4170088, -0.4165851, -0.4161604, -0.4157348, -0.4153082, 
--0.4148806, -0.4144521, -0.4140225, -0.413592, -0.4131605, -0.4127281, -0.4122947, -0.4118603, -0.4114249, -0.4109886, 
--0.4105513, -0.410113, -0.4096738, -0.4092336, -0.4087924, -0.4083503, -0.4079072, -0.4074632, -0.4070182, -0.4065722, 
--0.4061253, -0.4056774, -0.4052286, -0.4047788, -0.4043281, -0.4038764, -0.4034238, -0.4029702, -0.4025157, -0.4020602, 
--0.4016038, -0.4011464, -0.4006881, -0.4002288, -0.3997686, -0.3993075, -0.3988454, -0.3983824, -0.3979185, -0.3974536, 
--0.3969877, -0.396521, -0.3960533, -0.3955847, -0.3951151, -0.3946446, -0.3941732, -0.3937009, -0.3932276, -0.3927534, 
--0.3922783, -0.3918023, -0.3913253, -0.3908474, -0.3903686, -0.3898889, -0.3894083, -0.3889267, -0.3884442, -0.3879608, 
--0.3874766, -0.3869913, -0.3865052, -0.3860182, -0.3855303, -0.3850414, -0.3845517, -0.384061, -0.3835695, -0.383077, 
--0.3825836, -0.3820894, -0.3815942, -0.3810981, -0.3806012, -0.3801033, -0.3796046, -0.379105, -0.3786044, -0.378103, 
--0.3776007, -0.3770975, -0.3765934, -0.3760884, -0.3755826, -0.3750758, -0.3745682, -0.3740597, -0.3735503, -0.37304, 
--0.3725289, -0.3720169, -0.371504, -0.3709902, -0.3704756, -0.36996, -0.3694437, -0.3689264, -0.3684083, -0.3678893, 
--0.3673694, -0.3668487, -0.3663271, -0.3658047, -0.3652814, -0.3647572, -0.3642322, -0.3637063, -0.3631796, -0.362652, 
--0.3621235, -0.3615942, -0.3610641, -0.3605331, -0.3600013, -0.3594686, -0.358935, -0.3584006, -0.3578654, -0.3573293, 
--0.3567924, -0.3562547, -0.3557161, -0.3551767, -0.3546364, -0.3540953, -0.3535534, -0.3530106, -0.352467, -0.3519226, 
--0.3513774, -0.3508313, -0.3502844, -0.3497367, -0.3491881, -0.3486388, -0.3480886, -0.3475376, -0.3469857, -0.3464331, 
--0.3458796, -0.3453254, -0.3447703, -0.3442144, -0.3436577, -0.3431002, -0.3425418, -0.3419827, -0.3414228, -0.340862, 
--0.3403005, -0.3397382, -0.339175, -0.3386111, -0.3380464, -0.3374808, -0.3369145, -0.3363474, -0.3357795, -0.3352108, 
--0.3346413, -0.334071, -0.3335, -0.3329281, -0.3323555, -0.3317821, -0.3312079, -0.3306329, -0.3300572, -0.3294806, 
--0.3289033, -0.3283253, -0.3277464, -0.3271668, -0.3265864, -0.3260053, -0.3254233, -0.3248407, -0.3242572, -0.323673, 
--0.323088, -0.3225023, -0.3219158, -0.3213285, -0.3207405, -0.3201517, -0.3195622, -0.318972, -0.3183809, -0.3177892, 
--0.3171966, -0.3166034, -0.3160094, -0.3154146, -0.3148191, -0.3142229, -0.3136259, -0.3130282, -0.3124297, -0.3118306, 
--0.3112306, -0.31063, -0.3100286, -0.3094265, -0.3088237, -0.3082201, -0.3076158, -0.3070108, -0.306405, -0.3057986, 
--0.3051914, -0.3045835, -0.3039749, -0.3033656, -0.3027555, -0.3021448, -0.3015333, -0.3009211, -0.3003082, -0.2996946, 
--0.2990804, -0.2984654, -0.2978497, -0.2972332, -0.2966161, -0.2959983, -0.2953799, -0.2947607, -0.2941408, -0.2935202, 
--0.2928989, -0.292277, -0.2916543, -0.291031, -0.290407, -0.2897823, -0.2891569, -0.2885308, -0.2879041, -0.2872767, 
--0.2866486, -0.2860198, -0.2853904, -0.2847603, -0.2841295, -0.283498, -0.2828659, -0.2822331, -0.2815997, -0.2809656, 
--0.2803308, -0.2796954, -0.2790593, -0.2784225, -0.2777851, -0.2771471, -0.2765084, -0.275869, -0.275229, -0.2745883, 
--0.273947, -0.2733051, -0.2726625, -0.2720193, -0.2713754, -0.2707309, -0.2700857, -0.26944, -0.2687935, -0.2681465, 
--0.2674988, -0.2668505, -0.2662016, -0.265552, -0.2649018, -0.264251, -0.2635996, -0.2629475, -0.2622948, -0.2616416, 
--0.2609876, -0.2603331, -0.259678, -0.2590223, -0.2583659, -0.2577089, -0.2570514, -0.2563932, -0.2557344, -0.255075, 
--0.2544151, -0.2537545, -0.2530933, -0.2524316, -0.2517692, -0.2511062, -0.2504427, -0.2497786, -0.2491138, -0.2484485, 
--0.2477826, -0.2471162, -0.2464491, -0.2457815, -0.2451132, -0.2444444, -0.2437751, -0.2431051, -0.2424346, -0.2417635, 
--0.2410919, -0.2404197, -0.2397469, -0.2390735, -0.2383996, -0.2377251, -0.2370501, -0.2363745, -0.2356984, -0.2350217, 
--0.2343444, -0.2336666, -0.2329882, -0.2323093, -0.2316299, -0.2309499, -0.2302694, -0.2295883, -0.2289067, -0.2282245, 
--0.2275418, -0.2268586, -0.2261748, -0.2254905, -0.2248057, -0.2241203, -0.2234344, -0.222748, -0.2220611, -0.2213736, 
--0.2206856, -0.2199971, -0.2193081, -0.2186186, -0.2179285, -0.217238, -0.2165469, -0.2158553, -0.2151632, -0.2144706, 
--0.2137775, -0.2130839, -0.2123898, -0.2116952, -0.2110001, -0.2103045, -0.2096084, -0.2089119, -0.2082148, -0.2075172, 
--0.2068192, -0.2061206, -0.2054216, -0.2047221, -0.2040221, -0.2033216, -0.2026207, -0.2019192, -0.2012173, -0.2005149, 
--0.1998121, -0.1991088, -0.198405, -0.1977007, -0.196996, -0.1962908, -0.1955852, -0.1948791, -0.1941725, -0.1934655, 
--0.192758, -0.1920501, -0.1913417, -0.1906329, -0.1899236, -0.1892139, -0.1885037, -0.1877931, -0.187082, -0.1863705, 
--0.1856586, -0.1849462, -0.1842334, -0.1835202, -0.1828065, -0.1820924, -0.1813779, -0.1806629, -0.1799475, -0.1792317, 
--0.1785155, -0.1777988, -0.1770818, -0.1763643, -0.1756464, -0.1749281, -0.1742093, -0.1734902, -0.1727707, -0.1720507, 
--0.1713304, -0.1706096, -0.1698884, -0.1691669, -0.1684449, -0.1677226, -0.1669998, -0.1662767, -0.1655532, -0.1648292, 
--0.1641049, -0.1633802, -0.1626551, -0.1619297, -0.1612038, -0.1604776, -0.159751, -0.159024, -0.1582967, -0.157569, 
--0.1568409, -0.1561124, -0.1553836, -0.1546544, -0.1539248, -0.1531949, -0.1524646, -0.151734, -0.151003, -0.1502716, 
--0.1495399, -0.1488079, -0.1480754, -0.1473427, -0.1466096, -0.1458761, -0.1451423, -0.1444082, -0.1436737, -0.1429389, 
--0.1422038, -0.1414683, -0.1407325, -0.1399963, -0.1392598, -0.138523, -0.1377859, -0.1370485, -0.1363107, -0.1355726, 
--0.1348342, -0.1340954, -0.1333564, -0.132617, -0.1318773, -0.1311374, -0.1303971, -0.1296565, -0.1289156, -0.1281743, 
--0.1274328, -0.126691, -0.1259489, -0.1252065, -0.1244638, -0.1237208, -0.1229775, -0.122234, -0.1214901, -0.1207459, 
--0.1200015, -0.1192568, -0.1185118, -0.1177665, -0.117021, -0.1162752, -0.1155291, -0.1147827, -0.114036, -0.1132891, 
--0.112542, -0.1117945, -0.1110468, -0.1102988, -0.1095506, -0.1088021, -0.1080534, -0.1073044, -0.1065552, -0.1058057, 
--0.1050559, -0.1043059, -0.1035557, -0.1028052, -0.1020545, -0.1013035, -0.1005523, -0.0998009, -0.0990492, -0.0982973, 
--0.0975452, -0.0967928, -0.0960402, -0.0952874, -0.0945343, -0.0937811, -0.0930276, -0.0922739, -0.0915199, -0.0907658, 
--0.0900115, -0.0892569, -0.0885021, -0.0877471, -0.0869919, -0.0862365, -0.0854809, -0.0847251, -0.0839691, -0.083213, 
--0.0824566, -0.0817, -0.0809432, -0.0801862, -0.0794291, -0.0786717, -0.0779142, -0.0771565, -0.0763986, -0.0756405, 
--0.0748823, -0.0741238, -0.0733652, -0.0726065, -0.0718475, -0.0710884, -0.0703291, -0.0695697, -0.0688101, -0.0680503, 
--0.0672904, -0.0665303, -0.06577, -0.0650096, -0.0642491, -0.0634883, -0.0627275, -0.0619665, -0.0612053, -0.060444, 
--0.0596826, -0.058921, -0.0581593, -0.0573975, -0.0566355, -0.0558734, -0.0551111, -0.0543487, -0.0535862, -0.0528236, 
--0.0520608, -0.0512979, -0.0505349, -0.0497718, -0.0490086, -0.0482452, -0.0474817, -0.0467182, -0.0459545, -0.0451907, 
--0.0444268, -0.0436628, -0.0428987, -0.0421344, -0.0413701, -0.0406057, -0.0398412, -0.0390766, -0.0383119, -0.0375472, 
--0.0367823, -0.0360173, -0.0352523, -0.0344872, -0.033722, -0.0329567, -0.0321913, -0.0314259, -0.0306604, -0.0298948, 
--0.0291291, -0.0283634, -0.0275976, -0.0268318, -0.0260659, -0.0252999, -0.0245338, -0.0237677, -0.0230016, -0.0222354, 
--0.0214691, -0.0207028, -0.0199365, -0.0191701, -0.0184036, -0.0176371, -0.0168706, -0.016104, -0.0153374, -0.0145708, 
--0.0138041, -0.0130374, -0.0122706, -0.0115038, -0.010737, -0.0099702, -0.0092034, -0.0084365, -0.0076696, -0.0069027, 
--0.0061358, -0.0053688, -0.0046019, -0.0038349, -0.0030679, -0.002301, -0.001534, -0.000767, 0.0, 0.001534, 
-0.0030679, 0.0046019, 0.0061358, 0.0076696, 0.0092034, 0.010737, 0.0122706, 0.0138041, 0.0153374, 0.0168706, 
-0.0184036, 0.0199365, 0.0214691, 0.0230016, 0.0245338, 0.0260659, 0.0275976, 0.0291291, 0.0306604, 0.0321913, 
-0.033722, 0.0352523, 0.0367823, 0.0383119, 0.0398412, 0.0413701, 0.0428987, 0.0444268, 0.0459545, 0.0474817, 
-0.0490086, 0.0505349, 0.0520608, 0.0535862, 0.0551111, 0.0566355, 0.0581593, 0.0596826, 0.0612053, 0.0627275, 
-0.0642491, 0.06577, 0.0672904, 0.0688101, 0.0703291, 0.0718475, 0.0733652, 0.0748823, 0.0763986, 0.0779142, 
-0.0794291, 0.0809432, 0.0824566, 0.0839691, 0.0854809, 0.0869919, 0.0885021, 0.0900115, 0.0915199, 0.0930276, 
-0.0945343, 0.0960402, 0.0975452, 0.0990492, 0.1005523, 0.1020545, 0.1035557, 0.1050559, 0.1065552, 0.1080534, 
-0.1095506, 0.1110468, 0.112542, 0.114036, 0.1155291, 0.117021, 0.1185118, 0.1200015, 0.1214901, 0.1229775, 
-0.1244638, 0.1259489, 0.1274328, 0.1289156, 0.1303971, 0.1318773, 0.1333564, 0.1348342, 0.1363107, 0.1377859, 
-0.1392598, 0.1407325, 0.1422038, 0.1436737, 0.1451423, 0.1466096, 0.1480754, 0.1495399, 0.151003, 0.1524646, 
-0.1539248, 0.1553836, 0.1568409, 0.1582967, 0.159751, 0.1612038, 0.1626551, 0.1641049, 0.1655532, 0.1669998, 
-0.1684449, 0.1698884, 0.1713304, 0.1727707, 0.1742093, 0.1756464, 0.1770818, 0.1785155, 0.1799475, 0.1813779, 
-0.1828065, 0.1842334, 0.1856586, 0.187082, 0.1885037, 0.1899236, 0.1913417, 0.192758, 0.1941725, 0.1955852, 
-0.196996, 0.198405, 0.1998121, 0.2012173, 0.2026207, 0.2040221, 0.2054216, 0.2068192, 0.2082148, 0.2096084, 
-0.2110001, 0.2123898, 0.2137775, 0.2151632, 0.2165469, 0.2179285, 0.2193081, 0.2206856, 0.2220611, 0.2234344, 
-0.2248057, 0.2261748, 0.2275418, 0.2289067, 0.2302694, 0.2316299, 0.2329882, 0.2343444, 0.2356984, 0.2370501, 
-0.2383996, 0.2397469, 0.2410919, 0.2424346, 0.2437751, 0.2451132, 0.2464491, 0.2477826, 0.2491138, 0.2504427, 
-0.2517692, 0.2530933, 0.2544151, 0.2557344, 0.2570514, 0.2583659, 0.259678, 0.2609876, 0.2622948, 0.2635996, 
-0.2649018, 0.2662016, 0.2674988, 0.2687935, 0.2700857, 0.2713754, 0.2726625, 0.273947, 0.275229, 0.2765084, 
-0.2777851, 0.2790593, 0.2803308, 0.2815997, 0.2828659, 0.2841295, 0.2853904, 0.2866486, 0.2879041, 0.2891569, 
-0.290407, 0.2916543, 0.2928989, 0.2941408, 0.2953799, 0.2966161, 0.2978497, 0.2990804, 0.3003082, 0.3015333, 
-0.3027555, 0.3039749, 0.3051914, 0.306405, 0.3076158, 0.3088237, 0.3100286, 0.3112306, 0.3124297, 0.3136259, 
-0.3148191, 0.3160094, 0.3171966, 0.3183809, 0.3195622, 0.3207405, 0.3219158, 0.323088, 0.3242572, 0.3254233, 
-0.3265864, 0.3277464, 0.3289033, 0.3300572, 0.3312079, 0.3323555, 0.3335, 0.3346413, 0.3357795, 0.3369145, 
-0.3380464, 0.339175, 0.3403005, 0.3414228, 0.3425418, 0.3436577, 0.3447703, 0.3458796, 0.3469857, 0.3480886, 
-0.3491881, 0.3502844, 0.3513774, 0.352467, 0.3535534, 0.3546364, 0.3557161, 0.3567924, 0.3578654, 0.358935, 
-0.3600013, 0.3610641, 0.3621235, 0.3631796, 0.3642322, 0.3652814, 0.3663271, 0.3673694, 0.3684083, 0.3694437, 
-0.3704756, 0.371504, 0.3725289, 0.3735503, 0.3745682, 0.3755826, 0.3765934, 0.3776007, 0.3786044, 0.3796046, 
-0.3806012, 0.3815942, 0.3825836, 0.3835695, 0.3845517, 0.3855303, 0.3865052, 0.3874766, 0.3884442, 0.3894083, 
-0.3903686, 0.3913253, 0.3922783, 0.3932276, 0.3941732, 0.3951151, 0.3960533, 0.3969877, 0.3979185, 0.3988454, 
-0.3997686, 0.4006881, 0.4016038, 0.4025157, 0.4034238, 0.4043281, 0.4052286, 0.4061253, 0.4070182, 0.4079072, 
-0.4087924, 0.4096738, 0.4105513, 0.4114249, 0.4122947, 0.4131605, 0.4140225, 0.4148806, 0.4157348, 0.4165851, 
-0.4174314, 0.4182739, 0.4191124, 0.4199469, 0.4207775, 0.4216041, 0.4224268, 0.4232455, 0.4240602, 0.4248709, 
-0.4256776, 0.4264803, 0.427279, 0.4280737, 0.4288643, 0.4296509, 0.4304335, 0.431212, 0.4319864, 0.4327568, 
-0.4335231, 0.4342854, 0.4350435, 0.4357975, 0.4365475, 0.4372933, 0.438035, 0.4387726, 0.4395061, 0.4402354, 
-0.4409606, 0.4416817, 0.4423985, 0.4431113, 0.4438198, 0.4445242, 0.4452244, 0.4459204, 0.4466122, 0.4472997, 
-0.4479831, 0.4486623, 0.4493372, 0.4500079, 0.4506744, 0.4513367, 0.4519946, 0.4526484, 0.4532979, 0.4539431, 
-0.454584, 0.4552206, 0.455853, 0.4564811, 0.4571049, 0.4577244, 0.4583395, 0.4589504, 0.4595569, 0.4601591, 
-0.460757, 0.4613506, 0.4619398, 0.4625246, 0.4631051, 0.4636813, 0.464253, 0.4648204, 0.4653835, 0.4659421, 
-0.4664964, 0.4670463, 0.4675918, 0.4681328, 0.4686695, 0.4692018, 0.4697296, 0.470253, 0.470772, 0.4712866, 
-0.4717967, 0.4723024, 0.4728037, 0.4733005, 0.4737928, 0.4742807, 0.4747641, 0.475243, 0.4757175, 0.4761875, 
-0.476653, 0.477114, 0.4775706, 0.4780226, 0.4784702, 0.4789132, 0.4793517, 0.4797858, 0.4802153, 0.4806402, 
-0.4810607, 0.4814766, 0.481888, 0.4822949, 0.4826972, 0.483095, 0.4834882, 0.4838769, 0.484261, 0.4846406, 
-0.4850156, 0.4853861, 0.4857519, 0.4861132, 0.48647, 0.4868221, 0.4871697, 0.4875127, 0.4878511, 0.4881849, 
-0.4885141, 0.4888387, 0.4891587, 0.4894741, 0.4897849, 0.4900911, 0.4903926, 0.4906896, 0.4909819, 0.4912697, 
-0.4915527, 0.4918312, 0.492105, 0.4923743, 0.4926388, 0.4928988, 0.493154, 0.4934047, 0.4936507, 0.4938921, 
-0.4941288, 0.4943608, 0.4945883, 0.494811, 0.4950291, 0.4952425, 0.4954513, 0.4956554, 0.4958549, 0.4960497, 
-0.4962398, 0.4964252, 0.496606, 0.4967821, 0.4969535, 0.4971202, 0.4972823, 0.4974397, 0.4975924, 0.4977404, 
-0.4978837, 0.4980224, 0.4981563, 0.4982856, 0.4984101, 0.49853, 0.4986452, 0.4987557, 0.4988615, 0.4989626, 
-0.4990591, 0.4991508, 0.4992378, 0.4993201, 0.4993977, 0.4994706, 0.4995389, 0.4996024, 0.4996612, 0.4997153, 
-0.4997647, 0.4998094, 0.4998494, 0.4998847, 0.4999153, 0.4999412, 0.4999624, 0.4999788, 0.4999906, 0.4999976, 
-0.5, 0.4999976, 0.4999906, 0.4999788, 0.4999624, 0.4999412, 0.4999153, 0.4998847, 0.4998494, 0.4998094, 
-0.4997647, 0.4997153, 0.4996612, 0.4996024, 0.4995389, 0.4994706, 0.4993977, 0.4993201, 0.4992378, 0.4991508, 
-0.4990591, 0.4989626, 0.4988615, 0.4987557, 0.4986452, 0.49853, 0.4984101, 0.4982856, 0.4981563, 0.4980224, 
-0.4978837, 0.4977404, 0.4975924, 0.4974397, 0.4972823, 0.4971202, 0.4969535, 0.4967821, 0.496606, 0.4964252, 
-0.4962398, 0.4960497, 0.4958549, 0.4956554, 0.4954513, 0.4952425, 0.4950291, 0.494811, 0.4945883, 0.4943608, 
-0.4941288, 0.4938921, 0.4936507, 0.4934047, 0.493154, 0.4928988, 0.4926388, 0.4923743, 0.492105, 0.4918312, 
-0.4915527, 0.4912697, 0.4909819, 0.4906896, 0.4903926, 0.4900911, 0.4897849, 0.4894741, 0.4891587, 0.4888387, 
-0.4885141, 0.4881849, 0.4878511, 0.4875127, 0.4871697, 0.4868221, 0.48647, 0.4861132, 0.4857519, 0.4853861, 
-0.4850156, 0.4846406, 0.484261, 0.4838769, 0.4834882, 0.483095, 0.4826972, 0.4822949, 0.481888, 0.4814766, 
-0.4810607, 0.4806402, 0.4802153, 0.4797858, 0.4793517, 0.4789132, 0.4784702, 0.4780226, 0.4775706, 0.477114, 
-0.476653, 0.4761875, 0.4757175, 0.475243, 0.4747641, 0.4742807, 0.4737928, 0.4733005, 0.4728037, 0.4723024, 
-0.4717967, 0.4712866, 0.470772, 0.470253, 0.4697296, 0.4692018, 0.4686695, 0.4681328, 0.4675918, 0.4670463, 
-0.4664964, 0.4659421, 0.4653835, 0.4648204, 0.464253, 0.4636813, 0.4631051, 0.4625246, 0.4619398, 0.4613506, 
-0.460757, 0.4601591, 0.4595569, 0.4589504, 0.4583395, 0.4577244, 0.4571049, 0.4564811, 0.455853, 0.4552206, 
-0.454584, 0.4539431, 0.4532979, 0.4526484, 0.4519946, 0.4513367, 0.4506744, 0.4500079, 0.4493372, 0.4486623, 
-0.4479831, 0.4472997, 0.4466122, 0.4459204, 0.4452244, 0.4445242, 0.4438198, 0.4431113, 0.4423985, 0.4416817, 
-0.4409606, 0.4402354, 0.4395061, 0.4387726, 0.438035, 0.4372933, 0.4365475, 0.4357975, 0.4350435, 0.4342854, 
-0.4335231, 0.4327568, 0.4319864, 0.431212, 0.4304335, 0.4296509, 0.4288643, 0.4280737, 0.427279, 0.4264803, 
-0.4256776, 0.4248709, 0.4240602, 0.4232455, 0.4224268, 0.4216041, 0.4207775, 0.4199469, 0.4191124, 0.4182739, 
-0.4174314, 0.4165851, 0.4157348, 0.4148806, 0.4140225, 0.4131605, 0.4122947, 0.4114249, 0.4105513, 0.4096738, 
-0.4087924, 0.4079072, 0.4070182, 0.4061253, 0.4052286, 0.4043281, 0.4034238, 0.4025157, 0.4016038, 0.4006881, 
-0.3997686, 0.3988454, 0.3979185, 0.3969877, 0.3960533, 0.3951151, 0.3941732, 0.3932276, 0.3922783, 0.3913253, 
-0.3903686, 0.3894083, 0.3884442, 0.3874766, 0.3865052, 0.3855303, 0.3845517, 0.3835695, 0.3825836, 0.3815942, 
-0.3806012, 0.3796046, 0.3786044, 0.3776007, 0.3765934, 0.3755826, 0.3745682, 0.3735503, 0.3725289, 0.371504, 
-0.3704756, 0.3694437, 0.3684083, 0.3673694, 0.3663271, 0.3652814, 0.3642322, 0.3631796, 0.3621235, 0.3610641, 
-0.3600013, 0.358935, 0.3578654, 0.3567924, 0.3557161, 0.3546364, 0.3535534, 0.352467, 0.3513774, 0.3502844, 
-0.3491881, 0.3480886, 0.3469857, 0.3458796, 0.3447703, 0.3436577, 0.3425418, 0.3414228, 0.3403005, 0.339175, 
-0.3380464, 0.3369145, 0.3357795, 0.3346413, 0.3335, 0.3323555, 0.3312079, 0.3300572, 0.3289033, 0.3277464, 
-0.3265864, 0.3254233, 0.3242572, 0.323088, 0.3219158, 0.3207405, 0.3195622, 0.3183809, 0.3171966, 0.3160094, 
-0.3148191, 0.3136259, 0.3124297, 0.3112306, 0.3100286, 0.3088237, 0.3076158, 0.306405, 0.3051914, 0.3039749, 
-0.3027555, 0.3015333, 0.3003082, 0.2990804, 0.2978497, 0.2966161, 0.2953799, 0.2941408, 0.2928989, 0.2916543, 
-0.290407, 0.2891569, 0.2879041, 0.2866486, 0.2853904, 0.2841295, 0.2828659, 0.2815997, 0.2803308, 0.2790593, 
-0.2777851, 0.2765084, 0.275229, 0.273947, 0.2726625, 0.2713754, 0.2700857, 0.2687935, 0.2674988, 0.2662016, 
-0.2649018, 0.2635996, 0.2622948, 0.2609876, 0.259678, 0.2583659, 0.2570514, 0.2557344, 0.2544151, 0.2530933, 
-0.2517692, 0.2504427, 0.2491138, 0.2477826, 0.2464491, 0.2451132, 0.2437751, 0.2424346, 0.2410919, 0.2397469, 
-0.2383996, 0.2370501, 0.2356984, 0.2343444, 0.2329882, 0.2316299, 0.2302694, 0.2289067, 0.2275418, 0.2261748, 
-0.2248057, 0.2234344, 0.2220611, 0.2206856, 0.2193081, 0.2179285, 0.2165469, 0.2151632, 0.2137775, 0.2123898, 
-0.2110001, 0.2096084, 0.2082148, 0.2068192, 0.2054216, 0.2040221, 0.2026207, 0.2012173, 0.1998121, 0.198405, 
-0.196996, 0.1955852, 0.1941725, 0.192758, 0.1913417, 0.1899236, 0.1885037, 0.187082, 0.1856586, 0.1842334, 
-0.1828065, 0.1813779, 0.1799475, 0.1785155, 0.1770818, 0.1756464, 0.1742093, 0.1727707, 0.1713304, 0.1698884, 
-0.1684449, 0.1669998, 0.1655532, 0.1641049, 0.1626551, 0.1612038, 0.159751, 0.1582967, 0.1568409, 0.1553836, 
-0.1539248, 0.1524646, 0.151003, 0.1495399, 0.1480754, 0.1466096, 0.1451423, 0.1436737, 0.1422038, 0.1407325, 
-0.1392598, 0.1377859, 0.1363107, 0.1348342, 0.1333564, 0.1318773, 0.1303971, 0.1289156, 0.1274328, 0.1259489, 
-0.1244638, 0.1229775, 0.1214901, 0.1200015, 0.1185118, 0.117021, 0.1155291, 0.114036, 0.112542, 0.1110468, 
-0.1095506, 0.1080534, 0.1065552, 0.1050559, 0.1035557, 0.1020545, 0.1005523, 0.0990492, 0.0975452, 0.0960402, 
-0.0945343, 0.0930276, 0.0915199, 0.0900115, 0.0885021, 0.0869919, 0.0854809, 0.0839691, 0.0824566, 0.0809432, 
-0.0794291, 0.0779142, 0.0763986, 0.0748823, 0.0733652, 0.0718475, 0.0703291, 0.0688101, 0.0672904, 0.06577, 
-0.0642491, 0.0627275, 0.0612053, 0.0596826, 0.0581593, 0.0566355, 0.0551111, 0.0535862, 0.0520608, 0.0505349, 
-0.0490086, 0.0474817, 0.0459545, 0.0444268, 0.0428987, 0.0413701, 0.0398412, 0.0383119, 0.0367823, 0.0352523, 
-0.033722, 0.0321913, 0.0306604, 0.0291291, 0.0275976, 0.0260659, 0.0245338, 0.0230016, 0.0214691, 0.0199365, 
-0.0184036, 0.0168706, 0.0153374, 0.0138041, 0.0122706, 0.010737, 0.0092034, 0.0076696, 0.0061358, 0.0046019, 
-0.0030679, 0.001534, 0.0, -0.001534, -0.0030679, -0.0046019, -0.0061358, -0.0076696, -0.0092034, -0.010737, 
--0.0122706, -0.0138041, -0.0153374, -0.0168706, -0.0184036, -0.0199365, -0.0214691, -0.0230016, -0.0245338, -0.0260659, 
--0.0275976, -0.0291291, -0.0306604, -0.0321913, -0.033722, -0.0352523, -0.0367823, -0.0383119, -0.0398412, -0.0413701, 
--0.0428987, -0.0444268, -0.0459545, -0.0474817, -0.0490086, -0.0505349, -0.0520608, -0.0535862, -0.0551111, -0.0566355, 
--0.0581593, -0.0596826, -0.0612053, -0.0627275, -0.0642491, -0.06577, -0.0672904, -0.0688101, -0.0703291, -0.0718475, 
--0.0733652, -0.0748823, -0.0763986, -0.0779142, -0.0794291, -0.0809432, -0.0824566, -0.0839691, -0.0854809, -0.0869919, 
--0.0885021, -0.0900115, -0.0915199, -0.0930276, -0.0945343, -0.0960402, -0.0975452, -0.0990492, -0.1005523, -0.1020545, 
--0.1035557, -0.1050559, -0.1065552, -0.1080534, -0.1095506, -0.1110468, -0.112542, -0.114036, -0.1155291, -0.117021, 
--0.1185118, -0.1200015, -0.1214901, -0.1229775, -0.1244638, -0.1259489, -0.1274328, -0.1289156, -0.1303971, -0.1318773, 
--0.1333564, -0.1348342, -0.1363107, -0.1377859, -0.1392598, -0.1407325, -0.1422038, -0.1436737, -0.1451423, -0.1466096, 
--0.1480754, -0.1495399, -0.151003, -0.1524646, -0.1539248, -0.1553836, -0.1568409, -0.1582967, -0.159751, -0.1612038, 
--0.1626551, -0.1641049, -0.1655532, -0.1669998, -0.1684449, -0.1698884, -0.1713304, -0.1727707, -0.1742093, -0.1756464, 
--0.1770818, -0.1785155, -0.1799475, -0.1813779, -0.1828065, -0.1842334, -0.1856586, -0.187082, -0.1885037, -0.1899236, 
--0.1913417, -0.192758, -0.1941725, -0.1955852, -0.196996, -0.198405, -0.1998121, -0.2012173, -0.2026207, -0.2040221, 
--0.2054216, -0.2068192, -0.2082148, -0.2096084, -0.2110001, -0.2123898, -0.2137775, -0.2151632, -0.2165469, -0.2179285, 
--0.2193081, -0.2206856, -0.2220611, -0.2234344, -0.2248057, -0.2261748, -0.2275418, -0.2289067, -0.2302694, -0.2316299, 
--0.2329882, -0.2343444, -0.2356984, -0.2370501, -0.2383996, -0.2397469, -0.2410919, -0.2424346, -0.2437751, -0.2451132, 
--0.2464491, -0.2477826, -0.2491138, -0.2504427, -0.2517692, -0.2530933, -0.2544151, -0.2557344, -0.2570514, -0.2583659, 
--0.259678, -0.2609876, -0.2622948, -0.2635996, -0.2649018, -0.2662016, -0.2674988, -0.2687935, -0.2700857, -0.2713754, 
--0.2726625, -0.273947, -0.275229, -0.2765084, -0.2777851, -0.2790593, -0.2803308, -0.2815997, -0.2828659, -0.2841295, 
--0.2853904, -0.2866486, -0.2879041, -0.2891569, -0.290407, -0.2916543, -0.2928989, -0.2941408, -0.2953799, -0.2966161, 
--0.2978497, -0.2990804, -0.3003082, -0.3015333, -0.3027555, -0.3039749, -0.3051914, -0.306405, -0.3076158, -0.3088237, 
--0.3100286, -0.3112306, -0.3124297, -0.3136259, -0.3148191, -0.3160094, -0.3171966, -0.3183809, -0.3195622, -0.3207405, 
--0.3219158, -0.323088, -0.3242572, -0.3254233, -0.3265864, -0.3277464, -0.3289033, -0.3300572, -0.3312079, -0.3323555, 
--0.3335, -0.3346413, -0.3357795, -0.3369145, -0.3380464, -0.339175, -0.3403005, -0.3414228, -0.3425418, -0.3436577, 
--0.3447703, -0.3458796, -0.3469857, -0.3480886, -0.3491881, -0.3502844, -0.3513774, -0.352467, -0.3535534, -0.3546364, 
--0.3557161, -0.3567924, -0.3578654, -0.358935, -0.3600013, -0.3610641, -0.3621235, -0.3631796, -0.3642322, -0.3652814, 
--0.3663271, -0.3673694, -0.3684083, -0.3694437, -0.3704756, -0.371504, -0.3725289, -0.3735503, -0.3745682, -0.3755826, 
--0.3765934, -0.3776007, -0.3786044, -0.3796046, -0.3806012, -0.3815942, -0.3825836, -0.3835695, -0.3845517, -0.3855303, 
--0.3865052, -0.3874766, -0.3884442, -0.3894083, -0.3903686, -0.3913253, -0.3922783, -0.3932276, -0.3941732, -0.3951151, 
--0.3960533, -0.3969877, -0.3979185, -0.3988454, -0.3997686, -0.4006881, -0.4016038, -0.4025157, -0.4034238, -0.4043281, 
--0.4052286, -0.4061253, -0.4070182, -0.4079072, -0.4087924, -0.4096738, -0.4105513, -0.4114249, -0.4122947, -0.4131605, 
--0.4140225, -0.4148806, -0.4157348, -0.4165851, -0.4174314, -0.4182739, -0.4191124, -0.4199469, -0.4207775, -0.4216041, 
--0.4224268, -0.4232455, -0.4240602, -0.4248709, -0.4256776, -0.4264803, -0.427279, -0.4280737, -0.4288643, -0.4296509, 
--0.4304335, -0.431212, -0.4319864, -0.4327568, -0.4335231, -0.4342854, -0.4350435, -0.4357975, -0.4365475, -0.4372933, 
--0.438035, -0.4387726, -0.4395061, -0.4402354, -0.4409606, -0.4416817, -0.4423985, -0.4431113, -0.4438198, -0.4445242, 
--0.4452244, -0.4459204, -0.4466122, -0.4472997, -0.4479831, -0.4486623, -0.4493372, -0.4500079, -0.4506744, -0.4513367, 
--0.4519946, -0.4526484, -0.4532979, -0.4539431, -0.454584, -0.4552206, -0.455853, -0.4564811, -0.4571049, -0.4577244, 
--0.4583395, -0.4589504, -0.4595569, -0.4601591, -0.460757, -0.4613506, -0.4619398, -0.4625246, -0.4631051, -0.4636813, 
--0.464253, -0.4648204, -0.4653835, -0.4659421, -0.4664964, -0.4670463, -0.4675918, -0.4681328, -0.4686695, -0.4692018, 
--0.4697296, -0.470253, -0.470772, -0.4712866, -0.4717967, -0.4723024, -0.4728037, -0.4733005, -0.4737928, -0.4742807, 
--0.4747641, -0.475243, -0.4757175, -0.4761875, -0.476653, -0.477114, -0.4775706, -0.4780226, -0.4784702, -0.4789132, 
--0.4793517, -0.4797858, -0.4802153, -0.4806402, -0.4810607, -0.4814766, -0.481888, -0.4822949, -0.4826972, -0.483095, 
--0.4834882, -0.4838769, -0.484261, -0.4846406, -0.4850156, -0.4853861, -0.4857519, -0.4861132, -0.48647, -0.4868221, 
--0.4871697, -0.4875127, -0.4878511, -0.4881849, -0.4885141, -0.4888387, -0.4891587, -0.4894741, -0.4897849, -0.4900911, 
--0.4903926, -0.4906896, -0.4909819, -0.4912697, -0.4915527, -0.4918312, -0.492105, -0.4923743, -0.4926388, -0.4928988, 
--0.493154, -0.4934047, -0.4936507, -0.4938921, -0.4941288, -0.4943608, -0.4945883, -0.494811, -0.4950291, -0.4952425, 
--0.4954513, -0.4956554, -0.4958549, -0.4960497, -0.4962398, -0.4964252, -0.496606, -0.4967821, -0.4969535, -0.4971202, 
--0.4972823, -0.4974397, -0.4975924, -0.4977404, -0.4978837, -0.4980224, -0.4981563, -0.4982856, -0.4984101, -0.49853, 
--0.4986452, -0.4987557, -0.4988615, -0.4989626, -0.4990591, -0.4991508, -0.4992378, -0.4993201, -0.4993977, -0.4994706, 
--0.4995389, -0.4996024, -0.4996612, -0.4997153, -0.4997647, -0.4998094, -0.4998494, -0.4998847, -0.4999153, -0.4999412, 
--0.4999624, -0.4999788, -0.4999906, -0.4999976, -0.5, -0.4999976, -0.4999906, -0.4999788, -0.4999624, -0.4999412, 
--0.4999153, -0.4998847, -0.4998494, -0.4998094, -0.4997647, -0.4997153, -0.4996612, -0.4996024, -0.4995389, -0.4994706, 
--0.4993977, -0.4993201, -0.4992378, -0.4991508, -0.4990591, -0.4989626, -0.4988615, -0.4987557, -0.4986452, -0.49853, 
--0.4984101, -0.4982856, -0.4981563, -0.4980224, -0.4978837, -0.4977404, -0.4975924, -0.4974397, -0.4972823, -0.4971202, 
--0.4969535, -0.4967821, -0.496606, -0.4964252, -0.4962398, -0.4960497, -0.4958549, -0.4956554, -0.4954513, -0.4952425, 
--0.4950291, -0.494811, -0.4945883, -0.4943608, -0.4941288, -0.4938921, -0.4936507, -0.4934047, -0.493154, -0.4928988, 
--0.4926388, -0.4923743, -0.492105, -0.4918312, -0.4915527, -0.4912697, -0.4909819, -0.4906896, -0.4903926, -0.4900911, 
--0.4897849, -0.4894741, -0.4891587, -0.4888387, -0.4885141, -0.4881849, -0.4878511, -0.4875127, -0.4871697, -0.4868221, 
--0.48647, -0.4861132, -0.4857519, -0.4853861, -0.4850156, -0.4846406, -0.484261, -0.4838769, -0.4834882, -0.483095, 
--0.4826972, -0.4822949, -0.481888, -0.4814766, -0.4810607, -0.4806402, -0.4802153, -0.4797858, -0.4793517, -0.4789132, 
--0.4784702, -0.4780226, -0.4775706, -0.477114, -0.476653, -0.4761875, -0.4757175, -0.475243, -0.4747641, -0.4742807, 
--0.4737928, -0.4733005, -0.4728037, -0.4723024, -0.4717967, -0.4712866, -0.470772, -0.470253, -0.4697296, -0.4692018, 
--0.4686695, -0.4681328, -0.4675918, -0.4670463, -0.4664964, -0.4659421, -0.4653835, -0.4648204, -0.464253, -0.4636813, 
--0.4631051, -0.4625246, -0.4619398, -0.4613506, -0.460757, -0.4601591, -0.4595569, -0.4589504, -0.4583395, -0.4577244, 
--0.4571049, -0.4564811, -0.455853, -0.4552206, -0.454584, -0.4539431, -0.4532979, -0.4526484, -0.4519946, -0.4513367, 
--0.4506744, -0.4500079, -0.4493372, -0.4486623, -0.4479831, -0.4472997, -0.4466122, -0.4459204, -0.4452244, -0.4445242, 
--0.4438198, -0.4431113, -0.4423985, -0.4416817, -0.4409606, -0.4402354, -0.4395061, -0.4387726, -0.438035, -0.4372933, 
--0.4365475, -0.4357975, -0.4350435, -0.4342854, -0.4335231, -0.4327568, -0.4319864, -0.431212, -0.4304335, -0.4296509, 
--0.4288643, -0.4280737, -0.427279, -0.4264803, -0.4256776, -0.4248709, -0.4240602, -0.4232455, -0.4224268, -0.4216041, 
--0.4207775, -0.4199469, -0.4191124, -0.4182739, -0.4174314, -0.4165851, -0.4157348, -0.4148806, -0.4140225, -0.4131605, 
--0.4122947, -0.4114249, -0.4105513, -0.4096738, -0.4087924, -0.4079072, -0.4070182, -0.4061253, -0.4052286, -0.4043281, 
--0.4034238, -0.4025157, -0.4016038, -0.4006881, -0.3997686, -0.3988454, -0.3979185, -0.3969877, -0.3960533, -0.3951151, 
--0.3941732, -0.3932276, -0.3922783, -0.3913253, -0.3903686, -0.3894083, -0.3884442, -0.3874766, -0.3865052, -0.3855303, 
--0.3845517, -0.3835695, -0.3825836, -0.3815942, -0.3806012, -0.3796046, -0.3786044, -0.3776007, -0.3765934, -0.3755826, 
--0.3745682, -0.3735503, -0.3725289, -0.371504, -0.3704756, -0.3694437, -0.3684083, -0.3673694, -0.3663271, -0.3652814, 
--0.3642322, -0.3631796, -0.3621235, -0.3610641, -0.3600013, -0.358935, -0.3578654, -0.3567924, -0.3557161, -0.3546364, 
--0.3535534, -0.352467, -0.3513774, -0.3502844, -0.3491881, -0.3480886, -0.3469857, -0.3458796, -0.3447703, -0.3436577, 
--0.3425418, -0.3414228, -0.3403005, -0.339175, -0.3380464, -0.3369145, -0.3357795, -0.3346413, -0.3335, -0.3323555, 
--0.3312079, -0.3300572, -0.3289033, -0.3277464, -0.3265864, -0.3254233, -0.3242572, -0.323088, -0.3219158, -0.3207405, 
--0.3195622, -0.3183809, -0.3171966, -0.3160094, -0.3148191, -0.3136259, -0.3124297, -0.3112306, -0.3100286, -0.3088237, 
--0.3076158, -0.306405, -0.3051914, -0.3039749, -0.3027555, -0.3015333, -0.3003082, -0.2990804, -0.2978497, -0.2966161, 
--0.2953799, -0.2941408, -0.2928989, -0.2916543, -0.290407, -0.2891569, -0.2879041, -0.2866486, -0.2853904, -0.2841295, 
--0.2828659, -0.2815997, -0.2803308, -0.2790593, -0.2777851, -0.2765084, -0.275229, -0.273947, -0.2726625, -0.2713754, 
--0.2700857, -0.2687935, -0.2674988, -0.2662016, -0.2649018, -0.2635996, -0.2622948, -0.2609876, -0.259678, -0.2583659, 
--0.2570514, -0.2557344, -0.2544151, -0.2530933, -0.2517692, -0.2504427, -0.2491138, -0.2477826, -0.2464491, -0.2451132, 
--0.2437751, -0.2424346, -0.2410919, -0.2397469, -0.2383996, -0.2370501, -0.2356984, -0.2343444, -0.2329882, -0.2316299, 
--0.2302694, -0.2289067, -0.2275418, -0.2261748, -0.2248057, -0.2234344, -0.2220611, -0.2206856, -0.2193081, -0.2179285, 
--0.2165469, -0.2151632, -0.2137775, -0.2123898, -0.2110001, -0.2096084, -0.2082148, -0.2068192, -0.2054216, -0.2040221, 
--0.2026207, -0.2012173, -0.1998121, -0.198405, -0.196996, -0.1955852, -0.1941725, -0.192758, -0.1913417, -0.1899236, 
--0.1885037, -0.187082, -0.1856586, -0.1842334, -0.1828065, -0.1813779, -0.1799475, -0.1785155, -0.1770818, -0.1756464, 
--0.1742093, -0.1727707, -0.1713304, -0.1698884, -0.1684449, -0.1669998, -0.1655532, -0.1641049, -0.1626551, -0.1612038, 
--0.159751, -0.1582967, -0.1568409, -0.1553836, -0.1539248, -0.1524646, -0.151003, -0.1495399, -0.1480754, -0.1466096, 
--0.1451423, -0.1436737, -0.1422038, -0.1407325, -0.1392598, -0.1377859, -0.1363107, -0.1348342, -0.1333564, -0.1318773, 
--0.1303971, -0.1289156, -0.1274328, -0.1259489, -0.1244638, -0.1229775, -0.1214901, -0.1200015, -0.1185118, -0.117021, 
--0.1155291, -0.114036, -0.112542, -0.1110468, -0.1095506, -0.1080534, -0.1065552, -0.1050559, -0.1035557, -0.1020545, 
--0.1005523, -0.0990492, -0.0975452, -0.0960402, -0.0945343, -0.0930276, -0.0915199, -0.0900115, -0.0885021, -0.0869919, 
--0.0854809, -0.0839691, -0.0824566, -0.0809432, -0.0794291, -0.0779142, -0.0763986, -0.0748823, -0.0733652, -0.0718475, 
--0.0703291, -0.0688101, -0.0672904, -0.06577, -0.0642491, -0.0627275, -0.0612053, -0.0596826, -0.0581593, -0.0566355, 
--0.0551111, -0.0535862, -0.0520608, -0.0505349, -0.0490086, -0.0474817, -0.0459545, -0.0444268, -0.0428987, -0.0413701, 
--0.0398412, -0.0383119, -0.0367823, -0.0352523, -0.033722, -0.0321913, -0.0306604, -0.0291291, -0.0275976, -0.0260659, 
--0.0245338, -0.0230016, -0.0214691, -0.0199365, -0.0184036, -0.0168706, -0.0153374, -0.0138041, -0.0122706, -0.010737, 
--0.0092034, -0.0076696, -0.0061358, -0.0046019, -0.0030679, -0.001534, 0.0, 0.0030679, 0.0061358, 0.0092034, 
-0.0122706, 0.0153374, 0.0184036, 0.0214691, 0.0245338, 0.0275976, 0.0306604, 0.033722, 0.0367823, 0.0398412, 
-0.0428987, 0.0459545, 0.0490086, 0.0520608, 0.0551111, 0.0581593, 0.0612053, 0.0642491, 0.0672904, 0.0703291, 
-0.0733652, 0.0763986, 0.0794291, 0.0824566, 0.0854809, 0.0885021, 0.0915199, 0.0945343, 0.0975452, 0.1005523, 
-0.1035557, 0.1065552, 0.1095506, 0.112542, 0.1155291, 0.1185118, 0.1214901, 0.1244638, 0.1274328, 0.1303971, 
-0.1333564, 0.1363107, 0.1392598, 0.1422038, 0.1451423, 0.1480754, 0.151003, 0.1539248, 0.1568409, 0.159751, 
-0.1626551, 0.1655532, 0.1684449, 0.1713304, 0.1742093, 0.1770818, 0.1799475, 0.1828065, 0.1856586, 0.1885037, 
-0.1913417, 0.1941725, 0.196996, 0.1998121, 0.2026207, 0.2054216, 0.2082148, 0.2110001, 0.2137775, 0.2165469, 
-0.2193081, 0.2220611, 0.2248057, 0.2275418, 0.2302694, 0.2329882, 0.2356984, 0.2383996, 0.2410919, 0.2437751, 
-0.2464491, 0.2491138, 0.2517692, 0.2544151, 0.2570514, 0.259678, 0.2622948, 0.2649018, 0.2674988, 0.2700857, 
-0.2726625, 0.275229, 0.2777851, 0.2803308, 0.2828659, 0.2853904, 0.2879041, 0.290407, 0.2928989, 0.2953799, 
-0.2978497, 0.3003082, 0.3027555, 0.3051914, 0.3076158, 0.3100286, 0.3124297, 0.3148191, 0.3171966, 0.3195622, 
-0.3219158, 0.3242572, 0.3265864, 0.3289033, 0.3312079, 0.3335, 0.3357795, 0.3380464, 0.3403005, 0.3425418, 
-0.3447703, 0.3469857, 0.3491881, 0.3513774, 0.3535534, 0.3557161, 0.3578654, 0.3600013, 0.3621235, 0.3642322, 
-0.3663271, 0.3684083, 0.3704756, 0.3725289, 0.3745682, 0.3765934, 0.3786044, 0.3806012, 0.3825836, 0.3845517, 
-0.3865052, 0.3884442, 0.3903686, 0.3922783, 0.3941732, 0.3960533, 0.3979185, 0.3997686, 0.4016038, 0.4034238, 
-0.4052286, 0.4070182, 0.4087924, 0.4105513, 0.4122947, 0.4140225, 0.4157348, 0.4174314, 0.4191124, 0.4207775, 
-0.4224268, 0.4240602, 0.4256776, 0.427279, 0.4288643, 0.4304335, 0.4319864, 0.4335231, 0.4350435, 0.4365475, 
-0.438035, 0.4395061, 0.4409606, 0.4423985, 0.4438198, 0.4452244, 0.4466122, 0.4479831, 0.4493372, 0.4506744, 
-0.4519946, 0.4532979, 0.454584, 0.455853, 0.4571049, 0.4583395, 0.4595569, 0.460757, 0.4619398, 0.4631051, 
-0.464253, 0.4653835, 0.4664964, 0.4675918, 0.4686695, 0.4697296, 0.470772, 0.4717967, 0.4728037, 0.4737928, 
-0.4747641, 0.4757175, 0.476653, 0.4775706, 0.4784702, 0.4793517, 0.4802153, 0.4810607, 0.481888, 0.4826972, 
-0.4834882, 0.484261, 0.4850156, 0.4857519, 0.48647, 0.4871697, 0.4878511, 0.4885141, 0.4891587, 0.4897849, 
-0.4903926, 0.4909819, 0.4915527, 0.492105, 0.4926388, 0.493154, 0.4936507, 0.4941288, 0.4945883, 0.4950291, 
-0.4954513, 0.4958549, 0.4962398, 0.496606, 0.4969535, 0.4972823, 0.4975924, 0.4978837, 0.4981563, 0.4984101, 
-0.4986452, 0.4988615, 0.4990591, 0.4992378, 0.4993977, 0.4995389, 0.4996612, 0.4997647, 0.4998494, 0.4999153, 
-0.4999624, 0.4999906, 0.5, 0.4999906, 0.4999624, 0.4999153, 0.4998494, 0.4997647, 0.4996612, 0.4995389, 
-0.4993977, 0.4992378, 0.4990591, 0.4988615, 0.4986452, 0.4984101, 0.4981563, 0.4978837, 0.4975924, 0.4972823, 
-0.4969535, 0.496606, 0.4962398, 0.4958549, 0.4954513, 0.4950291, 0.4945883, 0.4941288, 0.4936507, 0.493154, 
-0.4926388, 0.492105, 0.4915527, 0.4909819, 0.4903926, 0.4897849, 0.4891587, 0.4885141, 0.4878511, 0.4871697, 
-0.48647, 0.4857519, 0.4850156, 0.484261, 0.4834882, 0.4826972, 0.481888, 0.4810607, 0.4802153, 0.4793517, 
-0.4784702, 0.4775706, 0.476653, 0.4757175, 0.4747641, 0.4737928, 0.4728037, 0.4717967, 0.470772, 0.4697296, 
-0.4686695, 0.4675918, 0.4664964, 0.4653835, 0.464253, 0.4631051, 0.4619398, 0.460757, 0.4595569, 0.4583395, 
-0.4571049, 0.455853, 0.454584, 0.4532979, 0.4519946, 0.4506744, 0.4493372, 0.4479831, 0.4466122, 0.4452244, 
-0.4438198, 0.4423985, 0.4409606, 0.4395061, 0.438035, 0.4365475, 0.4350435, 0.4335231, 0.4319864, 0.4304335, 
-0.4288643, 0.427279, 0.4256776, 0.4240602, 0.4224268, 0.4207775, 0.4191124, 0.4174314, 0.4157348, 0.4140225, 
-0.4122947, 0.4105513, 0.4087924, 0.4070182, 0.4052286, 0.4034238, 0.4016038, 0.3997686, 0.3979185, 0.3960533, 
-0.3941732, 0.3922783, 0.3903686, 0.3884442, 0.3865052, 0.3845517, 0.3825836, 0.3806012, 0.3786044, 0.3765934, 
-0.3745682, 0.3725289, 0.3704756, 0.3684083, 0.3663271, 0.3642322, 0.3621235, 0.3600013, 0.3578654, 0.3557161, 
-0.3535534, 0.3513774, 0.3491881, 0.3469857, 0.3447703, 0.3425418, 0.3403005, 0.3380464, 0.3357795, 0.3335, 
-0.3312079, 0.3289033, 0.3265864, 0.3242572, 0.3219158, 0.3195622, 0.3171966, 0.3148191, 0.3124297, 0.3100286, 
-0.3076158, 0.3051914, 0.3027555, 0.3003082, 0.2978497, 0.2953799, 0.2928989, 0.290407, 0.2879041, 0.2853904, 
-0.2828659, 0.2803308, 0.2777851, 0.275229, 0.2726625, 0.2700857, 0.2674988, 0.2649018, 0.2622948, 0.259678, 
-0.2570514, 0.2544151, 0.2517692, 0.2491138, 0.2464491, 0.2437751, 0.2410919, 0.2383996, 0.2356984, 0.2329882, 
-0.2302694, 0.2275418, 0.2248057, 0.2220611, 0.2193081, 0.2165469, 0.2137775, 0.2110001, 0.2082148, 0.2054216, 
-0.2026207, 0.1998121, 0.196996, 0.1941725, 0.1913417, 0.1885037, 0.1856586, 0.1828065, 0.1799475, 0.1770818, 
-0.1742093, 0.1713304, 0.1684449, 0.1655532, 0.1626551, 0.159751, 0.1568409, 0.1539248, 0.151003, 0.1480754, 
-0.1451423, 0.1422038, 0.1392598, 0.1363107, 0.1333564, 0.1303971, 0.1274328, 0.1244638, 0.1214901, 0.1185118, 
-0.1155291, 0.112542, 0.1095506, 0.1065552, 0.1035557, 0.1005523, 0.0975452, 0.0945343, 0.0915199, 0.0885021, 
-0.0854809, 0.0824566, 0.0794291, 0.0763986, 0.0733652, 0.0703291, 0.0672904, 0.0642491, 0.0612053, 0.0581593, 
-0.0551111, 0.0520608, 0.0490086, 0.0459545, 0.0428987, 0.0398412, 0.0367823, 0.033722, 0.0306604, 0.0275976, 
-0.0245338, 0.0214691, 0.0184036, 0.0153374, 0.0122706, 0.0092034, 0.0061358, 0.0030679, 0.0, -0.0030679, 
--0.0061358, -0.0092034, -0.0122706, -0.0153374, -0.0184036, -0.0214691, -0.0245338, -0.0275976, -0.0306604, -0.033722, 
--0.0367823, -0.0398412, -0.0428987, -0.0459545, -0.0490086, -0.0520608, -0.0551111, -0.0581593, -0.0612053, -0.0642491, 
--0.0672904, -0.0703291, -0.0733652, -0.0763986, -0.0794291, -0.0824566, -0.0854809, -0.0885021, -0.0915199, -0.0945343, 
--0.0975452, -0.1005523, -0.1035557, -0.1065552, -0.1095506, -0.112542, -0.1155291, -0.1185118, -0.1214901, -0.1244638, 
--0.1274328, -0.1303971, -0.1333564, -0.1363107, -0.1392598, -0.1422038, -0.1451423, -0.1480754, -0.151003, -0.1539248, 
--0.1568409, -0.159751, -0.1626551, -0.1655532, -0.1684449, -0.1713304, -0.1742093, -0.1770818, -0.1799475, -0.1828065, 
--0.1856586, -0.1885037, -0.1913417, -0.1941725, -0.196996, -0.1998121, -0.2026207, -0.2054216, -0.2082148, -0.2110001, 
--0.2137775, -0.2165469, -0.2193081, -0.2220611, -0.2248057, -0.2275418, -0.2302694, -0.2329882, -0.2356984, -0.2383996, 
--0.2410919, -0.2437751, -0.2464491, -0.2491138, -0.2517692, -0.2544151, -0.2570514, -0.259678, -0.2622948, -0.2649018, 
--0.2674988, -0.2700857, -0.2726625, -0.275229, -0.2777851, -0.2803308, -0.2828659, -0.2853904, -0.2879041, -0.290407, 
--0.2928989, -0.2953799, -0.2978497, -0.3003082, -0.3027555, -0.3051914, -0.3076158, -0.3100286, -0.3124297, -0.3148191, 
--0.3171966, -0.3195622, -0.3219158, -0.3242572, -0.3265864, -0.3289033, -0.3312079, -0.3335, -0.3357795, -0.3380464, 
--0.3403005, -0.3425418, -0.3447703, -0.3469857, -0.3491881, -0.3513774, -0.3535534, -0.3557161, -0.3578654, -0.3600013, 
--0.3621235, -0.3642322, -0.3663271, -0.3684083, -0.3704756, -0.3725289, -0.3745682, -0.3765934, -0.3786044, -0.3806012, 
--0.3825836, -0.3845517, -0.3865052, -0.3884442, -0.3903686, -0.3922783, -0.3941732, -0.3960533, -0.3979185, -0.3997686, 
--0.4016038, -0.4034238, -0.4052286, -0.4070182, -0.4087924, -0.4105513, -0.4122947, -0.4140225, -0.4157348, -0.4174314, 
--0.4191124, -0.4207775, -0.4224268, -0.4240602, -0.4256776, -0.427279, -0.4288643, -0.4304335, -0.4319864, -0.4335231, 
--0.4350435, -0.4365475, -0.438035, -0.4395061, -0.4409606, -0.4423985, -0.4438198, -0.4452244, -0.4466122, -0.4479831, 
--0.4493372, -0.4506744, -0.4519946, -0.4532979, -0.454584, -0.455853, -0.4571049, -0.4583395, -0.4595569, -0.460757, 
--0.4619398, -0.4631051, -0.464253, -0.4653835, -0.4664964, -0.4675918, -0.4686695, -0.4697296, -0.470772, -0.4717967, 
--0.4728037, -0.4737928, -0.4747641, -0.4757175, -0.476653, -0.4775706, -0.4784702, -0.4793517, -0.4802153, -0.4810607, 
--0.481888, -0.4826972, -0.4834882, -0.484261, -0.4850156, -0.4857519, -0.48647, -0.4871697, -0.4878511, -0.4885141, 
--0.4891587, -0.4897849, -0.4903926, -0.4909819, -0.4915527, -0.492105, -0.4926388, -0.493154, -0.4936507, -0.4941288, 
--0.4945883, -0.4950291, -0.4954513, -0.4958549, -0.4962398, -0.496606, -0.4969535, -0.4972823, -0.4975924, -0.4978837, 
--0.4981563, -0.4984101, -0.4986452, -0.4988615, -0.4990591, -0.4992378, -0.4993977, -0.4995389, -0.4996612, -0.4997647, 
--0.4998494, -0.4999153, -0.4999624, -0.4999906, -0.5, -0.4999906, -0.4999624, -0.4999153, -0.4998494, -0.4997647, 
--0.4996612, -0.4995389, -0.4993977, -0.4992378, -0.4990591, -0.4988615, -0.4986452, -0.4984101, -0.4981563, -0.4978837, 
--0.4975924, -0.4972823, -0.4969535, -0.496606, -0.4962398, -0.4958549, -0.4954513, -0.4950291, -0.4945883, -0.4941288, 
--0.4936507, -0.493154, -0.4926388, -0.492105, -0.4915527, -0.4909819, -0.4903926, -0.4897849, -0.4891587, -0.4885141, 
--0.4878511, -0.4871697, -0.48647, -0.4857519, -0.4850156, -0.484261, -0.4834882, -0.4826972, -0.481888, -0.4810607, 
--0.4802153, -0.4793517, -0.4784702, -0.4775706, -0.476653, -0.4757175, -0.4747641, -0.4737928, -0.4728037, -0.4717967, 
--0.470772, -0.4697296, -0.4686695, -0.4675918, -0.4664964, -0.4653835, -0.464253, -0.4631051, -0.4619398, -0.460757, 
--0.4595569, -0.4583395, -0.4571049, -0.455853, -0.454584, -0.4532979, -0.4519946, -0.4506744, -0.4493372, -0.4479831, 
--0.4466122, -0.4452244, -0.4438198, -0.4423985, -0.4409606, -0.4395061, -0.438035, -0.4365475, -0.4350435, -0.4335231, 
--0.4319864, -0.4304335, -0.4288643, -0.427279, -0.4256776, -0.4240602, -0.4224268, -0.4207775, -0.4191124, -0.4174314, 
--0.4157348, -0.4140225, -0.4122947, -0.4105513, -0.4087924, -0.4070182, -0.4052286, -0.4034238, -0.4016038, -0.3997686, 
--0.3979185, -0.3960533, -0.3941732, -0.3922783, -0.3903686, -0.3884442, -0.3865052, -0.3845517, -0.3825836, -0.3806012, 
--0.3786044, -0.3765934, -0.3745682, -0.3725289, -0.3704756, -0.3684083, -0.3663271, -0.3642322, -0.3621235, -0.3600013, 
--0.3578654, -0.3557161, -0.3535534, -0.3513774, -0.3491881, -0.3469857, -0.3447703, -0.3425418, -0.3403005, -0.3380464, 
--0.3357795, -0.3335, -0.3312079, -0.3289033, -0.3265864, -0.3242572, -0.3219158, -0.3195622, -0.3171966, -0.3148191, 
--0.3124297, -0.3100286, -0.3076158, -0.3051914, -0.3027555, -0.3003082, -0.2978497, -0.2953799, -0.2928989, -0.290407, 
--0.2879041, -0.2853904, -0.2828659, -0.2803308, -0.2777851, -0.275229, -0.2726625, -0.2700857, -0.2674988, -0.2649018, 
--0.2622948, -0.259678, -0.2570514, -0.2544151, -0.2517692, -0.2491138, -0.2464491, -0.2437751, -0.2410919, -0.2383996, 
--0.2356984, -0.2329882, -0.2302694, -0.2275418, -0.2248057, -0.2220611, -0.2193081, -0.2165469, -0.2137775, -0.2110001, 
--0.2082148, -0.2054216, -0.2026207, -0.1998121, -0.196996, -0.1941725, -0.1913417, -0.1885037, -0.1856586, -0.1828065, 
--0.1799475, -0.1770818, -0.1742093, -0.1713304, -0.1684449, -0.1655532, -0.1626551, -0.159751, -0.1568409, -0.1539248, 
--0.151003, -0.1480754, -0.1451423, -0.1422038, -0.1392598, -0.1363107, -0.1333564, -0.1303971, -0.1274328, -0.1244638, 
--0.1214901, -0.1185118, -0.1155291, -0.112542, -0.1095506, -0.1065552, -0.1035557, -0.1005523, -0.0975452, -0.0945343, 
--0.0915199, -0.0885021, -0.0854809, -0.0824566, -0.0794291, -0.0763986, -0.0733652, -0.0703291, -0.0672904, -0.0642491, 
--0.0612053, -0.0581593, -0.0551111, -0.0520608, -0.0490086, -0.0459545, -0.0428987, -0.0398412, -0.0367823, -0.033722, 
--0.0306604, -0.0275976, -0.0245338, -0.0214691, -0.0184036, -0.0153374, -0.0122706, -0.0092034, -0.0061358, -0.0030679, 
-0.0, 0.0061358, 0.0122706, 0.0184036, 0.0245338, 0.0306604, 0.0367823, 0.0428987, 0.0490086, 0.0551111, 
-0.0612053, 0.0672904, 0.0733652, 0.0794291, 0.0854809, 0.0915199, 0.0975452, 0.1035557, 0.1095506, 0.1155291, 
-0.1214901, 0.1274328, 0.1333564, 0.1392598, 0.1451423, 0.151003, 0.1568409, 0.1626551, 0.1684449, 0.1742093, 
-0.1799475, 0.1856586, 0.1913417, 0.196996, 0.2026207, 0.2082148, 0.2137775, 0.2193081, 0.2248057, 0.2302694, 
-0.2356984, 0.2410919, 0.2464491, 0.2517692, 0.2570514, 0.2622948, 0.2674988, 0.2726625, 0.2777851, 0.2828659, 
-0.2879041, 0.2928989, 0.2978497, 0.3027555, 0.3076158, 0.3124297, 0.3171966, 0.3219158, 0.3265864, 0.3312079, 
-0.3357795, 0.3403005, 0.3447703, 0.3491881, 0.3535534, 0.3578654, 0.3621235, 0.3663271, 0.3704756, 0.3745682, 
-0.3786044, 0.3825836, 0.3865052, 0.3903686, 0.3941732, 0.3979185, 0.4016038, 0.4052286, 0.4087924, 0.4122947, 
-0.4157348, 0.4191124, 0.4224268, 0.4256776, 0.4288643, 0.4319864, 0.4350435, 0.438035, 0.4409606, 0.4438198, 
-0.4466122, 0.4493372, 0.4519946, 0.454584, 0.4571049, 0.4595569, 0.4619398, 0.464253, 0.4664964, 0.4686695, 
-0.470772, 0.4728037, 0.4747641, 0.476653, 0.4784702, 0.4802153, 0.481888, 0.4834882, 0.4850156, 0.48647, 
-0.4878511, 0.4891587, 0.4903926, 0.4915527, 0.4926388, 0.4936507, 0.4945883, 0.4954513, 0.4962398, 0.4969535, 
-0.4975924, 0.4981563, 0.4986452, 0.4990591, 0.4993977, 0.4996612, 0.4998494, 0.4999624, 0.5, 0.4999624, 
-0.4998494, 0.4996612, 0.4993977, 0.4990591, 0.4986452, 0.4981563, 0.4975924, 0.4969535, 0.4962398, 0.4954513, 
-0.4945883, 0.4936507, 0.4926388, 0.4915527, 0.4903926, 0.4891587, 0.4878511, 0.48647, 0.4850156, 0.4834882, 
-0.481888, 0.4802153, 0.4784702, 0.476653, 0.4747641, 0.4728037, 0.470772, 0.4686695, 0.4664964, 0.464253, 
-0.4619398, 0.4595569, 0.4571049, 0.454584, 0.4519946, 0.4493372, 0.4466122, 0.4438198, 0.4409606, 0.438035, 
-0.4350435, 0.4319864, 0.4288643, 0.4256776, 0.4224268, 0.4191124, 0.4157348, 0.4122947, 0.4087924, 0.4052286, 
-0.4016038, 0.3979185, 0.3941732, 0.3903686, 0.3865052, 0.3825836, 0.3786044, 0.3745682, 0.3704756, 0.3663271, 
-0.3621235, 0.3578654, 0.3535534, 0.3491881, 0.3447703, 0.3403005, 0.3357795, 0.3312079, 0.3265864, 0.3219158, 
-0.3171966, 0.3124297, 0.3076158, 0.3027555, 0.2978497, 0.2928989, 0.2879041, 0.2828659, 0.2777851, 0.2726625, 
-0.2674988, 0.2622948, 0.2570514, 0.2517692, 0.2464491, 0.2410919, 0.2356984, 0.2302694, 0.2248057, 0.2193081, 
-0.2137775, 0.2082148, 0.2026207, 0.196996, 0.1913417, 0.1856586, 0.1799475, 0.1742093, 0.1684449, 0.1626551, 
-0.1568409, 0.151003, 0.1451423, 0.1392598, 0.1333564, 0.1274328, 0.1214901, 0.1155291, 0.1095506, 0.1035557, 
-0.0975452, 0.0915199, 0.0854809, 0.0794291, 0.0733652, 0.0672904, 0.0612053, 0.0551111, 0.0490086, 0.0428987, 
-0.0367823, 0.0306604, 0.0245338, 0.0184036, 0.0122706, 0.0061358, 0.0, -0.0061358, -0.0122706, -0.0184036, 
--0.0245338, -0.0306604, -0.0367823, -0.0428987, -0.0490086, -0.0551111, -0.0612053, -0.0672904, -0.0733652, -0.0794291, 
--0.0854809, -0.0915199, -0.0975452, -0.1035557, -0.1095506, -0.1155291, -0.1214901, -0.1274328, -0.1333564, -0.1392598, 
--0.1451423, -0.151003, -0.1568409, -0.1626551, -0.1684449, -0.1742093, -0.1799475, -0.1856586, -0.1913417, -0.196996, 
--0.2026207, -0.2082148, -0.2137775, -0.2193081, -0.2248057, -0.2302694, -0.2356984, -0.2410919, -0.2464491, -0.2517692, 
--0.2570514, -0.2622948, -0.2674988, -0.2726625, -0.2777851, -0.2828659, -0.2879041, -0.2928989, -0.2978497, -0.3027555, 
--0.3076158, -0.3124297, -0.3171966, -0.3219158, -0.3265864, -0.3312079, -0.3357795, -0.3403005, -0.3447703, -0.3491881, 
--0.3535534, -0.3578654, -0.3621235, -0.3663271, -0.3704756, -0.3745682, -0.3786044, -0.3825836, -0.3865052, -0.3903686, 
--0.3941732, -0.3979185, -0.4016038, -0.4052286, -0.4087924, -0.4122947, -0.4157348, -0.4191124, -0.4224268, -0.4256776, 
--0.4288643, -0.4319864, -0.4350435, -0.438035, -0.4409606, -0.4438198, -0.4466122, -0.4493372, -0.4519946, -0.454584, 
--0.4571049, -0.4595569, -0.4619398, -0.464253, -0.4664964, -0.4686695, -0.470772, -0.4728037, -0.4747641, -0.476653, 
--0.4784702, -0.4802153, -0.481888, -0.4834882, -0.4850156, -0.48647, -0.4878511, -0.4891587, -0.4903926, -0.4915527, 
--0.4926388, -0.4936507, -0.4945883, -0.4954513, -0.4962398, -0.4969535, -0.4975924, -0.4981563, -0.4986452, -0.4990591, 
--0.4993977, -0.4996612, -0.4998494, -0.4999624, -0.5, -0.4999624, -0.4998494, -0.4996612, -0.4993977, -0.4990591, 
--0.4986452, -0.4981563, -0.4975924, -0.4969535, -0.4962398, -0.4954513, -0.4945883, -0.4936507, -0.4926388, -0.4915527, 
--0.4903926, -0.4891587, -0.4878511, -0.48647, -0.4850156, -0.4834882, -0.481888, -0.4802153, -0.4784702, -0.476653, 
--0.4747641, -0.4728037, -0.470772, -0.4686695, -0.4664964, -0.464253, -0.4619398, -0.4595569, -0.4571049, -0.454584, 
--0.4519946, -0.4493372, -0.4466122, -0.4438198, -0.4409606, -0.438035, -0.4350435, -0.4319864, -0.4288643, -0.4256776, 
--0.4224268, -0.4191124, -0.4157348, -0.4122947, -0.4087924, -0.4052286, -0.4016038, -0.3979185, -0.3941732, -0.3903686, 
--0.3865052, -0.3825836, -0.3786044, -0.3745682, -0.3704756, -0.3663271, -0.3621235, -0.3578654, -0.3535534, -0.3491881, 
--0.3447703, -0.3403005, -0.3357795, -0.3312079, -0.3265864, -0.3219158, -0.3171966, -0.3124297, -0.3076158, -0.3027555, 
--0.2978497, -0.2928989, -0.2879041, -0.2828659, -0.2777851, -0.2726625, -0.2674988, -0.2622948, -0.2570514, -0.2517692, 
--0.2464491, -0.2410919, -0.2356984, -0.2302694, -0.2248057, -0.2193081, -0.2137775, -0.2082148, -0.2026207, -0.196996, 
--0.1913417, -0.1856586, -0.1799475, -0.1742093, -0.1684449, -0.1626551, -0.1568409, -0.151003, -0.1451423, -0.1392598, 
--0.1333564, -0.1274328, -0.1214901, -0.1155291, -0.1095506, -0.1035557, -0.0975452, -0.0915199, -0.0854809, -0.0794291, 
--0.0733652, -0.0672904, -0.0612053, -0.0551111, -0.0490086, -0.0428987, -0.0367823, -0.0306604, -0.0245338, -0.0184036, 
--0.0122706, -0.0061358, 0.0, 0.0122706, 0.0245338, 0.0367823, 0.0490086, 0.0612053, 0.0733652, 0.0854809, 
-0.0975452, 0.1095506, 0.1214901, 0.1333564, 0.1451423, 0.1568409, 0.1684449, 0.1799475, 0.1913417, 0.2026207, 
-0.2137775, 0.2248057, 0.2356984, 0.2464491, 0.2570514, 0.2674988, 0.2777851, 0.2879041, 0.2978497, 0.3076158, 
-0.3171966, 0.3265864, 0.3357795, 0.3447703, 0.3535534, 0.3621235, 0.3704756, 0.3786044, 0.3865052, 0.3941732, 
-0.4016038, 0.4087924, 0.4157348, 0.4224268, 0.4288643, 0.4350435, 0.4409606, 0.4466122, 0.4519946, 0.4571049, 
-0.4619398, 0.4664964, 0.470772, 0.4747641, 0.4784702, 0.481888, 0.4850156, 0.4878511, 0.4903926, 0.4926388, 
-0.4945883, 0.4962398, 0.4975924, 0.4986452, 0.4993977, 0.4998494, 0.5, 0.4998494, 0.4993977, 0.4986452, 
-0.4975924, 0.4962398, 0.4945883, 0.4926388, 0.4903926, 0.4878511, 0.4850156, 0.481888, 0.4784702, 0.4747641, 
-0.470772, 0.4664964, 0.4619398, 0.4571049, 0.4519946, 0.4466122, 0.4409606, 0.4350435, 0.4288643, 0.4224268, 
-0.4157348, 0.4087924, 0.4016038, 0.3941732, 0.3865052, 0.3786044, 0.3704756, 0.3621235, 0.3535534, 0.3447703, 
-0.3357795, 0.3265864, 0.3171966, 0.3076158, 0.2978497, 0.2879041, 0.2777851, 0.2674988, 0.2570514, 0.2464491, 
-0.2356984, 0.2248057, 0.2137775, 0.2026207, 0.1913417, 0.1799475, 0.1684449, 0.1568409, 0.1451423, 0.1333564, 
-0.1214901, 0.1095506, 0.0975452, 0.0854809, 0.0733652, 0.0612053, 0.0490086, 0.0367823, 0.0245338, 0.0122706, 
-0.0, -0.0122706, -0.0245338, -0.0367823, -0.0490086, -0.0612053, -0.0733652, -0.0854809, -0.0975452, -0.1095506, 
--0.1214901, -0.1333564, -0.1451423, -0.1568409, -0.1684449, -0.1799475, -0.1913417, -0.2026207, -0.2137775, -0.2248057, 
--0.2356984, -0.2464491, -0.2570514, -0.2674988, -0.2777851, -0.2879041, -0.2978497, -0.3076158, -0.3171966, -0.3265864, 
--0.3357795, -0.3447703, -0.3535534, -0.3621235, -0.3704756, -0.3786044, -0.3865052, -0.3941732, -0.4016038, -0.4087924, 
--0.4157348, -0.4224268, -0.4288643, -0.4350435, -0.4409606, -0.4466122, -0.4519946, -0.4571049, -0.4619398, -0.4664964, 
--0.470772, -0.4747641, -0.4784702, -0.481888, -0.4850156, -0.4878511, -0.4903926, -0.4926388, -0.4945883, -0.4962398, 
--0.4975924, -0.4986452, -0.4993977, -0.4998494, -0.5, -0.4998494, -0.4993977, -0.4986452, -0.4975924, -0.4962398, 
--0.4945883, -0.4926388, -0.4903926, -0.4878511, -0.4850156, -0.481888, -0.4784702, -0.4747641, -0.470772, -0.4664964, 
--0.4619398, -0.4571049, -0.4519946, -0.4466122, -0.4409606, -0.4350435, -0.4288643, -0.4224268, -0.4157348, -0.4087924, 
--0.4016038, -0.3941732, -0.3865052, -0.3786044, -0.3704756, -0.3621235, -0.3535534, -0.3447703, -0.3357795, -0.3265864, 
--0.3171966, -0.3076158, -0.2978497, -0.2879041, -0.2777851, -0.2674988, -0.2570514, -0.2464491, -0.2356984, -0.2248057, 
--0.2137775, -0.2026207, -0.1913417, -0.1799475, -0.1684449, -0.1568409, -0.1451423, -0.1333564, -0.1214901, -0.1095506, 
--0.0975452, -0.0854809, -0.0733652, -0.0612053, -0.0490086, -0.0367823, -0.0245338, -0.0122706, 0.0, 0.0245338, 
-0.0490086, 0.0733652, 0.0975452, 0.1214901, 0.1451423, 0.1684449, 0.1913417, 0.2137775, 0.2356984, 0.2570514, 
-0.2777851, 0.2978497, 0.3171966, 0.3357795, 0.3535534, 0.3704756, 0.3865052, 0.4016038, 0.4157348, 0.4288643, 
-0.4409606, 0.4519946, 0.4619398, 0.470772, 0.4784702, 0.4850156, 0.4903926, 0.4945883, 0.4975924, 0.4993977, 
-0.5, 0.4993977, 0.4975924, 0.4945883, 0.4903926, 0.4850156, 0.4784702, 0.470772, 0.4619398, 0.4519946, 
-0.4409606, 0.4288643, 0.4157348, 0.4016038, 0.3865052, 0.3704756, 0.3535534, 0.3357795, 0.3171966, 0.2978497, 
-0.2777851, 0.2570514, 0.2356984, 0.2137775, 0.1913417, 0.1684449, 0.1451423, 0.1214901, 0.0975452, 0.0733652, 
-0.0490086, 0.0245338, 0.0, -0.0245338, -0.0490086, -0.0733652, -0.0975452, -0.1214901, -0.1451423, -0.1684449, 
--0.1913417, -0.2137775, -0.2356984, -0.2570514, -0.2777851, -0.2978497, -0.3171966, -0.3357795, -0.3535534, -0.3704756, 
--0.3865052, -0.4016038, -0.4157348, -0.4288643, -0.4409606, -0.4519946, -0.4619398, -0.470772, -0.4784702, -0.4850156, 
--0.4903926, -0.4945883, -0.4975924, -0.4993977, -0.5, -0.4993977, -0.4975924, -0.4945883, -0.4903926, -0.4850156, 
--0.4784702, -0.470772, -0.4619398, -0.4519946, -0.4409606, -0.4288643, -0.4157348, -0.4016038, -0.3865052, -0.3704756, 
--0.3535534, -0.3357795, -0.3171966, -0.2978497, -0.2777851, -0.2570514, -0.2356984, -0.2137775, -0.1913417, -0.1684449, 
--0.1451423, -0.1214901, -0.0975452, -0.0733652, -0.0490086, -0.0245338, 0.0, 0.0490086, 0.0975452, 0.1451423, 
-0.1913417, 0.2356984, 0.2777851, 0.3171966, 0.3535534, 0.3865052, 0.4157348, 0.4409606, 0.4619398, 0.4784702, 
-0.4903926, 0.4975924, 0.5, 0.4975924, 0.4903926, 0.4784702, 0.4619398, 0.4409606, 0.4157348, 0.3865052, 
-0.3535534, 0.3171966, 0.2777851, 0.2356984, 0.1913417, 0.1451423, 0.0975452, 0.0490086, 0.0, -0.0490086, 
--0.0975452, -0.1451423, -0.1913417, -0.2356984, -0.2777851, -0.3171966, -0.3535534, -0.3865052, -0.4157348, -0.4409606, 
--0.4619398, -0.4784702, -0.4903926, -0.4975924, -0.5, -0.4975924, -0.4903926, -0.4784702, -0.4619398, -0.4409606, 
--0.4157348, -0.3865052, -0.3535534, -0.3171966, -0.2777851, -0.2356984, -0.1913417, -0.1451423, -0.0975452, -0.0490086, 
-0.0, 0.0975452, 0.1913417, 0.2777851, 0.3535534, 0.4157348, 0.4619398, 0.4903926, 0.5, 0.4903926, 
-0.4619398, 0.4157348, 0.3535534, 0.2777851, 0.1913417, 0.0975452, 0.0, -0.0975452, -0.1913417, -0.2777851, 
--0.3535534, -0.4157348, -0.4619398, -0.4903926, -0.5, -0.4903926, -0.4619398, -0.4157348, -0.3535534, -0.2777851, 
--0.1913417, -0.0975452, 0.0, 0.1913417, 0.3535534, 0.4619398, 0.5, 0.4619398, 0.3535534, 0.1913417, 
-0.0, -0.1913417, -0.3535534, -0.4619398, -0.5, -0.4619398, -0.3535534, -0.1913417, 0.0 };
-}
-#endif //APOLLO_WAVETABLES_X4_H
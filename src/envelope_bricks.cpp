@@ -23,7 +23,7 @@ void AudioRateADSRBrick::gate(bool gate)
 void AudioRateADSRBrick::render()
 {
     float attack = _ctrl_value(ControlInput::ATTACK);
-    float decay = _ctrl_value(ControlInput::RELEASE);
+    float decay = _ctrl_value(ControlInput::DECAY);
     float sustain = _ctrl_value(ControlInput::SUSTAIN);
     float release = _ctrl_value(ControlInput::RELEASE);
     float samplerate = _samplerate;
@@ -33,48 +33,49 @@ void AudioRateADSRBrick::render()
     float release_factor = std::max(sustain / (samplerate * release), SHORTEST_ENVELOPE_TIME);
     // TODO - Perhaps the release factor needs scaling if the envelope goes direcly to amp_release from attack or decay, see Apollo code
 
-    AudioBuffer& out = _output_buffer(AudioOutput::ENV_OUT);
+    float* out = _output_buffer(AudioOutput::ENV_OUT).data();
+    float level = _level;
+    int pos = 0;
 
-    for (auto& sample : out)
+    /* Render one segment at a time, only the stage transitions are handled separately */
+    while (pos < PROC_BLOCK_SIZE)
     {
+        bool reached;
         switch (_state)
         {
-        case EnvelopeState::OFF:
-            break;
-
-        case EnvelopeState::ATTACK:
-            _level += attack_factor;
-            if (_level >= 1)
-            {
-                _state = EnvelopeState::DECAY;
-                _level = 1.0f;
-            }
-            break;
-
-        case EnvelopeState::DECAY:
-            _level -= decay_factor;
-            if (_level <= sustain_level)
-            {
-                _state = EnvelopeState::SUSTAIN;
-                _level = sustain_level;
-            }
-            break;
-
-        case EnvelopeState::SUSTAIN:
-            /* fixed level, wait for a gate release/note off */
-            break;
-
-        case EnvelopeState::RELEASE:
-            _level -= release_factor;
-            if (_level < 0.0f)
-            {
-                _state = EnvelopeState::OFF;
-                _level = 0.0f;
-            }
-            break;
+            case EnvelopeState::OFF:
+            case EnvelopeState::SUSTAIN:
+                /* fixed level, wait for a gate release/note off */
+                std::fill(out + pos, out + PROC_BLOCK_SIZE, level);
+                pos = PROC_BLOCK_SIZE;
+                break;
+
+            case EnvelopeState::ATTACK:
+                pos += render_linear_segment(out + pos, PROC_BLOCK_SIZE - pos, level, 1.0f, attack_factor, reached);
+                if (reached)
+                {
+                    _state = EnvelopeState::DECAY;
+                }
+                break;
+
+            case EnvelopeState::DECAY:
+                pos += render_linear_segment(out + pos, PROC_BLOCK_SIZE - pos, level, sustain_level, -decay_factor, reached);
+                if (reached)
+                {
+                    _state = EnvelopeState::SUSTAIN;
+                }
+                break;
+
+            case EnvelopeState::RELEASE:
+                pos += render_linear_segment(out + pos, PROC_BLOCK_SIZE - pos, level, 0.0f, -release_factor, reached);
+                if (reached)
+                {
+                    _state = EnvelopeState::OFF;
+                }
+                break;
         }
-        sample = _level;
     }
+    _level = level;
 }
 
 void LinearADSREnvelopeBrick::gate(bool gate)
@@ -164,48 +165,57 @@ void AudioADSREnvelopeBrick::render()
 {
     float samplerate = _samplerate;
     float level = _level;
-    switch (_state)
+    /* Samples of this block not yet accounted for, so that the decay starts
+     * from the sample where the attack ends, not from the next block */
+    int samples = PROC_BLOCK_SIZE;
+    if (_state == EnvelopeState::ATTACK)
     {
-        case EnvelopeState::OFF:
-            break;
-
-        case EnvelopeState::ATTACK:
+        float attack_time = _ctrl_value(ControlInput::ATTACK);
+        float attack_inc = 1.0f / std::max(samplerate * attack_time, 1.0f);
+        /* With some tolerance, so that rounding errors don't add a sample */
+        int attack_samples = static_cast<int>(std::ceil((1.0f - level) / attack_inc - 1.0e-3f));
+        if (attack_samples <= samples)
         {
-            float attack_time = _ctrl_value(ControlInput::ATTACK);
-            _level += attack_time > 0 ? PROC_BLOCK_SIZE / (samplerate * attack_time) : 1.0f;
-            if (_level >= 1)
-            {
-                _state = EnvelopeState::DECAY;
-                _level = 1.0f;
-            }
-            break;
+            level = 1.0f;
+            samples -= attack_samples;
+            _state = EnvelopeState::DECAY;
         }
+        else
+        {
+            level += samples * attack_inc;
+        }
+    }
 
+    /* Decay and release are exponential, calculated in closed form for the
+     * remaining samples, level(n) = target + (level - target) * e^(-n / time) */
+    switch (_state)
+    {
         case EnvelopeState::DECAY:
         {
-            float decay_rate = _ctrl_value(ControlInput::DECAY);
+            float decay_time = _ctrl_value(ControlInput::DECAY);
             float sustain_level = _ctrl_value(ControlInput::SUSTAIN);
             sustain_level *= sustain_level;
-            /* 1 - 1/x is a quick approximation of e^(-1 / x) for small values of x */
-            float b0 = PROC_BLOCK_SIZE / (samplerate * decay_rate);
-            float a0 = 1.0f - b0;
-            _level = _level * a0 + b0 * sustain_level;
+            float coeff = std::exp(-samples / std::max(samplerate * decay_time, 1.0f));
             /* Note, as decay approaches the sustain level asymptotically,
              * we don't actually have to move to the sustain phase */
+            level = sustain_level + (level - sustain_level) * coeff;
             break;
         }
+
         case EnvelopeState::RELEASE:
         {
-            float release_rate = _ctrl_value(ControlInput::RELEASE);
-            float a0 = 1.0f - PROC_BLOCK_SIZE / (samplerate * release_rate);
-            _level = _level * a0;
-            if (_level < ENVELOPE_EPS)
+            float release_time = _ctrl_value(ControlInput::RELEASE);
+            level *= std::exp(-samples / std::max(samplerate * release_time, 1.0f));
+            if (level < ENVELOPE_EPS)
             {
                 _state = EnvelopeState::OFF;
-                _level = 0.0f;
+                level = 0.0f;
             }
             break;
         }
+
+        default:
+            break;
     }
     _level = level;
     _set_ctrl_value(ControlOutput::ENV_OUT, level);
@@ -214,7 +224,7 @@ void AudioADSREnvelopeBrick::render()
 
 void LfoBrick::render()
 {
-    float base_freq = LOWEST_LFO_SPEED * powf(2.0f, _ctrl_value(ControlInput::RATE) * 10.0f);
+    float base_freq = LOWEST_LFO_SPEED * exp2_approx(_ctrl_value(ControlInput::RATE) * 10.0f);
     float phase_inc = base_freq * PROC_BLOCK_SIZE * _samplerate_inv;
     float phase = _phase;
     float level = _level;
@@ -257,6 +267,7 @@ void LfoBrick::render()
                 phase -= 1;
                 level = _rand_device.get_norm();
             }
+            break;
 
         case Waveform::NOISE:
             level = _rand_device.get_norm();
@@ -274,15 +285,76 @@ void LfoBrick::render()
 
 void SineLfoBrick::render()
 {
-    // TODO - Cheaper power function
+    /* Phase is kept in cycles so that it wraps exactly at 1 */
     float rate = _ctrl_value(ControlInput::RATE);
-    float base_freq = 2.0f * static_cast<float>(M_PI) * LOWEST_LFO_SPEED * powf(2.0f, rate * 10.0f);
-    _phase += base_freq * PROC_BLOCK_SIZE * _samplerate_inv;
-    _set_ctrl_value(ControlOutput::LFO_OUT, std::sin(_phase));
-    if (_phase > 2 * M_PI)
+    float base_freq = LOWEST_LFO_SPEED * exp2_approx(rate * 10.0f);
+    float phase = _phase + base_freq * PROC_BLOCK_SIZE * _samplerate_inv;
+    phase -= phase >= 1.0f ? 1.0f : 0.0f;
+    _set_ctrl_value(ControlOutput::LFO_OUT, sin_2pi_approx(phase));
+    _phase = phase;
+}
+
+void AudioRateLfoBrick::render()
+{
+    float base_freq = LOWEST_LFO_SPEED * exp2_approx(_ctrl_value(ControlInput::RATE) * 10.0f);
+    uint32_t inc = lfo_phase_increment(std::min(base_freq * _samplerate_inv, 0.5f));
+    uint32_t phase = _phase;
+    auto& out = _output_buffer(AudioOutput::LFO_OUT);
+
+    /* The phase of every sample is computed directly from the phase at the
+     * start of the block, so the loops have no dependencies between samples */
+    switch (_waveform)
     {
-        _phase -= 1.0f;
+        case Waveform::SINE:
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                out[i] = sin_2pi_approx(lfo_phase_to_float(phase + inc * static_cast<uint32_t>(i + 1)));
+            }
+            break;
+
+        case Waveform::TRIANGLE:
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                out[i] = lfo_triangle(lfo_phase_to_float(phase + inc * static_cast<uint32_t>(i + 1)));
+            }
+            break;
+
+        case Waveform::SAW:
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                out[i] = lfo_saw(lfo_phase_to_float(phase + inc * static_cast<uint32_t>(i + 1)));
+            }
+            break;
+
+        case Waveform::PULSE:
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                out[i] = lfo_pulse(lfo_phase_to_float(phase + inc * static_cast<uint32_t>(i + 1)));
+            }
+            break;
+
+        case Waveform::SAMPLE_HOLD:
+        case Waveform::RANDOM:
+        {
+            /* Random values are a hash of the cycle count, which is the carry
+             * out of the 32 bit phase */
+            uint32_t cycle = _cycle;
+            uint32_t key = _key;
+            bool ramp = _waveform == Waveform::RANDOM;
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                uint64_t total = static_cast<uint64_t>(phase) + static_cast<uint64_t>(inc) * (i + 1);
+                uint32_t current = cycle + static_cast<uint32_t>(total >> 32u);
+                float p = lfo_phase_to_float(static_cast<uint32_t>(total));
+                float start = random_to_norm(random_hash(current, key));
+                float end = random_to_norm(random_hash(current + 1, key));
+                out[i] = ramp ? start + (end - start) * p : start;
+            }
+            break;
+        }
     }
+    _cycle += static_cast<uint32_t>((static_cast<uint64_t>(phase) + static_cast<uint64_t>(inc) * PROC_BLOCK_SIZE) >> 32u);
+    _phase = phase + inc * PROC_BLOCK_SIZE;
 }
 
 void RandLfoBrick::set_samplerate(float samplerate)
@@ -0,0 +1,158 @@
+#include <cassert>
+#include <cmath>
+#include <utility>
+
+#include "fft.h"
+
+namespace bricks {
+
+RealFft::RealFft(int size) : _size(size),
+                             _half_size(size / 2)
+{
+    assert(size >= 4 && (size & (size - 1)) == 0);
+    int bits = 0;
+    while ((1 << bits) < _half_size)
+    {
+        ++bits;
+    }
+    _bit_reverse.resize(_half_size);
+    for (int i = 0; i < _half_size; ++i)
+    {
+        int reversed = 0;
+        for (int b = 0; b < bits; ++b)
+        {
+            reversed |= ((i >> b) & 1) << (bits - 1 - b);
+        }
+        _bit_reverse[i] = reversed;
+    }
+
+    /* Twiddles for the complex fft of size N/2 */
+    _twiddle_re.resize(_half_size / 2);
+    _twiddle_im.resize(_half_size / 2);
+    for (int k = 0; k < _half_size / 2; ++k)
+    {
+        double w = -2.0 * M_PI * k / _half_size;
+        _twiddle_re[k] = std::cos(w);
+        _twiddle_im[k] = std::sin(w);
+    }
+
+    /* Twiddles for splitting the complex spectrum into the real spectrum of size N */
+    _split_re.resize(_half_size + 1);
+    _split_im.resize(_half_size + 1);
+    for (int k = 0; k <= _half_size; ++k)
+    {
+        double w = -2.0 * M_PI * k / _size;
+        _split_re[k] = std::cos(w);
+        _split_im[k] = std::sin(w);
+    }
+    _scratch_re.resize(_half_size);
+    _scratch_im.resize(_half_size);
+}
+
+void RealFft::forward(const float* in, float* re, float* im)
+{
+    float* z_re = _scratch_re.data();
+    float* z_im = _scratch_im.data();
+    int m = _half_size;
+
+    /* Pack even samples as the real part and odd samples as the imaginary part */
+    for (int n = 0; n < m; ++n)
+    {
+        z_re[n] = in[2 * n];
+        z_im[n] = in[2 * n + 1];
+    }
+    _complex_fft(z_re, z_im, false);
+
+    for (int k = 0; k <= m; ++k)
+    {
+        int k1 = k < m ? k : 0;
+        int k2 = k > 0 ? m - k : 0;
+        /* Spectrum of the even samples */
+        float even_re = 0.5f * (z_re[k1] + z_re[k2]);
+        float even_im = 0.5f * (z_im[k1] - z_im[k2]);
+        /* Spectrum of the odd samples */
+        float odd_re = 0.5f * (z_im[k1] + z_im[k2]);
+        float odd_im = -0.5f * (z_re[k1] - z_re[k2]);
+
+        float w_re = _split_re[k];
+        float w_im = _split_im[k];
+        re[k] = even_re + w_re * odd_re - w_im * odd_im;
+        im[k] = even_im + w_re * odd_im + w_im * odd_re;
+    }
+}
+
+void RealFft::inverse(const float* re, const float* im, float* out)
+{
+    float* z_re = _scratch_re.data();
+    float* z_im = _scratch_im.data();
+    int m = _half_size;
+
+    for (int k = 0; k < m; ++k)
+    {
+        float x1_re = re[k];
+        float x1_im = im[k];
+        float x2_re = re[m - k];
+        float x2_im = im[m - k];
+
+        float even_re = 0.5f * (x1_re + x2_re);
+        float even_im = 0.5f * (x1_im - x2_im);
+        float diff_re = 0.5f * (x1_re - x2_re);
+        float diff_im = 0.5f * (x1_im + x2_im);
+
+        /* Multiply with the conjugate twiddle to get the spectrum of the odd samples */
+        float w_re = _split_re[k];
+        float w_im = _split_im[k];
+        float odd_re = diff_re * w_re + diff_im * w_im;
+        float odd_im = diff_im * w_re - diff_re * w_im;
+
+        z_re[k] = even_re - odd_im;
+        z_im[k] = even_im + odd_re;
+    }
+    _complex_fft(z_re, z_im, true);
+
+    float scale = 1.0f / m;
+    for (int n = 0; n < m; ++n)
+    {
+        out[2 * n] = z_re[n] * scale;
+        out[2 * n + 1] = z_im[n] * scale;
+    }
+}
+
+void RealFft::_complex_fft(float* re, float* im, bool inverse)
+{
+    int m = _half_size;
+    for (int i = 0; i < m; ++i)
+    {
+        int j = _bit_reverse[i];
+        if (j > i)
+        {
+            std::swap(re[i], re[j]);
+            std::swap(im[i], im[j]);
+        }
+    }
+
+    float sign = inverse ? -1.0f : 1.0f;
+    for (int length = 2; length <= m; length *= 2)
+    {
+        int half = length / 2;
+        int step = m / length;
+        for (int start = 0; start < m; start += length)
+        {
+            for (int k = 0; k < half; ++k)
+            {
+                float w_re = _twiddle_re[k * step];
+                float w_im = sign * _twiddle_im[k * step];
+                int a = start + k;
+                int b = a + half;
+                float t_re = re[b] * w_re - im[b] * w_im;
+                float t_im = re[b] * w_im + im[b] * w_re;
+                re[b] = re[a] - t_re;
+                im[b] = im[a] - t_im;
+                re[a] += t_re;
+                im[a] += t_im;
+            }
+        }
+    }
+}
+
+} // namespace bricks
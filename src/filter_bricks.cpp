@@ -5,176 +5,214 @@
 
 namespace bricks {
 
-void SVFFilterBrick::render()
+PartitionedIr::PartitionedIr(const float* ir, int length, int partition_size) : _partition_size(partition_size)
 {
-    const auto& audio_in = _input_buffer(0);
-    auto& lowpass_out = _output_buffer(AudioOutput::LOWPASS);
-    auto& bandpass_out = _output_buffer(AudioOutput::BANDPASS);
-    auto& highpass_out = _output_buffer(AudioOutput::HIGHPASS);
-
-    float freq = 20 * powf(2.0f, _ctrl_value(ControlInput::CUTOFF) * 10.0f);
-    freq = std::clamp(freq, 5.0f, 19000.0f);
-    float k = 2 - 2 * _ctrl_value(ControlInput::RESONANCE);
-    _g_lag.set(std::tan(static_cast<float>(M_PI) * freq * _samplerate_inv));
-    auto reg = _reg;
-    auto g_lag = _g_lag;
-    for (unsigned int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    _partitions = std::max(1, (length + partition_size - 1) / partition_size);
+    RealFft fft(2 * partition_size);
+    _re.assign(_partitions * bins(), 0.0f);
+    _im.assign(_partitions * bins(), 0.0f);
+
+    /* Each partition is zero padded to twice its length before transforming */
+    std::vector<float> padded(2 * partition_size, 0.0f);
+    for (int p = 0; p < _partitions; ++p)
     {
-        float g = g_lag.get();
-        float a1 = 1 / (1 + g * (g + k));
-        float a2 = g * a1;
-        float a3 = g * a2;
-        float v3 = audio_in[i] - reg[1];
-        float v1 = a1 * reg[0] + a2 * v3;
-        float v2 = reg[1] + a2 * reg[0] + a3 * v3;
-        reg[0] = 2.0f * v1 - reg[0];
-        reg[1] = 2.0f * v2 - reg[1];
-
-        lowpass_out[i] = v2;
-        bandpass_out[i] = v1;
-        highpass_out[i] = audio_in[i] - k * v1 - v2;
+        int start = p * partition_size;
+        int count = std::clamp(length - start, 0, partition_size);
+        std::fill(padded.begin(), padded.end(), 0.0f);
+        std::copy(ir + start, ir + start + count, padded.begin());
+        fft.forward(padded.data(), &_re[p * bins()], &_im[p * bins()]);
     }
-    _reg = reg;
-    _g_lag = g_lag;
 }
 
-void FixedFilterBrick::set_lowpass(float freq, float q, bool clear)
+void PartitionedConvolver::set_impulse_response(const float* ir, int length, int partition_size)
 {
-    _coeff = calc_lowpass(freq, q, _samplerate);
-    if (clear)
-    {
-        _reg = {0, 0};
-    }
+    set_impulse_response(std::make_shared<const PartitionedIr>(ir, length, partition_size));
 }
 
-void FixedFilterBrick::set_highpass(float freq, float q, bool clear)
+void PartitionedConvolver::set_impulse_response(std::shared_ptr<const PartitionedIr> ir)
 {
-    _coeff = calc_highpass(freq, q, _samplerate);
-    if (clear)
-    {
-        reset();
-    }
+    _ir = std::move(ir);
+    _partition_size = _ir->partition_size();
+    _partitions = _ir->partitions();
+    _fft = std::make_unique<RealFft>(2 * _partition_size);
+    _bins = _fft->bins();
+
+    _fdl_re.assign(_partitions * _bins, 0.0f);
+    _fdl_im.assign(_partitions * _bins, 0.0f);
+    _acc_re.assign(_bins, 0.0f);
+    _acc_im.assign(_bins, 0.0f);
+    _input.assign(2 * _partition_size, 0.0f);
+    _output.assign(2 * _partition_size, 0.0f);
+    _fdl_head = 0;
 }
 
-void FixedFilterBrick::set_bandpass(float freq, float q, bool clear)
+void PartitionedConvolver::reset()
 {
-    _coeff = calc_bandpass(freq, q, _samplerate);
-    if (clear)
-    {
-        reset();
-    }
+    std::fill(_fdl_re.begin(), _fdl_re.end(), 0.0f);
+    std::fill(_fdl_im.begin(), _fdl_im.end(), 0.0f);
+    std::fill(_acc_re.begin(), _acc_re.end(), 0.0f);
+    std::fill(_acc_im.begin(), _acc_im.end(), 0.0f);
+    std::fill(_input.begin(), _input.end(), 0.0f);
 }
 
-void FixedFilterBrick::set_peaking(float freq, float gain, float q, bool clear)
+void PartitionedConvolver::push_input(const float* in)
 {
-    _coeff = calc_peaking(freq, gain, q, _samplerate);
-    if (clear)
+    /* Overlap-save, the transform window is the previous and the current input */
+    std::copy(_input.begin() + _partition_size, _input.end(), _input.begin());
+    std::copy(in, in + _partition_size, _input.begin() + _partition_size);
+
+    _fdl_head = _fdl_head + 1 < _partitions ? _fdl_head + 1 : 0;
+    _fft->forward(_input.data(), &_fdl_re[_fdl_head * _bins], &_fdl_im[_fdl_head * _bins]);
+}
+
+void PartitionedConvolver::accumulate(int first, int count)
+{
+    int bins = _bins;
+    float* acc_re = _acc_re.data();
+    float* acc_im = _acc_im.data();
+
+    for (int p = first; p < first + count; ++p)
     {
-        reset();
+        /* Partition p of the impulse response is applied to the input from p partitions ago */
+        int slot = _fdl_head - p;
+        slot = slot < 0 ? slot + _partitions : slot;
+        const float* x_re = &_fdl_re[slot * bins];
+        const float* x_im = &_fdl_im[slot * bins];
+        const float* h_re = _ir->re(p);
+        const float* h_im = _ir->im(p);
+
+        for (int k = 0; k < bins; ++k)
+        {
+            acc_re[k] += x_re[k] * h_re[k] - x_im[k] * h_im[k];
+            acc_im[k] += x_re[k] * h_im[k] + x_im[k] * h_re[k];
+        }
     }
 }
 
-void FixedFilterBrick::set_allpass(float freq, float q, bool clear)
+void PartitionedConvolver::output(float* out)
 {
-    _coeff = calc_allpass(freq, q, _samplerate);
-    if (clear)
+    _fft->inverse(_acc_re.data(), _acc_im.data(), _output.data());
+    /* The first half is circular convolution garbage, only the second half is valid */
+    std::copy(_output.begin() + _partition_size, _output.end(), out);
+    std::fill(_acc_re.begin(), _acc_re.end(), 0.0f);
+    std::fill(_acc_im.begin(), _acc_im.end(), 0.0f);
+}
+
+ImpulseResponse::ImpulseResponse(const float* ir, int length, int tail_partition_size)
+{
+    assert(tail_partition_size % PROC_BLOCK_SIZE == 0);
+    /* The tail can start no earlier than 2 tail partitions into the impulse response
+     * as the computation of 1 tail partition is spread out over a full partition */
+    int head_length = 2 * tail_partition_size;
+    if (tail_partition_size > 0 && length > head_length)
     {
-        reset();
+        _head = std::make_shared<const PartitionedIr>(ir, head_length, PROC_BLOCK_SIZE);
+        _tail = std::make_shared<const PartitionedIr>(ir + head_length, length - head_length, tail_partition_size);
     }
+    else
+    {
+        _head = std::make_shared<const PartitionedIr>(ir, length, PROC_BLOCK_SIZE);
+    }
+}
+
+void ConvolutionBrick::set_impulse_response(const float* ir, int length, int tail_partition_size)
+{
+    set_impulse_response(std::make_shared<const ImpulseResponse>(ir, length, tail_partition_size));
 }
 
-void FixedFilterBrick::set_lowshelf(float freq, float gain, float q, bool clear)
+void ConvolutionBrick::set_impulse_response(std::shared_ptr<const ImpulseResponse> ir)
 {
-    _coeff = calc_lowshelf(freq, gain, q, _samplerate);
-    if (clear)
+    _ir = std::move(ir);
+    _has_tail = _ir->tail() != nullptr;
+    _head.set_impulse_response(_ir->head());
+
+    if (_has_tail)
+    {
+        int tail_partition_size = _ir->tail()->partition_size();
+        _tail.set_impulse_response(_ir->tail());
+        _tail_blocks = tail_partition_size / PROC_BLOCK_SIZE;
+        _tail_input.assign(tail_partition_size, 0.0f);
+        _tail_output[0].assign(tail_partition_size, 0.0f);
+        _tail_output[1].assign(tail_partition_size, 0.0f);
+    }
+    else
     {
-        reset();
+        _tail_blocks = 0;
     }
+    _tail_step = 0;
+    _tail_playing = 0;
 }
 
-void FixedFilterBrick::set_highshelf(float freq, float gain, float q, bool clear)
+void ConvolutionBrick::reset()
 {
-    _coeff = calc_highshelf(freq, gain, q, _samplerate);
-    if (clear)
+    _head.reset();
+    if (_has_tail)
     {
-        reset();
+        _tail.reset();
+        std::fill(_tail_input.begin(), _tail_input.end(), 0.0f);
+        std::fill(_tail_output[0].begin(), _tail_output[0].end(), 0.0f);
+        std::fill(_tail_output[1].begin(), _tail_output[1].end(), 0.0f);
     }
+    _tail_step = 0;
+    _tail_playing = 0;
 }
 
-void FixedFilterBrick::render()
+void ConvolutionBrick::render()
 {
     const AudioBuffer& audio_in = _input_buffer(0);
-    AudioBuffer& audio_out = _output_buffer(AudioOutput::FILTER_OUT);
-    render_df2_biquad(audio_in, audio_out, _coeff, _reg);
-}
+    AudioBuffer& audio_out = _output_buffer(AudioOutput::CONV_OUT);
 
-/* tanh(x)/x approximation, flatline at very high inputs
- * so might not be safe for very large feedback gains
- * [limit is 1/15 so very large means ~15 or +23dB] */
-inline double tanhXdX(const double& x)
-{
-    double a = x*x;
-    // IIRC I got this as Pade-approx for tanh(sqrt(x))/sqrt(x)
-    return ((a + 105)*a + 945) / ((15*a + 420)*a + 945);
-}
+    if (_head.partitions() == 0)
+    {
+        audio_out.fill(0.0f);
+        return;
+    }
 
-void MystransLadderFilter::render()
-{
-    const auto& in = _input_buffer(0);
-    auto& audio_out = _output_buffer(0);
-    float freq = 20 * powf(2.0f, _ctrl_value(ControlInput::CUTOFF) * 10.0f);
-    freq = clamp(freq, 20.0f, 22000.0f);
-    _freq_lag.set(std::tan(static_cast<float>(M_PI) * freq * _samplerate_inv));
-    double r = (40.0/9.0) * _ctrl_value(ControlInput::RESONANCE);
-
-    auto s = _states;
-    auto zi = _zi;
-    auto freq_lag = _freq_lag;
-
-    for(int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    _head.push_input(audio_in.data());
+    _head.accumulate(0, _head.partitions());
+    _head.output(audio_out.data());
+
+    if (_has_tail)
     {
-        double f = freq_lag.get();
-        // input with half delay, for non-linearities
-        double ih = 0.5 * (in[i] + zi);
-        zi = in[i];
-
-        // evaluate the non-linear gains
-        double t0 = tanhXdX(ih - r * s[3]);
-        double t1 = tanhXdX(s[0]);
-        double t2 = tanhXdX(s[1]);
-        double t3 = tanhXdX(s[2]);
-        double t4 = tanhXdX(s[3]);
-
-        // g# the denominators for solutions of individual stages
-        double g0 = 1 / (1 + f * t1), g1 = 1 / (1 + f * t2);
-        double g2 = 1 / (1 + f * t3), g3 = 1 / (1 + f * t4);
-
-        // f# are just factored out of the feedback solution
-        double f3 = f * t3 * g3;
-        double f2 = f * t2 * g2 * f3;
-        double f1 = f * t1 * g1 * f2;
-        double f0 = f * t0 * g0 * f1;
-
-        // solve feedback
-        double y3 = (g3 * s[3] + f3 * g2 * s[2] + f2 * g1 * s[1] + f1 * g0 * s[0] + f0 * in[i]) / (1 + r * f0);
-
-        // then solve the remaining outputs (with the non-linear gains here)
-        double xx = t0 * (in[i] - r * y3);
-        double y0 = t1 * g0 * (s[0] + f * xx);
-        double y1 = t2 * g1 * (s[1] + f * y0);
-        double y2 = t3 * g2 * (s[2] + f * y1);
-
-        // update state
-        s[0] += 2 * f * (xx - y0);
-        s[1] += 2 * f * (y0 - y1);
-        s[2] += 2 * f * (y1 - y2);
-        s[3] += 2 * f * (y2 - t4 * y3);
-
-        audio_out[i] = y3;
+        int step = _tail_step;
+        int offset = step * PROC_BLOCK_SIZE;
+
+        /* The tail output was computed during the previous tail period */
+        const float* tail_out = _tail_output[_tail_playing].data() + offset;
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            audio_out[i] += tail_out[i];
+        }
+
+        /* A full tail partition of input was collected in the previous period */
+        if (step == 0)
+        {
+            _tail.push_input(_tail_input.data());
+        }
+        std::copy(audio_in.begin(), audio_in.end(), _tail_input.begin() + offset);
+
+        /* The forward fft runs in the first and the inverse fft in the last
+         * block of the period, so with 3 or more blocks the partitions are
+         * accumulated in the blocks in between */
+        int mac_first = _tail_blocks >= 3 ? 1 : 0;
+        int mac_blocks = _tail_blocks >= 3 ? _tail_blocks - 2 : _tail_blocks;
+        int mac_step = step - mac_first;
+        if (mac_step >= 0 && mac_step < mac_blocks)
+        {
+            int partitions = _tail.partitions();
+            int first = mac_step * partitions / mac_blocks;
+            int last = (mac_step + 1) * partitions / mac_blocks;
+            _tail.accumulate(first, last - first);
+        }
+
+        if (++step == _tail_blocks)
+        {
+            _tail.output(_tail_output[1 - _tail_playing].data());
+            _tail_playing = 1 - _tail_playing;
+            step = 0;
+        }
+        _tail_step = step;
     }
-    _zi = zi;
-    _states = s;
-    _freq_lag = freq_lag;
 }
 
 } // namepspace bricks
\ No newline at end of file
@@ -314,6 +314,13 @@ void SustainerBrick::render()
         }
     }
 
+    for (int c = LEFT; c <= RIGHT; ++c)
+    {
+        op_hp[c].flush_denormals();
+        env_hp[c].flush_denormals();
+        env_lp[c].flush_denormals();
+    }
+
     _op_gain = op_gain;
     _fet_gain = fet_gain;
     _op_hp = op_hp;
@@ -379,11 +386,13 @@ void ModulatedDelayBrick::render()
 
     float readout_speed =  rec_time / current_time;
     _delay_time_lag.set(readout_speed);
+    AudioBuffer speeds;
+    _delay_time_lag.get_all(speeds);
     auto& audio_out = _output_buffer(AudioOutput::DELAY_OUT);
 
     for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
     {
-        _play_head += _delay_time_lag.get();
+        _play_head += speeds[i];
         while (_play_head > _play_wraparound)
         {
             _play_head -= _play_wraparound;
@@ -0,0 +1,203 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#include "offline_renderer.h"
+#include "denormal_guard.h"
+
+namespace bricks {
+
+namespace {
+
+/* Chunk of interleaved audio on its way from a worker to the writer thread */
+struct Chunk
+{
+    std::vector<float>  data;
+    int                 frames{0};
+    bool                pending{false};
+};
+
+struct WriteRequest
+{
+    RenderSink* sink;
+    Chunk*      chunk;
+    int         channels;
+    bool        last;
+};
+
+/* Single thread that writes chunks to sinks in the order they are queued */
+class ChunkWriter
+{
+public:
+    ChunkWriter() : _thread(&ChunkWriter::_run, this) {}
+
+    ~ChunkWriter()
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            _quit = true;
+        }
+        _queue_cond.notify_one();
+        _thread.join();
+    }
+
+    void queue(const WriteRequest& request)
+    {
+        {
+            std::scoped_lock lock(_mutex);
+            request.chunk->pending = true;
+            _queue.push_back(request);
+        }
+        _queue_cond.notify_one();
+    }
+
+    /* Block until the chunk is written and can be rendered into again */
+    void wait_for(const Chunk& chunk)
+    {
+        std::unique_lock lock(_mutex);
+        _done_cond.wait(lock, [&]() {return !chunk.pending;});
+    }
+
+private:
+    void _run()
+    {
+        std::unique_lock lock(_mutex);
+        while (true)
+        {
+            _queue_cond.wait(lock, [&]() {return _quit || !_queue.empty();});
+            if (_queue.empty())
+            {
+                return;
+            }
+            auto request = _queue.front();
+            _queue.pop_front();
+            lock.unlock();
+
+            if (request.chunk->frames > 0)
+            {
+                request.sink->write(request.chunk->data.data(), request.channels, request.chunk->frames);
+            }
+            if (request.last)
+            {
+                request.sink->close();
+            }
+
+            lock.lock();
+            request.chunk->pending = false;
+            _done_cond.notify_all();
+        }
+    }
+
+    std::mutex                  _mutex;
+    std::condition_variable     _queue_cond;
+    std::condition_variable     _done_cond;
+    std::deque<WriteRequest>    _queue;
+    bool                        _quit{false};
+    std::thread                 _thread;
+};
+
+inline void render_job(RenderSource& source, RenderSink& sink, int64_t length, int chunk_size, ChunkWriter& writer)
+{
+    int channels = source.channels();
+    std::array<Chunk, 2> chunks;
+    for (auto& chunk : chunks)
+    {
+        chunk.data.resize(static_cast<size_t>(chunk_size) * channels);
+    }
+
+    int current = 0;
+    int64_t pos = 0;
+    while (pos < length)
+    {
+        Chunk& chunk = chunks[current];
+        writer.wait_for(chunk);
+        chunk.frames = 0;
+        while (chunk.frames < chunk_size && pos < length)
+        {
+            source.render(pos);
+            int frames = static_cast<int>(std::min<int64_t>(PROC_BLOCK_SIZE, length - pos));
+            float* dest = chunk.data.data() + chunk.frames * channels;
+            for (int c = 0; c < channels; ++c)
+            {
+                const auto& buffer = source.output(c);
+                for (int i = 0; i < frames; ++i)
+                {
+                    dest[i * channels + c] = buffer[i];
+                }
+            }
+            chunk.frames += frames;
+            pos += frames;
+        }
+        writer.queue({&sink, &chunk, channels, pos >= length});
+        current = 1 - current;
+    }
+    if (length <= 0)
+    {
+        chunks[0].frames = 0;
+        writer.queue({&sink, &chunks[0], channels, true});
+    }
+    /* The chunks are owned by this function, so wait for both before returning */
+    for (auto& chunk : chunks)
+    {
+        writer.wait_for(chunk);
+    }
+}
+} // namespace
+
+OfflineRenderer::OfflineRenderer(int threads, int chunk_size)
+{
+    _threads = threads > 0 ? threads : std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    _chunk_size = std::max(1, (chunk_size + PROC_BLOCK_SIZE - 1) / PROC_BLOCK_SIZE) * PROC_BLOCK_SIZE;
+}
+
+void OfflineRenderer::add_job(RenderSource* source, RenderSink* sink, int64_t length)
+{
+    _jobs.push_back({source, sink, length});
+}
+
+RenderStats OfflineRenderer::run(float samplerate)
+{
+    auto stats = run(static_cast<int>(_jobs.size()), [this](int /*worker*/, int job) {return _jobs[job];}, samplerate);
+    _jobs.clear();
+    return stats;
+}
+
+RenderStats OfflineRenderer::run(int jobs, const JobProvider& provider, float samplerate)
+{
+    auto start_time = std::chrono::steady_clock::now();
+    ChunkWriter writer;
+    std::atomic<int> next_job{0};
+    std::atomic<int64_t> samples{0};
+    int workers = std::min(_threads, jobs);
+
+    auto worker = [&](int worker_index)
+    {
+        ScopedDenormalGuard denormal_guard;
+        for (int job = next_job++; job < jobs; job = next_job++)
+        {
+            auto job_data = provider(worker_index, job);
+            render_job(*job_data.source, *job_data.sink, job_data.length, _chunk_size, writer);
+            samples += std::max<int64_t>(0, job_data.length);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < workers; ++i)
+    {
+        threads.emplace_back(worker, i);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    return {samples, seconds, seconds > 0 ? samples / static_cast<double>(samplerate) / seconds : 0.0};
+}
+
+} // namespace bricks
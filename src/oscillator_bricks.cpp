@@ -1,7 +1,6 @@
 #include <cmath>
 
 #include "oscillator_bricks.h"
-#include "data/wavetables_x4.h"
 
 namespace bricks {
 
@@ -106,41 +105,20 @@ void FmOscillatorBrick::render()
 
 void WtOscillatorBrick::render()
 {
-    /* If the samplerate it less than 80kHz, use the wavetables 1 octave above
-     * which has less harmonics to make sure they dont alias when interpolated */
-    float sr = _samplerate;
-    int wt_shift = sr > 80000? 0 : sr > 40000? 1 : 2;
     float pitch = _ctrl_value(ControlInput::PITCH);
     float base_freq = control_to_freq(pitch);
     float phase_inc = base_freq * _samplerate_inv;
     float phase = _phase;
 
-    int oct = std::max(0, std::min(9, static_cast<int>(pitch * 10) + wt_shift));
-    float table_len = wavetables::lengths[oct];
-    const float* table{nullptr};
-
-    switch (_waveform)
-    {
-        case Waveform::SAW:
-            table = wavetables::saw + wavetables::offsets[oct];
-            break;
-        case Waveform::PULSE:
-            table = wavetables::square + wavetables::offsets[oct];
-            break;
-        case Waveform::TRIANGLE:
-            table = wavetables::triangle + wavetables::offsets[oct];
-            break;
-        case Waveform::SINE:
-            table = wavetables::sine + wavetables::offsets[oct];
-            break;
-    }
-    assert(*table == 0.0f);
+    int oct = wavetable_level(pitch, _samplerate);
+    float table_len = Wavetable::length(oct);
+    const float* table = _table->level(oct);
 
     AudioBuffer& audio_out = _output_buffer(AudioOutput::OSC_OUT);
     for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
     {
         phase += phase_inc;
-        if (phase > 1.0f)
+        if (phase >= 1.0f)
             phase -= 1.0f;
         float pos = phase * table_len;
         float sample = linear_int(pos, table);
@@ -149,45 +127,83 @@ void WtOscillatorBrick::render()
     _phase = phase;
 }
 
-constexpr float PINK_CUTOFF_FREQ = 100;
-constexpr float PINK_GAIN_CORR = 4.0f;
+/* Paul Kellet's refined pink noise filter, a sum of first order lowpass
+ * filters that is within 0.05 dB of -3 dB/octave above 9.2 Hz at 44.1 kHz.
+ * All but the last pole are scaled to the samplerate, keeping their dc gains.
+ * Padded with 2 unused poles so the state fills a whole vector register */
+constexpr float PINK_REF_SAMPLERATE = 44100;
+constexpr std::array<float, NoiseGeneratorBrick::PINK_POLES> PINK_REF_POLES = {0.99886f, 0.99332f, 0.96900f, 0.86650f, 0.55000f, -0.7616f, 0.0f, 0.0f};
+constexpr std::array<float, NoiseGeneratorBrick::PINK_POLES> PINK_REF_GAINS = {0.0555179f, 0.0750759f, 0.1538520f, 0.3104856f, 0.5329522f, -0.0168980f, 0.0f, 0.0f};
+constexpr float PINK_DIRECT_GAIN = 0.5362f;
+constexpr float PINK_DELAYED_GAIN = 0.115926f;
+constexpr float PINK_GAIN_CORR = 0.1f;
 constexpr float BROWN_CUTOFF_FREQ = 0.03;
-constexpr float BROWN_GAIN_CORR = 50.0f;
+constexpr float BROWN_GAIN_CORR = 200.0f;
 
 void NoiseGeneratorBrick::render()
 {
     AudioBuffer& audio_out = _output_buffer(AudioOutput::NOISE_OUT);
+    _rand_device.fill_norm(audio_out);
 
-    for (auto& s : audio_out)
-    {
-        s = _rand_device.get_norm();
-    }
     if (_waveform == Waveform::PINK)
     {
-        float hist = audio_out[PROC_BLOCK_SIZE - 1];
-        for (auto& s : audio_out)
+        /* The filters are independent so their states are updated as one
+         * vector per sample, and summed in a separate pass */
+        std::array<std::array<float, PINK_POLES>, PROC_BLOCK_SIZE> states;
+        const auto poles = _pink_poles;
+        const auto gains = _pink_gains;
+        auto state = _pink_state;
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            for (int p = 0; p < PINK_POLES; ++p)
+            {
+                state[p] = poles[p] * state[p] + gains[p] * audio_out[i];
+            }
+            states[i] = state;
+        }
+        float delayed = _pink_delayed;
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
         {
-            s *= PINK_GAIN_CORR;
-            s = (1.0f - _pink_coeff_a0) * s + _pink_coeff_a0 * hist;
-            hist = s;
+            float white = audio_out[i];
+            float pink = PINK_DIRECT_GAIN * PINK_GAIN_CORR * white + delayed;
+            for (int p = 0; p < PINK_POLES; ++p)
+            {
+                pink += states[i][p];
+            }
+            delayed = PINK_DELAYED_GAIN * PINK_GAIN_CORR * white;
+            audio_out[i] = pink;
         }
+        _pink_state = state;
+        _pink_delayed = delayed;
     }
-    if (_waveform == Waveform::BROWN)
+    else if (_waveform == Waveform::BROWN)
     {
-        float hist = audio_out[PROC_BLOCK_SIZE - 1];
+        float a0 = _brown_coeff_a0;
+        float b0 = _brown_coeff_b0;
+        float state = _brown_state;
         for (auto& s : audio_out)
         {
-            s *= BROWN_GAIN_CORR;
-            s = (1.0f - _brown_coeff_a0) * s + _brown_coeff_a0 * hist;
-            hist = s;
+            state = a0 * state + b0 * s;
+            s = state;
         }
+        _brown_state = state;
     }
 }
 
 void NoiseGeneratorBrick::set_samplerate(float samplerate)
 {
-    _pink_coeff_a0 = std::exp(-2.0f * M_PI * PINK_CUTOFF_FREQ / samplerate);
+    for (int p = 0; p < PINK_POLES; ++p)
+    {
+        float pole = PINK_REF_POLES[p];
+        if (pole > 0)
+        {
+            pole = std::pow(pole, PINK_REF_SAMPLERATE / samplerate);
+        }
+        _pink_poles[p] = pole;
+        _pink_gains[p] = PINK_REF_GAINS[p] * PINK_GAIN_CORR * (1.0f - pole) / (1.0f - PINK_REF_POLES[p]);
+    }
     _brown_coeff_a0 = std::exp(-2.0f * M_PI * BROWN_CUTOFF_FREQ / samplerate);
+    _brown_coeff_b0 = (1.0f - _brown_coeff_a0) * BROWN_GAIN_CORR;
 }
 
 } // namespace bricks
\ No newline at end of file
@@ -1,17 +1,43 @@
+#include <atomic>
+
 #include "random_device.h"
 
 namespace bricks {
 
-constexpr uint32_t INITIAL_SEED = 12345;
+constexpr uint32_t DEFAULT_SEED = 12345;
 
-uint32_t RandomDevice::_seed = INITIAL_SEED;
+namespace {
+std::atomic<uint32_t> default_stream{0};
+thread_local RandomContext* current_context{nullptr};
+}
 
 RandomDevice::RandomDevice()
 {
-    /* Each device is initialised with a different seed to get independent
-     * random generators / noise */
-    _device.seed(_seed);
-    ++_seed;
+    if (auto context = RandomContext::current(); context)
+    {
+        set_seed(context->seed(), context->next_stream());
+    }
+    else
+    {
+        set_seed(DEFAULT_SEED, default_stream.fetch_add(1, std::memory_order_relaxed));
+    }
+}
+
+RandomContext::RandomContext(uint32_t seed, uint32_t first_stream) : _seed(seed),
+                                                                      _next_stream(first_stream),
+                                                                      _previous(current_context)
+{
+    current_context = this;
+}
+
+RandomContext::~RandomContext()
+{
+    current_context = _previous;
+}
+
+RandomContext* RandomContext::current()
+{
+    return current_context;
 }
 
-} // namespace bricks
\ No newline at end of file
+} // namespace bricks
@@ -0,0 +1,206 @@
+#include <algorithm>
+#include <cassert>
+
+#include "wavetable.h"
+#include "fft.h"
+
+namespace bricks {
+
+Wavetable::Wavetable(const std::vector<float>& cos_amplitudes, const std::vector<float>& sin_amplitudes, float dc)
+{
+    int size = 0;
+    for (int level = 0; level < LEVELS; ++level)
+    {
+        _offsets[level] = size;
+        size += length(level) + 1;
+    }
+    _data.resize(size);
+
+    int harmonics = static_cast<int>(std::max(cos_amplitudes.size(), sin_amplitudes.size()));
+    for (int level = 0; level < LEVELS; ++level)
+    {
+        int table_len = length(level);
+        RealFft fft(table_len);
+        std::vector<float> re(fft.bins(), 0.0f);
+        std::vector<float> im(fft.bins(), 0.0f);
+
+        /* Scale amplitudes to fft bin values, the inverse fft divides by the table length */
+        float scale = table_len / 2.0f;
+        re[0] = dc * table_len;
+        int limit = std::min(HARMONIC_LIMITS[level], harmonics + 1);
+        for (int h = 1; h < limit; ++h)
+        {
+            re[h] = h <= static_cast<int>(cos_amplitudes.size()) ? cos_amplitudes[h - 1] * scale : 0.0f;
+            im[h] = h <= static_cast<int>(sin_amplitudes.size()) ? -sin_amplitudes[h - 1] * scale : 0.0f;
+        }
+        float* table = _data.data() + _offsets[level];
+        fft.inverse(re.data(), im.data(), table);
+        table[table_len] = table[0];
+    }
+}
+
+MorphWavetable::MorphWavetable(const std::vector<std::shared_ptr<const Wavetable>>& frames) : _frames(static_cast<int>(frames.size()))
+{
+    assert(_frames >= 2);
+    int size = 0;
+    for (int level = 0; level < Wavetable::LEVELS; ++level)
+    {
+        _offsets[level] = size;
+        size += (length(level) + 1) * _frames;
+    }
+    _data.resize(size);
+
+    for (int level = 0; level < Wavetable::LEVELS; ++level)
+    {
+        float* data = _data.data() + _offsets[level];
+        for (int f = 0; f < _frames; ++f)
+        {
+            const float* table = frames[f]->level(level);
+            for (int i = 0; i <= length(level); ++i)
+            {
+                data[i * _frames + f] = table[i];
+            }
+        }
+    }
+}
+
+/* Harmonic amplitudes of the basic waveforms, same as the previously used precalculated tables */
+inline std::shared_ptr<const Wavetable> generate_basic_waveform(BasicWaveform waveform)
+{
+    int harmonics = Wavetable::HARMONIC_LIMITS[0] - 1;
+    std::vector<float> sin_amplitudes(harmonics, 0.0f);
+    for (int h = 1; h <= harmonics; ++h)
+    {
+        float& amplitude = sin_amplitudes[h - 1];
+        switch (waveform)
+        {
+            case BasicWaveform::SAW:
+                amplitude = 0.5f / h;
+                break;
+
+            case BasicWaveform::PULSE:
+                amplitude = h % 2 == 1 ? 1.0f / h : 0.0f;
+                break;
+
+            case BasicWaveform::TRIANGLE:
+                amplitude = h % 4 == 1 ? 0.8f / (h * h) : h % 4 == 3 ? -0.8f / (h * h) : 0.0f;
+                break;
+
+            case BasicWaveform::SINE:
+                amplitude = h == 1 ? 0.5f : 0.0f;
+                break;
+        }
+    }
+    return std::make_shared<const Wavetable>(std::vector<float>(), sin_amplitudes);
+}
+
+/* Analyse one cycle of a waveform into harmonics and regenerate it band limited */
+inline std::shared_ptr<const Wavetable> generate_from_cycle(const float* cycle, int length)
+{
+    assert(length >= 4 && (length & (length - 1)) == 0);
+    RealFft fft(length);
+    std::vector<float> re(fft.bins());
+    std::vector<float> im(fft.bins());
+    fft.forward(cycle, re.data(), im.data());
+
+    int harmonics = length / 2 - 1;
+    std::vector<float> cos_amplitudes(harmonics);
+    std::vector<float> sin_amplitudes(harmonics);
+    for (int h = 1; h <= harmonics; ++h)
+    {
+        cos_amplitudes[h - 1] = 2.0f * re[h] / length;
+        sin_amplitudes[h - 1] = -2.0f * im[h] / length;
+    }
+    return std::make_shared<const Wavetable>(cos_amplitudes, sin_amplitudes, re[0] / length);
+}
+
+WavetableStore& WavetableStore::instance()
+{
+    static WavetableStore store;
+    return store;
+}
+
+std::shared_ptr<const Wavetable> WavetableStore::get(BasicWaveform waveform)
+{
+    std::scoped_lock lock(_mutex);
+    auto& table = _basic_tables[static_cast<int>(waveform)];
+    if (table == nullptr)
+    {
+        table = generate_basic_waveform(waveform);
+    }
+    return table;
+}
+
+std::shared_ptr<const Wavetable> WavetableStore::get(const std::string& name)
+{
+    std::scoped_lock lock(_mutex);
+    auto table = _user_tables.find(name);
+    return table != _user_tables.end() ? table->second : nullptr;
+}
+
+std::shared_ptr<const Wavetable> WavetableStore::add(const std::string& name, const float* cycle, int length)
+{
+    auto table = generate_from_cycle(cycle, length);
+    std::scoped_lock lock(_mutex);
+    _user_tables[name] = table;
+    return table;
+}
+
+std::shared_ptr<const Wavetable> WavetableStore::add(const std::string& name,
+                                                     const std::vector<float>& cos_amplitudes,
+                                                     const std::vector<float>& sin_amplitudes)
+{
+    auto table = std::make_shared<const Wavetable>(cos_amplitudes, sin_amplitudes);
+    std::scoped_lock lock(_mutex);
+    _user_tables[name] = table;
+    return table;
+}
+
+std::shared_ptr<const MorphWavetable> WavetableStore::basic_morph()
+{
+    std::vector<std::shared_ptr<const Wavetable>> frames;
+    for (auto waveform : {BasicWaveform::SINE, BasicWaveform::TRIANGLE, BasicWaveform::SAW, BasicWaveform::PULSE})
+    {
+        frames.push_back(get(waveform));
+    }
+    std::scoped_lock lock(_mutex);
+    if (_basic_morph == nullptr)
+    {
+        _basic_morph = std::make_shared<const MorphWavetable>(frames);
+    }
+    return _basic_morph;
+}
+
+std::shared_ptr<const MorphWavetable> WavetableStore::get_morph(const std::string& name)
+{
+    std::scoped_lock lock(_mutex);
+    auto table = _morph_tables.find(name);
+    return table != _morph_tables.end() ? table->second : nullptr;
+}
+
+std::shared_ptr<const MorphWavetable> WavetableStore::add_morph(const std::string& name, const float* cycles, int length, int frames)
+{
+    std::vector<std::shared_ptr<const Wavetable>> tables;
+    for (int f = 0; f < frames; ++f)
+    {
+        tables.push_back(generate_from_cycle(cycles + f * length, length));
+    }
+    auto table = std::make_shared<const MorphWavetable>(tables);
+    std::scoped_lock lock(_mutex);
+    _morph_tables[name] = table;
+    return table;
+}
+
+void WavetableStore::clear()
+{
+    std::scoped_lock lock(_mutex);
+    _user_tables.clear();
+    _morph_tables.clear();
+    _basic_morph.reset();
+    for (auto& table : _basic_tables)
+    {
+        table.reset();
+    }
+}
+
+} // namespace bricks
@@ -1,3 +1,5 @@
+#include <thread>
+
 #include "gtest/gtest.h"
 
 #include "bricks_dsp/analyzer_bricks.h"
@@ -33,3 +35,365 @@ TEST_F(MeterBrickTest, OperationalTest)
     EXPECT_NEAR(0.9, *_test_module.control_output(MeterBrick<>::ControlOutput::RMS), 0.05);
     EXPECT_NEAR(1.0, *_test_module.control_output(MeterBrick<>::ControlOutput::PEAK), 0.05);
 }
+
+TEST_F(MeterBrickTest, NegativePeakTest)
+{
+    /* A negative dc signal has the same peak as a positive one */
+    _buffer.fill(-0.5f);
+    for (int i = 0; i < 1000; ++i)
+    {
+        _test_module.render();
+    }
+    EXPECT_NEAR(from_db_approx(0.5f), *_test_module.control_output(MeterBrick<>::ControlOutput::PEAK), 0.001);
+    EXPECT_NEAR(from_db_approx(0.5f), *_test_module.control_output(MeterBrick<>::ControlOutput::RMS), 0.001);
+}
+
+class TruePeakMeterBrickTest : public ::testing::Test
+{
+protected:
+    TruePeakMeterBrickTest() {}
+
+    /* Render a sine with the given frequency and phase, returns the sample peak */
+    float render_sine(float freq, float phase, int blocks)
+    {
+        float sample_peak = 0;
+        for (int b = 0; b < blocks; ++b)
+        {
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                _buffer[i] = std::sin(2.0f * static_cast<float>(M_PI) * freq * _sample++ / SAMPLERATE + phase);
+                sample_peak = std::max(sample_peak, std::abs(_buffer[i]));
+            }
+            _test_module.render();
+        }
+        return sample_peak;
+    }
+
+    static constexpr float SAMPLERATE = 48000;
+
+    int                 _sample{0};
+    AudioBuffer         _buffer;
+    TruePeakMeterBrick  _test_module{&_buffer};
+};
+
+TEST_F(TruePeakMeterBrickTest, OperationalTest)
+{
+    _test_module.reset();
+    /* At a quarter of the samplerate with a 45 degree phase shift, all samples
+     * are at +-0.707 while the true peak is 1 */
+    float sample_peak = render_sine(SAMPLERATE / 4, static_cast<float>(M_PI) / 4, 100);
+    EXPECT_NEAR(0.707f, sample_peak, 0.001f);
+    EXPECT_NEAR(1.0f, *_test_module.control_output(TruePeakMeterBrick::TRUE_PEAK), 0.02f);
+
+    /* Lower frequencies are accurate too */
+    _test_module.reset();
+    render_sine(997.0f, 0.3f, 100);
+    EXPECT_NEAR(1.0f, *_test_module.control_output(TruePeakMeterBrick::TRUE_PEAK), 0.01f);
+
+    /* The max is held until reset */
+    _buffer.fill(0.0f);
+    for (int i = 0; i < 10; ++i)
+    {
+        _test_module.render();
+    }
+    EXPECT_FLOAT_EQ(0.0f, *_test_module.control_output(TruePeakMeterBrick::TRUE_PEAK));
+    EXPECT_NEAR(1.0f, *_test_module.control_output(TruePeakMeterBrick::MAX_TRUE_PEAK), 0.01f);
+}
+
+class LoudnessMeterBrickTest : public ::testing::Test
+{
+protected:
+    LoudnessMeterBrickTest()
+    {
+        _test_module.set_samplerate(SAMPLERATE);
+    }
+
+    void render_sine(float amplitude, float seconds)
+    {
+        int blocks = static_cast<int>(seconds * SAMPLERATE / PROC_BLOCK_SIZE);
+        for (int b = 0; b < blocks; ++b)
+        {
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                _left[i] = amplitude * std::sin(2.0f * static_cast<float>(M_PI) * 997.0f * _sample++ / SAMPLERATE);
+            }
+            _right = _left;
+            _test_module.render();
+        }
+    }
+
+    float output(int output)
+    {
+        return *_test_module.control_output(output);
+    }
+
+    static constexpr float SAMPLERATE = 48000;
+    using Meter = LoudnessMeterBrick<2>;
+
+    int             _sample{0};
+    AudioBuffer     _left;
+    AudioBuffer     _right;
+    Meter           _test_module{&_left, &_right};
+};
+
+TEST_F(LoudnessMeterBrickTest, OperationalTest)
+{
+    EXPECT_FLOAT_EQ(Meter::MIN_LOUDNESS, output(Meter::MOMENTARY));
+
+    /* A -20 dBFS 1 kHz sine in both channels is -20 LUFS */
+    render_sine(0.1f, 0.5f);
+    EXPECT_NEAR(-20.0f, output(Meter::MOMENTARY), 0.1f);
+    EXPECT_FLOAT_EQ(Meter::MIN_LOUDNESS, output(Meter::SHORT_TERM));
+    render_sine(0.1f, 3.5f);
+    EXPECT_NEAR(-20.0f, output(Meter::SHORT_TERM), 0.1f);
+    EXPECT_NEAR(-20.0f, output(Meter::INTEGRATED), 0.1f);
+
+    /* Quieter parts more than 10 LU below are gated and don't affect the integrated loudness */
+    render_sine(0.01f, 4.0f);
+    EXPECT_NEAR(-40.0f, output(Meter::MOMENTARY), 0.1f);
+    EXPECT_NEAR(-40.0f, output(Meter::SHORT_TERM), 0.1f);
+    EXPECT_NEAR(-20.0f, output(Meter::INTEGRATED), 0.2f);
+
+    /* Silence is below the absolute gate */
+    render_sine(0.0f, 4.0f);
+    EXPECT_FLOAT_EQ(Meter::MIN_LOUDNESS, output(Meter::MOMENTARY));
+    EXPECT_NEAR(-20.0f, output(Meter::INTEGRATED), 0.2f);
+
+    _test_module.reset();
+    EXPECT_FLOAT_EQ(Meter::MIN_LOUDNESS, output(Meter::INTEGRATED));
+}
+
+TEST(SnapshotBufferTest, TestHistory)
+{
+    SnapshotBuffer<int, 3> buffer;
+    int value = -1;
+    EXPECT_FALSE(buffer.read_copy(0, value));
+
+    buffer.push(1);
+    buffer.push(2);
+    EXPECT_EQ(2u, buffer.frame_count());
+    ASSERT_TRUE(buffer.read_copy(0, value));
+    EXPECT_EQ(2, value);
+    ASSERT_TRUE(buffer.read_copy(1, value));
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(buffer.read_copy(2, value));
+
+    /* A slot being written in place is not visible until published */
+    buffer.push(3);
+    buffer.write_slot() = 4;
+    ASSERT_TRUE(buffer.read_copy(0, value));
+    EXPECT_EQ(3, value);
+    ASSERT_TRUE(buffer.read_copy(2, value));
+    EXPECT_EQ(1, value);
+    EXPECT_FALSE(buffer.read_copy(3, value));
+    buffer.publish();
+    ASSERT_TRUE(buffer.read_copy(0, value));
+    EXPECT_EQ(4, value);
+
+    /* A frame overwritten during a read is detected */
+    bool valid = buffer.read(2, [&](const int& frame)
+    {
+        EXPECT_EQ(2, frame);
+        buffer.push(5);
+        buffer.push(6);
+    });
+    EXPECT_FALSE(valid);
+}
+
+TEST(SnapshotBufferTest, TestConcurrentReaders)
+{
+    using Frame = std::array<int, 256>;
+    constexpr int FRAMES = 20000;
+    SnapshotBuffer<Frame, 2> buffer;
+    std::atomic<bool> done{false};
+    std::atomic<int> reads{0};
+    std::atomic<int> torn{0};
+
+    auto reader = [&]()
+    {
+        while (!done)
+        {
+            bool consistent = true;
+            bool valid = buffer.read(0, [&](const Frame& frame)
+            {
+                Frame copy = frame;
+                consistent = std::all_of(copy.begin(), copy.end(), [&](int v) {return v == copy[0];});
+            });
+            /* Torn reads can happen, but must always be reported as not valid */
+            if (valid)
+            {
+                reads++;
+                torn += consistent ? 0 : 1;
+            }
+        }
+    };
+    std::thread reader_1(reader);
+    std::thread reader_2(reader);
+
+    for (int f = 0; f < FRAMES; ++f)
+    {
+        buffer.write_slot().fill(f);
+        buffer.publish();
+        if (f % 100 == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    done = true;
+    reader_1.join();
+    reader_2.join();
+
+    Frame last;
+    ASSERT_TRUE(buffer.read_copy(0, last));
+    EXPECT_EQ(FRAMES - 1, last[0]);
+    EXPECT_GT(reads, 0);
+    EXPECT_EQ(0, torn);
+}
+
+class OscilloscopeBrickTest : public ::testing::Test
+{
+protected:
+    OscilloscopeBrickTest()
+    {
+        _test_module.set_control_input(Scope::SKIP, &_skip);
+    }
+
+    static constexpr int BLOCK_SIZE = 64;
+    using Scope = OscilloscopeBrick<BLOCK_SIZE, 4>;
+
+    float          _trig_level{0.5f};
+    float          _skip{0.0f};
+    AudioBuffer    _buffer;
+    Scope          _test_module{&_trig_level, &_buffer};
+};
+
+TEST_F(OscilloscopeBrickTest, OperationalTest)
+{
+    /* Skip is 1 at control value 0, which records every other sample */
+    _buffer.fill(0.7f);
+    for (int i = 0; i < 4 * BLOCK_SIZE / PROC_BLOCK_SIZE; ++i)
+    {
+        _test_module.render();
+    }
+    EXPECT_EQ(1u, _test_module.block_count());
+
+    _test_module.sync();
+    for (auto sample : _test_module.display_data(0))
+    {
+        ASSERT_FLOAT_EQ(0.7f, sample);
+    }
+    for (auto sample : _test_module.display_data(1))
+    {
+        ASSERT_FLOAT_EQ(0.0f, sample);
+    }
+
+    bool valid = _test_module.read_display_data(0, [&](const Scope::Block& block)
+    {
+        EXPECT_FLOAT_EQ(0.7f, block[BLOCK_SIZE - 1]);
+    });
+    EXPECT_TRUE(valid);
+}
+
+class SpectrumAnalyzerBrickTest : public ::testing::Test
+{
+protected:
+    SpectrumAnalyzerBrickTest()
+    {
+        _test_module.set_samplerate(SAMPLERATE);
+    }
+
+    void render_sine(float freq, int blocks)
+    {
+        for (int b = 0; b < blocks; ++b)
+        {
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                _buffer[i] = std::sin(2.0f * static_cast<float>(M_PI) * freq * _sample++ / SAMPLERATE);
+            }
+            _test_module.render();
+        }
+    }
+
+    static constexpr float SAMPLERATE = 44100;
+
+    int                     _sample{0};
+    float                   _averaging{0.0f};
+    AudioBuffer             _buffer;
+    SpectrumAnalyzerBrick   _test_module{&_averaging, &_buffer};
+};
+
+TEST_F(SpectrumAnalyzerBrickTest, OperationalTest)
+{
+    /* Nothing to analyse yet */
+    EXPECT_FALSE(_test_module.process());
+    SpectrumAnalyzerBrick::Frame frame;
+    EXPECT_FALSE(_test_module.read_frame_copy(0, frame));
+
+    render_sine(1000.0f, 8192 / PROC_BLOCK_SIZE);
+    ASSERT_TRUE(_test_module.process());
+    /* 8192 samples with a hop of 1024 */
+    EXPECT_EQ(8u, _test_module.frame_count());
+    EXPECT_EQ(0, _test_module.dropped_samples());
+
+    ASSERT_TRUE(_test_module.read_frame_copy(0, frame));
+    ASSERT_GE(SpectrumAnalyzerBrick::MAX_BANDS, _test_module.bands());
+    auto peak = std::max_element(frame.begin(), frame.begin() + _test_module.bands()) - frame.begin();
+    float band_ratio = _test_module.band_frequency(1) / _test_module.band_frequency(0);
+    EXPECT_GT(1000.0f * band_ratio, _test_module.band_frequency(peak));
+    EXPECT_LT(1000.0f / band_ratio, _test_module.band_frequency(peak));
+    /* A full scale sine is 0 dB */
+    EXPECT_NEAR(0.0f, frame[peak], 1.0f);
+    EXPECT_LT(frame[5], -60.0f);
+    EXPECT_LT(frame[_test_module.bands() - 5], -60.0f);
+}
+
+TEST_F(SpectrumAnalyzerBrickTest, TestReset)
+{
+    _averaging = 0.9f;
+    render_sine(1000.0f, 8192 / PROC_BLOCK_SIZE);
+    _test_module.reset();
+    /* Less than a hop after the reset, the sine rendered before it is discarded
+     * and a silent frame published instead */
+    AudioBuffer silence;
+    silence.fill(0.0f);
+    _buffer = silence;
+    _test_module.render();
+    ASSERT_TRUE(_test_module.process());
+    EXPECT_EQ(1u, _test_module.frame_count());
+    SpectrumAnalyzerBrick::Frame frame;
+    ASSERT_TRUE(_test_module.read_frame_copy(0, frame));
+    for (int b = 0; b < _test_module.bands(); ++b)
+    {
+        ASSERT_EQ(SpectrumAnalyzerBrick::MIN_DB, frame[b]);
+    }
+
+    /* The next frame only contains silence, nothing averaged from before the reset */
+    for (int i = 0; i < 1024 / PROC_BLOCK_SIZE; ++i)
+    {
+        _test_module.render();
+    }
+    ASSERT_TRUE(_test_module.process());
+    EXPECT_EQ(2u, _test_module.frame_count());
+    ASSERT_TRUE(_test_module.read_frame_copy(0, frame));
+    EXPECT_EQ(SpectrumAnalyzerBrick::MIN_DB, *std::max_element(frame.begin(), frame.begin() + _test_module.bands()));
+}
+
+TEST_F(SpectrumAnalyzerBrickTest, WorkerTest)
+{
+    AnalyzerWorker worker(std::chrono::milliseconds(1));
+    worker.add(&_test_module);
+    for (int i = 0; i < 2000 && _test_module.frame_count() == 0; ++i)
+    {
+        render_sine(100.0f, 4);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    worker.remove(&_test_module);
+    EXPECT_GT(_test_module.frame_count(), 0u);
+
+    bool valid = _test_module.read_frame(0, [&](const SpectrumAnalyzerBrick::Frame& frame)
+    {
+        EXPECT_GE(0.0f, frame[0]);
+        EXPECT_LE(SpectrumAnalyzerBrick::MIN_DB, frame[_test_module.bands() - 1]);
+    });
+    EXPECT_TRUE(valid);
+}
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "gtest/gtest.h"
 #define private public
 
@@ -52,6 +54,231 @@ TEST_F(AudioRateAdsrEnvelopeBrickTest, OperationalTest)
     }
 }
 
+TEST_F(AudioRateAdsrEnvelopeBrickTest, TestDecayTime)
+{
+    /* Should reach sustain after the attack + decay time, independently of the release time */
+    _attack = 0.01f;
+    _decay = 0.01f;
+    _sustain = 0.5f;
+    _release = 1.0f;
+    _test_module.set_samplerate(TEST_SAMPLERATE);
+    _test_module.gate(true);
+    int blocks = static_cast<int>(0.021f * TEST_SAMPLERATE / PROC_BLOCK_SIZE) + 1;
+    for (int i = 0; i < blocks; ++i)
+    {
+        _test_module.render();
+    }
+    const auto& out_buffer = *_test_module.audio_output(AudioRateADSRBrick::ENV_OUT);
+    EXPECT_FLOAT_EQ(0.5f, out_buffer[PROC_BLOCK_SIZE - 1]);
+}
+
+class PolyAdsrBrickTest : public ::testing::Test
+{
+protected:
+    PolyAdsrBrickTest() {}
+
+    static constexpr int VOICES = 3;
+    /* 441 samples each at 44100 Hz */
+    float       _attack{0.01f};
+    float       _decay{0.02f};
+    float       _sustain{0.5f};
+    float       _release{0.01f};
+    PolyADSRBrick<VOICES>    _test_module{&_attack, &_decay, &_sustain, &_release};
+
+    /* Render samples samples and return the output of voice */
+    std::vector<float> render(int blocks, int voice)
+    {
+        std::vector<float> out;
+        for (int i = 0; i < blocks; ++i)
+        {
+            _test_module.render();
+            const auto& buffer = *_test_module.audio_output(voice);
+            out.insert(out.end(), buffer.begin(), buffer.end());
+        }
+        return out;
+    }
+};
+
+TEST_F(PolyAdsrBrickTest, OperationalTest)
+{
+    constexpr int SEGMENT = 441;
+    constexpr int BLOCKS = (2 * SEGMENT) / PROC_BLOCK_SIZE + 2;
+    _test_module.set_samplerate(TEST_SAMPLERATE);
+    for (int v = 0; v < VOICES; ++v)
+    {
+        ASSERT_TRUE(_test_module.finished(v));
+    }
+    _test_module.gate(0, true);
+    _test_module.gate(2, true);
+    auto out = render(BLOCKS, 0);
+    EXPECT_FALSE(_test_module.finished(0));
+    EXPECT_TRUE(_test_module.finished(1));
+    EXPECT_FALSE(_test_module.finished(2));
+
+    /* Linear attack that reaches exactly 1 at the end of the attack time */
+    EXPECT_NEAR(1.0f / SEGMENT, out[0], 1.0e-6f);
+    for (int i = 1; i < SEGMENT; ++i)
+    {
+        ASSERT_GT(out[i], out[i - 1]);
+    }
+    EXPECT_FLOAT_EQ(1.0f, out[SEGMENT - 1]);
+
+    /* Decay to the sustain level, and stay there */
+    EXPECT_LT(out[SEGMENT], 1.0f);
+    EXPECT_FLOAT_EQ(0.5f, out[2 * SEGMENT - 1]);
+    EXPECT_FLOAT_EQ(0.5f, out.back());
+    for (auto sample : *_test_module.audio_output(1))
+    {
+        ASSERT_EQ(0.0f, sample);
+    }
+
+    /* Release voice 0 only */
+    _test_module.gate(0, false);
+    out = render(BLOCKS, 0);
+    EXPECT_LT(out[0], 0.5f);
+    EXPECT_FLOAT_EQ(0.0f, out[SEGMENT - 1]);
+    EXPECT_FLOAT_EQ(0.0f, out.back());
+    EXPECT_TRUE(_test_module.finished(0));
+    EXPECT_FLOAT_EQ(0.5f, (*_test_module.audio_output(2))[0]);
+
+    /* Retrigger during release continues from the current level */
+    _test_module.gate(2, false);
+    _test_module.render();
+    float level = (*_test_module.audio_output(2))[PROC_BLOCK_SIZE - 1];
+    _test_module.gate(2, true);
+    _test_module.render();
+    EXPECT_NEAR(level + 1.0f / SEGMENT, (*_test_module.audio_output(2))[0], 1.0e-5f);
+
+    _test_module.reset();
+    EXPECT_TRUE(_test_module.finished(2));
+}
+
+class SegmentEnvelopeBrickTest : public ::testing::Test
+{
+protected:
+    SegmentEnvelopeBrickTest()
+    {
+        /* 1 sample per ms */
+        _test_module.set_samplerate(1000);
+    }
+
+    std::vector<float> render(int blocks)
+    {
+        std::vector<float> out;
+        for (int i = 0; i < blocks; ++i)
+        {
+            _test_module.render();
+            const auto& buffer = *_test_module.audio_output(SegmentEnvelopeBrick<8>::ENV_OUT);
+            out.insert(out.end(), buffer.begin(), buffer.end());
+        }
+        return out;
+    }
+
+    SegmentEnvelopeBrick<8> _test_module;
+};
+
+TEST_F(SegmentEnvelopeBrickTest, TestDahdsr)
+{
+    _test_module.set_dahdsr(0.005f, 0.010f, 0.005f, 0.020f, 0.5f, 0.010f);
+    EXPECT_TRUE(_test_module.finished());
+    _test_module.gate(true, 3);
+    EXPECT_FALSE(_test_module.finished());
+    auto out = render(3);
+
+    /* 3 samples before the gate and 5 samples of delay */
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_EQ(0.0f, out[i]);
+    }
+    /* Attack */
+    for (int i = 8; i < 18; ++i)
+    {
+        ASSERT_NEAR((i - 7) / 10.0f, out[i], 1.0e-6f);
+    }
+    /* Hold */
+    for (int i = 18; i < 23; ++i)
+    {
+        ASSERT_EQ(1.0f, out[i]);
+    }
+    /* Decay and sustain */
+    EXPECT_NEAR(1.0f - 0.5f / 20, out[23], 1.0e-6f);
+    EXPECT_EQ(0.5f, out[42]);
+    EXPECT_EQ(0.5f, out.back());
+
+    /* Release from the sustain level at the given sample */
+    _test_module.gate(false, 10);
+    out = render(1);
+    EXPECT_EQ(0.5f, out[9]);
+    EXPECT_NEAR(0.45f, out[10], 1.0e-6f);
+    EXPECT_EQ(0.0f, out[19]);
+    EXPECT_EQ(0.0f, out.back());
+    EXPECT_TRUE(_test_module.finished());
+}
+
+TEST_F(SegmentEnvelopeBrickTest, TestCurves)
+{
+    constexpr float CURVE = -4.0f;
+    _test_module.set_segments({{1.0f, 0.020f, CURVE}, {0.0f, 0.020f, -CURVE}});
+    _test_module.gate(true);
+    auto out = render(2);
+
+    auto shape = [](float x, float curve) {return (1.0f - std::exp(curve * x)) / (1.0f - std::exp(curve));};
+    for (int i = 0; i < 20; ++i)
+    {
+        ASSERT_NEAR(shape((i + 1) / 20.0f, CURVE), out[i], 1.0e-5f);
+        ASSERT_NEAR(1.0f - shape((i + 1) / 20.0f, -CURVE), out[i + 20], 1.0e-5f);
+    }
+    /* Negative curve rises fast, positive falls slowly at first */
+    EXPECT_GT(out[9], 0.75f);
+    EXPECT_GT(out[29], 0.75f);
+    EXPECT_EQ(1.0f, out[19]);
+    EXPECT_EQ(0.0f, out[39]);
+    /* No sustain, so it ends by itself */
+    EXPECT_TRUE(_test_module.finished());
+}
+
+TEST_F(SegmentEnvelopeBrickTest, TestLoop)
+{
+    /* Attack, then loop between 0.5 and 1 while the gate is held, then release */
+    _test_module.set_segments({{1.0f, 0.004f}, {0.5f, 0.004f}, {1.0f, 0.004f}, {0.0f, 0.004f}});
+    _test_module.set_loop(1, 2);
+    _test_module.gate(true);
+    auto out = render(4);
+    for (int i = 4; i < static_cast<int>(out.size()) - 8; ++i)
+    {
+        ASSERT_FLOAT_EQ(out[i], out[i + 8]);
+        ASSERT_GE(out[i], 0.5f);
+    }
+    _test_module.gate(false);
+    out = render(1);
+    EXPECT_EQ(0.0f, out[3]);
+    EXPECT_TRUE(_test_module.finished());
+
+    /* Retrigger from the current level */
+    _test_module.gate(true);
+    _test_module.gate(false, 2);
+    out = render(1);
+    EXPECT_NEAR(0.5f, out[1], 1.0e-6f);
+    EXPECT_LT(out[2], out[1]);
+}
+
+TEST_F(SegmentEnvelopeBrickTest, TestShortenRunningSegment)
+{
+    _test_module.set_segments({{1.0f, 0.100f}, {0.0f, 0.050f}});
+    _test_module.gate(true);
+    auto out = render(2);
+    EXPECT_NEAR(0.64f, out.back(), 1.0e-5f);
+
+    /* The running segment is now shorter than the 64 samples already rendered
+     * of it, so it should end at its level with the next sample */
+    _test_module.set_segments({{1.0f, 0.010f}, {0.0f, 0.050f}});
+    out = render(3);
+    EXPECT_EQ(1.0f, out[0]);
+    EXPECT_NEAR(1.0f - 1.0f / 50, out[1], 1.0e-5f);
+    EXPECT_EQ(0.0f, out[50]);
+    EXPECT_TRUE(_test_module.finished());
+}
+
 class AdsrEnvelopeBrickTest : public ::testing::Test
 {
 protected:
@@ -95,6 +322,60 @@ TEST_F(AdsrEnvelopeBrickTest, OperationalTest)
 
 }
 
+class AudioAdsrEnvelopeBrickTest : public ::testing::Test
+{
+protected:
+    AudioAdsrEnvelopeBrickTest() {}
+
+    float       _attack{0.01f};
+    float       _decay{0.01f};
+    float       _sustain{0.5f};
+    float       _release{0.01f};
+    AudioADSREnvelopeBrick    _test_module{&_attack, &_decay, &_sustain, &_release};
+};
+
+TEST_F(AudioAdsrEnvelopeBrickTest, OperationalTest)
+{
+    _test_module.set_samplerate(TEST_SAMPLERATE);
+    const float* out(_test_module.control_output(AudioADSREnvelopeBrick::ENV_OUT));
+    ASSERT_TRUE(_test_module.finished());
+    _test_module.gate(true);
+
+    /* Linear attack, 441 samples */
+    _test_module.render();
+    EXPECT_NEAR(static_cast<float>(PROC_BLOCK_SIZE) / 441, *out, 1.0e-5f);
+    float prev = *out;
+    int attack_blocks = 441 / PROC_BLOCK_SIZE;
+    for (int i = 1; i < attack_blocks; ++i)
+    {
+        _test_module.render();
+        ASSERT_GT(*out, prev);
+        prev = *out;
+    }
+
+    /* Decays exponentially from the sample where the attack ended towards sustain squared */
+    _test_module.render();
+    int decay_samples = (attack_blocks + 1) * PROC_BLOCK_SIZE - 441;
+    EXPECT_NEAR(0.25f + 0.75f * std::exp(-decay_samples / 441.0f), *out, 1.0e-4f);
+    for (int i = 0; i < 100; ++i)
+    {
+        _test_module.render();
+    }
+    EXPECT_NEAR(0.25f, *out, 1.0e-3f);
+
+    _test_module.gate(false);
+    prev = *out;
+    _test_module.render();
+    EXPECT_NEAR(prev * std::exp(-PROC_BLOCK_SIZE / 441.0f), *out, 1.0e-5f);
+    ASSERT_FALSE(_test_module.finished());
+    for (int i = 0; i < 1000 && !_test_module.finished(); ++i)
+    {
+        _test_module.render();
+    }
+    EXPECT_TRUE(_test_module.finished());
+    EXPECT_EQ(0.0f, *out);
+}
+
 class LfoBrickTest : public ::testing::Test
 {
 protected:
@@ -155,4 +436,206 @@ TEST_F(RandLfoBrickTest, OperationalTest)
         EXPECT_LT(out, 1.0f);
 
     }
-}
\ No newline at end of file
+}
+
+TEST(SineLfoBrickTest, TestWrap)
+{
+    float rate = 1.0f;
+    SineLfoBrick module(&rate);
+    module.set_samplerate(TEST_SAMPLERATE);
+    const float& out = *module.control_output(SineLfoBrick::LFO_OUT);
+    float max = 0;
+    float min = 0;
+    /* At max rate the phase wraps many times, the output should still be a sine */
+    for (int i = 0; i < 10000; ++i)
+    {
+        module.render();
+        max = std::max(max, out);
+        min = std::min(min, out);
+    }
+    EXPECT_NEAR(1.0f, max, 0.01f);
+    EXPECT_NEAR(-1.0f, min, 0.01f);
+}
+
+class AudioRateLfoBrickTest : public ::testing::Test
+{
+protected:
+    AudioRateLfoBrickTest() {}
+
+    void SetUp()
+    {
+        _test_module.set_samplerate(TEST_SAMPLERATE);
+    }
+
+    float               _rate{0.8f};
+    AudioRateLfoBrick   _test_module{&_rate};
+};
+
+TEST_F(AudioRateLfoBrickTest, OperationalTest)
+{
+    const auto& out = *_test_module.audio_output(AudioRateLfoBrick::LFO_OUT);
+    for (auto waveform : {AudioRateLfoBrick::Waveform::SINE, AudioRateLfoBrick::Waveform::TRIANGLE,
+                          AudioRateLfoBrick::Waveform::SAW, AudioRateLfoBrick::Waveform::PULSE,
+                          AudioRateLfoBrick::Waveform::SAMPLE_HOLD, AudioRateLfoBrick::Waveform::RANDOM})
+    {
+        _test_module.reset();
+        _test_module.set_waveform(waveform);
+        float max = -1;
+        float min = 1;
+        for (int n = 0; n < 1000; ++n)
+        {
+            _test_module.render();
+            for (auto sample : out)
+            {
+                ASSERT_LE(sample, 1.0f);
+                ASSERT_GE(sample, -1.0f);
+                max = std::max(max, sample);
+                min = std::min(min, sample);
+            }
+        }
+        EXPECT_GT(max - min, 0.5f);
+    }
+}
+
+TEST_F(AudioRateLfoBrickTest, TestContinuity)
+{
+    /* Consecutive samples of a sine and a random ramp never step more than
+     * the maximum slope, also across block boundaries */
+    const auto& out = *_test_module.audio_output(AudioRateLfoBrick::LFO_OUT);
+    float freq = 0.05f * std::exp2(_rate * 10.0f);
+    float max_step = 2.0f * static_cast<float>(M_PI) * freq / TEST_SAMPLERATE * 1.01f;
+    for (auto waveform : {AudioRateLfoBrick::Waveform::SINE, AudioRateLfoBrick::Waveform::RANDOM})
+    {
+        _test_module.reset();
+        _test_module.set_waveform(waveform);
+        _test_module.render();
+        float prev = out[PROC_BLOCK_SIZE - 1];
+        for (int n = 0; n < 1000; ++n)
+        {
+            _test_module.render();
+            for (auto sample : out)
+            {
+                ASSERT_LE(std::abs(sample - prev), max_step);
+                prev = sample;
+            }
+        }
+    }
+}
+
+TEST_F(AudioRateLfoBrickTest, TestMatchesControlRate)
+{
+    /* The last sample of every block is where the control rate lfo is */
+    LfoBankBrick<1> control_lfo(&_rate);
+    control_lfo.set_samplerate(TEST_SAMPLERATE);
+    control_lfo.set_waveform(0, LfoBankBrick<1>::Waveform::SAW);
+    _test_module.set_waveform(AudioRateLfoBrick::Waveform::SAW);
+    const auto& out = *_test_module.audio_output(AudioRateLfoBrick::LFO_OUT);
+    for (int n = 0; n < 1000; ++n)
+    {
+        _test_module.render();
+        control_lfo.render();
+        float control = *control_lfo.control_output(0);
+        /* Unless one of them just wrapped */
+        if (std::abs(control) < 0.99f)
+        {
+            ASSERT_NEAR(control, out[PROC_BLOCK_SIZE - 1], 1e-4f);
+        }
+    }
+}
+
+class LfoBankBrickTest : public ::testing::Test
+{
+protected:
+    LfoBankBrickTest() {}
+
+    void SetUp()
+    {
+        _test_module.set_samplerate(TEST_SAMPLERATE);
+    }
+
+    std::array<float, 4> _rates{0.5f, 0.5f, 0.5f, 0.5f};
+    LfoBankBrick<4>      _test_module{&_rates[0], &_rates[1], &_rates[2], &_rates[3]};
+};
+
+TEST_F(LfoBankBrickTest, OperationalTest)
+{
+    _test_module.set_waveform(1, LfoBankBrick<4>::Waveform::TRIANGLE);
+    _test_module.set_waveform(2, LfoBankBrick<4>::Waveform::PULSE);
+    _test_module.set_waveform(3, LfoBankBrick<4>::Waveform::SAMPLE_HOLD);
+
+    std::array<float, 4> max{};
+    std::array<float, 4> min{};
+    for (int n = 0; n < 20000; ++n)
+    {
+        _test_module.render();
+        for (int i = 0; i < 4; ++i)
+        {
+            float out = *_test_module.control_output(i);
+            ASSERT_LE(out, 1.0f);
+            ASSERT_GE(out, -1.0f);
+            max[i] = std::max(max[i], out);
+            min[i] = std::min(min[i], out);
+        }
+    }
+    /* Sine and triangle reach their peaks, pulse is either 1 or -1 */
+    EXPECT_NEAR(1.0f, max[0], 0.01f);
+    EXPECT_NEAR(-1.0f, min[0], 0.01f);
+    EXPECT_NEAR(1.0f, max[1], 0.05f);
+    EXPECT_NEAR(-1.0f, min[1], 0.05f);
+    EXPECT_FLOAT_EQ(1.0f, max[2]);
+    EXPECT_FLOAT_EQ(-1.0f, min[2]);
+    EXPECT_GT(max[3] - min[3], 0.5f);
+
+    /* Matches the rate of LfoBrick, 0.05 * 2^5 Hz */
+    _test_module.reset();
+    _test_module.set_waveform(0, LfoBankBrick<4>::Waveform::SAW);
+    float freq = 0.05f * 32.0f;
+    int blocks = static_cast<int>(TEST_SAMPLERATE / PROC_BLOCK_SIZE / freq / 2.0f);
+    for (int n = 0; n < blocks; ++n)
+    {
+        _test_module.render();
+    }
+    EXPECT_NEAR(0.0f, *_test_module.control_output(0), 0.05f);
+}
+
+TEST_F(LfoBankBrickTest, TestTempoSync)
+{
+    /* 1 cycle per beat at 120 bpm is 2 Hz */
+    _test_module.set_waveform(0, LfoBankBrick<4>::Waveform::SAW);
+    _test_module.set_tempo(120);
+    _test_module.set_sync(0, 1.0f);
+    _test_module.set_sync(1, 1.0f);
+    _test_module.set_waveform(1, LfoBankBrick<4>::Waveform::SAW);
+    _rates[1] = 0.0f;
+    _test_module.set_beat_position(0.5);
+    _test_module.render();
+    EXPECT_NEAR(0.0f, *_test_module.control_output(0), 0.01f);
+
+    /* Synced lfos ignore the rate and stay in phase for a long time */
+    for (int n = 0; n < 1000000; ++n)
+    {
+        _test_module.render();
+        ASSERT_EQ(*_test_module.control_output(0), *_test_module.control_output(1));
+    }
+    /* And can be realigned to the song position */
+    _test_module.set_beat_position(1.25);
+    _test_module.render();
+    EXPECT_NEAR(-0.5f, *_test_module.control_output(0), 0.01f);
+}
+
+TEST_F(LfoBankBrickTest, TestResetIsReproducible)
+{
+    _test_module.set_waveform(0, LfoBankBrick<4>::Waveform::SAMPLE_HOLD);
+    std::array<float, 100> first;
+    for (auto& value : first)
+    {
+        _test_module.render();
+        value = *_test_module.control_output(0);
+    }
+    _test_module.reset();
+    for (auto value : first)
+    {
+        _test_module.render();
+        ASSERT_EQ(value, *_test_module.control_output(0));
+    }
+}
@@ -163,4 +163,183 @@ TEST_F(ParallelFilterBrickTest, OperationalTest)
         /* second channels should be zero in - zero out (check there's no crosstalk */
         EXPECT_FLOAT_EQ(0.0f, sample);
     }
-}
\ No newline at end of file
+}
+
+template <typename Precision>
+void test_parallel_filter()
+{
+    /* Not a multiple of the simd width, so the last group is partial */
+    constexpr int CHANNELS = 11;
+    std::array<AudioBuffer, CHANNELS> buffers;
+    ParallelFilterBrick<CHANNELS, Precision> module_under_test;
+    std::array<BasicFixedFilterBrick<Precision>, CHANNELS> references;
+    auto coeff = calc_lowpass<typename PrecisionTraits<Precision>::ProcessType>(1000, DEFAULT_Q, DEFAULT_SAMPLERATE);
+    module_under_test.set_coeffs(coeff);
+    for (int c = 0; c < CHANNELS; ++c)
+    {
+        module_under_test.set_audio_input(c, &buffers[c]);
+        references[c].set_audio_input(0, &buffers[c]);
+        references[c].set_coeffs(coeff);
+    }
+
+    for (int block = 0; block < 4; ++block)
+    {
+        for (int c = 0; c < CHANNELS; ++c)
+        {
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                buffers[c][i] = std::sin(0.05f * (c + 1) * (block * PROC_BLOCK_SIZE + i));
+            }
+            references[c].render();
+        }
+        module_under_test.render();
+        for (int c = 0; c < CHANNELS; ++c)
+        {
+            const auto& expected = *references[c].audio_output(0);
+            const auto& out = *module_under_test.audio_output(c);
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                ASSERT_NEAR(expected[i], out[i], 1e-5) << "channel " << c;
+            }
+        }
+    }
+}
+
+TEST_F(ParallelFilterBrickTest, TestChannelGroups)
+{
+    test_parallel_filter<float>();
+    test_parallel_filter<double>();
+}
+
+TEST(FilterPrecisionTest, TestLowCutoffCoefficients)
+{
+    /* b0 of a lowpass is proportional to 1 - cos(w0), which loses most of its
+     * precision to cancellation at low cutoffs when calculated in float */
+    double float_error = 0;
+    double mixed_error = 0;
+    for (float freq = 20; freq < 100; freq += 1.7f)
+    {
+        double reference = calc_lowpass<double>(freq, DEFAULT_Q, DEFAULT_SAMPLERATE).b0;
+        float_error = std::max(float_error, std::abs(calc_lowpass<float>(freq, DEFAULT_Q, DEFAULT_SAMPLERATE).b0 / reference - 1));
+        mixed_error = std::max(mixed_error, std::abs(calc_lowpass<float, double>(freq, DEFAULT_Q, DEFAULT_SAMPLERATE).b0 / reference - 1));
+    }
+    EXPECT_LT(mixed_error, 1e-6);
+    EXPECT_GT(float_error, 1e-4);
+}
+
+TEST(FilterPrecisionTest, TestPrecisionsAgree)
+{
+    AudioBuffer buffer;
+    float cutoff = 0.5f;
+    float resonance = 0.3f;
+    BasicFixedFilterBrick<float> fixed_float(&buffer);
+    BasicFixedFilterBrick<double> fixed_double(&buffer);
+    BasicFixedFilterBrick<MixedPrecision> fixed_mixed(&buffer);
+    fixed_float.set_peaking(800, 6, 2);
+    fixed_double.set_peaking(800, 6, 2);
+    fixed_mixed.set_peaking(800, 6, 2);
+    BasicSVFFilterBrick<float> svf_float(&cutoff, &resonance, &buffer);
+    BasicSVFFilterBrick<double> svf_double(&cutoff, &resonance, &buffer);
+    BasicSVFFilterBrick<MixedPrecision> svf_mixed(&cutoff, &resonance, &buffer);
+    BasicMystransLadderFilter<float> ladder_float(&cutoff, &resonance, &buffer);
+    BasicMystransLadderFilter<double> ladder_double(&cutoff, &resonance, &buffer);
+    std::array<DspBrick*, 8> bricks = {&fixed_float, &fixed_double, &fixed_mixed, &svf_float,
+                                       &svf_double, &svf_mixed, &ladder_float, &ladder_double};
+    for (auto brick : bricks)
+    {
+        brick->reset();
+    }
+
+    for (int block = 0; block < 20; ++block)
+    {
+        make_test_sq_wave(buffer);
+        for (auto brick : bricks)
+        {
+            brick->render();
+        }
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            float reference = (*fixed_double.audio_output(0))[i];
+            ASSERT_NEAR(reference, (*fixed_float.audio_output(0))[i], 1e-4);
+            ASSERT_NEAR(reference, (*fixed_mixed.audio_output(0))[i], 1e-4);
+            for (int output = 0; output < 3; ++output)
+            {
+                reference = (*svf_double.audio_output(output))[i];
+                ASSERT_NEAR(reference, (*svf_float.audio_output(output))[i], 1e-4);
+                ASSERT_NEAR(reference, (*svf_mixed.audio_output(output))[i], 1e-4);
+            }
+            ASSERT_NEAR((*ladder_double.audio_output(0))[i], (*ladder_float.audio_output(0))[i], 1e-4);
+        }
+    }
+}
+class ConvolutionBrickTest : public ::testing::Test
+{
+protected:
+    ConvolutionBrickTest() {}
+
+    void SetUp()
+    {
+        _ir.resize(IR_LENGTH);
+        for (int i = 0; i < IR_LENGTH; ++i)
+        {
+            _ir[i] = std::sin(i * 0.37f) * std::exp(-0.004f * i);
+        }
+        _input.resize(PROC_BLOCK_SIZE * TEST_BLOCKS);
+        for (size_t i = 0; i < _input.size(); ++i)
+        {
+            _input[i] = std::sin(i * 0.11f) + 0.5f * std::cos(i * 0.73f);
+        }
+    }
+
+    /* Render the test input and compare with a direct convolution */
+    void run_test()
+    {
+        for (int b = 0; b < TEST_BLOCKS; ++b)
+        {
+            std::copy(&_input[b * PROC_BLOCK_SIZE], &_input[(b + 1) * PROC_BLOCK_SIZE], _buffer.begin());
+            _test_module.render();
+            for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+            {
+                int n = b * PROC_BLOCK_SIZE + i;
+                float expected = 0.0f;
+                for (int k = 0; k < IR_LENGTH && k <= n; ++k)
+                {
+                    expected += _ir[k] * _input[n - k];
+                }
+                ASSERT_NEAR(expected, (*_out_buffer)[i], 1.0e-3f) << "at sample " << n;
+            }
+        }
+    }
+
+    static constexpr int IR_LENGTH = 1000;
+    static constexpr int TEST_BLOCKS = 100;
+
+    std::vector<float>  _ir;
+    std::vector<float>  _input;
+    AudioBuffer         _buffer;
+    ConvolutionBrick    _test_module{&_buffer};
+    const AudioBuffer*  _out_buffer{_test_module.audio_output(ConvolutionBrick::CONV_OUT)};
+};
+
+TEST_F(ConvolutionBrickTest, UniformPartitionsTest)
+{
+    _test_module.set_impulse_response(_ir.data(), IR_LENGTH);
+    run_test();
+}
+
+TEST_F(ConvolutionBrickTest, NonUniformPartitionsTest)
+{
+    _test_module.set_impulse_response(_ir.data(), IR_LENGTH, 4 * PROC_BLOCK_SIZE);
+    run_test();
+}
+
+TEST_F(ConvolutionBrickTest, SharedImpulseResponseTest)
+{
+    auto ir = std::make_shared<const ImpulseResponse>(_ir.data(), IR_LENGTH, 4 * PROC_BLOCK_SIZE);
+    ASSERT_TRUE(ir->tail());
+    ConvolutionBrick other_brick;
+    other_brick.set_impulse_response(ir);
+    _test_module.set_impulse_response(ir);
+    EXPECT_EQ(3, ir.use_count());
+    run_test();
+}
@@ -284,6 +284,65 @@ TEST_F(AllpassDelayBrickTest, OperationTest)
     EXPECT_FLOAT_EQ(_out_buffer[5], 0.0f);
 }
 
+class FdnReverbBrickTest : public ::testing::Test
+{
+protected:
+    FdnReverbBrickTest() {}
+
+    void SetUp()
+    {
+        fill_buffer(_left_in, 0.0f);
+        fill_buffer(_right_in, 0.0f);
+        _left_in[0] = 1.0f;
+    }
+
+    AudioBuffer         _left_in;
+    AudioBuffer         _right_in;
+    float               _size{0.5};
+    float               _decay{0.5};
+    float               _damping{0.5};
+    float               _mod{0.5};
+    FdnReverbBrick<8>   _test_module{&_size, &_decay, &_damping, &_mod, &_left_in, &_right_in};
+    const AudioBuffer&  _left_out{*_test_module.audio_output(FdnReverbBrick<8>::LEFT_OUT)};
+    const AudioBuffer&  _right_out{*_test_module.audio_output(FdnReverbBrick<8>::RIGHT_OUT)};
+};
+
+TEST_F(FdnReverbBrickTest, OperationTest)
+{
+    /* Nothing comes out before the shortest delay has passed */
+    _test_module.render();
+    assert_buffer(_left_out, 0.0f);
+    assert_buffer(_right_out, 0.0f);
+    fill_buffer(_left_in, 0.0f);
+
+    /* Render 1 second and measure the energy in the first and last part */
+    int blocks = DEFAULT_SAMPLERATE / PROC_BLOCK_SIZE;
+    float early_energy = 0;
+    float late_energy = 0;
+    float right_energy = 0;
+    for (int b = 0; b < blocks; ++b)
+    {
+        _test_module.render();
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            ASSERT_TRUE(std::isfinite(_left_out[i]));
+            float energy = _left_out[i] * _left_out[i];
+            early_energy += b < blocks / 4 ? energy : 0.0f;
+            late_energy += b >= blocks * 3 / 4 ? energy : 0.0f;
+            right_energy += _right_out[i] * _right_out[i];
+        }
+    }
+    EXPECT_GT(early_energy, 0.0f);
+    EXPECT_GT(right_energy, 0.0f);
+    EXPECT_LT(late_energy, early_energy);
+
+    /* Reset should clear the tail */
+    _test_module.reset();
+    _test_module.render();
+    assert_buffer(_left_out, 0.0f);
+    assert_buffer(_right_out, 0.0f);
+}
+
 class BitRateReducerBrickTest : public ::testing::Test
 {
 protected:
@@ -0,0 +1,174 @@
+#include "gtest/gtest.h"
+
+#include "bricks_dsp/batch_renderer.h"
+#include "bricks_dsp/filter_bricks.h"
+#include "bricks_dsp/offline_renderer.h"
+#include "bricks_dsp/utility_bricks.h"
+
+#include "test_utils.h"
+
+using namespace bricks;
+
+/* Outputs the sample position on the first channel and its negative on the second */
+class RampSource : public RenderSource
+{
+public:
+    int channels() const override {return 2;}
+
+    void render(int64_t sample_pos) override
+    {
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            _out[0][i] = static_cast<float>(sample_pos + i);
+            _out[1][i] = -static_cast<float>(sample_pos + i);
+        }
+    }
+
+    const AudioBuffer& output(int channel) const override {return _out[channel];}
+
+private:
+    std::array<AudioBuffer, 2> _out;
+};
+
+TEST(OfflineRendererTest, TestMultipleJobs)
+{
+    constexpr int JOBS = 7;
+    /* Not a multiple of the block or chunk size */
+    constexpr int LENGTH = 10 * PROC_BLOCK_SIZE + 5;
+    std::array<RampSource, JOBS> sources;
+    std::array<MemorySink, JOBS> sinks;
+
+    /* Small chunks so that every job needs several writes */
+    OfflineRenderer renderer(3, 2 * PROC_BLOCK_SIZE);
+    for (int j = 0; j < JOBS; ++j)
+    {
+        renderer.add_job(&sources[j], &sinks[j], LENGTH);
+    }
+    auto stats = renderer.run();
+    EXPECT_EQ(JOBS * LENGTH, stats.samples);
+
+    for (const auto& sink : sinks)
+    {
+        ASSERT_EQ(2, sink.channels());
+        ASSERT_EQ(LENGTH, sink.frames());
+        EXPECT_TRUE(sink.closed());
+        for (int i = 0; i < LENGTH; ++i)
+        {
+            ASSERT_FLOAT_EQ(static_cast<float>(i), sink.data()[2 * i]);
+            ASSERT_FLOAT_EQ(-static_cast<float>(i), sink.data()[2 * i + 1]);
+        }
+    }
+}
+
+TEST(OfflineRendererTest, TestGraphSource)
+{
+    float gain = 0.5f;
+    AudioBuffer input;
+    input.fill(1.0f);
+    VcaBrick<Response::LINEAR> vca(&gain, &input);
+    GraphSource source({&vca}, {vca.audio_output(VcaBrick<Response::LINEAR>::VCA_OUT)});
+    MemorySink sink;
+
+    OfflineRenderer renderer;
+    EXPECT_GE(renderer.threads(), 1);
+    renderer.add_job(&source, &sink, 4 * PROC_BLOCK_SIZE);
+    renderer.run();
+
+    ASSERT_EQ(1, sink.channels());
+    ASSERT_EQ(4 * PROC_BLOCK_SIZE, sink.frames());
+    /* The vca ramps up to its gain during the first block */
+    EXPECT_FLOAT_EQ(0.5f, sink.data().back());
+}
+
+/* Convolves an impulse with an amplitude given by the parameter */
+class ImpulsePatch : public RenderSource
+{
+public:
+    static constexpr int PARAMETERS = 1;
+    using SharedData = std::shared_ptr<const ImpulseResponse>;
+
+    explicit ImpulsePatch(const SharedData& ir)
+    {
+        _conv.set_impulse_response(ir);
+        instances++;
+    }
+
+    int channels() const override {return 1;}
+
+    void render(int64_t sample_pos) override
+    {
+        _input.fill(0.0f);
+        if (sample_pos == 0)
+        {
+            _input[0] = _amplitude;
+        }
+        _conv.render();
+    }
+
+    const AudioBuffer& output(int /*channel*/) const override {return *_output;}
+
+    void set_samplerate(float samplerate) {_conv.set_samplerate(samplerate);}
+
+    void reset() {_conv.reset();}
+
+    void set_parameters(const float* values) {_amplitude = values[0];}
+
+    static inline std::atomic<int> instances{0};
+
+private:
+    float               _amplitude{0};
+    AudioBuffer         _input;
+    ConvolutionBrick    _conv{&_input};
+    const AudioBuffer*  _output{_conv.audio_output(ConvolutionBrick::CONV_OUT)};
+};
+
+TEST(BatchRendererTest, TestVariants)
+{
+    constexpr int IR_LENGTH = 3 * PROC_BLOCK_SIZE;
+    constexpr int LENGTH = 4 * PROC_BLOCK_SIZE;
+    std::vector<float> ir_data(IR_LENGTH);
+    for (int i = 0; i < IR_LENGTH; ++i)
+    {
+        ir_data[i] = 1.0f - static_cast<float>(i) / IR_LENGTH;
+    }
+    auto ir = std::make_shared<const ImpulseResponse>(ir_data.data(), IR_LENGTH);
+    BatchRenderer<ImpulsePatch> renderer(std::make_shared<const ImpulsePatch::SharedData>(ir), 2);
+
+    auto parameters = BatchRenderer<ImpulsePatch>::parameter_grid({{{0.25f, 0.5f, 1.0f, -1.0f, 2.0f}}});
+    ASSERT_EQ(5u, parameters.size());
+    std::vector<MemorySink> sinks(parameters.size());
+    auto stats = renderer.render(parameters, [&](int variant) {return &sinks[variant];}, LENGTH);
+    EXPECT_EQ(static_cast<int64_t>(parameters.size()) * LENGTH, stats.samples);
+
+    /* One patch per worker, not per variant, all sharing the same impulse response */
+    EXPECT_LE(ImpulsePatch::instances, renderer.threads());
+    EXPECT_EQ(2 + ImpulsePatch::instances, ir.use_count());
+
+    for (size_t v = 0; v < parameters.size(); ++v)
+    {
+        ASSERT_EQ(LENGTH, sinks[v].frames());
+        for (int i = 0; i < LENGTH; ++i)
+        {
+            float expected = i < IR_LENGTH ? parameters[v][0] * ir_data[i] : 0.0f;
+            ASSERT_NEAR(expected, sinks[v].data()[i], 1.0e-5f) << "variant " << v << " sample " << i;
+        }
+    }
+}
+
+struct GridPatch
+{
+    static constexpr int PARAMETERS = 2;
+    using SharedData = int;
+};
+
+TEST(BatchRendererTest, TestParameterGrid)
+{
+    auto grid = BatchRenderer<GridPatch>::parameter_grid({{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f}}});
+    ASSERT_EQ(6u, grid.size());
+    EXPECT_FLOAT_EQ(1.0f, grid[0][0]);
+    EXPECT_FLOAT_EQ(4.0f, grid[0][1]);
+    EXPECT_FLOAT_EQ(1.0f, grid[1][0]);
+    EXPECT_FLOAT_EQ(5.0f, grid[1][1]);
+    EXPECT_FLOAT_EQ(3.0f, grid[5][0]);
+    EXPECT_FLOAT_EQ(5.0f, grid[5][1]);
+}
@@ -165,6 +165,200 @@ TEST_F(WtOscillatorBrickTest, TestOperation)
 }
 
 
+TEST_F(WtOscillatorBrickTest, TestUserTable)
+{
+    /* A user table of a single cosine should play back a cosine */
+    std::array<float, 64> cycle;
+    for (int i = 0; i < static_cast<int>(cycle.size()); ++i)
+    {
+        cycle[i] = std::cos(2.0f * M_PI * i / cycle.size());
+    }
+    _test_module.set_wavetable(WavetableStore::instance().add("cosine", cycle.data(), cycle.size()));
+    _test_module.reset();
+    _pitch = 0;
+    _test_module.render();
+    const auto& buffer = *_test_module.audio_output(WtOscillatorBrick::OSC_OUT);
+
+    float phase_inc = control_to_freq(_pitch) / DEFAULT_SAMPLERATE;
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_NEAR(std::cos(2.0f * M_PI * phase_inc * (i + 1)), buffer[i], 1e-3);
+    }
+    WavetableStore::instance().clear();
+}
+
+TEST(WavetableTest, TestHarmonicLimits)
+{
+    /* Amplitude of harmonics just below and above the limit of level 4 of the saw */
+    auto table = WavetableStore::instance().get(BasicWaveform::SAW);
+    constexpr int LEVEL = 4;
+    int length = Wavetable::length(LEVEL);
+    auto amplitude = [&](int harmonic)
+    {
+        double re = 0;
+        double im = 0;
+        for (int i = 0; i < length; ++i)
+        {
+            re += table->level(LEVEL)[i] * std::cos(2.0 * M_PI * harmonic * i / length);
+            im += table->level(LEVEL)[i] * std::sin(2.0 * M_PI * harmonic * i / length);
+        }
+        return 2.0 * std::sqrt(re * re + im * im) / length;
+    };
+    int limit = Wavetable::HARMONIC_LIMITS[LEVEL];
+    EXPECT_NEAR(0.5 / (limit - 1), amplitude(limit - 1), 1e-5);
+    EXPECT_NEAR(0.0, amplitude(limit), 1e-5);
+    EXPECT_EQ(62, limit - 1);
+}
+
+class WavetableMorphOscillatorBrickTest : public ::testing::Test
+{
+protected:
+    WavetableMorphOscillatorBrickTest() {}
+
+    void SetUp()
+    {
+        /* 2 frames, a cosine and an inverted cosine */
+        std::array<float, 128> cycles;
+        for (int i = 0; i < 64; ++i)
+        {
+            cycles[i] = std::cos(2.0f * M_PI * i / 64);
+            cycles[i + 64] = -cycles[i];
+        }
+        auto table = WavetableStore::instance().add_morph("test", cycles.data(), 64, 2);
+        _test_module.set_wavetable(table);
+        _audio_rate_module.set_wavetable(table);
+    }
+
+    void TearDown()
+    {
+        WavetableStore::instance().clear();
+    }
+
+    AudioBuffer                             _position_mod;
+    float                                   _pitch{0};
+    float                                   _position{0};
+    WavetableMorphOscillatorBrick<false>    _test_module{&_pitch, &_position};
+    WavetableMorphOscillatorBrick<true>     _audio_rate_module{&_pitch, &_position, &_position_mod};
+};
+
+TEST_F(WavetableMorphOscillatorBrickTest, TestOperation)
+{
+    const auto& buffer = *_test_module.audio_output(WavetableMorphOscillatorBrick<false>::OSC_OUT);
+    float phase_inc = control_to_freq(_pitch) / DEFAULT_SAMPLERATE;
+    _test_module.render();
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_NEAR(std::cos(2.0f * M_PI * phase_inc * (i + 1)), buffer[i], 1e-3);
+    }
+
+    /* Halfway between the frames they cancel out */
+    _position = 0.5;
+    _test_module.render();
+    _test_module.render();
+    for (auto sample : buffer)
+    {
+        ASSERT_NEAR(0.0f, sample, 1e-3);
+    }
+
+    /* Last frame */
+    _position = 1.0;
+    _test_module.reset();
+    _test_module.render();
+    _test_module.render();
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_NEAR(-std::cos(2.0f * M_PI * phase_inc * (i + 1 + PROC_BLOCK_SIZE)), buffer[i], 1e-3);
+    }
+}
+
+TEST_F(WavetableMorphOscillatorBrickTest, TestAudioRatePosition)
+{
+    const auto& buffer = *_audio_rate_module.audio_output(WavetableMorphOscillatorBrick<true>::OSC_OUT);
+    float phase_inc = control_to_freq(_pitch) / DEFAULT_SAMPLERATE;
+    /* Alternate between the frames every sample */
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        _position_mod[i] = i % 2 == 0 ? 0.0f : 1.0f;
+    }
+    _audio_rate_module.render();
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        float expected = std::cos(2.0f * M_PI * phase_inc * (i + 1));
+        ASSERT_NEAR(i % 2 == 0 ? expected : -expected, buffer[i], 1e-3);
+    }
+}
+
+class WavetableStoreTest : public ::testing::Test
+{
+protected:
+    WavetableStoreTest() {}
+
+    void TearDown()
+    {
+        _module_under_test.clear();
+    }
+
+    WavetableStore& _module_under_test{WavetableStore::instance()};
+};
+
+TEST_F(WavetableStoreTest, TestBasicWaveforms)
+{
+    auto saw = _module_under_test.get(BasicWaveform::SAW);
+    ASSERT_TRUE(saw);
+    /* Tables should be shared, not generated again */
+    EXPECT_EQ(saw, _module_under_test.get(BasicWaveform::SAW));
+    EXPECT_NE(saw, _module_under_test.get(BasicWaveform::SINE));
+
+    /* Every level should be followed by a copy of the first sample */
+    for (int level = 0; level < Wavetable::LEVELS; ++level)
+    {
+        EXPECT_FLOAT_EQ(saw->level(level)[0], saw->level(level)[Wavetable::length(level)]);
+    }
+
+    /* Sine tables should be a sine with amplitude 0.5 in every level */
+    auto sine = _module_under_test.get(BasicWaveform::SINE);
+    for (int level = 0; level < Wavetable::LEVELS; ++level)
+    {
+        int length = Wavetable::length(level);
+        const float* table = sine->level(level);
+        for (int i = 0; i < length; ++i)
+        {
+            ASSERT_NEAR(0.5f * std::sin(2.0f * M_PI * i / length), table[i], 1e-5);
+        }
+    }
+}
+
+TEST_F(WavetableStoreTest, TestUserTables)
+{
+    EXPECT_FALSE(_module_under_test.get("test"));
+
+    /* Harmonics over the limit of each level should be removed */
+    std::vector<float> sin_amplitudes(40, 0.0f);
+    sin_amplitudes[0] = 1.0f;
+    sin_amplitudes[39] = 1.0f;
+    auto table = _module_under_test.add("test", {}, sin_amplitudes);
+    EXPECT_EQ(table, _module_under_test.get("test"));
+
+    int level = Wavetable::LEVELS - 1;
+    int length = Wavetable::length(level);
+    for (int i = 0; i < length; ++i)
+    {
+        ASSERT_NEAR(std::sin(2.0f * M_PI * i / length), table->level(level)[i], 1e-5);
+    }
+    level = 0;
+    length = Wavetable::length(level);
+    for (int i = 0; i < length; ++i)
+    {
+        float expected = std::sin(2.0f * M_PI * i / length) + std::sin(2.0f * M_PI * 40 * i / length);
+        ASSERT_NEAR(expected, table->level(level)[i], 1e-4);
+    }
+
+    _module_under_test.clear();
+    EXPECT_FALSE(_module_under_test.get("test"));
+    /* Tables still in use should not be deleted */
+    EXPECT_FLOAT_EQ(1.0f, table->level(0)[length / 4]);
+}
+
 class NoiseGeneratorBrickTest : public ::testing::Test
 {
 protected:
@@ -210,4 +404,52 @@ TEST_F(NoiseGeneratorBrickTest, TestOperation)
         ASSERT_LE(std::abs(sample), 1.0f);
     }
     ASSERT_NE(0.0f, sum);
-}
\ No newline at end of file
+}
+
+TEST_F(NoiseGeneratorBrickTest, TestSpectralTilt)
+{
+    /* The power of the first difference relative to the signal power is 2 for
+     * white noise and decreases the more the high frequencies are attenuated */
+    auto diff_ratio = [&](NoiseGeneratorBrick::Waveform waveform)
+    {
+        _test_module.set_samplerate(TEST_SAMPLERATE);
+        _test_module.reset();
+        _test_module.set_waveform(waveform);
+        const auto& buffer = *_test_module.audio_output(NoiseGeneratorBrick::NOISE_OUT);
+        double power = 0;
+        double diff_power = 0;
+        float prev = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            _test_module.render();
+            for (auto sample : buffer)
+            {
+                power += sample * sample;
+                diff_power += (sample - prev) * (sample - prev);
+                prev = sample;
+            }
+        }
+        return diff_power / power;
+    };
+    float white = diff_ratio(NoiseGeneratorBrick::Waveform::WHITE);
+    float pink = diff_ratio(NoiseGeneratorBrick::Waveform::PINK);
+    float brown = diff_ratio(NoiseGeneratorBrick::Waveform::BROWN);
+    EXPECT_NEAR(2.0f, white, 0.05f);
+    EXPECT_LT(pink, 0.5f * white);
+    EXPECT_LT(brown, 0.01f * pink);
+}
+
+TEST_F(NoiseGeneratorBrickTest, TestResetIsReproducible)
+{
+    _test_module.set_waveform(NoiseGeneratorBrick::Waveform::PINK);
+    const auto& buffer = *_test_module.audio_output(NoiseGeneratorBrick::NOISE_OUT);
+    _test_module.render();
+    AudioBuffer first = buffer;
+    _test_module.render();
+    _test_module.reset();
+    _test_module.render();
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_EQ(first[i], buffer[i]);
+    }
+}
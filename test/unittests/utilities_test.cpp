@@ -1,8 +1,12 @@
+#include <thread>
+
 #include "gtest/gtest.h"
 #define private public
 
 #include "bricks_dsp/dsp_brick.h"
 #include "bricks_dsp/utils.h"
+#include "bricks_dsp/denormal_guard.h"
+#include "bricks_dsp/fft.h"
 #include "random_device.cpp"
 #include "test_utils.h"
 
@@ -82,6 +86,69 @@ TEST(FromdBApprox, TestOperation)
     EXPECT_NEAR(1.0f - 12.0 / 30.0, from_db_approx(0.25f), 0.06);
 }
 
+TEST(Exp2Approx, TestOperation)
+{
+    for (float x = -20.0f; x < 20.0f; x += 0.137f)
+    {
+        EXPECT_NEAR(std::exp2(x), exp2_approx(x), std::exp2(x) * 1e-6);
+    }
+    EXPECT_FLOAT_EQ(1.0f, exp2_approx(0.0f));
+    EXPECT_FLOAT_EQ(1024.0f, exp2_approx(10.0f));
+}
+
+TEST(Sin2PiApprox, TestOperation)
+{
+    for (float phase = 0.0f; phase <= 1.0f; phase += 0.0037f)
+    {
+        EXPECT_NEAR(std::sin(2.0f * static_cast<float>(M_PI) * phase), sin_2pi_approx(phase), 2e-6);
+    }
+    EXPECT_NEAR(1.0f, sin_2pi_approx(0.25f), 1e-6);
+    EXPECT_NEAR(-1.0f, sin_2pi_approx(0.75f), 1e-6);
+}
+
+TEST(MixRamped, TestOperation)
+{
+    constexpr int INPUTS = 9;
+    std::array<AudioBuffer, INPUTS> buffers;
+    std::array<const float*, INPUTS> inputs;
+    std::array<float, INPUTS> start;
+    std::array<float, INPUTS> step;
+    for (int k = 0; k < INPUTS; ++k)
+    {
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            buffers[k][i] = std::sin(0.3f * i + k);
+        }
+        inputs[k] = buffers[k].data();
+        start[k] = 0.1f * k;
+        step[k] = 0.01f - 0.002f * k;
+    }
+
+    /* All tile remainders, against a plain sum */
+    for (int count = 0; count <= INPUTS; ++count)
+    {
+        AudioBuffer mono(2.0f);
+        AudioBuffer left(2.0f);
+        AudioBuffer right(2.0f);
+        mix_ramped<PROC_BLOCK_SIZE>(mono.data(), inputs.data(), start.data(), step.data(), count);
+        mix_ramped_stereo<PROC_BLOCK_SIZE>(left.data(), right.data(), inputs.data(), start.data(), step.data(),
+                                           step.data(), start.data(), count, true);
+        for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+        {
+            float mono_sum = 0.0f;
+            float right_sum = 2.0f;
+            for (int k = 0; k < count; ++k)
+            {
+                mono_sum += buffers[k][i] * (start[k] + step[k] * (i + 1));
+                right_sum += buffers[k][i] * (step[k] + start[k] * (i + 1));
+            }
+            ASSERT_NEAR(mono_sum, mono[i], 1e-5);
+            ASSERT_NEAR(mono_sum + 2.0f, left[i], 1e-5);
+            ASSERT_NEAR(right_sum, right[i], 1e-4);
+        }
+    }
+}
+
 TEST(LinearInterpolatorTest, TestOperation)
 {
     LinearInterpolator<PROC_BLOCK_SIZE> _module_under_test;
@@ -123,6 +190,41 @@ TEST(OnePoleLagTest, TestOperation)
     ASSERT_GT(buffer[PROC_BLOCK_SIZE / 2 - 1], 1.0f);
 }
 
+TEST(OnePoleLagTest, TestGetAll)
+{
+    OnePoleLag<PROC_BLOCK_SIZE> per_sample;
+    OnePoleLag<PROC_BLOCK_SIZE> per_block;
+    AudioBuffer buffer;
+    for (float target : {2.0f, -1.0f, -1.0f, 0.5f})
+    {
+        per_sample.set(target);
+        per_block.set(target);
+        per_block.get_all(buffer);
+        for (auto sample : buffer)
+        {
+            ASSERT_NEAR(per_sample.get(), sample, 1e-5);
+        }
+    }
+}
+
+TEST(LinearInterpolatorTest, TestGetAll)
+{
+    LinearInterpolator<PROC_BLOCK_SIZE> per_sample;
+    LinearInterpolator<PROC_BLOCK_SIZE> per_block;
+    AudioBuffer buffer;
+    for (float target : {2.0f, -1.0f, -1.0f, 0.5f})
+    {
+        per_sample.set(target);
+        per_block.set(target);
+        per_block.get_all(buffer);
+        for (auto sample : buffer)
+        {
+            ASSERT_NEAR(per_sample.get(), sample, 1e-5);
+        }
+        ASSERT_FLOAT_EQ(target, buffer[PROC_BLOCK_SIZE - 1]);
+    }
+}
+
 TEST(RandomDeviceTest, TestOperation)
 {
     RandomDevice module_under_test;
@@ -145,6 +247,102 @@ TEST(RandomDeviceTest, TestUniquenes)
     }
 }
 
+TEST(RandomDeviceTest, TestFillNorm)
+{
+    RandomDevice module_under_test;
+    AudioBuffer buffer;
+    double sum = 0;
+    double sq_sum = 0;
+    constexpr int BLOCKS = 1000;
+    for (int i = 0; i < BLOCKS; ++i)
+    {
+        module_under_test.fill_norm(buffer);
+        for (auto sample : buffer)
+        {
+            ASSERT_GE(sample, -1.0f);
+            ASSERT_LT(sample, 1.0f);
+            sum += sample;
+            sq_sum += sample * sample;
+        }
+    }
+    /* Uniform distribution, mean 0 and variance 1/3 */
+    constexpr int SAMPLES = BLOCKS * PROC_BLOCK_SIZE;
+    EXPECT_NEAR(0.0, sum / SAMPLES, 0.02);
+    EXPECT_NEAR(1.0 / 3.0, sq_sum / SAMPLES, 0.02);
+}
+
+TEST(RandomDeviceTest, TestSeedAndStreams)
+{
+    RandomDevice dev_a(5, 0);
+    RandomDevice dev_b(5, 0);
+    RandomDevice dev_c(5, 1);
+    RandomDevice dev_d(6, 0);
+    for (int i = 0; i < 5; ++i)
+    {
+        auto a = dev_a.get();
+        EXPECT_EQ(a, dev_b.get());
+        EXPECT_NE(a, dev_c.get());
+        EXPECT_NE(a, dev_d.get());
+    }
+    dev_c.set_seed(5, 0);
+    dev_a.seek(0);
+    EXPECT_EQ(dev_a.get(), dev_c.get());
+}
+
+TEST(RandomDeviceTest, TestJumpAhead)
+{
+    RandomDevice dev_a(5, 2);
+    RandomDevice dev_b(5, 2);
+    std::array<float, 100> values;
+    dev_a.fill_norm(values);
+    dev_b.skip(60);
+    EXPECT_EQ(60u, dev_b.position());
+    EXPECT_EQ(values[60], dev_b.get_norm());
+    dev_b.seek(10);
+    EXPECT_EQ(values[10], dev_b.get_norm());
+}
+
+TEST(RandomContextTest, TestReproducibility)
+{
+    auto build = [](uint32_t seed)
+    {
+        RandomContext context(seed);
+        std::vector<RandomDevice> devices(3);
+        std::vector<uint32_t> values;
+        for (auto& device : devices)
+        {
+            values.push_back(device.get());
+        }
+        return values;
+    };
+    auto values = build(3);
+    EXPECT_NE(values[0], values[1]);
+    EXPECT_NE(values[1], values[2]);
+
+    /* Devices created outside the context in between don't affect it */
+    RandomDevice other;
+    EXPECT_EQ(values, build(3));
+    EXPECT_NE(values, build(4));
+
+    /* Neither does the thread it's built on */
+    std::vector<uint32_t> thread_values;
+    std::thread thread([&]() {thread_values = build(3);});
+    thread.join();
+    EXPECT_EQ(values, thread_values);
+
+    /* Nested contexts */
+    RandomContext outer(3);
+    RandomDevice first;
+    {
+        RandomContext inner(9);
+        EXPECT_EQ(&inner, RandomContext::current());
+    }
+    RandomDevice second;
+    EXPECT_EQ(&outer, RandomContext::current());
+    EXPECT_EQ(values[0], first.get());
+    EXPECT_EQ(values[1], second.get());
+}
+
 std::array<float, 10> INT_DATA = {1, 2, 3, 4, 5, 1, 1, 1, 0, 1};
 
 TEST(InterpolatorTest, TestZeroth)
@@ -354,3 +552,116 @@ TEST(UpSamplerTest, TestCubicUpSampler)
     EXPECT_NEAR(0.15, upsampled[19], 0.1);
     EXPECT_FLOAT_EQ(0.0,  upsampled[20]);
 }
+
+/* -ffast-math enables flush to zero at program startup, so the guard can only
+ * be tested by clearing the flags first. Returns the previous state */
+uint64_t clear_flush_to_zero()
+{
+#if defined(BRICKS_DSP_X86_FLUSH_TO_ZERO)
+    unsigned int state = _mm_getcsr();
+    _mm_setcsr(state & ~0x8040u);
+    return state;
+#elif defined(BRICKS_DSP_ARM64_FLUSH_TO_ZERO)
+    uint64_t state;
+    asm volatile("mrs %0, fpcr" : "=r"(state));
+    uint64_t cleared = state & ~(uint64_t(1) << 24);
+    asm volatile("msr fpcr, %0" : : "r"(cleared));
+    return state;
+#else
+    return 0;
+#endif
+}
+
+void restore_flush_to_zero(uint64_t state)
+{
+#if defined(BRICKS_DSP_X86_FLUSH_TO_ZERO)
+    _mm_setcsr(static_cast<unsigned int>(state));
+#elif defined(BRICKS_DSP_ARM64_FLUSH_TO_ZERO)
+    asm volatile("msr fpcr, %0" : : "r"(state));
+#else
+    (void)state;
+#endif
+}
+
+TEST(ScopedDenormalGuardTest, TestOperation)
+{
+    if (!ScopedDenormalGuard::supported())
+    {
+        GTEST_SKIP() << "Flush to zero not supported on this platform";
+    }
+    auto startup_state = clear_flush_to_zero();
+    ASSERT_FALSE(ScopedDenormalGuard::active());
+    volatile float denormal = 1.0e-39f;
+    volatile float result = denormal * 0.5f;
+    EXPECT_NE(0.0f, result);
+    {
+        ScopedDenormalGuard guard;
+        EXPECT_TRUE(ScopedDenormalGuard::active());
+        {
+            /* Nesting is allowed and leaves the outer state intact */
+            ScopedDenormalGuard inner_guard;
+            EXPECT_TRUE(ScopedDenormalGuard::active());
+        }
+        EXPECT_TRUE(ScopedDenormalGuard::active());
+
+        result = denormal * 0.5f;
+        EXPECT_EQ(0.0f, result);
+    }
+    /* The cleared state is restored */
+    EXPECT_FALSE(ScopedDenormalGuard::active());
+    result = denormal * 0.5f;
+    EXPECT_NE(0.0f, result);
+
+    restore_flush_to_zero(startup_state);
+}
+
+TEST(RealFftTest, TestForward)
+{
+    constexpr int SIZE = 64;
+    RealFft fft(SIZE);
+    ASSERT_EQ(SIZE / 2 + 1, fft.bins());
+
+    std::array<float, SIZE> signal;
+    for (int i = 0; i < SIZE; ++i)
+    {
+        signal[i] = std::sin(i * 0.3f) + 0.25f * std::cos(i * 1.7f) + 0.1f;
+    }
+    std::array<float, SIZE / 2 + 1> re;
+    std::array<float, SIZE / 2 + 1> im;
+    fft.forward(signal.data(), re.data(), im.data());
+
+    /* Compare with a direct dft */
+    for (int k = 0; k < fft.bins(); ++k)
+    {
+        double dft_re = 0;
+        double dft_im = 0;
+        for (int n = 0; n < SIZE; ++n)
+        {
+            dft_re += signal[n] * std::cos(2.0 * M_PI * k * n / SIZE);
+            dft_im -= signal[n] * std::sin(2.0 * M_PI * k * n / SIZE);
+        }
+        EXPECT_NEAR(dft_re, re[k], 1.0e-3);
+        EXPECT_NEAR(dft_im, im[k], 1.0e-3);
+    }
+}
+
+TEST(RealFftTest, TestInverse)
+{
+    constexpr int SIZE = 256;
+    RealFft fft(SIZE);
+    std::array<float, SIZE> signal;
+    std::array<float, SIZE> output;
+    std::array<float, SIZE / 2 + 1> re;
+    std::array<float, SIZE / 2 + 1> im;
+    for (int i = 0; i < SIZE; ++i)
+    {
+        signal[i] = std::sin(i * 0.05f) * std::cos(i * 0.9f);
+    }
+    fft.forward(signal.data(), re.data(), im.data());
+    fft.inverse(re.data(), im.data(), output.data());
+
+    for (int i = 0; i < SIZE; ++i)
+    {
+        EXPECT_NEAR(signal[i], output[i], 1.0e-5);
+    }
+}
@@ -241,3 +241,112 @@ TEST(MetaControlBrickTest, OperationalTest)
     EXPECT_FLOAT_EQ(1.0f, *module_under_test.control_output(2));
     EXPECT_FLOAT_EQ(0.0f, *module_under_test.control_output(3));
 }
+
+class ModMatrixBrickTest : public ::testing::Test
+{
+protected:
+    using Matrix = ModMatrixBrick<2, 1, 3, 2, 8>;
+
+    ModMatrixBrickTest() {}
+
+    std::array<float, 2> _ctrl{0.5f, -0.5f};
+    AudioBuffer          _audio;
+    Matrix               _test_module{{&_ctrl[0], &_ctrl[1]}, {&_audio}};
+};
+
+TEST_F(ModMatrixBrickTest, TestControlRoutes)
+{
+    fill_buffer(_audio, 0.25f);
+    ASSERT_TRUE(_test_module.add_route({0, 2, 2.0f}));
+    ASSERT_TRUE(_test_module.add_route({1, 0, 1.0f, Matrix::Curve::CUBIC}));
+    ASSERT_TRUE(_test_module.add_route({0, 0, 1.0f, Matrix::Curve::BIPOLAR}));
+    ASSERT_TRUE(_test_module.add_route({2, 2, 1.0f, Matrix::Curve::QUADRATIC}));
+    EXPECT_EQ(4, _test_module.route_count());
+    _test_module.render();
+
+    EXPECT_FLOAT_EQ(-0.125f + 0.0f, *_test_module.control_output(0));
+    EXPECT_FLOAT_EQ(0.0f, *_test_module.control_output(1));
+    EXPECT_FLOAT_EQ(1.0f + 0.0625f, *_test_module.control_output(2));
+
+    /* Replacing and removing routes */
+    ASSERT_TRUE(_test_module.add_route({0, 2, 1.0f, Matrix::Curve::INVERTED}));
+    _test_module.remove_route(1, 0);
+    EXPECT_EQ(3, _test_module.route_count());
+    _test_module.render();
+    EXPECT_FLOAT_EQ(0.0f, *_test_module.control_output(0));
+    EXPECT_FLOAT_EQ(0.5f + 0.0625f, *_test_module.control_output(2));
+
+    EXPECT_FALSE(_test_module.set_depth(1, 1, 1.0f));
+    EXPECT_TRUE(_test_module.set_depth(2, 2, 2.0f));
+    _test_module.render();
+    EXPECT_FLOAT_EQ(0.5f + 0.125f, *_test_module.control_output(2));
+
+    _test_module.clear_routes();
+    _test_module.render();
+    EXPECT_FLOAT_EQ(0.0f, *_test_module.control_output(2));
+
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_TRUE(_test_module.add_route({i % 3, i % 5, 1.0f + i}));
+    }
+    EXPECT_FALSE(_test_module.add_route({2, 4, 1.0f}));
+}
+
+TEST_F(ModMatrixBrickTest, TestAudioRoutes)
+{
+    fill_buffer(_audio, 0.5f);
+    _test_module.add_route({2, 3, 0.5f});
+    _test_module.add_route({0, 4, 1.0f});
+    _test_module.render();
+    const auto& audio_out = *_test_module.audio_output(0);
+    const auto& ctrl_out = *_test_module.audio_output(1);
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_FLOAT_EQ(0.25f, audio_out[i]);
+        ASSERT_FLOAT_EQ(0.5f, ctrl_out[i]);
+    }
+
+    /* Depth and control sources are ramped over the block */
+    _ctrl[0] = 1.0f;
+    _test_module.set_depth(2, 3, 1.0f);
+    _test_module.render();
+    float prev_audio = 0.25f;
+    float prev_ctrl = 0.5f;
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_GT(audio_out[i], prev_audio);
+        ASSERT_GT(ctrl_out[i], prev_ctrl);
+        prev_audio = audio_out[i];
+        prev_ctrl = ctrl_out[i];
+    }
+    EXPECT_FLOAT_EQ(0.5f, prev_audio);
+    EXPECT_FLOAT_EQ(1.0f, prev_ctrl);
+}
+
+TEST_F(ModMatrixBrickTest, TestRampsKeptOnRouteChanges)
+{
+    _test_module.add_route({0, 4, 1.0f});
+    _test_module.render();
+    const auto& audio_out = *_test_module.audio_output(0);
+    const auto& ctrl_out = *_test_module.audio_output(1);
+    EXPECT_FLOAT_EQ(0.5f, ctrl_out[PROC_BLOCK_SIZE - 1]);
+
+    /* Adding a route continues the ramps of the existing ones, while the new
+     * route starts at its current value */
+    _ctrl[0] = 1.0f;
+    _test_module.add_route({1, 3, 1.0f});
+    _test_module.render();
+    EXPECT_FLOAT_EQ(0.5f + 0.5f / PROC_BLOCK_SIZE, ctrl_out[0]);
+    EXPECT_FLOAT_EQ(1.0f, ctrl_out[PROC_BLOCK_SIZE - 1]);
+    for (int i = 0; i < PROC_BLOCK_SIZE; ++i)
+    {
+        ASSERT_FLOAT_EQ(-0.5f, audio_out[i]);
+    }
+
+    /* And so does removing a route */
+    _ctrl[0] = 0.0f;
+    _test_module.remove_route(1, 3);
+    _test_module.render();
+    EXPECT_FLOAT_EQ(1.0f - 1.0f / PROC_BLOCK_SIZE, ctrl_out[0]);
+    EXPECT_FLOAT_EQ(0.0f, ctrl_out[PROC_BLOCK_SIZE - 1]);
+}
@@ -0,0 +1,189 @@
+#!/usr/bin/env python3
+"""
+Stores and compares benchmark results from the bricks_dsp benchmarks.
+
+Results are read from google benchmark json output, i.e. from:
+    benchmarks --benchmark_out=results.json --benchmark_out_format=json --benchmark_repetitions=5
+
+and normalised into a baseline file where each result is keyed by fixture,
+brick (including its template arguments), audio type and the remaining fixture
+arguments, so results stay comparable when benchmarks are added or reordered.
+
+Usage:
+    bench_compare.py save baseline.json results.json [more_results.json ...]
+    bench_compare.py compare baseline.json results.json [more_results.json ...] [--threshold 0.05]
+
+compare accepts both raw google benchmark output and saved baselines, and exits
+with a non-zero status if any benchmark is slower than the baseline by more
+than the threshold and by more than the measured noise.
+"""
+
+import argparse
+import json
+import sys
+
+NOISE_FACTOR = 2.0
+TIME_UNITS_TO_NS = {"ns": 1.0, "us": 1.0e3, "ms": 1.0e6, "s": 1.0e9}
+# Fields in the google benchmark output that are not user counters
+IGNORED_FIELDS = {"name", "family_index", "per_family_instance_index", "run_name", "run_type", "repetitions",
+                  "repetition_index", "threads", "aggregate_name", "aggregate_unit", "iterations", "real_time",
+                  "cpu_time", "time_unit"}
+
+
+def split_template_args(args):
+    """Split a template argument list on commas that are not nested in <>"""
+    parts = []
+    depth = 0
+    current = ""
+    for c in args:
+        if c == "<":
+            depth += 1
+        elif c == ">":
+            depth -= 1
+        if c == "," and depth == 0:
+            parts.append(current.strip())
+            current = ""
+        else:
+            current += c
+    if current.strip():
+        parts.append(current.strip())
+    return parts
+
+
+def parse_name(run_name):
+    """Parse 'BrickBM<bricks::SVFFilterBrick, 2, 1, AudioType::NOISE>/iterations:10'
+    into its fixture, brick, audio type and remaining arguments"""
+    fixture, sep, rest = run_name.partition("<")
+    if not sep:
+        name, _, suffix = run_name.partition("/")
+        return {"fixture": name, "brick": "", "audio_type": "", "args": [], "suffix": suffix}
+
+    end = rest.rfind(">")
+    args = split_template_args(rest[:end])
+    suffix = rest[end + 1:].lstrip("/")
+    brick = args[0].replace("bricks_bench::", "").replace("bricks::", "") if args else ""
+    audio_type = next((a.replace("AudioType::", "") for a in args if a.startswith("AudioType::")), "")
+    other_args = [a for a in args[1:] if not a.startswith("AudioType::")]
+    return {"fixture": fixture, "brick": brick, "audio_type": audio_type, "args": other_args, "suffix": suffix}
+
+
+def make_key(parsed):
+    parts = [parsed["fixture"], parsed["brick"], parsed["audio_type"], ",".join(parsed["args"]), parsed["suffix"]]
+    return "/".join(p for p in parts if p)
+
+
+def normalise(gbench_data):
+    """Convert google benchmark json output to the baseline format. Uses the
+    median and stddev if the benchmarks were run with repetitions"""
+    results = {}
+    for bm in gbench_data["benchmarks"]:
+        run_name = bm.get("run_name", bm["name"])
+        aggregate = bm.get("aggregate_name", "")
+        if bm.get("run_type") == "aggregate" and aggregate not in ("median", "stddev"):
+            continue
+
+        parsed = parse_name(run_name)
+        key = make_key(parsed)
+        entry = results.setdefault(key, {"fixture": parsed["fixture"],
+                                         "brick": parsed["brick"],
+                                         "audio_type": parsed["audio_type"],
+                                         "args": parsed["args"],
+                                         "cpu_time_ns": None,
+                                         "stddev_ns": 0.0,
+                                         "counters": {}})
+        time_ns = bm["cpu_time"] * TIME_UNITS_TO_NS[bm.get("time_unit", "ns")]
+        if aggregate == "stddev":
+            entry["stddev_ns"] = time_ns
+        elif aggregate == "median" or entry["cpu_time_ns"] is None:
+            entry["cpu_time_ns"] = time_ns
+            entry["counters"] = {k: v for k, v in bm.items() if k not in IGNORED_FIELDS}
+
+    context = gbench_data.get("context", {})
+    return {"context": {k: context[k] for k in ("host_name", "num_cpus", "mhz_per_cpu", "library_build_type", "date")
+                        if k in context},
+            "benchmarks": dict(sorted(results.items()))}
+
+
+def load(filename):
+    with open(filename) as f:
+        data = json.load(f)
+    # Baselines have a dict of benchmarks, raw gbench output has a list
+    if isinstance(data.get("benchmarks"), dict):
+        return data
+    return normalise(data)
+
+
+def load_all(filenames):
+    """Merge the results of several benchmark executables"""
+    merged = load(filenames[0])
+    for filename in filenames[1:]:
+        merged["benchmarks"].update(load(filename)["benchmarks"])
+    merged["benchmarks"] = dict(sorted(merged["benchmarks"].items()))
+    return merged
+
+
+def compare(baseline, results, threshold):
+    regressions = 0
+    rows = []
+    for key, new in results["benchmarks"].items():
+        old = baseline["benchmarks"].get(key)
+        if old is None:
+            rows.append((key, None, new["cpu_time_ns"], None, "new"))
+            continue
+        change = new["cpu_time_ns"] / old["cpu_time_ns"] - 1.0
+        noise = NOISE_FACTOR * (old["stddev_ns"] + new["stddev_ns"])
+        diff = new["cpu_time_ns"] - old["cpu_time_ns"]
+        if change > threshold and diff > noise:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -threshold and -diff > noise:
+            status = "improved"
+        else:
+            status = ""
+        rows.append((key, old["cpu_time_ns"], new["cpu_time_ns"], change, status))
+
+    for key in baseline["benchmarks"]:
+        if key not in results["benchmarks"]:
+            rows.append((key, baseline["benchmarks"][key]["cpu_time_ns"], None, None, "missing"))
+
+    width = max((len(r[0]) for r in rows), default=10)
+    print(f"{'Benchmark':<{width}}  {'Baseline ns':>12}  {'New ns':>12}  {'Change':>8}")
+    for key, old, new, change, status in rows:
+        old_str = f"{old:12.1f}" if old is not None else f"{'-':>12}"
+        new_str = f"{new:12.1f}" if new is not None else f"{'-':>12}"
+        change_str = f"{change * 100:+7.1f}%" if change is not None else f"{'-':>8}"
+        print(f"{key:<{width}}  {old_str}  {new_str}  {change_str}  {status}")
+
+    print(f"\n{regressions} regression(s) over {threshold * 100:.1f}% threshold")
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Store and compare bricks_dsp benchmark results")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    save_parser = sub.add_parser("save", help="Normalise google benchmark json output into a baseline file")
+    save_parser.add_argument("baseline")
+    save_parser.add_argument("results", nargs="+")
+
+    compare_parser = sub.add_parser("compare", help="Compare results against a baseline")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("results", nargs="+")
+    compare_parser.add_argument("--threshold", type=float, default=0.05,
+                                help="Relative slowdown to report as a regression, default 0.05 (5%%)")
+
+    args = parser.parse_args()
+    if args.command == "save":
+        data = load_all(args.results)
+        with open(args.baseline, "w") as f:
+            json.dump(data, f, indent=2, sort_keys=True)
+            f.write("\n")
+        print(f"Saved {len(data['benchmarks'])} benchmarks to {args.baseline}")
+        return 0
+
+    regressions = compare(load(args.baseline), load_all(args.results), args.threshold)
+    return 1 if regressions > 0 else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())